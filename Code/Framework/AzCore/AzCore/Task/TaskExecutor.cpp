@@ -259,21 +259,28 @@ namespace AZ
                     Task* task = m_queue.TryDequeue();
                     while (task)
                     {
+                        CompiledTaskGraph* graph = task->m_graph;
                         task->Invoke();
-                        // Decrement counts for all task successors
-                        for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+
+                        // Standalone tasks are not part of a graph and may be resubmitted by their lambda, so they must
+                        // not be accessed once invoked
+                        if (graph)
                         {
-                            Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
-                            if (--successor->m_dependencyCount == 0)
+                            // Decrement counts for all task successors
+                            for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
                             {
-                                m_executor->Submit(*successor);
+                                Task* successor = graph->m_successors[task->m_successorOffset + j];
+                                if (--successor->m_dependencyCount == 0)
+                                {
+                                    m_executor->Submit(*successor);
+                                }
                             }
-                        }
 
-                        bool isRetained = task->m_graph->m_parent != nullptr;
-                        if (task->m_graph->Release() == (isRetained ? 1u : 0u))
-                        {
-                            m_executor->ReleaseGraph();
+                            bool isRetained = graph->m_parent != nullptr;
+                            if (graph->Release() == (isRetained ? 1u : 0u))
+                            {
+                                m_executor->ReleaseGraph();
+                            }
                         }
 
                         task = m_queue.TryDequeue();
@@ -359,6 +366,16 @@ namespace AZ
         return nullptr;
     }
 
+    uint32_t TaskExecutor::GetThreadCount() const
+    {
+        return m_threadCount;
+    }
+
+    bool TaskExecutor::IsTaskWorkerThread()
+    {
+        return GetTaskWorker() != nullptr;
+    }
+
     void TaskExecutor::Submit(Internal::CompiledTaskGraph& graph, TaskGraphEvent* event)
     {
         ++m_graphsRemaining;
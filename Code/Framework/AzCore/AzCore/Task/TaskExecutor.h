@@ -76,8 +76,18 @@ namespace AZ
         // that is currently active
         void Submit(Internal::CompiledTaskGraph& graph, TaskGraphEvent* event);
 
+        // Submit a single task. Tasks which aren't part of a graph are standalone: the executor doesn't access them
+        // once their lambda is invoked, so the lambda may hand the task back to its owner to be resubmitted.
+        // The caller is responsible for keeping standalone tasks alive until they are invoked.
         void Submit(Internal::Task& task);
 
+        // Returns the number of worker threads, so that work can be split into as many tasks as can run at once
+        uint32_t GetThreadCount() const;
+
+        // Returns true when called from one of the worker threads of this executor, such as from within a task.
+        // Waiting on a TaskGraphEvent is unsupported there, so callers can use this to run the work inline instead.
+        bool IsTaskWorkerThread();
+
     private:
         friend class Internal::TaskWorker;
         friend class TaskGraphEvent;
@@ -546,6 +546,26 @@ namespace UnitTest
         ev.Wait();
     }
 
+    TEST_F(TaskGraphTestFixture, IsTaskWorkerThread)
+    {
+        EXPECT_FALSE(m_executor->IsTaskWorkerThread());
+
+        AZStd::atomic<bool> isTaskWorkerThread = false;
+        TaskGraph graph;
+        graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                isTaskWorkerThread = m_executor->IsTaskWorkerThread();
+            });
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_TRUE(isTaskWorkerThread);
+    }
+
     TEST_F(TaskGraphTestFixture, RetainedGraph)
     {
         AZStd::atomic<int> x = 0;
@@ -623,6 +643,36 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphTestFixture, StandaloneTaskResubmittedFromLambda)
+    {
+        constexpr int SubmitCount = 1000;
+        AZStd::atomic<int> x = 0;
+        AZStd::binary_semaphore done;
+        TaskExecutor* executor = m_executor;
+
+        // The task hands itself back to the executor until it ran SubmitCount times
+        Task* taskPtr = nullptr;
+        Task task(
+            defaultTD,
+            [&x, &done, &taskPtr, executor]
+            {
+                if (++x < SubmitCount)
+                {
+                    executor->Submit(*taskPtr);
+                }
+                else
+                {
+                    done.release();
+                }
+            });
+        taskPtr = &task;
+
+        m_executor->Submit(task);
+        done.acquire();
+
+        EXPECT_EQ(SubmitCount, x);
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -12,6 +12,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/functional.h>
 #include <AzFramework/Physics/Material.h>
 
 namespace Physics
@@ -46,6 +47,11 @@ namespace Physics
         uint16_t m_padding{ 0 }; //!< available for future use.
     };
 
+    //! Callback for updating a single sample of the heightfield.
+    //! The column and row are the indices of the sample within the full heightfield grid.
+    //! Providers may call it from several threads at once, but never more than once at a time for the same sample.
+    using UpdateHeightfieldSampleFunction = AZStd::function<void(size_t column, size_t row, const Physics::HeightMaterialPoint& dataPoint)>;
+
     //! An interface to provide heightfield values.
     class HeightfieldProviderRequests
         : public AZ::ComponentBus
@@ -104,6 +110,24 @@ namespace Physics
         //! Returns the list of heights and materials used by the height field.
         //! @return the rows*columns vector of the heights and materials.
         virtual AZStd::vector<Physics::HeightMaterialPoint> GetHeightsAndMaterials() const = 0;
+
+        //! Returns the range of heightfield samples that are affected by a region of the world.
+        //! The range is clamped to the heightfield, and is empty if the region doesn't overlap the heightfield.
+        //! @param region the world space region to get the sample range for. Only the XY extents are used.
+        //! @param startColumn contains the first column of the range.
+        //! @param startRow contains the first row of the range.
+        //! @param numColumns contains the number of columns in the range.
+        //! @param numRows contains the number of rows in the range.
+        virtual void GetHeightfieldIndicesFromRegion(
+            const AZ::Aabb& region, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows) const = 0;
+
+        //! Generates the heights and materials of only the samples affected by a region of the world, so that a heightfield
+        //! can be updated in place without regenerating all of its data.
+        //! All the samples have been updated by the time the call returns.
+        //! @param updateHeightsMaterialsCallback the function to call for every sample within the range of the region.
+        //! @param region the world space region to generate the samples for. The whole heightfield is generated if the region is invalid.
+        virtual void UpdateHeightsAndMaterials(
+            const UpdateHeightfieldSampleFunction& updateHeightsMaterialsCallback, const AZ::Aabb& region) const = 0;
     };
 
     using HeightfieldProviderRequestsBus = AZ::EBus<HeightfieldProviderRequests>;
@@ -116,6 +140,8 @@ namespace Physics
         static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
 
         //! Called whenever the heightfield data changes.
+        //! Listeners can update only the samples within the dirty region, as long as the size, spacing, height bounds and
+        //! transform of the heightfield are unchanged. Otherwise the whole heightfield needs to be regenerated.
         //! @param the AABB of the area of data that changed.
         virtual void OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion)
         {
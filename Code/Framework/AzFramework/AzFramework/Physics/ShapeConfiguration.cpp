@@ -418,6 +418,18 @@ namespace Physics
         m_samples = samples;
     }
 
+    void HeightfieldShapeConfiguration::ModifySample(size_t column, size_t row, const Physics::HeightMaterialPoint& point)
+    {
+        const size_t numColumns = aznumeric_cast<size_t>(m_numColumns);
+        const size_t index = (row * numColumns) + column;
+        AZ_Assert((column < numColumns) && (row < aznumeric_cast<size_t>(m_numRows)) && (index < m_samples.size()),
+            "Heightfield sample (%zu, %zu) is out of range.", column, row);
+        if (index < m_samples.size())
+        {
+            m_samples[index] = point;
+        }
+    }
+
     float HeightfieldShapeConfiguration::GetMinHeightBounds() const
     {
         return m_minHeightBounds;
@@ -229,6 +229,8 @@ namespace Physics
         void SetNumRows(int32_t numRows);
         const AZStd::vector<Physics::HeightMaterialPoint>& GetSamples() const;
         void SetSamples(const AZStd::vector<Physics::HeightMaterialPoint>& samples);
+        //! Replace a single sample, so that the samples can be updated in place when only a region of the heightfield changes.
+        void ModifySample(size_t column, size_t row, const Physics::HeightMaterialPoint& point);
         float GetMinHeightBounds() const;
         void SetMinHeightBounds(float minBounds);
         float GetMaxHeightBounds() const;
@@ -103,4 +103,35 @@ namespace AzFramework::Terrain
 
         //TerrainDataNotificationHandler::Reflect(context);
     }
+
+    void TerrainJobContext::Cancel()
+    {
+        m_cancelled = true;
+    }
+
+    bool TerrainJobContext::IsCancelled() const
+    {
+        return m_cancelled;
+    }
+
+    bool TerrainJobContext::IsComplete() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_completeMutex);
+        return m_complete;
+    }
+
+    void TerrainJobContext::Wait()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_completeMutex);
+        m_completeCondition.wait(lock, [this]() { return m_complete; });
+    }
+
+    void TerrainJobContext::MarkComplete()
+    {
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_completeMutex);
+            m_complete = true;
+        }
+        m_completeCondition.notify_all();
+    }
 } // namespace AzFramework::Terrain
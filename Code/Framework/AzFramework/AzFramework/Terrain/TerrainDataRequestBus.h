@@ -11,7 +11,12 @@
 #include <AzCore/Math/Vector2.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/span.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Entity/EntityContextBus.h>
 #include <AzFramework/Render/GeometryIntersectionStructures.h>
 #include <AzFramework/SurfaceData/SurfaceData.h>
@@ -23,6 +28,46 @@ namespace AzFramework
         typedef AZStd::function<void(size_t xIndex, size_t yIndex, const SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)> SurfacePointRegionFillCallback;
         typedef AZStd::function<void(const SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)> SurfacePointListFillCallback;
 
+        //! Tracks an asynchronous terrain query, and allows it to be cancelled or waited on.
+        class TerrainJobContext final
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(TerrainJobContext, AZ::SystemAllocator, 0);
+
+            //! Request the query to stop. The positions that are already being processed still get reported,
+            //! but no new positions get processed. The completion callback is still called.
+            void Cancel();
+            bool IsCancelled() const;
+
+            //! Returns true once the query has finished processing, including the call to the completion callback.
+            bool IsComplete() const;
+
+            //! Block until the query is complete.
+            void Wait();
+
+            //! Called by the terrain system once the query has finished processing.
+            void MarkComplete();
+
+        private:
+            AZStd::atomic_bool m_cancelled{ false };
+            mutable AZStd::mutex m_completeMutex;
+            AZStd::condition_variable m_completeCondition;
+            bool m_complete = false;
+        };
+
+        //! Optional parameters for the asynchronous terrain queries.
+        struct QueryAsyncParams
+        {
+            //! Use one job for each hardware thread.
+            static constexpr int32_t NumJobsDefault = -1;
+
+            //! The number of jobs that the query is split into. The query never uses more jobs than it has tiles to process.
+            int32_t m_desiredNumberOfJobs = NumJobsDefault;
+
+            //! Called once the query is complete or cancelled, from the thread that finished the query.
+            AZStd::function<void(AZStd::shared_ptr<TerrainJobContext>)> m_completionCallback = nullptr;
+        };
+
         //! Shared interface for terrain system implementations
         class TerrainDataRequests
             : public AZ::EBusTraits
@@ -187,6 +232,31 @@ namespace AzFramework
                 SurfacePointRegionFillCallback perPositionCallback,
                 Sampler sampleFilter = Sampler::DEFAULT) const = 0;
 
+            //! Asynchronous versions of the region queries. The region is split into tiles that get processed in parallel, so
+            //! the callback is called from multiple threads, and the positions aren't reported in order. The callback needs to
+            //! be thread-safe, and needs to stay valid until the query is complete.
+            //! Returns the context of the query, which can be used to cancel it or to wait for it to complete.
+            virtual AZStd::shared_ptr<TerrainJobContext> ProcessHeightsFromRegionAsync(const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                SurfacePointRegionFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT,
+                const QueryAsyncParams& params = {}) const = 0;
+            virtual AZStd::shared_ptr<TerrainJobContext> ProcessNormalsFromRegionAsync(const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                SurfacePointRegionFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT,
+                const QueryAsyncParams& params = {}) const = 0;
+            virtual AZStd::shared_ptr<TerrainJobContext> ProcessSurfaceWeightsFromRegionAsync(const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                SurfacePointRegionFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT,
+                const QueryAsyncParams& params = {}) const = 0;
+            virtual AZStd::shared_ptr<TerrainJobContext> ProcessSurfacePointsFromRegionAsync(const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                SurfacePointRegionFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT,
+                const QueryAsyncParams& params = {}) const = 0;
+
             //! Get the terrain raycast entity context id.
             virtual EntityContextId GetTerrainRaycastEntityContextId() const = 0;
 
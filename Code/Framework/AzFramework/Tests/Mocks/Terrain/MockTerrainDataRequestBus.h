@@ -102,6 +102,14 @@ namespace UnitTest
             ProcessSurfaceWeightsFromRegion, void(const AZ::Aabb&, const AZ::Vector2&, AzFramework::Terrain::SurfacePointRegionFillCallback, Sampler));
         MOCK_CONST_METHOD4(
             ProcessSurfacePointsFromRegion, void(const AZ::Aabb&, const AZ::Vector2&, AzFramework::Terrain::SurfacePointRegionFillCallback, Sampler));
+        MOCK_CONST_METHOD5(
+            ProcessHeightsFromRegionAsync, AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>(const AZ::Aabb&, const AZ::Vector2&, AzFramework::Terrain::SurfacePointRegionFillCallback, Sampler, const AzFramework::Terrain::QueryAsyncParams&));
+        MOCK_CONST_METHOD5(
+            ProcessNormalsFromRegionAsync, AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>(const AZ::Aabb&, const AZ::Vector2&, AzFramework::Terrain::SurfacePointRegionFillCallback, Sampler, const AzFramework::Terrain::QueryAsyncParams&));
+        MOCK_CONST_METHOD5(
+            ProcessSurfaceWeightsFromRegionAsync, AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>(const AZ::Aabb&, const AZ::Vector2&, AzFramework::Terrain::SurfacePointRegionFillCallback, Sampler, const AzFramework::Terrain::QueryAsyncParams&));
+        MOCK_CONST_METHOD5(
+            ProcessSurfacePointsFromRegionAsync, AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>(const AZ::Aabb&, const AZ::Vector2&, AzFramework::Terrain::SurfacePointRegionFillCallback, Sampler, const AzFramework::Terrain::QueryAsyncParams&));
         MOCK_CONST_METHOD0(
             GetTerrainRaycastEntityContextId, AzFramework::EntityContextId());
         MOCK_CONST_METHOD1(
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Scene;
+        class View;
+    }
+
+    namespace Render
+    {
+        //! Types of lights that can be assigned to CpuLightClusters.
+        enum class ClusteredLightType : uint8_t
+        {
+            Point,
+            SimplePoint,
+            SimpleSpot,
+            Disk,
+            Capsule,
+            Quad,
+        };
+
+        //! A light assigned to the clusters, identified by its type and the index of its LightHandle in the owning feature processor.
+        struct ClusteredLight
+        {
+            ClusteredLightType m_type = ClusteredLightType::Point;
+            uint16_t m_handleIndex = 0;
+        };
+
+        //! Describes the perspective view and the cluster grid built by CpuLightClusters.
+        struct CpuLightClustersDescriptor
+        {
+            //! Creates a descriptor from the matrices of an RPI view. The view must use a perspective projection.
+            static CpuLightClustersDescriptor CreateFromView(const RPI::View& view);
+
+            //! World to view matrix. View space is right handed with x right, y up and negative z forward, like RPI::View.
+            Matrix3x4 m_worldToView = Matrix3x4::CreateIdentity();
+            float m_fovY = 1.0f;
+            float m_aspectRatio = 1.0f;
+            float m_nearDistance = 0.1f;
+            float m_farDistance = 1000.0f;
+
+            //! Number of clusters across the screen, down the screen and in depth. Depth slices are distributed exponentially.
+            uint32_t m_clusterCountX = 16;
+            uint32_t m_clusterCountY = 9;
+            uint32_t m_clusterCountZ = 24;
+        };
+
+        //! CPU implementation of clustered light assignment. The view frustum is split into a 3D grid of froxel clusters and
+        //! every light is assigned to the clusters its volume overlaps, so that the lights affecting a point or a box can be
+        //! looked up without testing every light. This gives headless servers and Null RHI runs, which have no GPU light culling,
+        //! a way to answer lighting queries.
+        //! Lights are tested against 4 clusters at a time using SIMD; spot and disk lights additionally use a cone test.
+        class CpuLightClusters final
+        {
+        public:
+            CpuLightClusters() = default;
+            ~CpuLightClusters() = default;
+
+            //! Removes all lights and clears the cluster assignments.
+            void Clear();
+
+            //! Adds a light whose volume is a sphere.
+            void AddSphereLight(ClusteredLightType type, uint16_t handleIndex, const Vector3& center, float radius);
+            //! Adds a light whose volume is a cone with its apex at the given position.
+            void AddSpotLight(
+                ClusteredLightType type, uint16_t handleIndex, const Vector3& apex, const Vector3& direction, float cosConeAngle, float range);
+            //! Adds a light whose volume is a capsule around the segment from start to end.
+            void AddCapsuleLight(ClusteredLightType type, uint16_t handleIndex, const Vector3& start, const Vector3& end, float radius);
+
+            //! Clears the lights, then adds the point, spot, disk, capsule and quad lights from the feature processors of the given scene.
+            void GatherLights(const RPI::Scene& scene);
+
+            //! Builds the clusters for the given view and assigns every light added so far to them.
+            void Build(const CpuLightClustersDescriptor& descriptor);
+
+            //! Appends the lights whose volume contains the world space position to lightsOut.
+            void FindLightsAffectingPoint(const Vector3& position, AZStd::vector<ClusteredLight>& lightsOut) const;
+            //! Appends the lights whose volume overlaps the world space box to lightsOut. Each light is reported once.
+            void FindLightsAffectingAabb(const Aabb& aabb, AZStd::vector<ClusteredLight>& lightsOut) const;
+
+            //! Returns the index of the cluster containing a world space position, or InvalidClusterIndex if it is outside of the view.
+            uint32_t GetClusterIndex(const Vector3& position) const;
+            //! Returns the indices into GetLights() of the lights assigned to a cluster.
+            AZStd::span<const uint32_t> GetClusterLightIndices(uint32_t clusterIndex) const;
+
+            uint32_t GetClusterCount() const;
+            const AZStd::vector<ClusteredLight>& GetLights() const;
+
+            static constexpr uint32_t InvalidClusterIndex = AZStd::numeric_limits<uint32_t>::max();
+
+        private:
+            enum class LightShape : uint8_t
+            {
+                Sphere,
+                Cone,
+                Capsule,
+            };
+
+            // World space volume of a light, used for the exact tests done by the queries.
+            struct LightVolume
+            {
+                LightShape m_shape = LightShape::Sphere;
+                // Bounding sphere of the light volume.
+                Vector3 m_center = Vector3::CreateZero();
+                float m_radius = 0.0f;
+                // Apex and direction for cones, end points for capsules.
+                Vector3 m_start = Vector3::CreateZero();
+                Vector3 m_end = Vector3::CreateZero();
+                float m_cosConeAngle = 0.0f;
+                float m_sinConeAngle = 0.0f;
+                // Cone range or capsule radius.
+                float m_range = 0.0f;
+            };
+
+            // Inclusive range of clusters overlapped by a view space box.
+            struct ClusterRange
+            {
+                uint32_t m_minX = 0;
+                uint32_t m_maxX = 0;
+                uint32_t m_minY = 0;
+                uint32_t m_maxY = 0;
+                uint32_t m_minZ = 0;
+                uint32_t m_maxZ = 0;
+            };
+
+            // Light and cluster pair produced while testing lights, sorted into per cluster lists once all lights are done.
+            struct Assignment
+            {
+                uint32_t m_clusterIndex;
+                uint32_t m_lightIndex;
+            };
+
+            void AddLight(ClusteredLightType type, uint16_t handleIndex, const LightVolume& volume);
+            void BuildClusterBounds();
+            void AssignLight(uint32_t lightIndex);
+
+            // Finds the clusters overlapped by a view space box. Returns false if the box is entirely outside of the clustered volume.
+            // If isContained isn't null, it's set to whether the box is entirely inside of the clustered volume.
+            bool GetClusterRange(const Vector3& viewMin, const Vector3& viewMax, ClusterRange& range, bool* isContained = nullptr) const;
+            uint32_t GetDepthSlice(float depth) const;
+            uint32_t GetFlatIndex(uint32_t x, uint32_t y, uint32_t z) const;
+
+            static bool IsPointInVolume(const LightVolume& volume, const Vector3& position);
+            static bool DoesVolumeOverlapAabb(const LightVolume& volume, const Aabb& aabb);
+
+            CpuLightClustersDescriptor m_descriptor;
+            float m_tanHalfFovX = 1.0f;
+            float m_tanHalfFovY = 1.0f;
+            float m_logFarOverNear = 1.0f;
+
+            // Clusters are stored row by row along x, with each row padded to a multiple of 4 clusters so
+            // lights can always be tested against 4 clusters at once. Padding clusters have inverted bounds and never match.
+            uint32_t m_rowStride = 0;
+            AZStd::vector<float> m_clusterMin[3];
+            AZStd::vector<float> m_clusterMax[3];
+            AZStd::vector<float> m_clusterCenter[3];
+            AZStd::vector<float> m_clusterRadius;
+
+            AZStd::vector<ClusteredLight> m_lights;
+            AZStd::vector<LightVolume> m_lightVolumes;
+
+            // Per cluster light lists. The lights of cluster i are m_clusterLightIndices[m_clusterOffsets[i], m_clusterOffsets[i + 1]).
+            AZStd::vector<uint32_t> m_clusterOffsets;
+            AZStd::vector<uint32_t> m_clusterLightIndices;
+            AZStd::vector<Assignment> m_assignments;
+        };
+    } // namespace Render
+} // namespace AZ
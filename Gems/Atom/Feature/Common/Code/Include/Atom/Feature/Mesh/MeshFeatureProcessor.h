@@ -82,6 +82,9 @@ namespace AZ
             RPI::Cullable::LodConfiguration GetMeshLodConfiguration() const;
             void UpdateDrawPackets(bool forceUpdate = false);
             void BuildCullable();
+            void AddStreamingImagesToLod(
+                const Data::Instance<RPI::Material>& material, float uvUnitsAcrossDiameter, RPI::Cullable::LodData::Lod& lod);
+            void BuildOccluderMesh();
             void UpdateCullBounds(const TransformServiceFeatureProcessor* transformService);
             void UpdateObjectSrg();
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
@@ -113,6 +116,7 @@ namespace AZ
             bool m_cullableNeedsRebuild = false;
             bool m_objectSrgNeedsUpdate = true;
             bool m_excludeFromReflectionCubeMaps = false;
+            bool m_isOccluder = false;
             bool m_visible = true;
             bool m_hasForwardPassIblSpecularMaterial = false;
         };
@@ -179,6 +183,7 @@ namespace AZ
             bool GetRayTracingEnabled(const MeshHandle& meshHandle) const override;
             void SetVisible(const MeshHandle& meshHandle, bool visible) override;
             void SetUseForwardPassIblSpecular(const MeshHandle& meshHandle, bool useForwardPassIblSpecular) override;
+            void SetIsOccluder(const MeshHandle& meshHandle, bool isOccluder) override;
 
             // called when reflection probes are modified in the editor so that meshes can re-evaluate their probes
             void UpdateMeshReflectionProbes();
@@ -111,6 +111,10 @@ namespace AZ
             virtual void SetVisible(const MeshHandle& meshHandle, bool visible) = 0;
             //! Sets the mesh to render IBL specular in the forward pass.
             virtual void SetUseForwardPassIblSpecular(const MeshHandle& meshHandle, bool useForwardPassIblSpecular) = 0;
+            //! Sets the mesh to be used as an occluder. The lowest lod of its model is rendered into the software occlusion
+            //! buffer of camera views (see r_CullSoftwareOcclusion) to cull the objects hidden behind it. Where the lowest lod
+            //! extends past the rendered lod, objects that are visible can be culled.
+            virtual void SetIsOccluder(const MeshHandle& meshHandle, bool isOccluder) = 0;
         };
     } // namespace Render
 } // namespace AZ
@@ -14,6 +14,13 @@
 #include <Atom/RPI.Public/FeatureProcessor.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <AzCore/Math/Obb.h>
+#include <AzCore/std/function/function_template.h>
+
+namespace UnitTest
+{
+    class TransformServiceTests;
+}
 
 namespace AZ
 {
@@ -49,8 +56,17 @@ namespace AZ
                 const AZ::Vector3& nonUniformScale = AZ::Vector3::CreateOne()) override;
             AZ::Transform GetTransformForId(ObjectId id) const override;
             AZ::Vector3 GetNonUniformScaleForId(ObjectId id) const override;
+            void SetLocalAabbForId(ObjectId id, const AZ::Aabb& localAabb) override;
+            AZ::Aabb GetWorldAabbForId(ObjectId id) const override;
+
+            //! Recomputes the world space bounds of every object whose transform or local bounds changed since the last call.
+            //! Must be called during the writeable phase of the frame, before the world bounds are read.
+            void UpdateWorldBounds();
+            //! Gets the world space oriented bounds for a given id. Id must be one reserved earlier.
+            AZ::Obb GetWorldObbForId(ObjectId id) const;
 
         private:
+            friend class UnitTest::TransformServiceTests;
 
             // Holds both regular 4x3 transforms and 3x3 normal transforms with padding at the end of each float3.
             union Float4x3
@@ -62,11 +78,60 @@ namespace AZ
             // Flag value for when the buffers have no empty spaces.
             static const uint32_t NoAvailableTransformIndices = std::numeric_limits<uint32_t>::max();
 
+            // Number of objects whose world bounds are computed together in one SIMD iteration.
+            static constexpr uint32_t ObjectBatchSize = 4;
+            static constexpr uint32_t DirtyBitsPerWord = 32;
+
+            // Dirty ranges closer together than this many objects are merged into a single upload.
+            static constexpr uint32_t UploadRangeMergeDistance = 64;
+            // If the dirty objects can't be covered by this many ranges, everything between the first and last one is uploaded at once.
+            static constexpr size_t MaxUploadRangeCount = 32;
+
+            // Half open range [m_begin, m_end) of object indices.
+            struct ObjectRange
+            {
+                uint32_t m_begin = 0;
+                uint32_t m_end = 0;
+            };
+
+            // Structure-of-arrays copy of the object to world matrices along with the local and world bounds of each object, one
+            // array per component. Every array is padded to a multiple of ObjectBatchSize so whole batches can be loaded and stored.
+            struct ObjectBoundsData
+            {
+                AZStd::vector<float> m_objectToWorld[12];
+                AZStd::vector<float> m_localCenter[3];
+                AZStd::vector<float> m_localHalfExtents[3];
+                AZStd::vector<float> m_worldMin[3];
+                AZStd::vector<float> m_worldMax[3];
+            };
+
             TransformServiceFeatureProcessor(const TransformServiceFeatureProcessor&) = delete;
 
             // Prepare GPU buffers for object transformation matrices
             // Create the buffers if they don't exist. Otherwise, resize them if they are not large enough for the matrices
-            void PrepareBuffers();
+            // Returns true if any buffer was (re)created, in which case its previous contents are lost.
+            bool PrepareBuffers();
+
+            // Grows the structure-of-arrays and dirty bit storage so it can hold objectCount objects.
+            void ResizeObjectBoundsData(uint32_t objectCount);
+
+            // Converts the set bits of a dirty bitset into a list of object ranges to upload and clears the bitset.
+            static void ExtractDirtyRanges(AZStd::vector<uint32_t>& dirtyBits, AZStd::vector<ObjectRange>& ranges);
+
+            // The GPU buffers the transforms are uploaded to.
+            enum class TransformBuffer
+            {
+                ObjectToWorld,
+                ObjectToWorldInverseTranspose,
+                ObjectToWorldHistory
+            };
+            using UploadRangeFunction = AZStd::function<void(TransformBuffer buffer, const AZStd::vector<Float4x3>& data, const ObjectRange& range)>;
+
+            // Calls uploadRange for the ranges of the transforms that changed since they were last uploaded, and for the history
+            // transforms of the objects uploaded last frame. Every object is uploaded if the buffers were recreated.
+            void UploadDirtyTransforms(bool buffersRecreated, const UploadRangeFunction& uploadRange);
+
+            static void SetDirtyBit(AZStd::vector<uint32_t>& dirtyBits, uint32_t index);
 
             void UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg);
 
@@ -86,6 +151,17 @@ namespace AZ
             static const size_t TransformValueSize = sizeof(decltype(m_objectToWorldTransforms)::value_type);
             static const size_t NormalValueSize = sizeof(decltype(m_objectToWorldInverseTransposeTransforms)::value_type);
 
+            // Bounds of each object in structure-of-arrays form, see UpdateWorldBounds()
+            ObjectBoundsData m_boundsData;
+
+            // One bit per object. m_boundsDirtyBits tracks objects whose world bounds need to be recomputed,
+            // m_uploadDirtyBits tracks objects whose transforms need to be uploaded this frame and m_historyDirtyBits tracks
+            // objects whose history transforms need to be uploaded this frame.
+            AZStd::vector<uint32_t> m_boundsDirtyBits;
+            AZStd::vector<uint32_t> m_uploadDirtyBits;
+            AZStd::vector<uint32_t> m_historyDirtyBits;
+            AZStd::vector<ObjectRange> m_uploadRanges;
+
             Data::Instance<RPI::Buffer> m_objectToWorldBuffer;
             Data::Instance<RPI::Buffer> m_objectToWorldInverseTransposeBuffer;
             Data::Instance<RPI::Buffer> m_objectToWorldHistoryBuffer;
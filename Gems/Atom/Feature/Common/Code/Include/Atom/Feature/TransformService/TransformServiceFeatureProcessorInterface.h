@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Vector3.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
@@ -38,6 +39,12 @@ namespace AZ
             virtual AZ::Transform GetTransformForId(ObjectId) const = 0;
             //! Gets the non-uniform scale for a given id. Id must be one reserved earlier.
             virtual AZ::Vector3 GetNonUniformScaleForId(ObjectId id) const = 0;
+
+            //! Sets the local space bounds for a given id. The world space bounds of the object are kept up to date from these
+            //! bounds and the object's transform. Id must be one reserved earlier.
+            virtual void SetLocalAabbForId(ObjectId id, const AZ::Aabb& localAabb) = 0;
+            //! Gets the world space bounds for a given id, as of the last time the world bounds were updated. Id must be one reserved earlier.
+            virtual AZ::Aabb GetWorldAabbForId(ObjectId id) const = 0;
         };
     }
 }
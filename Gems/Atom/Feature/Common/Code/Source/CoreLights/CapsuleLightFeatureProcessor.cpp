@@ -191,5 +191,10 @@ namespace AZ
             return m_lightBufferHandler.GetElementCount();
         }
 
+        const IndexedDataVector<CapsuleLightData>& CapsuleLightFeatureProcessor::GetLightData() const
+        {
+            return m_capsuleLightData;
+        }
+
     } // namespace Render
 } // namespace AZ
@@ -11,6 +11,7 @@
 #include <Atom/Feature/CoreLights/CapsuleLightFeatureProcessorInterface.h>
 #include <Atom/Feature/Utils/GpuBufferHandler.h>
 #include <Atom/Feature/Utils/IndexedDataVector.h>
+#include <CoreLights/CpuLightDataProvider.h>
 #include <Atom/Feature/CoreLights/PhotometricValue.h>
 
 namespace AZ
@@ -22,6 +23,7 @@ namespace AZ
     {
         class CapsuleLightFeatureProcessor final
             : public CapsuleLightFeatureProcessorInterface
+            , public CpuLightDataProvider<CapsuleLightData>
         {
         public:
             AZ_RTTI(AZ::Render::CapsuleLightFeatureProcessor, "{0FC290C5-DD28-4194-8C0B-B90C3291BAF6}", AZ::Render::CapsuleLightFeatureProcessorInterface);
@@ -50,6 +52,9 @@ namespace AZ
             const Data::Instance<RPI::Buffer> GetLightBuffer()const;
             uint32_t GetLightCount()const;
 
+            // CpuLightDataProvider overrides ...
+            const IndexedDataVector<CapsuleLightData>& GetLightData() const override;
+
         private:
             CapsuleLightFeatureProcessor(const CapsuleLightFeatureProcessor&) = delete;
 
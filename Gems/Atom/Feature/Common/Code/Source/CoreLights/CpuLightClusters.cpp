@@ -0,0 +1,689 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/Feature/CoreLights/CpuLightClusters.h>
+
+#include <CoreLights/CapsuleLightFeatureProcessor.h>
+#include <CoreLights/DiskLightFeatureProcessor.h>
+#include <CoreLights/PointLightFeatureProcessor.h>
+#include <CoreLights/QuadLightFeatureProcessor.h>
+#include <CoreLights/SimplePointLightFeatureProcessor.h>
+#include <CoreLights/SimpleSpotLightFeatureProcessor.h>
+
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        namespace
+        {
+            constexpr float CosQuarterPi = 0.70710678f;
+
+            float GetRadiusFromInvRadiusSquared(float invRadiusSquared)
+            {
+                return invRadiusSquared > 0.0f ? 1.0f / AZStd::sqrt(invRadiusSquared) : 0.0f;
+            }
+
+            Vector3 GetClosestPointOnSegment(const Vector3& start, const Vector3& end, const Vector3& point)
+            {
+                const Vector3 segment = end - start;
+                const float lengthSq = segment.GetLengthSq();
+                if (lengthSq <= 0.0f)
+                {
+                    return start;
+                }
+                const float t = AZ::GetClamp((point - start).Dot(segment) / lengthSq, 0.0f, 1.0f);
+                return start + segment * t;
+            }
+
+            // Conservative sphere / cone test, the cone being limited to range along its axis.
+            bool DoesSphereOverlapCone(
+                const Vector3& sphereCenter, float sphereRadius, const Vector3& apex, const Vector3& direction,
+                float cosConeAngle, float sinConeAngle, float range)
+            {
+                const Vector3 apexToCenter = sphereCenter - apex;
+                const float distanceAlongAxis = apexToCenter.Dot(direction);
+                const float distanceToAxisSq = AZ::GetMax(apexToCenter.GetLengthSq() - distanceAlongAxis * distanceAlongAxis, 0.0f);
+                const float distanceToCone = cosConeAngle * AZStd::sqrt(distanceToAxisSq) - distanceAlongAxis * sinConeAngle;
+                return distanceToCone <= sphereRadius && distanceAlongAxis <= sphereRadius + range && distanceAlongAxis >= -sphereRadius;
+            }
+        }
+
+        CpuLightClustersDescriptor CpuLightClustersDescriptor::CreateFromView(const RPI::View& view)
+        {
+            const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
+
+            CpuLightClustersDescriptor descriptor;
+            descriptor.m_worldToView = view.GetWorldToViewMatrixAsMatrix3x4();
+            descriptor.m_fovY = GetPerspectiveMatrixFOV(viewToClip);
+            descriptor.m_aspectRatio = viewToClip.GetElement(1, 1) / viewToClip.GetElement(0, 0);
+
+            // The depth terms of the projection are far / (near - far) and near * far / (near - far), with near and far swapped
+            // when reverse depth is used, so near and far can be recovered regardless of the depth direction.
+            const float depthScale = viewToClip.GetElement(2, 2);
+            const float depthOffset = viewToClip.GetElement(2, 3);
+            const float distance0 = depthOffset / depthScale;
+            const float distance1 = depthOffset / (depthScale + 1.0f);
+            descriptor.m_nearDistance = AZ::GetMin(distance0, distance1);
+            descriptor.m_farDistance = AZ::GetMax(distance0, distance1);
+            return descriptor;
+        }
+
+        void CpuLightClusters::Clear()
+        {
+            m_lights.clear();
+            m_lightVolumes.clear();
+            m_clusterOffsets.clear();
+            m_clusterLightIndices.clear();
+        }
+
+        void CpuLightClusters::AddLight(ClusteredLightType type, uint16_t handleIndex, const LightVolume& volume)
+        {
+            ClusteredLight light;
+            light.m_type = type;
+            light.m_handleIndex = handleIndex;
+            m_lights.push_back(light);
+            m_lightVolumes.push_back(volume);
+        }
+
+        void CpuLightClusters::AddSphereLight(ClusteredLightType type, uint16_t handleIndex, const Vector3& center, float radius)
+        {
+            LightVolume volume;
+            volume.m_shape = LightShape::Sphere;
+            volume.m_center = center;
+            volume.m_radius = radius;
+            AddLight(type, handleIndex, volume);
+        }
+
+        void CpuLightClusters::AddSpotLight(
+            ClusteredLightType type, uint16_t handleIndex, const Vector3& apex, const Vector3& direction, float cosConeAngle, float range)
+        {
+            LightVolume volume;
+            volume.m_shape = LightShape::Cone;
+            volume.m_start = apex;
+            volume.m_end = direction.GetNormalizedSafe();
+            volume.m_cosConeAngle = AZ::GetClamp(cosConeAngle, 0.0f, 1.0f);
+            volume.m_sinConeAngle = AZStd::sqrt(1.0f - volume.m_cosConeAngle * volume.m_cosConeAngle);
+            volume.m_range = range;
+
+            // Tightest sphere around the spherical sector lit by the cone. Narrow cones are bounded by the sphere going through the
+            // apex and the rim, wide ones by the sphere around the rim.
+            if (volume.m_cosConeAngle > CosQuarterPi)
+            {
+                volume.m_radius = range / (2.0f * volume.m_cosConeAngle);
+                volume.m_center = apex + volume.m_end * volume.m_radius;
+            }
+            else
+            {
+                volume.m_radius = range * volume.m_sinConeAngle;
+                volume.m_center = apex + volume.m_end * (range * volume.m_cosConeAngle);
+            }
+            AddLight(type, handleIndex, volume);
+        }
+
+        void CpuLightClusters::AddCapsuleLight(ClusteredLightType type, uint16_t handleIndex, const Vector3& start, const Vector3& end, float radius)
+        {
+            LightVolume volume;
+            volume.m_shape = LightShape::Capsule;
+            volume.m_start = start;
+            volume.m_end = end;
+            volume.m_range = radius;
+            volume.m_center = (start + end) * 0.5f;
+            volume.m_radius = start.GetDistance(end) * 0.5f + radius;
+            AddLight(type, handleIndex, volume);
+        }
+
+        void CpuLightClusters::GatherLights(const RPI::Scene& scene)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "CpuLightClusters: GatherLights");
+
+            Clear();
+
+            if (const PointLightFeatureProcessor* featureProcessor = scene.GetFeatureProcessor<PointLightFeatureProcessor>())
+            {
+                const auto& lightData = featureProcessor->GetLightData();
+                for (size_t i = 0; i < lightData.GetDataCount(); ++i)
+                {
+                    const PointLightData& light = lightData.GetDataVector()[i];
+                    if (light.m_invAttenuationRadiusSquared > 0.0f)
+                    {
+                        AddSphereLight(
+                            ClusteredLightType::Point, lightData.GetDataToIndexVector()[i], Vector3::CreateFromFloat3(light.m_position.data()),
+                            GetRadiusFromInvRadiusSquared(light.m_invAttenuationRadiusSquared));
+                    }
+                }
+            }
+
+            if (const SimplePointLightFeatureProcessor* featureProcessor = scene.GetFeatureProcessor<SimplePointLightFeatureProcessor>())
+            {
+                const auto& lightData = featureProcessor->GetLightData();
+                for (size_t i = 0; i < lightData.GetDataCount(); ++i)
+                {
+                    const SimplePointLightData& light = lightData.GetDataVector()[i];
+                    if (light.m_invAttenuationRadiusSquared > 0.0f)
+                    {
+                        AddSphereLight(
+                            ClusteredLightType::SimplePoint, lightData.GetDataToIndexVector()[i], Vector3::CreateFromFloat3(light.m_position.data()),
+                            GetRadiusFromInvRadiusSquared(light.m_invAttenuationRadiusSquared));
+                    }
+                }
+            }
+
+            if (const SimpleSpotLightFeatureProcessor* featureProcessor = scene.GetFeatureProcessor<SimpleSpotLightFeatureProcessor>())
+            {
+                const auto& lightData = featureProcessor->GetLightData();
+                for (size_t i = 0; i < lightData.GetDataCount(); ++i)
+                {
+                    const SimpleSpotLightData& light = lightData.GetDataVector()[i];
+                    if (light.m_invAttenuationRadiusSquared > 0.0f)
+                    {
+                        AddSpotLight(
+                            ClusteredLightType::SimpleSpot, lightData.GetDataToIndexVector()[i], Vector3::CreateFromFloat3(light.m_position.data()),
+                            Vector3::CreateFromFloat3(light.m_direction.data()), light.m_cosOuterConeAngle,
+                            GetRadiusFromInvRadiusSquared(light.m_invAttenuationRadiusSquared));
+                    }
+                }
+            }
+
+            if (const DiskLightFeatureProcessor* featureProcessor = scene.GetFeatureProcessor<DiskLightFeatureProcessor>())
+            {
+                const auto& lightData = featureProcessor->GetLightData();
+                for (size_t i = 0; i < lightData.GetDataCount(); ++i)
+                {
+                    const DiskLightData& light = lightData.GetDataVector()[i];
+                    if (light.m_invAttenuationRadiusSquared <= 0.0f)
+                    {
+                        continue;
+                    }
+
+                    const Vector3 position = Vector3::CreateFromFloat3(light.m_position.data());
+                    const float attenuationRadius = GetRadiusFromInvRadiusSquared(light.m_invAttenuationRadiusSquared);
+                    if (light.m_flags & DiskLightData::UseConeAngle)
+                    {
+                        // The cone starts behind the disk, at the point where its edges would meet.
+                        const Vector3 direction = Vector3::CreateFromFloat3(light.m_direction.data());
+                        AddSpotLight(
+                            ClusteredLightType::Disk, lightData.GetDataToIndexVector()[i], position - direction * light.m_bulbPositionOffset,
+                            direction, light.m_cosOuterConeAngle, attenuationRadius + light.m_bulbPositionOffset);
+                    }
+                    else
+                    {
+                        AddSphereLight(ClusteredLightType::Disk, lightData.GetDataToIndexVector()[i], position, attenuationRadius);
+                    }
+                }
+            }
+
+            if (const CapsuleLightFeatureProcessor* featureProcessor = scene.GetFeatureProcessor<CapsuleLightFeatureProcessor>())
+            {
+                const auto& lightData = featureProcessor->GetLightData();
+                for (size_t i = 0; i < lightData.GetDataCount(); ++i)
+                {
+                    const CapsuleLightData& light = lightData.GetDataVector()[i];
+                    if (light.m_invAttenuationRadiusSquared > 0.0f)
+                    {
+                        const Vector3 start = Vector3::CreateFromFloat3(light.m_startPoint.data());
+                        const Vector3 end = start + Vector3::CreateFromFloat3(light.m_direction.data()) * light.m_length;
+                        AddCapsuleLight(
+                            ClusteredLightType::Capsule, lightData.GetDataToIndexVector()[i], start, end,
+                            GetRadiusFromInvRadiusSquared(light.m_invAttenuationRadiusSquared));
+                    }
+                }
+            }
+
+            if (const QuadLightFeatureProcessor* featureProcessor = scene.GetFeatureProcessor<QuadLightFeatureProcessor>())
+            {
+                const auto& lightData = featureProcessor->GetLightData();
+                for (size_t i = 0; i < lightData.GetDataCount(); ++i)
+                {
+                    const QuadLightData& light = lightData.GetDataVector()[i];
+                    if (light.m_invAttenuationRadiusSquared > 0.0f)
+                    {
+                        AddSphereLight(
+                            ClusteredLightType::Quad, lightData.GetDataToIndexVector()[i], Vector3::CreateFromFloat3(light.m_position.data()),
+                            GetRadiusFromInvRadiusSquared(light.m_invAttenuationRadiusSquared));
+                    }
+                }
+            }
+        }
+
+        void CpuLightClusters::Build(const CpuLightClustersDescriptor& descriptor)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "CpuLightClusters: Build");
+
+            AZ_Assert(descriptor.m_nearDistance > 0.0f && descriptor.m_farDistance > descriptor.m_nearDistance,
+                "CpuLightClusters requires 0 < near distance < far distance");
+            AZ_Assert(descriptor.m_clusterCountX > 0 && descriptor.m_clusterCountY > 0 && descriptor.m_clusterCountZ > 0,
+                "CpuLightClusters requires at least one cluster in each dimension");
+
+            m_descriptor = descriptor;
+            m_tanHalfFovY = AZStd::tan(descriptor.m_fovY * 0.5f);
+            m_tanHalfFovX = m_tanHalfFovY * descriptor.m_aspectRatio;
+            m_logFarOverNear = logf(descriptor.m_farDistance / descriptor.m_nearDistance);
+
+            BuildClusterBounds();
+
+            m_assignments.clear();
+            for (uint32_t lightIndex = 0; lightIndex < m_lights.size(); ++lightIndex)
+            {
+                AssignLight(lightIndex);
+            }
+
+            // Counting sort of the assignments into per cluster lists. Lights keep their relative order inside each list.
+            const uint32_t clusterCount = GetClusterCount();
+            m_clusterOffsets.clear();
+            m_clusterOffsets.resize(clusterCount + 1, 0);
+            for (const Assignment& assignment : m_assignments)
+            {
+                ++m_clusterOffsets[assignment.m_clusterIndex + 1];
+            }
+            for (uint32_t clusterIndex = 0; clusterIndex < clusterCount; ++clusterIndex)
+            {
+                m_clusterOffsets[clusterIndex + 1] += m_clusterOffsets[clusterIndex];
+            }
+
+            m_clusterLightIndices.resize_no_construct(m_assignments.size());
+            AZStd::vector<uint32_t> writeOffsets(m_clusterOffsets.begin(), m_clusterOffsets.end() - 1);
+            for (const Assignment& assignment : m_assignments)
+            {
+                m_clusterLightIndices[writeOffsets[assignment.m_clusterIndex]++] = assignment.m_lightIndex;
+            }
+        }
+
+        void CpuLightClusters::BuildClusterBounds()
+        {
+            const uint32_t countX = m_descriptor.m_clusterCountX;
+            const uint32_t countY = m_descriptor.m_clusterCountY;
+            const uint32_t countZ = m_descriptor.m_clusterCountZ;
+            m_rowStride = aznumeric_cast<uint32_t>(AZ::SizeAlignUp(countX, Simd::Vec4::ElementCount));
+
+            const size_t clusterCount = GetClusterCount();
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                m_clusterMin[axis].resize_no_construct(clusterCount);
+                m_clusterMax[axis].resize_no_construct(clusterCount);
+                m_clusterCenter[axis].resize_no_construct(clusterCount);
+            }
+            m_clusterRadius.resize_no_construct(clusterCount);
+
+            const auto getSliceDepth = [this, countZ](uint32_t slice)
+            {
+                return m_descriptor.m_nearDistance * expf(m_logFarOverNear * slice / countZ);
+            };
+
+            for (uint32_t z = 0; z < countZ; ++z)
+            {
+                const float nearDepth = getSliceDepth(z);
+                const float farDepth = getSliceDepth(z + 1);
+
+                for (uint32_t y = 0; y < countY; ++y)
+                {
+                    // Slopes of the cluster's bottom and top planes, y / depth.
+                    const float slopeMinY = (2.0f * y / countY - 1.0f) * m_tanHalfFovY;
+                    const float slopeMaxY = (2.0f * (y + 1) / countY - 1.0f) * m_tanHalfFovY;
+
+                    for (uint32_t x = 0; x < m_rowStride; ++x)
+                    {
+                        const uint32_t index = GetFlatIndex(x, y, z);
+                        if (x >= countX)
+                        {
+                            // Padding cluster, inverted bounds never overlap anything.
+                            for (uint32_t axis = 0; axis < 3; ++axis)
+                            {
+                                m_clusterMin[axis][index] = AZStd::numeric_limits<float>::max();
+                                m_clusterMax[axis][index] = -AZStd::numeric_limits<float>::max();
+                                m_clusterCenter[axis][index] = 0.0f;
+                            }
+                            m_clusterRadius[index] = 0.0f;
+                            continue;
+                        }
+
+                        const float slopeMinX = (2.0f * x / countX - 1.0f) * m_tanHalfFovX;
+                        const float slopeMaxX = (2.0f * (x + 1) / countX - 1.0f) * m_tanHalfFovX;
+
+                        const Vector3 clusterMin(
+                            AZ::GetMin(slopeMinX * nearDepth, slopeMinX * farDepth),
+                            AZ::GetMin(slopeMinY * nearDepth, slopeMinY * farDepth),
+                            -farDepth);
+                        const Vector3 clusterMax(
+                            AZ::GetMax(slopeMaxX * nearDepth, slopeMaxX * farDepth),
+                            AZ::GetMax(slopeMaxY * nearDepth, slopeMaxY * farDepth),
+                            -nearDepth);
+                        const Vector3 center = (clusterMin + clusterMax) * 0.5f;
+
+                        for (uint32_t axis = 0; axis < 3; ++axis)
+                        {
+                            m_clusterMin[axis][index] = clusterMin.GetElement(axis);
+                            m_clusterMax[axis][index] = clusterMax.GetElement(axis);
+                            m_clusterCenter[axis][index] = center.GetElement(axis);
+                        }
+                        m_clusterRadius[index] = (clusterMax - center).GetLength();
+                    }
+                }
+            }
+        }
+
+        void CpuLightClusters::AssignLight(uint32_t lightIndex)
+        {
+            using Simd::Vec4;
+
+            const LightVolume& volume = m_lightVolumes[lightIndex];
+            const Vector3 viewCenter = m_descriptor.m_worldToView * volume.m_center;
+            const Vector3 radius(volume.m_radius);
+
+            ClusterRange range;
+            if (!GetClusterRange(viewCenter - radius, viewCenter + radius, range))
+            {
+                return;
+            }
+
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType sphereCenter[3] = {
+                Vec4::Splat(viewCenter.GetX()), Vec4::Splat(viewCenter.GetY()), Vec4::Splat(viewCenter.GetZ())
+            };
+            const Vec4::FloatType sphereRadiusSq = Vec4::Splat(volume.m_radius * volume.m_radius);
+
+            const bool isCone = volume.m_shape == LightShape::Cone;
+            const Vector3 viewApex = m_descriptor.m_worldToView * volume.m_start;
+            const Vector3 viewDirection = m_descriptor.m_worldToView.Multiply3x3(volume.m_end).GetNormalizedSafe();
+            const Vec4::FloatType coneApex[3] = {
+                Vec4::Splat(viewApex.GetX()), Vec4::Splat(viewApex.GetY()), Vec4::Splat(viewApex.GetZ())
+            };
+            const Vec4::FloatType coneDirection[3] = {
+                Vec4::Splat(viewDirection.GetX()), Vec4::Splat(viewDirection.GetY()), Vec4::Splat(viewDirection.GetZ())
+            };
+            const Vec4::FloatType cosConeAngle = Vec4::Splat(volume.m_cosConeAngle);
+            const Vec4::FloatType sinConeAngle = Vec4::Splat(volume.m_sinConeAngle);
+            const Vec4::FloatType coneRange = Vec4::Splat(volume.m_range);
+
+            alignas(16) int32_t laneMasks[Vec4::ElementCount];
+
+            for (uint32_t z = range.m_minZ; z <= range.m_maxZ; ++z)
+            {
+                for (uint32_t y = range.m_minY; y <= range.m_maxY; ++y)
+                {
+                    const uint32_t rowStart = GetFlatIndex(0, y, z);
+                    for (uint32_t x = range.m_minX & ~(Vec4::ElementCount - 1); x <= range.m_maxX; x += Vec4::ElementCount)
+                    {
+                        const uint32_t first = rowStart + x;
+
+                        // Squared distance from the light's bounding sphere center to each cluster box.
+                        Vec4::FloatType distanceSq = zero;
+                        for (uint32_t axis = 0; axis < 3; ++axis)
+                        {
+                            const Vec4::FloatType clusterMin = Vec4::LoadUnaligned(&m_clusterMin[axis][first]);
+                            const Vec4::FloatType clusterMax = Vec4::LoadUnaligned(&m_clusterMax[axis][first]);
+                            const Vec4::FloatType outside = Vec4::Max(
+                                Vec4::Max(Vec4::Sub(clusterMin, sphereCenter[axis]), Vec4::Sub(sphereCenter[axis], clusterMax)), zero);
+                            distanceSq = Vec4::Madd(outside, outside, distanceSq);
+                        }
+                        Vec4::FloatType overlaps = Vec4::CmpLtEq(distanceSq, sphereRadiusSq);
+
+                        if (isCone)
+                        {
+                            // Test the clusters' bounding spheres against the cone.
+                            const Vec4::FloatType clusterRadius = Vec4::LoadUnaligned(&m_clusterRadius[first]);
+                            Vec4::FloatType apexToCenterSq = zero;
+                            Vec4::FloatType distanceAlongAxis = zero;
+                            for (uint32_t axis = 0; axis < 3; ++axis)
+                            {
+                                const Vec4::FloatType apexToCenter = Vec4::Sub(Vec4::LoadUnaligned(&m_clusterCenter[axis][first]), coneApex[axis]);
+                                apexToCenterSq = Vec4::Madd(apexToCenter, apexToCenter, apexToCenterSq);
+                                distanceAlongAxis = Vec4::Madd(apexToCenter, coneDirection[axis], distanceAlongAxis);
+                            }
+                            const Vec4::FloatType distanceToAxis =
+                                Vec4::Sqrt(Vec4::Max(Vec4::Sub(apexToCenterSq, Vec4::Mul(distanceAlongAxis, distanceAlongAxis)), zero));
+                            const Vec4::FloatType distanceToCone =
+                                Vec4::Sub(Vec4::Mul(cosConeAngle, distanceToAxis), Vec4::Mul(distanceAlongAxis, sinConeAngle));
+
+                            const Vec4::FloatType outsideAngle = Vec4::CmpGt(distanceToCone, clusterRadius);
+                            const Vec4::FloatType pastRange = Vec4::CmpGt(distanceAlongAxis, Vec4::Add(clusterRadius, coneRange));
+                            const Vec4::FloatType behindApex = Vec4::CmpLt(distanceAlongAxis, Vec4::Sub(zero, clusterRadius));
+                            overlaps = Vec4::AndNot(Vec4::Or(Vec4::Or(outsideAngle, pastRange), behindApex), overlaps);
+                        }
+
+                        Vec4::StoreAligned(laneMasks, Vec4::CastToInt(overlaps));
+                        for (uint32_t lane = 0; lane < Vec4::ElementCount; ++lane)
+                        {
+                            if (laneMasks[lane] != 0)
+                            {
+                                m_assignments.push_back({ first + lane, lightIndex });
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        bool CpuLightClusters::GetClusterRange(const Vector3& viewMin, const Vector3& viewMax, ClusterRange& range, bool* isContained) const
+        {
+            const float nearDistance = m_descriptor.m_nearDistance;
+            const float farDistance = m_descriptor.m_farDistance;
+
+            // View space looks down negative z.
+            const float minDepth = -viewMax.GetZ();
+            const float maxDepth = -viewMin.GetZ();
+            if (maxDepth < nearDistance || minDepth > farDistance)
+            {
+                return false;
+            }
+
+            const float clampedMinDepth = AZ::GetMax(minDepth, nearDistance);
+            const float clampedMaxDepth = AZ::GetMin(maxDepth, farDistance);
+
+            // Smallest and largest x / depth and y / depth over the box, normalized so the view covers [-1, 1].
+            const auto getSlopeRange = [clampedMinDepth, clampedMaxDepth](float minValue, float maxValue, float tanHalfFov, float& minSlope, float& maxSlope)
+            {
+                minSlope = minValue / (minValue >= 0.0f ? clampedMaxDepth : clampedMinDepth) / tanHalfFov;
+                maxSlope = maxValue / (maxValue >= 0.0f ? clampedMinDepth : clampedMaxDepth) / tanHalfFov;
+            };
+
+            float minSlopeX, maxSlopeX, minSlopeY, maxSlopeY;
+            getSlopeRange(viewMin.GetX(), viewMax.GetX(), m_tanHalfFovX, minSlopeX, maxSlopeX);
+            getSlopeRange(viewMin.GetY(), viewMax.GetY(), m_tanHalfFovY, minSlopeY, maxSlopeY);
+            if (maxSlopeX < -1.0f || minSlopeX > 1.0f || maxSlopeY < -1.0f || minSlopeY > 1.0f)
+            {
+                return false;
+            }
+
+            if (isContained)
+            {
+                *isContained = minDepth >= nearDistance && maxDepth <= farDistance &&
+                    minSlopeX >= -1.0f && maxSlopeX <= 1.0f && minSlopeY >= -1.0f && maxSlopeY <= 1.0f;
+            }
+
+            const auto getCell = [](float slope, uint32_t count)
+            {
+                const float cell = AZStd::floor((slope + 1.0f) * 0.5f * count);
+                return aznumeric_cast<uint32_t>(AZ::GetClamp(cell, 0.0f, aznumeric_cast<float>(count - 1)));
+            };
+
+            range.m_minX = getCell(minSlopeX, m_descriptor.m_clusterCountX);
+            range.m_maxX = getCell(maxSlopeX, m_descriptor.m_clusterCountX);
+            range.m_minY = getCell(minSlopeY, m_descriptor.m_clusterCountY);
+            range.m_maxY = getCell(maxSlopeY, m_descriptor.m_clusterCountY);
+            range.m_minZ = GetDepthSlice(clampedMinDepth);
+            range.m_maxZ = GetDepthSlice(clampedMaxDepth);
+            return true;
+        }
+
+        uint32_t CpuLightClusters::GetDepthSlice(float depth) const
+        {
+            const uint32_t countZ = m_descriptor.m_clusterCountZ;
+            if (depth <= m_descriptor.m_nearDistance)
+            {
+                return 0;
+            }
+            const float slice = AZStd::floor(logf(depth / m_descriptor.m_nearDistance) / m_logFarOverNear * countZ);
+            return aznumeric_cast<uint32_t>(AZ::GetClamp(slice, 0.0f, aznumeric_cast<float>(countZ - 1)));
+        }
+
+        uint32_t CpuLightClusters::GetFlatIndex(uint32_t x, uint32_t y, uint32_t z) const
+        {
+            return (z * m_descriptor.m_clusterCountY + y) * m_rowStride + x;
+        }
+
+        uint32_t CpuLightClusters::GetClusterCount() const
+        {
+            return m_rowStride * m_descriptor.m_clusterCountY * m_descriptor.m_clusterCountZ;
+        }
+
+        const AZStd::vector<ClusteredLight>& CpuLightClusters::GetLights() const
+        {
+            return m_lights;
+        }
+
+        uint32_t CpuLightClusters::GetClusterIndex(const Vector3& position) const
+        {
+            if (m_clusterOffsets.empty())
+            {
+                return InvalidClusterIndex;
+            }
+
+            const Vector3 viewPosition = m_descriptor.m_worldToView * position;
+            ClusterRange range;
+            bool isContained = false;
+            if (!GetClusterRange(viewPosition, viewPosition, range, &isContained) || !isContained)
+            {
+                return InvalidClusterIndex;
+            }
+            return GetFlatIndex(range.m_minX, range.m_minY, range.m_minZ);
+        }
+
+        AZStd::span<const uint32_t> CpuLightClusters::GetClusterLightIndices(uint32_t clusterIndex) const
+        {
+            if (clusterIndex + 1 >= m_clusterOffsets.size())
+            {
+                return {};
+            }
+            const uint32_t begin = m_clusterOffsets[clusterIndex];
+            const uint32_t end = m_clusterOffsets[clusterIndex + 1];
+            return AZStd::span<const uint32_t>(m_clusterLightIndices.data() + begin, end - begin);
+        }
+
+        void CpuLightClusters::FindLightsAffectingPoint(const Vector3& position, AZStd::vector<ClusteredLight>& lightsOut) const
+        {
+            const uint32_t clusterIndex = GetClusterIndex(position);
+            if (clusterIndex != InvalidClusterIndex)
+            {
+                for (const uint32_t lightIndex : GetClusterLightIndices(clusterIndex))
+                {
+                    if (IsPointInVolume(m_lightVolumes[lightIndex], position))
+                    {
+                        lightsOut.push_back(m_lights[lightIndex]);
+                    }
+                }
+                return;
+            }
+
+            // Outside of the clustered volume, fall back to testing every light.
+            for (uint32_t lightIndex = 0; lightIndex < m_lights.size(); ++lightIndex)
+            {
+                if (IsPointInVolume(m_lightVolumes[lightIndex], position))
+                {
+                    lightsOut.push_back(m_lights[lightIndex]);
+                }
+            }
+        }
+
+        void CpuLightClusters::FindLightsAffectingAabb(const Aabb& aabb, AZStd::vector<ClusteredLight>& lightsOut) const
+        {
+            const Aabb viewAabb = aabb.GetTransformedAabb(m_descriptor.m_worldToView);
+
+            ClusterRange range;
+            bool isContained = false;
+            if (!m_clusterOffsets.empty() && GetClusterRange(viewAabb.GetMin(), viewAabb.GetMax(), range, &isContained) && isContained)
+            {
+                AZStd::vector<uint32_t> candidates;
+                for (uint32_t z = range.m_minZ; z <= range.m_maxZ; ++z)
+                {
+                    for (uint32_t y = range.m_minY; y <= range.m_maxY; ++y)
+                    {
+                        for (uint32_t x = range.m_minX; x <= range.m_maxX; ++x)
+                        {
+                            const AZStd::span<const uint32_t> clusterLights = GetClusterLightIndices(GetFlatIndex(x, y, z));
+                            candidates.insert(candidates.end(), clusterLights.begin(), clusterLights.end());
+                        }
+                    }
+                }
+
+                // A light overlapping several of the clusters is only reported once.
+                AZStd::sort(candidates.begin(), candidates.end());
+                candidates.erase(AZStd::unique(candidates.begin(), candidates.end()), candidates.end());
+
+                for (const uint32_t lightIndex : candidates)
+                {
+                    if (DoesVolumeOverlapAabb(m_lightVolumes[lightIndex], aabb))
+                    {
+                        lightsOut.push_back(m_lights[lightIndex]);
+                    }
+                }
+                return;
+            }
+
+            // Part of the box is outside of the clustered volume, fall back to testing every light.
+            for (uint32_t lightIndex = 0; lightIndex < m_lights.size(); ++lightIndex)
+            {
+                if (DoesVolumeOverlapAabb(m_lightVolumes[lightIndex], aabb))
+                {
+                    lightsOut.push_back(m_lights[lightIndex]);
+                }
+            }
+        }
+
+        bool CpuLightClusters::IsPointInVolume(const LightVolume& volume, const Vector3& position)
+        {
+            switch (volume.m_shape)
+            {
+            case LightShape::Cone:
+            {
+                const Vector3 apexToPosition = position - volume.m_start;
+                const float distance = apexToPosition.GetLength();
+                return distance <= volume.m_range && apexToPosition.Dot(volume.m_end) >= volume.m_cosConeAngle * distance;
+            }
+            case LightShape::Capsule:
+                return GetClosestPointOnSegment(volume.m_start, volume.m_end, position).GetDistanceSq(position) <= volume.m_range * volume.m_range;
+            default:
+                return volume.m_center.GetDistanceSq(position) <= volume.m_radius * volume.m_radius;
+            }
+        }
+
+        bool CpuLightClusters::DoesVolumeOverlapAabb(const LightVolume& volume, const Aabb& aabb)
+        {
+            if (aabb.GetDistanceSq(volume.m_center) > volume.m_radius * volume.m_radius)
+            {
+                return false;
+            }
+
+            Vector3 aabbCenter;
+            float aabbRadius;
+            aabb.GetAsSphere(aabbCenter, aabbRadius);
+
+            switch (volume.m_shape)
+            {
+            case LightShape::Cone:
+                return DoesSphereOverlapCone(
+                    aabbCenter, aabbRadius, volume.m_start, volume.m_end, volume.m_cosConeAngle, volume.m_sinConeAngle, volume.m_range);
+            case LightShape::Capsule:
+            {
+                const float maxDistance = volume.m_range + aabbRadius;
+                return GetClosestPointOnSegment(volume.m_start, volume.m_end, aabbCenter).GetDistanceSq(aabbCenter) <= maxDistance * maxDistance;
+            }
+            default:
+                return true;
+            }
+        }
+    } // namespace Render
+} // namespace AZ
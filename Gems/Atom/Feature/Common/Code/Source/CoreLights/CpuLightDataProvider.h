@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/Feature/Utils/IndexedDataVector.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! Implemented by the light feature processors that CpuLightClusters gathers lights from.
+        template<typename LightDataType>
+        class CpuLightDataProvider
+        {
+        public:
+            virtual ~CpuLightDataProvider() = default;
+
+            //! Returns the CPU side light data, used for light queries that don't go through the GPU.
+            virtual const IndexedDataVector<LightDataType>& GetLightData() const = 0;
+        };
+    }
+}
@@ -265,6 +265,11 @@ namespace AZ
             return m_lightBufferHandler.GetElementCount();
         }
 
+        const IndexedDataVector<DiskLightData>& DiskLightFeatureProcessor::GetLightData() const
+        {
+            return m_diskLightData;
+        }
+
         void DiskLightFeatureProcessor::SetShadowsEnabled(LightHandle handle, bool enabled)
         {
             DiskLightData& light = m_diskLightData.GetData(handle.GetIndex());
@@ -12,6 +12,7 @@
 #include <Atom/Feature/CoreLights/PhotometricValue.h>
 #include <Atom/Feature/Utils/GpuBufferHandler.h>
 #include <Atom/Feature/Utils/IndexedDataVector.h>
+#include <CoreLights/CpuLightDataProvider.h>
 #include <Shadows/ProjectedShadowFeatureProcessor.h>
 
 namespace AZ
@@ -23,6 +24,7 @@ namespace AZ
     {
         class DiskLightFeatureProcessor final
             : public DiskLightFeatureProcessorInterface
+            , public CpuLightDataProvider<DiskLightData>
         {
         public:
             AZ_RTTI(AZ::Render::DiskLightFeatureProcessor, "{F69C0188-2C1C-47A5-8187-17433C34AC2B}", AZ::Render::DiskLightFeatureProcessorInterface);
@@ -62,6 +64,9 @@ namespace AZ
             const Data::Instance<RPI::Buffer> GetLightBuffer()const;
             uint32_t GetLightCount()const;
 
+            // CpuLightDataProvider overrides ...
+            const IndexedDataVector<DiskLightData>& GetLightData() const override;
+
         private:
 
             static constexpr const char* FeatureProcessorName = "DiskLightFeatureProcessor";
@@ -188,6 +188,11 @@ namespace AZ
             return m_lightBufferHandler.GetElementCount();
         }
 
+        const IndexedDataVector<PointLightData>& PointLightFeatureProcessor::GetLightData() const
+        {
+            return m_pointLightData;
+        }
+
         void PointLightFeatureProcessor::SetShadowsEnabled(LightHandle handle, bool enabled)
         {
             auto& light = m_pointLightData.GetData(handle.GetIndex());
@@ -12,6 +12,7 @@
 #include <Atom/Feature/CoreLights/PointLightFeatureProcessorInterface.h>
 #include <Atom/Feature/Utils/GpuBufferHandler.h>
 #include <Atom/Feature/Utils/IndexedDataVector.h>
+#include <CoreLights/CpuLightDataProvider.h>
 #include <Shadows/ProjectedShadowFeatureProcessor.h>
 
 namespace AZ
@@ -23,6 +24,7 @@ namespace AZ
     {
         class PointLightFeatureProcessor final
             : public PointLightFeatureProcessorInterface
+            , public CpuLightDataProvider<PointLightData>
         {
         public:
             AZ_RTTI(AZ::Render::PointLightFeatureProcessor, "{C16A39D6-0DDA-4511-9E35-42968702D3B4}", AZ::Render::PointLightFeatureProcessorInterface);
@@ -58,6 +60,9 @@ namespace AZ
             const Data::Instance<RPI::Buffer>  GetLightBuffer() const;
             uint32_t GetLightCount()const;
 
+            // CpuLightDataProvider overrides ...
+            const IndexedDataVector<PointLightData>& GetLightData() const override;
+
         private:
             PointLightFeatureProcessor(const PointLightFeatureProcessor&) = delete;
             using ShadowId = ProjectedShadowFeatureProcessor::ShadowId;
@@ -211,5 +211,10 @@ namespace AZ
             return m_lightBufferHandler.GetElementCount();
         }
 
+        const IndexedDataVector<QuadLightData>& QuadLightFeatureProcessor::GetLightData() const
+        {
+            return m_quadLightData;
+        }
+
     } // namespace Render
 } // namespace AZ
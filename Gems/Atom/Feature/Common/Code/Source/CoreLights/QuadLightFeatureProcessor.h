@@ -11,6 +11,7 @@
 #include <Atom/Feature/CoreLights/QuadLightFeatureProcessorInterface.h>
 #include <Atom/Feature/Utils/GpuBufferHandler.h>
 #include <Atom/Feature/Utils/IndexedDataVector.h>
+#include <CoreLights/CpuLightDataProvider.h>
 
 namespace AZ
 {
@@ -21,6 +22,7 @@ namespace AZ
     {
         class QuadLightFeatureProcessor final
             : public QuadLightFeatureProcessorInterface
+            , public CpuLightDataProvider<QuadLightData>
         {
         public:
             AZ_RTTI(AZ::Render::QuadLightFeatureProcessor, "{F1E50245-5F05-475E-857F-221FB17C7E45}", AZ::Render::QuadLightFeatureProcessorInterface);
@@ -52,6 +54,9 @@ namespace AZ
             const Data::Instance<RPI::Buffer> GetLightBuffer()const;
             uint32_t GetLightCount()const;
 
+            // CpuLightDataProvider overrides ...
+            const IndexedDataVector<QuadLightData>& GetLightData() const override;
+
         private:
             QuadLightFeatureProcessor(const QuadLightFeatureProcessor&) = delete;
 
@@ -162,5 +162,10 @@ namespace AZ
             return m_lightBufferHandler.GetElementCount();
         }
 
+        const IndexedDataVector<SimplePointLightData>& SimplePointLightFeatureProcessor::GetLightData() const
+        {
+            return m_pointLightData;
+        }
+
     } // namespace Render
 } // namespace AZ
@@ -12,6 +12,7 @@
 #include <Atom/Feature/CoreLights/SimplePointLightFeatureProcessorInterface.h>
 #include <Atom/Feature/Utils/GpuBufferHandler.h>
 #include <Atom/Feature/Utils/IndexedDataVector.h>
+#include <CoreLights/CpuLightDataProvider.h>
 
 namespace AZ
 {
@@ -31,6 +32,7 @@ namespace AZ
 
         class SimplePointLightFeatureProcessor final
             : public SimplePointLightFeatureProcessorInterface
+            , public CpuLightDataProvider<SimplePointLightData>
         {
         public:
             AZ_RTTI(AZ::Render::SimplePointLightFeatureProcessor, "{310CE42A-FAD1-4778-ABF5-0DE04AC92246}", AZ::Render::SimplePointLightFeatureProcessorInterface);
@@ -57,6 +59,9 @@ namespace AZ
             const Data::Instance<RPI::Buffer>  GetLightBuffer() const;
             uint32_t GetLightCount()const;
 
+            // CpuLightDataProvider overrides ...
+            const IndexedDataVector<SimplePointLightData>& GetLightData() const override;
+
         private:
             SimplePointLightFeatureProcessor(const SimplePointLightFeatureProcessor&) = delete;
 
@@ -178,5 +178,10 @@ namespace AZ
             return m_lightBufferHandler.GetElementCount();
         }
 
+        const IndexedDataVector<SimpleSpotLightData>& SimpleSpotLightFeatureProcessor::GetLightData() const
+        {
+            return m_pointLightData;
+        }
+
     } // namespace Render
 } // namespace AZ
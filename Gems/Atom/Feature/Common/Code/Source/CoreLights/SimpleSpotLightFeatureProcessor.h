@@ -12,6 +12,7 @@
 #include <Atom/Feature/CoreLights/SimpleSpotLightFeatureProcessorInterface.h>
 #include <Atom/Feature/Utils/GpuBufferHandler.h>
 #include <Atom/Feature/Utils/IndexedDataVector.h>
+#include <CoreLights/CpuLightDataProvider.h>
 
 namespace AZ
 {
@@ -33,6 +34,7 @@ namespace AZ
 
         class SimpleSpotLightFeatureProcessor final
             : public SimpleSpotLightFeatureProcessorInterface
+            , public CpuLightDataProvider<SimpleSpotLightData>
         {
         public:
             AZ_RTTI(AZ::Render::SimpleSpotLightFeatureProcessor, "{01610AD4-0872-4F80-9F12-22FB7CCF6866}", AZ::Render::SimpleSpotLightFeatureProcessorInterface);
@@ -61,6 +63,9 @@ namespace AZ
             const Data::Instance<RPI::Buffer>  GetLightBuffer() const;
             uint32_t GetLightCount()const;
 
+            // CpuLightDataProvider overrides ...
+            const IndexedDataVector<SimpleSpotLightData>& GetLightData() const override;
+
         private:
             SimpleSpotLightFeatureProcessor(const SimpleSpotLightFeatureProcessor&) = delete;
 
@@ -80,6 +80,9 @@ namespace AZ
             AZ::Job* parentJob = packet.m_parentJob;
             AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
 
+            // Recompute the world bounds of every moved mesh in one pass, the jobs below only read the results.
+            m_transformService->UpdateWorldBounds();
+
             const auto iteratorRanges = m_modelData.GetParallelRanges();
             AZ::JobCompletion jobCompletion;
             for (const auto& iteratorRange : iteratorRanges)
@@ -309,6 +312,7 @@ namespace AZ
             {
                 ModelDataInstance& modelData = *meshHandle;
                 modelData.m_aabb = localAabb;
+                m_transformService->SetLocalAabbForId(modelData.m_objectId, localAabb);
                 modelData.m_cullBoundsNeedsUpdate = true;
                 modelData.m_objectSrgNeedsUpdate = true;
             }
@@ -411,6 +415,24 @@ namespace AZ
             }
         }
 
+        void MeshFeatureProcessor::SetIsOccluder(const MeshHandle& meshHandle, bool isOccluder)
+        {
+            if (meshHandle.IsValid() && meshHandle->m_isOccluder != isOccluder)
+            {
+                meshHandle->m_isOccluder = isOccluder;
+                if (isOccluder)
+                {
+                    // The occluder mesh is built with the cullable, once the model is loaded
+                    meshHandle->m_cullableNeedsRebuild = meshHandle->m_model != nullptr;
+                }
+                else
+                {
+                    meshHandle->m_scene->GetCullingScene()->UnregisterOccluder(meshHandle->m_cullable);
+                    meshHandle->m_cullable.m_occluderData.m_mesh.reset();
+                }
+            }
+        }
+
         void MeshFeatureProcessor::SetRayTracingEnabled(const MeshHandle& meshHandle, bool rayTracingEnabled)
         {
             if (meshHandle.IsValid())
@@ -632,6 +654,8 @@ namespace AZ
         void ModelDataInstance::DeInit()
         {
             m_scene->GetCullingScene()->UnregisterCullable(m_cullable);
+            m_scene->GetCullingScene()->UnregisterOccluder(m_cullable);
+            m_cullable.m_occluderData.m_mesh.reset();
 
             RemoveRayTracingData();
 
@@ -665,6 +689,7 @@ namespace AZ
             }
 
             m_aabb = model->GetModelAsset()->GetAabb();
+            m_scene->GetFeatureProcessor<TransformServiceFeatureProcessor>()->SetLocalAabbForId(m_objectId, m_aabb);
 
             m_cullableNeedsRebuild = true;
             m_cullBoundsNeedsUpdate = true;
@@ -1077,6 +1102,100 @@ namespace AZ
             }
         }
 
+        // Returns the number of UV units across one meter of the mesh, from the ratio of the UV area to the model space area of its
+        // triangles. Returns 0 when the positions, first UV set or indices of the mesh aren't readable on the CPU.
+        static float GetMeshUvDensity(const RPI::ModelLodAsset::Mesh& mesh)
+        {
+            static const Name positionSemantic{ "POSITION" };
+            static const Name uvSemantic{ "UV" };
+            const AZStd::span<const float> positions = mesh.GetSemanticBufferTyped<float>(positionSemantic);
+            const AZStd::span<const float> uvs = mesh.GetSemanticBufferTyped<float>(uvSemantic);
+            const size_t vertexCount = AZStd::min(positions.size() / 3, uvs.size() / 2);
+
+            float positionArea = 0.0f;
+            float uvArea = 0.0f;
+            auto addTriangles = [&](auto indices)
+            {
+                for (size_t index = 0; index + 2 < indices.size(); index += 3)
+                {
+                    const size_t a = indices[index];
+                    const size_t b = indices[index + 1];
+                    const size_t c = indices[index + 2];
+                    if (a >= vertexCount || b >= vertexCount || c >= vertexCount)
+                    {
+                        continue;
+                    }
+
+                    const Vector3 positionA = Vector3::CreateFromFloat3(&positions[a * 3]);
+                    const Vector3 positionB = Vector3::CreateFromFloat3(&positions[b * 3]);
+                    const Vector3 positionC = Vector3::CreateFromFloat3(&positions[c * 3]);
+                    positionArea += (positionB - positionA).Cross(positionC - positionA).GetLength();
+
+                    const Vector2 uvA = Vector2::CreateFromFloat2(&uvs[a * 2]);
+                    const Vector2 uvB = Vector2::CreateFromFloat2(&uvs[b * 2]);
+                    const Vector2 uvC = Vector2::CreateFromFloat2(&uvs[c * 2]);
+                    const Vector2 uvEdge1 = uvB - uvA;
+                    const Vector2 uvEdge2 = uvC - uvA;
+                    uvArea += AZStd::abs(uvEdge1.GetX() * uvEdge2.GetY() - uvEdge1.GetY() * uvEdge2.GetX());
+                }
+            };
+
+            const uint32_t indexSize = mesh.GetIndexBufferAssetView().GetBufferViewDescriptor().m_elementSize;
+            if (indexSize == sizeof(uint16_t))
+            {
+                addTriangles(mesh.GetIndexBufferTyped<uint16_t>());
+            }
+            else if (indexSize == sizeof(uint32_t))
+            {
+                addTriangles(mesh.GetIndexBufferTyped<uint32_t>());
+            }
+
+            // Both areas are doubled, which cancels out in the ratio
+            return (positionArea > 0.0f && uvArea > 0.0f) ? Sqrt(uvArea / positionArea) : 0.0f;
+        }
+
+        void ModelDataInstance::AddStreamingImagesToLod(
+            const Data::Instance<RPI::Material>& material, float uvUnitsAcrossDiameter, RPI::Cullable::LodData::Lod& lod)
+        {
+            if (!material || uvUnitsAcrossDiameter <= 0.0f)
+            {
+                return;
+            }
+
+            for (const RPI::MaterialPropertyValue& propertyValue : material->GetPropertyValues())
+            {
+                if (!propertyValue.Is<Data::Instance<RPI::Image>>())
+                {
+                    continue;
+                }
+
+                RPI::StreamingImage* streamingImage = azrtti_cast<RPI::StreamingImage*>(propertyValue.GetValue<Data::Instance<RPI::Image>>().get());
+                if (!streamingImage)
+                {
+                    continue;
+                }
+
+                const RHI::Size& imageSize = streamingImage->GetDescriptor().m_size;
+                const float texelsAcrossDiameter = aznumeric_cast<float>(AZStd::max(imageSize.m_width, imageSize.m_height)) * uvUnitsAcrossDiameter;
+
+                // When several meshes of the lod sample the same image, the one with the highest texel density decides its mip level
+                const auto isSameImage = [streamingImage](const RPI::Cullable::LodData::StreamingImageUsage& usage)
+                {
+                    return usage.m_image.get() == streamingImage;
+                };
+                auto usageIt = AZStd::find_if(lod.m_streamingImages.begin(), lod.m_streamingImages.end(), isSameImage);
+                if (usageIt != lod.m_streamingImages.end())
+                {
+                    usageIt->m_texelsAcrossDiameter = AZStd::max(usageIt->m_texelsAcrossDiameter, texelsAcrossDiameter);
+                    continue;
+                }
+
+                RPI::Cullable::LodData::StreamingImageUsage& usage = lod.m_streamingImages.emplace_back();
+                usage.m_image = streamingImage;
+                usage.m_texelsAcrossDiameter = texelsAcrossDiameter;
+            }
+        }
+
         void ModelDataInstance::BuildCullable()
         {
             AZ_Assert(m_cullableNeedsRebuild, "This function only needs to be called if the cullable to be rebuilt");
@@ -1092,6 +1211,14 @@ namespace AZ
             const auto& lodAssets = m_model->GetModelAsset()->GetLodAssets();
             AZ_Assert(lodAssets.size() == modelLodCount, "Number of asset lods must match number of model lods");
 
+            // Culling only requests the mip levels of the streaming images when r_CullStreamingImageMips is on, otherwise they
+            // are streamed in fully, so the texel densities of the meshes are only computed then.
+            bool requestStreamingImageMips = false;
+            if (auto* console = AZ::Interface<AZ::IConsole>::Get())
+            {
+                console->GetCvarValue("r_CullStreamingImageMips", requestStreamingImageMips);
+            }
+
             lodData.m_lods.resize(modelLodCount);
             cullData.m_drawListMask.reset();
 
@@ -1123,7 +1250,8 @@ namespace AZ
                 }
 
                 lod.m_drawPackets.clear();
-                for (const RPI::MeshDrawPacket& meshDrawPacket : m_drawPacketListsByLod[lodIndex])
+                lod.m_streamingImages.clear();
+                for (RPI::MeshDrawPacket& meshDrawPacket : m_drawPacketListsByLod[lodIndex])
                 {
                     const RHI::DrawPacket* rhiDrawPacket = meshDrawPacket.GetRHIDrawPacket();
 
@@ -1133,6 +1261,13 @@ namespace AZ
                         cullData.m_drawListMask |= rhiDrawPacket->GetDrawListMask();
 
                         lod.m_drawPackets.push_back(rhiDrawPacket);
+
+                        const AZStd::span<const RPI::ModelLodAsset::Mesh> meshAssets = lodAssets[lodIndex]->GetMeshes();
+                        if (requestStreamingImageMips && meshDrawPacket.GetModelLodMeshIndex() < meshAssets.size())
+                        {
+                            const float uvDensity = GetMeshUvDensity(meshAssets[meshDrawPacket.GetModelLodMeshIndex()]);
+                            AddStreamingImagesToLod(meshDrawPacket.GetMaterial(), uvDensity * 2.0f * lodData.m_lodSelectionRadius, lod);
+                        }
                     }
                 }
             }
@@ -1145,6 +1280,15 @@ namespace AZ
 
             cullData.m_scene = m_scene;     //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
 
+            if (m_isOccluder)
+            {
+                BuildOccluderMesh();
+            }
+            else
+            {
+                m_cullable.m_occluderData.m_mesh.reset();
+            }
+
 #ifdef AZ_CULL_DEBUG_ENABLED
             m_cullable.SetDebugName(AZ::Name(AZStd::string::format("%s - objectId: %u", m_model->GetModelAsset()->GetName().GetCStr(), m_objectId.GetIndex())));
 #endif
@@ -1153,28 +1297,89 @@ namespace AZ
             m_cullBoundsNeedsUpdate = true;
         }
 
+        void ModelDataInstance::BuildOccluderMesh()
+        {
+            // Occluders are rendered at a low resolution, so the lowest lod is used to keep the rasterization cost down
+            const auto& lodAssets = m_model->GetModelAsset()->GetLodAssets();
+            if (lodAssets.empty())
+            {
+                m_scene->GetCullingScene()->UnregisterOccluder(m_cullable);
+                m_cullable.m_occluderData.m_mesh.reset();
+                return;
+            }
+
+            auto occluderMesh = AZStd::make_shared<RPI::Cullable::OccluderMesh>();
+            static const Name positionSemantic{ "POSITION" };
+            for (const RPI::ModelLodAsset::Mesh& mesh : lodAssets.back()->GetMeshes())
+            {
+                const AZStd::span<const float> positions = mesh.GetSemanticBufferTyped<float>(positionSemantic);
+                const uint32_t vertexCount = aznumeric_cast<uint32_t>(positions.size() / 3);
+                if (vertexCount == 0)
+                {
+                    continue;
+                }
+
+                const uint32_t baseVertex = aznumeric_cast<uint32_t>(occluderMesh->m_positions.size());
+                for (uint32_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+                {
+                    occluderMesh->m_positions.push_back(Vector3::CreateFromFloat3(&positions[vertexIndex * 3]));
+                }
+
+                const uint32_t indexSize = mesh.GetIndexBufferAssetView().GetBufferViewDescriptor().m_elementSize;
+                if (indexSize == sizeof(uint16_t))
+                {
+                    for (uint16_t index : mesh.GetIndexBufferTyped<uint16_t>())
+                    {
+                        occluderMesh->m_indices.push_back(baseVertex + index);
+                    }
+                }
+                else if (indexSize == sizeof(uint32_t))
+                {
+                    for (uint32_t index : mesh.GetIndexBufferTyped<uint32_t>())
+                    {
+                        occluderMesh->m_indices.push_back(baseVertex + index);
+                    }
+                }
+            }
+
+            if (occluderMesh->m_indices.empty())
+            {
+                AZ_Warning("MeshFeatureProcessor", false, "Model '%s' has no triangles readable on the CPU, it won't be used as an occluder.",
+                    m_model->GetModelAsset()->GetName().GetCStr());
+                m_scene->GetCullingScene()->UnregisterOccluder(m_cullable);
+                m_cullable.m_occluderData.m_mesh.reset();
+                return;
+            }
+
+            m_cullable.m_occluderData.m_mesh = AZStd::move(occluderMesh);
+        }
+
         void ModelDataInstance::UpdateCullBounds(const TransformServiceFeatureProcessor* transformService)
         {
             AZ_Assert(m_cullBoundsNeedsUpdate, "This function only needs to be called if the culling bounds need to be rebuilt");
             AZ_Assert(m_model, "The model has not finished loading yet");
 
-            Transform localToWorld = transformService->GetTransformForId(m_objectId);
-            Vector3 nonUniformScale = transformService->GetNonUniformScaleForId(m_objectId);
+            // The world bounds were already computed in bulk by TransformServiceFeatureProcessor::UpdateWorldBounds()
+            const Aabb worldAabb = transformService->GetWorldAabbForId(m_objectId);
 
             Vector3 center;
             float radius;
-            Aabb localAabb = m_aabb;
-            localAabb.MultiplyByScale(nonUniformScale);
-
-            localAabb.GetTransformedAabb(localToWorld).GetAsSphere(center, radius);
+            worldAabb.GetAsSphere(center, radius);
 
             m_cullable.m_cullData.m_boundingSphere = Sphere(center, radius);
-            m_cullable.m_cullData.m_boundingObb = localAabb.GetTransformedObb(localToWorld);
-            m_cullable.m_cullData.m_visibilityEntry.m_boundingVolume = localAabb.GetTransformedAabb(localToWorld);
+            m_cullable.m_cullData.m_boundingObb = transformService->GetWorldObbForId(m_objectId);
+            m_cullable.m_cullData.m_visibilityEntry.m_boundingVolume = worldAabb;
             m_cullable.m_cullData.m_visibilityEntry.m_userData = &m_cullable;
             m_cullable.m_cullData.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_RPI_Cullable;
             m_scene->GetCullingScene()->RegisterOrUpdateCullable(m_cullable);
 
+            if (m_cullable.m_occluderData.m_mesh)
+            {
+                m_cullable.m_occluderData.m_localToWorld = Matrix3x4::CreateFromTransform(transformService->GetTransformForId(m_objectId)) *
+                    Matrix3x4::CreateScale(transformService->GetNonUniformScaleForId(m_objectId));
+                m_scene->GetCullingScene()->RegisterOrUpdateOccluder(m_cullable);
+            }
+
             m_cullBoundsNeedsUpdate = false;
         }
 
@@ -14,6 +14,9 @@
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/Utils/Utils.h>
 
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Math/SimdMath.h>
+
 #include <cinttypes>
 
 namespace AZ
@@ -50,6 +53,13 @@ namespace AZ
         {
             m_objectToWorldTransforms = {};
             m_objectToWorldInverseTransposeTransforms = {};
+            m_objectToWorldHistoryTransforms = {};
+
+            m_boundsData = {};
+            m_boundsDirtyBits = {};
+            m_uploadDirtyBits = {};
+            m_historyDirtyBits = {};
+            m_uploadRanges = {};
 
             m_objectToWorldBuffer = nullptr;
             m_objectToWorldInverseTransposeBuffer = nullptr;
@@ -67,10 +77,12 @@ namespace AZ
             m_updateSceneSrgHandler.Disconnect();
         }
         
-        void TransformServiceFeatureProcessor::PrepareBuffers()
+        bool TransformServiceFeatureProcessor::PrepareBuffers()
         {
             AZ_Assert(!m_isWriteable, "Must be called between OnBeginPrepareRender() and OnEndPrepareRender()");
 
+            bool buffersRecreated = false;
+
             RHI::BufferDescriptor desc;
             desc.m_bindFlags = RHI::BufferBindFlags::ShaderRead;
 
@@ -93,6 +105,7 @@ namespace AZ
 
                     desc2.m_bufferName = "m_objectToWorldHistoryBuffer";
                     m_objectToWorldHistoryBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersRecreated = true;
                 }
                 else
                 {
@@ -100,6 +113,7 @@ namespace AZ
                     {
                         m_objectToWorldBuffer->Resize(byteCount);
                         m_objectToWorldHistoryBuffer->Resize(byteCount);
+                        buffersRecreated = true;
                     }
                 }
             }
@@ -120,15 +134,85 @@ namespace AZ
                     desc2.m_elementSize = elementSize;
 
                     m_objectToWorldInverseTransposeBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersRecreated = true;
                 }
                 else
                 {
                     if (byteCount > m_objectToWorldInverseTransposeBuffer->GetBufferSize())
                     {
                         m_objectToWorldInverseTransposeBuffer->Resize(byteCount);
+                        buffersRecreated = true;
                     }
                 }
             }
+
+            return buffersRecreated;
+        }
+
+        void TransformServiceFeatureProcessor::ResizeObjectBoundsData(uint32_t objectCount)
+        {
+            const size_t paddedObjectCount = AZ::SizeAlignUp(objectCount, ObjectBatchSize);
+            if (paddedObjectCount > m_boundsData.m_worldMin[0].size())
+            {
+                for (AZStd::vector<float>& component : m_boundsData.m_objectToWorld)
+                {
+                    component.resize(paddedObjectCount, 0.0f);
+                }
+                for (uint32_t i = 0; i < 3; ++i)
+                {
+                    m_boundsData.m_localCenter[i].resize(paddedObjectCount, 0.0f);
+                    m_boundsData.m_localHalfExtents[i].resize(paddedObjectCount, 0.0f);
+                    m_boundsData.m_worldMin[i].resize(paddedObjectCount, 0.0f);
+                    m_boundsData.m_worldMax[i].resize(paddedObjectCount, 0.0f);
+                }
+            }
+
+            const size_t wordCount = (objectCount + DirtyBitsPerWord - 1) / DirtyBitsPerWord;
+            if (wordCount > m_boundsDirtyBits.size())
+            {
+                m_boundsDirtyBits.resize(wordCount, 0);
+                m_uploadDirtyBits.resize(wordCount, 0);
+                m_historyDirtyBits.resize(wordCount, 0);
+            }
+        }
+
+        void TransformServiceFeatureProcessor::SetDirtyBit(AZStd::vector<uint32_t>& dirtyBits, uint32_t index)
+        {
+            dirtyBits[index / DirtyBitsPerWord] |= 1u << (index % DirtyBitsPerWord);
+        }
+
+        void TransformServiceFeatureProcessor::ExtractDirtyRanges(AZStd::vector<uint32_t>& dirtyBits, AZStd::vector<ObjectRange>& ranges)
+        {
+            ranges.clear();
+
+            for (uint32_t wordIndex = 0; wordIndex < dirtyBits.size(); ++wordIndex)
+            {
+                uint32_t bits = dirtyBits[wordIndex];
+                dirtyBits[wordIndex] = 0;
+
+                while (bits != 0)
+                {
+                    const uint32_t objectIndex = wordIndex * DirtyBitsPerWord + az_ctz_u32(bits);
+                    bits &= bits - 1;
+
+                    // Small gaps are cheaper to upload than to issue another buffer update for.
+                    if (!ranges.empty() && objectIndex < ranges.back().m_end + UploadRangeMergeDistance)
+                    {
+                        ranges.back().m_end = objectIndex + 1;
+                    }
+                    else
+                    {
+                        ranges.push_back({ objectIndex, objectIndex + 1 });
+                    }
+                }
+            }
+
+            if (ranges.size() > MaxUploadRangeCount)
+            {
+                const ObjectRange coveringRange = { ranges.front().m_begin, ranges.back().m_end };
+                ranges.clear();
+                ranges.push_back(coveringRange);
+            }
         }
 
         void TransformServiceFeatureProcessor::UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg)
@@ -138,30 +222,74 @@ namespace AZ
             sceneSrg->SetBufferView(m_objectToWorldHistoryBufferIndex, m_objectToWorldHistoryBuffer->GetBufferView());
         }
 
-        void TransformServiceFeatureProcessor::OnBeginPrepareRender()
+        void TransformServiceFeatureProcessor::UploadDirtyTransforms(bool buffersRecreated, const UploadRangeFunction& uploadRange)
         {
-            m_isWriteable = false;
-
-            if (m_historyBufferNeedsUpdate || m_deviceBufferNeedsUpdate)
+            if (buffersRecreated)
             {
-                PrepareBuffers();
-                if (m_historyBufferNeedsUpdate)
+                // Newly created or resized buffers have no contents, so every object has to be uploaded again.
+                AZStd::fill(m_uploadDirtyBits.begin(), m_uploadDirtyBits.end(), 0u);
+                for (uint32_t objectIndex = 0; objectIndex < m_objectToWorldTransforms.size(); ++objectIndex)
                 {
-                    m_objectToWorldHistoryBuffer->UpdateData(m_objectToWorldHistoryTransforms.data(), m_objectToWorldHistoryTransforms.size() * TransformValueSize);
-                    m_historyBufferNeedsUpdate = false;
+                    SetDirtyBit(m_uploadDirtyBits, objectIndex);
                 }
+                m_historyDirtyBits = m_uploadDirtyBits;
+                m_historyBufferNeedsUpdate = true;
+                m_deviceBufferNeedsUpdate = true;
+            }
 
-                if (m_deviceBufferNeedsUpdate)
+            if (m_historyBufferNeedsUpdate)
+            {
+                // The history holds the transforms of the objects that were uploaded last frame
+                ExtractDirtyRanges(m_historyDirtyBits, m_uploadRanges);
+                for (const ObjectRange& range : m_uploadRanges)
                 {
-                    // copy data to the buffers
-                    m_objectToWorldBuffer->UpdateData(m_objectToWorldTransforms.data(), m_objectToWorldTransforms.size() * TransformValueSize);
-                    m_objectToWorldInverseTransposeBuffer->UpdateData(m_objectToWorldInverseTransposeTransforms.data(), m_objectToWorldInverseTransposeTransforms.size() * NormalValueSize);
+                    uploadRange(TransformBuffer::ObjectToWorldHistory, m_objectToWorldHistoryTransforms, range);
+                }
+                m_historyBufferNeedsUpdate = false;
+            }
 
-                    m_objectToWorldHistoryTransforms = m_objectToWorldTransforms;
+            if (m_deviceBufferNeedsUpdate)
+            {
+                // copy only the modified ranges to the buffers
+                m_historyDirtyBits = m_uploadDirtyBits;
+                ExtractDirtyRanges(m_uploadDirtyBits, m_uploadRanges);
+                for (const ObjectRange& range : m_uploadRanges)
+                {
+                    uploadRange(TransformBuffer::ObjectToWorld, m_objectToWorldTransforms, range);
+                    uploadRange(TransformBuffer::ObjectToWorldInverseTranspose, m_objectToWorldInverseTransposeTransforms, range);
 
-                    m_deviceBufferNeedsUpdate = false;
-                    m_historyBufferNeedsUpdate = true;
+                    AZStd::copy(
+                        m_objectToWorldTransforms.begin() + range.m_begin,
+                        m_objectToWorldTransforms.begin() + range.m_end,
+                        m_objectToWorldHistoryTransforms.begin() + range.m_begin);
                 }
+
+                m_deviceBufferNeedsUpdate = false;
+                m_historyBufferNeedsUpdate = true;
+            }
+        }
+
+        void TransformServiceFeatureProcessor::OnBeginPrepareRender()
+        {
+            m_isWriteable = false;
+
+            if (m_historyBufferNeedsUpdate || m_deviceBufferNeedsUpdate)
+            {
+                UploadDirtyTransforms(PrepareBuffers(),
+                    [this](TransformBuffer buffer, const AZStd::vector<Float4x3>& data, const ObjectRange& range)
+                    {
+                        RPI::Buffer* targetBuffer = m_objectToWorldBuffer.get();
+                        if (buffer == TransformBuffer::ObjectToWorldInverseTranspose)
+                        {
+                            targetBuffer = m_objectToWorldInverseTransposeBuffer.get();
+                        }
+                        else if (buffer == TransformBuffer::ObjectToWorldHistory)
+                        {
+                            targetBuffer = m_objectToWorldHistoryBuffer.get();
+                        }
+                        targetBuffer->UpdateData(
+                            data.data() + range.m_begin, (range.m_end - range.m_begin) * TransformValueSize, range.m_begin * TransformValueSize);
+                    });
             }
         }
 
@@ -185,6 +313,13 @@ namespace AZ
                 m_objectToWorldTransforms.push_back();
                 m_objectToWorldInverseTransposeTransforms.push_back();
                 m_objectToWorldHistoryTransforms.push_back();
+                ResizeObjectBoundsData(modelIndex + 1);
+            }
+
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                m_boundsData.m_localCenter[i][modelIndex] = 0.0f;
+                m_boundsData.m_localHalfExtents[i][modelIndex] = 0.0f;
             }
             return ObjectId(modelIndex);
         }
@@ -213,6 +348,15 @@ namespace AZ
 
                 // Inverse transpose to take the non-uniform scale out of the transform for usage with normals.
                 matrix3x4.GetInverseFull().GetTranspose3x3().StoreToRowMajorFloat12(m_objectToWorldInverseTransposeTransforms.at(id.GetIndex()).m_transform);
+
+                const float* transformValues = m_objectToWorldTransforms[id.GetIndex()].m_transform;
+                for (uint32_t i = 0; i < 12; ++i)
+                {
+                    m_boundsData.m_objectToWorld[i][id.GetIndex()] = transformValues[i];
+                }
+
+                SetDirtyBit(m_boundsDirtyBits, id.GetIndex());
+                SetDirtyBit(m_uploadDirtyBits, id.GetIndex());
                 m_deviceBufferNeedsUpdate = true;
             }
         }
@@ -232,5 +376,101 @@ namespace AZ
             AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromRowMajorFloat12(m_objectToWorldTransforms.at(id.GetIndex()).m_transform);
             return matrix3x4.RetrieveScale();
         }
+
+        void TransformServiceFeatureProcessor::SetLocalAabbForId(ObjectId id, const AZ::Aabb& localAabb)
+        {
+            AZ_Error("TransformServiceFeatureProcessor", m_isWriteable, "Transform data cannot be written to during this phase");
+            AZ_Error("TransformServiceFeatureProcessor", id.IsValid(), "Attempting to set the local bounds for an invalid handle.");
+            if (id.IsValid())
+            {
+                const AZ::Vector3 center = localAabb.GetCenter();
+                const AZ::Vector3 halfExtents = 0.5f * localAabb.GetExtents();
+                for (uint32_t i = 0; i < 3; ++i)
+                {
+                    m_boundsData.m_localCenter[i][id.GetIndex()] = center.GetElement(i);
+                    m_boundsData.m_localHalfExtents[i][id.GetIndex()] = halfExtents.GetElement(i);
+                }
+                SetDirtyBit(m_boundsDirtyBits, id.GetIndex());
+            }
+        }
+
+        AZ::Aabb TransformServiceFeatureProcessor::GetWorldAabbForId(ObjectId id) const
+        {
+            AZ_Error("TransformServiceFeatureProcessor", id.IsValid(), "Attempting to get the world bounds for an invalid handle.");
+            const uint32_t index = id.GetIndex();
+            return AZ::Aabb::CreateFromMinMaxValues(
+                m_boundsData.m_worldMin[0].at(index), m_boundsData.m_worldMin[1].at(index), m_boundsData.m_worldMin[2].at(index),
+                m_boundsData.m_worldMax[0].at(index), m_boundsData.m_worldMax[1].at(index), m_boundsData.m_worldMax[2].at(index));
+        }
+
+        AZ::Obb TransformServiceFeatureProcessor::GetWorldObbForId(ObjectId id) const
+        {
+            AZ_Error("TransformServiceFeatureProcessor", id.IsValid(), "Attempting to get the world bounds for an invalid handle.");
+            const uint32_t index = id.GetIndex();
+            const AZ::Vector3 localCenter(
+                m_boundsData.m_localCenter[0].at(index), m_boundsData.m_localCenter[1].at(index), m_boundsData.m_localCenter[2].at(index));
+            const AZ::Vector3 localHalfExtents(
+                m_boundsData.m_localHalfExtents[0].at(index), m_boundsData.m_localHalfExtents[1].at(index), m_boundsData.m_localHalfExtents[2].at(index));
+            const AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromRowMajorFloat12(m_objectToWorldTransforms.at(index).m_transform);
+            return AZ::Aabb::CreateCenterHalfExtents(localCenter, localHalfExtents).GetTransformedObb(matrix3x4);
+        }
+
+        void TransformServiceFeatureProcessor::UpdateWorldBounds()
+        {
+            AZ_PROFILE_SCOPE(RPI, "TransformServiceFeatureProcessor: UpdateWorldBounds");
+            AZ_Error("TransformServiceFeatureProcessor", m_isWriteable, "Transform data cannot be written to during this phase");
+
+            using Simd::Vec4;
+            static_assert(ObjectBatchSize == Vec4::ElementCount, "World bounds are computed one Vec4 worth of objects at a time");
+            static_assert(DirtyBitsPerWord % ObjectBatchSize == 0, "Object batches must not straddle dirty words");
+            constexpr uint32_t BatchMask = (1u << ObjectBatchSize) - 1;
+
+            const ObjectBoundsData& bounds = m_boundsData;
+            for (uint32_t wordIndex = 0; wordIndex < m_boundsDirtyBits.size(); ++wordIndex)
+            {
+                uint32_t bits = m_boundsDirtyBits[wordIndex];
+                m_boundsDirtyBits[wordIndex] = 0;
+
+                while (bits != 0)
+                {
+                    // Recompute the whole batch containing the lowest dirty object, it costs the same as computing a single one.
+                    const uint32_t batchBit = az_ctz_u32(bits) & ~(ObjectBatchSize - 1);
+                    bits &= ~(BatchMask << batchBit);
+                    const uint32_t first = wordIndex * DirtyBitsPerWord + batchBit;
+
+                    const Vec4::FloatType localCenter[3] = {
+                        Vec4::LoadUnaligned(&bounds.m_localCenter[0][first]),
+                        Vec4::LoadUnaligned(&bounds.m_localCenter[1][first]),
+                        Vec4::LoadUnaligned(&bounds.m_localCenter[2][first])
+                    };
+                    const Vec4::FloatType localHalfExtents[3] = {
+                        Vec4::LoadUnaligned(&bounds.m_localHalfExtents[0][first]),
+                        Vec4::LoadUnaligned(&bounds.m_localHalfExtents[1][first]),
+                        Vec4::LoadUnaligned(&bounds.m_localHalfExtents[2][first])
+                    };
+
+                    for (uint32_t row = 0; row < 3; ++row)
+                    {
+                        const Vec4::FloatType m0 = Vec4::LoadUnaligned(&bounds.m_objectToWorld[row * 4 + 0][first]);
+                        const Vec4::FloatType m1 = Vec4::LoadUnaligned(&bounds.m_objectToWorld[row * 4 + 1][first]);
+                        const Vec4::FloatType m2 = Vec4::LoadUnaligned(&bounds.m_objectToWorld[row * 4 + 2][first]);
+                        const Vec4::FloatType translation = Vec4::LoadUnaligned(&bounds.m_objectToWorld[row * 4 + 3][first]);
+
+                        // The world center is the transformed local center, the world half extents are the local half extents
+                        // transformed by the absolute value of the rotation and scale part of the matrix.
+                        Vec4::FloatType center = Vec4::Madd(m0, localCenter[0], translation);
+                        center = Vec4::Madd(m1, localCenter[1], center);
+                        center = Vec4::Madd(m2, localCenter[2], center);
+
+                        Vec4::FloatType halfExtent = Vec4::Mul(Vec4::Abs(m0), localHalfExtents[0]);
+                        halfExtent = Vec4::Madd(Vec4::Abs(m1), localHalfExtents[1], halfExtent);
+                        halfExtent = Vec4::Madd(Vec4::Abs(m2), localHalfExtents[2], halfExtent);
+
+                        Vec4::StoreUnaligned(&m_boundsData.m_worldMin[row][first], Vec4::Sub(center, halfExtent));
+                        Vec4::StoreUnaligned(&m_boundsData.m_worldMax[row][first], Vec4::Add(center, halfExtent));
+                    }
+                }
+            }
+        }
     }
 }
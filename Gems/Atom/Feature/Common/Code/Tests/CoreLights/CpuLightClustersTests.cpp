@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <algorithm>
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/sort.h>
+#include <Atom/Feature/CoreLights/CpuLightClusters.h>
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    namespace
+    {
+        // Camera at the origin looking down the negative y axis of world space.
+        CpuLightClustersDescriptor CreateTestDescriptor()
+        {
+            CpuLightClustersDescriptor descriptor;
+            descriptor.m_worldToView = Matrix3x4::CreateRotationX(Constants::HalfPi);
+            descriptor.m_fovY = Constants::HalfPi;
+            descriptor.m_aspectRatio = 16.0f / 9.0f;
+            descriptor.m_nearDistance = 0.1f;
+            descriptor.m_farDistance = 200.0f;
+            return descriptor;
+        }
+
+        // Adds a random mix of sphere, spot and capsule lights in front of the test camera.
+        void AddRandomLights(CpuLightClusters& clusters, uint32_t lightCount, SimpleLcgRandom& random)
+        {
+            const auto randomPosition = [&random]()
+            {
+                return Vector3(
+                    (random.GetRandomFloat() - 0.5f) * 300.0f, -random.GetRandomFloat() * 220.0f, (random.GetRandomFloat() - 0.5f) * 150.0f);
+            };
+
+            for (uint32_t i = 0; i < lightCount; ++i)
+            {
+                const float radius = 1.0f + random.GetRandomFloat() * 10.0f;
+                const uint16_t handleIndex = aznumeric_cast<uint16_t>(i);
+                switch (i % 3)
+                {
+                case 0:
+                    clusters.AddSphereLight(ClusteredLightType::Point, handleIndex, randomPosition(), radius);
+                    break;
+                case 1:
+                {
+                    const Vector3 direction =
+                        Vector3(random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f).GetNormalizedSafe();
+                    const float cosConeAngle = 0.2f + random.GetRandomFloat() * 0.79f;
+                    clusters.AddSpotLight(ClusteredLightType::SimpleSpot, handleIndex, randomPosition(), direction, cosConeAngle, radius);
+                    break;
+                }
+                default:
+                {
+                    const Vector3 start = randomPosition();
+                    const Vector3 end = start + Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * 5.0f;
+                    clusters.AddCapsuleLight(ClusteredLightType::Capsule, handleIndex, start, end, radius);
+                    break;
+                }
+                }
+            }
+        }
+
+        AZStd::vector<uint16_t> GetSortedHandles(const AZStd::vector<ClusteredLight>& lights)
+        {
+            AZStd::vector<uint16_t> handles;
+            for (const ClusteredLight& light : lights)
+            {
+                handles.push_back(light.m_handleIndex);
+            }
+            AZStd::sort(handles.begin(), handles.end());
+            return handles;
+        }
+    }
+
+    class CpuLightClustersTests
+        : public UnitTest::AllocatorsTestFixture
+    {
+    };
+
+    TEST_F(CpuLightClustersTests, FindLightsAffectingPoint_SphereLight_FoundOnlyInsideRadius)
+    {
+        CpuLightClusters clusters;
+        clusters.AddSphereLight(ClusteredLightType::Point, 7, Vector3(0.0f, -20.0f, 0.0f), 2.0f);
+        clusters.Build(CreateTestDescriptor());
+
+        AZStd::vector<ClusteredLight> lights;
+        clusters.FindLightsAffectingPoint(Vector3(1.0f, -20.0f, 1.0f), lights);
+        ASSERT_EQ(lights.size(), 1);
+        EXPECT_EQ(lights[0].m_handleIndex, 7);
+        EXPECT_EQ(lights[0].m_type, ClusteredLightType::Point);
+
+        lights.clear();
+        clusters.FindLightsAffectingPoint(Vector3(0.0f, -20.0f, 3.0f), lights);
+        EXPECT_TRUE(lights.empty());
+    }
+
+    TEST_F(CpuLightClustersTests, FindLightsAffectingPoint_SpotLight_FoundOnlyInsideCone)
+    {
+        CpuLightClusters clusters;
+        // Spot light pointing away from the camera with a 45 degree half angle.
+        clusters.AddSpotLight(ClusteredLightType::SimpleSpot, 3, Vector3(0.0f, -10.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f), AZStd::cos(Constants::QuarterPi), 10.0f);
+        clusters.Build(CreateTestDescriptor());
+
+        AZStd::vector<ClusteredLight> lights;
+        clusters.FindLightsAffectingPoint(Vector3(1.0f, -15.0f, 0.0f), lights);
+        EXPECT_EQ(lights.size(), 1);
+
+        // Behind the apex.
+        lights.clear();
+        clusters.FindLightsAffectingPoint(Vector3(0.0f, -9.0f, 0.0f), lights);
+        EXPECT_TRUE(lights.empty());
+
+        // Outside of the cone angle.
+        lights.clear();
+        clusters.FindLightsAffectingPoint(Vector3(4.0f, -12.0f, 0.0f), lights);
+        EXPECT_TRUE(lights.empty());
+    }
+
+    TEST_F(CpuLightClustersTests, GetClusterIndex_PositionBehindCamera_ReturnsInvalidIndex)
+    {
+        CpuLightClusters clusters;
+        clusters.Build(CreateTestDescriptor());
+
+        EXPECT_EQ(clusters.GetClusterIndex(Vector3(0.0f, 5.0f, 0.0f)), CpuLightClusters::InvalidClusterIndex);
+        EXPECT_NE(clusters.GetClusterIndex(Vector3(0.0f, -5.0f, 0.0f)), CpuLightClusters::InvalidClusterIndex);
+    }
+
+    TEST_F(CpuLightClustersTests, FindLightsAffectingPoint_RandomLights_MatchesBruteForce)
+    {
+        SimpleLcgRandom random(1234);
+        CpuLightClusters clusters;
+        AddRandomLights(clusters, 2000, random);
+
+        // Without a build every query falls back to testing every light.
+        CpuLightClusters bruteForce = clusters;
+        clusters.Build(CreateTestDescriptor());
+
+        for (uint32_t i = 0; i < 500; ++i)
+        {
+            const Vector3 position(
+                (random.GetRandomFloat() - 0.5f) * 300.0f, -random.GetRandomFloat() * 220.0f, (random.GetRandomFloat() - 0.5f) * 150.0f);
+
+            AZStd::vector<ClusteredLight> clusteredLights;
+            AZStd::vector<ClusteredLight> expectedLights;
+            clusters.FindLightsAffectingPoint(position, clusteredLights);
+            bruteForce.FindLightsAffectingPoint(position, expectedLights);
+            EXPECT_EQ(GetSortedHandles(clusteredLights), GetSortedHandles(expectedLights));
+        }
+    }
+
+    TEST_F(CpuLightClustersTests, FindLightsAffectingAabb_RandomLights_ConsistentWithBruteForce)
+    {
+        SimpleLcgRandom random(5678);
+        CpuLightClusters clusters;
+        AddRandomLights(clusters, 2000, random);
+
+        CpuLightClusters bruteForce = clusters;
+        clusters.Build(CreateTestDescriptor());
+
+        for (uint32_t i = 0; i < 200; ++i)
+        {
+            const Vector3 center(
+                (random.GetRandomFloat() - 0.5f) * 100.0f, -10.0f - random.GetRandomFloat() * 150.0f, (random.GetRandomFloat() - 0.5f) * 50.0f);
+            const Aabb aabb = Aabb::CreateCenterHalfExtents(center, Vector3(1.0f + random.GetRandomFloat() * 4.0f));
+
+            AZStd::vector<ClusteredLight> clusteredLights;
+            AZStd::vector<ClusteredLight> bruteForceLights;
+            AZStd::vector<ClusteredLight> centerLights;
+            clusters.FindLightsAffectingAabb(aabb, clusteredLights);
+            bruteForce.FindLightsAffectingAabb(aabb, bruteForceLights);
+            bruteForce.FindLightsAffectingPoint(center, centerLights);
+
+            // Box queries are conservative, so the clustered result must lie between the lights touching the center of the box
+            // and the lights found by testing everything.
+            const AZStd::vector<uint16_t> clusteredHandles = GetSortedHandles(clusteredLights);
+            const AZStd::vector<uint16_t> bruteForceHandles = GetSortedHandles(bruteForceLights);
+            const AZStd::vector<uint16_t> centerHandles = GetSortedHandles(centerLights);
+            EXPECT_TRUE(std::includes(bruteForceHandles.begin(), bruteForceHandles.end(), clusteredHandles.begin(), clusteredHandles.end()));
+            EXPECT_TRUE(std::includes(clusteredHandles.begin(), clusteredHandles.end(), centerHandles.begin(), centerHandles.end()));
+        }
+    }
+
+#ifdef HAVE_BENCHMARK
+    class CpuLightClustersBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+
+    protected:
+        void InternalSetUp(const benchmark::State& state)
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_clusters = AZStd::make_unique<CpuLightClusters>();
+            SimpleLcgRandom random;
+            AddRandomLights(*m_clusters, aznumeric_cast<uint32_t>(state.range(0)), random);
+
+            m_positions.resize(1024);
+            for (Vector3& position : m_positions)
+            {
+                position = Vector3(
+                    (random.GetRandomFloat() - 0.5f) * 300.0f, -random.GetRandomFloat() * 220.0f, (random.GetRandomFloat() - 0.5f) * 150.0f);
+            }
+        }
+
+        void InternalTearDown(const benchmark::State& state)
+        {
+            m_positions = {};
+            m_clusters.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::unique_ptr<CpuLightClusters> m_clusters;
+        AZStd::vector<Vector3> m_positions;
+    };
+
+    BENCHMARK_DEFINE_F(CpuLightClustersBenchmarkFixture, BM_Build)(benchmark::State& state)
+    {
+        const CpuLightClustersDescriptor descriptor = CreateTestDescriptor();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_clusters->Build(descriptor);
+        }
+    }
+
+    BENCHMARK_DEFINE_F(CpuLightClustersBenchmarkFixture, BM_PointQueriesClustered)(benchmark::State& state)
+    {
+        m_clusters->Build(CreateTestDescriptor());
+        AZStd::vector<ClusteredLight> lights;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const Vector3& position : m_positions)
+            {
+                lights.clear();
+                m_clusters->FindLightsAffectingPoint(position, lights);
+            }
+            benchmark::DoNotOptimize(lights.data());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(CpuLightClustersBenchmarkFixture, BM_PointQueriesBruteForce)(benchmark::State& state)
+    {
+        // The clusters are never built, so every query tests all of the lights.
+        AZStd::vector<ClusteredLight> lights;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const Vector3& position : m_positions)
+            {
+                lights.clear();
+                m_clusters->FindLightsAffectingPoint(position, lights);
+            }
+            benchmark::DoNotOptimize(lights.data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(CpuLightClustersBenchmarkFixture, BM_Build)
+        ->Arg(1000)->Arg(5000)->Arg(10000)->Arg(50000)
+        ->Unit(::benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(CpuLightClustersBenchmarkFixture, BM_PointQueriesClustered)
+        ->Arg(1000)->Arg(5000)->Arg(10000)->Arg(50000)
+        ->Unit(::benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(CpuLightClustersBenchmarkFixture, BM_PointQueriesBruteForce)
+        ->Arg(1000)->Arg(5000)->Arg(10000)->Arg(50000)
+        ->Unit(::benchmark::kMillisecond);
+#endif
+}
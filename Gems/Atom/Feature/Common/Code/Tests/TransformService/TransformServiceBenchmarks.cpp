@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    class TransformServiceBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+
+    protected:
+        void InternalSetUp(const benchmark::State& state)
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            NameDictionary::Create();
+
+            m_transformService = AZStd::make_unique<TransformServiceFeatureProcessor>();
+
+            const size_t objectCount = aznumeric_cast<size_t>(state.range(0));
+            m_objectIds.reserve(objectCount);
+            m_localAabbs.reserve(objectCount);
+            m_transforms.reserve(objectCount);
+
+            SimpleLcgRandom random;
+            for (size_t i = 0; i < objectCount; ++i)
+            {
+                const Vector3 halfExtents(1.0f + random.GetRandomFloat(), 1.0f + random.GetRandomFloat(), 1.0f + random.GetRandomFloat());
+                const Aabb localAabb = Aabb::CreateCenterHalfExtents(Vector3::CreateZero(), halfExtents);
+                const Transform transform = Transform::CreateFromQuaternionAndTranslation(
+                    Quaternion::CreateRotationZ(random.GetRandomFloat() * Constants::TwoPi),
+                    Vector3(random.GetRandomFloat() * 1000.0f, random.GetRandomFloat() * 1000.0f, random.GetRandomFloat() * 100.0f));
+
+                TransformServiceFeatureProcessor::ObjectId objectId = m_transformService->ReserveObjectId();
+                m_transformService->SetLocalAabbForId(objectId, localAabb);
+                m_transformService->SetTransformForId(objectId, transform);
+
+                m_objectIds.push_back(objectId);
+                m_localAabbs.push_back(localAabb);
+                m_transforms.push_back(transform);
+            }
+            m_transformService->UpdateWorldBounds();
+        }
+
+        void InternalTearDown(const benchmark::State& state)
+        {
+            m_objectIds = {};
+            m_localAabbs = {};
+            m_transforms = {};
+            m_transformService.reset();
+
+            NameDictionary::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        // Moves every object a little, the way a scene full of dynamic objects would between frames.
+        void MoveObjects()
+        {
+            const Vector3 offset(0.1f, 0.0f, 0.05f);
+            for (size_t i = 0; i < m_objectIds.size(); ++i)
+            {
+                m_transforms[i].SetTranslation(m_transforms[i].GetTranslation() + offset);
+                m_transformService->SetTransformForId(m_objectIds[i], m_transforms[i]);
+            }
+        }
+
+        AZStd::unique_ptr<TransformServiceFeatureProcessor> m_transformService;
+        AZStd::vector<TransformServiceFeatureProcessor::ObjectId> m_objectIds;
+        AZStd::vector<Aabb> m_localAabbs;
+        AZStd::vector<Transform> m_transforms;
+    };
+
+    BENCHMARK_DEFINE_F(TransformServiceBenchmarkFixture, BM_SetTransforms)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveObjects();
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_objectIds.size());
+    }
+
+    // Computes the world bounds of every moved object in a single batched pass over the structure-of-arrays storage.
+    BENCHMARK_DEFINE_F(TransformServiceBenchmarkFixture, BM_WorldBoundsBatched)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            MoveObjects();
+            state.ResumeTiming();
+
+            m_transformService->UpdateWorldBounds();
+            for (const TransformServiceFeatureProcessor::ObjectId& objectId : m_objectIds)
+            {
+                benchmark::DoNotOptimize(m_transformService->GetWorldAabbForId(objectId));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_objectIds.size());
+    }
+
+    // Computes the world bounds of every moved object one handle at a time, the way meshes used to.
+    BENCHMARK_DEFINE_F(TransformServiceBenchmarkFixture, BM_WorldBoundsPerObject)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            MoveObjects();
+            state.ResumeTiming();
+
+            for (size_t i = 0; i < m_objectIds.size(); ++i)
+            {
+                const Transform localToWorld = m_transformService->GetTransformForId(m_objectIds[i]);
+                const Vector3 nonUniformScale = m_transformService->GetNonUniformScaleForId(m_objectIds[i]);
+
+                Aabb localAabb = m_localAabbs[i];
+                localAabb.MultiplyByScale(nonUniformScale);
+                benchmark::DoNotOptimize(localAabb.GetTransformedAabb(localToWorld));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * m_objectIds.size());
+    }
+
+    BENCHMARK_REGISTER_F(TransformServiceBenchmarkFixture, BM_SetTransforms)
+        ->Arg(1000)->Arg(10000)->Arg(100000)
+        ->Unit(::benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TransformServiceBenchmarkFixture, BM_WorldBoundsBatched)
+        ->Arg(1000)->Arg(10000)->Arg(100000)
+        ->Unit(::benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TransformServiceBenchmarkFixture, BM_WorldBoundsPerObject)
+        ->Arg(1000)->Arg(10000)->Arg(100000)
+        ->Unit(::benchmark::kMillisecond);
+} // namespace UnitTest
+
+#endif
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    class TransformServiceTests
+        : public UnitTest::AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            UnitTest::AllocatorsTestFixture::SetUp();
+            NameDictionary::Create();
+
+            m_transformService = AZStd::make_unique<TransformServiceFeatureProcessor>();
+        }
+
+        void TearDown() override
+        {
+            m_objectIds = {};
+            m_localAabbs = {};
+            m_transforms = {};
+            m_nonUniformScales = {};
+            for (AZStd::vector<float>& buffer : m_buffers)
+            {
+                buffer = {};
+            }
+            m_expectedHistory = {};
+            m_transformService.reset();
+
+            NameDictionary::Destroy();
+            UnitTest::AllocatorsTestFixture::TearDown();
+        }
+
+    protected:
+        static constexpr size_t FloatsPerObject = 12;
+
+        Transform CreateRandomTransform()
+        {
+            const Quaternion rotation = Quaternion::CreateFromEulerAnglesRadians(Vector3(
+                m_random.GetRandomFloat() * Constants::TwoPi, m_random.GetRandomFloat() * Constants::TwoPi,
+                m_random.GetRandomFloat() * Constants::TwoPi));
+            const Vector3 translation(
+                (m_random.GetRandomFloat() - 0.5f) * 1000.0f, (m_random.GetRandomFloat() - 0.5f) * 1000.0f, m_random.GetRandomFloat() * 100.0f);
+            return Transform::CreateFromQuaternionAndTranslation(rotation, translation) *
+                Transform::CreateUniformScale(0.5f + m_random.GetRandomFloat() * 2.0f);
+        }
+
+        Vector3 CreateRandomScale()
+        {
+            return Vector3(0.25f + m_random.GetRandomFloat() * 4.0f, 0.25f + m_random.GetRandomFloat() * 4.0f, 0.25f + m_random.GetRandomFloat() * 4.0f);
+        }
+
+        void AddObjects(size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                // The local bounds are not centered on the origin, so the rotation of the center is verified as well.
+                const Vector3 center(m_random.GetRandomFloat() * 4.0f - 2.0f, m_random.GetRandomFloat() * 4.0f - 2.0f, m_random.GetRandomFloat());
+                const Vector3 halfExtents(0.1f + m_random.GetRandomFloat() * 3.0f, 0.1f + m_random.GetRandomFloat(), 0.1f + m_random.GetRandomFloat() * 2.0f);
+
+                TransformServiceFeatureProcessor::ObjectId objectId = m_transformService->ReserveObjectId();
+                m_objectIds.push_back(objectId);
+                m_localAabbs.push_back(Aabb::CreateCenterHalfExtents(center, halfExtents));
+                m_transforms.push_back(CreateRandomTransform());
+                m_nonUniformScales.push_back(CreateRandomScale());
+
+                m_transformService->SetLocalAabbForId(objectId, m_localAabbs.back());
+                m_transformService->SetTransformForId(objectId, m_transforms.back(), m_nonUniformScales.back());
+            }
+        }
+
+        void MoveObject(size_t objectIndex)
+        {
+            m_transforms[objectIndex] = CreateRandomTransform();
+            m_nonUniformScales[objectIndex] = CreateRandomScale();
+            m_transformService->SetTransformForId(m_objectIds[objectIndex], m_transforms[objectIndex], m_nonUniformScales[objectIndex]);
+        }
+
+        // The world bounds of an object computed one object at a time, the way meshes did before the batched update.
+        Aabb GetExpectedWorldAabb(size_t objectIndex) const
+        {
+            Matrix3x4 objectToWorld = Matrix3x4::CreateFromTransform(m_transforms[objectIndex]);
+            objectToWorld.MultiplyByScale(m_nonUniformScales[objectIndex]);
+            return m_localAabbs[objectIndex].GetTransformedAabb(objectToWorld);
+        }
+
+        void VerifyWorldBounds() const
+        {
+            for (size_t i = 0; i < m_objectIds.size(); ++i)
+            {
+                const Aabb expected = GetExpectedWorldAabb(i);
+                const Aabb actual = m_transformService->GetWorldAabbForId(m_objectIds[i]);
+
+                // The batched path does the same math in a different order, so allow for rounding relative to the distance from the origin.
+                const float tolerance = 1.0e-5f * AZ::GetMax(1.0f, expected.GetMax().GetAbs().GetMaxElement());
+                EXPECT_TRUE(actual.GetMin().IsClose(expected.GetMin(), tolerance)) << "Object " << i;
+                EXPECT_TRUE(actual.GetMax().IsClose(expected.GetMax(), tolerance)) << "Object " << i;
+            }
+        }
+
+        // Uploads the changed transforms the way OnBeginPrepareRender() does, but into CPU copies of the GPU buffers.
+        void UploadDirtyTransforms(bool buffersRecreated)
+        {
+            using TransformBuffer = TransformServiceFeatureProcessor::TransformBuffer;
+
+            const size_t floatCount = m_transformService->m_objectToWorldTransforms.size() * FloatsPerObject;
+            if (buffersRecreated)
+            {
+                // Recreated buffers don't keep their contents, so start from values that no transform would have.
+                for (AZStd::vector<float>& buffer : m_buffers)
+                {
+                    buffer.assign(floatCount, AZStd::numeric_limits<float>::quiet_NaN());
+                }
+            }
+
+            m_transformService->UploadDirtyTransforms(buffersRecreated,
+                [this](TransformBuffer buffer, const auto& data, const auto& range)
+                {
+                    AZStd::vector<float>& target = m_buffers[static_cast<size_t>(buffer)];
+                    ASSERT_LE(range.m_end * FloatsPerObject, target.size());
+                    memcpy(target.data() + range.m_begin * FloatsPerObject, data.data() + range.m_begin, (range.m_end - range.m_begin) * sizeof(float) * FloatsPerObject);
+                });
+        }
+
+        // Compares the CPU copies of the GPU buffers against what a full upload of every object would have produced.
+        void VerifyBuffersMatchFullUpload()
+        {
+            using TransformBuffer = TransformServiceFeatureProcessor::TransformBuffer;
+
+            const auto& objectToWorld = m_transformService->m_objectToWorldTransforms;
+            const auto& objectToWorldInverseTranspose = m_transformService->m_objectToWorldInverseTransposeTransforms;
+
+            // Objects that were never uploaded have no history yet.
+            m_expectedHistory.resize(objectToWorld.size() * FloatsPerObject, 0.0f);
+            for (size_t i = 0; i < m_objectIds.size(); ++i)
+            {
+                const size_t index = m_objectIds[i].GetIndex();
+                for (size_t element = 0; element < FloatsPerObject; ++element)
+                {
+                    const size_t bufferIndex = index * FloatsPerObject + element;
+                    EXPECT_EQ(m_buffers[static_cast<size_t>(TransformBuffer::ObjectToWorld)][bufferIndex], objectToWorld[index].m_transform[element]);
+                    EXPECT_EQ(
+                        m_buffers[static_cast<size_t>(TransformBuffer::ObjectToWorldInverseTranspose)][bufferIndex],
+                        objectToWorldInverseTranspose[index].m_transform[element]);
+
+                    // The history buffer holds the transforms of the previous frame.
+                    EXPECT_EQ(m_buffers[static_cast<size_t>(TransformBuffer::ObjectToWorldHistory)][bufferIndex], m_expectedHistory[bufferIndex]);
+                }
+            }
+
+            // The next frame's history is this frame's transforms.
+            memcpy(m_expectedHistory.data(), objectToWorld.data(), m_expectedHistory.size() * sizeof(float));
+        }
+
+        AZStd::unique_ptr<TransformServiceFeatureProcessor> m_transformService;
+        AZStd::vector<TransformServiceFeatureProcessor::ObjectId> m_objectIds;
+        AZStd::vector<Aabb> m_localAabbs;
+        AZStd::vector<Transform> m_transforms;
+        AZStd::vector<Vector3> m_nonUniformScales;
+        SimpleLcgRandom m_random;
+
+        // CPU copies of the object to world, inverse transpose and history buffers, indexed by TransformBuffer.
+        AZStd::vector<float> m_buffers[3];
+        AZStd::vector<float> m_expectedHistory;
+    };
+
+    TEST_F(TransformServiceTests, UpdateWorldBounds_MatchesTransformedAabb)
+    {
+        // Not a multiple of the SIMD batch size, so the last batch is partially filled.
+        AddObjects(103);
+        m_transformService->UpdateWorldBounds();
+        VerifyWorldBounds();
+    }
+
+    TEST_F(TransformServiceTests, UpdateWorldBounds_OnlyChangedObjectsAreUpdated)
+    {
+        AddObjects(64);
+        m_transformService->UpdateWorldBounds();
+
+        // Move a few objects in different batches and change the local bounds of another one.
+        MoveObject(1);
+        MoveObject(34);
+        MoveObject(63);
+        m_localAabbs[17] = Aabb::CreateFromMinMaxValues(-5.0f, -1.0f, 0.0f, 1.0f, 2.0f, 8.0f);
+        m_transformService->SetLocalAabbForId(m_objectIds[17], m_localAabbs[17]);
+
+        m_transformService->UpdateWorldBounds();
+        VerifyWorldBounds();
+
+        // Released ids get reused by the next object, which has to get its own bounds rather than the previous ones.
+        m_transformService->ReleaseObjectId(m_objectIds[34]);
+        m_objectIds.erase(m_objectIds.begin() + 34);
+        m_localAabbs.erase(m_localAabbs.begin() + 34);
+        m_transforms.erase(m_transforms.begin() + 34);
+        m_nonUniformScales.erase(m_nonUniformScales.begin() + 34);
+        AddObjects(1);
+
+        m_transformService->UpdateWorldBounds();
+        VerifyWorldBounds();
+    }
+
+    TEST_F(TransformServiceTests, PartialUploads_MatchFullUpload)
+    {
+        AddObjects(4000);
+        UploadDirtyTransforms(true);
+        VerifyBuffersMatchFullUpload();
+
+        // A few scattered objects, which get uploaded as separate or merged ranges.
+        MoveObject(3);
+        MoveObject(5);
+        MoveObject(500);
+        MoveObject(3999);
+        UploadDirtyTransforms(false);
+        VerifyBuffersMatchFullUpload();
+
+        // Nothing moved, so only the history of the objects uploaded last frame changes.
+        UploadDirtyTransforms(false);
+        VerifyBuffersMatchFullUpload();
+
+        // More scattered objects than fit in the upload ranges, so they get uploaded as a single covering range.
+        for (size_t i = 10; i < 4000; i += 97)
+        {
+            MoveObject(i);
+        }
+        UploadDirtyTransforms(false);
+        VerifyBuffersMatchFullUpload();
+
+        // Every other object moves for a few frames.
+        for (size_t frame = 0; frame < 4; ++frame)
+        {
+            for (size_t i = frame % 2; i < m_objectIds.size(); i += 2)
+            {
+                MoveObject(i);
+            }
+            UploadDirtyTransforms(false);
+            VerifyBuffersMatchFullUpload();
+        }
+
+        // Growing the buffers loses their contents, so everything gets uploaded again.
+        AddObjects(100);
+        UploadDirtyTransforms(true);
+        VerifyBuffersMatchFullUpload();
+
+        UploadDirtyTransforms(false);
+        VerifyBuffersMatchFullUpload();
+    }
+} // namespace UnitTest
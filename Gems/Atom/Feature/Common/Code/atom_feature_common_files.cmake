@@ -14,6 +14,7 @@ set(FILES
     Include/Atom/Feature/AuxGeom/AuxGeomFeatureProcessor.h
     Include/Atom/Feature/ColorGrading/LutResolution.h
     Include/Atom/Feature/CoreLights/CoreLightsConstants.h
+    Include/Atom/Feature/CoreLights/CpuLightClusters.h
     Include/Atom/Feature/DisplayMapper/AcesOutputTransformPass.h
     Include/Atom/Feature/DisplayMapper/AcesOutputTransformLutPass.h
     Include/Atom/Feature/DisplayMapper/ApplyShaperLookupTablePass.h
@@ -70,6 +71,8 @@ set(FILES
     Source/CoreLights/CapsuleLightFeatureProcessor.cpp
     Source/CoreLights/CascadedShadowmapsPass.h
     Source/CoreLights/CascadedShadowmapsPass.cpp
+    Source/CoreLights/CpuLightClusters.cpp
+    Source/CoreLights/CpuLightDataProvider.h
     Source/CoreLights/CoreLightsSystemComponent.h
     Source/CoreLights/CoreLightsSystemComponent.cpp
     Source/CoreLights/DepthExponentiationPass.h
@@ -9,6 +9,7 @@
 set(FILES
     Mocks/MockMeshFeatureProcessor.h
     Tests/CommonTest.cpp
+    Tests/CoreLights/CpuLightClustersTests.cpp
     Tests/CoreLights/ShadowmapAtlasTest.cpp
     Tests/IndexedDataVectorTests.cpp
     Tests/MultiIndexedDataVectorTests.cpp
@@ -16,4 +17,6 @@ set(FILES
     Tests/SparseVectorTests.cpp
     Tests/SkinnedMesh/SkinnedMeshDispatchItemTests.cpp
     Tests/Decals/DecalTextureArrayTests.cpp
+    Tests/TransformService/TransformServiceBenchmarks.cpp
+    Tests/TransformService/TransformServiceTests.cpp
 )
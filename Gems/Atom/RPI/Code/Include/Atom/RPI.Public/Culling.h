@@ -19,13 +19,16 @@
 
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Obb.h>
 #include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/containers/vector.h>
 
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 
+#include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/View.h>
 #include <Atom/RHI/DrawList.h>
 
@@ -49,6 +52,7 @@ namespace AZ
     namespace RPI
     {
         class Scene;
+        class SoftwareOcclusionBuffer;
 
         struct Cullable
         {
@@ -92,11 +96,22 @@ namespace AZ
 
             struct LodData
             {
+                //! A streaming image sampled by the draw packets of a lod.
+                struct StreamingImageUsage
+                {
+                    Data::Instance<StreamingImage> m_image;
+
+                    //! Texels of the most detailed mip spanning the lod selection diameter, from the UV density of the meshes
+                    //! sampling the image. Used to request the mip level matching the projected size of the object in each view.
+                    float m_texelsAcrossDiameter = 0.0f;
+                };
+
                 struct Lod
                 {
                     float m_screenCoverageMin;
                     float m_screenCoverageMax;
                     AZStd::vector<const RHI::DrawPacket*> m_drawPackets;
+                    AZStd::vector<StreamingImageUsage> m_streamingImages;
                 };
 
                 AZStd::vector<Lod> m_lods;
@@ -109,6 +124,22 @@ namespace AZ
             };
             LodData m_lodData;
 
+            //! Simplified triangle mesh, in local space, rendered into the software occlusion buffer to cull the objects behind it.
+            //! Usually built from the lowest lod of a model.
+            struct OccluderMesh
+            {
+                AZStd::vector<Vector3> m_positions;
+                AZStd::vector<uint32_t> m_indices;
+            };
+
+            struct OccluderData
+            {
+                //! Only cullables with an occluder mesh can be registered as occluders. The mesh can be shared between cullables.
+                AZStd::shared_ptr<const OccluderMesh> m_mesh;
+                Matrix3x4 m_localToWorld = Matrix3x4::CreateIdentity();
+            };
+            OccluderData m_occluderData;
+
             //! Flag indicating if the object is visible in any view, meaning it passed the culling tests in the previous frame.
             //! This flag must be manually cleared by the Cullable object every frame.
             bool m_isVisible = false;
@@ -178,6 +209,8 @@ namespace AZ
                     m_numJobs = 0;
                     m_numVisibleCullables = 0;
                     m_numVisibleDrawPackets = 0;
+                    m_numOccludedCullables = 0;
+                    m_numOccluders = 0;
                 }
 
                 AZ::Name m_name;
@@ -185,6 +218,10 @@ namespace AZ
                 AZStd::atomic_uint32_t m_numJobs = 0;
                 AZStd::atomic_uint32_t m_numVisibleCullables = 0;
                 AZStd::atomic_uint32_t m_numVisibleDrawPackets = 0;
+                //! Cullables which passed the frustum tests but were hidden by the software occlusion buffer
+                AZStd::atomic_uint32_t m_numOccludedCullables = 0;
+                //! Occluders rendered into the software occlusion buffer of the view
+                AZStd::atomic_uint32_t m_numOccluders = 0;
             };
 
             CullingDebugContext() = default;
@@ -215,7 +252,9 @@ namespace AZ
         };
 
         //! Selects an lod (based on size-in-screnspace) and adds the appropriate DrawPackets to the view.
-        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view);
+        //! When a viewport height in pixels is given, also requests the mip levels of the streaming images of the selected lods
+        //! that match their texel density in the view.
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view, float viewportHeight = 0.0f);
 
         //! Centralized manager for culling-related processing for a given scene.
         //! There is one CullingScene owned by each Scene, so external systems (such as FeatureProcessors) should
@@ -276,6 +315,16 @@ namespace AZ
             //! Is not threadsafe, so call this from the main thread outside of Begin/EndCulling()
             void UnregisterCullable(Cullable& cullable);
 
+            //! Adds a Cullable with an occluder mesh to the occluders rendered into the software occlusion buffer of camera views.
+            //! The Cullable must also be registered with RegisterOrUpdateCullable(), its world bounds are used to cull the occluder.
+            //! Must be called again whenever the occluder's transform changes.
+            //! Is threadsafe, but must be called from outside Begin/EndCulling()
+            void RegisterOrUpdateOccluder(Cullable& cullable);
+
+            //! Removes a Cullable from the occluders.
+            //! Is threadsafe, but must be called from outside Begin/EndCulling()
+            void UnregisterOccluder(Cullable& cullable);
+
             //! Returns the number of cullables that have been added to the CullingScene
             uint32_t GetNumCullables() const;
 
@@ -290,13 +339,17 @@ namespace AZ
         private:
             void BeginCullingTaskGraph(const AZStd::vector<ViewPtr>& views);
             void BeginCullingJobs(const AZStd::vector<ViewPtr>& views);
-            void ProcessCullablesCommon(const Scene& scene, View& view, AZ::Frustum& frustum, void*& maskedOcclusionCulling);
+            void ProcessCullablesCommon(
+                const Scene& scene, View& view, AZ::Frustum& frustum, void*& maskedOcclusionCulling, SoftwareOcclusionBuffer*& softwareOcclusionBuffer);
+            SoftwareOcclusionBuffer* RenderOccluders(const Scene& scene, View& view, const AZ::Frustum& frustum);
 
             const Scene* m_parentScene = nullptr;
             AzFramework::IVisibilityScene* m_visScene = nullptr;
             CullingDebugContext m_debugCtx;
             AZStd::concurrency_checker m_cullDataConcurrencyCheck;
             OcclusionPlaneVector m_occlusionPlanes;
+            AZStd::vector<Cullable*> m_occluders;
+            AZStd::mutex m_occludersMutex;
             AZ::TaskGraphActiveInterface* m_taskGraphActive = nullptr;
         };
         
@@ -15,6 +15,7 @@
 
 #include <Atom/RPI.Public/Base.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/DynamicDraw/DynamicBufferRingAllocator.h>
 
 
 namespace AZ
@@ -26,6 +27,7 @@ namespace AZ
         //! DynamicBufferAllocator allocates DynamicBuffers within a big pre-allocated buffer by using ring buffer allocation
         //! The addresses of allocated DynamicBuffers would be available after AZ::RHI::Limits::Device::FrameCountMax frames.
         //! Since the allocations are sub-allocations they almost have zero cost with both cpu and gpu.
+        //! Allocate is thread safe and lock free: each thread sub-allocates from its own chunk of the ring (see DynamicBufferRingAllocator).
         //! Limitation: the allocation may fail if the request buffer size is larger than the ring buffer size or
         //!     there isn't enough unused memory available within the ring buffer. User may increase the input of Init(ringBufferSize)
         //!     to increase the ring buffer's size. 
@@ -43,7 +45,7 @@ namespace AZ
 
             void Shutdown();
 
-            //! Allocate a dynamic buffer with specified size and alignment
+            //! Allocate a dynamic buffer with specified size and alignment. This function is thread safe.
             //! It may return nullptr if the input size is larger than ring buffer size or there isn't enough unused memory available within the ring buffer
             RHI::Ptr<DynamicBuffer> Allocate(uint32_t size, uint32_t alignment);
 
@@ -63,21 +65,13 @@ namespace AZ
             // Get buffer's offset;
             uint32_t GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer);
 
-            // The position where the buffer is available.
-            uint32_t m_currentPosition = 0;
-            // The upper bound limit of the allocation of current frame 
-            uint32_t m_endPositionLimit = 0;
-            // The allocated buffer size of current frame
-            uint32_t m_currentAllocatedSize = 0;
+            // Manages the offsets of the allocations within the ring buffer.
+            DynamicBufferRingAllocator m_ringAllocator;
 
             uint32_t m_ringBufferSize = 0;
             void* m_ringBufferStartAddress = 0;
             Data::Instance<Buffer> m_ringBuffer;
 
-            // Allocation history which are in use by GPU. 
-            uint32_t m_frameStartPositions[AZ::RHI::Limits::Device::FrameCountMax];
-            uint32_t m_currentFrame = 0;
-
             bool m_enableAllocationWarning = false;
         };
     }
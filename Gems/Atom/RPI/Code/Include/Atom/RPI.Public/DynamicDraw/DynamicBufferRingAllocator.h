@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI.Reflect/Limits.h>
+#include <Atom/RHI/ThreadLocalContext.h>
+
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Manages the offsets of the ring buffer used by DynamicBufferAllocator. It doesn't own any memory.
+        //! Allocations can be made from any number of threads without locking. Each thread acquires chunks of the ring with an
+        //! atomic compare and swap, then sub-allocates from its own chunk, so threads only touch shared state once per chunk.
+        //! Chunks are retired automatically when the frame ends; their unused space is lost for that frame.
+        //! Memory allocated in a frame becomes available again after AZ::RHI::Limits::Device::FrameCountMax frames.
+        class DynamicBufferRingAllocator
+        {
+        public:
+            //! Alignment of the chunks. Allocations requiring a larger alignment are not supported.
+            static constexpr uint32_t ChunkAlignment = 256;
+            static constexpr uint32_t DefaultChunkSize = 64 * 1024;
+
+            DynamicBufferRingAllocator() = default;
+            ~DynamicBufferRingAllocator() = default;
+
+            //! Initializes the allocator for a ring of the given size, rounded down to ChunkAlignment. The chunk size is reduced for small rings so that each
+            //! frame can still be split across many threads.
+            void Init(uint32_t ringBufferSize, uint32_t chunkSize = DefaultChunkSize);
+
+            //! Allocates a range of the ring and returns its offset in offsetOut. Returns false when the ring is full.
+            //! Thread safe, and may run concurrently with FrameEnd: an allocation racing with FrameEnd belongs to either frame.
+            bool Allocate(uint32_t size, uint32_t alignment, uint32_t& offsetOut);
+
+            //! Ends the current frame, retiring every thread's chunk and releasing the memory of the oldest frame.
+            //! Must not be called concurrently with itself.
+            void FrameEnd();
+
+            uint32_t GetRingBufferSize() const;
+            uint32_t GetChunkSize() const;
+
+            //! Returns the number of bytes of the ring taken by the current frame, including the unused space of chunks.
+            uint64_t GetCurrentFrameSize() const;
+
+        private:
+            // Per thread chunk. Positions are linear, they keep increasing across the ring and are wrapped when converted to offsets.
+            struct ThreadChunk
+            {
+                uint64_t m_frameIndex = 0;
+                uint64_t m_position = 0;
+                uint64_t m_end = 0;
+            };
+
+            // Reserves a contiguous range of the ring and returns its linear start position.
+            bool AcquireRange(uint32_t size, uint64_t& positionOut);
+
+            uint32_t m_ringBufferSize = 0;
+            uint32_t m_chunkSize = 0;
+            // Allocations larger than this are made directly from the ring rather than from the thread's chunk.
+            uint32_t m_maxChunkAllocationSize = 0;
+
+            // The linear position of the next free byte in the ring.
+            AZStd::atomic<uint64_t> m_position = {0};
+            // The linear position allocations must not go past, which is where the oldest frame in use by the GPU starts
+            // plus the ring size.
+            AZStd::atomic<uint64_t> m_positionLimit = {0};
+            // Incremented at the end of each frame, making the chunks acquired during the frame stale.
+            AZStd::atomic<uint64_t> m_frameIndex = {1};
+
+            // The linear position each of the frames in flight ended at.
+            uint64_t m_frameEndPositions[RHI::Limits::Device::FrameCountMax] = {};
+            uint32_t m_currentFrame = 0;
+
+            RHI::ThreadLocalContext<ThreadChunk> m_threadChunks;
+        };
+    }
+}
@@ -10,6 +10,7 @@
 
 #include <Atom/RPI.Reflect/Image/DefaultStreamingImageControllerAsset.h>
 
+#include <Atom/RPI.Public/Image/StreamingImageBudget.h>
 #include <Atom/RPI.Public/Image/StreamingImageController.h>
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
@@ -18,6 +19,10 @@ namespace AZ
 {
     namespace RPI
     {
+        //! The default streaming controller. Every update, the mip requests of the attached images (see StreamingImage::SetTargetMip
+        //! and StreamingImage::SetTargetMipFromTexelDensity) are prioritized across all images by a StreamingImageBudget, which
+        //! decides what to expand and what to evict so that the images fit in the memory budget.
+        //! Images which never received a mip request are streamed in fully, as long as the budget allows.
         class DefaultStreamingImageController final
             : public StreamingImageController
         {
@@ -27,6 +32,16 @@ namespace AZ
 
             static Data::Instance<DefaultStreamingImageController> FindOrCreate(const Data::Asset<DefaultStreamingImageControllerAsset>& asset);
 
+            //! Overrides the memory budget of the streamed images, in bytes. By default the budget of the RHI pool is used.
+            //! Zero disables the budget.
+            void SetMemoryBudget(size_t budgetInBytes);
+
+            //! Returns the memory budget in bytes currently applied, zero if it is not enforced.
+            size_t GetMemoryBudget() const;
+
+            //! Returns the budget, memory usage and miss metrics of the last update. Must not be called while the pool updates.
+            const StreamingImageBudgetMetrics& GetBudgetMetrics() const;
+
         private:
             // Standard init for InstanceData subclass
             DefaultStreamingImageController() = default;
@@ -39,8 +54,22 @@ namespace AZ
             void UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts) override;
             ///////////////////////////////////////////////////////////////////
 
+            // The maximum number of mip chain expansions queued per update, to avoid flooding the asset system.
+            static constexpr uint32_t MaxExpandsPerUpdate = 20;
+
             // A work queue for doing initial setup after an image is attached.
             AZStd::vector<StreamingImageContextPtr> m_recentlyAttachedContexts;
+
+            // Budget override set with SetMemoryBudget, used instead of the RHI pool budget when set.
+            static constexpr size_t NoMemoryBudgetOverride = AZStd::numeric_limits<size_t>::max();
+            AZStd::atomic<size_t> m_memoryBudgetOverride = {NoMemoryBudgetOverride};
+
+            StreamingImageBudget m_budget;
+
+            // Per update scratch data, kept to avoid allocations. m_images and m_imageStates are parallel arrays.
+            AZStd::vector<StreamingImage*> m_images;
+            AZStd::vector<StreamingImageBudget::ImageState> m_imageStates;
+            AZStd::vector<StreamingImageBudget::Decision> m_decisions;
         };
     }
 }
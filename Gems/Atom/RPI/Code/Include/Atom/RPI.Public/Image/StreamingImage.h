@@ -85,6 +85,15 @@ namespace AZ
             //! 
             //! A value of 0 is the most detailed mip level. The value is clamped to the last mip in the chain.
             void SetTargetMip(uint16_t targetMipLevel);
+
+            //! Requests the mip level matching a screen space texel density, which is the number of texels of the most detailed
+            //! mip covered by one screen pixel. Meshes and materials can estimate it per view from the projected size of a surface
+            //! and the texture's size and UV scale. Like SetTargetMip, this should be called every frame from every view the
+            //! image is visible in; the most detailed request is kept.
+            void SetTargetMipFromTexelDensity(float texelsPerPixel);
+
+            //! Returns the mip level that should be used to sample an image at the given screen space texel density.
+            static uint16_t GetMipLevelForTexelDensity(float texelsPerPixel);
             
             const Data::Instance<StreamingImagePool>& GetPool() const;
 
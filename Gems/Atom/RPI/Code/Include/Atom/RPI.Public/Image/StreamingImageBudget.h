@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <Atom/RHI.Reflect/Limits.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Memory statistics reported by StreamingImageBudget after each update.
+        struct StreamingImageBudgetMetrics
+        {
+            //! The memory budget in bytes. Zero means the budget is not enforced.
+            size_t m_budgetInBytes = 0;
+
+            //! Bytes of all mip chains granted residency, including the tail mip chains which are always resident.
+            size_t m_grantedBytes = 0;
+
+            //! Bytes that would be needed to grant every mip request.
+            size_t m_requestedBytes = 0;
+
+            //! Number of images whose requested mip chain could not be granted because of the budget.
+            uint32_t m_missCount = 0;
+
+            //! Number of images which had to drop resident mip chains to stay within the budget.
+            uint32_t m_evictionCount = 0;
+        };
+
+        //! Decides which mip chains of a set of streaming images should be resident so that the total stays within a memory budget.
+        //! The policy is independent of the GPU and of the asset system: the streaming controller gathers the state of its images,
+        //! asks the budget for the target mip chain of each, and then issues the expand and trim operations.
+        //!
+        //! Each mip chain above the tail is a step that costs its size in bytes. Steps are granted in priority order until the
+        //! budget is exhausted:
+        //!  - Mip chains requested this update come first, coarse mip chains of every image before finer ones, so that detail
+        //!    is spread evenly across the visible images rather than spent on a few of them.
+        //!  - Mip chains which are resident but not requested anymore come last, most recently used first. When the budget is
+        //!    exceeded, these are the first to be evicted.
+        //!
+        //! The steps are kept ordered between updates, and only the steps of images whose state changed are requeued, so an
+        //! update with few changes doesn't need to sort the steps of every image again. Images are identified by their index,
+        //! so the controller should pass them in a stable order.
+        class StreamingImageBudget
+        {
+        public:
+            static constexpr uint16_t NoMipChainRequest = RHI::Limits::Image::MipCountMax;
+
+            //! The state of an image, filled by the streaming controller before each update.
+            struct ImageState
+            {
+                //! Size in bytes of each mip chain, index 0 being the most detailed.
+                AZStd::array<size_t, RHI::Limits::Image::MipCountMax> m_mipChainSizes = {};
+                uint16_t m_mipChainCount = 1;
+
+                //! The most detailed mip chain resident or being streamed in.
+                uint16_t m_residentMipChain = 0;
+
+                //! The most detailed mip chain requested this update, or NoMipChainRequest if the image wasn't used.
+                uint16_t m_requestedMipChain = NoMipChainRequest;
+
+                //! Timestamp of the last request, used to keep the most recently used images when evicting.
+                size_t m_lastAccessTimestamp = 0;
+            };
+
+            //! A change of target mip chain for one of the images passed to Update.
+            struct Decision
+            {
+                uint32_t m_imageIndex = 0;
+                uint16_t m_targetMipChain = 0;
+            };
+
+            //! Sets the budget in bytes. Zero disables the budget, granting every request and never evicting.
+            void SetBudget(size_t budgetInBytes);
+            size_t GetBudget() const;
+
+            //! Computes the target mip chain of each image and appends one decision to decisionsOut for every image whose
+            //! target differs from its resident mip chain. Trims are listed before expansions, and expansions are listed in
+            //! priority order.
+            void Update(AZStd::span<const ImageState> images, AZStd::vector<Decision>& decisionsOut);
+
+            //! Returns the metrics of the last update.
+            const StreamingImageBudgetMetrics& GetMetrics() const;
+
+        private:
+            // One mip chain of one image waiting to be granted.
+            struct Step
+            {
+                uint64_t m_priority;
+                uint32_t m_imageIndex;
+                uint16_t m_mipChain;
+            };
+
+            // Orders steps by decreasing priority, then by image, then coarse mip chains first.
+            struct StepCompare
+            {
+                bool operator()(const Step& lhs, const Step& rhs) const;
+            };
+
+            // The part of an image state the steps of the image are built from. Fields which don't affect the steps are
+            // normalized, so that the key only changes when the steps do.
+            struct StepKey
+            {
+                uint16_t m_tailMipChain = 0;
+                uint16_t m_requestedMipChain = NoMipChainRequest;
+                uint16_t m_residentMipChain = 0;
+                uint64_t m_staleTimestamp = 0;
+
+                bool operator==(const StepKey& rhs) const;
+                bool operator!=(const StepKey& rhs) const;
+            };
+
+            static StepKey GetStepKey(const ImageState& image);
+
+            // Calls stepCallback with every step of an image.
+            template<typename StepCallback>
+            static void ForEachStep(uint32_t imageIndex, const StepKey& key, StepCallback stepCallback);
+
+            // Replaces the queued steps of an image with the steps of the new key.
+            void RequeueSteps(uint32_t imageIndex, const StepKey& key);
+
+            size_t m_budgetInBytes = 0;
+            StreamingImageBudgetMetrics m_metrics;
+
+            // The steps of every image in grant order, updated incrementally.
+            AZStd::set<Step, StepCompare> m_steps;
+
+            // The key the queued steps of each image were built from.
+            AZStd::vector<StepKey> m_stepKeys;
+
+            // Scratch data, kept between updates to avoid allocations.
+            AZStd::vector<uint16_t> m_grantedMipChains;
+        };
+    }
+}
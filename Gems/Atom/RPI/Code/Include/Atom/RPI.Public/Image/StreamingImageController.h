@@ -69,6 +69,16 @@ namespace AZ
             void QueueExpandToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
             void TrimToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
 
+            //! Wrapped streaming image queries used for derived StreamingImageController classes
+            size_t GetMipChainCount(const StreamingImage* image) const;
+            size_t GetMipChainIndex(const StreamingImage* image, size_t mipLevel) const;
+            //! Returns the size in bytes of the image data of a mip chain, across all array slices.
+            size_t GetMipChainDataSize(const StreamingImage* image, size_t mipChainIndex) const;
+            //! Returns the most detailed mip chain which is either resident or being streamed in.
+            uint16_t GetStreamingTargetMipChain(const StreamingImage* image) const;
+
+            RHI::StreamingImagePool* GetRHIPool() const;
+
         private:
 
             ///////////////////////////////////////////////////////////////////
@@ -51,6 +51,9 @@ namespace AZ
 
             const RHI::StreamingImagePool* GetRHIPool() const;
 
+            //! Returns the controller deciding which mips of the pool's images are resident.
+            StreamingImageController* GetController();
+
         private:
             StreamingImagePool() = default;
 
@@ -50,6 +50,9 @@ namespace AZ
 
             Data::Instance<Material> GetMaterial();
 
+            //! Returns the index of the mesh within its model lod that is drawn by this draw packet.
+            size_t GetModelLodMeshIndex() const { return m_modelLodMeshIndex; }
+
         private:
             bool DoUpdate(const Scene& parentScene);
 
@@ -45,6 +45,9 @@ namespace AZ
 
             uint32_t GetDrawItemCount();
 
+            //! Returns the viewport the pass renders with, as of the last frame it was prepared.
+            const RHI::Viewport& GetViewportState() const { return m_viewportState; }
+
         protected:
             explicit RasterPass(const PassDescriptor& descriptor);
 
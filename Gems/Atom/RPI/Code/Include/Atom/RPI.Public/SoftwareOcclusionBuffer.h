@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! A small CPU depth buffer that occluder meshes are rasterized into, used to cull the objects hidden behind them.
+        //! Each texel stores the view depth (clip space w) of the nearest occluder. After the occluders are rendered, a
+        //! hierarchical-Z pyramid is built where each texel holds the farthest depth of the texels it covers, so that a box
+        //! can be tested against a handful of texels regardless of its size on screen.
+        //! A box is occluded if its nearest point is behind the depth stored in every texel it covers.
+        //! The test is approximate, not conservative: occluders cover the texels whose center is inside them and store their
+        //! depth at the texel center, so a box that is only visible around the silhouette of an occluder, within a texel of
+        //! it, can still be reported as occluded. Only perspective projections are supported.
+        class SoftwareOcclusionBuffer
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(SoftwareOcclusionBuffer, AZ::SystemAllocator, 0);
+
+            static constexpr uint32_t DefaultWidth = 256;
+            static constexpr uint32_t DefaultHeight = 128;
+
+            //! The width is rounded up to a multiple of 4 so that rows can be processed 4 texels at a time.
+            explicit SoftwareOcclusionBuffer(uint32_t width = DefaultWidth, uint32_t height = DefaultHeight);
+
+            //! Clears the depth buffer and sets the world to clip matrix of the view the occluders are rendered for.
+            void Begin(const Matrix4x4& worldToClip);
+
+            //! Rasterizes an indexed triangle list into the depth buffer. Triangles are double-sided and clipped to the near plane.
+            void RenderTriangles(const Matrix3x4& localToWorld, AZStd::span<const Vector3> positions, AZStd::span<const uint32_t> indices);
+
+            //! Builds the hierarchical depth pyramid. Must be called once all the occluders are rendered, before testing.
+            void End();
+
+            //! Returns true if the world space box is hidden behind the occluders. Boxes which cross the near plane or are entirely
+            //! off screen are never reported as occluded.
+            bool IsOccluded(const Aabb& worldAabb) const;
+
+            uint32_t GetWidth() const;
+            uint32_t GetHeight() const;
+
+            //! Returns the depth of the nearest occluder at a texel of the full resolution buffer, or FLT_MAX if there is none.
+            float GetDepth(uint32_t x, uint32_t y) const;
+
+        private:
+            struct DepthLevel
+            {
+                uint32_t m_width = 0;
+                uint32_t m_height = 0;
+                AZStd::vector<float> m_depths;
+            };
+
+            // Screen space vertex: texel coordinates and the reciprocal of the view depth, which is linear in screen space.
+            struct ScreenVertex
+            {
+                float m_x;
+                float m_y;
+                float m_inverseDepth;
+            };
+
+            void RenderClippedTriangle(const Vector4& clip0, const Vector4& clip1, const Vector4& clip2);
+            void RasterizeTriangle(ScreenVertex v0, ScreenVertex v1, ScreenVertex v2);
+            ScreenVertex ToScreen(const Vector4& clipPosition) const;
+
+            Matrix4x4 m_worldToClip = Matrix4x4::CreateIdentity();
+
+            // m_levels[0] is the depth buffer the occluders are rendered into, the other levels are the hierarchical-Z pyramid.
+            AZStd::vector<DepthLevel> m_levels;
+
+            // Scratch buffer of clip space positions, kept to avoid allocations.
+            AZStd::vector<Vector4> m_clipPositions;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -18,6 +18,7 @@
 #include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Name/Name.h>
 
 class MaskedOcclusionCulling;
@@ -35,6 +36,8 @@ namespace AZ
 
     namespace RPI
     {
+        class SoftwareOcclusionBuffer;
+
         //! Represents a view into a scene, and is the primary interface for adding DrawPackets to the draw queues.
         //! It encapsulates the world<->view<->clip transforms and the per-view shader constants.
         //! Use View::CreateView() to make new vew Objects to ensure that you have a shared ViewPtr to pass around the code.
@@ -119,6 +122,10 @@ namespace AZ
             //! Value returned is 1.0f when an area equal to the viewport height squared is covered. Useful for accurate LOD decisions.
             float CalculateSphereAreaInClipSpace(const AZ::Vector3& sphereWorldPosition, float sphereRadius) const;
 
+            //! Returns the height in pixels of the tallest viewport of the raster passes that draw this view, as of the last frame
+            //! they were prepared. Returns 0 when the view isn't drawn by any raster pass yet.
+            float GetViewportHeight() const;
+
             const AZ::Name& GetName() const { return m_name; }
             const UsageFlags GetUsageFlags() { return m_usageFlags; }
 
@@ -138,6 +145,9 @@ namespace AZ
             //! Returns the masked occlusion culling interface
             MaskedOcclusionCulling* GetMaskedOcclusionCulling();
 
+            //! Returns the software occlusion buffer the occluders of the scene are rendered into, creating it on first use.
+            SoftwareOcclusionBuffer* GetSoftwareOcclusionBuffer();
+
             //! This is called by RenderPipeline when this view is added to the pipeline.
             void OnAddToRenderPipeline();
 
@@ -208,6 +218,9 @@ namespace AZ
 
             // Masked Occlusion Culling interface
             MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
+
+            // Hierarchical-Z occlusion buffer for the occluder meshes of the scene, only created for views which use it
+            AZStd::unique_ptr<SoftwareOcclusionBuffer> m_softwareOcclusionBuffer;
         };
 
         AZ_DEFINE_ENUM_BITWISE_OPERATORS(View::UsageFlags);
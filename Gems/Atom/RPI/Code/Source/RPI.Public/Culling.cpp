@@ -12,6 +12,7 @@
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/SoftwareOcclusionBuffer.h>
 #include <Atom/RPI.Public/View.h>
 
 #include <AzCore/Math/MatrixUtils.h>
@@ -23,6 +24,7 @@
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/sort.h>
 #include <Atom_RPI_Traits_Platform.h>
 
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
@@ -42,6 +44,14 @@ namespace AZ
     {
         AZ_CVAR(bool, r_CullInParallel, true, nullptr, ConsoleFunctorFlags::Null, "");
         AZ_CVAR(uint32_t, r_CullWorkPerBatch, 500, nullptr, ConsoleFunctorFlags::Null, "");
+        AZ_CVAR(bool, r_CullSoftwareOcclusion, false, nullptr, ConsoleFunctorFlags::Null,
+            "Renders the occluder meshes of the scene into a CPU hierarchical depth buffer for each camera view, and culls the objects hidden behind them. "
+            "The buffer is low resolution and the occluders use their lowest lod, so objects that are barely visible around the edges of occluders can be culled.");
+        AZ_CVAR(uint32_t, r_CullSoftwareOcclusionMaxOccluders, 128, nullptr, ConsoleFunctorFlags::Null,
+            "The maximum number of occluders rendered into the software occlusion buffer of a view, nearest first.");
+        AZ_CVAR(bool, r_CullStreamingImageMips, false, nullptr, ConsoleFunctorFlags::Null,
+            "Requests the mip levels of the streaming images of visible meshes that match their texel density on screen, instead of "
+            "streaming them in fully. Meshes record their texel densities when their culling data is built, so set this at startup.");
 
 #ifdef AZ_CULL_DEBUG_ENABLED
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
@@ -262,6 +272,37 @@ namespace AZ
             m_cullDataConcurrencyCheck.soft_unlock_shared();
         }
 
+        void CullingScene::RegisterOrUpdateOccluder(Cullable& cullable)
+        {
+            AZ_Assert(cullable.m_occluderData.m_mesh, "The Cullable must have an occluder mesh to be registered as an occluder");
+
+            // The occluder data is read in place during culling, so it can only be updated outside of Begin/EndCulling
+            m_cullDataConcurrencyCheck.soft_lock_shared();
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_occludersMutex);
+                if (AZStd::find(m_occluders.begin(), m_occluders.end(), &cullable) == m_occluders.end())
+                {
+                    m_occluders.push_back(&cullable);
+                }
+            }
+            m_cullDataConcurrencyCheck.soft_unlock_shared();
+        }
+
+        void CullingScene::UnregisterOccluder(Cullable& cullable)
+        {
+            m_cullDataConcurrencyCheck.soft_lock_shared();
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_occludersMutex);
+                auto iter = AZStd::find(m_occluders.begin(), m_occluders.end(), &cullable);
+                if (iter != m_occluders.end())
+                {
+                    *iter = m_occluders.back();
+                    m_occluders.pop_back();
+                }
+            }
+            m_cullDataConcurrencyCheck.soft_unlock_shared();
+        }
+
         uint32_t CullingScene::GetNumCullables() const
         {
             return m_visScene->GetEntryCount();
@@ -277,6 +318,8 @@ namespace AZ
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
 #endif
+            const SoftwareOcclusionBuffer* m_softwareOcclusionBuffer = nullptr;
+            float m_viewportHeight = 0.0f;
         };
 
         static AZStd::shared_ptr<WorklistData> MakeWorklistData(
@@ -284,7 +327,8 @@ namespace AZ
             const Scene& scene,
             View& view,
             Frustum& frustum,
-            [[maybe_unused]] void* maskedOcclusionCulling)
+            [[maybe_unused]] void* maskedOcclusionCulling,
+            const SoftwareOcclusionBuffer* softwareOcclusionBuffer)
         {
             AZStd::shared_ptr<WorklistData> worklistData = AZStd::make_shared<WorklistData>();
             worklistData->m_debugCtx = &debugCtx;
@@ -294,6 +338,8 @@ namespace AZ
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             worklistData->m_maskedOcclusionCulling = static_cast<MaskedOcclusionCulling*>(maskedOcclusionCulling);
 #endif
+            worklistData->m_softwareOcclusionBuffer = softwareOcclusionBuffer;
+            worklistData->m_viewportHeight = r_CullStreamingImageMips ? view.GetViewportHeight() : 0.0f;
             return worklistData;
         }
 
@@ -316,6 +362,7 @@ namespace AZ
                 // These variable are only used for the gathering of debug information.
                 uint32_t numDrawPackets = 0;
                 uint32_t numVisibleCullables = 0;
+                uint32_t numOccludedCullables = 0;
             #endif
 
             AZ_Assert(worklist.size() > 0, "Received empty worklist in ProcessWorklist");
@@ -350,6 +397,15 @@ namespace AZ
                                     continue;
                                 }
 
+                                if (worklistData->m_softwareOcclusionBuffer &&
+                                    worklistData->m_softwareOcclusionBuffer->IsOccluded(visibleEntry->m_boundingVolume))
+                                {
+                                    #ifdef AZ_CULL_DEBUG_ENABLED
+                                        ++numOccludedCullables;
+                                    #endif
+                                    continue;
+                                }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                                 if (TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
@@ -357,7 +413,7 @@ namespace AZ
                                     // There are ways to write this without [[maybe_unused]], but they are brittle.
                                     // For example, using #else could cause a bug where the function's parameter
                                     // is changed in #ifdef but not in #else.
-                                    [[maybe_unused]] const uint32_t drawPacketCount=AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view);
+                                    [[maybe_unused]] const uint32_t drawPacketCount=AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view, worklistData->m_viewportHeight);
                                     #ifdef AZ_CULL_DEBUG_ENABLED
                                         ++numVisibleCullables;
                                         numDrawPackets += drawPacketCount;
@@ -393,6 +449,15 @@ namespace AZ
                             }
                             else if (res == IntersectResult::Interior || ShapeIntersection::Overlaps(worklistData->m_frustum, c->m_cullData.m_boundingObb))
                             {
+                                if (worklistData->m_softwareOcclusionBuffer &&
+                                    worklistData->m_softwareOcclusionBuffer->IsOccluded(visibleEntry->m_boundingVolume))
+                                {
+                                    #ifdef AZ_CULL_DEBUG_ENABLED
+                                        ++numOccludedCullables;
+                                    #endif
+                                    continue;
+                                }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                                 if (TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
@@ -400,7 +465,7 @@ namespace AZ
                                     // There are ways to write this without [[maybe_unused]], but they are brittle.
                                     // For example, using #else could cause a bug where the function's parameter
                                     // is changed in #ifdef but not in #else.
-                                    [[maybe_unused]] const uint32_t drawPacketCount=AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view);
+                                    [[maybe_unused]] const uint32_t drawPacketCount=AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view, worklistData->m_viewportHeight);
                                     #ifdef AZ_CULL_DEBUG_ENABLED
                                         ++numVisibleCullables;
                                         numDrawPackets += drawPacketCount;
@@ -475,6 +540,7 @@ namespace AZ
                 //no need for mutex here since these are all atomics
                 cullStats.m_numVisibleDrawPackets += numDrawPackets;
                 cullStats.m_numVisibleCullables += numVisibleCullables;
+                cullStats.m_numOccludedCullables += numOccludedCullables;
                 ++cullStats.m_numJobs;
             }
 #endif //AZ_CULL_DEBUG_ENABLED
@@ -547,7 +613,8 @@ namespace AZ
             const Scene& scene [[maybe_unused]],
             View& view,
             AZ::Frustum& frustum [[maybe_unused]],
-            void*& maskedOcclusionCulling [[maybe_unused]])
+            void*& maskedOcclusionCulling [[maybe_unused]],
+            SoftwareOcclusionBuffer*& softwareOcclusionBuffer)
         {
             AZ_PROFILE_SCOPE(RPI, "CullingScene::ProcessCullablesCommon() - %s", view.GetName().GetCStr());
 
@@ -625,6 +692,66 @@ namespace AZ
                 }
             }
 #endif
+
+            softwareOcclusionBuffer = r_CullSoftwareOcclusion ? RenderOccluders(scene, view, frustum) : nullptr;
+        }
+
+        SoftwareOcclusionBuffer* CullingScene::RenderOccluders(const Scene& scene, View& view, const AZ::Frustum& frustum)
+        {
+            // Occluders are only worth it for the camera views, which have a perspective projection.
+            const bool isPerspective = view.GetViewToClipMatrix().GetElement(3, 3) == 0.0f;
+            if (m_occluders.empty() || !(view.GetUsageFlags() & View::UsageCamera) || !isPerspective)
+            {
+                return nullptr;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "CullingScene::RenderOccluders() - %s", view.GetName().GetCStr());
+
+            // Render the nearest occluders in the frustum first, they are the most likely to hide other objects.
+            using VisibleOccluder = AZStd::pair<const Cullable*, float>;
+            AZStd::vector<VisibleOccluder> visibleOccluders;
+            const Vector3 cameraPosition = view.GetCameraTransform().GetTranslation();
+            for (const Cullable* occluder : m_occluders)
+            {
+                if (occluder->m_cullData.m_scene == &scene &&       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
+                    !occluder->m_isHidden &&
+                    ShapeIntersection::Overlaps(frustum, occluder->m_cullData.m_visibilityEntry.m_boundingVolume))
+                {
+                    const float distanceSq = occluder->m_cullData.m_visibilityEntry.m_boundingVolume.GetDistanceSq(cameraPosition);
+                    visibleOccluders.push_back(AZStd::make_pair(occluder, distanceSq));
+                }
+            }
+
+            if (visibleOccluders.empty())
+            {
+                return nullptr;
+            }
+
+            const size_t occluderCount = AZStd::min<size_t>(visibleOccluders.size(), r_CullSoftwareOcclusionMaxOccluders);
+            AZStd::partial_sort(visibleOccluders.begin(), visibleOccluders.begin() + occluderCount, visibleOccluders.end(),
+                [](const VisibleOccluder& lhs, const VisibleOccluder& rhs)
+                {
+                    return lhs.second < rhs.second;
+                });
+
+            SoftwareOcclusionBuffer* softwareOcclusionBuffer = view.GetSoftwareOcclusionBuffer();
+            softwareOcclusionBuffer->Begin(view.GetWorldToClipMatrix());
+            for (size_t i = 0; i < occluderCount; ++i)
+            {
+                const Cullable::OccluderData& occluderData = visibleOccluders[i].first->m_occluderData;
+                softwareOcclusionBuffer->RenderTriangles(occluderData.m_localToWorld, occluderData.m_mesh->m_positions, occluderData.m_mesh->m_indices);
+            }
+            softwareOcclusionBuffer->End();
+
+#ifdef AZ_CULL_DEBUG_ENABLED
+            if (m_debugCtx.m_enableStats)
+            {
+                CullingDebugContext::CullStats& cullStats = m_debugCtx.GetCullStatsForView(&view);
+                cullStats.m_numOccluders = aznumeric_cast<uint32_t>(occluderCount);
+            }
+#endif
+
+            return softwareOcclusionBuffer;
         }
 
         void CullingScene::ProcessCullablesJobs(const Scene& scene, View& view, AZ::Job& parentJob)
@@ -635,11 +762,12 @@ namespace AZ
             AZ::Frustum frustum = Frustum::CreateFromMatrixColumnMajor(worldToClip);
 
             void* maskedOcclusionCulling = nullptr;
-            ProcessCullablesCommon(scene, view, frustum, maskedOcclusionCulling);
+            SoftwareOcclusionBuffer* softwareOcclusionBuffer = nullptr;
+            ProcessCullablesCommon(scene, view, frustum, maskedOcclusionCulling, softwareOcclusionBuffer);
 
             WorkListType worklist;
 
-            AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, maskedOcclusionCulling);
+            AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, maskedOcclusionCulling, softwareOcclusionBuffer);
 
             auto nodeVisitorLambda = [worklistData, &parentJob, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
             {
@@ -697,11 +825,12 @@ namespace AZ
             AZ::Frustum frustum = Frustum::CreateFromMatrixColumnMajor(worldToClip);
 
             void* maskedOcclusionCulling = nullptr;
-            ProcessCullablesCommon(scene, view, frustum, maskedOcclusionCulling);
+            SoftwareOcclusionBuffer* softwareOcclusionBuffer = nullptr;
+            ProcessCullablesCommon(scene, view, frustum, maskedOcclusionCulling, softwareOcclusionBuffer);
 
             AZStd::unique_ptr<WorkListType> worklist = AZStd::make_unique<WorkListType>();
 
-            AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, maskedOcclusionCulling);
+            AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, maskedOcclusionCulling, softwareOcclusionBuffer);
             static const AZ::TaskDescriptor descriptor{ "AZ::RPI::ProcessWorklist", "Graphics" };
 
             auto nodeVisitorLambda = [worklistData, &taskGraph, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
@@ -747,7 +876,7 @@ namespace AZ
         }
 
 
-        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view)
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view, float viewportHeight)
         {
 #ifdef AZ_CULL_PROFILE_DETAILED
             AZ_PROFILE_SCOPE(RPI, "AddLodDataToView");
@@ -763,6 +892,8 @@ namespace AZ
             const float approxScreenPercentage = ModelLodUtils::ApproxScreenPercentage(
                 pos, lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
 
+            const float diameterInPixels = AZStd::max(approxScreenPercentage * viewportHeight, 1.0f);
+
             uint32_t numVisibleDrawPackets = 0;
 
             auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
@@ -775,6 +906,13 @@ namespace AZ
                 {
                     view.AddDrawPacket(drawPacket, pos);
                 }
+                if (viewportHeight > 0.0f)
+                {
+                    for (const Cullable::LodData::StreamingImageUsage& streamingImage : lod.m_streamingImages)
+                    {
+                        streamingImage.m_image->SetTargetMipFromTexelDensity(streamingImage.m_texelsAcrossDiameter / diameterInPixels);
+                    }
+                }
             };
 
             switch (lodData.m_lodConfiguration.m_lodType)
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/DynamicDraw/DynamicBufferRingAllocator.h>
+
+#include <Atom/RHI.Reflect/Bits.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        void DynamicBufferRingAllocator::Init(uint32_t ringBufferSize, uint32_t chunkSize)
+        {
+            // Every range acquired from the ring starts at a multiple of ChunkAlignment. The remainder of the ring is left unused.
+            m_ringBufferSize = RHI::AlignDown(ringBufferSize, ChunkAlignment);
+            AZ_Assert(m_ringBufferSize > 0, "The ring buffer must be at least %u bytes", ChunkAlignment);
+
+            // Keep at least 64 chunks in the ring so that small rings are not used up by a handful of threads.
+            m_chunkSize = RHI::AlignDown(AZStd::min(chunkSize, m_ringBufferSize / 64), ChunkAlignment);
+            m_chunkSize = AZStd::max(m_chunkSize, ChunkAlignment);
+            m_maxChunkAllocationSize = m_chunkSize / 4;
+
+            m_position = 0;
+            m_positionLimit = m_ringBufferSize;
+            m_frameIndex = 1;
+            m_currentFrame = 0;
+            for (uint64_t& frameEndPosition : m_frameEndPositions)
+            {
+                frameEndPosition = 0;
+            }
+            m_threadChunks.Clear();
+        }
+
+        bool DynamicBufferRingAllocator::AcquireRange(uint32_t size, uint64_t& positionOut)
+        {
+            uint64_t position = m_position.load(AZStd::memory_order_relaxed);
+            uint64_t start = 0;
+            uint64_t end = 0;
+            do
+            {
+                // Ranges are contiguous in memory, so a range which doesn't fit before the end of the ring starts at its beginning.
+                start = position;
+                const uint64_t ringOffset = start % m_ringBufferSize;
+                if (ringOffset + size > m_ringBufferSize)
+                {
+                    start += m_ringBufferSize - ringOffset;
+                }
+                end = start + size;
+
+                // The limit only ever grows, so testing against a stale value is conservative.
+                if (end > m_positionLimit.load(AZStd::memory_order_acquire))
+                {
+                    return false;
+                }
+            } while (!m_position.compare_exchange_weak(position, end, AZStd::memory_order_acq_rel, AZStd::memory_order_relaxed));
+
+            positionOut = start;
+            return true;
+        }
+
+        bool DynamicBufferRingAllocator::Allocate(uint32_t size, uint32_t alignment, uint32_t& offsetOut)
+        {
+            AZ_Assert(alignment > 0 && alignment <= ChunkAlignment && ChunkAlignment % alignment == 0,
+                "DynamicBufferRingAllocator doesn't support an alignment of %u bytes", alignment);
+
+            if (size == 0 || size > m_ringBufferSize)
+            {
+                return false;
+            }
+
+            // Large allocations would waste most of a chunk, they get their own range of the ring.
+            if (size > m_maxChunkAllocationSize)
+            {
+                uint64_t position = 0;
+                if (!AcquireRange(RHI::AlignUp(size, ChunkAlignment), position))
+                {
+                    return false;
+                }
+                offsetOut = aznumeric_cast<uint32_t>(position % m_ringBufferSize);
+                return true;
+            }
+
+            ThreadChunk& chunk = m_threadChunks.GetStorage();
+            const uint64_t frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+
+            uint64_t position = RHI::AlignUp(chunk.m_position, static_cast<uint64_t>(alignment));
+            if (chunk.m_frameIndex != frameIndex || position + size > chunk.m_end)
+            {
+                // The chunk belongs to a previous frame or is full, retire it and take a new one.
+                uint64_t chunkStart = 0;
+                if (!AcquireRange(m_chunkSize, chunkStart))
+                {
+                    return false;
+                }
+                chunk.m_frameIndex = frameIndex;
+                chunk.m_end = chunkStart + m_chunkSize;
+                position = chunkStart;
+            }
+
+            chunk.m_position = position + size;
+            offsetOut = aznumeric_cast<uint32_t>(position % m_ringBufferSize);
+            return true;
+        }
+
+        void DynamicBufferRingAllocator::FrameEnd()
+        {
+            const uint32_t nextFrame = (m_currentFrame + 1) % RHI::Limits::Device::FrameCountMax;
+
+            // Save where the current frame ended. Allocations racing with this are either before this position, in the current
+            // frame, or after it and kept alive with the next frame.
+            m_frameEndPositions[m_currentFrame] = m_position.load(AZStd::memory_order_acquire);
+
+            // The oldest frame is no longer in use, so the ring can be filled up to where it ended.
+            m_positionLimit.store(m_frameEndPositions[nextFrame] + m_ringBufferSize, AZStd::memory_order_release);
+
+            m_currentFrame = nextFrame;
+
+            // Retire the chunks of every thread.
+            m_frameIndex.fetch_add(1, AZStd::memory_order_release);
+        }
+
+        uint32_t DynamicBufferRingAllocator::GetRingBufferSize() const
+        {
+            return m_ringBufferSize;
+        }
+
+        uint32_t DynamicBufferRingAllocator::GetChunkSize() const
+        {
+            return m_chunkSize;
+        }
+
+        uint64_t DynamicBufferRingAllocator::GetCurrentFrameSize() const
+        {
+            const uint32_t previousFrame = (m_currentFrame + RHI::Limits::Device::FrameCountMax - 1) % RHI::Limits::Device::FrameCountMax;
+            return m_position.load(AZStd::memory_order_relaxed) - m_frameEndPositions[previousFrame];
+        }
+    }
+}
@@ -49,7 +49,7 @@ namespace AZ
 
         RHI::Ptr<DynamicBuffer> DynamicDrawSystem::GetDynamicBuffer(uint32_t size, uint32_t alignment)
         {
-            AZStd::lock_guard<AZStd::mutex> lock(m_mutexBufferAlloc);
+            // The allocator is thread safe, only FrameEnd needs to be serialized.
             return m_bufferAlloc->Allocate(size, alignment);
         }
 
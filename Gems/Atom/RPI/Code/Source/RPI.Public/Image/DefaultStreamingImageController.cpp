@@ -9,10 +9,15 @@
 #include <Atom/RPI.Public/Image/DefaultStreamingImageController.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
+#include <Atom/RHI/StreamingImagePool.h>
+
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
+AZ_DECLARE_BUDGET(RPI);
+
 namespace AZ
 {
     namespace RPI
@@ -50,38 +55,133 @@ namespace AZ
             return RHI::ResultCode::Success;
         }
 
+        namespace
+        {
+            // Context caching the image data needed by the budget, which doesn't change once the image is attached.
+            class DefaultStreamingImageContext final
+                : public StreamingImageContext
+            {
+            public:
+                AZ_CLASS_ALLOCATOR(DefaultStreamingImageContext, AZ::ThreadPoolAllocator, 0);
+
+                bool m_isInitialized = false;
+
+                // Set by the controller once a mip level was requested for the image. Images without requests are streamed in fully.
+                mutable bool m_hasMipRequest = false;
+                uint16_t m_mipChainCount = 1;
+                AZStd::array<size_t, RHI::Limits::Image::MipCountMax> m_mipChainSizes = {};
+            };
+        }
+
+        void DefaultStreamingImageController::SetMemoryBudget(size_t budgetInBytes)
+        {
+            m_memoryBudgetOverride = budgetInBytes;
+        }
+
+        size_t DefaultStreamingImageController::GetMemoryBudget() const
+        {
+            const size_t memoryBudgetOverride = m_memoryBudgetOverride;
+            if (memoryBudgetOverride != NoMemoryBudgetOverride)
+            {
+                return memoryBudgetOverride;
+            }
+
+            const RHI::StreamingImagePool* pool = GetRHIPool();
+            return pool ? pool->GetDescriptor().m_budgetInBytes : 0;
+        }
+
+        const StreamingImageBudgetMetrics& DefaultStreamingImageController::GetBudgetMetrics() const
+        {
+            return m_budget.GetMetrics();
+        }
+
         StreamingImageContextPtr DefaultStreamingImageController::CreateContextInternal()
         {
-            StreamingImageContextPtr context = aznew StreamingImageContext();
+            StreamingImageContextPtr context = aznew DefaultStreamingImageContext();
             m_recentlyAttachedContexts.emplace_back(context);
             return context;
         }
 
         void DefaultStreamingImageController::UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts)
         {
-            AZ_UNUSED(timestamp);
-            AZ_UNUSED(contexts);
+            AZ_PROFILE_FUNCTION(RPI);
 
-            const uint32_t maxExpandsCount = 20;
-            uint32_t mipsExpandsPerUpdate = 0;
+            // Cache the mip chain sizes of the images attached since the last update.
+            for (const StreamingImageContextPtr& context : m_recentlyAttachedContexts)
+            {
+                if (StreamingImage* image = context->TryGetImage())
+                {
+                    DefaultStreamingImageContext* defaultContext = static_cast<DefaultStreamingImageContext*>(context.get());
+                    defaultContext->m_mipChainCount = static_cast<uint16_t>(GetMipChainCount(image));
+                    for (uint16_t mipChainIndex = 0; mipChainIndex < defaultContext->m_mipChainCount; ++mipChainIndex)
+                    {
+                        defaultContext->m_mipChainSizes[mipChainIndex] = GetMipChainDataSize(image, mipChainIndex);
+                    }
+                    defaultContext->m_isInitialized = true;
+                }
+            }
+            m_recentlyAttachedContexts.clear();
 
-            // [GFX TODO] [ATOM-551] Streaming image control of DefaultStreamingImageController
-            // For now we always stream in all the mips. Of course we need to make this smarter at some point.
-            if (!m_recentlyAttachedContexts.empty())
+            m_images.clear();
+            m_imageStates.clear();
+            for (const StreamingImageContext& context : contexts)
             {
-                for (auto& context : m_recentlyAttachedContexts)
+                StreamingImage* image = context.TryGetImage();
+                const DefaultStreamingImageContext& defaultContext = static_cast<const DefaultStreamingImageContext&>(context);
+                if (!image || !defaultContext.m_isInitialized)
                 {
-                    if (StreamingImage* image = context->TryGetImage())
+                    continue;
+                }
+
+                StreamingImageBudget::ImageState& imageState = m_imageStates.emplace_back();
+                imageState.m_mipChainSizes = defaultContext.m_mipChainSizes;
+                imageState.m_mipChainCount = defaultContext.m_mipChainCount;
+                imageState.m_residentMipChain = GetStreamingTargetMipChain(image);
+                imageState.m_lastAccessTimestamp = context.GetLastAccessTimestamp();
+
+                if (!image->IsStreamable())
+                {
+                    // Accounted for in the budget as a single mip chain which is never expanded or trimmed.
+                    size_t residentSize = 0;
+                    for (uint16_t mipChainIndex = imageState.m_residentMipChain; mipChainIndex < imageState.m_mipChainCount; ++mipChainIndex)
                     {
-                        QueueExpandToMipChainLevel(image, 0);
-                        mipsExpandsPerUpdate++;
-                        if (mipsExpandsPerUpdate >= maxExpandsCount)
-                        {
-                            break;
-                        }
+                        residentSize += imageState.m_mipChainSizes[mipChainIndex];
                     }
+                    imageState.m_mipChainSizes[0] = residentSize;
+                    imageState.m_mipChainCount = 1;
+                    imageState.m_residentMipChain = 0;
+                }
+                else if (context.GetTargetMip() != RHI::Limits::Image::MipCountMax)
+                {
+                    imageState.m_requestedMipChain = static_cast<uint16_t>(GetMipChainIndex(image, context.GetTargetMip()));
+                    defaultContext.m_hasMipRequest = true;
+                }
+                else if (!defaultContext.m_hasMipRequest)
+                {
+                    // Images which never had a mip request are streamed in fully, like they are used every frame.
+                    imageState.m_requestedMipChain = 0;
+                    imageState.m_lastAccessTimestamp = timestamp;
+                }
+                m_images.push_back(image);
+            }
+
+            m_budget.SetBudget(GetMemoryBudget());
+            m_decisions.clear();
+            m_budget.Update(m_imageStates, m_decisions);
+
+            uint32_t mipsExpandsPerUpdate = 0;
+            for (const StreamingImageBudget::Decision& decision : m_decisions)
+            {
+                StreamingImage* image = m_images[decision.m_imageIndex];
+                if (decision.m_targetMipChain > m_imageStates[decision.m_imageIndex].m_residentMipChain)
+                {
+                    TrimToMipChainLevel(image, decision.m_targetMipChain);
+                }
+                else if (mipsExpandsPerUpdate < MaxExpandsPerUpdate)
+                {
+                    QueueExpandToMipChainLevel(image, decision.m_targetMipChain);
+                    mipsExpandsPerUpdate++;
                 }
-                m_recentlyAttachedContexts.erase(m_recentlyAttachedContexts.begin(), m_recentlyAttachedContexts.begin() + mipsExpandsPerUpdate);
             }
         }
     }
@@ -248,6 +248,22 @@ namespace AZ
             }
         }
         
+        void StreamingImage::SetTargetMipFromTexelDensity(float texelsPerPixel)
+        {
+            SetTargetMip(GetMipLevelForTexelDensity(texelsPerPixel));
+        }
+
+        uint16_t StreamingImage::GetMipLevelForTexelDensity(float texelsPerPixel)
+        {
+            // Each mip halves the texel density, so a pixel covering 2^n texels is best served by mip n.
+            if (!(texelsPerPixel > 1.0f))
+            {
+                return 0;
+            }
+            const float mipLevel = AZStd::floor(log2f(texelsPerPixel));
+            return static_cast<uint16_t>(AZStd::min(mipLevel, static_cast<float>(RHI::Limits::Image::MipCountMax - 1)));
+        }
+
         uint16_t StreamingImage::GetResidentMipLevel()
         {
             return static_cast<uint16_t>(m_image->GetResidentMipLevel());
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Image/StreamingImageBudget.h>
+
+#include <AzCore/Debug/Profiler.h>
+
+AZ_DECLARE_BUDGET(RPI);
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace
+        {
+            // Requested steps are always granted before resident steps which are no longer requested.
+            constexpr uint64_t RequestedPriorityBit = uint64_t(1) << 63;
+            constexpr uint64_t TimestampMask = (uint64_t(1) << 48) - 1;
+
+            // Returns a priority which favors coarse mip chains, so that every image gets its first mip chains above the tail
+            // before any image gets its most detailed ones.
+            uint64_t GetCoarseFirstPriority(uint16_t mipChain, uint16_t tailMipChain)
+            {
+                const uint16_t stepsAboveTail = tailMipChain - mipChain;
+                return RHI::Limits::Image::MipCountMax - stepsAboveTail;
+            }
+        }
+
+        void StreamingImageBudget::SetBudget(size_t budgetInBytes)
+        {
+            m_budgetInBytes = budgetInBytes;
+        }
+
+        size_t StreamingImageBudget::GetBudget() const
+        {
+            return m_budgetInBytes;
+        }
+
+        const StreamingImageBudgetMetrics& StreamingImageBudget::GetMetrics() const
+        {
+            return m_metrics;
+        }
+
+        bool StreamingImageBudget::StepCompare::operator()(const Step& lhs, const Step& rhs) const
+        {
+            if (lhs.m_priority != rhs.m_priority)
+            {
+                return lhs.m_priority > rhs.m_priority;
+            }
+            if (lhs.m_imageIndex != rhs.m_imageIndex)
+            {
+                return lhs.m_imageIndex < rhs.m_imageIndex;
+            }
+            return lhs.m_mipChain > rhs.m_mipChain;
+        }
+
+        bool StreamingImageBudget::StepKey::operator==(const StepKey& rhs) const
+        {
+            return m_tailMipChain == rhs.m_tailMipChain &&
+                m_requestedMipChain == rhs.m_requestedMipChain &&
+                m_residentMipChain == rhs.m_residentMipChain &&
+                m_staleTimestamp == rhs.m_staleTimestamp;
+        }
+
+        bool StreamingImageBudget::StepKey::operator!=(const StepKey& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+        StreamingImageBudget::StepKey StreamingImageBudget::GetStepKey(const ImageState& image)
+        {
+            StepKey key;
+            key.m_tailMipChain = image.m_mipChainCount - 1;
+
+            uint16_t staleEnd = key.m_tailMipChain;
+            if (image.m_requestedMipChain != NoMipChainRequest)
+            {
+                key.m_requestedMipChain = AZStd::min(image.m_requestedMipChain, key.m_tailMipChain);
+                staleEnd = key.m_requestedMipChain;
+            }
+
+            // The resident mip chain and the timestamp only matter when there are resident mip chains beyond the request.
+            // Requested steps don't depend on the timestamp: the requests are reset every update, so they are all as recent.
+            key.m_residentMipChain = AZStd::min(image.m_residentMipChain, staleEnd);
+            if (key.m_residentMipChain < staleEnd)
+            {
+                key.m_staleTimestamp = image.m_lastAccessTimestamp & TimestampMask;
+            }
+            return key;
+        }
+
+        template<typename StepCallback>
+        void StreamingImageBudget::ForEachStep(uint32_t imageIndex, const StepKey& key, StepCallback stepCallback)
+        {
+            uint16_t staleEnd = key.m_tailMipChain;
+            if (key.m_requestedMipChain != NoMipChainRequest)
+            {
+                for (uint16_t mipChain = key.m_requestedMipChain; mipChain < key.m_tailMipChain; ++mipChain)
+                {
+                    const uint64_t priority = RequestedPriorityBit | GetCoarseFirstPriority(mipChain, key.m_tailMipChain);
+                    stepCallback(Step{ priority, imageIndex, mipChain });
+                }
+                staleEnd = key.m_requestedMipChain;
+            }
+
+            // Resident mip chains beyond the request are kept while the budget allows, most recently used first.
+            for (uint16_t mipChain = key.m_residentMipChain; mipChain < staleEnd; ++mipChain)
+            {
+                const uint64_t priority = (key.m_staleTimestamp << 8) | GetCoarseFirstPriority(mipChain, key.m_tailMipChain);
+                stepCallback(Step{ priority, imageIndex, mipChain });
+            }
+        }
+
+        void StreamingImageBudget::RequeueSteps(uint32_t imageIndex, const StepKey& key)
+        {
+            StepKey& queuedKey = m_stepKeys[imageIndex];
+            ForEachStep(imageIndex, queuedKey, [this](const Step& step)
+            {
+                m_steps.erase(step);
+            });
+            ForEachStep(imageIndex, key, [this](const Step& step)
+            {
+                m_steps.insert(step);
+            });
+            queuedKey = key;
+        }
+
+        void StreamingImageBudget::Update(AZStd::span<const ImageState> images, AZStd::vector<Decision>& decisionsOut)
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            m_metrics = {};
+            m_metrics.m_budgetInBytes = m_budgetInBytes;
+
+            // Drop the steps of the images which are gone since the last update.
+            for (uint32_t imageIndex = aznumeric_cast<uint32_t>(images.size()); imageIndex < m_stepKeys.size(); ++imageIndex)
+            {
+                RequeueSteps(imageIndex, StepKey{});
+            }
+            m_stepKeys.resize(images.size());
+            m_grantedMipChains.resize_no_construct(images.size());
+
+            // The tail mip chains are always resident. Every other mip chain is a step to be granted, and only the images
+            // whose steps changed since the last update need to be requeued.
+            size_t grantedBytes = 0;
+            size_t requestedBytes = 0;
+            for (uint32_t imageIndex = 0; imageIndex < images.size(); ++imageIndex)
+            {
+                const ImageState& image = images[imageIndex];
+                AZ_Assert(image.m_mipChainCount > 0 && image.m_mipChainCount <= RHI::Limits::Image::MipCountMax, "Invalid mip chain count.");
+
+                const StepKey key = GetStepKey(image);
+                if (key != m_stepKeys[imageIndex])
+                {
+                    RequeueSteps(imageIndex, key);
+                }
+
+                grantedBytes += image.m_mipChainSizes[key.m_tailMipChain];
+                m_grantedMipChains[imageIndex] = key.m_tailMipChain;
+
+                if (key.m_requestedMipChain != NoMipChainRequest)
+                {
+                    for (uint16_t mipChain = key.m_requestedMipChain; mipChain < key.m_tailMipChain; ++mipChain)
+                    {
+                        requestedBytes += image.m_mipChainSizes[mipChain];
+                    }
+                }
+            }
+            m_metrics.m_requestedBytes = grantedBytes + requestedBytes;
+
+            // Grant steps in priority order. A mip chain can only be granted once the next coarser one is, so that the
+            // resident mips of an image always stay contiguous down to the tail.
+            const bool isBudgetEnforced = m_budgetInBytes > 0;
+            for (const Step& step : m_steps)
+            {
+                uint16_t& grantedMipChain = m_grantedMipChains[step.m_imageIndex];
+                if (grantedMipChain != step.m_mipChain + 1)
+                {
+                    continue;
+                }
+
+                const size_t stepBytes = images[step.m_imageIndex].m_mipChainSizes[step.m_mipChain];
+                if (isBudgetEnforced && grantedBytes + stepBytes > m_budgetInBytes)
+                {
+                    continue;
+                }
+
+                grantedBytes += stepBytes;
+                grantedMipChain = step.m_mipChain;
+            }
+            m_metrics.m_grantedBytes = grantedBytes;
+
+            // Trims first, since they release the memory the expansions will use.
+            for (uint32_t imageIndex = 0; imageIndex < images.size(); ++imageIndex)
+            {
+                const ImageState& image = images[imageIndex];
+                const uint16_t grantedMipChain = m_grantedMipChains[imageIndex];
+                const uint16_t tailMipChain = image.m_mipChainCount - 1;
+                if (image.m_requestedMipChain != NoMipChainRequest && grantedMipChain > AZStd::min(image.m_requestedMipChain, tailMipChain))
+                {
+                    ++m_metrics.m_missCount;
+                }
+                if (grantedMipChain > image.m_residentMipChain)
+                {
+                    ++m_metrics.m_evictionCount;
+                    decisionsOut.push_back({ imageIndex, grantedMipChain });
+                }
+            }
+
+            // Then expansions, in the order their most detailed granted mip chain was granted.
+            for (const Step& step : m_steps)
+            {
+                const uint16_t grantedMipChain = m_grantedMipChains[step.m_imageIndex];
+                if (step.m_mipChain == grantedMipChain && grantedMipChain < images[step.m_imageIndex].m_residentMipChain)
+                {
+                    decisionsOut.push_back({ step.m_imageIndex, grantedMipChain });
+                }
+            }
+        }
+    }
+}
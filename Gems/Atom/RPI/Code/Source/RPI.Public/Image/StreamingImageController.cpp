@@ -10,6 +10,8 @@
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
+#include <Atom/RHI.Reflect/ImageSubresource.h>
+
 #include <AtomCore/Instance/InstanceDatabase.h>
 
 #include <AzCore/Jobs/Job.h>
@@ -173,6 +175,46 @@ namespace AZ
             image->TrimToMipChainLevel(mipChainIndex);
         }
 
+        size_t StreamingImageController::GetMipChainCount(const StreamingImage* image) const
+        {
+            return image->m_mipChains.size();
+        }
+
+        size_t StreamingImageController::GetMipChainIndex(const StreamingImage* image, size_t mipLevel) const
+        {
+            const StreamingImageAsset& imageAsset = *image->m_imageAsset;
+            const size_t lastMipLevel = imageAsset.GetImageDescriptor().m_mipLevels - 1;
+            return imageAsset.GetMipChainIndex(AZStd::min(mipLevel, lastMipLevel));
+        }
+
+        size_t StreamingImageController::GetMipChainDataSize(const StreamingImage* image, size_t mipChainIndex) const
+        {
+            const StreamingImageAsset& imageAsset = *image->m_imageAsset;
+            const RHI::ImageDescriptor& imageDescriptor = imageAsset.GetImageDescriptor();
+
+            const size_t mipLevelBegin = imageAsset.GetMipLevel(mipChainIndex);
+            const size_t mipLevelEnd = mipLevelBegin + imageAsset.GetMipCount(mipChainIndex);
+
+            size_t dataSize = 0;
+            for (size_t mipLevel = mipLevelBegin; mipLevel < mipLevelEnd; ++mipLevel)
+            {
+                const RHI::ImageSubresourceLayout layout =
+                    RHI::GetImageSubresourceLayout(imageDescriptor, RHI::ImageSubresource(static_cast<uint16_t>(mipLevel), 0));
+                dataSize += static_cast<size_t>(layout.m_bytesPerImage) * layout.m_size.m_depth;
+            }
+            return dataSize * imageDescriptor.m_arraySize;
+        }
+
+        uint16_t StreamingImageController::GetStreamingTargetMipChain(const StreamingImage* image) const
+        {
+            return image->m_state.m_streamingTarget;
+        }
+
+        RHI::StreamingImagePool* StreamingImageController::GetRHIPool() const
+        {
+            return m_pool;
+        }
+
         StreamingImageContextPtr StreamingImageController::CreateContextInternal()
         {
             return aznew StreamingImageContext();
@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/SoftwareOcclusionBuffer.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+
+#include <float.h>
+
+AZ_DECLARE_BUDGET(RPI);
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace
+        {
+            // Occluders are clipped at this view depth, and boxes nearer than it are never occluded. It doesn't need to match the
+            // near plane of the view: clipping occluders further away only removes the parts of them that are nearer than it.
+            constexpr float NearClipDepth = 0.1f;
+        }
+
+        SoftwareOcclusionBuffer::SoftwareOcclusionBuffer(uint32_t width, uint32_t height)
+        {
+            AZ_Assert(width > 0 && height > 0, "Invalid software occlusion buffer size %ux%u", width, height);
+
+            uint32_t levelWidth = (AZStd::max(width, 1u) + 3) & ~3u;
+            uint32_t levelHeight = AZStd::max(height, 1u);
+            while (true)
+            {
+                DepthLevel& level = m_levels.emplace_back();
+                level.m_width = levelWidth;
+                level.m_height = levelHeight;
+                level.m_depths.resize(levelWidth * levelHeight, FLT_MAX);
+
+                if (levelWidth == 1 && levelHeight == 1)
+                {
+                    break;
+                }
+                levelWidth = (levelWidth + 1) / 2;
+                levelHeight = (levelHeight + 1) / 2;
+            }
+        }
+
+        uint32_t SoftwareOcclusionBuffer::GetWidth() const
+        {
+            return m_levels[0].m_width;
+        }
+
+        uint32_t SoftwareOcclusionBuffer::GetHeight() const
+        {
+            return m_levels[0].m_height;
+        }
+
+        float SoftwareOcclusionBuffer::GetDepth(uint32_t x, uint32_t y) const
+        {
+            const DepthLevel& level = m_levels[0];
+            AZ_Assert(x < level.m_width && y < level.m_height, "Texel (%u, %u) is outside of the software occlusion buffer", x, y);
+            return level.m_depths[y * level.m_width + x];
+        }
+
+        void SoftwareOcclusionBuffer::Begin(const Matrix4x4& worldToClip)
+        {
+            m_worldToClip = worldToClip;
+            AZStd::fill(m_levels[0].m_depths.begin(), m_levels[0].m_depths.end(), FLT_MAX);
+        }
+
+        void SoftwareOcclusionBuffer::RenderTriangles(
+            const Matrix3x4& localToWorld, AZStd::span<const Vector3> positions, AZStd::span<const uint32_t> indices)
+        {
+            const Matrix4x4 localToClip = m_worldToClip * Matrix4x4::CreateFromMatrix3x4(localToWorld);
+
+            m_clipPositions.resize_no_construct(positions.size());
+            for (size_t i = 0; i < positions.size(); ++i)
+            {
+                m_clipPositions[i] = localToClip * Vector4::CreateFromVector3AndFloat(positions[i], 1.0f);
+            }
+
+            for (size_t i = 0; i + 2 < indices.size(); i += 3)
+            {
+                if (indices[i] >= positions.size() || indices[i + 1] >= positions.size() || indices[i + 2] >= positions.size())
+                {
+                    AZ_Assert(false, "Occluder triangle index out of range");
+                    continue;
+                }
+                RenderClippedTriangle(m_clipPositions[indices[i]], m_clipPositions[indices[i + 1]], m_clipPositions[indices[i + 2]]);
+            }
+        }
+
+        void SoftwareOcclusionBuffer::RenderClippedTriangle(const Vector4& clip0, const Vector4& clip1, const Vector4& clip2)
+        {
+            // Clip against the near plane, which turns the triangle into a polygon of up to 4 vertices.
+            const Vector4* input[3] = { &clip0, &clip1, &clip2 };
+            Vector4 clipped[4];
+            uint32_t clippedCount = 0;
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                const Vector4& a = *input[i];
+                const Vector4& b = *input[(i + 1) % 3];
+                const bool isInsideA = a.GetW() >= NearClipDepth;
+                const bool isInsideB = b.GetW() >= NearClipDepth;
+                if (isInsideA)
+                {
+                    clipped[clippedCount++] = a;
+                }
+                if (isInsideA != isInsideB)
+                {
+                    const float t = (NearClipDepth - a.GetW()) / (b.GetW() - a.GetW());
+                    clipped[clippedCount++] = a.Lerp(b, t);
+                }
+            }
+
+            if (clippedCount < 3)
+            {
+                return;
+            }
+
+            const ScreenVertex screen0 = ToScreen(clipped[0]);
+            const ScreenVertex screen2 = ToScreen(clipped[2]);
+            RasterizeTriangle(screen0, ToScreen(clipped[1]), screen2);
+            if (clippedCount == 4)
+            {
+                RasterizeTriangle(screen0, screen2, ToScreen(clipped[3]));
+            }
+        }
+
+        SoftwareOcclusionBuffer::ScreenVertex SoftwareOcclusionBuffer::ToScreen(const Vector4& clipPosition) const
+        {
+            const float inverseDepth = 1.0f / clipPosition.GetW();
+            return ScreenVertex{
+                (clipPosition.GetX() * inverseDepth * 0.5f + 0.5f) * m_levels[0].m_width,
+                (clipPosition.GetY() * inverseDepth * 0.5f + 0.5f) * m_levels[0].m_height,
+                inverseDepth };
+        }
+
+        void SoftwareOcclusionBuffer::RasterizeTriangle(ScreenVertex v0, ScreenVertex v1, ScreenVertex v2)
+        {
+            float area = (v1.m_x - v0.m_x) * (v2.m_y - v0.m_y) - (v1.m_y - v0.m_y) * (v2.m_x - v0.m_x);
+            if (area < 0.0f)
+            {
+                // Occluders are double-sided, flip back facing triangles so the edge functions are positive inside.
+                AZStd::swap(v1, v2);
+                area = -area;
+            }
+            if (!(area > FLT_EPSILON))
+            {
+                return;
+            }
+
+            DepthLevel& level = m_levels[0];
+
+            // Bounds of the triangle in texels, the first column is aligned to 4 texels.
+            const float minX = AZStd::max(AZStd::min(v0.m_x, AZStd::min(v1.m_x, v2.m_x)), 0.0f);
+            const float maxX = AZStd::min(AZStd::max(v0.m_x, AZStd::max(v1.m_x, v2.m_x)), level.m_width - 1.0f);
+            const float minY = AZStd::max(AZStd::min(v0.m_y, AZStd::min(v1.m_y, v2.m_y)), 0.0f);
+            const float maxY = AZStd::min(AZStd::max(v0.m_y, AZStd::max(v1.m_y, v2.m_y)), level.m_height - 1.0f);
+            if (minX > maxX || minY > maxY)
+            {
+                return;
+            }
+            const uint32_t x0 = aznumeric_cast<uint32_t>(minX) & ~3u;
+            const uint32_t x1 = aznumeric_cast<uint32_t>(maxX);
+            const uint32_t y0 = aznumeric_cast<uint32_t>(minY);
+            const uint32_t y1 = aznumeric_cast<uint32_t>(maxY);
+
+            // Edge functions E(x, y) = A * x + B * y + C, positive on the inside of the edge from a to b.
+            struct Edge
+            {
+                float m_a;
+                float m_b;
+                float m_c;
+            };
+            auto makeEdge = [](const ScreenVertex& a, const ScreenVertex& b)
+            {
+                const float edgeA = a.m_y - b.m_y;
+                const float edgeB = b.m_x - a.m_x;
+                return Edge{ edgeA, edgeB, -(edgeA * a.m_x + edgeB * a.m_y) };
+            };
+            const Edge edge01 = makeEdge(v0, v1);
+            const Edge edge12 = makeEdge(v1, v2);
+            const Edge edge20 = makeEdge(v2, v0);
+
+            // The inverse depth is interpolated with the barycentric coordinates, which are the edge functions over the area.
+            const float inverseArea = 1.0f / area;
+            const float depthA = (edge12.m_a * v0.m_inverseDepth + edge20.m_a * v1.m_inverseDepth + edge01.m_a * v2.m_inverseDepth) * inverseArea;
+            const float depthB = (edge12.m_b * v0.m_inverseDepth + edge20.m_b * v1.m_inverseDepth + edge01.m_b * v2.m_inverseDepth) * inverseArea;
+            const float depthC = (edge12.m_c * v0.m_inverseDepth + edge20.m_c * v1.m_inverseDepth + edge01.m_c * v2.m_inverseDepth) * inverseArea;
+
+            using Simd::Vec4;
+            const Vec4::FloatType texelCenterOffsets = Vec4::LoadImmediate(0.5f, 1.5f, 2.5f, 3.5f);
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType edge01A = Vec4::Splat(edge01.m_a);
+            const Vec4::FloatType edge12A = Vec4::Splat(edge12.m_a);
+            const Vec4::FloatType edge20A = Vec4::Splat(edge20.m_a);
+            const Vec4::FloatType depthAs = Vec4::Splat(depthA);
+
+            for (uint32_t y = y0; y <= y1; ++y)
+            {
+                const float centerY = y + 0.5f;
+                const Vec4::FloatType rowEdge01 = Vec4::Splat(edge01.m_b * centerY + edge01.m_c);
+                const Vec4::FloatType rowEdge12 = Vec4::Splat(edge12.m_b * centerY + edge12.m_c);
+                const Vec4::FloatType rowEdge20 = Vec4::Splat(edge20.m_b * centerY + edge20.m_c);
+                const Vec4::FloatType rowDepth = Vec4::Splat(depthB * centerY + depthC);
+
+                float* row = level.m_depths.data() + y * level.m_width;
+                for (uint32_t x = x0; x <= x1; x += 4)
+                {
+                    const Vec4::FloatType centersX = Vec4::Add(Vec4::Splat(static_cast<float>(x)), texelCenterOffsets);
+                    const Vec4::FloatType inside = Vec4::And(
+                        Vec4::And(
+                            Vec4::CmpGtEq(Vec4::Madd(edge01A, centersX, rowEdge01), zero),
+                            Vec4::CmpGtEq(Vec4::Madd(edge12A, centersX, rowEdge12), zero)),
+                        Vec4::CmpGtEq(Vec4::Madd(edge20A, centersX, rowEdge20), zero));
+                    if (Vec4::CmpAllEq(Vec4::CastToInt(inside), Vec4::ZeroInt()))
+                    {
+                        continue;
+                    }
+
+                    const Vec4::FloatType depth = Vec4::Reciprocal(Vec4::Madd(depthAs, centersX, rowDepth));
+                    const Vec4::FloatType current = Vec4::LoadUnaligned(row + x);
+                    Vec4::StoreUnaligned(row + x, Vec4::Select(Vec4::Min(current, depth), current, inside));
+                }
+            }
+        }
+
+        void SoftwareOcclusionBuffer::End()
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            // Each texel of a level keeps the farthest depth of the 2x2 texels it covers in the previous level.
+            for (size_t levelIndex = 1; levelIndex < m_levels.size(); ++levelIndex)
+            {
+                const DepthLevel& source = m_levels[levelIndex - 1];
+                DepthLevel& destination = m_levels[levelIndex];
+                for (uint32_t y = 0; y < destination.m_height; ++y)
+                {
+                    const float* sourceRow0 = source.m_depths.data() + (2 * y) * source.m_width;
+                    const float* sourceRow1 = source.m_depths.data() + AZStd::min(2 * y + 1, source.m_height - 1) * source.m_width;
+                    float* destinationRow = destination.m_depths.data() + y * destination.m_width;
+                    for (uint32_t x = 0; x < destination.m_width; ++x)
+                    {
+                        const uint32_t sourceX0 = 2 * x;
+                        const uint32_t sourceX1 = AZStd::min(2 * x + 1, source.m_width - 1);
+                        destinationRow[x] = AZStd::max(
+                            AZStd::max(sourceRow0[sourceX0], sourceRow0[sourceX1]),
+                            AZStd::max(sourceRow1[sourceX0], sourceRow1[sourceX1]));
+                    }
+                }
+            }
+        }
+
+        bool SoftwareOcclusionBuffer::IsOccluded(const Aabb& worldAabb) const
+        {
+            using Simd::Vec4;
+
+            // Project the 8 corners of the box, 4 at a time: the near z corners then the far z corners.
+            const Vector3& minBound = worldAabb.GetMin();
+            const Vector3& maxBound = worldAabb.GetMax();
+            const Vec4::FloatType cornersX = Vec4::LoadImmediate(minBound.GetX(), maxBound.GetX(), minBound.GetX(), maxBound.GetX());
+            const Vec4::FloatType cornersY = Vec4::LoadImmediate(minBound.GetY(), minBound.GetY(), maxBound.GetY(), maxBound.GetY());
+            const Vec4::FloatType cornersMinZ = Vec4::Splat(minBound.GetZ());
+            const Vec4::FloatType cornersMaxZ = Vec4::Splat(maxBound.GetZ());
+
+            auto transformRow = [this, &cornersX, &cornersY](int32_t row, const Vec4::FloatType& cornersZ)
+            {
+                return Vec4::Madd(Vec4::Splat(m_worldToClip.GetElement(row, 0)), cornersX,
+                    Vec4::Madd(Vec4::Splat(m_worldToClip.GetElement(row, 1)), cornersY,
+                        Vec4::Madd(Vec4::Splat(m_worldToClip.GetElement(row, 2)), cornersZ, Vec4::Splat(m_worldToClip.GetElement(row, 3)))));
+            };
+
+            const Vec4::FloatType depths0 = transformRow(3, cornersMinZ);
+            const Vec4::FloatType depths1 = transformRow(3, cornersMaxZ);
+
+            alignas(16) float reduce[4][4];
+            Vec4::StoreAligned(reduce[0], Vec4::Min(depths0, depths1));
+            const float minDepth = AZStd::min(AZStd::min(reduce[0][0], reduce[0][1]), AZStd::min(reduce[0][2], reduce[0][3]));
+            if (minDepth < NearClipDepth)
+            {
+                return false;
+            }
+
+            const Vec4::FloatType inverseDepths0 = Vec4::Reciprocal(depths0);
+            const Vec4::FloatType inverseDepths1 = Vec4::Reciprocal(depths1);
+            const Vec4::FloatType ndcX0 = Vec4::Mul(transformRow(0, cornersMinZ), inverseDepths0);
+            const Vec4::FloatType ndcX1 = Vec4::Mul(transformRow(0, cornersMaxZ), inverseDepths1);
+            const Vec4::FloatType ndcY0 = Vec4::Mul(transformRow(1, cornersMinZ), inverseDepths0);
+            const Vec4::FloatType ndcY1 = Vec4::Mul(transformRow(1, cornersMaxZ), inverseDepths1);
+            Vec4::StoreAligned(reduce[0], Vec4::Min(ndcX0, ndcX1));
+            Vec4::StoreAligned(reduce[1], Vec4::Max(ndcX0, ndcX1));
+            Vec4::StoreAligned(reduce[2], Vec4::Min(ndcY0, ndcY1));
+            Vec4::StoreAligned(reduce[3], Vec4::Max(ndcY0, ndcY1));
+            const float ndcMinX = AZStd::min(AZStd::min(reduce[0][0], reduce[0][1]), AZStd::min(reduce[0][2], reduce[0][3]));
+            const float ndcMaxX = AZStd::max(AZStd::max(reduce[1][0], reduce[1][1]), AZStd::max(reduce[1][2], reduce[1][3]));
+            const float ndcMinY = AZStd::min(AZStd::min(reduce[2][0], reduce[2][1]), AZStd::min(reduce[2][2], reduce[2][3]));
+            const float ndcMaxY = AZStd::max(AZStd::max(reduce[3][0], reduce[3][1]), AZStd::max(reduce[3][2], reduce[3][3]));
+
+            // Texel rectangle covered by the box, clamped to the buffer.
+            const DepthLevel& fullLevel = m_levels[0];
+            const float texelMinX = (ndcMinX * 0.5f + 0.5f) * fullLevel.m_width;
+            const float texelMaxX = (ndcMaxX * 0.5f + 0.5f) * fullLevel.m_width;
+            const float texelMinY = (ndcMinY * 0.5f + 0.5f) * fullLevel.m_height;
+            const float texelMaxY = (ndcMaxY * 0.5f + 0.5f) * fullLevel.m_height;
+            if (texelMaxX < 0.0f || texelMaxY < 0.0f || texelMinX >= fullLevel.m_width || texelMinY >= fullLevel.m_height)
+            {
+                return false;
+            }
+            const uint32_t x0 = aznumeric_cast<uint32_t>(AZStd::max(texelMinX, 0.0f));
+            const uint32_t x1 = aznumeric_cast<uint32_t>(AZStd::min(texelMaxX, fullLevel.m_width - 1.0f));
+            const uint32_t y0 = aznumeric_cast<uint32_t>(AZStd::max(texelMinY, 0.0f));
+            const uint32_t y1 = aznumeric_cast<uint32_t>(AZStd::min(texelMaxY, fullLevel.m_height - 1.0f));
+
+            // Pick the finest level where the rectangle covers at most 4x4 texels.
+            uint32_t levelIndex = 0;
+            while (levelIndex + 1 < m_levels.size() &&
+                ((x1 >> levelIndex) - (x0 >> levelIndex) > 3 || (y1 >> levelIndex) - (y0 >> levelIndex) > 3))
+            {
+                ++levelIndex;
+            }
+
+            const DepthLevel& level = m_levels[levelIndex];
+            const uint32_t levelX0 = x0 >> levelIndex;
+            const uint32_t levelX1 = x1 >> levelIndex;
+            const Vec4::FloatType minDepths = Vec4::Splat(minDepth);
+            for (uint32_t y = y0 >> levelIndex; y <= (y1 >> levelIndex); ++y)
+            {
+                const float* row = level.m_depths.data() + y * level.m_width;
+                uint32_t x = levelX0;
+                for (; x + 3 <= levelX1; x += 4)
+                {
+                    if (!Vec4::CmpAllLt(Vec4::LoadUnaligned(row + x), minDepths))
+                    {
+                        return false;
+                    }
+                }
+                for (; x <= levelX1; ++x)
+                {
+                    if (row[x] >= minDepth)
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -12,7 +12,9 @@
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Culling.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Pass/RasterPass.h>
 #include <Atom/RPI.Public/Pass/Specific/SwapChainPass.h>
+#include <Atom/RPI.Public/SoftwareOcclusionBuffer.h>
 #include <Atom/RHI/DrawListTagRegistry.h>
 
 #include <AzCore/Casting/lossy_cast.h>
@@ -365,6 +367,22 @@ namespace AZ
             return sortKey;
         }
 
+        float View::GetViewportHeight() const
+        {
+            float viewportHeight = 0.0f;
+            if (m_passesByDrawList)
+            {
+                for (const auto& [drawListTag, pass] : *m_passesByDrawList)
+                {
+                    if (const RasterPass* rasterPass = azrtti_cast<const RasterPass*>(pass))
+                    {
+                        viewportHeight = AZStd::max(viewportHeight, rasterPass->GetViewportState().GetHeight());
+                    }
+                }
+            }
+            return viewportHeight;
+        }
+
         float View::CalculateSphereAreaInClipSpace(const AZ::Vector3& sphereWorldPosition, float sphereRadius) const
         {
             // Projection of a sphere to clip space 
@@ -501,6 +519,15 @@ namespace AZ
             return m_maskedOcclusionCulling;
         }
 
+        SoftwareOcclusionBuffer* View::GetSoftwareOcclusionBuffer()
+        {
+            if (!m_softwareOcclusionBuffer)
+            {
+                m_softwareOcclusionBuffer = AZStd::make_unique<SoftwareOcclusionBuffer>();
+            }
+            return m_softwareOcclusionBuffer.get();
+        }
+
         void View::TryCreateShaderResourceGroup()
         {
             if (!m_shaderResourceGroup)
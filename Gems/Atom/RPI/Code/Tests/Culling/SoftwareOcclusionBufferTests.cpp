@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+
+#include <Atom/RPI.Public/SoftwareOcclusionBuffer.h>
+
+#include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    namespace
+    {
+        // Camera at the origin looking down -Z, so world space is view space.
+        Matrix4x4 CreateWorldToClip()
+        {
+            Matrix4x4 viewToClip;
+            MakePerspectiveFovMatrixRH(viewToClip, Constants::HalfPi, 2.0f, 0.1f, 1000.0f, true);
+            return viewToClip;
+        }
+
+        // A quad facing the camera, centered on the Z axis.
+        void RenderQuad(SoftwareOcclusionBuffer& buffer, float halfSize, float z, const Matrix3x4& localToWorld = Matrix3x4::CreateIdentity())
+        {
+            const Vector3 positions[] = {
+                Vector3(-halfSize, -halfSize, z),
+                Vector3(halfSize, -halfSize, z),
+                Vector3(halfSize, halfSize, z),
+                Vector3(-halfSize, halfSize, z),
+            };
+            const uint32_t indices[] = { 0, 1, 2, 2, 3, 0 };
+            buffer.RenderTriangles(localToWorld, positions, indices);
+        }
+    }
+
+    class SoftwareOcclusionBufferTests
+        : public UnitTest::AllocatorsTestFixture
+    {
+    };
+
+    TEST_F(SoftwareOcclusionBufferTests, IsOccluded_NoOccluders_NothingIsOccluded)
+    {
+        SoftwareOcclusionBuffer buffer;
+        buffer.Begin(CreateWorldToClip());
+        buffer.End();
+
+        EXPECT_FALSE(buffer.IsOccluded(Aabb::CreateCenterHalfExtents(Vector3(0.0f, 0.0f, -20.0f), Vector3(1.0f))));
+        EXPECT_EQ(buffer.GetDepth(buffer.GetWidth() / 2, buffer.GetHeight() / 2), FLT_MAX);
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, RenderTriangles_QuadInFrontOfCamera_DepthIsViewDistance)
+    {
+        SoftwareOcclusionBuffer buffer;
+        buffer.Begin(CreateWorldToClip());
+        RenderQuad(buffer, 5.0f, -10.0f);
+        buffer.End();
+
+        EXPECT_NEAR(buffer.GetDepth(buffer.GetWidth() / 2, buffer.GetHeight() / 2), 10.0f, 0.01f);
+        EXPECT_EQ(buffer.GetDepth(0, 0), FLT_MAX);
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, IsOccluded_BoxBehindOccluder_IsOccluded)
+    {
+        SoftwareOcclusionBuffer buffer;
+        buffer.Begin(CreateWorldToClip());
+        RenderQuad(buffer, 5.0f, -10.0f);
+        buffer.End();
+
+        EXPECT_TRUE(buffer.IsOccluded(Aabb::CreateCenterHalfExtents(Vector3(0.0f, 0.0f, -20.0f), Vector3(1.0f))));
+        EXPECT_TRUE(buffer.IsOccluded(Aabb::CreateCenterHalfExtents(Vector3(1.0f, -1.0f, -100.0f), Vector3(5.0f))));
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, IsOccluded_BoxInFrontOfOrBesideOccluder_IsNotOccluded)
+    {
+        SoftwareOcclusionBuffer buffer;
+        buffer.Begin(CreateWorldToClip());
+        RenderQuad(buffer, 5.0f, -10.0f);
+        buffer.End();
+
+        // In front of the occluder
+        EXPECT_FALSE(buffer.IsOccluded(Aabb::CreateCenterHalfExtents(Vector3(0.0f, 0.0f, -5.0f), Vector3(1.0f))));
+        // Intersecting the occluder
+        EXPECT_FALSE(buffer.IsOccluded(Aabb::CreateCenterHalfExtents(Vector3(0.0f, 0.0f, -10.0f), Vector3(1.0f))));
+        // Behind the occluder but larger than it on screen
+        EXPECT_FALSE(buffer.IsOccluded(Aabb::CreateCenterHalfExtents(Vector3(0.0f, 0.0f, -20.0f), Vector3(15.0f, 1.0f, 1.0f))));
+        // Off to the side
+        EXPECT_FALSE(buffer.IsOccluded(Aabb::CreateCenterHalfExtents(Vector3(20.0f, 0.0f, -20.0f), Vector3(1.0f))));
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, IsOccluded_BoxCrossingNearPlane_IsNotOccluded)
+    {
+        SoftwareOcclusionBuffer buffer;
+        buffer.Begin(CreateWorldToClip());
+        RenderQuad(buffer, 5.0f, -10.0f);
+        buffer.End();
+
+        EXPECT_FALSE(buffer.IsOccluded(Aabb::CreateCenterHalfExtents(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f))));
+        EXPECT_FALSE(buffer.IsOccluded(Aabb::CreateCenterHalfExtents(Vector3(0.0f, 0.0f, 10.0f), Vector3(1.0f))));
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, IsOccluded_OccluderCrossingNearPlane_IsClippedAndOccludes)
+    {
+        SoftwareOcclusionBuffer buffer;
+        buffer.Begin(CreateWorldToClip());
+
+        // A ramp which starts below and behind the camera and rises across the view, so it crosses the near plane.
+        const Vector3 positions[] = {
+            Vector3(-100.0f, -1.0f, 10.0f),
+            Vector3(100.0f, -1.0f, 10.0f),
+            Vector3(100.0f, 5.0f, -100.0f),
+            Vector3(-100.0f, 5.0f, -100.0f),
+        };
+        const uint32_t indices[] = { 0, 1, 2, 2, 3, 0 };
+        buffer.RenderTriangles(Matrix3x4::CreateIdentity(), positions, indices);
+        buffer.End();
+
+        EXPECT_TRUE(buffer.IsOccluded(Aabb::CreateCenterHalfExtents(Vector3(0.0f, -10.0f, -50.0f), Vector3(2.0f))));
+        EXPECT_FALSE(buffer.IsOccluded(Aabb::CreateCenterHalfExtents(Vector3(0.0f, 20.0f, -50.0f), Vector3(2.0f))));
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, RenderTriangles_LocalToWorld_IsApplied)
+    {
+        SoftwareOcclusionBuffer buffer;
+        buffer.Begin(CreateWorldToClip());
+        RenderQuad(buffer, 1.0f, 0.0f, Matrix3x4::CreateTranslation(Vector3(0.0f, 0.0f, -10.0f)) * Matrix3x4::CreateScale(Vector3(5.0f)));
+        buffer.End();
+
+        EXPECT_NEAR(buffer.GetDepth(buffer.GetWidth() / 2, buffer.GetHeight() / 2), 10.0f, 0.01f);
+        EXPECT_TRUE(buffer.IsOccluded(Aabb::CreateCenterHalfExtents(Vector3(0.0f, 0.0f, -20.0f), Vector3(1.0f))));
+    }
+
+    TEST_F(SoftwareOcclusionBufferTests, Begin_AfterRendering_BufferIsCleared)
+    {
+        SoftwareOcclusionBuffer buffer;
+        buffer.Begin(CreateWorldToClip());
+        RenderQuad(buffer, 5.0f, -10.0f);
+        buffer.End();
+
+        buffer.Begin(CreateWorldToClip());
+        buffer.End();
+
+        EXPECT_EQ(buffer.GetDepth(buffer.GetWidth() / 2, buffer.GetHeight() / 2), FLT_MAX);
+        EXPECT_FALSE(buffer.IsOccluded(Aabb::CreateCenterHalfExtents(Vector3(0.0f, 0.0f, -20.0f), Vector3(1.0f))));
+    }
+
+#ifdef HAVE_BENCHMARK
+    //! Measures the cost of rendering occluders and of testing boxes against the hierarchical-Z pyramid, which happens for
+    //! every visible cullable of a camera view when r_CullSoftwareOcclusion is enabled.
+    class SoftwareOcclusionBufferBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+
+    protected:
+        void InternalSetUp(const benchmark::State& state)
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            // A grid of walls at various depths.
+            m_positions = {};
+            m_indices = {};
+            for (int32_t x = -8; x < 8; ++x)
+            {
+                for (int32_t y = -4; y < 4; ++y)
+                {
+                    const float z = -20.0f - 2.0f * ((x + y) & 7);
+                    const uint32_t baseVertex = aznumeric_cast<uint32_t>(m_positions.size());
+                    m_positions.push_back(Vector3(x * 4.0f, y * 4.0f, z));
+                    m_positions.push_back(Vector3(x * 4.0f + 3.5f, y * 4.0f, z));
+                    m_positions.push_back(Vector3(x * 4.0f + 3.5f, y * 4.0f + 3.5f, z));
+                    m_positions.push_back(Vector3(x * 4.0f, y * 4.0f + 3.5f, z));
+                    for (uint32_t index : { 0, 1, 2, 2, 3, 0 })
+                    {
+                        m_indices.push_back(baseVertex + index);
+                    }
+                }
+            }
+
+            // Boxes of various sizes scattered behind and in front of the walls.
+            m_boxes = {};
+            for (uint32_t i = 0; i < BoxCount; ++i)
+            {
+                const float x = aznumeric_cast<float>((i * 7919) % 200) - 100.0f;
+                const float y = aznumeric_cast<float>((i * 104729) % 100) - 50.0f;
+                const float z = -5.0f - aznumeric_cast<float>((i * 1299709) % 200);
+                const float halfExtent = 0.25f + aznumeric_cast<float>(i % 8);
+                m_boxes.push_back(Aabb::CreateCenterHalfExtents(Vector3(x, y, z), Vector3(halfExtent)));
+            }
+
+            m_buffer = AZStd::make_unique<SoftwareOcclusionBuffer>();
+        }
+
+        void InternalTearDown(const benchmark::State& state)
+        {
+            m_buffer.reset();
+            m_positions = {};
+            m_indices = {};
+            m_boxes = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void RenderOccluders()
+        {
+            m_buffer->Begin(CreateWorldToClip());
+            m_buffer->RenderTriangles(Matrix3x4::CreateIdentity(), m_positions, m_indices);
+            m_buffer->End();
+        }
+
+        static constexpr uint32_t BoxCount = 10000;
+
+        AZStd::unique_ptr<SoftwareOcclusionBuffer> m_buffer;
+        AZStd::vector<Vector3> m_positions;
+        AZStd::vector<uint32_t> m_indices;
+        AZStd::vector<Aabb> m_boxes;
+    };
+
+    BENCHMARK_F(SoftwareOcclusionBufferBenchmarkFixture, BM_RenderOccluders)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            RenderOccluders();
+        }
+        state.SetItemsProcessed(state.iterations() * m_indices.size() / 3);
+    }
+
+    BENCHMARK_F(SoftwareOcclusionBufferBenchmarkFixture, BM_IsOccluded)(benchmark::State& state)
+    {
+        RenderOccluders();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            uint32_t occludedCount = 0;
+            for (const Aabb& box : m_boxes)
+            {
+                occludedCount += m_buffer->IsOccluded(box) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(occludedCount);
+        }
+        state.SetItemsProcessed(state.iterations() * m_boxes.size());
+    }
+#endif
+}
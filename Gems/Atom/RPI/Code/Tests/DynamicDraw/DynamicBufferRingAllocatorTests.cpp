@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+
+#include <Atom/RPI.Public/DynamicDraw/DynamicBufferRingAllocator.h>
+
+#include <Atom/RHI.Reflect/Bits.h>
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    namespace
+    {
+        struct Allocation
+        {
+            uint32_t m_offset;
+            uint32_t m_size;
+        };
+
+        // Returns true if none of the allocations overlap and all of them are within the ring.
+        bool AreAllocationsDisjoint(AZStd::vector<Allocation> allocations, uint32_t ringBufferSize)
+        {
+            AZStd::sort(allocations.begin(), allocations.end(), [](const Allocation& lhs, const Allocation& rhs)
+            {
+                return lhs.m_offset < rhs.m_offset;
+            });
+            for (size_t i = 0; i < allocations.size(); ++i)
+            {
+                if (allocations[i].m_offset + allocations[i].m_size > ringBufferSize)
+                {
+                    return false;
+                }
+                if (i > 0 && allocations[i - 1].m_offset + allocations[i - 1].m_size > allocations[i].m_offset)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Allocation sizes from a few vertices up to a couple of kilobytes.
+        uint32_t GetAllocationSize(uint32_t index)
+        {
+            return 16 + (index * 97) % 2048;
+        }
+    }
+
+    class DynamicBufferRingAllocatorTests
+        : public UnitTest::AllocatorsTestFixture
+    {
+    };
+
+    TEST_F(DynamicBufferRingAllocatorTests, Allocate_SingleThread_AllocationsAreAlignedAndDisjoint)
+    {
+        constexpr uint32_t RingBufferSize = 4 * 1024 * 1024;
+        constexpr uint32_t Alignment = 16;
+
+        DynamicBufferRingAllocator allocator;
+        allocator.Init(RingBufferSize);
+
+        AZStd::vector<Allocation> allocations;
+        for (uint32_t i = 0; i < 1000; ++i)
+        {
+            Allocation allocation{ 0, GetAllocationSize(i) };
+            ASSERT_TRUE(allocator.Allocate(allocation.m_size, Alignment, allocation.m_offset));
+            EXPECT_EQ(allocation.m_offset % Alignment, 0);
+            allocations.push_back(allocation);
+        }
+
+        EXPECT_TRUE(AreAllocationsDisjoint(allocations, RingBufferSize));
+    }
+
+    TEST_F(DynamicBufferRingAllocatorTests, Allocate_MultipleThreads_AllocationsAreDisjoint)
+    {
+        constexpr uint32_t RingBufferSize = 16 * 1024 * 1024;
+        constexpr uint32_t ThreadCount = 8;
+        constexpr uint32_t AllocationsPerThread = 500;
+
+        DynamicBufferRingAllocator allocator;
+        allocator.Init(RingBufferSize);
+
+        AZStd::vector<AZStd::vector<Allocation>> threadAllocations(ThreadCount);
+        AZStd::vector<AZStd::thread> threads;
+        for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&allocator, &allocations = threadAllocations[threadIndex], threadIndex]()
+            {
+                for (uint32_t i = 0; i < AllocationsPerThread; ++i)
+                {
+                    Allocation allocation{ 0, GetAllocationSize(i + threadIndex) };
+                    if (allocator.Allocate(allocation.m_size, 4, allocation.m_offset))
+                    {
+                        allocations.push_back(allocation);
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        AZStd::vector<Allocation> allocations;
+        for (const AZStd::vector<Allocation>& threadAllocation : threadAllocations)
+        {
+            EXPECT_EQ(threadAllocation.size(), AllocationsPerThread);
+            allocations.insert(allocations.end(), threadAllocation.begin(), threadAllocation.end());
+        }
+        EXPECT_TRUE(AreAllocationsDisjoint(allocations, RingBufferSize));
+    }
+
+    TEST_F(DynamicBufferRingAllocatorTests, Allocate_RingFull_MemoryIsReusedAfterFrameCountMaxFrames)
+    {
+        constexpr uint32_t RingBufferSize = 16 * 1024;
+        constexpr uint32_t AllocationSize = 1024;
+
+        DynamicBufferRingAllocator allocator;
+        allocator.Init(RingBufferSize);
+
+        uint32_t offset = 0;
+        for (uint32_t i = 0; i < RingBufferSize / AllocationSize; ++i)
+        {
+            EXPECT_TRUE(allocator.Allocate(AllocationSize, 4, offset));
+        }
+        EXPECT_FALSE(allocator.Allocate(AllocationSize, 4, offset));
+        EXPECT_EQ(allocator.GetCurrentFrameSize(), RingBufferSize);
+
+        // The memory of the full frame is in use by the GPU until FrameCountMax frames have ended.
+        for (uint32_t frame = 1; frame < RHI::Limits::Device::FrameCountMax; ++frame)
+        {
+            allocator.FrameEnd();
+            EXPECT_EQ(allocator.GetCurrentFrameSize(), 0);
+            EXPECT_FALSE(allocator.Allocate(AllocationSize, 4, offset));
+        }
+
+        allocator.FrameEnd();
+        EXPECT_TRUE(allocator.Allocate(AllocationSize, 4, offset));
+        EXPECT_EQ(offset, 0);
+    }
+
+    TEST_F(DynamicBufferRingAllocatorTests, Allocate_AfterFrameEnd_ThreadChunkIsRetired)
+    {
+        constexpr uint32_t RingBufferSize = 1024 * 1024;
+
+        DynamicBufferRingAllocator allocator;
+        allocator.Init(RingBufferSize);
+
+        uint32_t firstOffset = 0;
+        uint32_t secondOffset = 0;
+        EXPECT_TRUE(allocator.Allocate(16, 4, firstOffset));
+        EXPECT_TRUE(allocator.Allocate(16, 4, secondOffset));
+        EXPECT_EQ(secondOffset, firstOffset + 16);
+
+        // The next frame starts with a new chunk rather than continuing the previous frame's one.
+        allocator.FrameEnd();
+        EXPECT_TRUE(allocator.Allocate(16, 4, secondOffset));
+        EXPECT_EQ(secondOffset, firstOffset + allocator.GetChunkSize());
+    }
+
+#ifdef HAVE_BENCHMARK
+    //! Measures the cost of a frame of dynamic buffer allocations made concurrently by a number of producer threads, as
+    //! DynamicDrawContext and AuxGeom do. Only offsets are allocated, so this runs without any GPU buffer, as on the Null RHI.
+    class DynamicBufferRingAllocatorBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+
+    protected:
+        static constexpr uint32_t RingBufferSize = 64 * 1024 * 1024;
+        static constexpr uint32_t AllocationsPerThread = 2000;
+
+        void InternalSetUp(const benchmark::State& state)
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_allocator = AZStd::make_unique<DynamicBufferRingAllocator>();
+            m_allocator->Init(RingBufferSize);
+        }
+
+        void InternalTearDown(const benchmark::State& state)
+        {
+            m_allocator.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        // Runs one frame of allocations split across the given number of threads, then ends the frame.
+        template<typename AllocateFunction>
+        void RunFrame(uint32_t threadCount, const AllocateFunction& allocateFunction)
+        {
+            AZStd::vector<AZStd::thread> threads;
+            threads.reserve(threadCount);
+            for (uint32_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                threads.emplace_back([&allocateFunction, threadIndex]()
+                {
+                    for (uint32_t i = 0; i < AllocationsPerThread; ++i)
+                    {
+                        uint32_t offset = 0;
+                        allocateFunction(GetAllocationSize(i + threadIndex) / 4, offset);
+                    }
+                });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        AZStd::unique_ptr<DynamicBufferRingAllocator> m_allocator;
+    };
+
+    BENCHMARK_DEFINE_F(DynamicBufferRingAllocatorBenchmarkFixture, BM_AllocateLockFree)(benchmark::State& state)
+    {
+        const uint32_t threadCount = aznumeric_cast<uint32_t>(state.range(0));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            RunFrame(threadCount, [this](uint32_t size, uint32_t& offset)
+            {
+                return m_allocator->Allocate(size, 4, offset);
+            });
+            m_allocator->FrameEnd();
+        }
+        state.SetItemsProcessed(state.iterations() * threadCount * AllocationsPerThread);
+    }
+
+    // The previous behavior: a single ring position guarded by a mutex.
+    BENCHMARK_DEFINE_F(DynamicBufferRingAllocatorBenchmarkFixture, BM_AllocateLocked)(benchmark::State& state)
+    {
+        const uint32_t threadCount = aznumeric_cast<uint32_t>(state.range(0));
+        AZStd::mutex mutex;
+        uint32_t position = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            RunFrame(threadCount, [&mutex, &position](uint32_t size, uint32_t& offset)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(mutex);
+                size = RHI::AlignUp(size, 4);
+                if (position + size > RingBufferSize)
+                {
+                    position = 0;
+                }
+                offset = position;
+                position += size;
+                return true;
+            });
+        }
+        state.SetItemsProcessed(state.iterations() * threadCount * AllocationsPerThread);
+    }
+
+    BENCHMARK_REGISTER_F(DynamicBufferRingAllocatorBenchmarkFixture, BM_AllocateLockFree)
+        ->RangeMultiplier(2)->Range(1, 32)
+        ->Unit(::benchmark::kMillisecond)
+        ->UseRealTime();
+
+    BENCHMARK_REGISTER_F(DynamicBufferRingAllocatorBenchmarkFixture, BM_AllocateLocked)
+        ->RangeMultiplier(2)->Range(1, 32)
+        ->Unit(::benchmark::kMillisecond)
+        ->UseRealTime();
+#endif
+}
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Image/StreamingImageBudget.h>
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    namespace
+    {
+        // An image with one mip per mip chain, starting at the given size and with a 1x1 tail.
+        StreamingImageBudget::ImageState CreateImageState(uint32_t topMipSize, uint16_t residentMipChain, uint16_t requestedMipChain, size_t lastAccessTimestamp)
+        {
+            StreamingImageBudget::ImageState imageState;
+            imageState.m_mipChainCount = 0;
+            for (uint32_t mipSize = topMipSize; mipSize > 0; mipSize /= 2)
+            {
+                imageState.m_mipChainSizes[imageState.m_mipChainCount++] = mipSize * mipSize * 4;
+            }
+            imageState.m_residentMipChain = residentMipChain;
+            imageState.m_requestedMipChain = requestedMipChain;
+            imageState.m_lastAccessTimestamp = lastAccessTimestamp;
+            return imageState;
+        }
+
+        size_t GetResidentSize(const StreamingImageBudget::ImageState& imageState)
+        {
+            size_t size = 0;
+            for (uint16_t mipChain = imageState.m_residentMipChain; mipChain < imageState.m_mipChainCount; ++mipChain)
+            {
+                size += imageState.m_mipChainSizes[mipChain];
+            }
+            return size;
+        }
+
+        void ApplyDecisions(AZStd::vector<StreamingImageBudget::ImageState>& imageStates, const AZStd::vector<StreamingImageBudget::Decision>& decisions)
+        {
+            for (const StreamingImageBudget::Decision& decision : decisions)
+            {
+                imageStates[decision.m_imageIndex].m_residentMipChain = decision.m_targetMipChain;
+            }
+        }
+    }
+
+    class StreamingImageBudgetTests
+        : public UnitTest::AllocatorsTestFixture
+    {
+    };
+
+    TEST_F(StreamingImageBudgetTests, Update_NoBudget_GrantsAllRequests)
+    {
+        AZStd::vector<StreamingImageBudget::ImageState> imageStates;
+        imageStates.push_back(CreateImageState(1024, 10, 0, 1));
+        imageStates.push_back(CreateImageState(512, 9, 3, 1));
+
+        StreamingImageBudget budget;
+        AZStd::vector<StreamingImageBudget::Decision> decisions;
+        budget.Update(imageStates, decisions);
+        ApplyDecisions(imageStates, decisions);
+
+        EXPECT_EQ(imageStates[0].m_residentMipChain, 0);
+        EXPECT_EQ(imageStates[1].m_residentMipChain, 3);
+        EXPECT_EQ(budget.GetMetrics().m_missCount, 0);
+        EXPECT_EQ(budget.GetMetrics().m_grantedBytes, budget.GetMetrics().m_requestedBytes);
+    }
+
+    TEST_F(StreamingImageBudgetTests, Update_OverBudget_SpreadsDetailAcrossImages)
+    {
+        AZStd::vector<StreamingImageBudget::ImageState> imageStates;
+        imageStates.push_back(CreateImageState(1024, 10, 0, 1));
+        imageStates.push_back(CreateImageState(1024, 10, 0, 1));
+
+        // Enough for both images up to 512x512, but not for either at 1024x1024.
+        StreamingImageBudget budget;
+        budget.SetBudget(2 * GetResidentSize(CreateImageState(512, 0, 0, 0)) + 1024);
+
+        AZStd::vector<StreamingImageBudget::Decision> decisions;
+        budget.Update(imageStates, decisions);
+        ApplyDecisions(imageStates, decisions);
+
+        EXPECT_EQ(imageStates[0].m_residentMipChain, 1);
+        EXPECT_EQ(imageStates[1].m_residentMipChain, 1);
+        EXPECT_EQ(budget.GetMetrics().m_missCount, 2);
+        EXPECT_LE(budget.GetMetrics().m_grantedBytes, budget.GetBudget());
+    }
+
+    TEST_F(StreamingImageBudgetTests, Update_OverBudget_EvictsLeastRecentlyUsedImage)
+    {
+        AZStd::vector<StreamingImageBudget::ImageState> imageStates;
+        // Two fully resident images which were not requested this update, the first one used less recently.
+        imageStates.push_back(CreateImageState(1024, 0, StreamingImageBudget::NoMipChainRequest, 5));
+        imageStates.push_back(CreateImageState(1024, 0, StreamingImageBudget::NoMipChainRequest, 8));
+        // A newly visible image.
+        imageStates.push_back(CreateImageState(1024, 10, 0, 10));
+
+        // Room for two of the images, plus the tail of the third one which is always resident.
+        StreamingImageBudget budget;
+        budget.SetBudget(2 * GetResidentSize(CreateImageState(1024, 0, 0, 0)) + 4);
+
+        AZStd::vector<StreamingImageBudget::Decision> decisions;
+        budget.Update(imageStates, decisions);
+
+        // The trim is listed before the expansion.
+        ASSERT_EQ(decisions.size(), 2);
+        EXPECT_EQ(decisions[0].m_imageIndex, 0);
+        EXPECT_EQ(decisions[1].m_imageIndex, 2);
+
+        ApplyDecisions(imageStates, decisions);
+        EXPECT_EQ(imageStates[0].m_residentMipChain, 10);
+        EXPECT_EQ(imageStates[1].m_residentMipChain, 0);
+        EXPECT_EQ(imageStates[2].m_residentMipChain, 0);
+        EXPECT_EQ(budget.GetMetrics().m_evictionCount, 1);
+        EXPECT_EQ(budget.GetMetrics().m_missCount, 0);
+    }
+
+    TEST_F(StreamingImageBudgetTests, Update_StatesChangeBetweenUpdates_MatchesNewBudget)
+    {
+        AZStd::vector<StreamingImageBudget::ImageState> imageStates;
+        size_t totalSize = 0;
+        for (uint32_t i = 0; i < 64; ++i)
+        {
+            imageStates.push_back(CreateImageState(256u << (i % 3), 0, StreamingImageBudget::NoMipChainRequest, 0));
+            imageStates.back().m_residentMipChain = imageStates.back().m_mipChainCount - 1;
+            totalSize += GetResidentSize(CreateImageState(256u << (i % 3), 0, 0, 0));
+        }
+
+        // The steps of the budget are requeued incrementally, so its decisions should match a budget that sees the images
+        // for the first time, including when images are removed.
+        StreamingImageBudget budget;
+        budget.SetBudget(totalSize / 3);
+        SimpleLcgRandom random;
+        for (size_t timestamp = 1; timestamp < 32; ++timestamp)
+        {
+            for (StreamingImageBudget::ImageState& imageState : imageStates)
+            {
+                if (random.GetRandom() % 4 == 0)
+                {
+                    imageState.m_requestedMipChain = aznumeric_cast<uint16_t>(random.GetRandom() % imageState.m_mipChainCount);
+                    imageState.m_lastAccessTimestamp = timestamp;
+                }
+                else if (random.GetRandom() % 2 == 0)
+                {
+                    imageState.m_requestedMipChain = StreamingImageBudget::NoMipChainRequest;
+                }
+            }
+            if (timestamp % 8 == 0)
+            {
+                imageStates.pop_back();
+            }
+
+            StreamingImageBudget newBudget;
+            newBudget.SetBudget(budget.GetBudget());
+            AZStd::vector<StreamingImageBudget::Decision> expectedDecisions;
+            newBudget.Update(imageStates, expectedDecisions);
+
+            AZStd::vector<StreamingImageBudget::Decision> decisions;
+            budget.Update(imageStates, decisions);
+
+            ASSERT_EQ(decisions.size(), expectedDecisions.size());
+            for (size_t i = 0; i < decisions.size(); ++i)
+            {
+                EXPECT_EQ(decisions[i].m_imageIndex, expectedDecisions[i].m_imageIndex);
+                EXPECT_EQ(decisions[i].m_targetMipChain, expectedDecisions[i].m_targetMipChain);
+            }
+            EXPECT_EQ(budget.GetMetrics().m_grantedBytes, newBudget.GetMetrics().m_grantedBytes);
+            ApplyDecisions(imageStates, decisions);
+        }
+    }
+
+    TEST_F(StreamingImageBudgetTests, GetMipLevelForTexelDensity_ReturnsMipMatchingDensity)
+    {
+        EXPECT_EQ(StreamingImage::GetMipLevelForTexelDensity(0.25f), 0);
+        EXPECT_EQ(StreamingImage::GetMipLevelForTexelDensity(1.0f), 0);
+        EXPECT_EQ(StreamingImage::GetMipLevelForTexelDensity(2.5f), 1);
+        EXPECT_EQ(StreamingImage::GetMipLevelForTexelDensity(16.0f), 4);
+        EXPECT_EQ(StreamingImage::GetMipLevelForTexelDensity(1.0e20f), RHI::Limits::Image::MipCountMax - 1);
+    }
+
+#ifdef HAVE_BENCHMARK
+    //! Simulates a camera moving through a scene: every frame a random subset of the images is visible with a random texel density,
+    //! and the decisions of the budget are applied immediately as if streaming was instant.
+    class StreamingImageBudgetBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+
+    protected:
+        void InternalSetUp(const benchmark::State& state)
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            const size_t imageCount = aznumeric_cast<size_t>(state.range(0));
+            size_t totalSize = 0;
+            for (size_t i = 0; i < imageCount; ++i)
+            {
+                const uint32_t topMipSize = 256u << (m_random.GetRandom() % 4);
+                m_imageStates.push_back(CreateImageState(topMipSize, 0, StreamingImageBudget::NoMipChainRequest, 0));
+                m_imageStates.back().m_residentMipChain = m_imageStates.back().m_mipChainCount - 1;
+                totalSize += GetResidentSize(CreateImageState(topMipSize, 0, 0, 0));
+            }
+
+            // A quarter of the memory needed to have everything fully resident.
+            m_budget.SetBudget(totalSize / 4);
+        }
+
+        void InternalTearDown(const benchmark::State& state)
+        {
+            m_imageStates = {};
+            m_decisions = {};
+            m_budget = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void SimulateFrame(size_t timestamp)
+        {
+            for (StreamingImageBudget::ImageState& imageState : m_imageStates)
+            {
+                // About a third of the images are visible each frame.
+                if (m_random.GetRandom() % 3 == 0)
+                {
+                    const float texelsPerPixel = m_random.GetRandomFloat() * 64.0f;
+                    imageState.m_requestedMipChain = StreamingImage::GetMipLevelForTexelDensity(texelsPerPixel);
+                    imageState.m_lastAccessTimestamp = timestamp;
+                }
+                else
+                {
+                    imageState.m_requestedMipChain = StreamingImageBudget::NoMipChainRequest;
+                }
+            }
+
+            m_decisions.clear();
+            m_budget.Update(m_imageStates, m_decisions);
+            ApplyDecisions(m_imageStates, m_decisions);
+        }
+
+        SimpleLcgRandom m_random;
+        StreamingImageBudget m_budget;
+        AZStd::vector<StreamingImageBudget::ImageState> m_imageStates;
+        AZStd::vector<StreamingImageBudget::Decision> m_decisions;
+    };
+
+    BENCHMARK_DEFINE_F(StreamingImageBudgetBenchmarkFixture, BM_SimulateFrame)(benchmark::State& state)
+    {
+        size_t timestamp = 1;
+        uint64_t missCount = 0;
+        uint64_t evictionCount = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SimulateFrame(timestamp++);
+            missCount += m_budget.GetMetrics().m_missCount;
+            evictionCount += m_budget.GetMetrics().m_evictionCount;
+        }
+
+        state.counters["Misses"] = benchmark::Counter(aznumeric_cast<double>(missCount), benchmark::Counter::kAvgIterations);
+        state.counters["Evictions"] = benchmark::Counter(aznumeric_cast<double>(evictionCount), benchmark::Counter::kAvgIterations);
+        state.counters["UsageRatio"] =
+            aznumeric_cast<double>(m_budget.GetMetrics().m_grantedBytes) / aznumeric_cast<double>(m_budget.GetMetrics().m_budgetInBytes);
+    }
+
+    BENCHMARK_REGISTER_F(StreamingImageBudgetBenchmarkFixture, BM_SimulateFrame)
+        ->Arg(1000)->Arg(10000)->Arg(50000)
+        ->Unit(::benchmark::kMillisecond);
+#endif
+}
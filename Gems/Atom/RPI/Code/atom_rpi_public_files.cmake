@@ -20,6 +20,7 @@ set(FILES
     Include/Atom/RPI.Public/RPIUtils.h
     Include/Atom/RPI.Public/Scene.h
     Include/Atom/RPI.Public/SceneBus.h
+    Include/Atom/RPI.Public/SoftwareOcclusionBuffer.h
     Include/Atom/RPI.Public/View.h
     Include/Atom/RPI.Public/ViewportContext.h
     Include/Atom/RPI.Public/ViewportContextBus.h
@@ -36,6 +37,7 @@ set(FILES
     Include/Atom/RPI.Public/ColorManagement/TransformColor.h
     Include/Atom/RPI.Public/DynamicDraw/DynamicBuffer.h
     Include/Atom/RPI.Public/DynamicDraw/DynamicBufferAllocator.h
+    Include/Atom/RPI.Public/DynamicDraw/DynamicBufferRingAllocator.h
     Include/Atom/RPI.Public/DynamicDraw/DynamicDrawContext.h
     Include/Atom/RPI.Public/DynamicDraw/DynamicDrawSystem.h
     Include/Atom/RPI.Public/DynamicDraw/DynamicDrawInterface.h
@@ -45,6 +47,7 @@ set(FILES
     Include/Atom/RPI.Public/Image/ImageSystem.h
     Include/Atom/RPI.Public/Image/ImageSystemInterface.h
     Include/Atom/RPI.Public/Image/StreamingImage.h
+    Include/Atom/RPI.Public/Image/StreamingImageBudget.h
     Include/Atom/RPI.Public/Image/StreamingImageContext.h
     Include/Atom/RPI.Public/Image/StreamingImageController.h
     Include/Atom/RPI.Public/Image/StreamingImagePool.h
@@ -108,6 +111,7 @@ set(FILES
     Source/RPI.Public/RPISystem.cpp
     Source/RPI.Public/RPIUtils.cpp
     Source/RPI.Public/Scene.cpp
+    Source/RPI.Public/SoftwareOcclusionBuffer.cpp
     Source/RPI.Public/View.cpp
     Source/RPI.Public/ViewportContext.cpp
     Source/RPI.Public/ViewportContextManager.cpp
@@ -118,6 +122,7 @@ set(FILES
     Source/RPI.Public/Buffer/BufferSystem.cpp
     Source/RPI.Public/DynamicDraw/DynamicBuffer.cpp
     Source/RPI.Public/DynamicDraw/DynamicBufferAllocator.cpp
+    Source/RPI.Public/DynamicDraw/DynamicBufferRingAllocator.cpp
     Source/RPI.Public/DynamicDraw/DynamicDrawContext.cpp
     Source/RPI.Public/DynamicDraw/DynamicDrawSystem.cpp
     Source/RPI.Public/Image/AttachmentImage.cpp
@@ -125,6 +130,7 @@ set(FILES
     Source/RPI.Public/Image/DefaultStreamingImageController.cpp
     Source/RPI.Public/Image/ImageSystem.cpp
     Source/RPI.Public/Image/StreamingImage.cpp
+    Source/RPI.Public/Image/StreamingImageBudget.cpp
     Source/RPI.Public/Image/StreamingImageContext.cpp
     Source/RPI.Public/Image/StreamingImageController.cpp
     Source/RPI.Public/Image/StreamingImagePool.cpp
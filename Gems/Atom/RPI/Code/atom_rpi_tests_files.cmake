@@ -26,6 +26,9 @@ set(FILES
     Tests/Common/RHI/Stubs.h
     Tests/Common/ShaderAssetTestUtils.cpp
     Tests/Common/ShaderAssetTestUtils.h
+    Tests/Culling/SoftwareOcclusionBufferTests.cpp
+    Tests/DynamicDraw/DynamicBufferRingAllocatorTests.cpp
+    Tests/Image/StreamingImageBudgetTests.cpp
     Tests/Image/StreamingImageTests.cpp
     Tests/Material/LuaMaterialFunctorTests.cpp
     Tests/Material/MaterialTypeAssetTests.cpp
@@ -59,6 +59,7 @@ namespace AZ
                 uint32_t totalCullables = 0;
                 uint32_t totalVisibleCullables = 0;
                 uint32_t totalVisibleDrawPackets = 0;
+                uint32_t totalOccludedCullables = 0;
                 uint32_t totalCullJobs = 0;
                 size_t numViews = 0;
 
@@ -83,11 +84,13 @@ namespace AZ
                 for (CullStatsType* cullStats : cullStatsSorted)
                 {
                     // create formatted display strings
-                    itemStrings.push_back(AZStd::string::format("%s - %d/%d CullPackets visible, %d drawPackets visible, %d cull jobs",
+                    itemStrings.push_back(AZStd::string::format("%s - %d/%d CullPackets visible, %d drawPackets visible, %d occluded by %d occluders, %d cull jobs",
                         cullStats->m_name.GetCStr(),
                         static_cast<uint32_t>(cullStats->m_numVisibleCullables),
                         static_cast<uint32_t>(debugCtx.m_numCullablesInScene),
                         static_cast<uint32_t>(cullStats->m_numVisibleDrawPackets),
+                        static_cast<uint32_t>(cullStats->m_numOccludedCullables),
+                        static_cast<uint32_t>(cullStats->m_numOccluders),
                         static_cast<uint32_t>(cullStats->m_numJobs)
                     ));
 
@@ -95,10 +98,11 @@ namespace AZ
                     totalCullables += debugCtx.m_numCullablesInScene;
                     totalVisibleCullables += cullStats->m_numVisibleCullables;
                     totalVisibleDrawPackets += cullStats->m_numVisibleDrawPackets;
+                    totalOccludedCullables += cullStats->m_numOccludedCullables;
                     totalCullJobs += cullStats->m_numJobs;
                 }
 
-                if (ImGui::BeginChild("Totals", ImVec2(0, 120.0f), true, ImGuiWindowFlags_None))
+                if (ImGui::BeginChild("Totals", ImVec2(0, 140.0f), true, ImGuiWindowFlags_None))
                 {
                     ImGui::Text("Totals:");
                     ImGui::Separator();
@@ -106,6 +110,7 @@ namespace AZ
                     ImGui::Text("   %u Cull Jobs", totalCullJobs);
                     ImGui::Text("   %d/%d Visible Cullables", totalVisibleCullables, totalCullables);
                     ImGui::Text("   %d Submitted DrawPackets", totalVisibleDrawPackets);
+                    ImGui::Text("   %d Occluded Cullables", totalOccludedCullables);
                 }                
                 ImGui::EndChild();
 
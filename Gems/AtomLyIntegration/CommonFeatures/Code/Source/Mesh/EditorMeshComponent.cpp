@@ -82,6 +82,11 @@ namespace AZ
                             ->DataElement(AZ::Edit::UIHandlers::CheckBox, &MeshComponentConfig::m_isRayTracingEnabled, "Use ray tracing",
                                 "Includes this mesh in ray tracing calculations.")
                                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, Edit::PropertyRefreshLevels::ValuesOnly)
+                            ->DataElement(AZ::Edit::UIHandlers::CheckBox, &MeshComponentConfig::m_isOccluder, "Use as occluder",
+                                "Renders the lowest lod of this mesh into the software occlusion buffer to cull the objects hidden behind it. "
+                                "Only recommended for large opaque meshes such as walls and terrain features, whose lowest lod doesn't extend past "
+                                "their other lods. Requires r_CullSoftwareOcclusion.")
+                                ->Attribute(AZ::Edit::Attributes::ChangeNotify, Edit::PropertyRefreshLevels::ValuesOnly)
                             ->DataElement(AZ::Edit::UIHandlers::ComboBox, &MeshComponentConfig::m_lodType, "Lod Type", "Lod Method.")
                                 ->EnumAttribute(RPI::Cullable::LodType::Default, "Default")
                                 ->EnumAttribute(RPI::Cullable::LodType::ScreenCoverage, "Screen Coverage")
@@ -11,11 +11,14 @@
 #include "ActorManager.h"
 #include "ActorInstance.h"
 #include "MultiThreadScheduler.h"
+#include "TaskGraphScheduler.h"
 #include <MCore/Source/LogManager.h>
 #include <MCore/Source/StringConversions.h>
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/Actor.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace EMotionFX
 {
@@ -27,8 +30,16 @@ namespace EMotionFX
     {
         m_scheduler  = nullptr;
 
-        // setup the default scheduler
-        SetScheduler(MultiThreadScheduler::Create());
+        // setup the default scheduler, following the task graph switch like the other task graph clients do
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            SetScheduler(TaskGraphScheduler::Create());
+        }
+        else
+        {
+            SetScheduler(MultiThreadScheduler::Create());
+        }
 
         // reserve memory
         m_actorInstances.reserve(1024);
@@ -11,6 +11,7 @@
 #include <EMotionFX/Source/AnimGraph.h>
 #include <EMotionFX/Source/AnimGraphInstance.h>
 #include <EMotionFX/Source/AnimGraphManager.h>
+#include <EMotionFX/Source/AnimGraphOutputProgram.h>
 #include <EMotionFX/Source/AnimGraphPosePool.h>
 #include <EMotionFX/Source/AnimGraphStateMachine.h>
 #include <EMotionFX/Source/Attachment.h>
@@ -65,6 +66,8 @@ namespace EMotionFX
         // prealloc the unique data array (doesn't create the actual unique data objects yet though)
         InitUniqueDatas();
 
+        SetUseOutputProgram(m_initSettings.m_useOutputProgram);
+
         // automatically register the anim graph instance
         GetAnimGraphManager().AddAnimGraphInstance(this);
 
@@ -231,6 +234,20 @@ namespace EMotionFX
         // calculate the anim graph output
         AnimGraphNode* rootNode = GetRootNode();
 
+        // The output program relies on all poses being released at the end of the output pass, so only root anim graphs can use it.
+        const bool releasePoses = m_autoReleaseAllPoses && !m_parentAnimGraphInstance;
+        if (m_outputProgram)
+        {
+            if (releasePoses)
+            {
+                m_outputProgram->Execute(this);
+            }
+            else
+            {
+                m_outputProgram->Invalidate();
+            }
+        }
+
         // calculate the output of the state machine
         rootNode->PerformOutput(this);
 
@@ -248,10 +265,15 @@ namespace EMotionFX
         //MCORE_ASSERT(GetEMotionFX().GetThreadData(0).GetPosePool().GetNumUsedPoses() == 0);
 
         // Release only for root anim graphs and when we want to auto release.
-        if (m_autoReleaseAllPoses && !m_parentAnimGraphInstance)
+        if (releasePoses)
         {
             ReleasePoses();
             posePool.FreeAllPoses();
+
+            if (m_outputProgram)
+            {
+                m_outputProgram->Finish(this);
+            }
         }
 
         // Gather active state. Must be done in output function.
@@ -660,6 +682,7 @@ namespace EMotionFX
     {
         m_uniqueDatas.emplace_back(nullptr);
         m_objectFlags.emplace_back(0);
+        InvalidateOutputProgram();
     }
 
     // remove the given unique data object
@@ -678,6 +701,7 @@ namespace EMotionFX
 
         m_uniqueDatas.erase(m_uniqueDatas.begin() + index);
         m_objectFlags.erase(AZStd::next(begin(m_objectFlags), index));
+        InvalidateOutputProgram();
     }
 
 
@@ -686,6 +710,7 @@ namespace EMotionFX
         AnimGraphObjectData* data = m_uniqueDatas[index];
         m_uniqueDatas.erase(m_uniqueDatas.begin() + index);
         m_objectFlags.erase(AZStd::next(begin(m_objectFlags), index));
+        InvalidateOutputProgram();
         if (delFromMem && data)
         {
             data->Destroy();
@@ -709,6 +734,7 @@ namespace EMotionFX
 
         m_uniqueDatas.clear();
         m_objectFlags.clear();
+        InvalidateOutputProgram();
     }
 
 
@@ -820,6 +846,8 @@ namespace EMotionFX
             m_uniqueDatas[i] = nullptr;
             m_objectFlags[i] = 0;
         }
+
+        InvalidateOutputProgram();
     }
 
 
@@ -1302,6 +1330,36 @@ namespace EMotionFX
         }
     }
 
+    void AnimGraphInstance::SetUseOutputProgram(bool enabled)
+    {
+        if (enabled && !m_outputProgram)
+        {
+            m_outputProgram = AZStd::make_unique<AnimGraphOutputProgram>();
+        }
+        else if (!enabled)
+        {
+            m_outputProgram.reset();
+        }
+    }
+
+    bool AnimGraphInstance::GetUseOutputProgram() const
+    {
+        return m_outputProgram != nullptr;
+    }
+
+    void AnimGraphInstance::InvalidateOutputProgram()
+    {
+        if (m_outputProgram)
+        {
+            m_outputProgram->Invalidate();
+        }
+
+        if (m_parentAnimGraphInstance)
+        {
+            m_parentAnimGraphInstance->InvalidateOutputProgram();
+        }
+    }
+
     bool AnimGraphInstance::GetParameterValueAsFloat(size_t paramIndex, float* outValue)
     {
         MCore::AttributeFloat* floatAttribute = GetParameterValueChecked<MCore::AttributeFloat>(paramIndex);
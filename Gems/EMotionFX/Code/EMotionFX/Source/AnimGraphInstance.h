@@ -17,6 +17,7 @@
 #include <EMotionFX/Source/EMotionFXConfig.h>
 #include <MCore/Source/Attribute.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <MCore/Source/Random.h>
 
 
@@ -38,6 +39,7 @@ namespace EMotionFX
     class AnimGraphInstanceEventHandler;
     class AnimGraphObjectData;
     class AnimGraphNodeData;
+    class AnimGraphOutputProgram;
 
     /**
      * The anim graph instance class.
@@ -65,10 +67,12 @@ namespace EMotionFX
         struct EMFX_API InitSettings
         {
             bool    m_preInitMotionInstances;
+            bool    m_useOutputProgram;         /**< Compile the output pass into a flat list of nodes, see AnimGraphOutputProgram. */
 
             InitSettings()
             {
                 m_preInitMotionInstances = false;
+                m_useOutputProgram = false;
             }
         };
 
@@ -297,6 +301,21 @@ namespace EMotionFX
         void ReleaseRefDatas();
         void ReleasePoses();
 
+        /**
+         * Enable or disable compiling the output pass into a flat list of nodes with precomputed pose slots.
+         * The program is only used by anim graph instances that do not have a parent and automatically release their poses.
+         * @param enabled Set to true to output the anim graph using an AnimGraphOutputProgram, false to walk the graph recursively.
+         */
+        void SetUseOutputProgram(bool enabled);
+        bool GetUseOutputProgram() const;
+        MCORE_INLINE AnimGraphOutputProgram* GetOutputProgram() const   { return m_outputProgram.get(); }
+
+        /**
+         * Force the output program to be recompiled during the next output pass, like needed when the set of active nodes changes.
+         * Child anim graph instances forward this to their parent, as the parent program outputs the reference nodes.
+         */
+        void InvalidateOutputProgram();
+
     private:
         AnimGraph*                                          m_animGraph;
         ActorInstance*                                      m_actorInstance;
@@ -327,6 +346,8 @@ namespace EMotionFX
         AZStd::shared_ptr<AnimGraphSnapshot>                m_snapshot;
         MCore::LcgRandom                                    m_lcgRandom;
 
+        AZStd::unique_ptr<AnimGraphOutputProgram>           m_outputProgram;         /**< The compiled output pass, nullptr when not used. */
+
 #if defined(EMFX_DEVELOPMENT_BUILD)
         bool                                                m_isOwnedByRuntime;
 #endif // EMFX_DEVELOPMENT_BUILD
@@ -24,6 +24,7 @@
 #include "AnimGraphObjectData.h"
 #include "AnimGraphEventBuffer.h"
 #include "AnimGraphManager.h"
+#include "AnimGraphOutputProgram.h"
 #include "AnimGraphSyncTrack.h"
 #include "AnimGraph.h"
 #include "Recorder.h"
@@ -1992,6 +1993,8 @@ namespace EMotionFX
 
         const uint32 threadIndex = animGraphInstance->GetActorInstance()->GetThreadIndex();
         AnimGraphPosePool& posePool = GetEMotionFX().GetThreadData(threadIndex)->GetPosePool();
+        AnimGraphOutputProgram* outputProgram = animGraphInstance->GetOutputProgram();
+        size_t poseIndex = 0;
         const size_t numOutputs = m_outputPorts.size();
         for (size_t i = 0; i < numOutputs; ++i)
         {
@@ -2002,11 +2005,12 @@ namespace EMotionFX
 
                 AttributePose* poseAttribute = static_cast<AttributePose*>(attribute);
                 AnimGraphPose* pose = poseAttribute->GetValue();
-                if (pose)
+                if (pose && (!outputProgram || !outputProgram->FreePose(this, poseIndex, pose)))
                 {
                     posePool.FreePose(pose);
                 }
                 poseAttribute->SetValue(nullptr);
+                poseIndex++;
             }
         }
     }
@@ -2020,6 +2024,9 @@ namespace EMotionFX
 
         AnimGraphPosePool& posePool = GetEMotionFX().GetThreadData(threadIndex)->GetPosePool();
 
+        // take the poses from the slots of the output program, if it assigned any
+        AnimGraphOutputProgram* outputProgram = animGraphInstance->GetOutputProgram();
+        size_t poseIndex = 0;
         const size_t numOutputs = m_outputPorts.size();
         for (size_t i = 0; i < numOutputs; ++i)
         {
@@ -2028,7 +2035,12 @@ namespace EMotionFX
                 MCore::Attribute* attribute = GetOutputAttribute(animGraphInstance, i);
                 MCORE_ASSERT(attribute->GetType() == AttributePose::TYPE_ID);
 
-                AnimGraphPose* pose = posePool.RequestPose(actorInstance);
+                AnimGraphPose* pose = outputProgram ? outputProgram->RequestPose(animGraphInstance, this, poseIndex) : nullptr;
+                if (!pose)
+                {
+                    pose = posePool.RequestPose(actorInstance);
+                }
+                poseIndex++;
                 AttributePose* poseAttribute = static_cast<AttributePose*>(attribute);
                 poseAttribute->SetValue(pose);
             }
@@ -2180,6 +2192,13 @@ namespace EMotionFX
         // now decrease ref counts of all input nodes as we do not need the poses of this input node anymore for this node
         // once the pose ref count of a node reaches zero it will automatically release the poses back to the pool so they can be reused again by others
         FreeIncomingPoses(animGraphInstance);
+
+        // let the output program record or verify the order in which the nodes finish their output
+        AnimGraphOutputProgram* outputProgram = animGraphInstance->GetOutputProgram();
+        if (outputProgram)
+        {
+            outputProgram->OnNodeOutput(animGraphInstance, this);
+        }
     }
 
 
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/AnimGraphAttributeTypes.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/AnimGraphNode.h>
+#include <EMotionFX/Source/AnimGraphOutputProgram.h>
+#include <EMotionFX/Source/Allocators.h>
+
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(AnimGraphOutputProgram, AnimGraphInstanceAllocator, 0)
+
+    // output the nodes in the program, or start recording it
+    void AnimGraphOutputProgram::Execute(AnimGraphInstance* animGraphInstance)
+    {
+        if (m_state == State::Invalid || m_state == State::RecordingNodes)
+        {
+            // the poses of the last output pass have been released already, so the pose slots are not referenced anymore
+            Clear();
+            m_state = State::RecordingNodes;
+            return;
+        }
+
+        for (AnimGraphPose& pose : m_poseSlots)
+        {
+            pose.SetIsInUse(false);
+        }
+
+        // output the nodes that got updated this frame, in the recorded order
+        for (AnimGraphNode* node : m_instructions)
+        {
+            const size_t objectIndex = node->GetObjectIndex();
+            if (!animGraphInstance->GetIsUpdateReady(objectIndex) || animGraphInstance->GetIsOutputReady(objectIndex))
+            {
+                continue;
+            }
+
+            m_executingNode = node;
+            node->PerformOutput(animGraphInstance);
+
+            // let the recursive output of the root node take care of the remaining nodes
+            if (m_state == State::Invalid)
+            {
+                break;
+            }
+        }
+
+        m_executingNode = nullptr;
+    }
+
+
+    // move on to the next state while compiling
+    void AnimGraphOutputProgram::Finish(AnimGraphInstance* animGraphInstance)
+    {
+        switch (m_state)
+        {
+        case State::RecordingNodes:
+            m_state = m_instructions.empty() ? State::Invalid : State::RecordingPoses;
+            break;
+
+        case State::RecordingPoses:
+            BuildPoseSlots(animGraphInstance);
+            m_state = State::Compiled;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+
+    // mark the program as invalid
+    void AnimGraphOutputProgram::Invalidate()
+    {
+        // keep the pose slots alive, as the nodes might still be using them during the current output pass
+        m_state = State::Invalid;
+    }
+
+
+    // a node finished its output
+    void AnimGraphOutputProgram::OnNodeOutput(AnimGraphInstance* animGraphInstance, AnimGraphNode* node)
+    {
+        if (m_state == State::Invalid || !animGraphInstance->GetIsUpdateReady(node->GetObjectIndex()))
+        {
+            return;
+        }
+
+        if (m_state == State::RecordingNodes)
+        {
+            m_instructions.emplace_back(node);
+        }
+        else if (node != m_executingNode)
+        {
+            // the node is active but not part of the program, or got output before its turn
+            Invalidate();
+        }
+    }
+
+
+    // request an output pose from the pose slots
+    AnimGraphPose* AnimGraphOutputProgram::RequestPose(AnimGraphInstance* animGraphInstance, const AnimGraphNode* node, size_t poseIndex)
+    {
+        if (m_state == State::RecordingPoses)
+        {
+            m_poseEvents.push_back({ node->GetObjectIndex(), static_cast<AZ::u32>(poseIndex), true });
+            return nullptr;
+        }
+
+        if (m_state != State::Compiled)
+        {
+            return nullptr;
+        }
+
+        const size_t outputSlotIndex = FindOutputSlotIndex(node, poseIndex);
+        if (outputSlotIndex == s_invalidIndex || m_outputSlots[outputSlotIndex] == s_invalidSlot)
+        {
+            return nullptr;
+        }
+
+        // the slot is still in use when the poses got requested in another order than recorded
+        AnimGraphPose* pose = &m_poseSlots[m_outputSlots[outputSlotIndex]];
+        if (pose->GetIsInUse())
+        {
+            Invalidate();
+            return nullptr;
+        }
+
+        pose->LinkToActorInstance(animGraphInstance->GetActorInstance());
+        pose->SetIsInUse(true);
+        return pose;
+    }
+
+
+    // release an output pose
+    bool AnimGraphOutputProgram::FreePose(const AnimGraphNode* node, size_t poseIndex, AnimGraphPose* pose)
+    {
+        if (m_state == State::RecordingPoses)
+        {
+            m_poseEvents.push_back({ node->GetObjectIndex(), static_cast<AZ::u32>(poseIndex), false });
+        }
+
+        if (m_poseSlots.empty() || pose < m_poseSlots.data() || pose >= m_poseSlots.data() + m_poseSlots.size())
+        {
+            return false;
+        }
+
+        pose->SetIsInUse(false);
+        return true;
+    }
+
+
+    // release all instructions and pose slots
+    void AnimGraphOutputProgram::Clear()
+    {
+        m_instructions.clear();
+        m_poseEvents.clear();
+        m_firstSlotIndices.clear();
+        m_outputSlots.clear();
+        m_poseSlots.clear();
+        m_executingNode = nullptr;
+    }
+
+
+    // assign the pose outputs of the nodes in the program to pose slots
+    void AnimGraphOutputProgram::BuildPoseSlots(AnimGraphInstance* animGraphInstance)
+    {
+        m_firstSlotIndices.clear();
+        m_firstSlotIndices.resize(animGraphInstance->GetAnimGraph()->GetNumObjects(), s_invalidIndex);
+        m_outputSlots.clear();
+        for (const AnimGraphNode* node : m_instructions)
+        {
+            m_firstSlotIndices[node->GetObjectIndex()] = m_outputSlots.size();
+            for (const AnimGraphNode::Port& port : node->GetOutputPorts())
+            {
+                if (port.m_compatibleTypes[0] == AttributePose::TYPE_ID)
+                {
+                    m_outputSlots.emplace_back(s_invalidSlot);
+                }
+            }
+        }
+
+        // only pose outputs that got requested exactly once can be assigned a slot
+        AZStd::vector<AZ::u32> numRequests(m_outputSlots.size(), 0);
+        for (const PoseEvent& poseEvent : m_poseEvents)
+        {
+            const size_t firstSlotIndex = m_firstSlotIndices[poseEvent.m_objectIndex];
+            if (poseEvent.m_isRequest && firstSlotIndex != s_invalidIndex)
+            {
+                numRequests[firstSlotIndex + poseEvent.m_poseIndex]++;
+            }
+        }
+
+        // walk the events in order, reusing the slots of the poses that got released already
+        AZStd::vector<AZ::u32> freeSlots;
+        AZ::u32 numSlots = 0;
+        for (const PoseEvent& poseEvent : m_poseEvents)
+        {
+            const size_t firstSlotIndex = m_firstSlotIndices[poseEvent.m_objectIndex];
+            if (firstSlotIndex == s_invalidIndex || numRequests[firstSlotIndex + poseEvent.m_poseIndex] != 1)
+            {
+                continue;
+            }
+
+            AZ::u32& slot = m_outputSlots[firstSlotIndex + poseEvent.m_poseIndex];
+            if (poseEvent.m_isRequest)
+            {
+                if (freeSlots.empty())
+                {
+                    slot = numSlots++;
+                }
+                else
+                {
+                    slot = freeSlots.back();
+                    freeSlots.pop_back();
+                }
+            }
+            else if (slot != s_invalidSlot)
+            {
+                freeSlots.emplace_back(slot);
+            }
+        }
+
+        m_poseEvents.clear();
+        m_poseSlots.clear();
+        m_poseSlots.resize(numSlots);
+        for (AnimGraphPose& pose : m_poseSlots)
+        {
+            pose.LinkToActorInstance(animGraphInstance->GetActorInstance());
+        }
+    }
+
+
+    // find the index into the output slots for a given pose output
+    size_t AnimGraphOutputProgram::FindOutputSlotIndex(const AnimGraphNode* node, size_t poseIndex) const
+    {
+        const size_t objectIndex = node->GetObjectIndex();
+        if (objectIndex >= m_firstSlotIndices.size() || m_firstSlotIndices[objectIndex] == s_invalidIndex)
+        {
+            return s_invalidIndex;
+        }
+
+        return m_firstSlotIndices[objectIndex] + poseIndex;
+    }
+} // namespace EMotionFX
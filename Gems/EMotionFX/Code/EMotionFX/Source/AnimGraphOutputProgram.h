@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/AnimGraphPose.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+
+namespace EMotionFX
+{
+    // forward declarations
+    class AnimGraphInstance;
+    class AnimGraphNode;
+
+    /**
+     * The output pass of an anim graph instance, compiled into a flat list of nodes.
+     * Without a program, the output pass recursively walks the graph starting at the root state machine, and every node
+     * requests its output poses from the pose pool of the thread and releases them again once all nodes using them are done.
+     * The program records the order in which the nodes finished their output during one such recursive pass, so that the
+     * following passes can output the nodes in that order from a linear list. When a node then outputs its input nodes, their
+     * outputs are ready already and the recursion ends right away.
+     * During the second pass the program records when the output poses of the nodes are requested and released, and assigns
+     * each output pose a slot in a buffer of poses owned by the program, so that poses which are never in use at the same
+     * time share a slot. From then on the output poses are taken from those slots instead of the pose pool.
+     *
+     * Only the nodes that got updated during the current frame are output by the program, and nodes that get output but are not part
+     * of the program invalidate it, so that the program gets recompiled during the next frame. The state machines invalidate
+     * the program when transitions start or end, as that changes the set of active nodes.
+     */
+    class EMFX_API AnimGraphOutputProgram
+    {
+    public:
+        AZ_CLASS_ALLOCATOR_DECL
+
+        enum class State : AZ::u8
+        {
+            Invalid,            /**< The program has to be recorded again. */
+            RecordingNodes,     /**< The graph gets output recursively, while recording the node order. */
+            RecordingPoses,     /**< The nodes get output using the program, while recording the pose requests and releases. */
+            Compiled            /**< The nodes get output using the program, the output poses use the pose slots. */
+        };
+
+        /**
+         * Start the output pass. Outputs the nodes in the program, if there is one, or starts recording it.
+         * @param animGraphInstance The anim graph instance the program belongs to.
+         */
+        void Execute(AnimGraphInstance* animGraphInstance);
+
+        /**
+         * Finish the output pass, after the root node has been output and its poses got released.
+         * Moves on to the next state while the program is being compiled.
+         * @param animGraphInstance The anim graph instance the program belongs to.
+         */
+        void Finish(AnimGraphInstance* animGraphInstance);
+
+        /**
+         * Mark the program as invalid, so that it gets recorded again during the next output pass.
+         */
+        void Invalidate();
+
+        /**
+         * Called by the nodes once they finished their output.
+         * @param animGraphInstance The anim graph instance the program belongs to.
+         * @param node The node that finished its output.
+         */
+        void OnNodeOutput(AnimGraphInstance* animGraphInstance, AnimGraphNode* node);
+
+        /**
+         * Request an output pose of a node from the pose slots.
+         * @param animGraphInstance The anim graph instance the program belongs to.
+         * @param node The node requesting the pose.
+         * @param poseIndex The index of the pose among the pose outputs of the node.
+         * @result The pose of the slot, or nullptr in case the pose has to be requested from the pose pool.
+         */
+        AnimGraphPose* RequestPose(AnimGraphInstance* animGraphInstance, const AnimGraphNode* node, size_t poseIndex);
+
+        /**
+         * Release an output pose of a node.
+         * @param node The node releasing the pose.
+         * @param poseIndex The index of the pose among the pose outputs of the node.
+         * @param pose The pose to release.
+         * @result True in case the pose belongs to a pose slot, false in case it has to be returned to the pose pool.
+         */
+        bool FreePose(const AnimGraphNode* node, size_t poseIndex, AnimGraphPose* pose);
+
+        MCORE_INLINE State GetState() const                                         { return m_state; }
+        MCORE_INLINE bool GetIsCompiled() const                                     { return m_state == State::Compiled; }
+        MCORE_INLINE size_t GetNumInstructions() const                              { return m_instructions.size(); }
+        MCORE_INLINE const AnimGraphNode* GetInstruction(size_t index) const        { return m_instructions[index]; }
+        MCORE_INLINE size_t GetNumPoseSlots() const                                 { return m_poseSlots.size(); }
+
+    private:
+        static constexpr AZ::u32 s_invalidSlot = static_cast<AZ::u32>(-1);
+        static constexpr size_t s_invalidIndex = static_cast<size_t>(-1);
+
+        struct PoseEvent
+        {
+            size_t  m_objectIndex;
+            AZ::u32 m_poseIndex;
+            bool    m_isRequest;
+        };
+
+        void Clear();
+        void BuildPoseSlots(AnimGraphInstance* animGraphInstance);
+        size_t FindOutputSlotIndex(const AnimGraphNode* node, size_t poseIndex) const;
+
+        AZStd::vector<AnimGraphNode*>   m_instructions;                 /**< The nodes in the order they finished their output. */
+        AZStd::vector<PoseEvent>        m_poseEvents;                   /**< The pose requests and releases, only used while recording. */
+        AZStd::vector<size_t>           m_firstSlotIndices;             /**< The index into m_outputSlots of the first pose output of each object. */
+        AZStd::vector<AZ::u32>          m_outputSlots;                  /**< The pose slot used by each pose output. */
+        AZStd::vector<AnimGraphPose>    m_poseSlots;                    /**< The poses of the slots. */
+        const AnimGraphNode*            m_executingNode = nullptr;      /**< The node the program is outputting right now. */
+        State                           m_state = State::Invalid;
+    };
+} // namespace EMotionFX
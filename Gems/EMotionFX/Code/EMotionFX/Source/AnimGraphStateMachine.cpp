@@ -757,6 +757,7 @@ namespace EMotionFX
         uniqueData->m_previousState = uniqueData->m_currentState;
         uniqueData->m_currentState = targetState;
         uniqueData->m_activeTransitions.clear();
+        animGraphInstance->InvalidateOutputProgram();
     }
 
     // checks if there is a transition from the current to the target node and starts a transition towards it, in case there is no transition between them the target node just gets activated
@@ -1185,6 +1186,7 @@ namespace EMotionFX
             // reset the the unique data of the state machine and overwrite the current state as that is not nullptr but the entry state
             uniqueData->Reset();
             uniqueData->m_currentState = entryState;
+            animGraphInstance->InvalidateOutputProgram();
         }
     }
 
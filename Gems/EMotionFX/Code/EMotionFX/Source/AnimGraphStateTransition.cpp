@@ -328,6 +328,9 @@ namespace EMotionFX
 
         m_targetNode->SetSyncIndex(animGraphInstance, InvalidIndex);
 
+        // the target state becomes active
+        animGraphInstance->InvalidateOutputProgram();
+
         // Trigger action
         for (AnimGraphTriggerAction* action : m_actionSetup.GetActions())
         {
@@ -361,6 +364,9 @@ namespace EMotionFX
         uniqueData->m_blendProgress  = 1.0f;
         uniqueData->m_isDone         = true;
 
+        // the source state is not active anymore
+        animGraphInstance->InvalidateOutputProgram();
+
         // Trigger action
         for (AnimGraphTriggerAction* action : m_actionSetup.GetActions())
         {
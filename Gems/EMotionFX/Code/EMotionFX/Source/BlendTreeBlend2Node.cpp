@@ -213,18 +213,9 @@ namespace EMotionFX
         *outputPose = *nodeA->GetMainOutputPose(animGraphInstance);
         Pose& outputLocalPose = outputPose->GetPose();
 
-        const size_t numNodes = uniqueData->m_mask.size();
-        if (numNodes > 0)
+        if (!uniqueData->m_mask.empty())
         {
-            Transform transform;
-            for (size_t n = 0; n < numNodes; ++n)
-            {
-                const float finalWeight = blendWeight /* * uniqueData->m_weights[n]*/;
-                const size_t nodeIndex = uniqueData->m_mask[n];
-                transform = outputLocalPose.GetLocalSpaceTransform(nodeIndex);
-                transform.Blend(localMaskPose.GetLocalSpaceTransform(nodeIndex), finalWeight);
-                outputLocalPose.SetLocalSpaceTransform(nodeIndex, transform);
-            }
+            outputLocalPose.BlendJoints(&localMaskPose, blendWeight, uniqueData->m_mask);
         }
     }
 
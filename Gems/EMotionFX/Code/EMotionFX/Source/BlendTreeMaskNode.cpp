@@ -182,11 +182,7 @@ namespace EMotionFX
             {
                 OutputIncomingNode(animGraphInstance, inputNode);
                 const Pose& inputPose = GetInputPose(animGraphInstance, inputPortNr)->GetValue()->GetPose();
-
-                for (size_t jointIndex : maskInstance.m_jointIndices)
-                {
-                    outputPose.SetLocalSpaceTransform(jointIndex, inputPose.GetLocalSpaceTransform(jointIndex));
-                }
+                outputPose.CopyLocalSpaceTransforms(inputPose, maskInstance.m_jointIndices);
             }
         }
 
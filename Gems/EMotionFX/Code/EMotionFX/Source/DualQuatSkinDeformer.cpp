@@ -8,8 +8,11 @@
 
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Math/SimdMath.h>
 #include "EMotionFXConfig.h"
 #include "DualQuatSkinDeformer.h"
+#include "EMotionFXManager.h"
+#include "SoftSkinManager.h"
 #include "Mesh.h"
 #include "Node.h"
 #include "SubMesh.h"
@@ -71,6 +74,7 @@ namespace EMotionFX
 
         // copy the bone info (for precalc/optimization reasons)
         result->m_bones = m_bones;
+        result->m_packedInfluences = m_packedInfluences;
 
         // return the result
         return result;
@@ -90,7 +94,17 @@ namespace EMotionFX
             boneInfo.m_dualQuat.FromRotationTranslation(skinTransform.m_rotation, skinTransform.m_position);
         }
 
-        if (m_useTaskGraph)
+        // the packed influences are only available after reinitializing the deformer for this mesh
+        const uint32 numVertices = m_mesh->GetNumVertices();
+        m_useBatchedSkinning = GetSoftSkinManager().GetUseBatchedSkinning() && m_packedInfluences.GetNumVertices() == numVertices;
+
+        // skin small meshes directly, there is nothing to gain from splitting them up
+        const AZ::u32 numBatches = aznumeric_caster(ceilf(aznumeric_cast<float>(numVertices) / aznumeric_cast<float>(s_numVerticesPerBatch)));
+        if (numBatches <= 1 || !GetSoftSkinManager().GetUseMultiThreadedSkinning())
+        {
+            SkinVertexBatch(0, numVertices);
+        }
+        else if (m_useTaskGraph && !m_taskGraph.IsEmpty())
         {
             // Skin the vertices by executing the task graph.
             AZ::TaskGraphEvent finishedEvent;
@@ -102,8 +116,6 @@ namespace EMotionFX
             AZ::JobCompletion jobCompletion;
 
             // Split up the skinned vertices into batches.
-            const uint32 numVertices = m_mesh->GetNumVertices();
-            const AZ::u32 numBatches = aznumeric_caster(ceilf(aznumeric_cast<float>(numVertices) / aznumeric_cast<float>(s_numVerticesPerBatch)));
             for (AZ::u32 batchIndex = 0; batchIndex < numBatches; ++batchIndex)
             {
                 const AZ::u32 startVertex = batchIndex * s_numVerticesPerBatch;
@@ -113,7 +125,7 @@ namespace EMotionFX
                 AZ::JobContext* jobContext = nullptr;
                 AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex]()
                     {
-                        SkinRange(m_mesh, startVertex, endVertex, m_bones);
+                        SkinVertexBatch(startVertex, endVertex);
                     }, /*isAutoDelete=*/true, jobContext);
 
                 job->SetDependent(&jobCompletion);
@@ -124,6 +136,73 @@ namespace EMotionFX
         }
     }
 
+    void DualQuatSkinDeformer::SkinVertexBatch(AZ::u32 startVertex, AZ::u32 endVertex)
+    {
+        if (m_useBatchedSkinning)
+        {
+            SkinRangeBatched(m_mesh, startVertex, endVertex, m_bones, m_packedInfluences);
+        }
+        else
+        {
+            SkinRange(m_mesh, startVertex, endVertex, m_bones);
+        }
+    }
+
+    void DualQuatSkinDeformer::SkinRangeBatched(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos, const PackedSkinInfluences& influences)
+    {
+        using AZ::Simd::Vec4;
+
+        AZ::Vector3* positions = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+        AZ::Vector3* normals = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+        AZ::Vector4* tangents = static_cast<AZ::Vector4*>(mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
+        AZ::Vector3* bitangents = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+
+        // bitangents are only skinned together with the tangents, like in the per influence path
+        const bool skinTangents = (tangents != nullptr);
+        const bool skinBitangents = (tangents && bitangents);
+        for (AZ::u32 v = startVertex; v < endVertex; ++v)
+        {
+            // vertices without influences keep their values
+            const size_t numInfluences = influences.GetNumInfluences(v);
+            if (numInfluences == 0)
+            {
+                continue;
+            }
+
+            // get the pivot quat, used for the dot product check
+            const uint16* boneNumbers = influences.GetBoneNumbers(v);
+            const float* weights = influences.GetWeights(v);
+            const AZ::Quaternion& pivotReal = boneInfos[boneNumbers[0]].m_dualQuat.m_real;
+
+            // weighted sum of the real and dual parts, inverting the dual quats on the other side of the pivot by negating their weight
+            Vec4::FloatType real = Vec4::ZeroFloat();
+            Vec4::FloatType dual = Vec4::ZeroFloat();
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                const MCore::DualQuaternion& influenceQuat = boneInfos[boneNumbers[i]].m_dualQuat;
+                const float weight = (influenceQuat.m_real.Dot(pivotReal) < 0.0f) ? -weights[i] : weights[i];
+                const Vec4::FloatType splatWeight = Vec4::Splat(weight);
+                real = Vec4::Madd(influenceQuat.m_real.GetSimdValue(), splatWeight, real);
+                dual = Vec4::Madd(influenceQuat.m_dual.GetSimdValue(), splatWeight, dual);
+            }
+
+            MCore::DualQuaternion skinQuat{ AZ::Quaternion(real), AZ::Quaternion(dual) };
+            skinQuat.Normalize();
+
+            // perform skinning
+            positions[v] = skinQuat.TransformPoint(positions[v]);
+            normals[v] = skinQuat.TransformVector(normals[v]);
+            if (skinTangents)
+            {
+                tangents[v].Set(skinQuat.TransformVector(tangents[v].GetAsVector3()), tangents[v].GetW());
+            }
+            if (skinBitangents)
+            {
+                bitangents[v] = skinQuat.TransformVector(bitangents[v]);
+            }
+        }
+    }
+
     void DualQuatSkinDeformer::SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos)
     {
         SkinningInfoVertexAttributeLayer* layer = (SkinningInfoVertexAttributeLayer*)mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID);
@@ -353,6 +432,10 @@ namespace EMotionFX
             }
         }
 
+        // pack the influences now that the bone numbers are known
+        m_packedInfluences.Init(m_mesh, skinningLayer);
+
+        m_taskGraph.Reset();
         if (m_useTaskGraph)
         {
             // Prepare the task graph
@@ -371,7 +454,7 @@ namespace EMotionFX
                     taskDescriptor,
                     [this, startVertex, endVertex]()
                     {
-                        SkinRange(m_mesh, startVertex, endVertex, m_bones);
+                        SkinVertexBatch(startVertex, endVertex);
                     });
             }
         }
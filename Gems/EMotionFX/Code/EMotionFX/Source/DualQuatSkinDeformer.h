@@ -15,6 +15,7 @@
 #include <MCore/Source/DualQuaternion.h>
 #include "Mesh.h"
 #include "MeshDeformer.h"
+#include "PackedSkinInfluences.h"
 
 namespace EMotionFX
 {
@@ -114,6 +115,12 @@ namespace EMotionFX
          */
         MCORE_INLINE void ReserveLocalBones(size_t numBones)                { m_bones.reserve(numBones); }
 
+        /**
+         * Get the skinning influences packed per vertex, which are used by the batched skinning path.
+         * @result The packed skinning influences, which are empty until the deformer got reinitialized.
+         */
+        MCORE_INLINE const PackedSkinInfluences& GetPackedInfluences() const   { return m_packedInfluences; }
+
     protected:
         /**
          * Structure used for pre-calculating the skinning matrices.
@@ -127,6 +134,8 @@ namespace EMotionFX
                 : m_nodeNr(InvalidIndex) {}
         };
         AZStd::vector<BoneInfo> m_bones; /**< The array of bone information used for pre-calculation. */
+        PackedSkinInfluences m_packedInfluences; /**< The influences packed per vertex, used by the batched skinning path. */
+        bool m_useBatchedSkinning = true; /**< Use the batched skinning path during the current update? */
 
         /**
          * Skin a part of the mesh.
@@ -137,6 +146,24 @@ namespace EMotionFX
          */
         static void SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos);
 
+        /**
+         * Skin a part of the mesh using the packed influences.
+         * The dual quaternions of the influences are blended using SIMD, without looking up the influences in the skinning info layer.
+         * @param mesh The mesh to be skinned.
+         * @param startVertex The start vertex index to start skinning.
+         * @param endVertex The end vertex index for the range to be skinned.
+         * @param boneInfos The pre-calculated skinning matrices shared across the skinning process.
+         * @param influences The influences of the mesh, packed per vertex.
+         */
+        static void SkinRangeBatched(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos, const PackedSkinInfluences& influences);
+
+        /**
+         * Skin a batch of vertices of the mesh, using either the batched or the per influence skinning path.
+         * @param startVertex The start vertex index to start skinning.
+         * @param endVertex The end vertex index for the range to be skinned.
+         */
+        void SkinVertexBatch(AZ::u32 startVertex, AZ::u32 endVertex);
+
         //! Number of vertices per batch/job used for multi-threaded software skinning.
         static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
         AZ::TaskGraph m_taskGraph;
@@ -505,6 +505,23 @@ namespace EMotionFX
     }
 
 
+    // add thread data for extra threads, keeping the existing thread data
+    void EMotionFXManager::GrowNumThreads(uint32 numThreads)
+    {
+        const uint32 oldNumThreads = static_cast<uint32>(m_threadDatas.size());
+        if (numThreads <= oldNumThreads)
+        {
+            return;
+        }
+
+        m_threadDatas.resize(numThreads);
+        for (uint32 i = oldNumThreads; i < numThreads; ++i)
+        {
+            m_threadDatas[i] = ThreadData::Create(i);
+        }
+    }
+
+
     // shrink internal pools to minimize memory usage
     void EMotionFXManager::ShrinkPools()
     {
@@ -285,6 +285,14 @@ namespace EMotionFX
          */
         MCORE_INLINE size_t GetNumThreads() const                                   { return m_threadDatas.size(); }
 
+        /**
+         * Make sure there is thread data for at least the given number of threads.
+         * Unlike SetNumThreads, the existing thread data is kept, so this can be used by schedulers that need more thread indices than configured.
+         * This must not be called while actor instances are being updated.
+         * @param numThreads The minimum number of threads to have thread data for.
+         */
+        void GrowNumThreads(uint32 numThreads);
+
         /**
          * Shrink the memory pools, to reduce memory usage.
          * When you create many actor instances and destroy them later again, the pools have been grown internally, which increases memory usage.
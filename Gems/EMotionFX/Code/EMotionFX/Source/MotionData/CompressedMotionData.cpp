@@ -0,0 +1,1531 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/algorithm.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/SimdQuaternion.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Source/Importer/MotionFileFormat.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/CompressedQuaternion.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        using AZ::Simd::Vec4;
+
+        // The three smallest components of a normalized quaternion are within [-1/sqrt(2), 1/sqrt(2)].
+        constexpr float MaxSmallestComponent = 0.70710678f;
+        constexpr AZ::u16 RotationValueMask = 0x7FFF;
+        constexpr float RotationQuantizationScale = 32767.0f / (2.0f * MaxSmallestComponent);
+        constexpr float RotationStep = (2.0f * MaxSmallestComponent) / 32767.0f;
+        constexpr float MaxVector3Value = 65535.0f;
+
+        // Encodes a rotation into three values. The 15 lower bits hold the three smallest components, while the
+        // highest bits of the first two values hold the index of the dropped largest component.
+        void EncodeRotation(const AZ::Quaternion& rotation, AZ::u16* out)
+        {
+            const AZ::Quaternion normalized = rotation.GetNormalized();
+            const float components[4] = { normalized.GetX(), normalized.GetY(), normalized.GetZ(), normalized.GetW() };
+            size_t largest = 0;
+            for (size_t i = 1; i < 4; ++i)
+            {
+                if (AZ::GetAbs(components[i]) > AZ::GetAbs(components[largest]))
+                {
+                    largest = i;
+                }
+            }
+
+            // The quaternion and its negation are the same rotation, pick the one where the dropped component is positive.
+            const float sign = (components[largest] < 0.0f) ? -1.0f : 1.0f;
+            size_t outIndex = 0;
+            for (size_t i = 0; i < 4; ++i)
+            {
+                if (i != largest)
+                {
+                    const float value = AZ::GetClamp(components[i] * sign, -MaxSmallestComponent, MaxSmallestComponent);
+                    out[outIndex++] = static_cast<AZ::u16>((value + MaxSmallestComponent) * RotationQuantizationScale + 0.5f);
+                }
+            }
+            out[0] |= static_cast<AZ::u16>((largest & 1) << 15);
+            out[1] |= static_cast<AZ::u16>((largest >> 1) << 15);
+        }
+
+        AZ::Quaternion DecodeRotation(const AZ::u16* in)
+        {
+            const size_t largest = (in[0] >> 15) | ((in[1] >> 15) << 1);
+            const float smallest[3] =
+            {
+                (in[0] & RotationValueMask) * RotationStep - MaxSmallestComponent,
+                (in[1] & RotationValueMask) * RotationStep - MaxSmallestComponent,
+                (in[2] & RotationValueMask) * RotationStep - MaxSmallestComponent
+            };
+            const float missing = AZ::Sqrt(AZ::GetMax(0.0f, 1.0f - smallest[0] * smallest[0] - smallest[1] * smallest[1] - smallest[2] * smallest[2]));
+
+            float components[4];
+            size_t smallestIndex = 0;
+            for (size_t i = 0; i < 4; ++i)
+            {
+                components[i] = (i == largest) ? missing : smallest[smallestIndex++];
+            }
+            return AZ::Quaternion(components[0], components[1], components[2], components[3]);
+        }
+
+        // Decodes four rotations into structure of arrays registers.
+        SimdQuaternion::Lanes DecodeRotations(const AZ::u16* const (&packed)[4])
+        {
+            alignas(16) int32_t values[3][4];
+            alignas(16) int32_t largest[4];
+            for (size_t lane = 0; lane < 4; ++lane)
+            {
+                values[0][lane] = packed[lane][0] & RotationValueMask;
+                values[1][lane] = packed[lane][1] & RotationValueMask;
+                values[2][lane] = packed[lane][2] & RotationValueMask;
+                largest[lane] = (packed[lane][0] >> 15) | ((packed[lane][1] >> 15) << 1);
+            }
+
+            const Vec4::FloatType step = Vec4::Splat(RotationStep);
+            const Vec4::FloatType offset = Vec4::Splat(-MaxSmallestComponent);
+            const Vec4::FloatType s0 = Vec4::Madd(Vec4::ConvertToFloat(Vec4::LoadAligned(values[0])), step, offset);
+            const Vec4::FloatType s1 = Vec4::Madd(Vec4::ConvertToFloat(Vec4::LoadAligned(values[1])), step, offset);
+            const Vec4::FloatType s2 = Vec4::Madd(Vec4::ConvertToFloat(Vec4::LoadAligned(values[2])), step, offset);
+            const Vec4::FloatType lengthSq = Vec4::Madd(s2, s2, Vec4::Madd(s1, s1, Vec4::Mul(s0, s0)));
+            const Vec4::FloatType missing = Vec4::Sqrt(Vec4::Max(Vec4::ZeroFloat(), Vec4::Sub(Vec4::Splat(1.0f), lengthSq)));
+
+            // Put the missing component back in place. The components before it are stored at their own index, the ones after it one index lower.
+            const Vec4::FloatType largestIndex = Vec4::ConvertToFloat(Vec4::LoadAligned(largest));
+            const Vec4::FloatType isX = Vec4::CmpEq(largestIndex, Vec4::Splat(0.0f));
+            const Vec4::FloatType isY = Vec4::CmpEq(largestIndex, Vec4::Splat(1.0f));
+            const Vec4::FloatType isZ = Vec4::CmpEq(largestIndex, Vec4::Splat(2.0f));
+            const Vec4::FloatType isW = Vec4::CmpEq(largestIndex, Vec4::Splat(3.0f));
+
+            SimdQuaternion::Lanes result;
+            result.m_x = Vec4::Select(missing, s0, isX);
+            result.m_y = Vec4::Select(s0, Vec4::Select(missing, s1, isY), isX);
+            result.m_z = Vec4::Select(s2, Vec4::Select(missing, s1, isZ), isW);
+            result.m_w = Vec4::Select(missing, s2, isW);
+            return result;
+        }
+
+        void EncodeVector3(const AZ::Vector3& value, const AZ::Vector3& min, const AZ::Vector3& step, AZ::u16* out)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                const float axisStep = step.GetElement(i);
+                const float quantized = (axisStep > 0.0f) ? (value.GetElement(i) - min.GetElement(i)) / axisStep + 0.5f : 0.0f;
+                out[i] = static_cast<AZ::u16>(AZ::GetClamp(quantized, 0.0f, MaxVector3Value));
+            }
+        }
+
+        AZ::Vector3 DecodeVector3(const AZ::u16* in, const AZ::Vector3& min, const AZ::Vector3& step)
+        {
+            return min + AZ::Vector3(static_cast<float>(in[0]), static_cast<float>(in[1]), static_cast<float>(in[2])) * step;
+        }
+
+        //! Also maps the joint data indices back to the skeleton, so the decoded tracks can be written straight into a pose.
+        class CompressedMotionLinkData
+            : public MotionLinkData
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(CompressedMotionLinkData, MotionAllocator, 0)
+            AZ_RTTI(CompressedMotionLinkData, "{0E8B5D31-7C42-4A6F-B9D3-2F61C8A4E7B5}", MotionLinkData)
+
+            AZStd::vector<size_t>& GetSkeletonJoints() { return m_skeletonJoints; }
+            const AZStd::vector<size_t>& GetSkeletonJoints() const { return m_skeletonJoints; }
+
+        private:
+            AZStd::vector<size_t> m_skeletonJoints; //!< The skeleton joint index of each joint data index, InvalidIndex when not in the skeleton.
+        };
+    } // namespace
+
+    CompressedMotionData::~CompressedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedMotionData::CreateNew() const
+    {
+        return aznew CompressedMotionData();
+    }
+
+    const char* CompressedMotionData::GetSceneSettingsName() const
+    {
+        return "Compressed Keyframes (smallest, slightly lossy)";
+    }
+
+    AZStd::unique_ptr<const MotionLinkData> CompressedMotionData::CreateMotionLinkData(const Actor* actor) const
+    {
+        auto data = AZStd::make_unique<CompressedMotionLinkData>();
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const size_t numJoints = skeleton->GetNumNodes();
+        AZStd::vector<size_t>& jointLinks = data->GetJointDataLinks();
+        AZStd::vector<size_t>& skeletonJoints = data->GetSkeletonJoints();
+        jointLinks.resize(numJoints);
+        skeletonJoints.resize(GetNumJoints(), InvalidIndex);
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            const AZ::Outcome<size_t> findResult = FindJointIndexByNameId(skeleton->GetNode(i)->GetID());
+            jointLinks[i] = findResult.IsSuccess() ? findResult.GetValue() : InvalidIndex;
+            if (findResult.IsSuccess())
+            {
+                skeletonJoints[findResult.GetValue()] = i;
+            }
+        }
+        return AZStd::move(data);
+    }
+
+    void CompressedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, [[maybe_unused]] bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        SetSampleRate(keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate);
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), m_sampleRate, numSamples, sampleSpacing);
+
+        CompressedMotionData::InitSettings initSettings;
+        initSettings.m_numJoints = motionData->GetNumJoints();
+        initSettings.m_numMorphs = motionData->GetNumMorphs();
+        initSettings.m_numFloats = motionData->GetNumFloats();
+        initSettings.m_sampleRate = m_sampleRate;
+        initSettings.m_numSamples = numSamples;
+        Init(initSettings);
+        CopyBaseMotionData(motionData);
+
+        // Sample the joints uniformly, then compress them all at once, as the quantization ranges depend on all samples.
+        AZStd::vector<AZStd::vector<AZ::Vector3>> positions(initSettings.m_numJoints);
+        AZStd::vector<AZStd::vector<AZ::Quaternion>> rotations(initSettings.m_numJoints);
+        AZStd::vector<AZStd::vector<AZ::Vector3>> scales(initSettings.m_numJoints);
+        for (size_t i = 0; i < initSettings.m_numJoints; ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            const bool posAnimated = motionData->IsJointPositionAnimated(i);
+            const bool rotAnimated = motionData->IsJointRotationAnimated(i);
+            if (posAnimated) { positions[i].resize(m_numSamples); }
+            if (rotAnimated) { rotations[i].resize(m_numSamples); }
+#ifndef EMFX_SCALE_DISABLED
+            const bool scaleAnimated = motionData->IsJointScaleAnimated(i);
+            if (scaleAnimated) { scales[i].resize(m_numSamples); }
+#endif
+
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const float keyTime = s * sampleSpacing;
+                const Transform transform = motionData->SampleJointTransform(keyTime, i);
+                if (posAnimated) positions[i][s] = transform.m_position;
+                if (rotAnimated) rotations[i][s] = transform.m_rotation;
+#ifndef EMFX_SCALE_DISABLED
+                if (scaleAnimated) scales[i][s] = transform.m_scale;
+#endif
+            }
+        }
+        SetJointSamples(positions, rotations, scales);
+
+        // Morphs.
+        AZStd::vector<float> values;
+        for (size_t i = 0; i < initSettings.m_numMorphs; ++i)
+        {
+            if (motionData->IsMorphAnimated(i))
+            {
+                values.resize(m_numSamples);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    values[s] = motionData->SampleMorph(s * sampleSpacing, i);
+                }
+                SetMorphSamples(i, values);
+            }
+        }
+
+        // Floats.
+        for (size_t i = 0; i < initSettings.m_numFloats; ++i)
+        {
+            if (motionData->IsFloatAnimated(i))
+            {
+                values.resize(m_numSamples);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    values[s] = motionData->SampleFloat(s * sampleSpacing, i);
+                }
+                SetFloatSamples(i, values);
+            }
+        }
+    }
+
+    void CompressedMotionData::SetJointSamples(const AZStd::vector<AZStd::vector<AZ::Vector3>>& positions,
+        const AZStd::vector<AZStd::vector<AZ::Quaternion>>& rotations,
+        const AZStd::vector<AZStd::vector<AZ::Vector3>>& scales)
+    {
+        ClearAllJointTransformSamples();
+
+        auto isValidTrack = [this](size_t jointDataIndex, size_t numValues)
+        {
+            AZ_Error("EMotionFX", numValues == 0 || numValues == m_numSamples,
+                "Expecting the samples of joint %zu to be of size %zu instead of %zu.", jointDataIndex, m_numSamples, numValues);
+            return jointDataIndex < GetNumJoints() && numValues > 0 && numValues == m_numSamples;
+        };
+
+        auto createVector3Track = [](size_t jointDataIndex, const AZStd::vector<AZ::Vector3>& values)
+        {
+            AZ::Vector3 min = values[0];
+            AZ::Vector3 max = values[0];
+            for (const AZ::Vector3& value : values)
+            {
+                min = min.GetMin(value);
+                max = max.GetMax(value);
+            }
+
+            Vector3Track track;
+            track.m_jointDataIndex = jointDataIndex;
+            track.m_min = min;
+            track.m_step = (max - min) / MaxVector3Value;
+            return track;
+        };
+
+        for (size_t i = 0; i < rotations.size(); ++i)
+        {
+            if (isValidTrack(i, rotations[i].size()))
+            {
+                m_rotationTracks.emplace_back(i);
+            }
+        }
+        for (size_t i = 0; i < positions.size(); ++i)
+        {
+            if (isValidTrack(i, positions[i].size()))
+            {
+                m_positionTracks.emplace_back(createVector3Track(i, positions[i]));
+            }
+        }
+        for (size_t i = 0; i < scales.size(); ++i)
+        {
+            if (isValidTrack(i, scales[i].size()))
+            {
+                m_scaleTracks.emplace_back(createVector3Track(i, scales[i]));
+            }
+        }
+
+        // Interleave the tracks per frame.
+        const size_t frameStride = GetFrameStride();
+        m_frames.resize(m_numSamples * frameStride);
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            AZ::u16* frame = m_frames.data() + s * frameStride;
+            for (size_t r = 0; r < m_rotationTracks.size(); ++r)
+            {
+                EncodeRotation(rotations[m_rotationTracks[r]][s], frame + r * 3);
+            }
+            for (size_t p = 0; p < m_positionTracks.size(); ++p)
+            {
+                const Vector3Track& track = m_positionTracks[p];
+                EncodeVector3(positions[track.m_jointDataIndex][s], track.m_min, track.m_step, frame + GetPositionTrackOffset(p));
+            }
+            for (size_t i = 0; i < m_scaleTracks.size(); ++i)
+            {
+                const Vector3Track& track = m_scaleTracks[i];
+                EncodeVector3(scales[track.m_jointDataIndex][s], track.m_min, track.m_step, frame + GetScaleTrackOffset(i));
+            }
+        }
+
+        UpdateJointTracks();
+    }
+
+    void CompressedMotionData::SetMorphSamples(size_t morphDataIndex, const AZStd::vector<float>& values)
+    {
+        AZ_Error("EMotionFX", values.size() == m_numSamples, "Expecting morph values vector to be of size %zu instead of %zu.", m_numSamples, values.size());
+        if (values.size() == m_numSamples)
+        {
+            m_morphData[morphDataIndex].m_values = values;
+        }
+    }
+
+    void CompressedMotionData::SetFloatSamples(size_t floatDataIndex, const AZStd::vector<float>& values)
+    {
+        AZ_Error("EMotionFX", values.size() == m_numSamples, "Expecting float values vector to be of size %zu instead of %zu.", m_numSamples, values.size());
+        if (values.size() == m_numSamples)
+        {
+            m_floatData[floatDataIndex].m_values = values;
+        }
+    }
+
+    template<typename JointTransformFunction>
+    void CompressedMotionData::SampleAnimatedTracks(float sampleTime, const JointTransformFunction& getJointTransform) const
+    {
+        if (m_frames.empty())
+        {
+            return;
+        }
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const size_t frameStride = GetFrameStride();
+        const AZ::u16* frameA = m_frames.data() + indexA * frameStride;
+        const AZ::u16* frameB = m_frames.data() + indexB * frameStride;
+
+        // Decode and interpolate the rotations four at a time. The last block is padded by repeating its last track.
+        const Vec4::FloatType tLanes = Vec4::Splat(t);
+        const Vec4::FloatType oneMinusT = Vec4::Splat(1.0f - t);
+        const size_t numRotationTracks = m_rotationTracks.size();
+        for (size_t i = 0; i < numRotationTracks; i += 4)
+        {
+            const size_t last = numRotationTracks - 1;
+            const size_t offsets[4] = { i * 3, AZStd::min(i + 1, last) * 3, AZStd::min(i + 2, last) * 3, AZStd::min(i + 3, last) * 3 };
+            const AZ::u16* const packedA[4] = { frameA + offsets[0], frameA + offsets[1], frameA + offsets[2], frameA + offsets[3] };
+            const AZ::u16* const packedB[4] = { frameB + offsets[0], frameB + offsets[1], frameB + offsets[2], frameB + offsets[3] };
+
+            AZ::Quaternion rotations[4];
+            SimdQuaternion::Store(SimdQuaternion::NLerp(DecodeRotations(packedA), DecodeRotations(packedB), tLanes, oneMinusT),
+                rotations[0], rotations[1], rotations[2], rotations[3]);
+
+            const size_t numActiveTracks = AZStd::min<size_t>(4, numRotationTracks - i);
+            for (size_t lane = 0; lane < numActiveTracks; ++lane)
+            {
+                if (Transform* transform = getJointTransform(m_rotationTracks[i + lane]))
+                {
+                    transform->m_rotation = rotations[lane];
+                }
+            }
+        }
+
+        for (size_t p = 0; p < m_positionTracks.size(); ++p)
+        {
+            const Vector3Track& track = m_positionTracks[p];
+            if (Transform* transform = getJointTransform(track.m_jointDataIndex))
+            {
+                const size_t offset = GetPositionTrackOffset(p);
+                transform->m_position = DecodeVector3(frameA + offset, track.m_min, track.m_step).Lerp(DecodeVector3(frameB + offset, track.m_min, track.m_step), t);
+            }
+        }
+
+#ifndef EMFX_SCALE_DISABLED
+        for (size_t i = 0; i < m_scaleTracks.size(); ++i)
+        {
+            const Vector3Track& track = m_scaleTracks[i];
+            if (Transform* transform = getJointTransform(track.m_jointDataIndex))
+            {
+                const size_t offset = GetScaleTrackOffset(i);
+                transform->m_scale = DecodeVector3(frameA + offset, track.m_min, track.m_step).Lerp(DecodeVector3(frameB + offset, track.m_min, track.m_step), t);
+            }
+        }
+#endif
+    }
+
+    void CompressedMotionData::SampleJointTransforms(float sampleTime, Transform* outTransforms) const
+    {
+        const size_t numJoints = GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            outTransforms[i] = m_staticJointData[i].m_staticTransform;
+        }
+
+        SampleAnimatedTracks(sampleTime, [outTransforms](size_t jointDataIndex)
+        {
+            return outTransforms + jointDataIndex;
+        });
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const size_t jointDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && jointDataIndex == InvalidIndex)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        const bool inPlace = (settings.m_inPlace && jointSkeletonIndex == actor->GetMotionExtractionNodeIndex());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (jointDataIndex != InvalidIndex && !inPlace)
+        {
+            result = SampleJointTransform(settings.m_sampleTime, jointDataIndex);
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.m_axis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).m_sourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.m_flags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+        const CompressedMotionLinkData* compressedLinkData = azrtti_cast<const CompressedMotionLinkData*>(motionLinkData);
+        AZ_Assert(compressedLinkData, "Expected the motion link data to be created by the compressed motion data.");
+        const size_t inPlaceJointIndex = settings.m_inPlace ? actor->GetMotionExtractionNodeIndex() : InvalidIndex;
+
+        // Decode the animated tracks straight into the output pose. This also writes the joints that are linked to the motion
+        // but aren't enabled, which is harmless as their transforms are not used.
+        const AZStd::vector<size_t>& skeletonJoints = compressedLinkData->GetSkeletonJoints();
+        SampleAnimatedTracks(settings.m_sampleTime, [&skeletonJoints, inPlaceJointIndex, outputPose](size_t jointDataIndex) -> Transform*
+        {
+            const size_t skeletonJointIndex = (jointDataIndex < skeletonJoints.size()) ? skeletonJoints[jointDataIndex] : InvalidIndex;
+            if (skeletonJointIndex == InvalidIndex || skeletonJointIndex == inPlaceJointIndex)
+            {
+                return nullptr;
+            }
+            return &outputPose->GetLocalSpaceTransformDirect(skeletonJointIndex);
+        });
+
+        // Fill in the parts that aren't animated.
+        const AZStd::vector<size_t>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const size_t numNodes = actorInstance->GetNumEnabledNodes();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (skeletonJointIndex == inPlaceJointIndex);
+
+            Transform result = outputPose->GetLocalSpaceTransformDirect(skeletonJointIndex);
+            const size_t jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex && !inPlace)
+            {
+                const JointTracks& jointTracks = m_jointTracks[jointDataIndex];
+                const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+                if (jointTracks.m_positionTrack == InvalidIndex)
+                {
+                    result.m_position = staticTransform.m_position;
+                }
+                if (jointTracks.m_rotationTrack == InvalidIndex)
+                {
+                    result.m_rotation = staticTransform.m_rotation;
+                }
+#ifndef EMFX_SCALE_DISABLED
+                if (jointTracks.m_scaleTrack == InvalidIndex)
+                {
+                    result.m_scale = staticTransform.m_scale;
+                }
+#endif
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const size_t numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (size_t i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                const FloatData& data = m_morphData[realIndex];
+                if (!data.m_values.empty())
+                {
+                    outputPose->SetMorphWeight(i, AZ::Lerp(data.m_values[indexA], data.m_values[indexB], t));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, m_staticMorphData[realIndex].m_staticValue);
+                }
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const AZStd::vector<float>& values = m_morphData[morphDataIndex].m_values;
+        return (!values.empty()) ? AZ::Lerp(values[indexA], values[indexB], t) : m_staticMorphData[morphDataIndex].m_staticValue;
+    }
+
+    float CompressedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const AZStd::vector<float>& values = m_floatData[floatDataIndex].m_values;
+        return (!values.empty()) ? AZ::Lerp(values[indexA], values[indexB], t) : m_staticFloatData[floatDataIndex].m_staticValue;
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        const size_t trackIndex = m_jointTracks[jointDataIndex].m_positionTrack;
+        if (trackIndex == InvalidIndex)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_position;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const Vector3Track& track = m_positionTracks[trackIndex];
+        const size_t offset = GetPositionTrackOffset(trackIndex);
+        const size_t frameStride = GetFrameStride();
+        return DecodeVector3(&m_frames[indexA * frameStride + offset], track.m_min, track.m_step)
+            .Lerp(DecodeVector3(&m_frames[indexB * frameStride + offset], track.m_min, track.m_step), t);
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        const size_t trackIndex = m_jointTracks[jointDataIndex].m_rotationTrack;
+        if (trackIndex == InvalidIndex)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_rotation;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const size_t offset = trackIndex * 3;
+        const size_t frameStride = GetFrameStride();
+        return DecodeRotation(&m_frames[indexA * frameStride + offset]).NLerp(DecodeRotation(&m_frames[indexB * frameStride + offset]), t);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        const size_t trackIndex = m_jointTracks[jointDataIndex].m_scaleTrack;
+        if (trackIndex == InvalidIndex)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_scale;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const Vector3Track& track = m_scaleTracks[trackIndex];
+        const size_t offset = GetScaleTrackOffset(trackIndex);
+        const size_t frameStride = GetFrameStride();
+        return DecodeVector3(&m_frames[indexA * frameStride + offset], track.m_min, track.m_step)
+            .Lerp(DecodeVector3(&m_frames[indexB * frameStride + offset], track.m_min, track.m_step), t);
+    }
+#endif
+
+    Transform CompressedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        return Transform
+        (
+            SampleJointPosition(sampleTime, jointDataIndex),
+            SampleJointRotation(sampleTime, jointDataIndex)
+#ifndef EMFX_SCALE_DISABLED
+            ,SampleJointScale(sampleTime, jointDataIndex)
+#endif
+        );
+    }
+
+    void CompressedMotionData::Init(const InitSettings& settings)
+    {
+        if (settings.m_numSamples > 0)
+        {
+            AZ_Error("EMotionFX", settings.m_sampleRate > 0.0f, "Sample rate should be larger than zero.");
+        }
+        Clear();
+        Resize(settings.m_numJoints, settings.m_numMorphs, settings.m_numFloats);
+        m_numSamples = settings.m_numSamples;
+        SetSampleRate(settings.m_sampleRate);
+        UpdateDuration();
+    }
+
+    void CompressedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        if (numJoints < m_jointTracks.size())
+        {
+            auto isRemovedJoint = [numJoints](size_t jointDataIndex) { return jointDataIndex >= numJoints; };
+            RemoveTracks(isRemovedJoint, isRemovedJoint, isRemovedJoint);
+        }
+        m_jointTracks.resize(numJoints);
+        UpdateJointTracks();
+
+        m_morphData.resize(numMorphs);
+        m_floatData.resize(numFloats);
+    }
+
+    void CompressedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointTracks.size(), "Expected the size of the jointTracks vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointTracks.emplace_back();
+    }
+
+    void CompressedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphData.size(), "Expected the size of the morphData vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphData.emplace_back();
+    }
+
+    void CompressedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatData.size(), "Expected the size of the floatData vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatData.emplace_back();
+    }
+
+    void CompressedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0) ? (m_numSamples - 1) * m_sampleSpacing : 0.0f;
+    }
+
+    bool CompressedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_positionTrack != InvalidIndex;
+    }
+
+    bool CompressedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_rotationTrack != InvalidIndex;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool CompressedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_scaleTrack != InvalidIndex;
+    }
+#endif
+
+    bool CompressedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+        const JointTracks& jointTracks = m_jointTracks[jointDataIndex];
+        return jointTracks.m_positionTrack != InvalidIndex || jointTracks.m_rotationTrack != InvalidIndex || jointTracks.m_scaleTrack != InvalidIndex;
+    }
+
+    bool CompressedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return !m_morphData[morphDataIndex].m_values.empty();
+    }
+
+    bool CompressedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return !m_floatData[floatDataIndex].m_values.empty();
+    }
+
+    size_t CompressedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    float CompressedMotionData::GetSampleSpacing() const
+    {
+        return m_sampleSpacing;
+    }
+
+    void CompressedMotionData::UpdateSampleSpacing()
+    {
+        if (m_sampleRate > AZ::Constants::FloatEpsilon)
+        {
+            m_sampleSpacing = 1.0f / m_sampleRate;
+        }
+        else
+        {
+            m_sampleSpacing = 0.0f;
+        }
+    }
+
+    void CompressedMotionData::SetSampleRate(float sampleRate)
+    {
+        MotionData::SetSampleRate(sampleRate);
+        UpdateSampleSpacing();
+    }
+
+    size_t CompressedMotionData::CalcSampleMemoryUsageInBytes() const
+    {
+        size_t numBytes = m_frames.size() * sizeof(AZ::u16);
+        numBytes += m_rotationTracks.size() * sizeof(size_t);
+        numBytes += (m_positionTracks.size() + m_scaleTracks.size()) * sizeof(Vector3Track);
+        numBytes += m_jointTracks.size() * sizeof(JointTracks);
+        for (const FloatData& data : m_morphData)
+        {
+            numBytes += data.m_values.size() * sizeof(float);
+        }
+        for (const FloatData& data : m_floatData)
+        {
+            numBytes += data.m_values.size() * sizeof(float);
+        }
+        return numBytes;
+    }
+
+    size_t CompressedMotionData::GetFrameStride() const
+    {
+        return (m_rotationTracks.size() + m_positionTracks.size() + m_scaleTracks.size()) * 3;
+    }
+
+    size_t CompressedMotionData::GetPositionTrackOffset(size_t positionTrack) const
+    {
+        return (m_rotationTracks.size() + positionTrack) * 3;
+    }
+
+    size_t CompressedMotionData::GetScaleTrackOffset(size_t scaleTrack) const
+    {
+        return (m_rotationTracks.size() + m_positionTracks.size() + scaleTrack) * 3;
+    }
+
+    void CompressedMotionData::UpdateJointTracks()
+    {
+        for (JointTracks& jointTracks : m_jointTracks)
+        {
+            jointTracks = JointTracks();
+        }
+        for (size_t i = 0; i < m_rotationTracks.size(); ++i)
+        {
+            m_jointTracks[m_rotationTracks[i]].m_rotationTrack = i;
+        }
+        for (size_t i = 0; i < m_positionTracks.size(); ++i)
+        {
+            m_jointTracks[m_positionTracks[i].m_jointDataIndex].m_positionTrack = i;
+        }
+        for (size_t i = 0; i < m_scaleTracks.size(); ++i)
+        {
+            m_jointTracks[m_scaleTracks[i].m_jointDataIndex].m_scaleTrack = i;
+        }
+    }
+
+    template<typename RotationPredicate, typename PositionPredicate, typename ScalePredicate>
+    void CompressedMotionData::RemoveTracks(const RotationPredicate& removeRotationTrack, const PositionPredicate& removePositionTrack, const ScalePredicate& removeScaleTrack)
+    {
+        // Gather the offsets of the tracks to keep, in their new order.
+        AZStd::vector<size_t> keptOffsets;
+        AZStd::vector<size_t> rotationTracks;
+        AZStd::vector<Vector3Track> positionTracks;
+        AZStd::vector<Vector3Track> scaleTracks;
+        for (size_t i = 0; i < m_rotationTracks.size(); ++i)
+        {
+            if (!removeRotationTrack(m_rotationTracks[i]))
+            {
+                keptOffsets.emplace_back(i * 3);
+                rotationTracks.emplace_back(m_rotationTracks[i]);
+            }
+        }
+        for (size_t i = 0; i < m_positionTracks.size(); ++i)
+        {
+            if (!removePositionTrack(m_positionTracks[i].m_jointDataIndex))
+            {
+                keptOffsets.emplace_back(GetPositionTrackOffset(i));
+                positionTracks.emplace_back(m_positionTracks[i]);
+            }
+        }
+        for (size_t i = 0; i < m_scaleTracks.size(); ++i)
+        {
+            if (!removeScaleTrack(m_scaleTracks[i].m_jointDataIndex))
+            {
+                keptOffsets.emplace_back(GetScaleTrackOffset(i));
+                scaleTracks.emplace_back(m_scaleTracks[i]);
+            }
+        }
+
+        const size_t oldFrameStride = GetFrameStride();
+        const size_t newFrameStride = keptOffsets.size() * 3;
+        if (newFrameStride == oldFrameStride)
+        {
+            return;
+        }
+
+        // Repack the frames. The quantized values are copied as they are, so this doesn't lose any precision.
+        AZStd::vector<AZ::u16> frames(m_numSamples * newFrameStride);
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            const AZ::u16* oldFrame = m_frames.data() + s * oldFrameStride;
+            AZ::u16* newFrame = frames.data() + s * newFrameStride;
+            for (size_t i = 0; i < keptOffsets.size(); ++i)
+            {
+                AZStd::copy(oldFrame + keptOffsets[i], oldFrame + keptOffsets[i] + 3, newFrame + i * 3);
+            }
+        }
+
+        m_frames = AZStd::move(frames);
+        m_rotationTracks = AZStd::move(rotationTracks);
+        m_positionTracks = AZStd::move(positionTracks);
+        m_scaleTracks = AZStd::move(scaleTracks);
+        UpdateJointTracks();
+    }
+
+    void CompressedMotionData::ClearAllJointTransformSamples()
+    {
+        m_rotationTracks.clear();
+        m_positionTracks.clear();
+        m_scaleTracks.clear();
+        m_frames.clear();
+        m_frames.shrink_to_fit();
+        UpdateJointTracks();
+    }
+
+    void CompressedMotionData::ClearAllMorphSamples()
+    {
+        for (FloatData& data : m_morphData)
+        {
+            data.m_values.clear();
+        }
+    }
+
+    void CompressedMotionData::ClearAllFloatSamples()
+    {
+        for (FloatData& data : m_floatData)
+        {
+            data.m_values.clear();
+        }
+    }
+
+    void CompressedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        auto keep = [](size_t) { return false; };
+        RemoveTracks(keep, [jointDataIndex](size_t index) { return index == jointDataIndex; }, keep);
+    }
+
+    void CompressedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        auto keep = [](size_t) { return false; };
+        RemoveTracks([jointDataIndex](size_t index) { return index == jointDataIndex; }, keep, keep);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void CompressedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        auto keep = [](size_t) { return false; };
+        RemoveTracks(keep, keep, [jointDataIndex](size_t index) { return index == jointDataIndex; });
+    }
+#endif
+
+    void CompressedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        auto isJoint = [jointDataIndex](size_t index) { return index == jointDataIndex; };
+        RemoveTracks(isJoint, isJoint, isJoint);
+    }
+
+    void CompressedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        m_morphData[morphDataIndex].m_values.clear();
+    }
+
+    void CompressedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        m_floatData[floatDataIndex].m_values.clear();
+    }
+
+    void CompressedMotionData::ClearAllData()
+    {
+        m_rotationTracks.clear();
+        m_positionTracks.clear();
+        m_scaleTracks.clear();
+        m_jointTracks.clear();
+        m_jointTracks.shrink_to_fit();
+        m_frames.clear();
+        m_frames.shrink_to_fit();
+        m_morphData.clear();
+        m_morphData.shrink_to_fit();
+        m_floatData.clear();
+        m_floatData.shrink_to_fit();
+
+        m_numSamples = 0;
+    }
+
+    void CompressedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        ClearJointTransformSamples(jointDataIndex);
+
+        // Shift the joint data indices of the tracks of the joints after the removed one.
+        for (size_t& trackJointIndex : m_rotationTracks)
+        {
+            trackJointIndex -= (trackJointIndex > jointDataIndex) ? 1 : 0;
+        }
+        for (Vector3Track& track : m_positionTracks)
+        {
+            track.m_jointDataIndex -= (track.m_jointDataIndex > jointDataIndex) ? 1 : 0;
+        }
+        for (Vector3Track& track : m_scaleTracks)
+        {
+            track.m_jointDataIndex -= (track.m_jointDataIndex > jointDataIndex) ? 1 : 0;
+        }
+        m_jointTracks.erase(m_jointTracks.begin() + jointDataIndex);
+        UpdateJointTracks();
+    }
+
+    void CompressedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        m_morphData.erase(m_morphData.begin() + morphDataIndex);
+    }
+
+    void CompressedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        m_floatData.erase(m_floatData.begin() + floatDataIndex);
+    }
+
+    void CompressedMotionData::ScaleData(float scaleFactor)
+    {
+        // Scaling the quantization range scales all samples, without having to requantize them.
+        for (Vector3Track& track : m_positionTracks)
+        {
+            track.m_min *= scaleFactor;
+            track.m_step *= scaleFactor;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct File_CompressedMotionData_Info
+    {
+        AZ::u32 m_numJoints = 0;
+        AZ::u32 m_numMorphs = 0;
+        AZ::u32 m_numFloats = 0;
+        AZ::u32 m_numSamples = 0;
+        AZ::u32 m_numRotationTracks = 0;
+        AZ::u32 m_numPositionTracks = 0;
+        AZ::u32 m_numScaleTracks = 0;
+        float m_sampleRate = 30.0f;
+
+        // Followed by:
+        // File_CompressedMotionData_Joint[m_numJoints]
+        // AZ::u32[m_numRotationTracks] : The joint index of each rotation track.
+        // File_CompressedMotionData_Vector3Track[m_numPositionTracks]
+        // File_CompressedMotionData_Vector3Track[m_numScaleTracks]
+        // AZ::u16[m_numSamples * 3 * (m_numRotationTracks + m_numPositionTracks + m_numScaleTracks)] : The quantized frames.
+        // File_CompressedMotionData_Float[m_numMorphs]
+        // File_CompressedMotionData_Float[m_numFloats]
+    };
+
+    struct File_CompressedMotionData_Joint
+    {
+        FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+        FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+        FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+        FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+        FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+        FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+
+        // Followed by:
+        // string : The name of the joint.
+    };
+
+    struct File_CompressedMotionData_Vector3Track
+    {
+        AZ::u32                 m_jointIndex = 0;               // The joint data index of the track.
+        FileFormat::FileVector3 m_min { 0.0f, 0.0f, 0.0f };     // The minimum of the quantization range.
+        FileFormat::FileVector3 m_step { 0.0f, 0.0f, 0.0f };    // The size of a quantization step.
+    };
+
+    struct File_CompressedMotionData_Float
+    {
+        float m_staticValue = 0.0f; // The static (first frame) value.
+        AZ::u8 m_isAnimated = 0;    // Whether the samples follow.
+
+        // Followed by:
+        // String: The name of the channel.
+        // float[ File_CompressedMotionData_Info.m_numSamples ] (only when m_isAnimated is set).
+    };
+    //---------------------------------------------------------------------------------------
+
+    size_t CompressedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedMotionData_Info);
+
+        const size_t numJoints = GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+        }
+
+        numBytes += m_rotationTracks.size() * sizeof(AZ::u32);
+        numBytes += (m_positionTracks.size() + m_scaleTracks.size()) * sizeof(File_CompressedMotionData_Vector3Track);
+        numBytes += m_frames.size() * sizeof(AZ::u16);
+
+        const size_t numMorphs = GetNumMorphs();
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+            numBytes += m_morphData[i].m_values.size() * sizeof(float);
+        }
+
+        const size_t numFloats = GetNumFloats();
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+            numBytes += m_floatData[i].m_values.size() * sizeof(float);
+        }
+
+        return numBytes;
+    }
+
+    AZ::u32 CompressedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+
+        // Write the info chunk.
+        File_CompressedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(GetNumSamples());
+        info.m_numRotationTracks = static_cast<AZ::u32>(m_rotationTracks.size());
+        info.m_numPositionTracks = static_cast<AZ::u32>(m_positionTracks.size());
+        info.m_numScaleTracks = static_cast<AZ::u32>(m_scaleTracks.size());
+        info.m_sampleRate = GetSampleRate();
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numRotationTracks, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numPositionTracks, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numScaleTracks, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        // Write the static joint data.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointChunk;
+            ExporterLib::CopyVector(jointChunk.m_staticPos, AZ::PackedVector3f(GetJointStaticPosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, MCore::Compressed16BitQuaternion(GetJointStaticRotation(i)));
+            ExporterLib::CopyVector(jointChunk.m_bindPosePos, AZ::PackedVector3f(GetJointBindPosePosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, MCore::Compressed16BitQuaternion(GetJointBindPoseRotation(i)));
+#ifndef EMFX_SCALE_DISABLED
+            ExporterLib::CopyVector(jointChunk.m_staticScale, AZ::PackedVector3f(GetJointStaticScale(i)));
+            ExporterLib::CopyVector(jointChunk.m_bindPoseScale, AZ::PackedVector3f(GetJointBindPoseScale(i)));
+#endif
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("- Motion Joint: %s", GetJointName(i).c_str());
+                MCore::LogDetailedInfo("   + Position Animated:     %s", IsJointPositionAnimated(i) ? "Yes" : "No");
+                MCore::LogDetailedInfo("   + Rotation Animated:     %s", IsJointRotationAnimated(i) ? "Yes" : "No");
+                MCore::LogDetailedInfo("   + Scale Animated:        %s", (m_jointTracks[i].m_scaleTrack != InvalidIndex) ? "Yes" : "No");
+            }
+
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+            if (stream->Write(&jointChunk, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetJointName(i), stream, targetEndianType);
+        }
+
+        // Write the track descriptions.
+        for (const size_t jointDataIndex : m_rotationTracks)
+        {
+            AZ::u32 jointIndex = static_cast<AZ::u32>(jointDataIndex);
+            ExporterLib::ConvertUnsignedInt(&jointIndex, targetEndianType);
+            if (stream->Write(&jointIndex, sizeof(AZ::u32)) == 0)
+            {
+                return false;
+            }
+        }
+        for (const AZStd::vector<Vector3Track>* tracks : { &m_positionTracks, &m_scaleTracks })
+        {
+            for (const Vector3Track& track : *tracks)
+            {
+                File_CompressedMotionData_Vector3Track trackChunk;
+                trackChunk.m_jointIndex = static_cast<AZ::u32>(track.m_jointDataIndex);
+                ExporterLib::CopyVector(trackChunk.m_min, AZ::PackedVector3f(track.m_min));
+                ExporterLib::CopyVector(trackChunk.m_step, AZ::PackedVector3f(track.m_step));
+                ExporterLib::ConvertUnsignedInt(&trackChunk.m_jointIndex, targetEndianType);
+                ExporterLib::ConvertFileVector3(&trackChunk.m_min, targetEndianType);
+                ExporterLib::ConvertFileVector3(&trackChunk.m_step, targetEndianType);
+                if (stream->Write(&trackChunk, sizeof(File_CompressedMotionData_Vector3Track)) == 0)
+                {
+                    return false;
+                }
+            }
+        }
+
+        // Write the frames in a single call.
+        if (!m_frames.empty())
+        {
+            AZStd::vector<AZ::u16> frames = m_frames;
+            for (AZ::u16& value : frames)
+            {
+                ExporterLib::ConvertUnsignedShort(&value, targetEndianType);
+            }
+            if (stream->Write(frames.data(), frames.size() * sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+        }
+
+        // Write the morph and float channels.
+        auto saveFloatChannel = [stream, targetEndianType](const AZStd::string& name, float staticValue, const FloatData& data)
+        {
+            if (name.empty())
+            {
+                MCore::LogError("Cannot save morph or float channel with empty name.");
+                return false;
+            }
+
+            File_CompressedMotionData_Float floatChunk;
+            floatChunk.m_staticValue = staticValue;
+            floatChunk.m_isAnimated = data.m_values.empty() ? 0 : 1;
+            ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+            if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(name, stream, targetEndianType);
+
+            for (float value : data.m_values)
+            {
+                ExporterLib::ConvertFloat(&value, targetEndianType);
+                if (stream->Write(&value, sizeof(float)) == 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (!saveFloatChannel(GetMorphName(i), GetMorphStaticValue(i), m_morphData[i]))
+            {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (!saveFloatChannel(GetFloatName(i), GetFloatStaticValue(i), m_floatData[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        // Read the info header.
+        File_CompressedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numRotationTracks, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numPositionTracks, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numScaleTracks, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints         = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs         = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats         = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumSamples        = %d", info.m_numSamples);
+            MCore::LogDetailedInfo("  + NumRotationTracks = %d", info.m_numRotationTracks);
+            MCore::LogDetailedInfo("  + NumPositionTracks = %d", info.m_numPositionTracks);
+            MCore::LogDetailedInfo("  + NumScaleTracks    = %d", info.m_numScaleTracks);
+            MCore::LogDetailedInfo("  + SampleRate        = %f", info.m_sampleRate);
+        }
+
+        // Initialize the motion data.
+        InitSettings initSettings;
+        initSettings.m_numJoints = info.m_numJoints;
+        initSettings.m_numMorphs = info.m_numMorphs;
+        initSettings.m_numFloats = info.m_numFloats;
+        initSettings.m_numSamples = info.m_numSamples;
+        initSettings.m_sampleRate = info.m_sampleRate;
+        Init(initSettings);
+
+        // Read the static joint data.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.m_x, jointInfo.m_staticPos.m_y, jointInfo.m_staticPos.m_z);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.m_x, jointInfo.m_staticRot.m_y, jointInfo.m_staticRot.m_z, jointInfo.m_staticRot.m_w);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.m_x, jointInfo.m_bindPosePos.m_y, jointInfo.m_bindPosePos.m_z);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.m_x, jointInfo.m_bindPoseRot.m_y, jointInfo.m_bindPoseRot.m_z, jointInfo.m_bindPoseRot.m_w);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+
+            SetJointStaticPosition(i, staticPos);
+            SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            SetJointBindPosePosition(i, bindPosePos);
+            SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+#ifndef EMFX_SCALE_DISABLED
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.m_x, jointInfo.m_staticScale.m_y, jointInfo.m_staticScale.m_z);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.m_x, jointInfo.m_bindPoseScale.m_y, jointInfo.m_bindPoseScale.m_z);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+            SetJointStaticScale(i, staticScale);
+            SetJointBindPoseScale(i, bindPoseScale);
+#endif
+
+            const AZStd::string name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            SetJointName(i, name);
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, name.c_str());
+            }
+        }
+
+        // Read the track descriptions.
+        m_rotationTracks.resize(info.m_numRotationTracks);
+        for (size_t& jointDataIndex : m_rotationTracks)
+        {
+            AZ::u32 jointIndex = 0;
+            if (stream->Read(&jointIndex, sizeof(AZ::u32)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertUnsignedInt32(&jointIndex, sourceEndianType);
+            jointDataIndex = jointIndex;
+        }
+
+        m_positionTracks.resize(info.m_numPositionTracks);
+        m_scaleTracks.resize(info.m_numScaleTracks);
+        for (AZStd::vector<Vector3Track>* tracks : { &m_positionTracks, &m_scaleTracks })
+        {
+            for (Vector3Track& track : *tracks)
+            {
+                File_CompressedMotionData_Vector3Track trackInfo;
+                if (stream->Read(&trackInfo, sizeof(File_CompressedMotionData_Vector3Track)) == 0)
+                {
+                    return false;
+                }
+                AZ::Vector3 min(trackInfo.m_min.m_x, trackInfo.m_min.m_y, trackInfo.m_min.m_z);
+                AZ::Vector3 step(trackInfo.m_step.m_x, trackInfo.m_step.m_y, trackInfo.m_step.m_z);
+                MCore::Endian::ConvertUnsignedInt32(&trackInfo.m_jointIndex, sourceEndianType);
+                MCore::Endian::ConvertVector3(&min, sourceEndianType);
+                MCore::Endian::ConvertVector3(&step, sourceEndianType);
+                track.m_jointDataIndex = trackInfo.m_jointIndex;
+                track.m_min = min;
+                track.m_step = step;
+            }
+        }
+
+        const auto isInvalidJoint = [this](size_t jointDataIndex) { return jointDataIndex >= GetNumJoints(); };
+        const auto isInvalidTrack = [&isInvalidJoint](const Vector3Track& track) { return isInvalidJoint(track.m_jointDataIndex); };
+        if (AZStd::any_of(m_rotationTracks.begin(), m_rotationTracks.end(), isInvalidJoint) ||
+            AZStd::any_of(m_positionTracks.begin(), m_positionTracks.end(), isInvalidTrack) ||
+            AZStd::any_of(m_scaleTracks.begin(), m_scaleTracks.end(), isInvalidTrack))
+        {
+            AZ_Error("EMotionFX", false, "CompressedMotionData has a track that refers to a joint that doesn't exist.");
+            ClearAllJointTransformSamples();
+            return false;
+        }
+
+        // Read the frames in a single call.
+        m_frames.resize(m_numSamples * GetFrameStride());
+        if (!m_frames.empty())
+        {
+            if (stream->Read(m_frames.data(), m_frames.size() * sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertUnsignedInt16(m_frames.data(), sourceEndianType, static_cast<uint32>(m_frames.size()));
+        }
+        UpdateJointTracks();
+
+        // Read the morph and float channels.
+        AZStd::vector<float> values;
+        auto readFloatChannel = [stream, sourceEndianType, &values, &info](AZStd::string& name, float& staticValue)
+        {
+            File_CompressedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            staticValue = floatInfo.m_staticValue;
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+
+            values.resize(floatInfo.m_isAnimated ? info.m_numSamples : 0);
+            if (!values.empty())
+            {
+                if (stream->Read(values.data(), values.size() * sizeof(float)) == 0)
+                {
+                    return false;
+                }
+                MCore::Endian::ConvertFloat(values.data(), sourceEndianType, static_cast<uint32>(values.size()));
+            }
+            return true;
+        };
+
+        AZStd::string name;
+        float staticValue = 0.0f;
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (!readFloatChannel(name, staticValue))
+            {
+                return false;
+            }
+            SetMorphName(i, name);
+            SetMorphStaticValue(i, staticValue);
+            if (!values.empty())
+            {
+                SetMorphSamples(i, values);
+            }
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (!readFloatChannel(name, staticValue))
+            {
+                return false;
+            }
+            SetFloatName(i, name);
+            SetFloatStaticValue(i, staticValue);
+            if (!values.empty())
+            {
+                SetFloatSamples(i, values);
+            }
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        switch (readSettings.m_version)
+        {
+            case 1:
+            {
+                return ReadVersion1(stream, readSettings);
+            }
+            break;
+
+            default:
+            {
+                AZ_Error("EMotionFX", false, "Unsupported CompressedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            }
+        }
+
+        return false;
+    }
+} // namespace EMotionFX
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    //! Uniformly sampled motion data, quantized to reduce memory usage and laid out for sampling whole poses.
+    //! Rotations are stored using the smallest three encoding: the largest component is dropped and the three others are
+    //! quantized to 15 bits each, which takes 6 bytes per rotation. Positions and scales are quantized to 16 bits per component,
+    //! relative to the range they cover over the whole motion.
+    //! The samples of all animated joints are interleaved per frame, so sampling a pose reads two contiguous blocks of memory.
+    //! Rotations are decoded and interpolated four joints at a time using SIMD.
+    //! Morph and float samples are few and are stored uncompressed, like UniformMotionData does.
+    class EMFX_API CompressedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedMotionData, MotionAllocator, 0)
+        AZ_RTTI(CompressedMotionData, "{6B1F7E8A-3B74-4D5C-9A0E-5C1E2D8F4B93}", MotionData)
+
+        struct EMFX_API InitSettings
+        {
+            size_t m_numJoints = 0;
+            size_t m_numMorphs = 0;
+            size_t m_numFloats = 0;
+            size_t m_numSamples = 0;
+            float m_sampleRate = 30.0f;
+        };
+
+        CompressedMotionData() = default;
+        ~CompressedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        bool GetSupportsOptimizeSettings() const override { return false; }
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const override;
+        void SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        //! Samples the transforms of all joints at once.
+        //! @param sampleTime The time to sample at.
+        //! @param outTransforms The sampled transforms, indexed by joint data index. Must hold GetNumJoints() transforms.
+        void SampleJointTransforms(float sampleTime, Transform* outTransforms) const;
+
+        // Initialize and clear.
+        void Init(const InitSettings& settings);
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+        //! Compresses the joint samples. Each sample array holds GetNumSamples() values, or is empty when not animated.
+        //! Replaces all joint samples that were set before.
+        void SetJointSamples(const AZStd::vector<AZStd::vector<AZ::Vector3>>& positions,
+            const AZStd::vector<AZStd::vector<AZ::Quaternion>>& rotations,
+            const AZStd::vector<AZStd::vector<AZ::Vector3>>& scales);
+        void SetMorphSamples(size_t morphDataIndex, const AZStd::vector<float>& values);
+        void SetFloatSamples(size_t floatDataIndex, const AZStd::vector<float>& values);
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+#endif
+
+        size_t GetNumSamples() const;
+        float GetSampleSpacing() const;
+        void SetSampleRate(float sampleRate) override;
+        void UpdateDuration() override;
+
+        //! The number of bytes used by the samples in memory, excluding the static joint, morph and float data.
+        size_t CalcSampleMemoryUsageInBytes() const;
+
+    private:
+        //! Quantized vector track, dequantized as m_min + quantizedValue * m_step.
+        struct EMFX_API Vector3Track
+        {
+            size_t m_jointDataIndex = InvalidIndex;
+            AZ::Vector3 m_min = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_step = AZ::Vector3::CreateZero();
+        };
+
+        //! Indices of the tracks of a joint, InvalidIndex when not animated.
+        struct EMFX_API JointTracks
+        {
+            size_t m_rotationTrack = InvalidIndex;
+            size_t m_positionTrack = InvalidIndex;
+            size_t m_scaleTrack = InvalidIndex;
+        };
+
+        struct EMFX_API FloatData
+        {
+            AZStd::vector<float> m_values;
+        };
+
+        MotionData* CreateNew() const override;
+        AZStd::unique_ptr<const MotionLinkData> CreateMotionLinkData(const Actor* actor) const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+
+        //! Decodes and interpolates all tracks, writing the results into the transforms returned by getJointTransform.
+        //! Only the animated parts of the transforms are written.
+        template<typename JointTransformFunction>
+        void SampleAnimatedTracks(float sampleTime, const JointTransformFunction& getJointTransform) const;
+
+        //! Removes the tracks for which the predicate, called with the joint data index of the track, returns true and repacks the frames.
+        template<typename RotationPredicate, typename PositionPredicate, typename ScalePredicate>
+        void RemoveTracks(const RotationPredicate& removeRotationTrack, const PositionPredicate& removePositionTrack, const ScalePredicate& removeScaleTrack);
+
+        void UpdateJointTracks();
+        void UpdateSampleSpacing();
+        size_t GetFrameStride() const;
+        size_t GetPositionTrackOffset(size_t positionTrack) const;
+        size_t GetScaleTrackOffset(size_t scaleTrack) const;
+
+        bool ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings);
+
+        AZStd::vector<size_t> m_rotationTracks; //!< The joint data index of each rotation track.
+        AZStd::vector<Vector3Track> m_positionTracks;
+        AZStd::vector<Vector3Track> m_scaleTracks;
+        AZStd::vector<JointTracks> m_jointTracks; //!< Indexed by the joint data index.
+
+        //! Quantized samples, three values per track. Each frame holds the rotation tracks, followed by the position tracks and the scale tracks.
+        AZStd::vector<AZ::u16> m_frames;
+
+        AZStd::vector<FloatData> m_morphData;
+        AZStd::vector<FloatData> m_floatData;
+        size_t m_numSamples = 0;
+        float m_sampleSpacing = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "PackedSkinInfluences.h"
+#include "Mesh.h"
+#include "SkinningInfoVertexAttributeLayer.h"
+
+
+namespace EMotionFX
+{
+    // pack the influences of all vertices
+    void PackedSkinInfluences::Init(Mesh* mesh, SkinningInfoVertexAttributeLayer* layer)
+    {
+        Clear();
+
+        const uint32 numVertices = mesh->GetNumVertices();
+        const uint32* orgVerts = static_cast<const uint32*>(mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
+        if (numVertices == 0 || orgVerts == nullptr)
+        {
+            return;
+        }
+
+        // find the number of slots we need per vertex
+        m_numInfluences.resize(numVertices);
+        for (uint32 v = 0; v < numVertices; ++v)
+        {
+            const size_t numInfluences = layer->GetNumInfluences(orgVerts[v]);
+            m_numInfluences[v] = static_cast<uint16>(numInfluences);
+            m_numInfluencesPerVertex = AZStd::max(m_numInfluencesPerVertex, numInfluences);
+        }
+
+        // copy the influences in the order of the skinning info layer, so that the first influence stays the first one
+        m_boneNumbers.resize(numVertices * m_numInfluencesPerVertex, 0);
+        m_weights.resize(numVertices * m_numInfluencesPerVertex, 0.0f);
+        for (uint32 v = 0; v < numVertices; ++v)
+        {
+            const size_t offset = v * m_numInfluencesPerVertex;
+            const uint32 orgVertex = orgVerts[v];
+            const size_t numInfluences = m_numInfluences[v];
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
+                m_boneNumbers[offset + i] = influence->GetBoneNr();
+                m_weights[offset + i] = influence->GetWeight();
+            }
+        }
+    }
+
+
+    // release the packed influences
+    void PackedSkinInfluences::Clear()
+    {
+        m_boneNumbers.clear();
+        m_weights.clear();
+        m_numInfluences.clear();
+        m_numInfluencesPerVertex = 0;
+    }
+
+
+    // calculate the memory usage
+    size_t PackedSkinInfluences::CalcMemoryUsageInBytes() const
+    {
+        return sizeof(PackedSkinInfluences)
+            + m_boneNumbers.capacity() * sizeof(uint16)
+            + m_weights.capacity() * sizeof(float)
+            + m_numInfluences.capacity() * sizeof(uint16);
+    }
+} // namespace EMotionFX
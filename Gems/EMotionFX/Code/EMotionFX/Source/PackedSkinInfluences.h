@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include "EMotionFXConfig.h"
+
+
+namespace EMotionFX
+{
+    // forward declarations
+    class Mesh;
+    class SkinningInfoVertexAttributeLayer;
+
+    /**
+     * The skinning influences of a mesh, packed per vertex for the batched CPU skinning path.
+     * The skinning info layer stores the influences per original vertex in separately allocated rows, so skinning a vertex
+     * has to look up the original vertex number and follow a pointer per influence. This class resolves the original vertex numbers
+     * once and stores the local bone numbers and weights of all vertices in two flat arrays, with a fixed number of slots per vertex.
+     * The influences of a vertex keep the order of the skinning info layer, unused slots have a weight of zero.
+     */
+    class EMFX_API PackedSkinInfluences
+    {
+    public:
+        /**
+         * Pack the influences of all vertices of the given mesh.
+         * The bone numbers of the influences have to be set already, like done by the skinning deformers on reinitialization.
+         * @param mesh The mesh to pack the influences for.
+         * @param layer The skinning info layer of the mesh.
+         */
+        void Init(Mesh* mesh, SkinningInfoVertexAttributeLayer* layer);
+
+        /**
+         * Release all packed influences.
+         */
+        void Clear();
+
+        /**
+         * Get the number of vertices the influences are packed for.
+         * @result The number of vertices, which equals Mesh::GetNumVertices() of the mesh used to initialize.
+         */
+        MCORE_INLINE size_t GetNumVertices() const                                  { return m_numInfluences.size(); }
+
+        /**
+         * Get the number of influence slots per vertex, which is the maximum number of influences of any vertex in the mesh.
+         * @result The number of influence slots per vertex.
+         */
+        MCORE_INLINE size_t GetNumInfluencesPerVertex() const                       { return m_numInfluencesPerVertex; }
+
+        /**
+         * Get the number of influences of a given vertex.
+         * @param vertex The vertex number, which must be in range of [0..GetNumVertices()-1].
+         * @result The number of influences, which is at most GetNumInfluencesPerVertex().
+         */
+        MCORE_INLINE size_t GetNumInfluences(size_t vertex) const                   { return m_numInfluences[vertex]; }
+
+        /**
+         * Get the local bone numbers of the influences of a given vertex.
+         * @param vertex The vertex number, which must be in range of [0..GetNumVertices()-1].
+         * @result A pointer to the GetNumInfluences(vertex) bone numbers of the vertex.
+         */
+        MCORE_INLINE const uint16* GetBoneNumbers(size_t vertex) const              { return &m_boneNumbers[vertex * m_numInfluencesPerVertex]; }
+
+        /**
+         * Get the weights of the influences of a given vertex.
+         * @param vertex The vertex number, which must be in range of [0..GetNumVertices()-1].
+         * @result A pointer to the GetNumInfluences(vertex) weights of the vertex.
+         */
+        MCORE_INLINE const float* GetWeights(size_t vertex) const                   { return &m_weights[vertex * m_numInfluencesPerVertex]; }
+
+        /**
+         * Calculate the memory used by the packed influences.
+         * @result The memory usage in bytes.
+         */
+        size_t CalcMemoryUsageInBytes() const;
+
+    private:
+        AZStd::vector<uint16>   m_boneNumbers;                  /**< The local bone numbers, GetNumInfluencesPerVertex() per vertex. */
+        AZStd::vector<float>    m_weights;                      /**< The influence weights, GetNumInfluencesPerVertex() per vertex. */
+        AZStd::vector<uint16>   m_numInfluences;                /**< The number of used influence slots of each vertex. */
+        size_t                  m_numInfluencesPerVertex = 0;   /**< The number of influence slots per vertex. */
+    };
+} // namespace EMotionFX
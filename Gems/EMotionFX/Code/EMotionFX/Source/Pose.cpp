@@ -13,11 +13,25 @@
 #include <EMotionFX/Source/MorphSetup.h>
 #include <EMotionFX/Source/Node.h>
 #include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/PoseBlendKernels.h>
 #include <EMotionFX/Source/PoseDataFactory.h>
 #include <EMotionFX/Source/TransformData.h>
 
 namespace EMotionFX
 {
+    namespace
+    {
+        // Makes sure the local space transforms of the joints are ready before the blend kernels read the transform arrays.
+        template<typename IndexType>
+        void UpdateLocalSpaceTransforms(const Pose& pose, const IndexType* jointIndices, size_t numJoints)
+        {
+            for (size_t i = 0; i < numJoints; ++i)
+            {
+                pose.UpdateLocalSpaceTransform(jointIndices[i]);
+            }
+        }
+    } // namespace
+
     // default constructor
     Pose::Pose()
     {
@@ -833,13 +847,10 @@ namespace EMotionFX
     {
         if (m_actorInstance)
         {
-            const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
-            }
+            const AZStd::vector<uint16>& enabledNodes = m_actorInstance->GetEnabledNodes();
+            UpdateLocalSpaceTransforms(*this, enabledNodes.data(), enabledNodes.size());
+            UpdateLocalSpaceTransforms(*destPose, enabledNodes.data(), enabledNodes.size());
+            PoseBlendKernels::Blend(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), enabledNodes.data(), enabledNodes.size(), weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -861,9 +872,10 @@ namespace EMotionFX
             const size_t numNodes = m_actor->GetSkeleton()->GetNumNodes();
             for (size_t i = 0; i < numNodes; ++i)
             {
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(i), weight);
+                UpdateLocalSpaceTransform(i);
+                destPose->UpdateLocalSpaceTransform(i);
             }
+            PoseBlendKernels::Blend(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), numNodes, weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -885,6 +897,27 @@ namespace EMotionFX
     }
 
 
+    void Pose::BlendJoints(const Pose* destPose, float weight, const AZStd::vector<size_t>& jointIndices)
+    {
+        UpdateLocalSpaceTransforms(*this, jointIndices.data(), jointIndices.size());
+        UpdateLocalSpaceTransforms(*destPose, jointIndices.data(), jointIndices.size());
+        PoseBlendKernels::Blend(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), jointIndices.data(), jointIndices.size(), weight);
+        InvalidateAllModelSpaceTransforms();
+    }
+
+
+    void Pose::CopyLocalSpaceTransforms(const Pose& sourcePose, const AZStd::vector<size_t>& jointIndices)
+    {
+        UpdateLocalSpaceTransforms(sourcePose, jointIndices.data(), jointIndices.size());
+        PoseBlendKernels::Copy(m_localSpaceTransforms.data(), sourcePose.m_localSpaceTransforms.data(), jointIndices.data(), jointIndices.size());
+        for (const size_t jointIndex : jointIndices)
+        {
+            m_flags[jointIndex] |= FLAG_LOCALTRANSFORMREADY;
+        }
+        InvalidateAllModelSpaceTransforms();
+    }
+
+
     Pose& Pose::MakeRelativeTo(const Pose& other)
     {
         AZ_Assert(m_localSpaceTransforms.size() == other.m_localSpaceTransforms.size(), "Poses must be of the same size");
@@ -1090,16 +1123,14 @@ namespace EMotionFX
         if (m_actorInstance)
         {
             const TransformData* transformData = m_actorInstance->GetTransformData();
-            Pose* bindPose = transformData->GetBindPose();
-            Transform result;
+            const Pose* bindPose = transformData->GetBindPose();
 
-            const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                BlendTransformAdditiveUsingBindPose(bindPose->GetLocalSpaceTransform(nodeNr), GetLocalSpaceTransform(nodeNr), destPose->GetLocalSpaceTransform(nodeNr), weight, &result);
-                SetLocalSpaceTransform(nodeNr, result, false);
-            }
+            const AZStd::vector<uint16>& enabledNodes = m_actorInstance->GetEnabledNodes();
+            UpdateLocalSpaceTransforms(*this, enabledNodes.data(), enabledNodes.size());
+            UpdateLocalSpaceTransforms(*destPose, enabledNodes.data(), enabledNodes.size());
+            UpdateLocalSpaceTransforms(*bindPose, enabledNodes.data(), enabledNodes.size());
+            PoseBlendKernels::BlendAdditive(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), bindPose->m_localSpaceTransforms.data(),
+                enabledNodes.data(), enabledNodes.size(), weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
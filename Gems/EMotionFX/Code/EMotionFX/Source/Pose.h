@@ -138,6 +138,23 @@ namespace EMotionFX
          */
         void BlendAdditiveUsingBindPose(const Pose* destPose, float weight);
 
+        /**
+         * Blend the local space transforms of the given joints towards the destination pose.
+         * This invalidates all model space transforms.
+         * @param destPose The pose to blend towards.
+         * @param weight The blend weight, between 0 and 1.
+         * @param jointIndices The joints to blend.
+         */
+        void BlendJoints(const Pose* destPose, float weight, const AZStd::vector<size_t>& jointIndices);
+
+        /**
+         * Copy the local space transforms of the given joints from another pose.
+         * This invalidates all model space transforms, rather than walking the child joints of every copied joint.
+         * @param sourcePose The pose to copy the transforms from.
+         * @param jointIndices The joints to copy.
+         */
+        void CopyLocalSpaceTransforms(const Pose& sourcePose, const AZStd::vector<size_t>& jointIndices);
+
         /**
          * Blend this pose into a specified destination pose.
          * @param destPose The destination pose to blend into.
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/algorithm.h>
+#include <EMotionFX/Source/PoseBlendKernels.h>
+#include <EMotionFX/Source/SimdQuaternion.h>
+
+namespace EMotionFX
+{
+    namespace PoseBlendKernels
+    {
+        namespace
+        {
+            using AZ::Simd::Vec4;
+            using SimdQuaternion::Lanes;
+
+            AZ_FORCE_INLINE Lanes LoadRotations(const Transform& t0, const Transform& t1, const Transform& t2, const Transform& t3)
+            {
+                return SimdQuaternion::Load(t0.m_rotation, t1.m_rotation, t2.m_rotation, t3.m_rotation);
+            }
+
+            AZ_FORCE_INLINE void StoreRotations(const Lanes& lanes, Transform& t0, Transform& t1, Transform& t2, Transform& t3)
+            {
+                SimdQuaternion::Store(lanes, t0.m_rotation, t1.m_rotation, t2.m_rotation, t3.m_rotation);
+            }
+
+            //! Runs a kernel over blocks of four joints.
+            //! The last block is padded by repeating its last joint. The padded lanes compute the same rotation as the lane they
+            //! repeat, which is harmless as all the lanes are loaded before any is stored, while the per joint part of the kernel
+            //! only runs for the actual joints.
+            template<typename JointIndexFunction, typename BlockFunction>
+            AZ_FORCE_INLINE void ForEachBlock(size_t numJoints, const JointIndexFunction& jointIndex, const BlockFunction& blockFunction)
+            {
+                for (size_t i = 0; i < numJoints; i += 4)
+                {
+                    const size_t last = numJoints - 1;
+                    const size_t joints[4] = {
+                        jointIndex(i),
+                        jointIndex(AZStd::min(i + 1, last)),
+                        jointIndex(AZStd::min(i + 2, last)),
+                        jointIndex(AZStd::min(i + 3, last)) };
+                    blockFunction(joints, AZStd::min<size_t>(4, numJoints - i));
+                }
+            }
+
+            template<typename JointIndexFunction>
+            void BlendImpl(Transform* transforms, const Transform* destTransforms, size_t numJoints, float weight, const JointIndexFunction& jointIndex)
+            {
+                const Vec4::FloatType t = Vec4::Splat(weight);
+                const Vec4::FloatType oneMinusT = Vec4::Splat(1.0f - weight);
+
+                ForEachBlock(numJoints, jointIndex, [=](const size_t (&joints)[4], size_t numActiveJoints)
+                {
+                    const Lanes source = LoadRotations(transforms[joints[0]], transforms[joints[1]], transforms[joints[2]], transforms[joints[3]]);
+                    const Lanes dest = LoadRotations(destTransforms[joints[0]], destTransforms[joints[1]], destTransforms[joints[2]], destTransforms[joints[3]]);
+                    StoreRotations(SimdQuaternion::NLerp(source, dest, t, oneMinusT), transforms[joints[0]], transforms[joints[1]], transforms[joints[2]], transforms[joints[3]]);
+
+                    for (size_t i = 0; i < numActiveJoints; ++i)
+                    {
+                        Transform& transform = transforms[joints[i]];
+                        const Transform& destTransform = destTransforms[joints[i]];
+                        transform.m_position += (destTransform.m_position - transform.m_position) * weight;
+                        EMFX_SCALECODE
+                        (
+                            transform.m_scale += (destTransform.m_scale - transform.m_scale) * weight;
+                        )
+                    }
+                });
+            }
+
+            template<typename JointIndexFunction>
+            void BlendAdditiveImpl(Transform* transforms, const Transform* destTransforms, const Transform* baseTransforms,
+                size_t numJoints, float weight, const JointIndexFunction& jointIndex)
+            {
+                const Vec4::FloatType t = Vec4::Splat(weight);
+                const Vec4::FloatType oneMinusT = Vec4::Splat(1.0f - weight);
+
+                ForEachBlock(numJoints, jointIndex, [=](const size_t (&joints)[4], size_t numActiveJoints)
+                {
+                    const Lanes source = LoadRotations(transforms[joints[0]], transforms[joints[1]], transforms[joints[2]], transforms[joints[3]]);
+                    const Lanes dest = LoadRotations(destTransforms[joints[0]], destTransforms[joints[1]], destTransforms[joints[2]], destTransforms[joints[3]]);
+                    const Lanes base = LoadRotations(baseTransforms[joints[0]], baseTransforms[joints[1]], baseTransforms[joints[2]], baseTransforms[joints[3]]);
+
+                    // Apply the change from the base to the weighted destination rotation.
+                    const Lanes delta = SimdQuaternion::Multiply(SimdQuaternion::Conjugate(base), SimdQuaternion::NLerp(base, dest, t, oneMinusT));
+                    StoreRotations(SimdQuaternion::Normalize(SimdQuaternion::Multiply(source, delta)), transforms[joints[0]], transforms[joints[1]], transforms[joints[2]], transforms[joints[3]]);
+
+                    for (size_t i = 0; i < numActiveJoints; ++i)
+                    {
+                        Transform& transform = transforms[joints[i]];
+                        const Transform& destTransform = destTransforms[joints[i]];
+                        const Transform& baseTransform = baseTransforms[joints[i]];
+                        transform.m_position += (destTransform.m_position - baseTransform.m_position) * weight;
+                        EMFX_SCALECODE
+                        (
+                            transform.m_scale += (destTransform.m_scale - baseTransform.m_scale) * weight;
+                        )
+                    }
+                });
+            }
+        } // namespace
+
+        void Blend(Transform* transforms, const Transform* destTransforms, size_t numJoints, float weight)
+        {
+            BlendImpl(transforms, destTransforms, numJoints, weight, [](size_t i) { return i; });
+        }
+
+        void Blend(Transform* transforms, const Transform* destTransforms, const uint16* jointIndices, size_t numJoints, float weight)
+        {
+            BlendImpl(transforms, destTransforms, numJoints, weight, [jointIndices](size_t i) { return static_cast<size_t>(jointIndices[i]); });
+        }
+
+        void Blend(Transform* transforms, const Transform* destTransforms, const size_t* jointIndices, size_t numJoints, float weight)
+        {
+            BlendImpl(transforms, destTransforms, numJoints, weight, [jointIndices](size_t i) { return jointIndices[i]; });
+        }
+
+        void BlendAdditive(Transform* transforms, const Transform* destTransforms, const Transform* baseTransforms, size_t numJoints, float weight)
+        {
+            BlendAdditiveImpl(transforms, destTransforms, baseTransforms, numJoints, weight, [](size_t i) { return i; });
+        }
+
+        void BlendAdditive(Transform* transforms, const Transform* destTransforms, const Transform* baseTransforms,
+            const uint16* jointIndices, size_t numJoints, float weight)
+        {
+            BlendAdditiveImpl(transforms, destTransforms, baseTransforms, numJoints, weight,
+                [jointIndices](size_t i) { return static_cast<size_t>(jointIndices[i]); });
+        }
+
+        void Copy(Transform* transforms, const Transform* sourceTransforms, const size_t* jointIndices, size_t numJoints)
+        {
+            for (size_t i = 0; i < numJoints; ++i)
+            {
+                transforms[jointIndices[i]] = sourceTransforms[jointIndices[i]];
+            }
+        }
+    } // namespace PoseBlendKernels
+} // namespace EMotionFX
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/Transform.h>
+
+namespace EMotionFX
+{
+    //! SIMD kernels blending the local space transforms of poses.
+    //! Joints are processed four at a time. The rotations of the four joints are transposed into structure of arrays
+    //! registers (x, y, z and w of four quaternions per register), so the dot products and normalizations run for four
+    //! joints at once instead of once per joint. Positions and scales are blended in place, their layout already maps to a register.
+    //! The kernels only touch the transform arrays, the callers are responsible for making sure the local space transforms
+    //! are up to date and for invalidating the model space transforms afterwards.
+    //! Each kernel either processes the first numJoints transforms, or the joints in the given index list.
+    namespace PoseBlendKernels
+    {
+        //! Same as Transform::Blend for every joint.
+        EMFX_API void Blend(Transform* transforms, const Transform* destTransforms, size_t numJoints, float weight);
+        EMFX_API void Blend(Transform* transforms, const Transform* destTransforms, const uint16* jointIndices, size_t numJoints, float weight);
+        EMFX_API void Blend(Transform* transforms, const Transform* destTransforms, const size_t* jointIndices, size_t numJoints, float weight);
+
+        //! Same as Transform::BlendAdditive for every joint, using baseTransforms as the original transforms.
+        EMFX_API void BlendAdditive(Transform* transforms, const Transform* destTransforms, const Transform* baseTransforms, size_t numJoints, float weight);
+        EMFX_API void BlendAdditive(Transform* transforms, const Transform* destTransforms, const Transform* baseTransforms,
+            const uint16* jointIndices, size_t numJoints, float weight);
+
+        //! Copies the transforms of the joints in the index list.
+        EMFX_API void Copy(Transform* transforms, const Transform* sourceTransforms, const size_t* jointIndices, size_t numJoints);
+    } // namespace PoseBlendKernels
+} // namespace EMotionFX
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/SimdMath.h>
+
+namespace EMotionFX
+{
+    //! Quaternion math on four quaternions at once, used by the pose blending and motion sampling kernels.
+    namespace SimdQuaternion
+    {
+        using AZ::Simd::Vec4;
+
+        //! Four quaternions in structure of arrays form, one component per register.
+        struct Lanes
+        {
+            Vec4::FloatType m_x;
+            Vec4::FloatType m_y;
+            Vec4::FloatType m_z;
+            Vec4::FloatType m_w;
+        };
+
+        AZ_FORCE_INLINE Lanes Load(const AZ::Quaternion& q0, const AZ::Quaternion& q1, const AZ::Quaternion& q2, const AZ::Quaternion& q3)
+        {
+            const Vec4::FloatType rows[4] = { q0.GetSimdValue(), q1.GetSimdValue(), q2.GetSimdValue(), q3.GetSimdValue() };
+            Vec4::FloatType columns[4];
+            Vec4::Mat4x4Transpose(rows, columns);
+            return { columns[0], columns[1], columns[2], columns[3] };
+        }
+
+        AZ_FORCE_INLINE void Store(const Lanes& lanes, AZ::Quaternion& q0, AZ::Quaternion& q1, AZ::Quaternion& q2, AZ::Quaternion& q3)
+        {
+            const Vec4::FloatType columns[4] = { lanes.m_x, lanes.m_y, lanes.m_z, lanes.m_w };
+            Vec4::FloatType rows[4];
+            Vec4::Mat4x4Transpose(columns, rows);
+            q0 = AZ::Quaternion(rows[0]);
+            q1 = AZ::Quaternion(rows[1]);
+            q2 = AZ::Quaternion(rows[2]);
+            q3 = AZ::Quaternion(rows[3]);
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Dot(const Lanes& a, const Lanes& b)
+        {
+            return Vec4::Madd(a.m_w, b.m_w, Vec4::Madd(a.m_z, b.m_z, Vec4::Madd(a.m_y, b.m_y, Vec4::Mul(a.m_x, b.m_x))));
+        }
+
+        AZ_FORCE_INLINE Lanes Normalize(const Lanes& q)
+        {
+            const Vec4::FloatType invLength = Vec4::SqrtInv(Dot(q, q));
+            return { Vec4::Mul(q.m_x, invLength), Vec4::Mul(q.m_y, invLength), Vec4::Mul(q.m_z, invLength), Vec4::Mul(q.m_w, invLength) };
+        }
+
+        AZ_FORCE_INLINE Lanes Conjugate(const Lanes& q)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            return { Vec4::Sub(zero, q.m_x), Vec4::Sub(zero, q.m_y), Vec4::Sub(zero, q.m_z), q.m_w };
+        }
+
+        //! Same as AZ::Quaternion::operator*.
+        AZ_FORCE_INLINE Lanes Multiply(const Lanes& a, const Lanes& b)
+        {
+            Lanes result;
+            result.m_x = Vec4::Sub(Vec4::Madd(a.m_y, b.m_z, Vec4::Madd(a.m_x, b.m_w, Vec4::Mul(a.m_w, b.m_x))), Vec4::Mul(a.m_z, b.m_y));
+            result.m_y = Vec4::Sub(Vec4::Madd(a.m_z, b.m_x, Vec4::Madd(a.m_y, b.m_w, Vec4::Mul(a.m_w, b.m_y))), Vec4::Mul(a.m_x, b.m_z));
+            result.m_z = Vec4::Sub(Vec4::Madd(a.m_x, b.m_y, Vec4::Madd(a.m_z, b.m_w, Vec4::Mul(a.m_w, b.m_z))), Vec4::Mul(a.m_y, b.m_x));
+            result.m_w = Vec4::Sub(Vec4::Mul(a.m_w, b.m_w), Vec4::Madd(a.m_z, b.m_z, Vec4::Madd(a.m_y, b.m_y, Vec4::Mul(a.m_x, b.m_x))));
+            return result;
+        }
+
+        //! Same as MCore::NLerp and AZ::Quaternion::NLerp, interpolating along the shortest path.
+        AZ_FORCE_INLINE Lanes NLerp(const Lanes& a, const Lanes& b, Vec4::FloatArgType t, Vec4::FloatArgType oneMinusT)
+        {
+            const Vec4::FloatType flip = Vec4::CmpLt(Dot(a, b), Vec4::ZeroFloat());
+            const Vec4::FloatType signedT = Vec4::Select(Vec4::Sub(Vec4::ZeroFloat(), t), t, flip);
+
+            Lanes result;
+            result.m_x = Vec4::Madd(a.m_x, oneMinusT, Vec4::Mul(b.m_x, signedT));
+            result.m_y = Vec4::Madd(a.m_y, oneMinusT, Vec4::Mul(b.m_y, signedT));
+            result.m_z = Vec4::Madd(a.m_z, oneMinusT, Vec4::Mul(b.m_z, signedT));
+            result.m_w = Vec4::Madd(a.m_w, oneMinusT, Vec4::Mul(b.m_w, signedT));
+            return Normalize(result);
+        }
+    } // namespace SimdQuaternion
+} // namespace EMotionFX
@@ -7,8 +7,13 @@
  */
 
 // include the required headers
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Math/SimdMath.h>
 #include "EMotionFXConfig.h"
 #include "SoftSkinDeformer.h"
+#include "SoftSkinManager.h"
+#include "EMotionFXManager.h"
 #include "Mesh.h"
 #include "Node.h"
 #include "SubMesh.h"
@@ -28,6 +33,8 @@ namespace EMotionFX
     SoftSkinDeformer::SoftSkinDeformer(Mesh* mesh)
         : MeshDeformer(mesh)
     {
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        m_useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
     }
 
 
@@ -69,6 +76,7 @@ namespace EMotionFX
         // copy the bone info (for precalc/optimization reasons)
         result->m_nodeNumbers    = m_nodeNumbers;
         result->m_boneMatrices   = m_boneMatrices;
+        result->m_packedInfluences = m_packedInfluences;
 
         // return the result
         return result;
@@ -93,17 +101,112 @@ namespace EMotionFX
             m_boneMatrices[i] = skinningMatrices[nodeIndex];
         }
 
-        // find the skinning layer
-        SkinningInfoVertexAttributeLayer* layer = (SkinningInfoVertexAttributeLayer*)m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID);
-        AZ_Assert(layer, "Cannot find skinning info");
+        // the packed influences are only available after reinitializing the deformer for this mesh
+        const uint32 numVertices = m_mesh->GetNumVertices();
+        m_useBatchedSkinning = GetSoftSkinManager().GetUseBatchedSkinning() && m_packedInfluences.GetNumVertices() == numVertices;
 
-        // Perform the skinning.
+        // skin small meshes directly, there is nothing to gain from splitting them up
+        const AZ::u32 numBatches = aznumeric_caster(ceilf(aznumeric_cast<float>(numVertices) / aznumeric_cast<float>(s_numVerticesPerBatch)));
+        if (numBatches <= 1 || !GetSoftSkinManager().GetUseMultiThreadedSkinning())
+        {
+            SkinVertexBatch(0, numVertices);
+        }
+        else if (m_useTaskGraph && !m_taskGraph.IsEmpty())
+        {
+            // Skin the vertices by executing the task graph.
+            AZ::TaskGraphEvent finishedEvent;
+            m_taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else
+        {
+            AZ::JobCompletion jobCompletion;
+
+            // Split up the skinned vertices into batches.
+            for (AZ::u32 batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+            {
+                const AZ::u32 startVertex = batchIndex * s_numVerticesPerBatch;
+                const AZ::u32 endVertex = AZStd::min(startVertex + s_numVerticesPerBatch, numVertices);
+
+                // Create a job for every batch and skin them simultaneously.
+                AZ::JobContext* jobContext = nullptr;
+                AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex]()
+                    {
+                        SkinVertexBatch(startVertex, endVertex);
+                    }, /*isAutoDelete=*/true, jobContext);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        }
+    }
+
+
+    // skin a batch of vertices
+    void SoftSkinDeformer::SkinVertexBatch(uint32 startVertex, uint32 endVertex)
+    {
         AZ::Vector3* __restrict positions    = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
         AZ::Vector3* __restrict normals      = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
         AZ::Vector4* __restrict tangents     = static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
         AZ::Vector3* __restrict bitangents   = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+
+        if (m_useBatchedSkinning)
+        {
+            SkinVertexRangeBatched(startVertex, endVertex, positions, normals, tangents, bitangents);
+            return;
+        }
+
+        // find the skinning layer
+        SkinningInfoVertexAttributeLayer* layer = (SkinningInfoVertexAttributeLayer*)m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID);
+        AZ_Assert(layer, "Cannot find skinning info");
+
+        // Perform the skinning.
         AZ::u32*     __restrict orgVerts     = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
-        SkinVertexRange(0, m_mesh->GetNumVertices(), positions, normals, tangents, bitangents, orgVerts, layer);
+        SkinVertexRange(startVertex, endVertex, positions, normals, tangents, bitangents, orgVerts, layer);
+    }
+
+
+    void SoftSkinDeformer::SkinVertexRangeBatched(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents)
+    {
+        using AZ::Simd::Vec4;
+
+        // bitangents are only skinned together with the tangents, like in the per influence path
+        const AZ::Matrix3x4* boneMatrices = m_boneMatrices.data();
+        const bool skinTangents = (tangents != nullptr);
+        const bool skinBitangents = (tangents && bitangents);
+        for (uint32 v = startVertex; v < endVertex; ++v)
+        {
+            // blend the skinning matrices, which is the same as blending the skinned attributes, as the skinning is linear
+            const size_t numInfluences = m_packedInfluences.GetNumInfluences(v);
+            const uint16* boneNumbers = m_packedInfluences.GetBoneNumbers(v);
+            const float* weights = m_packedInfluences.GetWeights(v);
+            Vec4::FloatType row0 = Vec4::ZeroFloat();
+            Vec4::FloatType row1 = Vec4::ZeroFloat();
+            Vec4::FloatType row2 = Vec4::ZeroFloat();
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                const Vec4::FloatType* rows = boneMatrices[boneNumbers[i]].GetSimdValues();
+                const Vec4::FloatType weight = Vec4::Splat(weights[i]);
+                row0 = Vec4::Madd(rows[0], weight, row0);
+                row1 = Vec4::Madd(rows[1], weight, row1);
+                row2 = Vec4::Madd(rows[2], weight, row2);
+            }
+            const AZ::Matrix3x4 skinMatrix = AZ::Matrix3x4::CreateFromRows(AZ::Vector4(row0), AZ::Vector4(row1), AZ::Vector4(row2));
+
+            // output the skinned values
+            positions[v] = skinMatrix * positions[v];
+            normals[v] = skinMatrix.TransformVector(normals[v]);
+            if (skinTangents)
+            {
+                tangents[v].Set(skinMatrix.TransformVector(tangents[v].GetAsVector3()), tangents[v].GetW());
+            }
+            if (skinBitangents)
+            {
+                bitangents[v] = skinMatrix.TransformVector(bitangents[v]);
+            }
+        }
     }
 
 
@@ -252,5 +355,32 @@ namespace EMotionFX
                 influence->SetBoneNr(static_cast<uint16>(boneIndex));
             }
         }
+
+        // pack the influences now that the bone numbers are known
+        m_packedInfluences.Init(m_mesh, skinningLayer);
+
+        m_taskGraph.Reset();
+        if (m_useTaskGraph)
+        {
+            // Prepare the task graph
+            // Split up the to be skinned vertices into batches. As the mesh does not change at runtime, the task graph can
+            // be prepared at init time and be reused at runtime.
+            const uint32 numVertices = m_mesh->GetNumVertices();
+            const AZ::u32 numBatches = aznumeric_caster(ceilf(aznumeric_cast<float>(numVertices) / aznumeric_cast<float>(s_numVerticesPerBatch)));
+            for (AZ::u32 batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+            {
+                const AZ::u32 startVertex = batchIndex * s_numVerticesPerBatch;
+                const AZ::u32 endVertex = AZStd::min(startVertex + s_numVerticesPerBatch, numVertices);
+
+                // Create a task for every batch and skin them simultaneously.
+                AZ::TaskDescriptor taskDescriptor{"SoftSkinVertexRange", "Animation"};
+                m_taskGraph.AddTask(
+                    taskDescriptor,
+                    [this, startVertex, endVertex]()
+                    {
+                        SkinVertexBatch(startVertex, endVertex);
+                    });
+            }
+        }
     }
 } // namespace EMotionFX
@@ -11,8 +11,10 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/Task/TaskGraph.h>
 #include "EMotionFXConfig.h"
 #include "MeshDeformer.h"
+#include "PackedSkinInfluences.h"
 
 
 namespace EMotionFX
@@ -117,9 +119,23 @@ namespace EMotionFX
         MCORE_INLINE void ReserveLocalBones(size_t numBones)                { m_nodeNumbers.reserve(numBones); m_boneMatrices.reserve(numBones); }
 
 
+        /**
+         * Get the skinning influences packed per vertex, which are used by the batched skinning path.
+         * @result The packed skinning influences, which are empty until the deformer got reinitialized.
+         */
+        MCORE_INLINE const PackedSkinInfluences& GetPackedInfluences() const   { return m_packedInfluences; }
+
+
     protected:
         AZStd::vector<AZ::Matrix3x4>    m_boneMatrices;
         AZStd::vector<size_t>           m_nodeNumbers;
+        PackedSkinInfluences            m_packedInfluences;             /**< The influences packed per vertex, used by the batched skinning path. */
+        bool                            m_useBatchedSkinning = true;    /**< Use the batched skinning path during the current update? */
+
+        //! Number of vertices per batch/job used for multi-threaded software skinning.
+        static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
+        AZ::TaskGraph m_taskGraph;
+        bool m_useTaskGraph = true;
 
         /**
          * Default constructor.
@@ -144,5 +160,20 @@ namespace EMotionFX
         }
 
         void SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
+
+        /**
+         * Skin a range of vertices using the packed influences.
+         * The skinning matrices of the influences of a vertex are blended first, so that every vertex attribute only gets transformed once.
+         * @param startVertex The first vertex to skin.
+         * @param endVertex The vertex after the last vertex to skin.
+         */
+        void SkinVertexRangeBatched(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents);
+
+        /**
+         * Skin a batch of vertices of the mesh, using either the batched or the per influence skinning path.
+         * @param startVertex The first vertex to skin.
+         * @param endVertex The vertex after the last vertex to skin.
+         */
+        void SkinVertexBatch(uint32 startVertex, uint32 endVertex);
     };
 } // namespace EMotionFX
@@ -36,4 +36,28 @@ namespace EMotionFX
     {
         return SoftSkinDeformer::Create(mesh);
     }
+
+
+    void SoftSkinManager::SetUseBatchedSkinning(bool enabled)
+    {
+        m_useBatchedSkinning = enabled;
+    }
+
+
+    bool SoftSkinManager::GetUseBatchedSkinning() const
+    {
+        return m_useBatchedSkinning;
+    }
+
+
+    void SoftSkinManager::SetUseMultiThreadedSkinning(bool enabled)
+    {
+        m_useMultiThreadedSkinning = enabled;
+    }
+
+
+    bool SoftSkinManager::GetUseMultiThreadedSkinning() const
+    {
+        return m_useMultiThreadedSkinning;
+    }
 } // namespace EMotionFX
@@ -50,7 +50,40 @@ namespace EMotionFX
          */
         SoftSkinDeformer* CreateDeformer(Mesh* mesh);
 
+        /**
+         * Enable or disable the batched CPU skinning path of the skinning deformers.
+         * The batched path skins the vertices using influences that are packed per vertex when the deformer gets reinitialized,
+         * and blends the skinning matrices or dual quaternions of the influences using SIMD before transforming the vertex once.
+         * When disabled, the vertices are skinned one influence at a time, directly from the skinning info layer.
+         * This can be changed at runtime and is enabled on default.
+         * @param enabled Set to true to use the batched skinning path, false to use the per influence path.
+         */
+        void SetUseBatchedSkinning(bool enabled);
+
+        /**
+         * Check if the skinning deformers use the batched CPU skinning path.
+         * @result Returns true when the batched skinning path is used.
+         */
+        bool GetUseBatchedSkinning() const;
+
+        /**
+         * Enable or disable splitting the skinning of large meshes into jobs that run in parallel.
+         * Meshes with only a single batch worth of vertices are always skinned on the calling thread.
+         * This can be changed at runtime and is enabled on default.
+         * @param enabled Set to true to skin large meshes using multiple jobs, false to skin all meshes on the calling thread.
+         */
+        void SetUseMultiThreadedSkinning(bool enabled);
+
+        /**
+         * Check if the skinning of large meshes is split into jobs.
+         * @result Returns true when large meshes are skinned using multiple jobs.
+         */
+        bool GetUseMultiThreadedSkinning() const;
+
     private:
+        bool m_useBatchedSkinning = true;           /**< Use the batched skinning path? */
+        bool m_useMultiThreadedSkinning = true;     /**< Split the skinning of large meshes into jobs? */
+
         /**
          * The constructor.
          * When constructed, the class checks if SSE is available on the hardware.
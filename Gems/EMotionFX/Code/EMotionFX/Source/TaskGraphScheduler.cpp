@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "TaskGraphScheduler.h"
+#include "ActorManager.h"
+#include "ActorInstance.h"
+#include "Attachment.h"
+#include "EMotionFXManager.h"
+#include <EMotionFX/Source/Allocators.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Task/TaskExecutor.h>
+
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(TaskGraphScheduler, ActorUpdateAllocator, 0)
+
+    // constructor
+    TaskGraphScheduler::TaskGraphScheduler(AZ::TaskExecutor* executor)
+        : ActorUpdateScheduler()
+        , m_executor(executor)
+    {
+    }
+
+
+    // destructor
+    TaskGraphScheduler::~TaskGraphScheduler()
+    {
+    }
+
+
+    // create
+    TaskGraphScheduler* TaskGraphScheduler::Create(AZ::TaskExecutor* executor)
+    {
+        return aznew TaskGraphScheduler(executor);
+    }
+
+
+    // clear the schedule
+    void TaskGraphScheduler::Clear()
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_batches.clear();
+        m_taskGraph.Reset();
+        m_isDirty = true;
+    }
+
+
+    // log it, for debugging purposes
+    void TaskGraphScheduler::Print()
+    {
+        const size_t numBatches = m_batches.size();
+        for (size_t i = 0; i < numBatches; ++i)
+        {
+            AZ_Printf("EMotionFX", "BATCH %.3zu - %zu", i, m_batches[i].m_items.size());
+        }
+
+        AZ_Printf("EMotionFX", "---------");
+    }
+
+
+    void TaskGraphScheduler::RecursiveInsertActorInstance([[maybe_unused]] ActorInstance* actorInstance, [[maybe_unused]] size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_isDirty = true;
+    }
+
+
+    void TaskGraphScheduler::RecursiveRemoveActorInstance([[maybe_unused]] ActorInstance* actorInstance, [[maybe_unused]] size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_isDirty = true;
+    }
+
+
+    size_t TaskGraphScheduler::RemoveActorInstance([[maybe_unused]] ActorInstance* actorInstance, [[maybe_unused]] size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_isDirty = true;
+        return 0;
+    }
+
+
+    void TaskGraphScheduler::UpdateSchedule()
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        if (m_isDirty)
+        {
+            RebuildSchedule();
+        }
+    }
+
+
+    void TaskGraphScheduler::RecursiveAddToBatch(ActorInstance* actorInstance, Batch& outBatch)
+    {
+        const size_t itemIndex = outBatch.m_items.size();
+        outBatch.m_items.push_back({ actorInstance, 0 });
+
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment)
+            {
+                RecursiveAddToBatch(attachment, outBatch);
+            }
+        }
+
+        outBatch.m_items[itemIndex].m_subtreeEnd = outBatch.m_items.size();
+    }
+
+
+    void TaskGraphScheduler::RebuildSchedule()
+    {
+        AZ_PROFILE_SCOPE(Animation, "TaskGraphScheduler::RebuildSchedule");
+
+        m_taskGraph.Reset();
+        m_batches.clear();
+        m_isDirty = false;
+
+        // flatten the trees of all root actor instances, parents before their attachments
+        const ActorManager& actorManager = GetActorManager();
+        const size_t numRootActorInstances = actorManager.GetNumRootActorInstances();
+        Batch allItems;
+        allItems.m_items.reserve(actorManager.GetNumActorInstances());
+        AZStd::vector<size_t> treeStarts;
+        treeStarts.reserve(numRootActorInstances + 1);
+        for (size_t i = 0; i < numRootActorInstances; ++i)
+        {
+            treeStarts.emplace_back(allItems.m_items.size());
+            RecursiveAddToBatch(actorManager.GetRootActorInstance(i), allItems);
+        }
+        treeStarts.emplace_back(allItems.m_items.size());
+
+        // use one batch per worker thread, as the number of threads EMotion FX is configured with is meant for its own job based
+        // schedulers and defaults to a single thread. each batch uses its own thread index, so grow the thread data to match.
+        const AZ::TaskExecutor& executor = m_executor ? *m_executor : AZ::TaskExecutor::Instance();
+        const size_t numItems = allItems.m_items.size();
+        const size_t numBatches = AZStd::min(static_cast<size_t>(executor.GetThreadCount()), numRootActorInstances);
+        if (numBatches == 0)
+        {
+            return;
+        }
+        GetEMotionFX().GrowNumThreads(static_cast<uint32>(numBatches));
+
+        // distribute the trees over the batches, never splitting a tree
+        m_batches.resize(numBatches);
+        size_t treeIndex = 0;
+        for (size_t batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+        {
+            const size_t batchStart = treeStarts[treeIndex];
+            const size_t targetEnd = (numItems * (batchIndex + 1)) / numBatches;
+            const size_t numTreesLeftForOtherBatches = numBatches - batchIndex - 1;
+            do
+            {
+                ++treeIndex;
+            } while (treeIndex < numRootActorInstances - numTreesLeftForOtherBatches && treeStarts[treeIndex] < targetEnd);
+            const size_t batchEnd = treeStarts[treeIndex];
+
+            Batch& batch = m_batches[batchIndex];
+            batch.m_items.assign(allItems.m_items.begin() + batchStart, allItems.m_items.begin() + batchEnd);
+            for (BatchItem& item : batch.m_items)
+            {
+                item.m_subtreeEnd -= batchStart;
+            }
+        }
+        AZ_Assert(treeIndex == numRootActorInstances, "Expected all actor instance trees to be scheduled.");
+
+        // create a task per batch, the tasks read the time passed from the scheduler so that the graph can be resubmitted every update
+        const AZ::TaskDescriptor taskDescriptor{ "TaskGraphScheduler::ExecuteBatch", "Animation" };
+        for (size_t batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+        {
+            m_taskGraph.AddTask(taskDescriptor, [this, batchIndex]()
+            {
+                ExecuteBatch(batchIndex);
+            });
+        }
+    }
+
+
+    void TaskGraphScheduler::ExecuteBatch(size_t batchIndex)
+    {
+        AZ_PROFILE_SCOPE(Animation, "TaskGraphScheduler::ExecuteBatch");
+
+        const float timePassedInSeconds = m_timePassedInSeconds;
+        const uint32 threadIndex = static_cast<uint32>(batchIndex);
+        size_t numUpdated = 0;
+        size_t numVisible = 0;
+        size_t numSampled = 0;
+
+        const AZStd::vector<BatchItem>& items = m_batches[batchIndex].m_items;
+        const size_t numItems = items.size();
+        for (size_t i = 0; i < numItems; )
+        {
+            ActorInstance* actorInstance = items[i].m_actorInstance;
+
+            // skip disabled actor instances, including their attachments
+            if (actorInstance->GetIsEnabled() == false)
+            {
+                i = items[i].m_subtreeEnd;
+                continue;
+            }
+
+            actorInstance->SetThreadIndex(threadIndex);
+            numUpdated++;
+
+            const bool isVisible = actorInstance->GetIsVisible();
+            if (isVisible)
+            {
+                numVisible++;
+            }
+
+            // check if we want to sample motions
+            bool sampleMotions = false;
+            actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+            if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+            {
+                sampleMotions = true;
+                actorInstance->SetMotionSamplingTimer(0.0f);
+
+                if (isVisible)
+                {
+                    numSampled++;
+                }
+            }
+
+            // update the actor instance
+            actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+            ++i;
+        }
+
+        // add the stats once per batch, rather than once per actor instance
+        m_numUpdated.Add(numUpdated);
+        m_numVisible.Add(numVisible);
+        m_numSampled.Add(numSampled);
+    }
+
+
+    // execute the schedule
+    void TaskGraphScheduler::Execute(float timePassedInSeconds)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        if (m_isDirty)
+        {
+            RebuildSchedule();
+        }
+
+        // reset stats
+        m_numUpdated.SetValue(0);
+        m_numVisible.SetValue(0);
+        m_numSampled.SetValue(0);
+
+        if (m_batches.empty())
+        {
+            return;
+        }
+
+        // propagate root actor instance visibility to their attachments
+        const ActorManager& actorManager = GetActorManager();
+        const size_t numRootActorInstances = actorManager.GetNumRootActorInstances();
+        for (size_t i = 0; i < numRootActorInstances; ++i)
+        {
+            ActorInstance* rootInstance = actorManager.GetRootActorInstance(i);
+            if (rootInstance->GetIsEnabled() == false)
+            {
+                continue;
+            }
+
+            rootInstance->RecursiveSetIsVisible(rootInstance->GetIsVisible());
+        }
+
+        // execute all batches in parallel and wait for them to finish
+        m_timePassedInSeconds = timePassedInSeconds;
+        AZ::TaskGraphEvent finishedEvent;
+        if (m_executor)
+        {
+            m_taskGraph.SubmitOnExecutor(*m_executor, &finishedEvent);
+        }
+        else
+        {
+            m_taskGraph.Submit(&finishedEvent);
+        }
+        finishedEvent.Wait();
+    }
+}   // namespace EMotionFX
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// include the required headers
+#include "EMotionFXConfig.h"
+#include "ActorUpdateScheduler.h"
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <MCore/Source/MultiThreadManager.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+}
+
+namespace EMotionFX
+{
+    // forward declarations
+    class ActorInstance;
+
+
+    /**
+     * The task graph scheduler.
+     * This scheduler updates the actor instances on the task graph, in parallel batches.
+     * An attachment has to be updated after the actor instance it is attached to. The schedule therefore groups each root actor instance
+     * together with all of its attachments, so that these trees can be updated independently of each other. The trees are distributed over
+     * one batch per worker thread of the task executor, balanced on the number of actor instances, and each batch updates its trees in order, parents first.
+     * The schedule and the task graph are only rebuilt when actor instances or attachments are added or removed, so executing the schedule
+     * doesn't allocate any memory.
+     * Each batch uses its own thread index, so the EMotion FX thread data is grown to the number of batches when the schedule is rebuilt.
+     */
+    class EMFX_API TaskGraphScheduler
+        : public ActorUpdateScheduler
+    {
+        AZ_CLASS_ALLOCATOR_DECL
+    public:
+        /**
+         * The unique type ID of this scheduler, as returned by the GetType() method.
+         */
+        enum
+        {
+            TYPE_ID = 0x00000003
+        };
+
+        /**
+         * An actor instance inside a batch.
+         */
+        struct EMFX_API BatchItem
+        {
+            ActorInstance*  m_actorInstance = nullptr;  /**< The actor instance to update. */
+            size_t          m_subtreeEnd = 0;           /**< The index of the first item after the attachments of this actor instance, used to skip the attachments of disabled actor instances. */
+        };
+
+        /**
+         * A batch of actor instance trees, updated on a single task.
+         * Each actor instance is directly followed by its attachments.
+         */
+        struct EMFX_API Batch
+        {
+            AZStd::vector<BatchItem>    m_items;
+        };
+
+        /**
+         * The constructor.
+         * @param executor The task executor to run the batches on, or nullptr to use the global task executor.
+         */
+        static TaskGraphScheduler* Create(AZ::TaskExecutor* executor = nullptr);
+
+        /**
+         * Get the name of this class, or a description.
+         * @result The string containing the name of the scheduler.
+         */
+        const char* GetName() const override        { return "TaskGraphScheduler"; }
+
+        /**
+         * Get the unique type ID of the scheduler type.
+         * All schedulers will have another ID, so that you can use this to identify what scheduler you are dealing with.
+         * @result The unique ID of the scheduler type.
+         */
+        uint32 GetType() const override             { return TYPE_ID; }
+
+        /**
+         * The main method which will execute all batches, which on their turn will check for visibility and perform the updates.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void Execute(float timePassedInSeconds) override;
+
+        /**
+         * LOG the schedule using the LOG method.
+         * This shows the number of actor instances in each batch.
+         */
+        void Print() override;
+
+        /**
+         * Clear the schedule.
+         */
+        void Clear() override;
+
+        /**
+         * Mark the schedule to be rebuilt, as the actor instance or its attachments changed.
+         * @param actorInstance The actor instance to insert.
+         * @param startStep Unused, the schedule is built from the root actor instances.
+         */
+        void RecursiveInsertActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Mark the schedule to be rebuilt, as the actor instance or its attachments changed.
+         * @param actorInstance The actor instance to remove.
+         * @param startStep Unused, the schedule is built from the root actor instances.
+         */
+        void RecursiveRemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Remove a single actor instance from the schedule. The schedule will be rebuilt before the next execution.
+         * @param actorInstance The actor instance to remove.
+         * @param startStep Unused, the schedule is built from the root actor instances.
+         * @result Always returns 0, as the schedule has no steps.
+         */
+        size_t RemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Rebuild the batches and the task graph, if actor instances or attachments changed since the last time.
+         * This is done automatically when executing the schedule.
+         */
+        void UpdateSchedule();
+
+        const Batch& GetBatch(size_t index) const   { return m_batches[index]; }
+        size_t GetNumBatches() const                { return m_batches.size(); }
+
+    protected:
+        AZStd::vector<Batch>            m_batches;                  /**< The batches, one task each. */
+        AZ::TaskGraph                   m_taskGraph;                /**< The retained task graph, with a task per batch. */
+        AZ::TaskExecutor*               m_executor = nullptr;       /**< The executor to submit to, or nullptr for the global one. */
+        float                           m_timePassedInSeconds = 0.0f;
+        MCore::MutexRecursive           m_mutex;
+        bool                            m_isDirty = true;
+
+        /**
+         * The constructor.
+         * @param executor The task executor to run the batches on, or nullptr to use the global task executor.
+         */
+        explicit TaskGraphScheduler(AZ::TaskExecutor* executor);
+
+        /**
+         * The destructor.
+         */
+        ~TaskGraphScheduler() override;
+
+        /**
+         * Rebuild the batches from the root actor instances, and the task graph executing them.
+         */
+        void RebuildSchedule();
+
+        /**
+         * Recursively add an actor instance and all of its attachments to a batch.
+         * @param actorInstance The actor instance to add.
+         * @param outBatch The batch to add the actor instance to.
+         */
+        static void RecursiveAddToBatch(ActorInstance* actorInstance, Batch& outBatch);
+
+        /**
+         * Update all enabled actor instances in a batch.
+         * @param batchIndex The index of the batch, which is also used as thread index.
+         */
+        void ExecuteBatch(size_t batchIndex);
+    };
+}   // namespace EMotionFX
@@ -96,11 +96,15 @@ set(FILES
     Source/NodeMap.h
     Source/ObjectId.cpp
     Source/ObjectId.h
+    Source/PackedSkinInfluences.cpp
+    Source/PackedSkinInfluences.h
     Source/PlayBackInfo.h
     Source/PhysicsSetup.cpp
     Source/PhysicsSetup.h
     Source/Pose.cpp
     Source/Pose.h
+    Source/PoseBlendKernels.cpp
+    Source/PoseBlendKernels.h
     Source/PoseData.cpp
     Source/PoseData.h
     Source/PoseDataFactory.cpp
@@ -116,11 +120,14 @@ set(FILES
     Source/RecorderBus.h
     Source/RepositioningLayerPass.cpp
     Source/RepositioningLayerPass.h
+    Source/SimdQuaternion.h
     Source/SimulatedObjectBus.h
     Source/SimulatedObjectSetup.cpp
     Source/SimulatedObjectSetup.h
     Source/SingleThreadScheduler.cpp
     Source/SingleThreadScheduler.h
+    Source/TaskGraphScheduler.cpp
+    Source/TaskGraphScheduler.h
     Source/Skeleton.cpp
     Source/Skeleton.h
     Source/SkinningInfoVertexAttributeLayer.cpp
@@ -187,6 +194,8 @@ set(FILES
     Source/AnimGraphObjectFactory.cpp
     Source/AnimGraphObjectFactory.h
     Source/AnimGraphObjectIds.h
+    Source/AnimGraphOutputProgram.cpp
+    Source/AnimGraphOutputProgram.h
     Source/AnimGraphPose.cpp
     Source/AnimGraphPose.h
     Source/AnimGraphPosePool.cpp
@@ -347,6 +356,8 @@ set(FILES
     Source/EventInfo.h
     Source/EventManager.cpp
     Source/EventManager.h
+    Source/MotionData/CompressedMotionData.cpp
+    Source/MotionData/CompressedMotionData.h
     Source/MotionData/MotionData.cpp
     Source/MotionData/MotionData.h
     Source/MotionData/MotionDataFactory.cpp
@@ -114,6 +114,7 @@ namespace MCore
 
         MCORE_INLINE size_t Increment()             { return m_atomic++; }
         MCORE_INLINE size_t Decrement()             { return m_atomic--; }
+        MCORE_INLINE size_t Add(size_t value)       { return m_atomic.fetch_add(value); }
 
     private:
         AZStd::atomic<size_t> m_atomic;
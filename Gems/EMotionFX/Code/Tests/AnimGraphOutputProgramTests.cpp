@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/optional.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/AnimGraphInstance.h>
+#include <EMotionFX/Source/AnimGraphMotionNode.h>
+#include <EMotionFX/Source/AnimGraphOutputProgram.h>
+#include <EMotionFX/Source/AnimGraphStateMachine.h>
+#include <EMotionFX/Source/BlendTree.h>
+#include <EMotionFX/Source/BlendTreeBlend2Node.h>
+#include <EMotionFX/Source/BlendTreeFinalNode.h>
+#include <EMotionFX/Source/BlendTreeFloatConstantNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionSet.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <Tests/AnimGraphFixture.h>
+#include <Tests/EMotionFXBenchmarkFixture.h>
+#include <Tests/Matchers.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/AnimGraphFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        // Create a motion that rotates all joints of a SimpleJointChainActor around the z axis.
+        Motion* CreateRotationMotion(const AZStd::string& motionId, size_t numJoints, float angle)
+        {
+            NonUniformMotionData* motionData = aznew NonUniformMotionData();
+            for (size_t i = 0; i < numJoints; ++i)
+            {
+                motionData->AddJoint(i == 0 ? AZStd::string("rootJoint") : AZStd::string::format("joint%zu", i), Transform::CreateIdentity(), Transform::CreateIdentity());
+                motionData->AllocateJointRotationSamples(i, 2);
+                motionData->SetJointRotationSample(i, 0, { 0.0f, AZ::Quaternion::CreateIdentity() });
+                motionData->SetJointRotationSample(i, 1, { 1.0f, AZ::Quaternion::CreateRotationZ(angle) });
+            }
+            motionData->UpdateDuration();
+
+            Motion* motion = aznew Motion(motionId.c_str());
+            motion->SetMotionData(motionData);
+            motion->UpdateDuration();
+            return motion;
+        }
+
+        // Add one motion node per motion id to the blend tree and blend them pairwise with blend 2 nodes, down to the final node.
+        void ConstructBlendTree(BlendTree* blendTree, const AZStd::vector<AZStd::string>& motionIds)
+        {
+            BlendTreeFloatConstantNode* weightNode = aznew BlendTreeFloatConstantNode();
+            weightNode->SetValue(0.3f);
+            blendTree->AddChildNode(weightNode);
+
+            AZStd::vector<AnimGraphNode*> layer;
+            for (const AZStd::string& motionId : motionIds)
+            {
+                AnimGraphMotionNode* motionNode = aznew AnimGraphMotionNode();
+                motionNode->AddMotionId(motionId);
+                blendTree->AddChildNode(motionNode);
+                layer.emplace_back(motionNode);
+            }
+
+            while (layer.size() > 1)
+            {
+                AZStd::vector<AnimGraphNode*> nextLayer;
+                for (size_t i = 0; i + 1 < layer.size(); i += 2)
+                {
+                    BlendTreeBlend2Node* blendNode = aznew BlendTreeBlend2Node();
+                    blendTree->AddChildNode(blendNode);
+                    blendNode->AddConnection(layer[i], AnimGraphMotionNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::PORTID_INPUT_POSE_A);
+                    blendNode->AddConnection(layer[i + 1], AnimGraphMotionNode::PORTID_OUTPUT_POSE, BlendTreeBlend2Node::PORTID_INPUT_POSE_B);
+                    blendNode->AddConnection(weightNode, BlendTreeFloatConstantNode::PORTID_OUTPUT_RESULT, BlendTreeBlend2Node::PORTID_INPUT_WEIGHT);
+                    nextLayer.emplace_back(blendNode);
+                }
+                if (layer.size() % 2 == 1)
+                {
+                    nextLayer.emplace_back(layer.back());
+                }
+                layer = AZStd::move(nextLayer);
+            }
+
+            BlendTreeFinalNode* finalNode = aznew BlendTreeFinalNode();
+            blendTree->AddChildNode(finalNode);
+            finalNode->AddConnection(layer[0], AnimGraphMotionNode::PORTID_OUTPUT_POSE, BlendTreeFinalNode::PORTID_INPUT_POSE);
+        }
+    } // namespace
+
+    // A blend tree blending four motions, which transitions into a single motion state after half a second.
+    // The fixture anim graph instance uses an output program, the reference one on a second actor instance does not.
+    class AnimGraphOutputProgramFixture
+        : public AnimGraphFixture
+    {
+    public:
+        static constexpr size_t NumJoints = 5;
+        static constexpr size_t NumMotions = 4;
+
+        void ConstructActor() override
+        {
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(NumJoints);
+        }
+
+        void ConstructGraph() override
+        {
+            auto animGraph = AnimGraphFactory::Create<OneBlendTreeNodeAnimGraph>();
+            m_rootStateMachine = animGraph->GetRootStateMachine();
+            m_blendTree = animGraph->GetBlendTreeNode();
+            m_animGraph = AZStd::move(animGraph);
+
+            AZStd::vector<AZStd::string> motionIds;
+            for (size_t i = 0; i < NumMotions; ++i)
+            {
+                motionIds.emplace_back(AZStd::string::format("motion%zu", i));
+            }
+            ConstructBlendTree(m_blendTree, motionIds);
+
+            m_motionState = aznew AnimGraphMotionNode();
+            m_motionState->AddMotionId("motion0");
+            m_rootStateMachine->AddChildNode(m_motionState);
+            AddTransitionWithTimeCondition(m_blendTree, m_motionState, 0.2f, 0.5f);
+        }
+
+        void SetUp() override
+        {
+            AnimGraphFixture::SetUp();
+
+            for (size_t i = 0; i < NumMotions; ++i)
+            {
+                Motion* motion = CreateRotationMotion(AZStd::string::format("motion%zu", i), NumJoints, 0.25f * static_cast<float>(i + 1));
+                m_motionSet->AddMotionEntry(aznew MotionSet::MotionEntry(motion->GetName(), motion->GetName(), motion));
+            }
+
+            m_animGraphInstance->SetUseOutputProgram(true);
+
+            m_referenceActorInstance = ActorInstance::Create(m_actor.get());
+            AnimGraphInstance* referenceAnimGraphInstance = AnimGraphInstance::Create(m_animGraph.get(), m_referenceActorInstance, m_motionSet);
+            m_referenceActorInstance->SetAnimGraphInstance(referenceAnimGraphInstance);
+        }
+
+        void TearDown() override
+        {
+            m_referenceActorInstance->Destroy();
+            AnimGraphFixture::TearDown();
+        }
+
+        void ExpectPosesMatch() const
+        {
+            const Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+            const Pose* referencePose = m_referenceActorInstance->GetTransformData()->GetCurrentPose();
+            for (size_t i = 0; i < NumJoints; ++i)
+            {
+                EXPECT_THAT(pose->GetLocalSpaceTransform(i), IsClose(referencePose->GetLocalSpaceTransform(i)));
+            }
+        }
+
+        bool HasInstruction(const AnimGraphNode* node) const
+        {
+            const AnimGraphOutputProgram* program = m_animGraphInstance->GetOutputProgram();
+            for (size_t i = 0; i < program->GetNumInstructions(); ++i)
+            {
+                if (program->GetInstruction(i) == node)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        BlendTree* m_blendTree = nullptr;
+        AnimGraphMotionNode* m_motionState = nullptr;
+        ActorInstance* m_referenceActorInstance = nullptr;
+    };
+
+    TEST_F(AnimGraphOutputProgramFixture, CompilesAfterTwoOutputPasses)
+    {
+        const AnimGraphOutputProgram* program = m_animGraphInstance->GetOutputProgram();
+        ASSERT_NE(program, nullptr);
+        EXPECT_EQ(program->GetState(), AnimGraphOutputProgram::State::Invalid);
+
+        GetEMotionFX().Update(0.0f);
+        EXPECT_EQ(program->GetState(), AnimGraphOutputProgram::State::RecordingPoses);
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_TRUE(program->GetIsCompiled());
+
+        // The motion nodes, blend nodes, final node, blend tree and root state machine finish their output in depth first order.
+        const size_t numPoseNodes = NumMotions + (NumMotions - 1) + 3;
+        EXPECT_GE(program->GetNumInstructions(), numPoseNodes);
+        EXPECT_EQ(program->GetInstruction(program->GetNumInstructions() - 1), m_rootStateMachine);
+        EXPECT_FALSE(HasInstruction(m_motionState));
+
+        // Poses that are not in use at the same time share a slot.
+        EXPECT_GT(program->GetNumPoseSlots(), size_t{ 0 });
+        EXPECT_LT(program->GetNumPoseSlots(), numPoseNodes);
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_TRUE(program->GetIsCompiled());
+    }
+
+    TEST_F(AnimGraphOutputProgramFixture, MatchesRecursiveOutput)
+    {
+        GetEMotionFX().Update(0.0f);
+        ExpectPosesMatch();
+
+        // Run through the transition, which recompiles the program twice.
+        for (int frame = 0; frame < 60; ++frame)
+        {
+            GetEMotionFX().Update(1.0f / 60.0f);
+            ExpectPosesMatch();
+        }
+    }
+
+    TEST_F(AnimGraphOutputProgramFixture, RecompilesOnTransition)
+    {
+        const AnimGraphOutputProgram* program = m_animGraphInstance->GetOutputProgram();
+        bool wasCompiled = false;
+        bool wasInvalidated = false;
+
+        GetEMotionFX().Update(0.0f);
+        for (int frame = 0; frame < 60; ++frame)
+        {
+            GetEMotionFX().Update(1.0f / 60.0f);
+            if (program->GetIsCompiled())
+            {
+                wasCompiled = true;
+            }
+            else if (wasCompiled)
+            {
+                wasInvalidated = true;
+            }
+        }
+
+        EXPECT_TRUE(wasInvalidated);
+        EXPECT_TRUE(program->GetIsCompiled());
+        EXPECT_TRUE(HasInstruction(m_motionState));
+        EXPECT_FALSE(HasInstruction(m_blendTree));
+    }
+
+    TEST_F(AnimGraphOutputProgramFixture, DisablingReleasesProgram)
+    {
+        GetEMotionFX().Update(0.0f);
+        GetEMotionFX().Update(1.0f / 60.0f);
+        ASSERT_TRUE(m_animGraphInstance->GetOutputProgram()->GetIsCompiled());
+
+        m_animGraphInstance->SetUseOutputProgram(false);
+        EXPECT_FALSE(m_animGraphInstance->GetUseOutputProgram());
+        EXPECT_EQ(m_animGraphInstance->GetOutputProgram(), nullptr);
+
+        GetEMotionFX().Update(1.0f / 60.0f);
+        ExpectPosesMatch();
+    }
+
+#ifdef HAVE_BENCHMARK
+    //! Updates and outputs a blend tree that blends the given number of motions pairwise.
+    //! The first argument is the number of motions, the second one enables the output program.
+    class AnimGraphOutputProgramBenchmarkFixture
+        : public EMotionFXBenchmarkFixture
+    {
+    protected:
+        static constexpr size_t NumJoints = 50;
+
+        void SetUpBenchmark(const ::benchmark::State& state) override
+        {
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(NumJoints);
+            m_motionSet = aznew MotionSet("benchmarkMotionSet");
+
+            const size_t numMotions = static_cast<size_t>(state.range(0));
+            AZStd::vector<AZStd::string> motionIds;
+            for (size_t i = 0; i < numMotions; ++i)
+            {
+                motionIds.emplace_back(AZStd::string::format("motion%zu", i));
+                Motion* motion = CreateRotationMotion(motionIds.back(), NumJoints, 0.01f * static_cast<float>(i + 1));
+                m_motionSet->AddMotionEntry(aznew MotionSet::MotionEntry(motion->GetName(), motion->GetName(), motion));
+            }
+
+            auto animGraph = AnimGraphFactory::Create<OneBlendTreeNodeAnimGraph>();
+            ConstructBlendTree(animGraph->GetBlendTreeNode(), motionIds);
+            m_animGraph = AZStd::move(animGraph);
+            m_animGraph->InitAfterLoading();
+
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+            m_animGraphInstance = AnimGraphInstance::Create(m_animGraph.get(), m_actorInstance, m_motionSet);
+            m_actorInstance->SetAnimGraphInstance(m_animGraphInstance);
+            m_animGraphInstance->SetUseOutputProgram(state.range(1) != 0);
+            m_pose.emplace();
+            m_pose->LinkToActorInstance(m_actorInstance);
+
+            // Compile the output program before measuring.
+            for (int i = 0; i < 2; ++i)
+            {
+                m_animGraphInstance->Update(0.0f);
+                m_animGraphInstance->Output(&m_pose.value());
+            }
+        }
+
+        void TearDownBenchmark() override
+        {
+            m_actorInstance->Destroy();
+            m_animGraph.reset();
+            delete m_motionSet;
+            m_actor.reset();
+            m_pose.reset();
+        }
+
+        AZStd::unique_ptr<Actor> m_actor;
+        AZStd::unique_ptr<AnimGraph> m_animGraph;
+        MotionSet* m_motionSet = nullptr;
+        ActorInstance* m_actorInstance = nullptr;
+        AnimGraphInstance* m_animGraphInstance = nullptr;
+        AZStd::optional<Pose> m_pose;
+    };
+
+    BENCHMARK_DEFINE_F(AnimGraphOutputProgramBenchmarkFixture, BM_UpdateAndOutputBlendTree)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_animGraphInstance->Update(1.0f / 60.0f);
+            m_animGraphInstance->Output(&m_pose.value());
+        }
+        state.SetItemsProcessed(state.iterations() * m_animGraph->GetNumNodes());
+    }
+    BENCHMARK_REGISTER_F(AnimGraphOutputProgramBenchmarkFixture, BM_UpdateAndOutputBlendTree)
+        ->ArgNames({ "Motions", "OutputProgram" })
+        ->Args({ 16, 0 })
+        ->Args({ 16, 1 })
+        ->Args({ 64, 0 })
+        ->Args({ 64, 1 })
+        ->Args({ 256, 0 })
+        ->Args({ 256, 1 })
+        ->Unit(benchmark::kMicrosecond);
+#endif // HAVE_BENCHMARK
+} // namespace EMotionFX
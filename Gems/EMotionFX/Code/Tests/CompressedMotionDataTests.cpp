@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/MotionDataSampleSettings.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/Matchers.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+#ifdef HAVE_BENCHMARK
+#include <Tests/EMotionFXBenchmarkFixture.h>
+#endif
+
+namespace EMotionFX
+{
+    namespace
+    {
+        //! Fills the motion data with joints named like the ones of the SimpleJointChainActor.
+        //! Every joint is rotated, every other joint moves and every third joint scales. The last joint isn't animated.
+        void FillSourceMotionData(NonUniformMotionData& motionData, size_t numJoints, size_t numKeys, float duration)
+        {
+            for (size_t i = 0; i < numJoints; ++i)
+            {
+                Transform transform = Transform::CreateIdentity();
+                transform.m_position = AZ::Vector3(static_cast<float>(i), 0.0f, 0.0f);
+                motionData.AddJoint(i == 0 ? AZStd::string("rootJoint") : AZStd::string::format("joint%zu", i), transform, transform);
+            }
+
+            for (size_t i = 0; i + 1 < numJoints; ++i)
+            {
+                const float jointOffset = static_cast<float>(i) * 0.37f;
+                const AZ::Vector3 axis = AZ::Vector3(1.0f, static_cast<float>(i % 3), 0.5f).GetNormalized();
+
+                motionData.AllocateJointRotationSamples(i, numKeys);
+                for (size_t k = 0; k < numKeys; ++k)
+                {
+                    const float time = duration * k / (numKeys - 1);
+                    motionData.SetJointRotationSample(i, k, { time, AZ::Quaternion::CreateFromAxisAngle(axis, jointOffset + time * 4.0f) });
+                }
+
+                if (i % 2 == 0)
+                {
+                    motionData.AllocateJointPositionSamples(i, numKeys);
+                    for (size_t k = 0; k < numKeys; ++k)
+                    {
+                        const float time = duration * k / (numKeys - 1);
+                        motionData.SetJointPositionSample(i, k, { time, AZ::Vector3(static_cast<float>(i), AZ::Sin(time + jointOffset), time * 2.0f) });
+                    }
+                }
+
+#ifndef EMFX_SCALE_DISABLED
+                if (i % 3 == 0)
+                {
+                    motionData.AllocateJointScaleSamples(i, numKeys);
+                    for (size_t k = 0; k < numKeys; ++k)
+                    {
+                        const float time = duration * k / (numKeys - 1);
+                        motionData.SetJointScaleSample(i, k, { time, AZ::Vector3(1.0f + time, 1.0f, 1.0f - time * 0.5f) });
+                    }
+                }
+#endif
+            }
+
+            motionData.UpdateDuration();
+        }
+    } // namespace
+
+    class CompressedMotionDataFixture
+        : public SystemComponentFixture
+    {
+    public:
+        static constexpr size_t NumJoints = 9;
+
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            m_sourceData = aznew NonUniformMotionData();
+            FillSourceMotionData(*m_sourceData, NumJoints, 11, 1.0f);
+
+            m_uniformData = aznew UniformMotionData();
+            m_uniformData->InitFromNonUniformData(m_sourceData, false, 30.0f);
+
+            m_compressedData = aznew CompressedMotionData();
+            m_compressedData->InitFromNonUniformData(m_sourceData, false, 30.0f);
+        }
+
+        void TearDown() override
+        {
+            delete m_compressedData;
+            delete m_uniformData;
+            delete m_sourceData;
+            SystemComponentFixture::TearDown();
+        }
+
+        //! Compares rotations while ignoring their sign, as the compression keeps the largest component positive.
+        static void ExpectSameRotation(const AZ::Quaternion& rotation, const AZ::Quaternion& expected)
+        {
+            EXPECT_NEAR(AZ::GetAbs(rotation.Dot(expected)), 1.0f, 1.0e-5f) << "Rotations differ.";
+        }
+
+        static void ExpectSameTransforms(const CompressedMotionData& motionData, const CompressedMotionData& expected, float sampleTime)
+        {
+            for (size_t i = 0; i < expected.GetNumJoints(); ++i)
+            {
+                EXPECT_THAT(motionData.SampleJointTransform(sampleTime, i), IsClose(expected.SampleJointTransform(sampleTime, i)));
+            }
+        }
+
+    protected:
+        NonUniformMotionData* m_sourceData = nullptr;
+        UniformMotionData* m_uniformData = nullptr;
+        CompressedMotionData* m_compressedData = nullptr;
+    };
+
+    TEST_F(CompressedMotionDataFixture, InitFromNonUniformData)
+    {
+        EXPECT_EQ(m_compressedData->GetNumJoints(), NumJoints);
+        EXPECT_EQ(m_compressedData->GetNumSamples(), m_uniformData->GetNumSamples());
+        EXPECT_FLOAT_EQ(m_compressedData->GetDuration(), m_uniformData->GetDuration());
+        for (size_t i = 0; i < NumJoints; ++i)
+        {
+            EXPECT_EQ(m_compressedData->IsJointRotationAnimated(i), m_sourceData->IsJointRotationAnimated(i));
+            EXPECT_EQ(m_compressedData->IsJointPositionAnimated(i), m_sourceData->IsJointPositionAnimated(i));
+            EMFX_SCALECODE
+            (
+                EXPECT_EQ(m_compressedData->IsJointScaleAnimated(i), m_sourceData->IsJointScaleAnimated(i));
+            )
+        }
+        EXPECT_FALSE(m_compressedData->IsJointAnimated(NumJoints - 1));
+    }
+
+    TEST_F(CompressedMotionDataFixture, SampleJointTransformsMatchesUniformMotionData)
+    {
+        AZStd::vector<Transform> transforms(NumJoints);
+        for (float sampleTime = 0.0f; sampleTime <= m_compressedData->GetDuration(); sampleTime += 0.013f)
+        {
+            m_compressedData->SampleJointTransforms(sampleTime, transforms.data());
+            for (size_t i = 0; i < NumJoints; ++i)
+            {
+                const Transform expected = m_uniformData->SampleJointTransform(sampleTime, i);
+                EXPECT_THAT(transforms[i].m_position, IsClose(expected.m_position));
+                ExpectSameRotation(transforms[i].m_rotation, expected.m_rotation);
+                EMFX_SCALECODE
+                (
+                    EXPECT_THAT(transforms[i].m_scale, IsClose(expected.m_scale));
+                )
+
+                // The batched decoding should give the same results as sampling a single joint.
+                EXPECT_THAT(transforms[i], IsClose(m_compressedData->SampleJointTransform(sampleTime, i)));
+            }
+        }
+    }
+
+    TEST_F(CompressedMotionDataFixture, SamplePoseMatchesSampleJointTransform)
+    {
+        AZStd::unique_ptr<Actor> actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(NumJoints + 1);
+        actor->SetMotionExtractionNodeIndex(0);
+        ActorInstance* actorInstance = ActorInstance::Create(actor.get());
+
+        Pose pose;
+        pose.LinkToActorInstance(actorInstance);
+        pose.InitFromBindPose(actorInstance);
+
+        MotionDataSampleSettings settings;
+        settings.m_actorInstance = actorInstance;
+        settings.m_inputPose = actorInstance->GetTransformData()->GetBindPose();
+        for (bool inPlace : { false, true })
+        {
+            settings.m_inPlace = inPlace;
+            for (float sampleTime = 0.0f; sampleTime <= m_compressedData->GetDuration(); sampleTime += 0.1f)
+            {
+                settings.m_sampleTime = sampleTime;
+                m_compressedData->SamplePose(settings, &pose);
+
+                // The joint that isn't in the motion comes from the input pose.
+                for (size_t i = 0; i < actor->GetNumNodes(); ++i)
+                {
+                    EXPECT_THAT(pose.GetLocalSpaceTransform(i), IsClose(m_compressedData->SampleJointTransform(settings, i)));
+                }
+            }
+        }
+
+        actorInstance->Destroy();
+    }
+
+    TEST_F(CompressedMotionDataFixture, SaveAndRead)
+    {
+        MotionData::SaveSettings saveSettings;
+        MCore::MemoryFile file;
+        file.Open();
+        ASSERT_TRUE(m_compressedData->Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), m_compressedData->CalcStreamSaveSizeInBytes(saveSettings));
+
+        CompressedMotionData loadedData;
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = m_compressedData->GetStreamSaveVersion();
+        file.Seek(0);
+        ASSERT_TRUE(loadedData.Read(&file, readSettings));
+
+        EXPECT_EQ(loadedData.GetNumJoints(), NumJoints);
+        EXPECT_EQ(loadedData.GetNumSamples(), m_compressedData->GetNumSamples());
+        for (size_t i = 0; i < NumJoints; ++i)
+        {
+            EXPECT_STREQ(loadedData.GetJointName(i).c_str(), m_compressedData->GetJointName(i).c_str());
+        }
+        for (float sampleTime = 0.0f; sampleTime <= m_compressedData->GetDuration(); sampleTime += 0.1f)
+        {
+            ExpectSameTransforms(loadedData, *m_compressedData, sampleTime);
+        }
+    }
+
+    TEST_F(CompressedMotionDataFixture, SmallerThanUniformMotionData)
+    {
+        const MotionData::SaveSettings saveSettings;
+        EXPECT_LT(m_compressedData->CalcStreamSaveSizeInBytes(saveSettings), m_uniformData->CalcStreamSaveSizeInBytes(saveSettings));
+    }
+
+    TEST_F(CompressedMotionDataFixture, ClearSamplesKeepsOtherTracks)
+    {
+        const float sampleTime = 0.42f;
+        AZStd::vector<Transform> expected(NumJoints);
+        m_compressedData->SampleJointTransforms(sampleTime, expected.data());
+
+        m_compressedData->ClearJointRotationSamples(2);
+        EXPECT_FALSE(m_compressedData->IsJointRotationAnimated(2));
+        EXPECT_TRUE(m_compressedData->IsJointPositionAnimated(2));
+        EXPECT_THAT(m_compressedData->SampleJointRotation(sampleTime, 2), IsClose(m_compressedData->GetJointStaticRotation(2)));
+        EXPECT_THAT(m_compressedData->SampleJointPosition(sampleTime, 2), IsClose(expected[2].m_position));
+
+        m_compressedData->ClearJointTransformSamples(0);
+        EXPECT_FALSE(m_compressedData->IsJointAnimated(0));
+
+        for (size_t i = 1; i < NumJoints; ++i)
+        {
+            if (i != 2)
+            {
+                EXPECT_THAT(m_compressedData->SampleJointTransform(sampleTime, i), IsClose(expected[i]));
+            }
+        }
+    }
+
+    TEST_F(CompressedMotionDataFixture, RemoveJoint)
+    {
+        const float sampleTime = 0.42f;
+        AZStd::vector<Transform> expected(NumJoints);
+        m_compressedData->SampleJointTransforms(sampleTime, expected.data());
+
+        m_compressedData->RemoveJoint(3);
+        ASSERT_EQ(m_compressedData->GetNumJoints(), NumJoints - 1);
+        for (size_t i = 0; i < NumJoints - 1; ++i)
+        {
+            const size_t sourceIndex = (i < 3) ? i : i + 1;
+            EXPECT_EQ(m_compressedData->IsJointAnimated(i), m_sourceData->IsJointAnimated(sourceIndex));
+            EXPECT_THAT(m_compressedData->SampleJointTransform(sampleTime, i), IsClose(expected[sourceIndex]));
+        }
+    }
+
+#ifdef HAVE_BENCHMARK
+    //! Samples all joints of a motion, comparing UniformMotionData sampling joint by joint with CompressedMotionData sampling them at once.
+    //! The first argument is the number of joints. The save size is reported as the Bytes counter.
+    class CompressedMotionDataBenchmarkFixture
+        : public EMotionFXBenchmarkFixture
+    {
+    protected:
+        void SetUpBenchmark(const ::benchmark::State& state) override
+        {
+            NonUniformMotionData sourceData;
+            FillSourceMotionData(sourceData, static_cast<size_t>(state.range(0)), 31, 10.0f);
+
+            m_uniformData = aznew UniformMotionData();
+            m_uniformData->InitFromNonUniformData(&sourceData, false, 30.0f);
+            m_compressedData = aznew CompressedMotionData();
+            m_compressedData->InitFromNonUniformData(&sourceData, false, 30.0f);
+            m_transforms.resize(sourceData.GetNumJoints());
+        }
+
+        void TearDownBenchmark() override
+        {
+            m_transforms = {};
+            delete m_compressedData;
+            delete m_uniformData;
+        }
+
+        template<typename SampleFunction>
+        void Run(::benchmark::State& state, const MotionData* motionData, const SampleFunction& sample)
+        {
+            float sampleTime = 0.0f;
+            const float duration = motionData->GetDuration();
+            for ([[maybe_unused]] auto _ : state)
+            {
+                sample(sampleTime);
+                benchmark::DoNotOptimize(m_transforms.data());
+                sampleTime += 1.0f / 60.0f;
+                sampleTime = (sampleTime > duration) ? 0.0f : sampleTime;
+            }
+
+            state.counters["Bytes"] = static_cast<double>(motionData->CalcStreamSaveSizeInBytes(MotionData::SaveSettings()));
+        }
+
+        UniformMotionData* m_uniformData = nullptr;
+        CompressedMotionData* m_compressedData = nullptr;
+        AZStd::vector<Transform> m_transforms;
+    };
+
+    BENCHMARK_DEFINE_F(CompressedMotionDataBenchmarkFixture, BM_SampleAllJoints_Uniform)(::benchmark::State& state)
+    {
+        Run(state, m_uniformData, [this](float sampleTime)
+        {
+            for (size_t i = 0; i < m_transforms.size(); ++i)
+            {
+                m_transforms[i] = m_uniformData->SampleJointTransform(sampleTime, i);
+            }
+        });
+    }
+    BENCHMARK_REGISTER_F(CompressedMotionDataBenchmarkFixture, BM_SampleAllJoints_Uniform)->Arg(50)->Arg(200)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(CompressedMotionDataBenchmarkFixture, BM_SampleAllJoints_Compressed)(::benchmark::State& state)
+    {
+        Run(state, m_compressedData, [this](float sampleTime)
+        {
+            m_compressedData->SampleJointTransforms(sampleTime, m_transforms.data());
+        });
+    }
+    BENCHMARK_REGISTER_F(CompressedMotionDataBenchmarkFixture, BM_SampleAllJoints_Compressed)->Arg(50)->Arg(200)->Unit(benchmark::kMicrosecond);
+#endif // HAVE_BENCHMARK
+} // namespace EMotionFX
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <Integration/System/SystemCommon.h>
+#include <MCore/Source/MCoreSystem.h>
+#include <benchmark/benchmark.h>
+
+namespace EMotionFX
+{
+    //! Initializes the EMotionFX runtime for benchmarks, without the component application the test fixtures use.
+    //! EMotionFX sizes its per thread data on the global job manager, so this also starts one with the given number of worker threads.
+    class EMotionFXBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpEMotionFX();
+            SetUpBenchmark(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpEMotionFX();
+            SetUpBenchmark(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            TearDownBenchmark();
+            TearDownEMotionFX();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDownBenchmark();
+            TearDownEMotionFX();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        virtual void SetUpBenchmark([[maybe_unused]] const ::benchmark::State& state) {}
+        virtual void TearDownBenchmark() {}
+
+        static constexpr AZ::u32 NumWorkerThreads = 4;
+
+    private:
+        void SetUpEMotionFX()
+        {
+            AZ::JobManagerDesc jobDesc;
+            for (AZ::u32 i = 0; i < NumWorkerThreads; ++i)
+            {
+                jobDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = aznew AZ::JobManager(jobDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext);
+
+            EMotionFX::Integration::EMotionFXAllocator::Descriptor allocatorDescriptor;
+            AZ::AllocatorInstance<EMotionFX::Integration::EMotionFXAllocator>::Create(allocatorDescriptor);
+            MCore::Initializer::Init();
+            EMotionFX::Initializer::Init();
+        }
+
+        void TearDownEMotionFX()
+        {
+            EMotionFX::Initializer::Shutdown();
+            MCore::Initializer::Shutdown();
+            AZ::AllocatorInstance<EMotionFX::Integration::EMotionFXAllocator>::Destroy();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            m_jobContext = nullptr;
+            delete m_jobManager;
+            m_jobManager = nullptr;
+        }
+
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+    };
+} // namespace EMotionFX
+
+#endif // HAVE_BENCHMARK
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/algorithm.h>
 #include <Tests/SystemComponentFixture.h>
 #include <Tests/Matchers.h>
 #include <MCore/Source/MemoryObject.h>
@@ -18,6 +19,7 @@
 #include <EMotionFX/Source/MorphSetupInstance.h>
 #include <EMotionFX/Source/MorphTargetStandard.h>
 #include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/PoseBlendKernels.h>
 #include <EMotionFX/Source/PoseData.h>
 #include <EMotionFX/Source/PoseDataFactory.h>
 #include <EMotionFX/Source/PoseDataRagdoll.h>
@@ -30,6 +32,11 @@
 #include <Tests/TestAssetCode/SimpleActors.h>
 #include <Tests/TestAssetCode/ActorFactory.h>
 
+#ifdef HAVE_BENCHMARK
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+#endif
+
 namespace EMotionFX
 {
     class PoseTests
@@ -870,6 +877,122 @@ namespace EMotionFX
         }
     }
 
+    TEST_P(PoseTestsBlendWeightParam, BlendJoints)
+    {
+        const float blendWeight = GetParam();
+        const Pose* sourcePose = m_actorInstance->GetTransformData()->GetBindPose();
+
+        Pose destPose;
+        destPose.LinkToActorInstance(m_actorInstance);
+        destPose.InitFromBindPose(m_actor.get());
+        for (size_t i = 0; i < m_actor->GetSkeleton()->GetNumNodes(); ++i)
+        {
+            const float floatI = static_cast<float>(i);
+            destPose.SetLocalSpaceTransform(i, Transform(AZ::Vector3(0.0f, floatI, 0.0f),
+                AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(0.0f, 0.0f, 1.0f), floatI)));
+        }
+
+        // Only blend some of the joints, the others keep the source transforms.
+        const AZStd::vector<size_t> jointIndices = { 4, 1, 3 };
+        Pose blendedPose;
+        blendedPose.LinkToActorInstance(m_actorInstance);
+        blendedPose.InitFromBindPose(m_actor.get());
+        blendedPose.BlendJoints(&destPose, blendWeight, jointIndices);
+
+        for (size_t i = 0; i < m_actor->GetSkeleton()->GetNumNodes(); ++i)
+        {
+            Transform expectedResult = sourcePose->GetLocalSpaceTransform(i);
+            if (AZStd::find(jointIndices.begin(), jointIndices.end(), i) != jointIndices.end())
+            {
+                expectedResult.Blend(destPose.GetLocalSpaceTransform(i), blendWeight);
+            }
+            EXPECT_THAT(blendedPose.GetLocalSpaceTransform(i), IsClose(expectedResult));
+        }
+    }
+
+    TEST_F(PoseTests, CopyLocalSpaceTransforms)
+    {
+        Pose sourcePose;
+        sourcePose.LinkToActorInstance(m_actorInstance);
+        sourcePose.InitFromBindPose(m_actor.get());
+        for (size_t i = 0; i < m_actor->GetSkeleton()->GetNumNodes(); ++i)
+        {
+            const float floatI = static_cast<float>(i);
+            sourcePose.SetLocalSpaceTransform(i, Transform(AZ::Vector3(floatI, floatI, floatI), AZ::Quaternion::CreateRotationX(floatI)));
+        }
+
+        Pose pose;
+        pose.LinkToActorInstance(m_actorInstance);
+        pose.InitFromBindPose(m_actor.get());
+        const Transform lastModelSpaceTransform = pose.GetModelSpaceTransform(4);
+
+        const AZStd::vector<size_t> jointIndices = { 2, 3 };
+        pose.CopyLocalSpaceTransforms(sourcePose, jointIndices);
+
+        const Pose* bindPose = m_actorInstance->GetTransformData()->GetBindPose();
+        for (size_t i = 0; i < m_actor->GetSkeleton()->GetNumNodes(); ++i)
+        {
+            const bool copied = (i == 2 || i == 3);
+            const Transform& expectedResult = copied ? sourcePose.GetLocalSpaceTransform(i) : bindPose->GetLocalSpaceTransform(i);
+            EXPECT_THAT(pose.GetLocalSpaceTransform(i), IsClose(expectedResult));
+        }
+
+        // The model space transforms of the child joints have to be updated with the copied transforms.
+        EXPECT_THAT(pose.GetModelSpaceTransform(4), ::testing::Not(IsClose(lastModelSpaceTransform)));
+    }
+
+    TEST_F(PoseTests, BlendKernels_MatchTransformBlending)
+    {
+        AZ::SimpleLcgRandom random;
+        random.SetSeed(875960);
+        auto createRandomTransform = [&random]()
+        {
+            Transform transform(
+                AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * 10.0f,
+                AZ::Quaternion(random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f).GetNormalized());
+            EMFX_SCALECODE
+            (
+                transform.m_scale = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) + AZ::Vector3::CreateOne();
+            )
+            return transform;
+        };
+
+        // Joint counts covering full blocks of four joints as well as partial ones.
+        for (size_t numJoints = 1; numJoints <= 9; ++numJoints)
+        {
+            AZStd::vector<Transform> transforms(numJoints);
+            AZStd::vector<Transform> destTransforms(numJoints);
+            AZStd::vector<Transform> baseTransforms(numJoints);
+            AZStd::vector<uint16> jointIndices(numJoints);
+            for (size_t i = 0; i < numJoints; ++i)
+            {
+                transforms[i] = createRandomTransform();
+                destTransforms[i] = createRandomTransform();
+                baseTransforms[i] = createRandomTransform();
+                jointIndices[i] = static_cast<uint16>(numJoints - 1 - i);
+            }
+
+            const float weight = random.GetRandomFloat();
+
+            AZStd::vector<Transform> blended = transforms;
+            PoseBlendKernels::Blend(blended.data(), destTransforms.data(), numJoints, weight);
+
+            AZStd::vector<Transform> blendedAdditive = transforms;
+            PoseBlendKernels::BlendAdditive(blendedAdditive.data(), destTransforms.data(), baseTransforms.data(), jointIndices.data(), numJoints, weight);
+
+            for (size_t i = 0; i < numJoints; ++i)
+            {
+                Transform expectedBlend = transforms[i];
+                expectedBlend.Blend(destTransforms[i], weight);
+                EXPECT_THAT(blended[i], IsClose(expectedBlend));
+
+                Transform expectedAdditive = transforms[i];
+                expectedAdditive.BlendAdditive(destTransforms[i], baseTransforms[i], weight);
+                EXPECT_THAT(blendedAdditive[i], IsClose(expectedAdditive));
+            }
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
 
     enum PoseTestsMultiplyFunction
@@ -1340,4 +1463,214 @@ namespace EMotionFX
         pose.ClearPoseDatas();
         EXPECT_TRUE(pose.GetPoseDatas().empty());
     }
+
+#ifdef HAVE_BENCHMARK
+    //! Blends the transforms of many actor instances with the same skeleton, the way the blend tree nodes do every update.
+    //! The second argument selects between the per joint Transform functions and the blend kernels.
+    class PoseBlendBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t NumJoints = 100;
+        static constexpr int64_t PerJoint = 0;
+        static constexpr int64_t Kernels = 1;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpInternal(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpInternal(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            TearDownInternal();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDownInternal();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void SetUpInternal(const ::benchmark::State& state)
+        {
+            m_numInstances = static_cast<size_t>(state.range(0));
+            AZ::SimpleLcgRandom random;
+            for (AZStd::vector<Transform>* poses : { &m_poses, &m_destPoses, &m_secondDestPoses })
+            {
+                poses->resize(m_numInstances * NumJoints);
+                for (Transform& transform : *poses)
+                {
+                    transform = Transform(
+                        AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()),
+                        AZ::Quaternion(random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f).GetNormalized());
+                }
+            }
+            m_bindPose.assign(m_poses.begin(), m_poses.begin() + NumJoints);
+
+            m_enabledJoints.resize(NumJoints);
+            for (size_t i = 0; i < NumJoints; ++i)
+            {
+                m_enabledJoints[i] = static_cast<uint16>(i);
+            }
+
+            // Masks typically cover a limb or the upper body, use every other joint.
+            for (size_t i = 0; i < NumJoints; i += 2)
+            {
+                m_mask.push_back(i);
+            }
+        }
+
+        void TearDownInternal()
+        {
+            m_poses = {};
+            m_destPoses = {};
+            m_secondDestPoses = {};
+            m_bindPose = {};
+            m_enabledJoints = {};
+            m_mask = {};
+        }
+
+        size_t m_numInstances = 0;
+        AZStd::vector<Transform> m_poses;
+        AZStd::vector<Transform> m_destPoses;
+        AZStd::vector<Transform> m_secondDestPoses;
+        AZStd::vector<Transform> m_bindPose;
+        AZStd::vector<uint16> m_enabledJoints;
+        AZStd::vector<size_t> m_mask;
+    };
+
+    //! Blend2 node: blends the enabled joints of two input poses.
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, BM_PoseBlend_Blend2)(benchmark::State& state)
+    {
+        const bool useKernels = state.range(1) == Kernels;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t instance = 0; instance < m_numInstances; ++instance)
+            {
+                Transform* transforms = m_poses.data() + instance * NumJoints;
+                const Transform* destTransforms = m_destPoses.data() + instance * NumJoints;
+                if (useKernels)
+                {
+                    PoseBlendKernels::Blend(transforms, destTransforms, m_enabledJoints.data(), m_enabledJoints.size(), 0.5f);
+                }
+                else
+                {
+                    for (const uint16 joint : m_enabledJoints)
+                    {
+                        transforms[joint].Blend(destTransforms[joint], 0.5f);
+                    }
+                }
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * m_numInstances * NumJoints);
+    }
+
+    //! BlendN node: picks the two input poses around the blend parameter of each instance and blends them.
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, BM_PoseBlend_BlendN)(benchmark::State& state)
+    {
+        const bool useKernels = state.range(1) == Kernels;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t instance = 0; instance < m_numInstances; ++instance)
+            {
+                Transform* transforms = m_poses.data() + instance * NumJoints;
+                const AZStd::vector<Transform>& inputPoses = (instance % 2) ? m_destPoses : m_secondDestPoses;
+                const Transform* destTransforms = inputPoses.data() + instance * NumJoints;
+                const float weight = static_cast<float>(instance % 10) / 10.0f;
+                if (useKernels)
+                {
+                    PoseBlendKernels::Blend(transforms, destTransforms, m_enabledJoints.data(), m_enabledJoints.size(), weight);
+                }
+                else
+                {
+                    for (const uint16 joint : m_enabledJoints)
+                    {
+                        transforms[joint].Blend(destTransforms[joint], weight);
+                    }
+                }
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * m_numInstances * NumJoints);
+    }
+
+    //! Blend2 node with a mask: only blends the masked joints.
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, BM_PoseBlend_Mask)(benchmark::State& state)
+    {
+        const bool useKernels = state.range(1) == Kernels;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t instance = 0; instance < m_numInstances; ++instance)
+            {
+                Transform* transforms = m_poses.data() + instance * NumJoints;
+                const Transform* destTransforms = m_destPoses.data() + instance * NumJoints;
+                if (useKernels)
+                {
+                    PoseBlendKernels::Blend(transforms, destTransforms, m_mask.data(), m_mask.size(), 0.5f);
+                }
+                else
+                {
+                    for (const size_t joint : m_mask)
+                    {
+                        transforms[joint].Blend(destTransforms[joint], 0.5f);
+                    }
+                }
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * m_numInstances * m_mask.size());
+    }
+
+    //! Additive blending on top of the bind pose.
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, BM_PoseBlend_Additive)(benchmark::State& state)
+    {
+        const bool useKernels = state.range(1) == Kernels;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t instance = 0; instance < m_numInstances; ++instance)
+            {
+                Transform* transforms = m_poses.data() + instance * NumJoints;
+                const Transform* destTransforms = m_destPoses.data() + instance * NumJoints;
+                if (useKernels)
+                {
+                    PoseBlendKernels::BlendAdditive(transforms, destTransforms, m_bindPose.data(), m_enabledJoints.data(), m_enabledJoints.size(), 0.5f);
+                }
+                else
+                {
+                    for (const uint16 joint : m_enabledJoints)
+                    {
+                        transforms[joint].BlendAdditive(destTransforms[joint], m_bindPose[joint], 0.5f);
+                    }
+                }
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * m_numInstances * NumJoints);
+    }
+
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, BM_PoseBlend_Blend2)
+        ->Args({ 1000, PoseBlendBenchmarkFixture::PerJoint })
+        ->Args({ 1000, PoseBlendBenchmarkFixture::Kernels })
+        ->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, BM_PoseBlend_BlendN)
+        ->Args({ 1000, PoseBlendBenchmarkFixture::PerJoint })
+        ->Args({ 1000, PoseBlendBenchmarkFixture::Kernels })
+        ->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, BM_PoseBlend_Mask)
+        ->Args({ 1000, PoseBlendBenchmarkFixture::PerJoint })
+        ->Args({ 1000, PoseBlendBenchmarkFixture::Kernels })
+        ->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, BM_PoseBlend_Additive)
+        ->Args({ 1000, PoseBlendBenchmarkFixture::PerJoint })
+        ->Args({ 1000, PoseBlendBenchmarkFixture::Kernels })
+        ->Unit(benchmark::kMicrosecond);
+#endif // HAVE_BENCHMARK
 } // namespace EMotionFX
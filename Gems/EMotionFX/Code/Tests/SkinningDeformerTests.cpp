@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/DualQuatSkinDeformer.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+#include <EMotionFX/Source/SoftSkinDeformer.h>
+#include <EMotionFX/Source/SoftSkinManager.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <EMotionFX/Source/VertexAttributeLayerAbstractData.h>
+#include <Tests/Matchers.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+#ifdef HAVE_BENCHMARK
+#include <Tests/EMotionFXBenchmarkFixture.h>
+#endif
+
+namespace EMotionFX
+{
+    //! Creates a mesh where vertex v has (v % 5) influences on the joints following joint (v % numJoints), so that some vertices have no influences.
+    static Mesh* CreateSkinnedMesh(uint32 numVertices, size_t numJoints)
+    {
+        Mesh* mesh = Mesh::Create(numVertices, numVertices, numVertices / 3, numVertices, false);
+
+        SkinningInfoVertexAttributeLayer* skinningLayer = SkinningInfoVertexAttributeLayer::Create(numVertices);
+        for (uint32 v = 0; v < numVertices; ++v)
+        {
+            const size_t numInfluences = v % 5;
+            const float totalWeight = static_cast<float>(numInfluences * (numInfluences + 1) / 2);
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                skinningLayer->AddInfluence(v, (v + i) % numJoints, static_cast<float>(i + 1) / totalWeight);
+            }
+        }
+        mesh->AddSharedVertexAttributeLayer(skinningLayer);
+
+        auto addLayer = [mesh, numVertices](uint32 typeId, uint32 attribSizeInBytes)
+        {
+            VertexAttributeLayerAbstractData* layer = VertexAttributeLayerAbstractData::Create(numVertices, typeId, attribSizeInBytes, true);
+            mesh->AddVertexAttributeLayer(layer);
+            return layer->GetOriginalData();
+        };
+        uint32* orgVerts = static_cast<uint32*>(addLayer(Mesh::ATTRIB_ORGVTXNUMBERS, sizeof(uint32)));
+        AZ::Vector3* positions = static_cast<AZ::Vector3*>(addLayer(Mesh::ATTRIB_POSITIONS, sizeof(AZ::Vector3)));
+        AZ::Vector3* normals = static_cast<AZ::Vector3*>(addLayer(Mesh::ATTRIB_NORMALS, sizeof(AZ::Vector3)));
+        AZ::Vector4* tangents = static_cast<AZ::Vector4*>(addLayer(Mesh::ATTRIB_TANGENTS, sizeof(AZ::Vector4)));
+        AZ::Vector3* bitangents = static_cast<AZ::Vector3*>(addLayer(Mesh::ATTRIB_BITANGENTS, sizeof(AZ::Vector3)));
+        for (uint32 v = 0; v < numVertices; ++v)
+        {
+            const float x = static_cast<float>(v % 100) * 0.1f;
+            const float y = static_cast<float>(v / 100) * 0.01f;
+            orgVerts[v] = v;
+            positions[v] = AZ::Vector3(x, y, 0.5f);
+            normals[v] = AZ::Vector3(x, 1.0f, y).GetNormalized();
+            tangents[v] = AZ::Vector4::CreateFromVector3AndFloat(AZ::Vector3(1.0f, 0.0f, -x).GetNormalized(), (v % 2) ? 1.0f : -1.0f);
+            bitangents[v] = AZ::Vector3(0.0f, y, 1.0f).GetNormalized();
+        }
+        mesh->ResetToOriginalData();
+
+        return mesh;
+    }
+
+    //! Rotates and moves all joints, so that every joint has a different skinning matrix.
+    static void PoseActorInstance(ActorInstance* actorInstance)
+    {
+        Pose* pose = actorInstance->GetTransformData()->GetCurrentPose();
+        const size_t numJoints = actorInstance->GetActor()->GetNumNodes();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            const float angle = 0.3f + static_cast<float>(i) * 0.7f;
+            const AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 2.0f, 3.0f).GetNormalized(), angle);
+            pose->SetLocalSpaceTransform(i, Transform(AZ::Vector3(1.0f, 0.1f * static_cast<float>(i), 0.0f), rotation));
+        }
+        actorInstance->UpdateSkinningMatrices();
+    }
+
+    class SkinningDeformerFixture
+        : public SystemComponentFixture
+        , public ::testing::WithParamInterface<bool>
+    {
+    public:
+        static constexpr size_t NumJoints = 7;
+
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(NumJoints);
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+            PoseActorInstance(m_actorInstance);
+        }
+
+        void TearDown() override
+        {
+            if (m_deformer)
+            {
+                m_deformer->Destroy();
+                m_deformer = nullptr;
+            }
+            m_actorInstance->Destroy();
+            m_actor.reset();
+
+            GetSoftSkinManager().SetUseBatchedSkinning(true);
+            GetSoftSkinManager().SetUseMultiThreadedSkinning(true);
+
+            SystemComponentFixture::TearDown();
+        }
+
+        //! Creates a mesh owned by the actor and a soft skin or dual quaternion skin deformer for it, based on the test parameter.
+        void CreateDeformer(uint32 numVertices)
+        {
+            m_mesh = CreateSkinnedMesh(numVertices, NumJoints);
+            m_actor->SetMesh(0, 0, m_mesh);
+            if (GetParam())
+            {
+                m_deformer = DualQuatSkinDeformer::Create(m_mesh);
+            }
+            else
+            {
+                m_deformer = GetSoftSkinManager().CreateDeformer(m_mesh);
+            }
+            m_deformer->Reinitialize(m_actor.get(), m_actor->GetSkeleton()->GetNode(0), 0);
+        }
+
+        struct SkinnedVertices
+        {
+            AZStd::vector<AZ::Vector3> m_positions;
+            AZStd::vector<AZ::Vector3> m_normals;
+            AZStd::vector<AZ::Vector4> m_tangents;
+            AZStd::vector<AZ::Vector3> m_bitangents;
+        };
+
+        SkinnedVertices Skin(bool useBatchedSkinning, bool useMultiThreadedSkinning)
+        {
+            GetSoftSkinManager().SetUseBatchedSkinning(useBatchedSkinning);
+            GetSoftSkinManager().SetUseMultiThreadedSkinning(useMultiThreadedSkinning);
+            m_mesh->ResetToOriginalData();
+            m_deformer->Update(m_actorInstance, m_actor->GetSkeleton()->GetNode(0), 0.0f);
+
+            const size_t numVertices = m_mesh->GetNumVertices();
+            const AZ::Vector3* positions = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+            const AZ::Vector3* normals = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+            const AZ::Vector4* tangents = static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
+            const AZ::Vector3* bitangents = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+
+            SkinnedVertices result;
+            result.m_positions.assign(positions, positions + numVertices);
+            result.m_normals.assign(normals, normals + numVertices);
+            result.m_tangents.assign(tangents, tangents + numVertices);
+            result.m_bitangents.assign(bitangents, bitangents + numVertices);
+            return result;
+        }
+
+        void ExpectClose(const SkinnedVertices& actual, const SkinnedVertices& expected)
+        {
+            ASSERT_EQ(actual.m_positions.size(), expected.m_positions.size());
+            for (size_t v = 0; v < expected.m_positions.size(); ++v)
+            {
+                EXPECT_THAT(actual.m_positions[v], IsClose(expected.m_positions[v])) << "Vertex " << v;
+                EXPECT_THAT(actual.m_normals[v], IsClose(expected.m_normals[v])) << "Vertex " << v;
+                EXPECT_THAT(actual.m_tangents[v], IsClose(expected.m_tangents[v])) << "Vertex " << v;
+                EXPECT_THAT(actual.m_bitangents[v], IsClose(expected.m_bitangents[v])) << "Vertex " << v;
+            }
+        }
+
+    protected:
+        AZStd::unique_ptr<Actor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+        Mesh* m_mesh = nullptr;
+        MeshDeformer* m_deformer = nullptr;
+    };
+    INSTANTIATE_TEST_CASE_P(SkinningDeformerTests, SkinningDeformerFixture, ::testing::Bool());
+
+    TEST_P(SkinningDeformerFixture, PackInfluencesPerVertex)
+    {
+        CreateDeformer(300);
+
+        const PackedSkinInfluences& influences = GetParam()
+            ? static_cast<DualQuatSkinDeformer*>(m_deformer)->GetPackedInfluences()
+            : static_cast<SoftSkinDeformer*>(m_deformer)->GetPackedInfluences();
+        ASSERT_EQ(influences.GetNumVertices(), size_t{ 300 });
+        EXPECT_EQ(influences.GetNumInfluencesPerVertex(), size_t{ 4 });
+
+        SkinningInfoVertexAttributeLayer* skinningLayer = static_cast<SkinningInfoVertexAttributeLayer*>(m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+        for (uint32 v = 0; v < 300; ++v)
+        {
+            ASSERT_EQ(influences.GetNumInfluences(v), skinningLayer->GetNumInfluences(v));
+            for (size_t i = 0; i < influences.GetNumInfluences(v); ++i)
+            {
+                EXPECT_EQ(influences.GetBoneNumbers(v)[i], skinningLayer->GetInfluence(v, i)->GetBoneNr());
+                EXPECT_FLOAT_EQ(influences.GetWeights(v)[i], skinningLayer->GetInfluence(v, i)->GetWeight());
+            }
+        }
+    }
+
+    TEST_P(SkinningDeformerFixture, BatchedSkinningMatchesPerInfluenceSkinning)
+    {
+        CreateDeformer(300);
+
+        const SkinnedVertices expected = Skin(/*useBatchedSkinning=*/false, /*useMultiThreadedSkinning=*/false);
+        const SkinnedVertices actual = Skin(/*useBatchedSkinning=*/true, /*useMultiThreadedSkinning=*/false);
+        ExpectClose(actual, expected);
+    }
+
+    TEST_P(SkinningDeformerFixture, MultiThreadedSkinningMatchesSingleThreadedSkinning)
+    {
+        // large enough to be split into multiple batches
+        CreateDeformer(25000);
+
+        const SkinnedVertices expected = Skin(/*useBatchedSkinning=*/false, /*useMultiThreadedSkinning=*/false);
+        const SkinnedVertices actual = Skin(/*useBatchedSkinning=*/true, /*useMultiThreadedSkinning=*/true);
+        ExpectClose(actual, expected);
+    }
+
+#ifdef HAVE_BENCHMARK
+    //! Skins a mesh with one million vertices.
+    //! The first argument selects the dual quaternion deformer over the soft skin deformer, the second one the batched skinning path
+    //! and the third one splitting the mesh into jobs.
+    class SkinningDeformerBenchmarkFixture
+        : public EMotionFXBenchmarkFixture
+    {
+    protected:
+        static constexpr uint32 NumVertices = 1000000;
+        static constexpr size_t NumJoints = 50;
+
+        void SetUpBenchmark(const ::benchmark::State& state) override
+        {
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(NumJoints);
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+            PoseActorInstance(m_actorInstance);
+
+            m_mesh = CreateSkinnedMesh(NumVertices, NumJoints);
+            m_actor->SetMesh(0, 0, m_mesh);
+            if (state.range(0))
+            {
+                m_deformer = DualQuatSkinDeformer::Create(m_mesh);
+            }
+            else
+            {
+                m_deformer = GetSoftSkinManager().CreateDeformer(m_mesh);
+            }
+            m_deformer->Reinitialize(m_actor.get(), m_actor->GetSkeleton()->GetNode(0), 0);
+
+            GetSoftSkinManager().SetUseBatchedSkinning(state.range(1) != 0);
+            GetSoftSkinManager().SetUseMultiThreadedSkinning(state.range(2) != 0);
+        }
+
+        void TearDownBenchmark() override
+        {
+            m_deformer->Destroy();
+            m_actorInstance->Destroy();
+            m_actor.reset();
+        }
+
+        AZStd::unique_ptr<Actor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+        Mesh* m_mesh = nullptr;
+        MeshDeformer* m_deformer = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(SkinningDeformerBenchmarkFixture, BM_SkinMesh)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_mesh->ResetToOriginalData();
+            m_deformer->Update(m_actorInstance, m_actor->GetSkeleton()->GetNode(0), 0.0f);
+        }
+        state.SetItemsProcessed(state.iterations() * NumVertices);
+    }
+    BENCHMARK_REGISTER_F(SkinningDeformerBenchmarkFixture, BM_SkinMesh)
+        ->ArgNames({ "DualQuat", "Batched", "MultiThreaded" })
+        ->Args({ 0, 0, 0 })
+        ->Args({ 0, 1, 0 })
+        ->Args({ 0, 1, 1 })
+        ->Args({ 1, 0, 0 })
+        ->Args({ 1, 1, 0 })
+        ->Args({ 1, 1, 1 })
+        ->Unit(benchmark::kMillisecond);
+#endif // HAVE_BENCHMARK
+} // namespace EMotionFX
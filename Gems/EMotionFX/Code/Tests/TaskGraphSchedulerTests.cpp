@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/AttachmentNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
+#include <EMotionFX/Source/TaskGraphScheduler.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+#ifdef HAVE_BENCHMARK
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <EMotionFX/Source/MotionSystem.h>
+#include <Tests/EMotionFXBenchmarkFixture.h>
+#endif
+
+namespace EMotionFX
+{
+    class TaskGraphSchedulerFixture
+        : public SystemComponentFixture
+    {
+    public:
+        static constexpr size_t NumActorInstances = 7;
+
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            m_executor = AZStd::make_unique<AZ::TaskExecutor>(2);
+            m_scheduler = TaskGraphScheduler::Create(m_executor.get());
+            GetActorManager().SetScheduler(m_scheduler);
+
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(3);
+            for (size_t i = 0; i < NumActorInstances; ++i)
+            {
+                m_actorInstances.emplace_back(ActorInstance::Create(m_actor.get()));
+            }
+        }
+
+        void TearDown() override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+            m_actor.reset();
+
+            GetActorManager().SetScheduler(MultiThreadScheduler::Create());
+            m_scheduler = nullptr;
+            m_executor.reset();
+
+            SystemComponentFixture::TearDown();
+        }
+
+        void Attach(size_t parentIndex, size_t childIndex)
+        {
+            ActorInstance* parent = m_actorInstances[parentIndex];
+            parent->AddAttachment(AttachmentNode::Create(parent, 0, m_actorInstances[childIndex]));
+        }
+
+        //! Checks that every actor instance is scheduled exactly once, and that attachments are in the same batch, after their parent.
+        void ExpectValidSchedule()
+        {
+            AZStd::unordered_map<const ActorInstance*, AZStd::pair<size_t, size_t>> batchAndItemIndices;
+            for (size_t batchIndex = 0; batchIndex < m_scheduler->GetNumBatches(); ++batchIndex)
+            {
+                const TaskGraphScheduler::Batch& batch = m_scheduler->GetBatch(batchIndex);
+                for (size_t itemIndex = 0; itemIndex < batch.m_items.size(); ++itemIndex)
+                {
+                    const TaskGraphScheduler::BatchItem& item = batch.m_items[itemIndex];
+                    EXPECT_TRUE(batchAndItemIndices.emplace(item.m_actorInstance, AZStd::make_pair(batchIndex, itemIndex)).second)
+                        << "Actor instance scheduled more than once.";
+                    EXPECT_GT(item.m_subtreeEnd, itemIndex);
+                    EXPECT_LE(item.m_subtreeEnd, batch.m_items.size());
+                }
+            }
+            ASSERT_EQ(batchAndItemIndices.size(), m_actorInstances.size());
+
+            for (const ActorInstance* actorInstance : m_actorInstances)
+            {
+                const ActorInstance* parent = actorInstance->GetAttachedTo();
+                if (parent)
+                {
+                    const auto& [parentBatch, parentItem] = batchAndItemIndices[parent];
+                    const auto& [batch, item] = batchAndItemIndices[actorInstance];
+                    EXPECT_EQ(batch, parentBatch) << "An attachment has to be updated in the same batch as its parent.";
+                    EXPECT_GT(item, parentItem) << "An attachment has to be updated after its parent.";
+                    EXPECT_LE(item, m_scheduler->GetBatch(parentBatch).m_items[parentItem].m_subtreeEnd);
+                }
+            }
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::TaskExecutor> m_executor;
+        TaskGraphScheduler* m_scheduler = nullptr;
+        AZStd::unique_ptr<Actor> m_actor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    TEST_F(TaskGraphSchedulerFixture, ScheduleRootActorInstances)
+    {
+        m_scheduler->UpdateSchedule();
+
+        EXPECT_EQ(m_scheduler->GetNumBatches(), AZStd::min(static_cast<size_t>(m_executor->GetThreadCount()), NumActorInstances));
+        ExpectValidSchedule();
+    }
+
+    TEST_F(TaskGraphSchedulerFixture, ScheduleOneBatchPerWorkerThreadWithDefaultSettings)
+    {
+        // EMotion FX defaults to a single thread, which shouldn't limit the task graph scheduler to a single serial batch.
+        EXPECT_EQ(GetEMotionFX().GetNumThreads(), size_t{ 1 });
+
+        m_scheduler->UpdateSchedule();
+
+        EXPECT_GT(m_scheduler->GetNumBatches(), size_t{ 1 });
+        EXPECT_EQ(m_scheduler->GetNumBatches(), static_cast<size_t>(m_executor->GetThreadCount()));
+        EXPECT_GE(GetEMotionFX().GetNumThreads(), m_scheduler->GetNumBatches());
+        ExpectValidSchedule();
+
+        m_scheduler->Execute(0.1f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), NumActorInstances);
+    }
+
+    TEST_F(TaskGraphSchedulerFixture, ScheduleAttachmentsAfterTheirParent)
+    {
+        Attach(0, 1);
+        Attach(1, 2);
+        Attach(3, 4);
+        m_scheduler->UpdateSchedule();
+
+        EXPECT_EQ(GetActorManager().GetNumRootActorInstances(), size_t{ 4 });
+        EXPECT_EQ(m_scheduler->GetNumBatches(), AZStd::min(static_cast<size_t>(m_executor->GetThreadCount()), size_t{ 4 }));
+        ExpectValidSchedule();
+    }
+
+    TEST_F(TaskGraphSchedulerFixture, RemovingAttachmentRebuildsSchedule)
+    {
+        Attach(0, 1);
+        Attach(1, 2);
+        m_scheduler->UpdateSchedule();
+        ExpectValidSchedule();
+
+        m_actorInstances[0]->RemoveAttachment(size_t{ 0 });
+        m_scheduler->UpdateSchedule();
+
+        EXPECT_EQ(GetActorManager().GetNumRootActorInstances(), NumActorInstances - 1);
+        ExpectValidSchedule();
+    }
+
+    TEST_F(TaskGraphSchedulerFixture, ExecuteUpdatesEnabledActorInstances)
+    {
+        Attach(0, 1);
+        Attach(1, 2);
+        Attach(3, 4);
+
+        m_scheduler->Execute(0.1f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), NumActorInstances);
+
+        // Disabling an actor instance also skips its attachments.
+        m_actorInstances[1]->SetIsEnabled(false);
+        m_scheduler->Execute(0.1f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), NumActorInstances - 2);
+
+        m_actorInstances[1]->SetIsEnabled(true);
+        m_scheduler->Execute(0.1f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), NumActorInstances);
+    }
+
+#ifdef HAVE_BENCHMARK
+    //! Updates actor instances playing a motion, where every tenth actor instance has an attachment.
+    //! The first argument is the number of actor instances, the second one selects the TaskGraphScheduler over the MultiThreadScheduler.
+    class ActorUpdateSchedulerBenchmarkFixture
+        : public EMotionFXBenchmarkFixture
+    {
+    protected:
+        static constexpr size_t NumJoints = 20;
+
+        void SetUpBenchmark(const ::benchmark::State& state) override
+        {
+            m_executor = AZStd::make_unique<AZ::TaskExecutor>(NumWorkerThreads);
+            if (state.range(1))
+            {
+                GetActorManager().SetScheduler(TaskGraphScheduler::Create(m_executor.get()));
+            }
+            else
+            {
+                GetActorManager().SetScheduler(MultiThreadScheduler::Create());
+            }
+
+            NonUniformMotionData sourceData;
+            for (size_t i = 0; i < NumJoints; ++i)
+            {
+                sourceData.AddJoint(i == 0 ? AZStd::string("rootJoint") : AZStd::string::format("joint%zu", i), Transform::CreateIdentity(), Transform::CreateIdentity());
+                sourceData.AllocateJointRotationSamples(i, 2);
+                sourceData.SetJointRotationSample(i, 0, { 0.0f, AZ::Quaternion::CreateIdentity() });
+                sourceData.SetJointRotationSample(i, 1, { 1.0f, AZ::Quaternion::CreateRotationZ(1.0f) });
+            }
+            sourceData.UpdateDuration();
+
+            UniformMotionData* motionData = aznew UniformMotionData();
+            motionData->InitFromNonUniformData(&sourceData, false, 30.0f);
+            m_motion = aznew Motion("BenchmarkMotion");
+            m_motion->SetMotionData(motionData);
+            m_motion->UpdateDuration();
+
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(NumJoints);
+            const size_t numActorInstances = static_cast<size_t>(state.range(0));
+            m_actorInstances.reserve(numActorInstances + numActorInstances / 10);
+            for (size_t i = 0; i < numActorInstances; ++i)
+            {
+                ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+                actorInstance->GetMotionSystem()->PlayMotion(m_motion);
+                m_actorInstances.emplace_back(actorInstance);
+
+                if (i % 10 == 0)
+                {
+                    ActorInstance* attachmentInstance = ActorInstance::Create(m_actor.get());
+                    actorInstance->AddAttachment(AttachmentNode::Create(actorInstance, NumJoints - 1, attachmentInstance));
+                    m_actorInstances.emplace_back(attachmentInstance);
+                }
+            }
+        }
+
+        void TearDownBenchmark() override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances = {};
+            m_actor.reset();
+            m_motion->Destroy();
+
+            GetActorManager().SetScheduler(MultiThreadScheduler::Create());
+            m_executor.reset();
+        }
+
+        AZStd::unique_ptr<AZ::TaskExecutor> m_executor;
+        AZStd::unique_ptr<Actor> m_actor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+        Motion* m_motion = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(ActorUpdateSchedulerBenchmarkFixture, BM_UpdateActorInstances)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            GetActorManager().UpdateActorInstances(1.0f / 60.0f);
+        }
+        state.SetItemsProcessed(state.iterations() * m_actorInstances.size());
+    }
+    BENCHMARK_REGISTER_F(ActorUpdateSchedulerBenchmarkFixture, BM_UpdateActorInstances)
+        ->ArgNames({ "ActorInstances", "TaskGraph" })
+        ->Args({ 500, 0 })
+        ->Args({ 500, 1 })
+        ->Args({ 1000, 0 })
+        ->Args({ 1000, 1 })
+        ->Args({ 5000, 0 })
+        ->Args({ 5000, 1 })
+        ->Unit(benchmark::kMillisecond);
+#endif // HAVE_BENCHMARK
+} // namespace EMotionFX
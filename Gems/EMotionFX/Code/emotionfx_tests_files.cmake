@@ -35,6 +35,7 @@ set(FILES
     Tests/AnimGraphNodeEventFilterTests.cpp
     Tests/AnimGraphNodeGroupTests.cpp
     Tests/AnimGraphNodeProcessingTests.cpp
+    Tests/AnimGraphOutputProgramTests.cpp
     Tests/AnimGraphParameterActionTests.cpp
     Tests/AnimGraphParameterActionTests.cpp
     Tests/AnimGraphParameterConditionCommandTests.cpp
@@ -77,6 +78,8 @@ set(FILES
     Tests/BlendTreeTwoLinkIKNodeTests.cpp
     Tests/BoolLogicNodeTests.cpp
     Tests/ColliderCommandTests.cpp
+    Tests/CompressedMotionDataTests.cpp
+    Tests/EMotionFXBenchmarkFixture.h
     Tests/EMotionFXTest.cpp
     Tests/EmotionFXMathLibTests.cpp
     Tests/EventManagerTests.cpp
@@ -108,9 +111,11 @@ set(FILES
     Tests/SimulatedObjectSerializeTests.cpp
     Tests/SkeletalLODTests.cpp
     Tests/SkeletonNodeSearchTests.cpp
+    Tests/SkinningDeformerTests.cpp
     Tests/SyncingSystemTests.cpp
     Tests/SystemComponentFixture.h
     Tests/SystemComponentTests.cpp
+    Tests/TaskGraphSchedulerTests.cpp
     Tests/TransformUnitTests.cpp
     Tests/Vector2ToVector3CompatibilityTests.cpp
     Tests/Vector3ParameterTests.cpp
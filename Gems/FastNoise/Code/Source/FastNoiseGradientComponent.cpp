@@ -14,6 +14,7 @@
 #include <External/FastNoise/FastNoise.h>
 #include <LmbrCentral/Dependency/DependencyNotificationBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
+#include <GradientSignal/Util.h>
 
 namespace FastNoiseGem
 {
@@ -281,6 +282,7 @@ namespace FastNoiseGem
         m_generator.SetCellularDistanceFunction(m_configuration.m_cellularDistanceFunction);
         m_generator.SetCellularReturnType(m_configuration.m_cellularReturnType);
         m_generator.SetCellularJitter(m_configuration.m_cellularJitter);
+        m_simdGenerator.SetGenerator(m_generator);
 
         GradientSignal::GradientRequestBus::Handler::BusConnect(GetEntityId());
         FastNoiseGradientRequestBus::Handler::BusConnect(GetEntityId());
@@ -343,20 +345,64 @@ namespace FastNoiseGem
             return;
         }
 
-        AZStd::shared_lock<decltype(m_transformMutex)> lock(m_transformMutex);
-        AZ::Vector3 uvw;
+        using GradientSignal::GradientTransform;
+        AZ::Vector3 uvws[GradientTransform::TransformChunkSize];
+        bool wasPointRejected[GradientTransform::TransformChunkSize];
 
-        for (size_t index = 0; index < positions.size(); index++)
         {
-            bool wasPointRejected = false;
-
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
+            AZStd::shared_lock<decltype(m_transformMutex)> lock(m_transformMutex);
 
-            // Generator returns a range between [-1, 1], map that to [0, 1]
-            outValues[index] = wasPointRejected ?
-                0.0f :
-                AZ::GetClamp((m_generator.GetNoise(uvw.GetX(), uvw.GetY(), uvw.GetZ()) + 1.0f) / 2.0f, 0.0f, 1.0f);
+            // Transform the positions one chunk at a time, then generate the noise for the chunk four points at a time.
+            for (size_t chunkStart = 0; chunkStart < positions.size(); chunkStart += GradientTransform::TransformChunkSize)
+            {
+                const size_t chunkSize = AZStd::min(GradientTransform::TransformChunkSize, positions.size() - chunkStart);
+                const AZStd::span<float> chunkValues = outValues.subspan(chunkStart, chunkSize);
+
+                m_gradientTransform.TransformPositionsToUVW(
+                    positions.subspan(chunkStart, chunkSize), AZStd::span<AZ::Vector3>(uvws, chunkSize),
+                    AZStd::span<bool>(wasPointRejected, chunkSize));
+
+                for (size_t blockStart = 0; blockStart < chunkSize; blockStart += 4)
+                {
+                    const size_t blockSize = AZStd::min<size_t>(4, chunkSize - blockStart);
+
+                    // The points at the end of the chunk that don't fill a full block of four get padded with zeros.
+                    float x[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+                    float y[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+                    float z[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+                    bool allPointsRejected = true;
+                    for (size_t lane = 0; lane < blockSize; lane++)
+                    {
+                        const AZ::Vector3& uvw = uvws[blockStart + lane];
+                        x[lane] = uvw.GetX();
+                        y[lane] = uvw.GetY();
+                        z[lane] = uvw.GetZ();
+                        allPointsRejected = allPointsRejected && wasPointRejected[blockStart + lane];
+                    }
+
+                    // Rejected points are set to -1, which maps to 0 below.
+                    float noise[4] = { -1.0f, -1.0f, -1.0f, -1.0f };
+                    if (!allPointsRejected)
+                    {
+                        m_simdGenerator.GetNoise4(x, y, z, noise);
+                    }
+
+                    for (size_t lane = 0; lane < blockSize; lane++)
+                    {
+                        chunkValues[blockStart + lane] = wasPointRejected[blockStart + lane] ? -1.0f : noise[lane];
+                    }
+                }
+            }
         }
+
+        // Generator returns a range between [-1, 1], map that to [0, 1] four values at a time.
+        const AZ::Simd::Vec4::FloatType zero = AZ::Simd::Vec4::ZeroFloat();
+        const AZ::Simd::Vec4::FloatType one = AZ::Simd::Vec4::Splat(1.0f);
+        const AZ::Simd::Vec4::FloatType two = AZ::Simd::Vec4::Splat(2.0f);
+        GradientSignal::TransformValues(outValues, [&](AZ::Simd::Vec4::FloatArgType value)
+        {
+            return AZ::Simd::Vec4::Clamp(AZ::Simd::Vec4::Div(AZ::Simd::Vec4::Add(value, one), two), zero, one);
+        });
     }
 
     template <typename TValueType, TValueType FastNoiseGradientConfig::*TConfigMember, void (FastNoise::*TMethod)(TValueType)>
@@ -364,6 +410,7 @@ namespace FastNoiseGem
     {
         m_configuration.*TConfigMember = value;
         ((&m_generator)->*TMethod)(value);
+        m_simdGenerator.SetGenerator(m_generator);
         LmbrCentral::DependencyNotificationBus::Event(GetEntityId(), &LmbrCentral::DependencyNotificationBus::Events::OnCompositionChanged);
     }
 
@@ -16,6 +16,7 @@
 #include <FastNoise/Ebuses/FastNoiseGradientRequestBus.h>
 
 #include <External/FastNoise/FastNoise.h>
+#include <FastNoiseSimd.h>
 
 namespace AZ
 {
@@ -97,6 +98,7 @@ namespace FastNoiseGem
     protected:
         FastNoiseGradientConfig m_configuration;
         FastNoise m_generator;
+        FastNoiseSimd m_simdGenerator;
         GradientSignal::GradientTransform m_gradientTransform;
         mutable AZStd::shared_mutex m_transformMutex;
 
@@ -0,0 +1,449 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <FastNoiseSimd.h>
+
+#include <AzCore/Math/SimdMath.h>
+
+#include <random>
+
+namespace FastNoiseGem
+{
+    namespace
+    {
+        using AZ::Simd::Vec4;
+
+        // Copies of the tables and constants in External/FastNoise/FastNoise.cpp that the 3D Value and Simplex noise use.
+        const float VAL_LUT[] =
+        {
+            0.3490196078f, 0.4352941176f, -0.4509803922f, 0.6392156863f, 0.5843137255f, -0.1215686275f, 0.7176470588f, -0.1058823529f, 0.3960784314f, 0.0431372549f, -0.03529411765f, 0.3176470588f, 0.7254901961f, 0.137254902f, 0.8588235294f, -0.8196078431f,
+            -0.7960784314f, -0.3333333333f, -0.6705882353f, -0.3882352941f, 0.262745098f, 0.3254901961f, -0.6470588235f, -0.9215686275f, -0.5294117647f, 0.5294117647f, -0.4666666667f, 0.8117647059f, 0.3803921569f, 0.662745098f, 0.03529411765f, -0.6156862745f,
+            -0.01960784314f, -0.3568627451f, -0.09019607843f, 0.7490196078f, 0.8352941176f, -0.4039215686f, -0.7490196078f, 0.9529411765f, -0.0431372549f, -0.9294117647f, -0.6549019608f, 0.9215686275f, -0.06666666667f, -0.4431372549f, 0.4117647059f, -0.4196078431f,
+            -0.7176470588f, -0.8117647059f, -0.2549019608f, 0.4901960784f, 0.9137254902f, 0.7882352941f, -1.0f, -0.4745098039f, 0.7960784314f, 0.8509803922f, -0.6784313725f, 0.4588235294f, 1.0f, -0.1843137255f, 0.4509803922f, 0.1450980392f,
+            -0.231372549f, -0.968627451f, -0.8588235294f, 0.4274509804f, 0.003921568627f, -0.003921568627f, 0.2156862745f, 0.5058823529f, 0.7647058824f, 0.2078431373f, -0.5921568627f, 0.5764705882f, -0.1921568627f, -0.937254902f, 0.08235294118f, -0.08235294118f,
+            0.9058823529f, 0.8274509804f, 0.02745098039f, -0.168627451f, -0.7803921569f, 0.1137254902f, -0.9450980392f, 0.2f, 0.01960784314f, 0.5607843137f, 0.2705882353f, 0.4431372549f, -0.9607843137f, 0.6156862745f, 0.9294117647f, -0.07450980392f,
+            0.3098039216f, 0.9921568627f, -0.9137254902f, -0.2941176471f, -0.3411764706f, -0.6235294118f, -0.7647058824f, -0.8901960784f, 0.05882352941f, 0.2392156863f, 0.7333333333f, 0.6549019608f, 0.2470588235f, 0.231372549f, -0.3960784314f, -0.05098039216f,
+            -0.2235294118f, -0.3725490196f, 0.6235294118f, 0.7019607843f, -0.8274509804f, 0.4196078431f, 0.07450980392f, 0.8666666667f, -0.537254902f, -0.5058823529f, -0.8039215686f, 0.09019607843f, -0.4823529412f, 0.6705882353f, -0.7882352941f, 0.09803921569f,
+            -0.6078431373f, 0.8039215686f, -0.6f, -0.3254901961f, -0.4117647059f, -0.01176470588f, 0.4823529412f, 0.168627451f, 0.8745098039f, -0.3647058824f, -0.1607843137f, 0.568627451f, -0.9921568627f, 0.9450980392f, 0.5137254902f, 0.01176470588f,
+            -0.1450980392f, -0.5529411765f, -0.5764705882f, -0.1137254902f, 0.5215686275f, 0.1607843137f, 0.3725490196f, -0.2f, -0.7254901961f, 0.631372549f, 0.7098039216f, -0.568627451f, 0.1294117647f, -0.3098039216f, 0.7411764706f, -0.8509803922f,
+            0.2549019608f, -0.6392156863f, -0.5607843137f, -0.3176470588f, 0.937254902f, 0.9843137255f, 0.5921568627f, 0.6941176471f, 0.2862745098f, -0.5215686275f, 0.1764705882f, 0.537254902f, -0.4901960784f, -0.4588235294f, -0.2078431373f, -0.2156862745f,
+            0.7725490196f, 0.3647058824f, -0.2392156863f, 0.2784313725f, -0.8823529412f, 0.8980392157f, 0.1215686275f, 0.1058823529f, -0.8745098039f, -0.9843137255f, -0.7019607843f, 0.9607843137f, 0.2941176471f, 0.3411764706f, 0.1529411765f, 0.06666666667f,
+            -0.9764705882f, 0.3019607843f, 0.6470588235f, -0.5843137255f, 0.05098039216f, -0.5137254902f, -0.137254902f, 0.3882352941f, -0.262745098f, -0.3019607843f, -0.1764705882f, -0.7568627451f, 0.1843137255f, -0.5450980392f, -0.4980392157f, -0.2784313725f,
+            -0.9529411765f, -0.09803921569f, 0.8901960784f, -0.2862745098f, -0.3803921569f, 0.5529411765f, 0.7803921569f, -0.8352941176f, 0.6862745098f, 0.7568627451f, 0.4980392157f, -0.6862745098f, -0.8980392157f, -0.7725490196f, -0.7098039216f, -0.2470588235f,
+            -0.9058823529f, 0.9764705882f, 0.1921568627f, 0.8431372549f, -0.05882352941f, 0.3568627451f, 0.6078431373f, 0.5450980392f, 0.4039215686f, -0.7333333333f, -0.4274509804f, 0.6f, 0.6784313725f, -0.631372549f, -0.02745098039f, -0.1294117647f,
+            0.3333333333f, -0.8431372549f, 0.2235294118f, -0.3490196078f, -0.6941176471f, 0.8823529412f, 0.4745098039f, 0.4666666667f, -0.7411764706f, -0.2705882353f, 0.968627451f, 0.8196078431f, -0.662745098f, -0.4352941176f, -0.8666666667f, -0.1529411765f,
+        };
+
+        constexpr float F3 = 1.0f / 3.0f;
+        constexpr float G3 = 1.0f / 6.0f;
+
+        // The generator settings the SIMD noise functions need, under the same names as the FastNoise members.
+        struct NoiseSettings
+        {
+            unsigned char Index3D_12(unsigned char offset, int x, int y, int z) const
+            {
+                return m_perm12[(x & 0xff) + m_perm[(y & 0xff) + m_perm[(z & 0xff) + offset]]];
+            }
+
+            const unsigned char* m_perm;
+            const unsigned char* m_perm12;
+            FastNoise::Interp m_interp;
+            FastNoise::FractalType m_fractalType;
+            int m_octaves;
+            float m_lacunarity;
+            float m_gain;
+            float m_fractalBounding;
+        };
+
+        // SIMD versions of the 3D Value, Perlin and Simplex noise of FastNoise, evaluating four positions at a time.
+        // The operations are done in the same order as in the scalar versions. The permutation table lookups are done one lane
+        // at a time, since there are no gather instructions to use for them.
+        using SingleNoiseFunc = Vec4::FloatType (*)(const NoiseSettings&, unsigned char, Vec4::FloatArgType, Vec4::FloatArgType, Vec4::FloatArgType);
+
+        // Same as the scalar FastFloor(), which also rounds negative whole numbers down to the next integer.
+        Vec4::Int32Type FastFloor(Vec4::FloatArgType f)
+        {
+            // The comparison mask is -1 in the lanes that are negative.
+            return Vec4::Add(Vec4::ConvertToInt(f), Vec4::CastToInt(Vec4::CmpLt(f, Vec4::ZeroFloat())));
+        }
+
+        Vec4::FloatType Lerp(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType t)
+        {
+            return Vec4::Add(a, Vec4::Mul(t, Vec4::Sub(b, a)));
+        }
+
+        Vec4::FloatType Interp(FastNoise::Interp interp, Vec4::FloatArgType t)
+        {
+            switch (interp)
+            {
+            case FastNoise::Linear:
+                return t;
+            case FastNoise::Hermite:
+                return Vec4::Mul(Vec4::Mul(t, t), Vec4::Sub(Vec4::Splat(3.0f), Vec4::Mul(Vec4::Splat(2.0f), t)));
+            case FastNoise::Quintic:
+                return Vec4::Mul(
+                    Vec4::Mul(Vec4::Mul(t, t), t),
+                    Vec4::Add(Vec4::Mul(t, Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f))), Vec4::Splat(10.0f)));
+            default:
+                return Vec4::ZeroFloat();
+            }
+        }
+
+        // The GRAD_X, GRAD_Y and GRAD_Z lookup of GradCoord3D() without the tables: the first term is x for lutPos < 8 and y
+        // otherwise, the second term is y for lutPos < 4 and z otherwise, and the low two bits negate them.
+        Vec4::FloatType Gradient(Vec4::Int32ArgType lutPos, Vec4::FloatArgType xd, Vec4::FloatArgType yd, Vec4::FloatArgType zd)
+        {
+            const Vec4::FloatType signBit = Vec4::Splat(-0.0f);
+            const Vec4::FloatType useXForU = Vec4::CastToFloat(Vec4::CmpLt(lutPos, Vec4::Splat(8)));
+            const Vec4::FloatType useYForV = Vec4::CastToFloat(Vec4::CmpLt(lutPos, Vec4::Splat(4)));
+            const Vec4::FloatType negateU = Vec4::CastToFloat(Vec4::CmpNeq(Vec4::And(lutPos, Vec4::Splat(1)), Vec4::ZeroInt()));
+            const Vec4::FloatType negateV = Vec4::CastToFloat(Vec4::CmpNeq(Vec4::And(lutPos, Vec4::Splat(2)), Vec4::ZeroInt()));
+
+            const Vec4::FloatType u = Vec4::Select(xd, yd, useXForU);
+            const Vec4::FloatType v = Vec4::Select(yd, zd, useYForV);
+            return Vec4::Add(Vec4::Xor(u, Vec4::And(negateU, signBit)), Vec4::Xor(v, Vec4::And(negateV, signBit)));
+        }
+
+        // Same as GradCoord3D(), with the hash done one lane at a time.
+        Vec4::FloatType GradCoord3D(
+            const NoiseSettings& noise, unsigned char offset, Vec4::Int32ArgType x, Vec4::Int32ArgType y, Vec4::Int32ArgType z,
+            Vec4::FloatArgType xd, Vec4::FloatArgType yd, Vec4::FloatArgType zd)
+        {
+            int32_t xi[4], yi[4], zi[4], lutPos[4];
+            Vec4::StoreUnaligned(xi, x);
+            Vec4::StoreUnaligned(yi, y);
+            Vec4::StoreUnaligned(zi, z);
+            for (int lane = 0; lane < 4; lane++)
+            {
+                lutPos[lane] = noise.Index3D_12(offset, xi[lane], yi[lane], zi[lane]);
+            }
+
+            return Gradient(Vec4::LoadUnaligned(lutPos), xd, yd, zd);
+        }
+
+        // Index3D_256() or Index3D_12() for the 8 corners of the cells of four positions, indexed by (z << 2) | (y << 1) | x.
+        // The lookups of the z and y coordinates are shared between the corners.
+        void CornerIndices(
+            const NoiseSettings& noise, const unsigned char* lastPerm, unsigned char offset, Vec4::Int32ArgType x0, Vec4::Int32ArgType y0,
+            Vec4::Int32ArgType z0, int32_t lutPos[8][4])
+        {
+            int32_t xi[4], yi[4], zi[4];
+            Vec4::StoreUnaligned(xi, x0);
+            Vec4::StoreUnaligned(yi, y0);
+            Vec4::StoreUnaligned(zi, z0);
+
+            for (int lane = 0; lane < 4; lane++)
+            {
+                for (int dz = 0; dz < 2; dz++)
+                {
+                    const int zHash = noise.m_perm[((zi[lane] + dz) & 0xff) + offset];
+                    for (int dy = 0; dy < 2; dy++)
+                    {
+                        const int yHash = noise.m_perm[((yi[lane] + dy) & 0xff) + zHash];
+                        for (int dx = 0; dx < 2; dx++)
+                        {
+                            lutPos[(dz << 2) | (dy << 1) | dx][lane] = lastPerm[((xi[lane] + dx) & 0xff) + yHash];
+                        }
+                    }
+                }
+            }
+        }
+
+        Vec4::FloatType SingleValue(
+            const NoiseSettings& noise, unsigned char offset, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            const Vec4::Int32Type x0 = FastFloor(x);
+            const Vec4::Int32Type y0 = FastFloor(y);
+            const Vec4::Int32Type z0 = FastFloor(z);
+
+            const Vec4::FloatType xs = Interp(noise.m_interp, Vec4::Sub(x, Vec4::ConvertToFloat(x0)));
+            const Vec4::FloatType ys = Interp(noise.m_interp, Vec4::Sub(y, Vec4::ConvertToFloat(y0)));
+            const Vec4::FloatType zs = Interp(noise.m_interp, Vec4::Sub(z, Vec4::ConvertToFloat(z0)));
+
+            int32_t lutPos[8][4];
+            CornerIndices(noise, noise.m_perm, offset, x0, y0, z0, lutPos);
+
+            Vec4::FloatType values[8];
+            for (int corner = 0; corner < 8; corner++)
+            {
+                values[corner] = Vec4::LoadImmediate(
+                    VAL_LUT[lutPos[corner][0]], VAL_LUT[lutPos[corner][1]], VAL_LUT[lutPos[corner][2]], VAL_LUT[lutPos[corner][3]]);
+            }
+
+            const Vec4::FloatType xf00 = Lerp(values[0], values[1], xs);
+            const Vec4::FloatType xf10 = Lerp(values[2], values[3], xs);
+            const Vec4::FloatType xf01 = Lerp(values[4], values[5], xs);
+            const Vec4::FloatType xf11 = Lerp(values[6], values[7], xs);
+
+            const Vec4::FloatType yf0 = Lerp(xf00, xf10, ys);
+            const Vec4::FloatType yf1 = Lerp(xf01, xf11, ys);
+
+            return Lerp(yf0, yf1, zs);
+        }
+
+        Vec4::FloatType SinglePerlin(
+            const NoiseSettings& noise, unsigned char offset, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            const Vec4::Int32Type x0 = FastFloor(x);
+            const Vec4::Int32Type y0 = FastFloor(y);
+            const Vec4::Int32Type z0 = FastFloor(z);
+
+            const Vec4::FloatType xd[2] = { Vec4::Sub(x, Vec4::ConvertToFloat(x0)), Vec4::Sub(xd[0], Vec4::Splat(1.0f)) };
+            const Vec4::FloatType yd[2] = { Vec4::Sub(y, Vec4::ConvertToFloat(y0)), Vec4::Sub(yd[0], Vec4::Splat(1.0f)) };
+            const Vec4::FloatType zd[2] = { Vec4::Sub(z, Vec4::ConvertToFloat(z0)), Vec4::Sub(zd[0], Vec4::Splat(1.0f)) };
+
+            const Vec4::FloatType xs = Interp(noise.m_interp, xd[0]);
+            const Vec4::FloatType ys = Interp(noise.m_interp, yd[0]);
+            const Vec4::FloatType zs = Interp(noise.m_interp, zd[0]);
+
+            int32_t lutPos[8][4];
+            CornerIndices(noise, noise.m_perm12, offset, x0, y0, z0, lutPos);
+
+            Vec4::FloatType gradients[8];
+            for (int corner = 0; corner < 8; corner++)
+            {
+                gradients[corner] = Gradient(Vec4::LoadUnaligned(lutPos[corner]), xd[corner & 1], yd[(corner >> 1) & 1], zd[corner >> 2]);
+            }
+
+            const Vec4::FloatType xf00 = Lerp(gradients[0], gradients[1], xs);
+            const Vec4::FloatType xf10 = Lerp(gradients[2], gradients[3], xs);
+            const Vec4::FloatType xf01 = Lerp(gradients[4], gradients[5], xs);
+            const Vec4::FloatType xf11 = Lerp(gradients[6], gradients[7], xs);
+
+            const Vec4::FloatType yf0 = Lerp(xf00, xf10, ys);
+            const Vec4::FloatType yf1 = Lerp(xf01, xf11, ys);
+
+            return Lerp(yf0, yf1, zs);
+        }
+
+        // The contribution of one simplex corner: 0 outside of its radius, t^4 * gradient inside.
+        Vec4::FloatType SimplexCorner(
+            const NoiseSettings& noise, unsigned char offset, Vec4::Int32ArgType i, Vec4::Int32ArgType j, Vec4::Int32ArgType k,
+            Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            Vec4::FloatType t = Vec4::Sub(Vec4::Sub(Vec4::Sub(Vec4::Splat(0.6f), Vec4::Mul(x, x)), Vec4::Mul(y, y)), Vec4::Mul(z, z));
+            const Vec4::FloatType isOutside = Vec4::CmpLt(t, Vec4::ZeroFloat());
+            t = Vec4::Mul(t, t);
+            const Vec4::FloatType n = Vec4::Mul(Vec4::Mul(t, t), GradCoord3D(noise, offset, i, j, k, x, y, z));
+            return Vec4::Select(Vec4::ZeroFloat(), n, isOutside);
+        }
+
+        Vec4::FloatType SingleSimplex(
+            const NoiseSettings& noise, unsigned char offset, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            const Vec4::FloatType t = Vec4::Mul(Vec4::Add(Vec4::Add(x, y), z), Vec4::Splat(F3));
+            const Vec4::Int32Type i = FastFloor(Vec4::Add(x, t));
+            const Vec4::Int32Type j = FastFloor(Vec4::Add(y, t));
+            const Vec4::Int32Type k = FastFloor(Vec4::Add(z, t));
+
+            const Vec4::FloatType t0 = Vec4::Mul(Vec4::ConvertToFloat(Vec4::Add(Vec4::Add(i, j), k)), Vec4::Splat(G3));
+            const Vec4::FloatType x0 = Vec4::Sub(x, Vec4::Sub(Vec4::ConvertToFloat(i), t0));
+            const Vec4::FloatType y0 = Vec4::Sub(y, Vec4::Sub(Vec4::ConvertToFloat(j), t0));
+            const Vec4::FloatType z0 = Vec4::Sub(z, Vec4::Sub(Vec4::ConvertToFloat(k), t0));
+
+            // Branchless version of the simplex corner selection in the scalar SingleSimplex().
+            const Vec4::Int32Type xGreaterY = Vec4::CastToInt(Vec4::CmpGtEq(x0, y0));
+            const Vec4::Int32Type yGreaterZ = Vec4::CastToInt(Vec4::CmpGtEq(y0, z0));
+            const Vec4::Int32Type xGreaterZ = Vec4::CastToInt(Vec4::CmpGtEq(x0, z0));
+            const Vec4::Int32Type one = Vec4::Splat(1);
+            const Vec4::Int32Type i1 = Vec4::And(Vec4::And(xGreaterY, Vec4::Or(yGreaterZ, xGreaterZ)), one);
+            const Vec4::Int32Type j1 = Vec4::And(Vec4::And(Vec4::Not(xGreaterY), yGreaterZ), one);
+            const Vec4::Int32Type k1 = Vec4::And(Vec4::And(Vec4::Not(yGreaterZ), Vec4::Or(Vec4::Not(xGreaterY), Vec4::Not(xGreaterZ))), one);
+            const Vec4::Int32Type i2 = Vec4::And(Vec4::Or(xGreaterY, Vec4::And(yGreaterZ, xGreaterZ)), one);
+            const Vec4::Int32Type j2 = Vec4::And(Vec4::Or(Vec4::Not(xGreaterY), yGreaterZ), one);
+            const Vec4::Int32Type k2 = Vec4::And(Vec4::Or(Vec4::Not(yGreaterZ), Vec4::And(Vec4::Not(xGreaterY), Vec4::Not(xGreaterZ))), one);
+
+            const Vec4::FloatType g1 = Vec4::Splat(G3);
+            const Vec4::FloatType g2 = Vec4::Splat(2 * G3);
+            const Vec4::FloatType g3 = Vec4::Splat(3 * G3);
+            const Vec4::FloatType x1 = Vec4::Add(Vec4::Sub(x0, Vec4::ConvertToFloat(i1)), g1);
+            const Vec4::FloatType y1 = Vec4::Add(Vec4::Sub(y0, Vec4::ConvertToFloat(j1)), g1);
+            const Vec4::FloatType z1 = Vec4::Add(Vec4::Sub(z0, Vec4::ConvertToFloat(k1)), g1);
+            const Vec4::FloatType x2 = Vec4::Add(Vec4::Sub(x0, Vec4::ConvertToFloat(i2)), g2);
+            const Vec4::FloatType y2 = Vec4::Add(Vec4::Sub(y0, Vec4::ConvertToFloat(j2)), g2);
+            const Vec4::FloatType z2 = Vec4::Add(Vec4::Sub(z0, Vec4::ConvertToFloat(k2)), g2);
+            const Vec4::FloatType x3 = Vec4::Add(Vec4::Sub(x0, Vec4::Splat(1.0f)), g3);
+            const Vec4::FloatType y3 = Vec4::Add(Vec4::Sub(y0, Vec4::Splat(1.0f)), g3);
+            const Vec4::FloatType z3 = Vec4::Add(Vec4::Sub(z0, Vec4::Splat(1.0f)), g3);
+
+            const Vec4::FloatType n0 = SimplexCorner(noise, offset, i, j, k, x0, y0, z0);
+            const Vec4::FloatType n1 = SimplexCorner(noise, offset, Vec4::Add(i, i1), Vec4::Add(j, j1), Vec4::Add(k, k1), x1, y1, z1);
+            const Vec4::FloatType n2 = SimplexCorner(noise, offset, Vec4::Add(i, i2), Vec4::Add(j, j2), Vec4::Add(k, k2), x2, y2, z2);
+            const Vec4::FloatType n3 = SimplexCorner(noise, offset, Vec4::Add(i, one), Vec4::Add(j, one), Vec4::Add(k, one), x3, y3, z3);
+
+            return Vec4::Mul(Vec4::Splat(32.0f), Vec4::Add(Vec4::Add(Vec4::Add(n0, n1), n2), n3));
+        }
+
+        template<SingleNoiseFunc SingleNoise>
+        Vec4::FloatType Fractal(const NoiseSettings& noise, Vec4::FloatType x, Vec4::FloatType y, Vec4::FloatType z)
+        {
+            const Vec4::FloatType lacunarity = Vec4::Splat(noise.m_lacunarity);
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType two = Vec4::Splat(2.0f);
+            float amp = 1.0f;
+
+            switch (noise.m_fractalType)
+            {
+            case FastNoise::FBM:
+            {
+                Vec4::FloatType sum = SingleNoise(noise, noise.m_perm[0], x, y, z);
+                for (int i = 1; i < noise.m_octaves; i++)
+                {
+                    x = Vec4::Mul(x, lacunarity);
+                    y = Vec4::Mul(y, lacunarity);
+                    z = Vec4::Mul(z, lacunarity);
+
+                    amp *= noise.m_gain;
+                    sum = Vec4::Add(sum, Vec4::Mul(SingleNoise(noise, noise.m_perm[i], x, y, z), Vec4::Splat(amp)));
+                }
+                return Vec4::Mul(sum, Vec4::Splat(noise.m_fractalBounding));
+            }
+            case FastNoise::Billow:
+            {
+                Vec4::FloatType sum = Vec4::Sub(Vec4::Mul(Vec4::Abs(SingleNoise(noise, noise.m_perm[0], x, y, z)), two), one);
+                for (int i = 1; i < noise.m_octaves; i++)
+                {
+                    x = Vec4::Mul(x, lacunarity);
+                    y = Vec4::Mul(y, lacunarity);
+                    z = Vec4::Mul(z, lacunarity);
+
+                    amp *= noise.m_gain;
+                    const Vec4::FloatType octave = Vec4::Sub(Vec4::Mul(Vec4::Abs(SingleNoise(noise, noise.m_perm[i], x, y, z)), two), one);
+                    sum = Vec4::Add(sum, Vec4::Mul(octave, Vec4::Splat(amp)));
+                }
+                return Vec4::Mul(sum, Vec4::Splat(noise.m_fractalBounding));
+            }
+            case FastNoise::RigidMulti:
+            {
+                Vec4::FloatType sum = Vec4::Sub(one, Vec4::Abs(SingleNoise(noise, noise.m_perm[0], x, y, z)));
+                for (int i = 1; i < noise.m_octaves; i++)
+                {
+                    x = Vec4::Mul(x, lacunarity);
+                    y = Vec4::Mul(y, lacunarity);
+                    z = Vec4::Mul(z, lacunarity);
+
+                    amp *= noise.m_gain;
+                    const Vec4::FloatType octave = Vec4::Sub(one, Vec4::Abs(SingleNoise(noise, noise.m_perm[i], x, y, z)));
+                    sum = Vec4::Sub(sum, Vec4::Mul(octave, Vec4::Splat(amp)));
+                }
+                return sum;
+            }
+            default:
+                return Vec4::ZeroFloat();
+            }
+        }
+    } // namespace
+
+    FastNoiseSimd::FastNoiseSimd()
+        : FastNoiseSimd(FastNoise())
+    {
+    }
+
+    FastNoiseSimd::FastNoiseSimd(const FastNoise& generator)
+        : m_generator(generator)
+    {
+        BuildPermutationTables(generator.GetSeed());
+        CalculateFractalBounding();
+    }
+
+    void FastNoiseSimd::SetGenerator(const FastNoise& generator)
+    {
+        const bool seedChanged = generator.GetSeed() != m_generator.GetSeed();
+        m_generator = generator;
+        if (seedChanged)
+        {
+            BuildPermutationTables(generator.GetSeed());
+        }
+        CalculateFractalBounding();
+    }
+
+    const FastNoise& FastNoiseSimd::GetGenerator() const
+    {
+        return m_generator;
+    }
+
+    void FastNoiseSimd::GetNoise4(const float* x, const float* y, const float* z, float* out) const
+    {
+        const NoiseSettings settings = { m_perm,
+                                         m_perm12,
+                                         m_generator.GetInterp(),
+                                         m_generator.GetFractalType(),
+                                         m_generator.GetFractalOctaves(),
+                                         m_generator.GetFractalLacunarity(),
+                                         m_generator.GetFractalGain(),
+                                         m_fractalBounding };
+
+        const Vec4::FloatType frequency = Vec4::Splat(m_generator.GetFrequency());
+        const Vec4::FloatType xf = Vec4::Mul(Vec4::LoadUnaligned(x), frequency);
+        const Vec4::FloatType yf = Vec4::Mul(Vec4::LoadUnaligned(y), frequency);
+        const Vec4::FloatType zf = Vec4::Mul(Vec4::LoadUnaligned(z), frequency);
+
+        switch (m_generator.GetNoiseType())
+        {
+        case FastNoise::Value:
+            Vec4::StoreUnaligned(out, SingleValue(settings, 0, xf, yf, zf));
+            return;
+        case FastNoise::ValueFractal:
+            Vec4::StoreUnaligned(out, Fractal<&SingleValue>(settings, xf, yf, zf));
+            return;
+        case FastNoise::Perlin:
+            Vec4::StoreUnaligned(out, SinglePerlin(settings, 0, xf, yf, zf));
+            return;
+        case FastNoise::PerlinFractal:
+            Vec4::StoreUnaligned(out, Fractal<&SinglePerlin>(settings, xf, yf, zf));
+            return;
+        case FastNoise::Simplex:
+            Vec4::StoreUnaligned(out, SingleSimplex(settings, 0, xf, yf, zf));
+            return;
+        case FastNoise::SimplexFractal:
+            Vec4::StoreUnaligned(out, Fractal<&SingleSimplex>(settings, xf, yf, zf));
+            return;
+        default:
+            break;
+        }
+
+        for (int n = 0; n < 4; n++)
+        {
+            out[n] = m_generator.GetNoise(x[n], y[n], z[n]);
+        }
+    }
+
+    void FastNoiseSimd::BuildPermutationTables(int seed)
+    {
+        // Same as FastNoise::SetSeed(), which keeps its tables private.
+        std::mt19937_64 gen(seed);
+
+        for (int i = 0; i < 256; i++)
+        {
+            m_perm[i] = static_cast<unsigned char>(i);
+        }
+
+        for (int j = 0; j < 256; j++)
+        {
+            const int rng = static_cast<int>(gen() % (256 - j));
+            const int k = rng + j;
+            const unsigned char l = m_perm[j];
+            m_perm[j] = m_perm[j + 256] = m_perm[k];
+            m_perm[k] = l;
+            m_perm12[j] = m_perm12[j + 256] = m_perm[j] % 12;
+        }
+    }
+
+    void FastNoiseSimd::CalculateFractalBounding()
+    {
+        // Same as FastNoise::CalculateFractalBounding().
+        float amp = m_generator.GetFractalGain();
+        float ampFractal = 1.0f;
+        for (int i = 1; i < m_generator.GetFractalOctaves(); i++)
+        {
+            ampFractal += amp;
+            amp *= m_generator.GetFractalGain();
+        }
+        m_fractalBounding = 1.0f / ampFractal;
+    }
+} // namespace FastNoiseGem
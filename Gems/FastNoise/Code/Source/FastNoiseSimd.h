@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <External/FastNoise/FastNoise.h>
+
+namespace FastNoiseGem
+{
+    //! Evaluates the 3D noise of a FastNoise generator for four positions at a time.
+    //! Value, Perlin and Simplex noise and their fractal types are evaluated with SIMD, using the same operations as
+    //! FastNoise::GetNoise(x, y, z). The other noise types call GetNoise(x, y, z) one position at a time.
+    //! FastNoise keeps its permutation tables private, so they are rebuilt from the seed of the generator.
+    class FastNoiseSimd
+    {
+    public:
+        FastNoiseSimd();
+        explicit FastNoiseSimd(const FastNoise& generator);
+
+        //! Copies the settings of the generator. This needs to be called again whenever the settings of the generator change.
+        void SetGenerator(const FastNoise& generator);
+        const FastNoise& GetGenerator() const;
+
+        //! Batched GetNoise(x, y, z) for four positions: out[n] gets the noise at (x[n], y[n], z[n]), which matches
+        //! GetNoise(x[n], y[n], z[n]) within floating-point tolerance.
+        void GetNoise4(const float* x, const float* y, const float* z, float* out) const;
+
+    private:
+        void BuildPermutationTables(int seed);
+        void CalculateFractalBounding();
+
+        FastNoise m_generator;
+        unsigned char m_perm[512];
+        unsigned char m_perm12[512];
+        float m_fractalBounding = 1.0f;
+    };
+} // namespace FastNoiseGem
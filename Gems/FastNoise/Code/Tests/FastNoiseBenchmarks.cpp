@@ -12,6 +12,7 @@
 
 #include <AzCore/Math/Vector3.h>
 #include <FastNoiseGradientComponent.h>
+#include <FastNoiseSimd.h>
 #include <FastNoiseTest.h>
 #include <GradientSignalTestHelpers.h>
 #include <GradientSignal/Components/GradientTransformComponent.h>
@@ -109,6 +110,85 @@ namespace UnitTest
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(FastNoiseGetValues, BM_FastNoiseGradient_Cubic);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(FastNoiseGetValues, BM_FastNoiseGradient_CubicFractal);
 
+    // Measure the raw per-point FastNoise generator, so that the overhead of the gradient transform and the value remapping in
+    // FastNoiseGradientComponent::GetValues() can be compared against the cost of the noise generation itself.
+    static void BM_FastNoiseGenerator_GetNoise(benchmark::State& state)
+    {
+        const size_t numPositions = aznumeric_cast<size_t>(state.range(1) * state.range(1));
+
+        FastNoise generator;
+        generator.SetFrequency(0.01f);
+        generator.SetNoiseType(static_cast<FastNoise::NoiseType>(state.range(0)));
+
+        AZStd::vector<AZ::Vector3> positions(numPositions);
+        for (size_t index = 0; index < numPositions; index++)
+        {
+            positions[index] = AZ::Vector3(aznumeric_cast<float>(index % state.range(1)), aznumeric_cast<float>(index / state.range(1)), 0.0f);
+        }
+        AZStd::vector<float> results(numPositions);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < numPositions; index++)
+            {
+                results[index] = generator.GetNoise(positions[index].GetX(), positions[index].GetY(), positions[index].GetZ());
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+
+    BENCHMARK(BM_FastNoiseGenerator_GetNoise)
+        ->Args({ FastNoise::NoiseType::Value, 1024 })
+        ->Args({ FastNoise::NoiseType::Perlin, 1024 })
+        ->Args({ FastNoise::NoiseType::PerlinFractal, 1024 })
+        ->Args({ FastNoise::NoiseType::Simplex, 1024 })
+        ->Args({ FastNoise::NoiseType::SimplexFractal, 1024 })
+        ->Args({ FastNoise::NoiseType::Cellular, 1024 })
+        ->ArgNames({ "NoiseType", "size" })
+        ->Unit(::benchmark::kMillisecond);
+
+    // Measure the batched FastNoiseSimd generator on the same positions as BM_FastNoiseGenerator_GetNoise, to compare the SIMD
+    // GetNoise4() against the per-point GetNoise().
+    static void BM_FastNoiseGenerator_GetNoise4(benchmark::State& state)
+    {
+        const size_t numPositions = aznumeric_cast<size_t>(state.range(1) * state.range(1));
+
+        FastNoise generator;
+        generator.SetFrequency(0.01f);
+        generator.SetNoiseType(static_cast<FastNoise::NoiseType>(state.range(0)));
+        const FastNoiseGem::FastNoiseSimd simdGenerator(generator);
+
+        // The batched API takes separate x, y and z arrays.
+        AZStd::vector<float> x(numPositions);
+        AZStd::vector<float> y(numPositions);
+        AZStd::vector<float> z(numPositions, 0.0f);
+        for (size_t index = 0; index < numPositions; index++)
+        {
+            x[index] = aznumeric_cast<float>(index % state.range(1));
+            y[index] = aznumeric_cast<float>(index / state.range(1));
+        }
+        AZStd::vector<float> results(numPositions);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < numPositions; index += 4)
+            {
+                simdGenerator.GetNoise4(&x[index], &y[index], &z[index], &results[index]);
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+
+    BENCHMARK(BM_FastNoiseGenerator_GetNoise4)
+        ->Args({ FastNoise::NoiseType::Value, 1024 })
+        ->Args({ FastNoise::NoiseType::Perlin, 1024 })
+        ->Args({ FastNoise::NoiseType::PerlinFractal, 1024 })
+        ->Args({ FastNoise::NoiseType::Simplex, 1024 })
+        ->Args({ FastNoise::NoiseType::SimplexFractal, 1024 })
+        ->Args({ FastNoise::NoiseType::Cellular, 1024 })
+        ->ArgNames({ "NoiseType", "size" })
+        ->Unit(::benchmark::kMillisecond);
+
 #endif
 }
 
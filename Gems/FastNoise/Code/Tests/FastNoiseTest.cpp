@@ -14,7 +14,9 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Script/ScriptContext.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <External/FastNoise/FastNoise.h>
 #include <FastNoiseGradientComponent.h>
+#include <FastNoiseSimd.h>
 #include <FastNoiseTest.h>
 #include <GradientSignalTestHelpers.h>
 #include <GradientSignal/Components/GradientTransformComponent.h>
@@ -105,6 +107,56 @@ TEST_F(FastNoiseTest, FastNoise_VerifyGetValueAndGetValuesMatch)
     UnitTest::GradientSignalTestHelpers::CompareGetValueAndGetValues(noiseEntity->GetId(), shapeHalfBounds);
 }
 
+TEST_F(FastNoiseTest, FastNoise_VerifyGetNoise4MatchesGetNoise)
+{
+    // FastNoiseSimd evaluates Value, Perlin and Simplex noise four positions at a time with SIMD, and falls back to GetNoise()
+    // for the other noise types. Either way, it should produce the same values as GetNoise().
+    const FastNoise::NoiseType noiseTypes[] = { FastNoise::Value,   FastNoise::ValueFractal,   FastNoise::Perlin,
+                                                FastNoise::PerlinFractal, FastNoise::Simplex, FastNoise::SimplexFractal,
+                                                FastNoise::Cellular, FastNoise::Cubic };
+    const FastNoise::Interp interps[] = { FastNoise::Linear, FastNoise::Hermite, FastNoise::Quintic };
+    const FastNoise::FractalType fractalTypes[] = { FastNoise::FBM, FastNoise::Billow, FastNoise::RigidMulti };
+
+    for (FastNoise::NoiseType noiseType : noiseTypes)
+    {
+        for (FastNoise::Interp interp : interps)
+        {
+            for (FastNoise::FractalType fractalType : fractalTypes)
+            {
+                FastNoise generator(2468);
+                generator.SetFrequency(0.37f);
+                generator.SetNoiseType(noiseType);
+                generator.SetInterp(interp);
+                generator.SetFractalType(fractalType);
+                generator.SetFractalOctaves(4);
+                const FastNoiseGem::FastNoiseSimd simdGenerator(generator);
+
+                // The positions cross zero and include whole numbers, so that the negative coordinates and the cell edges
+                // are verified as well.
+                for (int index = 0; index < 64; index++)
+                {
+                    float x[4];
+                    float y[4];
+                    float z[4];
+                    for (int lane = 0; lane < 4; lane++)
+                    {
+                        x[lane] = -20.0f + (index * 4 + lane) * 0.25f;
+                        y[lane] = 13.5f - index * 0.5f;
+                        z[lane] = (lane % 2) ? 0.0f : x[lane] * 0.5f - y[lane];
+                    }
+
+                    float noise[4];
+                    simdGenerator.GetNoise4(x, y, z, noise);
+                    for (int lane = 0; lane < 4; lane++)
+                    {
+                        EXPECT_NEAR(noise[lane], generator.GetNoise(x[lane], y[lane], z[lane]), 1.0e-6f);
+                    }
+                }
+            }
+        }
+    }
+}
+
 // This uses custom test / benchmark hooks so that we can load LmbrCentral and GradientSignal Gems.
 AZ_UNIT_TEST_HOOK(new UnitTest::FastNoiseTestEnvironment, UnitTest::FastNoiseBenchmarkEnvironment);
 
@@ -13,6 +13,8 @@ set(FILES
     Source/FastNoiseSystemComponent.h
     Source/FastNoiseGradientComponent.cpp
     Source/FastNoiseGradientComponent.h
+    Source/FastNoiseSimd.cpp
+    Source/FastNoiseSimd.h
     External/FastNoise/FastNoise.h
     External/FastNoise/FastNoise.cpp
 )
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <GradientSignal/GradientProgram.h>
+#include <LmbrCentral/Dependency/DependencyNotificationBus.h>
+
+namespace GradientSignal
+{
+    /**
+     * Keeps a compiled GradientProgram of a gradient entity up to date, for systems that query large regions of a gradient.
+     * The program gets compiled on the first query, and recompiled on the first query after OnCompositionChanged() got
+     * sent for any of the gradients that got compiled into it. Gradients that are sampled through the bus by the program
+     * don't invalidate it. When the gradient can't be compiled, the queries go through the GradientRequestBus instead, until
+     * the next invalidation. The activation of the gradient entity itself isn't tracked, so owners that compile gradients
+     * which might not be active yet should call Invalidate() when they get activated, like a DependencyMonitor notifies.
+     * Queries can be made from multiple threads.
+     */
+    class CompiledGradient final
+        : private LmbrCentral::DependencyNotificationBus::MultiHandler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompiledGradient, AZ::SystemAllocator, 0);
+
+        explicit CompiledGradient(const AZ::EntityId& gradientId);
+        ~CompiledGradient();
+
+        const AZ::EntityId& GetGradientId() const { return m_gradientId; }
+
+        //! Mark the program as outdated, so that it gets recompiled on the next query.
+        void Invalidate();
+
+        //! Get the current program, compiling it first if needed. Returns nullptr if the gradient can't be compiled.
+        AZStd::shared_ptr<const GradientProgram> GetProgram();
+
+        /**
+         * Given a list of positions, generate values, the same way GradientRequests::GetValues() does.
+         * \param positions The input list of positions to query.
+         * \param outValues The output list of values. This list is expected to be the same size as the positions list.
+         */
+        void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues);
+
+    private:
+        CompiledGradient(const CompiledGradient&) = delete;
+        CompiledGradient& operator=(const CompiledGradient&) = delete;
+
+        //////////////////////////////////////////////////////////////////////////
+        // DependencyNotificationBus
+        void OnCompositionChanged() override;
+
+        AZ::EntityId m_gradientId;
+        AZStd::mutex m_programMutex;
+        AZStd::shared_ptr<const GradientProgram> m_program;
+        AZ::u64 m_programVersion = 0;
+
+        // The notifications only increment the version, so that they never wait on a compile in progress.
+        AZStd::atomic<AZ::u64> m_version{ 1 };
+    };
+} // namespace GradientSignal
@@ -73,6 +73,8 @@ namespace GradientSignal
         ////////////////////////////////////////////////////////////////////////
         // SurfaceData::SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfaceData::SurfacePointList& surfacePointList) const override;
+        void ModifySurfacePointsFromList(
+            AZStd::span<const size_t> pointIndices, SurfaceData::PackedSurfacePointList& surfacePointList) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // LmbrCentral::DependencyNotificationBus
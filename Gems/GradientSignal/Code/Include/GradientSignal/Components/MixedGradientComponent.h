@@ -100,8 +100,14 @@ namespace GradientSignal
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
         void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const override;
+        bool CompileGradient(GradientProgramBuilder& builder, AZ::u32 positions, AZ::u32 output) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
 
+        //! Blend the values of a layer into the accumulated values, using the given mixing operation and the opacity of the layer.
+        static void MixValues(
+            MixedGradientLayer::MixingOperation operation, float opacity, AZStd::span<float> inOutValues,
+            AZStd::span<const float> layerValues);
+
     protected:
         //////////////////////////////////////////////////////////////////////////
         // MixedGradientRequestBus
@@ -139,6 +145,9 @@ namespace GradientSignal
             }
         }
 
+        template<MixedGradientLayer::MixingOperation Operation>
+        static void MixValues(float opacity, AZStd::span<float> inOutValues, AZStd::span<const float> layerValues);
+
         MixedGradientConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
     };
@@ -74,8 +74,12 @@ namespace GradientSignal
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
         void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const override;
+        bool CompileGradient(GradientProgramBuilder& builder, AZ::u32 positions, AZ::u32 output) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
 
+        //! Posterize a list of values, the same way PosterizeValue() does for a single value.
+        static void PosterizeValues(AZStd::span<float> inOutValues, float bands, PosterizeGradientConfig::ModeType mode);
+
     protected:
         //////////////////////////////////////////////////////////////////////////
         // PosterizeGradientRequestBus
@@ -14,6 +14,8 @@
 
 namespace GradientSignal
 {
+    class GradientProgramBuilder;
+
     struct GradientSampleParams final
     {
         AZ_CLASS_ALLOCATOR(GradientSampleParams, AZ::SystemAllocator, 0);
@@ -75,6 +77,20 @@ namespace GradientSignal
             }
         }
 
+        /**
+         * Add the instructions that calculate the values of this gradient to a compiled gradient program.
+         * Gradients that return false without adding any instructions get sampled through GetValues() by the program.
+         * \param builder The builder of the program.
+         * \param positions The position register with the positions to sample.
+         * \param output The value register to write the values to.
+         * \return True if the gradient added its instructions to the program.
+         */
+        virtual bool CompileGradient(
+            [[maybe_unused]] GradientProgramBuilder& builder, [[maybe_unused]] AZ::u32 positions, [[maybe_unused]] AZ::u32 output) const
+        {
+            return false;
+        }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace GradientSignal
+{
+    class GradientSampler;
+
+    /**
+     * A gradient network compiled into a flat, immutable list of instructions.
+     * Evaluating a chain of gradients through the GradientRequestBus costs an EBus dispatch, a temporary buffer and the
+     * post-processing of a GradientSampler for every gradient in the chain. A program resolves the chain once, so that
+     * evaluating it only walks the instructions, which process the positions in tiles with the SIMD span functions.
+     * Gradients that can't be expressed as instructions are sampled through the GradientRequestBus by the program.
+     * Programs are built with the GradientProgramBuilder, and kept up to date by CompiledGradient.
+     */
+    class GradientProgram final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(GradientProgram, AZ::SystemAllocator, 0);
+
+        //! The index of a value or position register used by the instructions.
+        using Register = AZ::u32;
+
+        //! The value register that holds the output values of the program.
+        static constexpr Register OutputRegister = 0;
+        //! The position register that holds the input positions of the program.
+        static constexpr Register InputPositionsRegister = 0;
+        //! The number of positions that are processed at once, which keeps the registers of a tile in the cache.
+        static constexpr size_t TileSize = 1024;
+
+        enum class OpCode : AZ::u8
+        {
+            Fill,               //!< output = m_params[0]
+            SampleGradient,     //!< output = the values of the gradient m_gradientId at the positions
+            TransformPositions, //!< positions output = m_transform * positions input
+            Invert,             //!< output = 1 - output
+            InvertClamped,      //!< output = 1 - clamp(output, 0, 1)
+            Scale,              //!< output = output * m_params[0]
+            Clamp,              //!< output = clamp(output, 0, 1)
+            Threshold,          //!< output = (output <= m_params[0]) ? 0 : 1
+            Levels,             //!< output = GetLevels(output, mid, min, max, output min, output max) with m_params[0..4]
+            Posterize,          //!< output = PosterizeValues(output, bands) with m_params[0] bands and m_mode as the posterize mode
+            SmoothStep,         //!< output = GetSmoothedValues(output) with m_params[0..2] as the falloff midpoint, range and strength
+            Mix,                //!< output = mix of output and input, with m_mode as the mixing operation and m_params[0] the opacity
+        };
+
+        struct Instruction
+        {
+            OpCode m_opCode = OpCode::Fill;
+            AZ::u8 m_mode = 0;
+            Register m_output = OutputRegister;
+            Register m_input = OutputRegister;
+            Register m_positions = InputPositionsRegister;
+            AZStd::array<float, 5> m_params = { { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f } };
+            AZ::EntityId m_gradientId;
+            AZ::Matrix3x4 m_transform = AZ::Matrix3x4::CreateIdentity();
+        };
+
+        /**
+         * Evaluate the program for a list of positions.
+         * \param positions The input list of positions to query.
+         * \param outValues The output list of values. This list is expected to be the same size as the positions list.
+         */
+        void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
+        const AZ::EntityId& GetGradientId() const { return m_gradientId; }
+        size_t GetNumInstructions() const { return m_instructions.size(); }
+        const Instruction& GetInstruction(size_t index) const { return m_instructions[index]; }
+        size_t GetNumValueRegisters() const { return m_numValueRegisters; }
+        size_t GetNumPositionRegisters() const { return m_numPositionRegisters; }
+
+        //! The gradients that got compiled into instructions. Changes to any of them invalidate the program.
+        const AZStd::vector<AZ::EntityId>& GetDependencies() const { return m_dependencies; }
+
+    private:
+        friend class GradientProgramBuilder;
+
+        void ExecuteTile(
+            AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, AZStd::span<AZ::Vector3> positionRegisters,
+            AZStd::span<float> valueRegisters, size_t registerSize) const;
+
+        AZ::EntityId m_gradientId;
+        AZStd::vector<Instruction> m_instructions;
+        AZStd::vector<AZ::EntityId> m_dependencies;
+        size_t m_numValueRegisters = 1;
+        size_t m_numPositionRegisters = 1;
+    };
+
+    /**
+     * Builds a GradientProgram for a gradient entity.
+     * The gradients emit their instructions through GradientRequests::CompileGradient(), and add the gradients they sample
+     * with AddGradientSampler(). Gradients that don't implement CompileGradient() get sampled through the GradientRequestBus.
+     */
+    class GradientProgramBuilder final
+    {
+    public:
+        using Register = GradientProgram::Register;
+
+        /**
+         * Compile the gradient network of a gradient entity.
+         * \param gradientId The gradient entity to compile.
+         * \return The compiled program, or nullptr if the network contains cyclic references.
+         */
+        static AZStd::shared_ptr<const GradientProgram> Build(const AZ::EntityId& gradientId);
+
+        /**
+         * Add the instructions to calculate the values of a gradient entity.
+         * \param gradientId The gradient entity.
+         * \param positions The position register with the positions to sample.
+         * \param output The value register to write the values to.
+         */
+        void AddGradient(const AZ::EntityId& gradientId, Register positions, Register output);
+
+        /**
+         * Add the instructions to calculate the values of a gradient sampler, including its transform, invert, levels and opacity.
+         * \param sampler The gradient sampler.
+         * \param positions The position register with the positions to sample.
+         * \param output The value register to write the values to.
+         */
+        void AddGradientSampler(const GradientSampler& sampler, Register positions, Register output);
+
+        //! Add an instruction to the program.
+        void AddInstruction(const GradientProgram::Instruction& instruction);
+
+        //! Get a value register for temporary values. Registers get reused once they have been released.
+        Register AcquireValueRegister();
+        void ReleaseValueRegister(Register valueRegister);
+
+    private:
+        GradientProgramBuilder() = default;
+
+        Register AcquirePositionRegister();
+        void ReleasePositionRegister(Register positionRegister);
+
+        GradientProgram m_program;
+        AZStd::vector<AZ::EntityId> m_gradientStack;
+        AZStd::vector<Register> m_freeValueRegisters;
+        AZStd::vector<Register> m_freePositionRegisters;
+        bool m_hasCyclicReferences = false;
+    };
+} // namespace GradientSignal
@@ -208,20 +208,29 @@ namespace GradientSignal
         }
 
         // Perform any post-fetch transformations on the gradient values (invert, levels, opacity).
-        for (auto& outValue : outValues)
+        using AZ::Simd::Vec4;
+        if (m_invertInput)
         {
-            if (m_invertInput)
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            TransformValues(outValues, [&](Vec4::FloatArgType value)
             {
-                outValue = 1.0f - outValue;
-            }
+                return Vec4::Sub(one, value);
+            });
+        }
 
-            // apply levels if set
-            if (m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this))
-            {
-                outValue = GetLevels(outValue, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
-            }
+        // apply levels if set
+        if (m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this))
+        {
+            GetLevels(outValues, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+        }
 
-            outValue = outValue * m_opacity;
+        if (m_opacity != 1.0f)
+        {
+            const Vec4::FloatType opacity = Vec4::Splat(m_opacity);
+            TransformValues(outValues, [&](Vec4::FloatArgType value)
+            {
+                return Vec4::Mul(value, opacity);
+            });
         }
     }
 
@@ -11,6 +11,7 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/functional.h>
 
 namespace GradientSignal
@@ -99,6 +100,33 @@ namespace GradientSignal
          */
         void TransformPositionToUVWNormalized(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, bool& wasPointRejected) const;
 
+        /**
+         * Transform a list of world space positions to gradient space UVW lookup values.
+         * This produces the same results as calling TransformPositionToUVW() for each position, but only selects the wrapping
+         * function once for the entire list.
+         * \param inPositions The input world space positions to transform.
+         * \param outUVWs [out] The UVW values, which must be the same size as inPositions.
+         * \param wasPointRejected [out] The rejection result for each position, which must be the same size as inPositions.
+         */
+        void TransformPositionsToUVW(
+            AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const;
+
+        /**
+         * Transform a list of world space positions to gradient space UVW lookup values and normalize them to the shape bounds.
+         * This produces the same results as calling TransformPositionToUVWNormalized() for each position.
+         * \param inPositions The input world space positions to transform.
+         * \param outUVWs [out] The UVW values, which must be the same size as inPositions.
+         * \param wasPointRejected [out] The rejection result for each position, which must be the same size as inPositions.
+         */
+        void TransformPositionsToUVWNormalized(
+            AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const;
+
+        /**
+         * Number of positions the gradients transform at once with the batched transforms in their GetValues().
+         * The transformed positions of a chunk are small enough to be kept on the stack instead of being allocated for every query.
+         */
+        static constexpr size_t TransformChunkSize = 128;
+
         /**
          * Epsilon value to allow our UVW range to go to [min, max) by using the range [min, max - epsilon].
          * To keep things behaving consistently between clamped and unbounded uv ranges, we want our clamped uvs to use a
@@ -110,6 +138,17 @@ namespace GradientSignal
 
     private:
 
+        //! Transform a list of positions, optionally normalizing them to the shape bounds.
+        void TransformPositionsToUVW(
+            AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected,
+            bool normalize) const;
+
+        //! Transform a list of positions four at a time, using a Vec4 version of one of the wrapping functions below.
+        template<typename WrapFunction>
+        void TransformPositionsToUVW(
+            AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected,
+            bool normalize, WrapFunction wrapFunction) const;
+
         //! These are the various transformations that will be performed, based on wrapping type.
         static AZ::Vector3 NoTransform(const AZ::Vector3& point, const AZ::Aabb& bounds);
         static AZ::Vector3 GetUnboundedPointInAabb(const AZ::Vector3& point, const AZ::Aabb& bounds);
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/Math/Vector3.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h>
 
@@ -32,6 +34,14 @@ namespace GradientSignal
         */
         float GenerateOctaveNoise(float x, float y, float z, int octaves, float persistence, float initialFrequency = 1.0f);
 
+        /**
+        * Creates Perlin 'natural' noise factor values for a list of positions, evaluating four positions at a time with SIMD.
+        * This produces the same results as calling the single position GenerateOctaveNoise() for each position.
+        */
+        void GenerateOctaveNoise(
+            AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, int octaves, float persistence,
+            float initialFrequency = 1.0f) const;
+
         /**
         * Creates a Perlin noise factor value based on a position
         */
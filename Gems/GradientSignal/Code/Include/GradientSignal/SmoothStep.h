@@ -64,9 +64,41 @@ namespace GradientSignal
         const float max = m_falloffMidpoint + m_falloffRange / 2.0f;
         const float valueFalloffStrength = AZ::GetClamp(m_falloffStrength, 0.0f, 1.0f);
 
-        for (auto& inOutValue : inOutValues)
+        // GetRatio() treats empty ranges as a step function, so fall back to the per-value calculation for those.
+        const float minRangeExtents = (min + valueFalloffStrength) - min;
+        const float maxRangeExtents = max - (max - valueFalloffStrength);
+        if (minRangeExtents == 0.0f || maxRangeExtents == 0.0f)
         {
-            inOutValue = CalculateSmoothedValue(min, max, valueFalloffStrength, inOutValue);
+            for (auto& inOutValue : inOutValues)
+            {
+                inOutValue = CalculateSmoothedValue(min, max, valueFalloffStrength, inOutValue);
+            }
+            return;
         }
+
+        using AZ::Simd::Vec4;
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType two = Vec4::Splat(2.0f);
+        const Vec4::FloatType three = Vec4::Splat(3.0f);
+        const Vec4::FloatType minRangeStart = Vec4::Splat(min);
+        const Vec4::FloatType maxRangeStart = Vec4::Splat(max - valueFalloffStrength);
+        const Vec4::FloatType minRangeExtentsValue = Vec4::Splat(minRangeExtents);
+        const Vec4::FloatType maxRangeExtentsValue = Vec4::Splat(maxRangeExtents);
+
+        auto smoothStep = [&](Vec4::FloatArgType t)
+        {
+            return Vec4::Mul(Vec4::Mul(t, t), Vec4::Sub(three, Vec4::Mul(two, t)));
+        };
+
+        TransformValues(inOutValues, [&](Vec4::FloatArgType inputValue)
+        {
+            const Vec4::FloatType value = Vec4::Clamp(inputValue, zero, one);
+            const Vec4::FloatType result1 =
+                smoothStep(Vec4::Clamp(Vec4::Div(Vec4::Sub(value, minRangeStart), minRangeExtentsValue), zero, one));
+            const Vec4::FloatType result2 =
+                smoothStep(Vec4::Clamp(Vec4::Div(Vec4::Sub(value, maxRangeStart), maxRangeExtentsValue), zero, one));
+            return Vec4::Mul(result1, Vec4::Sub(one, result2));
+        });
     }
 } // namespace GradientSignal
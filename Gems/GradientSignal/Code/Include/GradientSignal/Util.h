@@ -11,6 +11,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/std/containers/span.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
@@ -79,36 +80,80 @@ namespace GradientSignal
         return AZ::Lerp(outputMin, outputMax, inputCorrected);
     }
 
+    //! Apply a function that operates on a Vec4 to every value in the span, four values at a time.
+    //! The values at the end of the span that don't fill a full Vec4 get padded, so the function needs to be safe to call on zeros.
+    template<typename Function>
+    inline void TransformValues(AZStd::span<float> inOutValues, Function&& function)
+    {
+        using AZ::Simd::Vec4;
+
+        float* values = inOutValues.data();
+        const size_t numValues = inOutValues.size();
+        const size_t numFullValues = numValues & ~static_cast<size_t>(3);
+
+        for (size_t index = 0; index < numFullValues; index += 4)
+        {
+            Vec4::StoreUnaligned(values + index, function(Vec4::LoadUnaligned(values + index)));
+        }
+
+        if (numFullValues < numValues)
+        {
+            float remainingValues[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            AZStd::copy(values + numFullValues, values + numValues, remainingValues);
+            Vec4::StoreUnaligned(remainingValues, function(Vec4::LoadUnaligned(remainingValues)));
+            AZStd::copy(remainingValues, remainingValues + (numValues - numFullValues), values + numFullValues);
+        }
+    }
+
     inline void GetLevels(AZStd::span<float> inOutValues, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
     {
+        using AZ::Simd::Vec4;
+
         inputMid = AZ::GetClamp(inputMid, 0.01f, 10.0f); // Clamp the midpoint to a non-zero value so that it's always safe to divide by it.
         inputMin = AZ::GetClamp(inputMin, 0.0f, 1.0f);
         inputMax = AZ::GetClamp(inputMax, 0.0f, 1.0f);
         outputMin = AZ::GetClamp(outputMin, 0.0f, 1.0f);
         outputMax = AZ::GetClamp(outputMax, 0.0f, 1.0f);
 
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType inputMinValue = Vec4::Splat(inputMin);
+        const Vec4::FloatType outputMinValue = Vec4::Splat(outputMin);
+        const Vec4::FloatType outputMaxValue = Vec4::Splat(outputMax);
+
         if (inputMin == inputMax)
         {
-            for (auto& inOutValue : inOutValues)
+            TransformValues(inOutValues, [&](Vec4::FloatArgType value)
             {
-                inOutValue = (AZ::GetClamp(inOutValue, 0.0f, 1.0f) <= inputMin) ? outputMin : outputMax;
-            }
+                return Vec4::Select(outputMinValue, outputMaxValue, Vec4::CmpLtEq(Vec4::Clamp(value, zero, one), inputMinValue));
+            });
+            return;
         }
 
         const float inputMidReciprocal = 1.0f / inputMid;
-        const float inputExtentsReciprocal = 1.0f / (inputMax - inputMin);
+        const Vec4::FloatType inputExtentsReciprocal = Vec4::Splat(1.0f / (inputMax - inputMin));
 
-        for (auto& inOutValue : inOutValues)
+        TransformValues(inOutValues, [&](Vec4::FloatArgType value)
         {
-            const float inputRemapped =
-                AZ::GetMin(AZ::GetMax(AZ::GetClamp(inOutValue, 0.0f, 1.0f) - inputMin, 0.0f) * inputExtentsReciprocal, 1.0f);
+            return Vec4::Min(Vec4::Mul(Vec4::Max(Vec4::Sub(Vec4::Clamp(value, zero, one), inputMinValue), zero), inputExtentsReciprocal), one);
+        });
 
-            // Note:  Some paint programs map the midpoint using 1/mid where low values are dark and high values are light,
-            // others do the reverse and use mid directly, so low values are light and high values are dark.  We've chosen to
-            // align with 1/mid since it appears to be the more prevalent of the two approaches.
-            const float inputCorrected = powf(inputRemapped, inputMidReciprocal);
-
-            inOutValue = AZ::Lerp(outputMin, outputMax, inputCorrected);
+        // Note:  Some paint programs map the midpoint using 1/mid where low values are dark and high values are light,
+        // others do the reverse and use mid directly, so low values are light and high values are dark.  We've chosen to
+        // align with 1/mid since it appears to be the more prevalent of the two approaches.
+        // There's no vectorized pow, so only apply it when the midpoint actually changes the values.
+        if (inputMidReciprocal != 1.0f)
+        {
+            for (auto& inOutValue : inOutValues)
+            {
+                inOutValue = powf(inOutValue, inputMidReciprocal);
+            }
         }
+
+        const Vec4::FloatType outputExtents = Vec4::Splat(outputMax - outputMin);
+        TransformValues(inOutValues, [&](Vec4::FloatArgType value)
+        {
+            return Vec4::Add(outputMinValue, Vec4::Mul(outputExtents, value));
+        });
     }
 } // namespace GradientSignal
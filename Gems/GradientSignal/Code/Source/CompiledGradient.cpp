@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/CompiledGradient.h>
+#include <GradientSignal/Ebuses/GradientRequestBus.h>
+
+namespace GradientSignal
+{
+    CompiledGradient::CompiledGradient(const AZ::EntityId& gradientId)
+        : m_gradientId(gradientId)
+    {
+        // Changes anywhere in the gradient network get forwarded to the gradient itself by the dependency monitors,
+        // so stay connected to it even while compiling, when the dependencies of the new program aren't known yet.
+        if (m_gradientId.IsValid())
+        {
+            LmbrCentral::DependencyNotificationBus::MultiHandler::BusConnect(m_gradientId);
+        }
+    }
+
+    CompiledGradient::~CompiledGradient()
+    {
+        LmbrCentral::DependencyNotificationBus::MultiHandler::BusDisconnect();
+    }
+
+    void CompiledGradient::Invalidate()
+    {
+        ++m_version;
+    }
+
+    void CompiledGradient::OnCompositionChanged()
+    {
+        Invalidate();
+    }
+
+    AZStd::shared_ptr<const GradientProgram> CompiledGradient::GetProgram()
+    {
+        const AZ::u64 version = m_version;
+        {
+            AZStd::scoped_lock lock(m_programMutex);
+            if (m_programVersion == version)
+            {
+                return m_program;
+            }
+        }
+
+        // Compile without holding the lock, as compiling locks the gradient bus, which might be held by a thread waiting on the lock.
+        // The result is cached with its version even when the gradient is invalid or inactive, so that the following queries
+        // don't compile again until the next invalidation: an invalid id has no program, and an inactive gradient compiles
+        // into a program that samples it through the bus.
+        AZStd::shared_ptr<const GradientProgram> program =
+            m_gradientId.IsValid() ? GradientProgramBuilder::Build(m_gradientId) : nullptr;
+
+        AZStd::scoped_lock lock(m_programMutex);
+
+        // Another thread might have compiled a more recent version in the meantime.
+        if (version < m_programVersion)
+        {
+            return m_program;
+        }
+
+        // Track the gradients that got compiled into the new program instead of the ones of the previous program.
+        if (m_program)
+        {
+            for (const AZ::EntityId& dependency : m_program->GetDependencies())
+            {
+                if (dependency != m_gradientId)
+                {
+                    LmbrCentral::DependencyNotificationBus::MultiHandler::BusDisconnect(dependency);
+                }
+            }
+        }
+        if (program)
+        {
+            for (const AZ::EntityId& dependency : program->GetDependencies())
+            {
+                if (dependency != m_gradientId)
+                {
+                    LmbrCentral::DependencyNotificationBus::MultiHandler::BusConnect(dependency);
+                }
+            }
+        }
+
+        m_program = program;
+        m_programVersion = version;
+
+        return m_program;
+    }
+
+    void CompiledGradient::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues)
+    {
+        if (!m_gradientId.IsValid())
+        {
+            return;
+        }
+
+        if (AZStd::shared_ptr<const GradientProgram> program = GetProgram())
+        {
+            program->GetValues(positions, outValues);
+        }
+        else
+        {
+            GradientRequestBus::Event(m_gradientId, &GradientRequestBus::Events::GetValues, positions, outValues);
+        }
+    }
+} // namespace GradientSignal
@@ -10,6 +10,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 #include <LmbrCentral/Dependency/DependencyMonitor.h>
 
 namespace GradientSignal
@@ -146,6 +147,17 @@ namespace GradientSignal
         AZStd::fill(outValues.begin(), outValues.end(), m_configuration.m_value);
     }
 
+    bool ConstantGradientComponent::CompileGradient(
+        GradientProgramBuilder& builder, [[maybe_unused]] AZ::u32 positions, AZ::u32 output) const
+    {
+        GradientProgram::Instruction instruction;
+        instruction.m_opCode = GradientProgram::OpCode::Fill;
+        instruction.m_output = output;
+        instruction.m_params[0] = m_configuration.m_value;
+        builder.AddInstruction(instruction);
+        return true;
+    }
+
     float ConstantGradientComponent::GetConstantValue() const
     {
         return m_configuration.m_value;
@@ -9,6 +9,7 @@
 #include <GradientSignal/Components/DitherGradientComponent.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -18,6 +19,29 @@
 
 namespace GradientSignal
 {
+    namespace DitherGradientDetails
+    {
+        // The Bayer matrices, as thresholds in the [0, 1) range.
+        constexpr int PatternSize4x4 = 4;
+        constexpr float IndexMatrix4x4[] = {
+             0.0f / 16.0f,  8.0f / 16.0f,  2.0f / 16.0f, 10.0f / 16.0f,
+            12.0f / 16.0f,  4.0f / 16.0f, 14.0f / 16.0f,  6.0f / 16.0f,
+             3.0f / 16.0f, 11.0f / 16.0f,  1.0f / 16.0f,  9.0f / 16.0f,
+            15.0f / 16.0f,  7.0f / 16.0f, 13.0f / 16.0f,  5.0f / 16.0f };
+
+        constexpr int PatternSize8x8 = 8;
+        constexpr float IndexMatrix8x8[] = {
+             0.0f / 64.0f, 32.0f / 64.0f,  8.0f / 64.0f, 40.0f / 64.0f,  2.0f / 64.0f, 34.0f / 64.0f, 10.0f / 64.0f, 42.0f / 64.0f,
+            48.0f / 64.0f, 16.0f / 64.0f, 56.0f / 64.0f, 24.0f / 64.0f, 50.0f / 64.0f, 18.0f / 64.0f, 58.0f / 64.0f, 26.0f / 64.0f,
+            12.0f / 64.0f, 44.0f / 64.0f,  4.0f / 64.0f, 36.0f / 64.0f, 14.0f / 64.0f, 46.0f / 64.0f,  6.0f / 64.0f, 38.0f / 64.0f,
+            60.0f / 64.0f, 28.0f / 64.0f, 52.0f / 64.0f, 20.0f / 64.0f, 62.0f / 64.0f, 30.0f / 64.0f, 54.0f / 64.0f, 22.0f / 64.0f,
+             3.0f / 64.0f, 35.0f / 64.0f, 11.0f / 64.0f, 43.0f / 64.0f,  1.0f / 64.0f, 33.0f / 64.0f,  9.0f / 64.0f, 41.0f / 64.0f,
+            51.0f / 64.0f, 19.0f / 64.0f, 59.0f / 64.0f, 27.0f / 64.0f, 49.0f / 64.0f, 17.0f / 64.0f, 57.0f / 64.0f, 25.0f / 64.0f,
+            15.0f / 64.0f, 47.0f / 64.0f,  7.0f / 64.0f, 39.0f / 64.0f, 13.0f / 64.0f, 45.0f / 64.0f,  5.0f / 64.0f, 37.0f / 64.0f,
+            63.0f / 64.0f, 31.0f / 64.0f, 55.0f / 64.0f, 23.0f / 64.0f, 61.0f / 64.0f, 29.0f / 64.0f, 53.0f / 64.0f, 21.0f / 64.0f
+        };
+    }
+
     void DitherGradientConfig::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context);
@@ -194,31 +218,12 @@ namespace GradientSignal
 
     float DitherGradientComponent::GetDitherValue4x4(const AZ::Vector3& scaledPosition)
     {
-        constexpr int patternSize = 4;
-        constexpr float indexMatrix[] = {
-             0.0f / 16.0f,  8.0f / 16.0f,  2.0f / 16.0f, 10.0f / 16.0f,
-            12.0f / 16.0f,  4.0f / 16.0f, 14.0f / 16.0f,  6.0f / 16.0f,
-             3.0f / 16.0f, 11.0f / 16.0f,  1.0f / 16.0f,  9.0f / 16.0f,
-            15.0f / 16.0f,  7.0f / 16.0f, 13.0f / 16.0f,  5.0f / 16.0f };
-
-        return indexMatrix[ScaledPositionToPatternIndex(scaledPosition, patternSize)];
+        return DitherGradientDetails::IndexMatrix4x4[ScaledPositionToPatternIndex(scaledPosition, DitherGradientDetails::PatternSize4x4)];
     }
 
     float DitherGradientComponent::GetDitherValue8x8(const AZ::Vector3& scaledPosition)
     {
-        constexpr int patternSize = 8;
-        constexpr float indexMatrix[] = {
-             0.0f / 64.0f, 32.0f / 64.0f,  8.0f / 64.0f, 40.0f / 64.0f,  2.0f / 64.0f, 34.0f / 64.0f, 10.0f / 64.0f, 42.0f / 64.0f,
-            48.0f / 64.0f, 16.0f / 64.0f, 56.0f / 64.0f, 24.0f / 64.0f, 50.0f / 64.0f, 18.0f / 64.0f, 58.0f / 64.0f, 26.0f / 64.0f,
-            12.0f / 64.0f, 44.0f / 64.0f,  4.0f / 64.0f, 36.0f / 64.0f, 14.0f / 64.0f, 46.0f / 64.0f,  6.0f / 64.0f, 38.0f / 64.0f,
-            60.0f / 64.0f, 28.0f / 64.0f, 52.0f / 64.0f, 20.0f / 64.0f, 62.0f / 64.0f, 30.0f / 64.0f, 54.0f / 64.0f, 22.0f / 64.0f,
-             3.0f / 64.0f, 35.0f / 64.0f, 11.0f / 64.0f, 43.0f / 64.0f,  1.0f / 64.0f, 33.0f / 64.0f,  9.0f / 64.0f, 41.0f / 64.0f,
-            51.0f / 64.0f, 19.0f / 64.0f, 59.0f / 64.0f, 27.0f / 64.0f, 49.0f / 64.0f, 17.0f / 64.0f, 57.0f / 64.0f, 25.0f / 64.0f,
-            15.0f / 64.0f, 47.0f / 64.0f,  7.0f / 64.0f, 39.0f / 64.0f, 13.0f / 64.0f, 45.0f / 64.0f,  5.0f / 64.0f, 37.0f / 64.0f,
-            63.0f / 64.0f, 31.0f / 64.0f, 55.0f / 64.0f, 23.0f / 64.0f, 61.0f / 64.0f, 29.0f / 64.0f, 53.0f / 64.0f, 21.0f / 64.0f
-        };
-
-        return indexMatrix[ScaledPositionToPatternIndex(scaledPosition, patternSize)];
+        return DitherGradientDetails::IndexMatrix8x8[ScaledPositionToPatternIndex(scaledPosition, DitherGradientDetails::PatternSize8x8)];
     }
 
     float DitherGradientComponent::GetCalculatedPointsPerUnit() const
@@ -284,11 +289,61 @@ namespace GradientSignal
 
         m_configuration.m_gradientSampler.GetValues(flooredCoordinates, outValues);
 
-        // For each gradient value, turn it into a 0 or 1 based on the location and the dither pattern.
-        for (size_t index = 0; index < positions.size(); index++)
+        // For each gradient value, turn it into a 0 or 1 based on the location and the dither pattern, four values at a time.
+        // This matches GetDitherValue(). Both patterns have a power of two size, so the double-mod of ScaledPositionToPatternIndex()
+        // is just a mask of the floored position.
+        int patternSize = DitherGradientDetails::PatternSize4x4;
+        const float* indexMatrix = DitherGradientDetails::IndexMatrix4x4;
+        if (m_configuration.m_patternType == DitherGradientConfig::BayerPatternType::PATTERN_SIZE_8x8)
         {
-            AZ::Vector3 scaledCoordinate = positions[index] * pointsPerUnit;
-            outValues[index] = GetDitherValue(scaledCoordinate, outValues[index]);
+            patternSize = DitherGradientDetails::PatternSize8x8;
+            indexMatrix = DitherGradientDetails::IndexMatrix8x8;
+        }
+
+        using AZ::Simd::Vec4;
+        const Vec4::FloatType scale = Vec4::Splat(pointsPerUnit);
+        const Vec4::FloatType offsetX = Vec4::Splat(m_configuration.m_patternOffset.GetX());
+        const Vec4::FloatType offsetY = Vec4::Splat(m_configuration.m_patternOffset.GetY());
+        const Vec4::Int32Type patternMask = Vec4::Splat(patternSize - 1);
+        const Vec4::Int32Type patternRowSize = Vec4::Splat(patternSize);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+        const size_t numValues = outValues.size();
+        for (size_t index = 0; index < numValues; index += 4)
+        {
+            // The last block is padded with copies of the last position and value.
+            const size_t blockSize = AZStd::min<size_t>(4, numValues - index);
+            size_t blockIndices[4];
+            for (size_t blockIndex = 0; blockIndex < 4; ++blockIndex)
+            {
+                blockIndices[blockIndex] = index + AZStd::min(blockIndex, blockSize - 1);
+            }
+
+            const Vec4::FloatType x = Vec4::LoadImmediate(
+                positions[blockIndices[0]].GetX(), positions[blockIndices[1]].GetX(), positions[blockIndices[2]].GetX(),
+                positions[blockIndices[3]].GetX());
+            const Vec4::FloatType y = Vec4::LoadImmediate(
+                positions[blockIndices[0]].GetY(), positions[blockIndices[1]].GetY(), positions[blockIndices[2]].GetY(),
+                positions[blockIndices[3]].GetY());
+
+            const Vec4::Int32Type patternX = Vec4::And(Vec4::ConvertToInt(Vec4::Floor(Vec4::Add(Vec4::Mul(x, scale), offsetX))), patternMask);
+            const Vec4::Int32Type patternY = Vec4::And(Vec4::ConvertToInt(Vec4::Floor(Vec4::Add(Vec4::Mul(y, scale), offsetY))), patternMask);
+            int32_t patternIndices[4];
+            Vec4::StoreUnaligned(patternIndices, Vec4::Madd(patternY, patternRowSize, patternX));
+
+            const Vec4::FloatType thresholds = Vec4::LoadImmediate(
+                indexMatrix[patternIndices[0]], indexMatrix[patternIndices[1]], indexMatrix[patternIndices[2]],
+                indexMatrix[patternIndices[3]]);
+            const Vec4::FloatType values = Vec4::LoadImmediate(
+                outValues[blockIndices[0]], outValues[blockIndices[1]], outValues[blockIndices[2]], outValues[blockIndices[3]]);
+
+            float results[4];
+            Vec4::StoreUnaligned(results, Vec4::Select(one, zero, Vec4::CmpGt(values, thresholds)));
+            for (size_t blockIndex = 0; blockIndex < blockSize; ++blockIndex)
+            {
+                outValues[index + blockIndex] = results[blockIndex];
+            }
         }
     }
 
@@ -261,6 +261,70 @@ namespace GradientSignal
         }
     }
 
+    void GradientSurfaceDataComponent::ModifySurfacePointsFromList(
+        AZStd::span<const size_t> pointIndices, SurfaceData::PackedSurfacePointList& surfacePointList) const
+    {
+        if (m_configuration.m_modifierTags.empty())
+        {
+            return;
+        }
+
+        bool validShapeBounds = false;
+        AZ::Aabb shapeConstraintBounds;
+        if (m_validShapeBounds)
+        {
+            AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+            shapeConstraintBounds = m_cachedShapeConstraintBounds;
+            validShapeBounds = m_cachedShapeConstraintBounds.IsValid();
+        }
+
+        // Gather the points that pass the entity and shape checks first, so that the gradient can be sampled for all of them at once.
+        const AZ::EntityId entityId = GetEntityId();
+        const AZStd::span<const AZ::Vector3> positions = surfacePointList.GetPositions();
+        const AZStd::span<const AZ::EntityId> entityIds = surfacePointList.GetEntityIds();
+
+        AZStd::vector<size_t> sampledPointIndices;
+        AZStd::vector<AZ::Vector3> sampledPositions;
+        sampledPointIndices.reserve(pointIndices.size());
+        sampledPositions.reserve(pointIndices.size());
+        for (size_t pointIndex : pointIndices)
+        {
+            if (entityIds[pointIndex] == entityId)
+            {
+                continue;
+            }
+
+            bool inBounds = true;
+            if (validShapeBounds)
+            {
+                inBounds = false;
+                if (shapeConstraintBounds.Contains(positions[pointIndex]))
+                {
+                    LmbrCentral::ShapeComponentRequestsBus::EventResult(inBounds, m_configuration.m_shapeConstraintEntityId,
+                                                                        &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, positions[pointIndex]);
+                }
+            }
+
+            if (inBounds)
+            {
+                sampledPointIndices.push_back(pointIndex);
+                sampledPositions.push_back(positions[pointIndex]);
+            }
+        }
+
+        AZStd::vector<float> values(sampledPositions.size());
+        m_gradientSampler.GetValues(sampledPositions, values);
+
+        for (size_t index = 0; index < sampledPointIndices.size(); index++)
+        {
+            const float value = values[index];
+            if (value >= m_configuration.m_thresholdMin && value <= m_configuration.m_thresholdMax)
+            {
+                surfacePointList.AddMaxValueForMasks(sampledPointIndices[index], m_configuration.m_modifierTags, value);
+            }
+        }
+    }
+
     void GradientSurfaceDataComponent::OnCompositionChanged()
     {
         AZ_PROFILE_FUNCTION(Entity);
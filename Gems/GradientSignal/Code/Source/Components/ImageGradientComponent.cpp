@@ -227,23 +227,30 @@ namespace GradientSignal
             return;
         }
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
+        AZ::Vector3 uvws[GradientTransform::TransformChunkSize];
+        bool wasPointRejected[GradientTransform::TransformChunkSize];
 
         AZStd::shared_lock<decltype(m_imageMutex)> imageLock(m_imageMutex);
 
-        for (size_t index = 0; index < positions.size(); index++)
+        // Transform the positions one chunk at a time, then look up the image values for the ones that weren't rejected.
+        for (size_t chunkStart = 0; chunkStart < positions.size(); chunkStart += GradientTransform::TransformChunkSize)
         {
-            m_gradientTransform.TransformPositionToUVWNormalized(positions[index], uvw, wasPointRejected);
+            const size_t chunkSize = AZStd::min(GradientTransform::TransformChunkSize, positions.size() - chunkStart);
+            m_gradientTransform.TransformPositionsToUVWNormalized(
+                positions.subspan(chunkStart, chunkSize), AZStd::span<AZ::Vector3>(uvws, chunkSize),
+                AZStd::span<bool>(wasPointRejected, chunkSize));
 
-            if (!wasPointRejected)
-            {
-                outValues[index] = GetValueFromImageAsset(
-                    m_configuration.m_imageAsset, uvw, m_configuration.m_tilingX, m_configuration.m_tilingY, 0.0f);
-            }
-            else
+            for (size_t index = 0; index < chunkSize; index++)
             {
-                outValues[index] = 0.0f;
+                if (!wasPointRejected[index])
+                {
+                    outValues[chunkStart + index] = GetValueFromImageAsset(
+                        m_configuration.m_imageAsset, uvws[index], m_configuration.m_tilingX, m_configuration.m_tilingY, 0.0f);
+                }
+                else
+                {
+                    outValues[chunkStart + index] = 0.0f;
+                }
             }
         }
     }
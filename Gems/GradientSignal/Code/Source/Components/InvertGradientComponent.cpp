@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -146,10 +147,25 @@ namespace GradientSignal
         }
 
         m_configuration.m_gradientSampler.GetValues(positions, outValues);
-        for (auto& outValue : outValues)
+
+        using AZ::Simd::Vec4;
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        TransformValues(outValues, [&](Vec4::FloatArgType value)
         {
-            outValue = 1.0f - AZ::GetClamp(outValue, 0.0f, 1.0f);
-        }
+            return Vec4::Sub(one, Vec4::Clamp(value, zero, one));
+        });
+    }
+
+    bool InvertGradientComponent::CompileGradient(GradientProgramBuilder& builder, AZ::u32 positions, AZ::u32 output) const
+    {
+        builder.AddGradientSampler(m_configuration.m_gradientSampler, positions, output);
+
+        GradientProgram::Instruction instruction;
+        instruction.m_opCode = GradientProgram::OpCode::InvertClamped;
+        instruction.m_output = output;
+        builder.AddInstruction(instruction);
+        return true;
     }
 
     bool InvertGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
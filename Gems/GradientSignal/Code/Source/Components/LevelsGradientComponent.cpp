@@ -12,6 +12,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/Util.h>
 
 namespace GradientSignal
@@ -200,6 +201,22 @@ namespace GradientSignal
                 m_configuration.m_outputMin, m_configuration.m_outputMax);
     }
 
+    bool LevelsGradientComponent::CompileGradient(GradientProgramBuilder& builder, AZ::u32 positions, AZ::u32 output) const
+    {
+        builder.AddGradientSampler(m_configuration.m_gradientSampler, positions, output);
+
+        GradientProgram::Instruction instruction;
+        instruction.m_opCode = GradientProgram::OpCode::Levels;
+        instruction.m_output = output;
+        instruction.m_params[0] = m_configuration.m_inputMid;
+        instruction.m_params[1] = m_configuration.m_inputMin;
+        instruction.m_params[2] = m_configuration.m_inputMax;
+        instruction.m_params[3] = m_configuration.m_outputMin;
+        instruction.m_params[4] = m_configuration.m_outputMax;
+        builder.AddInstruction(instruction);
+        return true;
+    }
+
     bool LevelsGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
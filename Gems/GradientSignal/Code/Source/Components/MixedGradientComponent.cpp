@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -303,33 +304,113 @@ namespace GradientSignal
             // added check to prevent opacity of 0.0, which will bust when we unpremultiply the alpha out
             if (layer.m_enabled && layer.m_gradientSampler.m_opacity != 0.0f)
             {
-                // Precalculate the inverse opacity that we'll use for blending the current accumulated value with.
-                // In the one case of "Initialize" blending, force this value to 0 so that we erase any accumulated values.
-                const float inverseOpacity = (layer.m_operation == MixedGradientLayer::MixingOperation::Initialize)
-                    ? 0.0f
-                    : (1.0f - layer.m_gradientSampler.m_opacity);
-
                 // this includes leveling and opacity result, we need unpremultiplied opacity to combine properly
                 layer.m_gradientSampler.GetValues(positions, layerValues);
+                MixValues(layer.m_operation, layer.m_gradientSampler.m_opacity, outValues, layerValues);
+            }
+        }
+
+        using AZ::Simd::Vec4;
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        TransformValues(outValues, [&](Vec4::FloatArgType value)
+        {
+            return Vec4::Clamp(value, zero, one);
+        });
+    }
+
+
+
+    bool MixedGradientComponent::CompileGradient(GradientProgramBuilder& builder, AZ::u32 positions, AZ::u32 output) const
+    {
+        // Initialize the output to 0.0f, the layer blends will combine with this.
+        GradientProgram::Instruction initialize;
+        initialize.m_opCode = GradientProgram::OpCode::Fill;
+        initialize.m_output = output;
+        builder.AddInstruction(initialize);
 
-                for (size_t index = 0; index < outValues.size(); index++)
-                {
-                    // unpremultiplied alpha (we clamp the end result)
-                    const float currentUnpremultiplied = layerValues[index] / layer.m_gradientSampler.m_opacity;
-                    const float operationResult = PerformMixingOperation(layer.m_operation, outValues[index], currentUnpremultiplied);
-                    // blend layers (re-applying opacity, which is why we needed to use unpremultiplied)
-                    outValues[index] = (outValues[index] * inverseOpacity) + (operationResult * layer.m_gradientSampler.m_opacity);
-                }
+        const AZ::u32 layerValues = builder.AcquireValueRegister();
+        for (const auto& layer : m_configuration.m_layers)
+        {
+            // added check to prevent opacity of 0.0, which will bust when we unpremultiply the alpha out
+            if (layer.m_enabled && layer.m_gradientSampler.m_opacity != 0.0f)
+            {
+                builder.AddGradientSampler(layer.m_gradientSampler, positions, layerValues);
+
+                GradientProgram::Instruction mix;
+                mix.m_opCode = GradientProgram::OpCode::Mix;
+                mix.m_mode = static_cast<AZ::u8>(layer.m_operation);
+                mix.m_output = output;
+                mix.m_input = layerValues;
+                mix.m_params[0] = layer.m_gradientSampler.m_opacity;
+                builder.AddInstruction(mix);
             }
         }
+        builder.ReleaseValueRegister(layerValues);
+
+        GradientProgram::Instruction clamp;
+        clamp.m_opCode = GradientProgram::OpCode::Clamp;
+        clamp.m_output = output;
+        builder.AddInstruction(clamp);
+        return true;
+    }
+
+    void MixedGradientComponent::MixValues(
+        MixedGradientLayer::MixingOperation operation, float opacity, AZStd::span<float> inOutValues, AZStd::span<const float> layerValues)
+    {
+        AZ_Assert(inOutValues.size() == layerValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            layerValues.size(), inOutValues.size());
 
-        for (auto& outValue : outValues)
+        // Select the mixing operation once for the whole list, instead of once per value.
+        switch (operation)
         {
-            outValue = AZ::GetClamp(outValue, 0.0f, 1.0f);
+        case MixedGradientLayer::MixingOperation::Initialize:
+            MixValues<MixedGradientLayer::MixingOperation::Initialize>(opacity, inOutValues, layerValues);
+            break;
+        case MixedGradientLayer::MixingOperation::Multiply:
+            MixValues<MixedGradientLayer::MixingOperation::Multiply>(opacity, inOutValues, layerValues);
+            break;
+        case MixedGradientLayer::MixingOperation::Add:
+            MixValues<MixedGradientLayer::MixingOperation::Add>(opacity, inOutValues, layerValues);
+            break;
+        case MixedGradientLayer::MixingOperation::Subtract:
+            MixValues<MixedGradientLayer::MixingOperation::Subtract>(opacity, inOutValues, layerValues);
+            break;
+        case MixedGradientLayer::MixingOperation::Min:
+            MixValues<MixedGradientLayer::MixingOperation::Min>(opacity, inOutValues, layerValues);
+            break;
+        case MixedGradientLayer::MixingOperation::Max:
+            MixValues<MixedGradientLayer::MixingOperation::Max>(opacity, inOutValues, layerValues);
+            break;
+        case MixedGradientLayer::MixingOperation::Average:
+            MixValues<MixedGradientLayer::MixingOperation::Average>(opacity, inOutValues, layerValues);
+            break;
+        case MixedGradientLayer::MixingOperation::Overlay:
+            MixValues<MixedGradientLayer::MixingOperation::Overlay>(opacity, inOutValues, layerValues);
+            break;
+        case MixedGradientLayer::MixingOperation::Normal:
+        default:
+            MixValues<MixedGradientLayer::MixingOperation::Normal>(opacity, inOutValues, layerValues);
+            break;
         }
     }
 
+    template<MixedGradientLayer::MixingOperation Operation>
+    void MixedGradientComponent::MixValues(float opacity, AZStd::span<float> inOutValues, AZStd::span<const float> layerValues)
+    {
+        // Precalculate the inverse opacity that we'll use for blending the current accumulated value with.
+        // In the one case of "Initialize" blending, force this value to 0 so that we erase any accumulated values.
+        const float inverseOpacity = (Operation == MixedGradientLayer::MixingOperation::Initialize) ? 0.0f : (1.0f - opacity);
 
+        for (size_t index = 0; index < inOutValues.size(); index++)
+        {
+            // unpremultiplied alpha (we clamp the end result)
+            const float currentUnpremultiplied = layerValues[index] / opacity;
+            const float operationResult = PerformMixingOperation(Operation, inOutValues[index], currentUnpremultiplied);
+            // blend layers (re-applying opacity, which is why we needed to use unpremultiplied)
+            inOutValues[index] = (inOutValues[index] * inverseOpacity) + (operationResult * opacity);
+        }
+    }
 
     bool MixedGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
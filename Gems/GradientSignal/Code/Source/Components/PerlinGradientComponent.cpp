@@ -14,6 +14,7 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <LmbrCentral/Dependency/DependencyNotificationBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
@@ -211,24 +212,59 @@ namespace GradientSignal
             return;
         }
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
+        AZ::Vector3 uvws[GradientTransform::TransformChunkSize];
+        bool wasPointRejected[GradientTransform::TransformChunkSize];
 
         AZStd::shared_lock<decltype(m_transformMutex)> lock(m_transformMutex);
 
-        for (size_t index = 0; index < positions.size(); index++)
+        // Transform the positions one chunk at a time, then generate the noise for the chunk in batches of four positions.
+        for (size_t chunkStart = 0; chunkStart < positions.size(); chunkStart += GradientTransform::TransformChunkSize)
         {
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
+            const size_t chunkSize = AZStd::min(GradientTransform::TransformChunkSize, positions.size() - chunkStart);
+            const AZStd::span<float> chunkValues = outValues.subspan(chunkStart, chunkSize);
 
-            if (!wasPointRejected)
+            m_gradientTransform.TransformPositionsToUVW(
+                positions.subspan(chunkStart, chunkSize), AZStd::span<AZ::Vector3>(uvws, chunkSize),
+                AZStd::span<bool>(wasPointRejected, chunkSize));
+
+            // Returns true if the block of four positions starting at blockStart has at least one position that wasn't rejected.
+            auto hasAcceptedPoints = [&wasPointRejected, chunkSize](size_t blockStart)
             {
-                outValues[index] = m_perlinImprovedNoise->GenerateOctaveNoise(
-                    uvw.GetX(), uvw.GetY(), uvw.GetZ(), m_configuration.m_octave, m_configuration.m_amplitude,
-                    m_configuration.m_frequency);
+                const size_t blockEnd = AZStd::min<size_t>(blockStart + 4, chunkSize);
+                return AZStd::find(wasPointRejected + blockStart, wasPointRejected + blockEnd, false) != wasPointRejected + blockEnd;
+            };
+
+            // Generate the noise for each run of blocks that have accepted positions, and skip the blocks where every position
+            // was rejected.
+            size_t blockStart = 0;
+            while (blockStart < chunkSize)
+            {
+                size_t runEnd = blockStart;
+                while ((runEnd < chunkSize) && hasAcceptedPoints(runEnd))
+                {
+                    runEnd = AZStd::min<size_t>(runEnd + 4, chunkSize);
+                }
+
+                if (runEnd > blockStart)
+                {
+                    const size_t runSize = runEnd - blockStart;
+                    m_perlinImprovedNoise->GenerateOctaveNoise(
+                        AZStd::span<const AZ::Vector3>(uvws + blockStart, runSize), chunkValues.subspan(blockStart, runSize),
+                        m_configuration.m_octave, m_configuration.m_amplitude, m_configuration.m_frequency);
+                    blockStart = runEnd;
+                }
+                else
+                {
+                    blockStart = AZStd::min<size_t>(blockStart + 4, chunkSize);
+                }
             }
-            else
+
+            for (size_t index = 0; index < chunkSize; index++)
             {
-                outValues[index] = 0.0f;
+                if (wasPointRejected[index])
+                {
+                    chunkValues[index] = 0.0f;
+                }
             }
         }
     }
@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -169,10 +170,55 @@ namespace GradientSignal
         m_configuration.m_gradientSampler.GetValues(positions, outValues);
 
         // Run through all the input values and posterize them.
-        for (auto& outValue : outValues)
+        PosterizeValues(outValues, bands, m_configuration.m_mode);
+    }
+
+    void PosterizeGradientComponent::PosterizeValues(AZStd::span<float> inOutValues, float bands, PosterizeGradientConfig::ModeType mode)
+    {
+        // Each mode maps a band to (band + offset) / denominator, see PosterizeValue() for the output ranges.
+        float bandOffset = 0.0f;
+        float bandDenominator = bands;
+        switch (mode)
         {
-            outValue = PosterizeValue(outValue, bands, m_configuration.m_mode);
+        default:
+        case PosterizeGradientConfig::ModeType::Floor:
+            break;
+        case PosterizeGradientConfig::ModeType::Round:
+            bandOffset = 0.5f;
+            break;
+        case PosterizeGradientConfig::ModeType::Ceiling:
+            bandOffset = 1.0f;
+            break;
+        case PosterizeGradientConfig::ModeType::Ps:
+            bandDenominator = bands - 1.0f;
+            break;
         }
+
+        using AZ::Simd::Vec4;
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType numBands = Vec4::Splat(bands);
+        const Vec4::FloatType maxBand = Vec4::Splat(bands - 1.0f);
+        const Vec4::FloatType offset = Vec4::Splat(bandOffset);
+        const Vec4::FloatType denominator = Vec4::Splat(bandDenominator);
+        TransformValues(inOutValues, [&](Vec4::FloatArgType value)
+        {
+            const Vec4::FloatType band = Vec4::Min(Vec4::Floor(Vec4::Mul(Vec4::Clamp(value, zero, one), numBands)), maxBand);
+            return Vec4::Min(Vec4::Div(Vec4::Add(band, offset), denominator), one);
+        });
+    }
+
+    bool PosterizeGradientComponent::CompileGradient(GradientProgramBuilder& builder, AZ::u32 positions, AZ::u32 output) const
+    {
+        builder.AddGradientSampler(m_configuration.m_gradientSampler, positions, output);
+
+        GradientProgram::Instruction instruction;
+        instruction.m_opCode = GradientProgram::OpCode::Posterize;
+        instruction.m_output = output;
+        instruction.m_mode = static_cast<AZ::u8>(m_configuration.m_mode);
+        instruction.m_params[0] = AZ::GetMax(static_cast<float>(m_configuration.m_bands), 2.0f);
+        builder.AddInstruction(instruction);
+        return true;
     }
 
     bool PosterizeGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
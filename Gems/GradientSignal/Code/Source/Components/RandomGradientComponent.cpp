@@ -191,24 +191,31 @@ namespace GradientSignal
             return;
         }
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
+        AZ::Vector3 uvws[GradientTransform::TransformChunkSize];
+        bool wasPointRejected[GradientTransform::TransformChunkSize];
         const AZStd::size_t seed = m_configuration.m_randomSeed +
             AZStd::size_t(2); // Add 2 to avoid seeds 0 and 1, which can create strange patterns with this particular algorithm
 
         AZStd::shared_lock<decltype(m_transformMutex)> lock(m_transformMutex);
 
-        for (size_t index = 0; index < positions.size(); index++)
+        // Transform the positions one chunk at a time, then generate the random values for the ones that weren't rejected.
+        for (size_t chunkStart = 0; chunkStart < positions.size(); chunkStart += GradientTransform::TransformChunkSize)
         {
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
+            const size_t chunkSize = AZStd::min(GradientTransform::TransformChunkSize, positions.size() - chunkStart);
+            m_gradientTransform.TransformPositionsToUVW(
+                positions.subspan(chunkStart, chunkSize), AZStd::span<AZ::Vector3>(uvws, chunkSize),
+                AZStd::span<bool>(wasPointRejected, chunkSize));
 
-            if (!wasPointRejected)
-            {
-                outValues[index] = GetRandomValue(uvw, seed);
-            }
-            else
+            for (size_t index = 0; index < chunkSize; index++)
             {
-                outValues[index] = 0.0f;
+                if (!wasPointRejected[index])
+                {
+                    outValues[chunkStart + index] = GetRandomValue(uvws[index], seed);
+                }
+                else
+                {
+                    outValues[chunkStart + index] = 0.0f;
+                }
             }
         }
     }
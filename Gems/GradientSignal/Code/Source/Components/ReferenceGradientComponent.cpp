@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -145,6 +146,12 @@ namespace GradientSignal
         m_configuration.m_gradientSampler.GetValues(positions, outValues);
     }
 
+    bool ReferenceGradientComponent::CompileGradient(GradientProgramBuilder& builder, AZ::u32 positions, AZ::u32 output) const
+    {
+        builder.AddGradientSampler(m_configuration.m_gradientSampler, positions, output);
+        return true;
+    }
+
     bool ReferenceGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
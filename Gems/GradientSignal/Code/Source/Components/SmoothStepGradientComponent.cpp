@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Util.h>
 
@@ -184,6 +185,20 @@ namespace GradientSignal
         m_configuration.m_smoothStep.GetSmoothedValues(outValues);
     }
 
+    bool SmoothStepGradientComponent::CompileGradient(GradientProgramBuilder& builder, AZ::u32 positions, AZ::u32 output) const
+    {
+        builder.AddGradientSampler(m_configuration.m_gradientSampler, positions, output);
+
+        GradientProgram::Instruction instruction;
+        instruction.m_opCode = GradientProgram::OpCode::SmoothStep;
+        instruction.m_output = output;
+        instruction.m_params[0] = m_configuration.m_smoothStep.m_falloffMidpoint;
+        instruction.m_params[1] = m_configuration.m_smoothStep.m_falloffRange;
+        instruction.m_params[2] = m_configuration.m_smoothStep.m_falloffStrength;
+        builder.AddInstruction(instruction);
+        return true;
+    }
+
     bool SmoothStepGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
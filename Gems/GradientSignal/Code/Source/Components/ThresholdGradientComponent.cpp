@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -150,10 +151,27 @@ namespace GradientSignal
         }
 
         m_configuration.m_gradientSampler.GetValues(positions, outValues);
-        for (auto& outValue : outValues)
+
+        using AZ::Simd::Vec4;
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType threshold = Vec4::Splat(m_configuration.m_threshold);
+        TransformValues(outValues, [&](Vec4::FloatArgType value)
         {
-            outValue = (outValue <= m_configuration.m_threshold) ? 0.0f : 1.0f;
-        }
+            return Vec4::Select(zero, one, Vec4::CmpLtEq(value, threshold));
+        });
+    }
+
+    bool ThresholdGradientComponent::CompileGradient(GradientProgramBuilder& builder, AZ::u32 positions, AZ::u32 output) const
+    {
+        builder.AddGradientSampler(m_configuration.m_gradientSampler, positions, output);
+
+        GradientProgram::Instruction instruction;
+        instruction.m_opCode = GradientProgram::OpCode::Threshold;
+        instruction.m_output = output;
+        instruction.m_params[0] = m_configuration.m_threshold;
+        builder.AddInstruction(instruction);
+        return true;
     }
 
     bool ThresholdGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
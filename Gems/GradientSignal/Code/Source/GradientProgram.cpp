@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <GradientSignal/Components/MixedGradientComponent.h>
+#include <GradientSignal/Components/PosterizeGradientComponent.h>
+#include <GradientSignal/Ebuses/GradientRequestBus.h>
+#include <GradientSignal/GradientProgram.h>
+#include <GradientSignal/GradientSampler.h>
+#include <GradientSignal/SmoothStep.h>
+#include <GradientSignal/Util.h>
+#include <SurfaceData/SurfaceDataSystemRequestBus.h>
+
+namespace GradientSignal
+{
+    void GradientProgram::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        // The registers only need to hold a single tile, so they are shared by all the tiles of the query.
+        const size_t registerSize = AZStd::min(TileSize, positions.size());
+        AZStd::vector<AZ::Vector3> positionRegisters((m_numPositionRegisters - 1) * registerSize);
+        AZStd::vector<float> valueRegisters((m_numValueRegisters - 1) * registerSize);
+
+        for (size_t tileStart = 0; tileStart < positions.size(); tileStart += TileSize)
+        {
+            const size_t tileCount = AZStd::min(TileSize, positions.size() - tileStart);
+            ExecuteTile(
+                positions.subspan(tileStart, tileCount), outValues.subspan(tileStart, tileCount), positionRegisters, valueRegisters,
+                registerSize);
+        }
+    }
+
+    void GradientProgram::ExecuteTile(
+        AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, AZStd::span<AZ::Vector3> positionRegisters,
+        AZStd::span<float> valueRegisters, size_t registerSize) const
+    {
+        using AZ::Simd::Vec4;
+
+        const size_t tileCount = positions.size();
+        auto GetPositions = [&](Register positionRegister) -> AZStd::span<const AZ::Vector3>
+        {
+            return (positionRegister == InputPositionsRegister)
+                ? positions
+                : AZStd::span<const AZ::Vector3>(positionRegisters.subspan((positionRegister - 1) * registerSize, tileCount));
+        };
+        auto GetValueRegister = [&](Register valueRegister) -> AZStd::span<float>
+        {
+            return (valueRegister == OutputRegister) ? outValues : valueRegisters.subspan((valueRegister - 1) * registerSize, tileCount);
+        };
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+        for (const Instruction& instruction : m_instructions)
+        {
+            // The transform instructions write to a position register instead of a value register.
+            AZStd::span<float> values = (instruction.m_opCode != OpCode::TransformPositions)
+                ? GetValueRegister(instruction.m_output)
+                : AZStd::span<float>();
+
+            switch (instruction.m_opCode)
+            {
+            case OpCode::Fill:
+                AZStd::fill(values.begin(), values.end(), instruction.m_params[0]);
+                break;
+
+            case OpCode::SampleGradient:
+                {
+                    // Lock the surface data bus before the gradient bus, the same way GradientSampler does, to prevent lock inversions
+                    // with gradients that query surface data.
+                    auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+                    typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+
+                    // Gradients that aren't active don't write any values, so make sure they read as 0.
+                    AZStd::fill(values.begin(), values.end(), 0.0f);
+                    GradientRequestBus::Event(
+                        instruction.m_gradientId, &GradientRequestBus::Events::GetValues, GetPositions(instruction.m_positions), values);
+                }
+                break;
+
+            case OpCode::TransformPositions:
+                {
+                    AZStd::span<const AZ::Vector3> inPositions = GetPositions(instruction.m_positions);
+                    AZStd::span<AZ::Vector3> outPositions = positionRegisters.subspan((instruction.m_output - 1) * registerSize, tileCount);
+                    for (size_t index = 0; index < tileCount; index++)
+                    {
+                        outPositions[index] = instruction.m_transform * inPositions[index];
+                    }
+                }
+                break;
+
+            case OpCode::Invert:
+                TransformValues(values, [&](Vec4::FloatArgType value)
+                {
+                    return Vec4::Sub(one, value);
+                });
+                break;
+
+            case OpCode::InvertClamped:
+                TransformValues(values, [&](Vec4::FloatArgType value)
+                {
+                    return Vec4::Sub(one, Vec4::Clamp(value, zero, one));
+                });
+                break;
+
+            case OpCode::Scale:
+                {
+                    const Vec4::FloatType scale = Vec4::Splat(instruction.m_params[0]);
+                    TransformValues(values, [&](Vec4::FloatArgType value)
+                    {
+                        return Vec4::Mul(value, scale);
+                    });
+                }
+                break;
+
+            case OpCode::Clamp:
+                TransformValues(values, [&](Vec4::FloatArgType value)
+                {
+                    return Vec4::Clamp(value, zero, one);
+                });
+                break;
+
+            case OpCode::Threshold:
+                {
+                    const Vec4::FloatType threshold = Vec4::Splat(instruction.m_params[0]);
+                    TransformValues(values, [&](Vec4::FloatArgType value)
+                    {
+                        return Vec4::Select(zero, one, Vec4::CmpLtEq(value, threshold));
+                    });
+                }
+                break;
+
+            case OpCode::Levels:
+                GetLevels(
+                    values, instruction.m_params[0], instruction.m_params[1], instruction.m_params[2], instruction.m_params[3],
+                    instruction.m_params[4]);
+                break;
+
+            case OpCode::Posterize:
+                PosterizeGradientComponent::PosterizeValues(
+                    values, instruction.m_params[0], static_cast<PosterizeGradientConfig::ModeType>(instruction.m_mode));
+                break;
+
+            case OpCode::SmoothStep:
+                {
+                    SmoothStep smoothStep;
+                    smoothStep.m_falloffMidpoint = instruction.m_params[0];
+                    smoothStep.m_falloffRange = instruction.m_params[1];
+                    smoothStep.m_falloffStrength = instruction.m_params[2];
+                    smoothStep.GetSmoothedValues(values);
+                }
+                break;
+
+            case OpCode::Mix:
+                MixedGradientComponent::MixValues(
+                    static_cast<MixedGradientLayer::MixingOperation>(instruction.m_mode), instruction.m_params[0], values,
+                    GetValueRegister(instruction.m_input));
+                break;
+
+            default:
+                AZ_Assert(false, "Unknown gradient program instruction %u.", static_cast<AZ::u32>(instruction.m_opCode));
+                break;
+            }
+        }
+    }
+
+    AZStd::shared_ptr<const GradientProgram> GradientProgramBuilder::Build(const AZ::EntityId& gradientId)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        GradientProgramBuilder builder;
+        builder.m_program.m_gradientId = gradientId;
+        builder.AddGradient(gradientId, GradientProgram::InputPositionsRegister, GradientProgram::OutputRegister);
+
+        // Cyclic references are left to the GradientSampler to report, as the gradients get sampled through the bus instead.
+        if (builder.m_hasCyclicReferences)
+        {
+            return {};
+        }
+
+        return AZStd::make_shared<GradientProgram>(AZStd::move(builder.m_program));
+    }
+
+    void GradientProgramBuilder::AddGradient(const AZ::EntityId& gradientId, Register positions, Register output)
+    {
+        if (AZStd::find(m_gradientStack.begin(), m_gradientStack.end(), gradientId) != m_gradientStack.end())
+        {
+            m_hasCyclicReferences = true;
+            return;
+        }
+
+        m_gradientStack.push_back(gradientId);
+        bool isCompiled = false;
+        GradientRequestBus::EventResult(isCompiled, gradientId, &GradientRequestBus::Events::CompileGradient, *this, positions, output);
+        m_gradientStack.pop_back();
+
+        if (isCompiled)
+        {
+            auto& dependencies = m_program.m_dependencies;
+            if (AZStd::find(dependencies.begin(), dependencies.end(), gradientId) == dependencies.end())
+            {
+                dependencies.push_back(gradientId);
+            }
+            return;
+        }
+
+        GradientProgram::Instruction instruction;
+        instruction.m_opCode = GradientProgram::OpCode::SampleGradient;
+        instruction.m_output = output;
+        instruction.m_positions = positions;
+        instruction.m_gradientId = gradientId;
+        AddInstruction(instruction);
+    }
+
+    void GradientProgramBuilder::AddGradientSampler(const GradientSampler& sampler, Register positions, Register output)
+    {
+        // Follow the same steps as GradientSampler::GetValues().
+        if (sampler.m_opacity <= 0.0f || !sampler.m_gradientId.IsValid())
+        {
+            GradientProgram::Instruction instruction;
+            instruction.m_opCode = GradientProgram::OpCode::Fill;
+            instruction.m_output = output;
+            AddInstruction(instruction);
+            return;
+        }
+
+        if (sampler.m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(sampler))
+        {
+            GradientProgram::Instruction instruction;
+            instruction.m_opCode = GradientProgram::OpCode::TransformPositions;
+            instruction.m_output = AcquirePositionRegister();
+            instruction.m_positions = positions;
+            instruction.m_transform.SetFromEulerDegrees(sampler.m_rotate);
+            instruction.m_transform.MultiplyByScale(sampler.m_scale);
+            instruction.m_transform.SetTranslation(sampler.m_translate);
+            AddInstruction(instruction);
+
+            AddGradient(sampler.m_gradientId, instruction.m_output, output);
+            ReleasePositionRegister(instruction.m_output);
+        }
+        else
+        {
+            AddGradient(sampler.m_gradientId, positions, output);
+        }
+
+        if (sampler.m_invertInput)
+        {
+            GradientProgram::Instruction instruction;
+            instruction.m_opCode = GradientProgram::OpCode::Invert;
+            instruction.m_output = output;
+            AddInstruction(instruction);
+        }
+
+        if (sampler.m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(sampler))
+        {
+            GradientProgram::Instruction instruction;
+            instruction.m_opCode = GradientProgram::OpCode::Levels;
+            instruction.m_output = output;
+            instruction.m_params = { { sampler.m_inputMid, sampler.m_inputMin, sampler.m_inputMax, sampler.m_outputMin, sampler.m_outputMax } };
+            AddInstruction(instruction);
+        }
+
+        if (sampler.m_opacity != 1.0f)
+        {
+            GradientProgram::Instruction instruction;
+            instruction.m_opCode = GradientProgram::OpCode::Scale;
+            instruction.m_output = output;
+            instruction.m_params[0] = sampler.m_opacity;
+            AddInstruction(instruction);
+        }
+    }
+
+    void GradientProgramBuilder::AddInstruction(const GradientProgram::Instruction& instruction)
+    {
+        AZ_Assert(instruction.m_output < m_program.m_numValueRegisters || instruction.m_opCode == GradientProgram::OpCode::TransformPositions,
+            "Gradient program instruction writes to a register that hasn't been acquired.");
+        m_program.m_instructions.push_back(instruction);
+    }
+
+    GradientProgramBuilder::Register GradientProgramBuilder::AcquireValueRegister()
+    {
+        if (!m_freeValueRegisters.empty())
+        {
+            const Register valueRegister = m_freeValueRegisters.back();
+            m_freeValueRegisters.pop_back();
+            return valueRegister;
+        }
+
+        return static_cast<Register>(m_program.m_numValueRegisters++);
+    }
+
+    void GradientProgramBuilder::ReleaseValueRegister(Register valueRegister)
+    {
+        AZ_Assert(valueRegister != GradientProgram::OutputRegister, "The output register can't be released.");
+        m_freeValueRegisters.push_back(valueRegister);
+    }
+
+    GradientProgramBuilder::Register GradientProgramBuilder::AcquirePositionRegister()
+    {
+        if (!m_freePositionRegisters.empty())
+        {
+            const Register positionRegister = m_freePositionRegisters.back();
+            m_freePositionRegisters.pop_back();
+            return positionRegister;
+        }
+
+        return static_cast<Register>(m_program.m_numPositionRegisters++);
+    }
+
+    void GradientProgramBuilder::ReleasePositionRegister(Register positionRegister)
+    {
+        AZ_Assert(positionRegister != GradientProgram::InputPositionsRegister, "The input positions register can't be released.");
+        m_freePositionRegisters.push_back(positionRegister);
+    }
+} // namespace GradientSignal
@@ -8,6 +8,7 @@
 
 
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
 #include <GradientSignal/GradientTransform.h>
 
 
@@ -93,6 +94,150 @@ namespace GradientSignal
         outUVW = m_normalizeExtentsReciprocal * (outUVW - m_shapeBounds.GetMin());
     }
 
+    void GradientTransform::TransformPositionsToUVW(
+        AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const
+    {
+        TransformPositionsToUVW(inPositions, outUVWs, wasPointRejected, false);
+    }
+
+    void GradientTransform::TransformPositionsToUVWNormalized(
+        AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const
+    {
+        TransformPositionsToUVW(inPositions, outUVWs, wasPointRejected, true);
+    }
+
+    void GradientTransform::TransformPositionsToUVW(
+        AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected,
+        bool normalize) const
+    {
+        AZ_Assert(
+            (inPositions.size() == outUVWs.size()) && (inPositions.size() == wasPointRejected.size()),
+            "input and output lists are different sizes (%zu vs %zu vs %zu).", inPositions.size(), outUVWs.size(),
+            wasPointRejected.size());
+
+        using AZ::Simd::Vec4;
+
+        // These are the Vec4 versions of the wrapping functions, which produce the same results as the Vector3 versions below.
+        switch (m_wrappingType)
+        {
+        default:
+        case WrappingType::None:
+            TransformPositionsToUVW(inPositions, outUVWs, wasPointRejected, normalize,
+                [](Vec4::FloatArgType value, [[maybe_unused]] Vec4::FloatArgType min, [[maybe_unused]] Vec4::FloatArgType max)
+                {
+                    return value;
+                });
+            break;
+        case WrappingType::ClampToEdge:
+        case WrappingType::ClampToZero:
+            TransformPositionsToUVW(inPositions, outUVWs, wasPointRejected, normalize,
+                [](Vec4::FloatArgType value, Vec4::FloatArgType min, Vec4::FloatArgType max)
+                {
+                    return Vec4::Clamp(value, min, Vec4::Sub(max, Vec4::Splat(UvEpsilon)));
+                });
+            break;
+        case WrappingType::Mirror:
+            TransformPositionsToUVW(inPositions, outUVWs, wasPointRejected, normalize,
+                [](Vec4::FloatArgType value, Vec4::FloatArgType min, Vec4::FloatArgType max)
+                {
+                    // See GetMirroredPointInAabb() for the details of the mirroring pattern.
+                    const Vec4::FloatType range = Vec4::Sub(max, min);
+                    const Vec4::FloatType rangeX2 = Vec4::Mul(range, Vec4::Splat(2.0f));
+                    Vec4::FloatType relativeValue = Vec4::Sub(value, min);
+                    relativeValue = Vec4::Mod(Vec4::Add(Vec4::Mod(relativeValue, rangeX2), rangeX2), rangeX2);
+                    const Vec4::FloatType mirroredValue = Vec4::Sub(rangeX2, Vec4::Add(relativeValue, Vec4::Splat(UvEpsilon)));
+                    return Vec4::Add(Vec4::Select(mirroredValue, relativeValue, Vec4::CmpGtEq(relativeValue, range)), min);
+                });
+            break;
+        case WrappingType::Repeat:
+            TransformPositionsToUVW(inPositions, outUVWs, wasPointRejected, normalize,
+                [](Vec4::FloatArgType value, Vec4::FloatArgType min, Vec4::FloatArgType max)
+                {
+                    return Vec4::Wrap(value, min, max);
+                });
+            break;
+        }
+    }
+
+    template<typename WrapFunction>
+    void GradientTransform::TransformPositionsToUVW(
+        AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected,
+        bool normalize, WrapFunction wrapFunction) const
+    {
+        using AZ::Simd::Vec4;
+
+        // This matches TransformPositionToUVW(), but transforms four positions at a time, with each Vec4 holding one of the
+        // components of the four positions.
+        Vec4::FloatType matrix[3][4];
+        Vec4::FloatType boundsMin[3];
+        Vec4::FloatType boundsMax[3];
+        Vec4::FloatType normalizeExtentsReciprocal[3];
+        for (int row = 0; row < 3; ++row)
+        {
+            for (int column = 0; column < 4; ++column)
+            {
+                matrix[row][column] = Vec4::Splat(m_inverseTransform.GetElement(row, column));
+            }
+            boundsMin[row] = Vec4::Splat(m_shapeBounds.GetMin().GetElement(row));
+            boundsMax[row] = Vec4::Splat(m_shapeBounds.GetMax().GetElement(row));
+            normalizeExtentsReciprocal[row] = Vec4::Splat(m_normalizeExtentsReciprocal.GetElement(row));
+        }
+        const Vec4::FloatType frequencyZoom = Vec4::Splat(m_frequencyZoom);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+        const size_t numPositions = inPositions.size();
+        for (size_t index = 0; index < numPositions; index += 4)
+        {
+            // The last block is padded with copies of the last position.
+            const size_t blockSize = AZStd::min<size_t>(4, numPositions - index);
+            const AZ::Vector3* positions[4];
+            for (size_t blockIndex = 0; blockIndex < 4; ++blockIndex)
+            {
+                positions[blockIndex] = &inPositions[index + AZStd::min(blockIndex, blockSize - 1)];
+            }
+
+            Vec4::FloatType position[3];
+            for (int component = 0; component < 3; ++component)
+            {
+                position[component] = Vec4::LoadImmediate(
+                    positions[0]->GetElement(component), positions[1]->GetElement(component), positions[2]->GetElement(component),
+                    positions[3]->GetElement(component));
+            }
+
+            float uvw[3][4];
+            Vec4::FloatType wasAccepted = Vec4::Splat(1.0f);
+            for (int row = 0; row < 3; ++row)
+            {
+                const Vec4::FloatType value = Vec4::Add(
+                    Vec4::Add(
+                        Vec4::Add(Vec4::Mul(matrix[row][0], position[0]), Vec4::Mul(matrix[row][1], position[1])),
+                        Vec4::Mul(matrix[row][2], position[2])),
+                    matrix[row][3]);
+
+                // Only the [min, max) range is accepted, see TransformPositionToUVW().
+                wasAccepted = Vec4::Select(
+                    wasAccepted, zero,
+                    Vec4::And(Vec4::CmpGtEq(value, boundsMin[row]), Vec4::CmpLt(value, boundsMax[row])));
+
+                Vec4::FloatType result = Vec4::Mul(wrapFunction(value, boundsMin[row], boundsMax[row]), frequencyZoom);
+                if (normalize)
+                {
+                    result = Vec4::Mul(normalizeExtentsReciprocal[row], Vec4::Sub(result, boundsMin[row]));
+                }
+                Vec4::StoreUnaligned(uvw[row], result);
+            }
+
+            float accepted[4];
+            Vec4::StoreUnaligned(accepted, m_alwaysAcceptPoint ? one : wasAccepted);
+            for (size_t blockIndex = 0; blockIndex < blockSize; ++blockIndex)
+            {
+                outUVWs[index + blockIndex].Set(uvw[0][blockIndex], uvw[1][blockIndex], uvw[2][blockIndex]);
+                wasPointRejected[index + blockIndex] = (accepted[blockIndex] == 0.0f);
+            }
+        }
+    }
+
     AZ::Vector3 GradientTransform::NoTransform(const AZ::Vector3& point, const AZ::Aabb& /*bounds*/)
     {
         return point;
@@ -8,6 +8,7 @@
 
 
 #include <GradientSignal/PerlinImprovedNoise.h>
+#include <AzCore/Math/SimdMath.h>
 
 #include <numeric>
 #include <random> // std::mt19937 std::random_device
@@ -60,6 +61,100 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+        // SIMD versions of the functions above, which evaluate four positions at once.
+        // The operations are kept in the same order as the scalar versions so that both produce the same results.
+        using AZ::Simd::Vec4;
+
+        // Branchless version of the Gradient() switch table. The low bit of the hash negates the first term, the next bit negates the
+        // second term, and the upper bits pick which coordinates the two terms come from.
+        AZ_FORCE_INLINE Vec4::FloatType Gradient(Vec4::Int32ArgType hash, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            const Vec4::Int32Type h = Vec4::And(hash, Vec4::Splat(0xF));
+            const Vec4::FloatType signBit = Vec4::Splat(-0.0f);
+
+            const Vec4::FloatType useYForU = Vec4::CastToFloat(Vec4::CmpGt(h, Vec4::Splat(7)));
+            const Vec4::FloatType useYForV = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(4)));
+            const Vec4::FloatType useXForV =
+                Vec4::CastToFloat(Vec4::Or(Vec4::CmpEq(h, Vec4::Splat(0xC)), Vec4::CmpEq(h, Vec4::Splat(0xE))));
+            const Vec4::FloatType negateU = Vec4::CastToFloat(Vec4::CmpNeq(Vec4::And(h, Vec4::Splat(1)), Vec4::ZeroInt()));
+            const Vec4::FloatType negateV = Vec4::CastToFloat(Vec4::CmpNeq(Vec4::And(h, Vec4::Splat(2)), Vec4::ZeroInt()));
+
+            const Vec4::FloatType u = Vec4::Select(y, x, useYForU);
+            const Vec4::FloatType v = Vec4::Select(y, Vec4::Select(x, z, useXForV), useYForV);
+
+            return Vec4::Add(Vec4::Xor(u, Vec4::And(negateU, signBit)), Vec4::Xor(v, Vec4::And(negateV, signBit)));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Fade(Vec4::FloatArgType t)
+        {
+            const Vec4::FloatType t3 = Vec4::Mul(Vec4::Mul(t, t), t);
+            const Vec4::FloatType t6 = Vec4::Mul(t, Vec4::Splat(6.0f));
+            return Vec4::Mul(t3, Vec4::Add(Vec4::Mul(t, Vec4::Sub(t6, Vec4::Splat(15.0f))), Vec4::Splat(10.0f)));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Lerp(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType x)
+        {
+            return Vec4::Add(a, Vec4::Mul(x, Vec4::Sub(b, a)));
+        }
+
+        Vec4::FloatType GenerateNoise(
+            const AZStd::array<int, 512>& p, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            const Vec4::FloatType floorX = Vec4::Floor(x);
+            const Vec4::FloatType floorY = Vec4::Floor(y);
+            const Vec4::FloatType floorZ = Vec4::Floor(z);
+            const Vec4::FloatType xf = Vec4::Sub(x, floorX);
+            const Vec4::FloatType yf = Vec4::Sub(y, floorY);
+            const Vec4::FloatType zf = Vec4::Sub(z, floorZ);
+
+            const Vec4::Int32Type mask = Vec4::Splat(255);
+            int32_t xi0[4];
+            int32_t yi0[4];
+            int32_t zi0[4];
+            Vec4::StoreUnaligned(xi0, Vec4::And(Vec4::ConvertToInt(floorX), mask));
+            Vec4::StoreUnaligned(yi0, Vec4::And(Vec4::ConvertToInt(floorY), mask));
+            Vec4::StoreUnaligned(zi0, Vec4::And(Vec4::ConvertToInt(floorZ), mask));
+
+            // The permutation table lookups don't vectorize without gather instructions, so they're done one lane at a time.
+            int32_t aaa[4], aba[4], aab[4], abb[4], baa[4], bba[4], bab[4], bbb[4];
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                const int xi1 = xi0[lane] + 1;
+                const int yi1 = yi0[lane] + 1;
+                const int zi1 = zi0[lane] + 1;
+                const int a0 = p[p[xi0[lane]] + yi0[lane]];
+                const int a1 = p[p[xi0[lane]] + yi1];
+                const int b0 = p[p[xi1] + yi0[lane]];
+                const int b1 = p[p[xi1] + yi1];
+                aaa[lane] = p[a0 + zi0[lane]];
+                aba[lane] = p[a1 + zi0[lane]];
+                aab[lane] = p[a0 + zi1];
+                abb[lane] = p[a1 + zi1];
+                baa[lane] = p[b0 + zi0[lane]];
+                bba[lane] = p[b1 + zi0[lane]];
+                bab[lane] = p[b0 + zi1];
+                bbb[lane] = p[b1 + zi1];
+            }
+
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType xf1 = Vec4::Sub(xf, one);
+            const Vec4::FloatType yf1 = Vec4::Sub(yf, one);
+            const Vec4::FloatType zf1 = Vec4::Sub(zf, one);
+            const Vec4::FloatType u = Fade(xf);
+            const Vec4::FloatType v = Fade(yf);
+            const Vec4::FloatType w = Fade(zf);
+
+            Vec4::FloatType x1, x2;
+            x1 = Lerp(Gradient(Vec4::LoadUnaligned(aaa), xf, yf, zf), Gradient(Vec4::LoadUnaligned(baa), xf1, yf, zf), u);
+            x2 = Lerp(Gradient(Vec4::LoadUnaligned(aba), xf, yf1, zf), Gradient(Vec4::LoadUnaligned(bba), xf1, yf1, zf), u);
+            const Vec4::FloatType y1 = Lerp(x1, x2, v);
+            x1 = Lerp(Gradient(Vec4::LoadUnaligned(aab), xf, yf, zf1), Gradient(Vec4::LoadUnaligned(bab), xf1, yf, zf1), u);
+            x2 = Lerp(Gradient(Vec4::LoadUnaligned(abb), xf, yf1, zf1), Gradient(Vec4::LoadUnaligned(bbb), xf1, yf1, zf1), u);
+            const Vec4::FloatType y2 = Lerp(x1, x2, v);
+
+            return Vec4::Div(Vec4::Add(Lerp(y1, y2, w), one), Vec4::Splat(2.0f));
+        }
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -87,6 +182,74 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoise(
+        AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, int octaves, float persistence, float initialFrequency) const
+    {
+        using AZ::Simd::Vec4;
+
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        // The normalization factor doesn't depend on the positions, so calculate it once for the whole list.
+        float maxValue = 0.0f;
+        {
+            float amplitude = 1.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                maxValue += amplitude;
+                amplitude *= persistence;
+            }
+        }
+        if (maxValue <= 0.0f)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        const Vec4::FloatType maxValueVec = Vec4::Splat(maxValue);
+        float x[4];
+        float y[4];
+        float z[4];
+        float results[4];
+
+        for (size_t index = 0; index < positions.size(); index += 4)
+        {
+            // The positions at the end of the list that don't fill a full Vec4 get padded with zeros.
+            const size_t count = AZStd::min<size_t>(4, positions.size() - index);
+            for (size_t lane = 0; lane < 4; ++lane)
+            {
+                const AZ::Vector3& position = (lane < count) ? positions[index + lane] : AZ::Vector3::CreateZero();
+                x[lane] = position.GetX();
+                y[lane] = position.GetY();
+                z[lane] = position.GetZ();
+            }
+
+            const Vec4::FloatType xValues = Vec4::LoadUnaligned(x);
+            const Vec4::FloatType yValues = Vec4::LoadUnaligned(y);
+            const Vec4::FloatType zValues = Vec4::LoadUnaligned(z);
+
+            Vec4::FloatType total = Vec4::ZeroFloat();
+            float frequency = initialFrequency;
+            float amplitude = 1.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                const Vec4::FloatType frequencyVec = Vec4::Splat(frequency);
+                const Vec4::FloatType noise = PerlinImprovedNoiseDetails::GenerateNoise(
+                    m_permutationTable, Vec4::Mul(xValues, frequencyVec), Vec4::Mul(yValues, frequencyVec),
+                    Vec4::Mul(zValues, frequencyVec));
+                total = Vec4::Add(total, Vec4::Mul(noise, Vec4::Splat(amplitude)));
+                amplitude *= persistence;
+                frequency *= 2.0f;
+            }
+
+            Vec4::StoreUnaligned(results, Vec4::Div(total, maxValueVec));
+            AZStd::copy(results, results + count, outValues.begin() + index);
+        }
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
@@ -16,6 +16,9 @@
 #include <AzCore/Math/Vector2.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzFramework/Asset/AssetCatalogBus.h>
+#include <GradientSignal/CompiledGradient.h>
+#include <GradientSignal/GradientTransform.h>
+#include <GradientSignal/PerlinImprovedNoise.h>
 
 namespace UnitTest
 {
@@ -79,7 +82,7 @@ namespace UnitTest
     BENCHMARK_DEFINE_F(GradientGetValues, BM_InvertGradient)(benchmark::State& state)
     {
         auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
-        auto entity = BuildTestDitherGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto entity = BuildTestInvertGradient(TestShapeHalfBounds, baseEntity->GetId());
         GradientSignalTestHelpers::RunGetValueOrGetValuesBenchmark(state, entity->GetId());
     }
 
@@ -169,6 +172,141 @@ namespace UnitTest
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SurfaceMaskGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SurfaceSlopeGradient);
 
+    // --------------------------------------------------------------------------------------
+    // Compiled Gradient Programs
+
+    BENCHMARK_DEFINE_F(GradientGetValues, BM_CompiledGradientChain)(benchmark::State& state)
+    {
+        // Build a chain of gradient modifiers on top of a random gradient, with a mixed gradient at the top.
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto smoothStepEntity = BuildTestSmoothStepGradient(TestShapeHalfBounds, levelsEntity->GetId());
+        auto invertEntity = BuildTestInvertGradient(TestShapeHalfBounds, smoothStepEntity->GetId());
+        auto posterizeEntity = BuildTestPosterizeGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto entity = BuildTestMixedGradient(TestShapeHalfBounds, invertEntity->GetId(), posterizeEntity->GetId());
+
+        const bool useCompiledGradient = (state.range(0) != 0);
+        const int64_t queryRange = state.range(1);
+        const float size = aznumeric_cast<float>(queryRange);
+
+        AZStd::vector<AZ::Vector3> positions(queryRange * queryRange);
+        GradientSignalTestHelpers::FillQueryPositions(positions, size, size);
+        AZStd::vector<float> results(queryRange * queryRange);
+
+        GradientSignal::CompiledGradient compiledGradient(entity->GetId());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            if (useCompiledGradient)
+            {
+                compiledGradient.GetValues(positions, results);
+            }
+            else
+            {
+                GradientSignal::GradientRequestBus::Event(
+                    entity->GetId(), &GradientSignal::GradientRequestBus::Events::GetValues, positions, results);
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(GradientGetValues, BM_CompiledGradientChain)
+        ->Args({ 0, 1024 })
+        ->Args({ 1, 1024 })
+        ->ArgNames({ "Compiled", "size" })
+        ->Unit(::benchmark::kMillisecond);
+
+    // --------------------------------------------------------------------------------------
+    // Gradient Transform
+
+    static void BM_GradientTransformPositions(benchmark::State& state)
+    {
+        const float queryRange = aznumeric_cast<float>(state.range(1));
+        const size_t numPositions = aznumeric_cast<size_t>(state.range(1) * state.range(1));
+        const bool useBatch = (state.range(0) != 0);
+
+        GradientSignal::GradientTransform gradientTransform(
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(queryRange * 0.5f)), AZ::Matrix3x4::CreateIdentity(), false, 1.0f,
+            GradientSignal::WrappingType::Mirror);
+
+        AZStd::vector<AZ::Vector3> positions(numPositions);
+        for (size_t index = 0; index < numPositions; index++)
+        {
+            positions[index] = AZ::Vector3(aznumeric_cast<float>(index % state.range(1)), aznumeric_cast<float>(index / state.range(1)), 0.0f);
+        }
+        AZStd::vector<AZ::Vector3> uvws(numPositions);
+        AZStd::vector<bool> wasPointRejected(numPositions);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            if (useBatch)
+            {
+                gradientTransform.TransformPositionsToUVW(positions, uvws, wasPointRejected);
+            }
+            else
+            {
+                for (size_t index = 0; index < numPositions; index++)
+                {
+                    bool rejected = false;
+                    gradientTransform.TransformPositionToUVW(positions[index], uvws[index], rejected);
+                    wasPointRejected[index] = rejected;
+                }
+            }
+            benchmark::DoNotOptimize(uvws.data());
+        }
+    }
+
+    BENCHMARK(BM_GradientTransformPositions)
+        ->Args({ 0, 1024 })
+        ->Args({ 1, 1024 })
+        ->ArgNames({ "Batched", "size" })
+        ->Unit(::benchmark::kMillisecond);
+
+    // --------------------------------------------------------------------------------------
+    // Perlin Noise
+
+    static void BM_PerlinImprovedNoise(benchmark::State& state)
+    {
+        constexpr int octaves = 4;
+        constexpr float persistence = 0.5f;
+        constexpr float frequency = 0.01f;
+
+        const size_t numPositions = aznumeric_cast<size_t>(state.range(1) * state.range(1));
+        const bool useBatch = (state.range(0) != 0);
+
+        GradientSignal::PerlinImprovedNoise perlinNoise(1234);
+
+        AZStd::vector<AZ::Vector3> positions(numPositions);
+        for (size_t index = 0; index < numPositions; index++)
+        {
+            positions[index] = AZ::Vector3(aznumeric_cast<float>(index % state.range(1)), aznumeric_cast<float>(index / state.range(1)), 0.0f);
+        }
+        AZStd::vector<float> results(numPositions);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            if (useBatch)
+            {
+                perlinNoise.GenerateOctaveNoise(positions, results, octaves, persistence, frequency);
+            }
+            else
+            {
+                for (size_t index = 0; index < numPositions; index++)
+                {
+                    results[index] = perlinNoise.GenerateOctaveNoise(
+                        positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), octaves, persistence, frequency);
+                }
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+
+    BENCHMARK(BM_PerlinImprovedNoise)
+        ->Args({ 0, 1024 })
+        ->Args({ 1, 1024 })
+        ->ArgNames({ "Batched", "size" })
+        ->Unit(::benchmark::kMillisecond);
+
 #endif
 }
 
@@ -10,6 +10,11 @@
 #include <Tests/GradientSignalTestFixtures.h>
 #include <Tests/GradientSignalTestHelpers.h>
 #include <AzTest/AzTest.h>
+#include <GradientSignal/Components/DitherGradientComponent.h>
+#include <GradientSignal/Components/PosterizeGradientComponent.h>
+#include <GradientSignal/Ebuses/DitherGradientRequestBus.h>
+#include <GradientSignal/Ebuses/GradientTransformModifierRequestBus.h>
+#include <GradientSignal/Ebuses/PosterizeGradientRequestBus.h>
 
 namespace UnitTest
 {
@@ -135,6 +140,130 @@ namespace UnitTest
         auto entity = BuildTestSurfaceSlopeGradient(TestShapeHalfBounds);
         GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), TestShapeHalfBounds);
     }
-}
 
+    // The following gradients process their values four at a time with SIMD in GetValues(), so compare them against their scalar
+    // GetValue() at positions that exercise every lane and the padded last block.
+
+    TEST_F(GradientSignalGetValuesTestsFixture, PerlinGradientComponent_VerifySimdAndScalarValuesMatch)
+    {
+        auto entity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = entity->GetId();
+        GradientSignalTestHelpers::CompareGetValueAndGetValuesAtUnalignedPositions(gradientSampler, TestShapeHalfBounds);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, PerlinGradientComponent_VerifyRejectedPointsMatchScalarValues)
+    {
+        auto entity = BuildTestPerlinGradient(TestShapeHalfBounds);
+
+        // Reject every point outside of the shape, so that GetValues() can skip the blocks of four points that are all rejected.
+        GradientSignal::GradientTransformModifierRequestBus::Event(
+            entity->GetId(), &GradientSignal::GradientTransformModifierRequestBus::Events::SetWrappingType,
+            GradientSignal::WrappingType::ClampToZero);
+
+        // Use a row of points that crosses the shape edge and then comes back, so that the blocks are fully accepted, partially
+        // rejected and fully rejected. The odd number of points leaves a padded block at the end.
+        AZStd::vector<AZ::Vector3> positions;
+        for (int index = 0; index < 301; index++)
+        {
+            const float offset = (index < 150) ? index * 0.25f : (300 - index) * 0.25f;
+            positions.emplace_back(TestShapeHalfBounds - 10.1f + offset, 3.3f, 0.0f);
+        }
+
+        AZStd::vector<float> values(positions.size());
+        GradientSignal::GradientRequestBus::Event(entity->GetId(), &GradientSignal::GradientRequestBus::Events::GetValues, positions, values);
+
+        size_t rejectedCount = 0;
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            float value = 0.0f;
+            GradientSignal::GradientRequestBus::EventResult(
+                value, entity->GetId(), &GradientSignal::GradientRequestBus::Events::GetValue,
+                GradientSignal::GradientSampleParams(positions[index]));
+            EXPECT_NEAR(values[index], value, 1.0e-6f);
+
+            if (positions[index].GetX() > TestShapeHalfBounds)
+            {
+                EXPECT_EQ(values[index], 0.0f);
+                ++rejectedCount;
+            }
+        }
+        EXPECT_GT(rejectedCount, 4);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, DitherGradientComponent_VerifySimdAndScalarValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestDitherGradient(TestShapeHalfBounds, baseEntity->GetId());
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = entity->GetId();
+        GradientSignalTestHelpers::CompareGetValueAndGetValuesAtUnalignedPositions(gradientSampler, TestShapeHalfBounds);
+
+        // Check the other pattern, with an offset and a pattern size that doesn't match the input sample grid.
+        GradientSignal::DitherGradientRequestBus::Event(
+            entity->GetId(), &GradientSignal::DitherGradientRequestBus::Events::SetPatternType,
+            static_cast<AZ::u8>(GradientSignal::DitherGradientConfig::BayerPatternType::PATTERN_SIZE_8x8));
+        GradientSignal::DitherGradientRequestBus::Event(
+            entity->GetId(), &GradientSignal::DitherGradientRequestBus::Events::SetPatternOffset, AZ::Vector3(3.0f, -5.0f, 0.0f));
+        GradientSignal::DitherGradientRequestBus::Event(
+            entity->GetId(), &GradientSignal::DitherGradientRequestBus::Events::SetPointsPerUnit, 1.7f);
+        GradientSignalTestHelpers::CompareGetValueAndGetValuesAtUnalignedPositions(gradientSampler, TestShapeHalfBounds);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, ValueModifierGradientComponents_VerifySimdAndScalarValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto mixedEntity = BuildTestConstantGradient(TestShapeHalfBounds);
 
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+        entities.push_back(BuildTestInvertGradient(TestShapeHalfBounds, baseEntity->GetId()));
+        entities.push_back(BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId()));
+        entities.push_back(BuildTestMixedGradient(TestShapeHalfBounds, baseEntity->GetId(), mixedEntity->GetId()));
+        entities.push_back(BuildTestSmoothStepGradient(TestShapeHalfBounds, baseEntity->GetId()));
+        entities.push_back(BuildTestThresholdGradient(TestShapeHalfBounds, baseEntity->GetId()));
+
+        for (const auto& entity : entities)
+        {
+            GradientSignal::GradientSampler gradientSampler;
+            gradientSampler.m_gradientId = entity->GetId();
+            GradientSignalTestHelpers::CompareGetValueAndGetValuesAtUnalignedPositions(gradientSampler, TestShapeHalfBounds);
+        }
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, PosterizeGradientComponent_VerifySimdAndScalarValuesMatchForAllModes)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestPosterizeGradient(TestShapeHalfBounds, baseEntity->GetId());
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = entity->GetId();
+
+        const GradientSignal::PosterizeGradientConfig::ModeType modes[] = {
+            GradientSignal::PosterizeGradientConfig::ModeType::Ceiling, GradientSignal::PosterizeGradientConfig::ModeType::Floor,
+            GradientSignal::PosterizeGradientConfig::ModeType::Round, GradientSignal::PosterizeGradientConfig::ModeType::Ps
+        };
+        for (auto mode : modes)
+        {
+            GradientSignal::PosterizeGradientRequestBus::Event(
+                entity->GetId(), &GradientSignal::PosterizeGradientRequestBus::Events::SetModeType, static_cast<AZ::u8>(mode));
+            GradientSignalTestHelpers::CompareGetValueAndGetValuesAtUnalignedPositions(gradientSampler, TestShapeHalfBounds);
+        }
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, GradientSampler_VerifySimdAndScalarPostProcessingMatch)
+    {
+        auto entity = BuildTestRandomGradient(TestShapeHalfBounds);
+
+        // Enable every post-processing step of the sampler: invert, levels with a midpoint and opacity.
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = entity->GetId();
+        gradientSampler.m_invertInput = true;
+        gradientSampler.m_enableLevels = true;
+        gradientSampler.m_inputMin = 0.1f;
+        gradientSampler.m_inputMid = 0.6f;
+        gradientSampler.m_inputMax = 0.8f;
+        gradientSampler.m_outputMin = 0.2f;
+        gradientSampler.m_outputMax = 0.9f;
+        gradientSampler.m_opacity = 0.75f;
+        GradientSignalTestHelpers::CompareGetValueAndGetValuesAtUnalignedPositions(gradientSampler, TestShapeHalfBounds);
+    }
+}
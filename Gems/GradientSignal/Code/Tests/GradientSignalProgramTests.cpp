@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#include <Tests/GradientSignalTestFixtures.h>
+#include <Tests/GradientSignalTestHelpers.h>
+#include <AzTest/AzTest.h>
+#include <GradientSignal/CompiledGradient.h>
+#include <GradientSignal/Components/ConstantGradientComponent.h>
+#include <GradientSignal/Components/ReferenceGradientComponent.h>
+#include <GradientSignal/Ebuses/ConstantGradientRequestBus.h>
+
+namespace UnitTest
+{
+    struct GradientSignalProgramTestsFixture
+        : public GradientSignalTest
+    {
+        // Create an arbitrary size shape for comparing values within. It needs to contain more points than a single program tile.
+        const float TestShapeHalfBounds = 64.0f;
+
+        AZStd::vector<AZ::Vector3> GetQueryPositions() const
+        {
+            AZStd::vector<AZ::Vector3> positions;
+            for (float y = -TestShapeHalfBounds; y < TestShapeHalfBounds; y += 1.0f)
+            {
+                for (float x = -TestShapeHalfBounds; x < TestShapeHalfBounds; x += 1.0f)
+                {
+                    positions.emplace_back(x, y, 0.0f);
+                }
+            }
+            return positions;
+        }
+
+        void CompareCompiledAndBusValues(const AZ::EntityId& gradientId)
+        {
+            const AZStd::vector<AZ::Vector3> positions = GetQueryPositions();
+            ASSERT_GT(positions.size(), GradientSignal::GradientProgram::TileSize);
+
+            AZStd::vector<float> busValues(positions.size());
+            GradientSignal::GradientRequestBus::Event(
+                gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, positions, busValues);
+
+            GradientSignal::CompiledGradient compiledGradient(gradientId);
+            ASSERT_NE(compiledGradient.GetProgram(), nullptr);
+
+            AZStd::vector<float> compiledValues(positions.size());
+            compiledGradient.GetValues(positions, compiledValues);
+
+            for (size_t index = 0; index < positions.size(); index++)
+            {
+                // We use ASSERT_NEAR instead of EXPECT_NEAR because if one value doesn't match, they probably all won't.
+                ASSERT_NEAR(busValues[index], compiledValues[index], 0.000001f);
+            }
+        }
+    };
+
+    TEST_F(GradientSignalProgramTestsFixture, InvertGradientComponent_VerifyCompiledValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestInvertGradient(TestShapeHalfBounds, baseEntity->GetId());
+        CompareCompiledAndBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalProgramTestsFixture, LevelsGradientComponent_VerifyCompiledValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+        CompareCompiledAndBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalProgramTestsFixture, MixedGradientComponent_VerifyCompiledValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto mixedEntity = BuildTestConstantGradient(TestShapeHalfBounds);
+        auto entity = BuildTestMixedGradient(TestShapeHalfBounds, baseEntity->GetId(), mixedEntity->GetId());
+        CompareCompiledAndBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalProgramTestsFixture, PosterizeGradientComponent_VerifyCompiledValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestPosterizeGradient(TestShapeHalfBounds, baseEntity->GetId());
+        CompareCompiledAndBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalProgramTestsFixture, ReferenceGradientComponent_VerifyCompiledValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestReferenceGradient(TestShapeHalfBounds, baseEntity->GetId());
+        CompareCompiledAndBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalProgramTestsFixture, SmoothStepGradientComponent_VerifyCompiledValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestSmoothStepGradient(TestShapeHalfBounds, baseEntity->GetId());
+        CompareCompiledAndBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalProgramTestsFixture, ThresholdGradientComponent_VerifyCompiledValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestThresholdGradient(TestShapeHalfBounds, baseEntity->GetId());
+        CompareCompiledAndBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalProgramTestsFixture, GradientChain_CompilesModifiersAndSamplesOtherGradients)
+    {
+        // Build a chain of modifiers on top of a random gradient. The modifiers get compiled into the program, while the random
+        // gradient gets sampled through the bus.
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto invertEntity = BuildTestInvertGradient(TestShapeHalfBounds, levelsEntity->GetId());
+        auto entity = BuildTestReferenceGradient(TestShapeHalfBounds, invertEntity->GetId());
+        CompareCompiledAndBusValues(entity->GetId());
+
+        auto program = GradientSignal::GradientProgramBuilder::Build(entity->GetId());
+        ASSERT_NE(program, nullptr);
+
+        const auto& dependencies = program->GetDependencies();
+        EXPECT_EQ(dependencies.size(), 3);
+        EXPECT_NE(AZStd::find(dependencies.begin(), dependencies.end(), entity->GetId()), dependencies.end());
+        EXPECT_NE(AZStd::find(dependencies.begin(), dependencies.end(), invertEntity->GetId()), dependencies.end());
+        EXPECT_NE(AZStd::find(dependencies.begin(), dependencies.end(), levelsEntity->GetId()), dependencies.end());
+
+        size_t numSampledGradients = 0;
+        for (size_t index = 0; index < program->GetNumInstructions(); index++)
+        {
+            const auto& instruction = program->GetInstruction(index);
+            if (instruction.m_opCode == GradientSignal::GradientProgram::OpCode::SampleGradient)
+            {
+                EXPECT_EQ(instruction.m_gradientId, baseEntity->GetId());
+                numSampledGradients++;
+            }
+        }
+        EXPECT_EQ(numSampledGradients, 1);
+    }
+
+    TEST_F(GradientSignalProgramTestsFixture, CompositionChange_InvalidatesOnlyAffectedPrograms)
+    {
+        auto entity = BuildTestConstantGradient(TestShapeHalfBounds);
+        auto otherEntity = BuildTestConstantGradient(TestShapeHalfBounds);
+
+        GradientSignal::CompiledGradient compiledGradient(entity->GetId());
+        GradientSignal::CompiledGradient otherCompiledGradient(otherEntity->GetId());
+        auto program = compiledGradient.GetProgram();
+        auto otherProgram = otherCompiledGradient.GetProgram();
+        ASSERT_NE(program, nullptr);
+        ASSERT_NE(otherProgram, nullptr);
+
+        // Querying again without any changes reuses the compiled programs.
+        EXPECT_EQ(compiledGradient.GetProgram(), program);
+
+        // Changing the constant value sends OnCompositionChanged, which only invalidates the program of that gradient.
+        GradientSignal::ConstantGradientRequestBus::Event(
+            entity->GetId(), &GradientSignal::ConstantGradientRequestBus::Events::SetConstantValue, 0.25f);
+        EXPECT_NE(compiledGradient.GetProgram(), program);
+        EXPECT_EQ(otherCompiledGradient.GetProgram(), otherProgram);
+
+        const AZStd::vector<AZ::Vector3> positions = GetQueryPositions();
+        AZStd::vector<float> values(positions.size());
+        compiledGradient.GetValues(positions, values);
+        for (float value : values)
+        {
+            ASSERT_EQ(value, 0.25f);
+        }
+    }
+
+    TEST_F(GradientSignalProgramTestsFixture, InvalidAndInactiveGradients_AreCachedUntilInvalidated)
+    {
+        // Invalid ids never compile, and their queries leave the values untouched.
+        GradientSignal::CompiledGradient invalidCompiledGradient{ AZ::EntityId() };
+        EXPECT_EQ(invalidCompiledGradient.GetProgram(), nullptr);
+
+        const AZStd::vector<AZ::Vector3> positions = GetQueryPositions();
+        AZStd::vector<float> values(positions.size(), 1.0f);
+        invalidCompiledGradient.GetValues(positions, values);
+        for (float value : values)
+        {
+            ASSERT_EQ(value, 1.0f);
+        }
+
+        // A gradient that isn't active yet compiles into a program that samples it through the bus. Activating the gradient
+        // doesn't invalidate it.
+        auto entity = CreateTestEntity(TestShapeHalfBounds);
+        GradientSignal::ConstantGradientConfig config;
+        config.m_value = 0.75f;
+        entity->CreateComponent<GradientSignal::ConstantGradientComponent>(config);
+
+        GradientSignal::CompiledGradient compiledGradient(entity->GetId());
+        auto inactiveProgram = compiledGradient.GetProgram();
+        ASSERT_NE(inactiveProgram, nullptr);
+        EXPECT_TRUE(inactiveProgram->GetDependencies().empty());
+
+        ActivateEntity(entity.get());
+        EXPECT_EQ(compiledGradient.GetProgram(), inactiveProgram);
+
+        // The owner invalidates it once the gradient is active, and the next query compiles the gradient itself.
+        compiledGradient.Invalidate();
+        auto program = compiledGradient.GetProgram();
+        ASSERT_NE(program, nullptr);
+        EXPECT_NE(program, inactiveProgram);
+        EXPECT_FALSE(program->GetDependencies().empty());
+    }
+
+    TEST_F(GradientSignalProgramTestsFixture, CyclicReferences_FallBackToBus)
+    {
+        // Create two reference gradients that reference each other. They can't be compiled, and the queries go through the bus,
+        // which detects the cycle and returns 0.
+        auto entity = CreateTestEntity(TestShapeHalfBounds);
+        auto otherEntity = CreateTestEntity(TestShapeHalfBounds);
+
+        GradientSignal::ReferenceGradientConfig config;
+        config.m_gradientSampler.m_gradientId = otherEntity->GetId();
+        entity->CreateComponent<GradientSignal::ReferenceGradientComponent>(config);
+        config.m_gradientSampler.m_gradientId = entity->GetId();
+        otherEntity->CreateComponent<GradientSignal::ReferenceGradientComponent>(config);
+        ActivateEntity(entity.get());
+        ActivateEntity(otherEntity.get());
+
+        EXPECT_EQ(GradientSignal::GradientProgramBuilder::Build(entity->GetId()), nullptr);
+
+        GradientSignal::CompiledGradient compiledGradient(entity->GetId());
+        const AZStd::vector<AZ::Vector3> positions = GetQueryPositions();
+        AZStd::vector<float> values(positions.size(), 1.0f);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        compiledGradient.GetValues(positions, values);
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+
+        for (float value : values)
+        {
+            ASSERT_EQ(value, 0.0f);
+        }
+    }
+}
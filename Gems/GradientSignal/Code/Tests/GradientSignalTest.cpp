@@ -171,6 +171,42 @@ namespace UnitTest
         TestFixedDataSampler(expectedOutput, dataSize, entity->GetId());
     }
 
+    TEST_F(GradientSignalTestGeneratorFixture, PerlinImprovedNoise_BatchMatchesSingleValues)
+    {
+        // Make sure the SIMD batch version of GenerateOctaveNoise produces the same values as the single position version.
+        // An odd number of positions is used so that the padded values at the end of the batch are verified too, and the
+        // positions cross zero so that negative coordinates are verified as well.
+
+        constexpr int octaves = 4;
+        constexpr float persistence = 0.6f;
+        constexpr float frequency = 0.37f;
+
+        GradientSignal::PerlinImprovedNoise perlinNoise(7878);
+
+        AZStd::vector<AZ::Vector3> positions;
+        for (int yIndex = 0; yIndex < 27; yIndex++)
+        {
+            for (int xIndex = 0; xIndex < 38; xIndex++)
+            {
+                const float x = -10.5f + xIndex * 0.55f;
+                const float y = -10.25f + yIndex * 0.75f;
+                positions.emplace_back(x, y, x * 0.5f - y);
+            }
+        }
+        positions.emplace_back(1000.3f, -2000.7f, 0.0f);
+        ASSERT_TRUE((positions.size() % 4) != 0);
+
+        AZStd::vector<float> batchValues(positions.size());
+        perlinNoise.GenerateOctaveNoise(positions, batchValues, octaves, persistence, frequency);
+
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            const float value = perlinNoise.GenerateOctaveNoise(
+                positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), octaves, persistence, frequency);
+            EXPECT_NEAR(batchValues[index], value, 1.0e-6f);
+        }
+    }
+
     TEST_F(GradientSignalTestGeneratorFixture, RandomGradientComponent_GoldenTest)
     {
         // Make sure RandomGradientComponent returns back a "golden" set
@@ -56,6 +56,30 @@ namespace UnitTest
         }
     }
 
+    void GradientSignalTestHelpers::CompareGetValueAndGetValuesAtUnalignedPositions(
+        const GradientSignal::GradientSampler& gradientSampler, float shapeHalfBounds)
+    {
+        // Spread the positions through the whole shape, with fractional coordinates and negative values.
+        constexpr size_t NumPositions = 1001;
+        AZStd::vector<AZ::Vector3> positions(NumPositions);
+        for (size_t index = 0; index < NumPositions; index++)
+        {
+            const float x = AZ::Mod(index * 7.31f, 2.0f * shapeHalfBounds) - shapeHalfBounds;
+            const float y = AZ::Mod(index * 3.17f, 2.0f * shapeHalfBounds) - shapeHalfBounds;
+            positions[index] = AZ::Vector3(x, y, 0.0f);
+        }
+
+        AZStd::vector<float> results(NumPositions);
+        gradientSampler.GetValues(positions, results);
+
+        for (size_t positionIndex = 0; positionIndex < positions.size(); positionIndex++)
+        {
+            GradientSignal::GradientSampleParams params;
+            params.m_position = positions[positionIndex];
+            ASSERT_NEAR(gradientSampler.GetValue(params), results[positionIndex], 0.000001f);
+        }
+    }
+
 #ifdef HAVE_BENCHMARK
 
     void GradientSignalTestHelpers::FillQueryPositions(AZStd::vector<AZ::Vector3>& positions, float height, float width)
@@ -11,6 +11,7 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzTest/AzTest.h>
+#include <GradientSignal/GradientSampler.h>
 
 namespace UnitTest
 {
@@ -19,6 +20,12 @@ namespace UnitTest
     public:
         static void CompareGetValueAndGetValues(AZ::EntityId gradientEntityId, float shapeHalfBounds);
 
+        // Compares the values of GetValue() and GetValues() at positions which aren't aligned to the sample grid of the gradients,
+        // in a count which isn't a multiple of four. The gradients which process GetValues() four values at a time with SIMD are
+        // then compared against their scalar GetValue() path, including the padded last block.
+        static void CompareGetValueAndGetValuesAtUnalignedPositions(
+            const GradientSignal::GradientSampler& gradientSampler, float shapeHalfBounds);
+
 #ifdef HAVE_BENCHMARK
         // We use an enum to list out the different types of GetValue() benchmarks to run so that way we can condense our test cases
         // to just take the value in as a benchmark argument and switch on it. Otherwise, we would need to write a different benchmark
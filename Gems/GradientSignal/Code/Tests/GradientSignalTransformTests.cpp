@@ -60,6 +60,47 @@ namespace UnitTest
             gradientTransform2d.TransformPositionToUVW(test.m_positionToTest, outUVW, wasPointRejected);
             EXPECT_THAT(outUVW, IsClose(AZ::Vector3(test.m_expectedOutputUVW.GetX(), test.m_expectedOutputUVW.GetY(), 0.0f)));
             EXPECT_EQ(wasPointRejected, test.m_expectedOutputRejectionResult);
+
+            // Perform the query through the batched version and verify that the results match as well.
+            AZ::Vector3 outUVWs[1];
+            bool wasPointsRejected[1];
+            gradientTransform3d.TransformPositionsToUVW(
+                AZStd::span<const AZ::Vector3>(&test.m_positionToTest, 1), outUVWs, wasPointsRejected);
+            EXPECT_THAT(outUVWs[0], IsClose(test.m_expectedOutputUVW));
+            EXPECT_EQ(wasPointsRejected[0], test.m_expectedOutputRejectionResult);
+        }
+
+        // Verifies that the batched transforms, which transform four positions at a time with SIMD, match the per-position ones.
+        void CompareBatchedAndSingleTransforms(const GradientSignal::GradientTransform& gradientTransform)
+        {
+            // Use a position count that isn't a multiple of four so that the padded last block is tested too.
+            constexpr size_t NumPositions = 1003;
+            AZStd::vector<AZ::Vector3> positions(NumPositions);
+            for (size_t index = 0; index < NumPositions; index++)
+            {
+                positions[index] = AZ::Vector3(
+                    60.0f + (index * 0.137f), 170.0f + ((index % 37) * 1.71f), 250.0f + ((index % 11) * 9.3f));
+            }
+
+            AZStd::vector<AZ::Vector3> outUVWs(NumPositions);
+            AZStd::vector<AZ::Vector3> outNormalizedUVWs(NumPositions);
+            bool wasPointRejected[NumPositions];
+            bool wasNormalizedPointRejected[NumPositions];
+            gradientTransform.TransformPositionsToUVW(positions, outUVWs, wasPointRejected);
+            gradientTransform.TransformPositionsToUVWNormalized(positions, outNormalizedUVWs, wasNormalizedPointRejected);
+
+            for (size_t index = 0; index < NumPositions; index++)
+            {
+                AZ::Vector3 outUVW;
+                bool wasRejected = false;
+                gradientTransform.TransformPositionToUVW(positions[index], outUVW, wasRejected);
+                ASSERT_THAT(outUVWs[index], IsClose(outUVW));
+                ASSERT_EQ(wasPointRejected[index], wasRejected);
+
+                gradientTransform.TransformPositionToUVWNormalized(positions[index], outUVW, wasRejected);
+                ASSERT_THAT(outNormalizedUVWs[index], IsClose(outUVW));
+                ASSERT_EQ(wasNormalizedPointRejected[index], wasRejected);
+            }
         }
     };
 
@@ -279,6 +320,26 @@ namespace UnitTest
             TestGradientTransform(setup, test);
         }
     }
-}
 
+    TEST_F(GradientSignalTransformTestsFixture, BatchedTransformsMatchSingleTransforms)
+    {
+        // Use a transform with rotation and scale, so that every component of the positions contributes to every output.
+        AZ::Matrix3x4 transform = AZ::Matrix3x4::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateFromEulerAnglesDegrees(AZ::Vector3(5.0f, 10.0f, 30.0f)), AZ::Vector3(100.0f, 200.0f, 300.0f));
+        transform.MultiplyByScale(AZ::Vector3(2.0f));
+        const AZ::Aabb shapeBounds = AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(5.0f, 10.0f, 20.0f));
+
+        const GradientSignal::WrappingType wrappingTypes[] = {
+            GradientSignal::WrappingType::None, GradientSignal::WrappingType::ClampToEdge, GradientSignal::WrappingType::Mirror,
+            GradientSignal::WrappingType::Repeat, GradientSignal::WrappingType::ClampToZero
+        };
 
+        for (auto wrappingType : wrappingTypes)
+        {
+            for (bool use3d : { false, true })
+            {
+                CompareBatchedAndSingleTransforms(GradientSignal::GradientTransform(shapeBounds, transform, use3d, 1.5f, wrappingType));
+            }
+        }
+    }
+}
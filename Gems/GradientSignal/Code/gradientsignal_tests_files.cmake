@@ -10,6 +10,7 @@ set(FILES
     Tests/GradientSignalBenchmarks.cpp
     Tests/GradientSignalGetValuesTests.cpp
     Tests/GradientSignalImageTests.cpp
+    Tests/GradientSignalProgramTests.cpp
     Tests/GradientSignalReferencesTests.cpp
     Tests/GradientSignalServicesTests.cpp
     Tests/GradientSignalSurfaceTests.cpp
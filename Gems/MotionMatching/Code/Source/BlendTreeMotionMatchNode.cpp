@@ -16,6 +16,7 @@
 #include <EMotionFX/Source/Motion.h>
 #include <BlendTreeMotionMatchNode.h>
 #include <FeatureSchemaDefault.h>
+#include <FlatKdTree.h>
 #include <EMotionFX/Source/MotionSet.h>
 #include <EMotionFX/Source/Node.h>
 #include <EMotionFX/Source/Recorder.h>
@@ -125,6 +126,7 @@ namespace EMotionFX::MotionMatching
         settings.m_importMirrored = animGraphNode->m_mirror;
         settings.m_maxKdTreeDepth = animGraphNode->m_maxKdTreeDepth;
         settings.m_minFramesPerKdTreeNode = animGraphNode->m_minFramesPerKdTreeNode;
+        settings.m_useFlatKdTree = animGraphNode->m_useFlatKdTree;
         settings.m_motionList.reserve(animGraphNode->m_motionIds.size());
         for (const AZStd::string& id : animGraphNode->m_motionIds)
         {
@@ -280,6 +282,7 @@ namespace EMotionFX::MotionMatching
 
         MotionMatching::MotionMatchingInstance* instance = uniqueData->m_instance;
         instance->SetLowestCostSearchFrequency(m_lowestCostSearchFrequency);
+        instance->SetMaxNearestNeighbors(m_maxNearestNeighbors);
 
         Pose& outTransformPose = outputPose->GetPose();
         instance->Output(outTransformPose);
@@ -307,11 +310,13 @@ namespace EMotionFX::MotionMatching
         }
 
         serializeContext->Class<BlendTreeMotionMatchNode, AnimGraphNode>()
-            ->Version(9)
+            ->Version(10)
             ->Field("sampleRate", &BlendTreeMotionMatchNode::m_sampleRate)
             ->Field("lowestCostSearchFrequency", &BlendTreeMotionMatchNode::m_lowestCostSearchFrequency)
             ->Field("maxKdTreeDepth", &BlendTreeMotionMatchNode::m_maxKdTreeDepth)
             ->Field("minFramesPerKdTreeNode", &BlendTreeMotionMatchNode::m_minFramesPerKdTreeNode)
+            ->Field("useFlatKdTree", &BlendTreeMotionMatchNode::m_useFlatKdTree)
+            ->Field("maxNearestNeighbors", &BlendTreeMotionMatchNode::m_maxNearestNeighbors)
             ->Field("mirror", &BlendTreeMotionMatchNode::m_mirror)
             ->Field("controlSplineMode", &BlendTreeMotionMatchNode::m_trajectoryQueryMode)
             ->Field("pathRadius", &BlendTreeMotionMatchNode::m_pathRadius)
@@ -346,6 +351,11 @@ namespace EMotionFX::MotionMatching
             ->Attribute(AZ::Edit::Attributes::Min, 1)
             ->Attribute(AZ::Edit::Attributes::Max, 100000)
             ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+            ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_useFlatKdTree, "Use nearest neighbor search", "Search the nearest frames using the flat kdTree, rather than searching all frames in a kdTree node. Only the nearest frames are compared in the final cost calculation, which is much faster for large motion databases.")
+            ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+            ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_maxNearestNeighbors, "Nearest neighbors", "The number of nearest frames to compare in the final cost calculation, when using the nearest neighbor search.")
+            ->Attribute(AZ::Edit::Attributes::Min, 1)
+            ->Attribute(AZ::Edit::Attributes::Max, static_cast<AZ::u32>(FlatKdTree::MaxNeighbors))
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_pathRadius, "Path radius", "")
             ->Attribute(AZ::Edit::Attributes::Min, 0.0001f)
             ->Attribute(AZ::Edit::Attributes::Max, std::numeric_limits<float>::max())
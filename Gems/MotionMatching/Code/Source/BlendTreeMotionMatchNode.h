@@ -96,8 +96,10 @@ namespace EMotionFX::MotionMatching
         AZ::u32 m_sampleRate = 30;
         AZ::u32 m_maxKdTreeDepth = 15;
         AZ::u32 m_minFramesPerKdTreeNode = 1000;
+        AZ::u32 m_maxNearestNeighbors = 64;
         TrajectoryQuery::EMode m_trajectoryQueryMode = TrajectoryQuery::MODE_TARGETDRIVEN;
         bool m_mirror = false;
+        bool m_useFlatKdTree = false;
 
         AZ::Debug::Timer m_timer;
         float m_updateTimeInMs = 0.0f;
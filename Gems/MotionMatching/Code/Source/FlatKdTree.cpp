@@ -0,0 +1,401 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <FlatKdTree.h>
+#include <Feature.h>
+#include <Allocators.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/sort.h>
+
+#include <numeric>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(FlatKdTree, MotionMatchAllocator, 0)
+
+    namespace FlatKdTreeInternal
+    {
+        // The search keeps the far sides of the visited nodes on a fixed size stack, which limits the depth of the tree.
+        static constexpr size_t MaxDepth = 32;
+    }
+
+    bool FlatKdTree::Init(const FeatureMatrix& featureMatrix,
+        const AZStd::vector<Feature*>& features,
+        size_t maxDepth,
+        size_t maxFramesPerLeaf)
+    {
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+
+        Clear();
+
+        size_t numDimensions = 0;
+        for (const Feature* feature : features)
+        {
+            numDimensions += feature->GetNumDimensions();
+        }
+
+        if (numDimensions == 0)
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize flat KD-tree. There are no feature values to search.");
+            return false;
+        }
+
+        if (maxDepth == 0 || maxDepth > FlatKdTreeInternal::MaxDepth)
+        {
+            AZ_Error("Motion Matching", false, "Flat KD-tree max depth (%zu) has to be between 1 and %zu.", maxDepth, FlatKdTreeInternal::MaxDepth);
+            return false;
+        }
+
+        if (maxFramesPerLeaf == 0)
+        {
+            AZ_Error("Motion Matching", false, "Flat KD-tree maxFramesPerLeaf cannot be zero.");
+            return false;
+        }
+
+        const size_t numFrames = static_cast<size_t>(featureMatrix.rows());
+        if (numFrames == 0)
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize flat KD-tree. The feature matrix is empty.");
+            return false;
+        }
+
+        m_numDimensions = numDimensions;
+        m_maxDepth = maxDepth;
+        m_maxFramesPerLeaf = maxFramesPerLeaf;
+
+        // Gather the values of the features in the tree, so that the tree is built from contiguous rows.
+        AZStd::vector<float> frameValues(numFrames * m_numDimensions);
+        for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            float* values = &frameValues[frameIndex * m_numDimensions];
+            for (const Feature* feature : features)
+            {
+                const size_t featureNumDimensions = feature->GetNumDimensions();
+                const FeatureMatrix::Index featureColumnOffset = feature->GetColumnOffset();
+                for (size_t i = 0; i < featureNumDimensions; ++i)
+                {
+                    *values++ = featureMatrix(frameIndex, featureColumnOffset + i);
+                }
+            }
+        }
+
+        AZStd::vector<size_t> frames(numFrames);
+        std::iota(frames.begin(), frames.end(), size_t{ 0 });
+
+        const size_t expectedNumLeafs = (numFrames + m_maxFramesPerLeaf - 1) / m_maxFramesPerLeaf;
+        m_nodes.reserve(expectedNumLeafs * 2);
+        m_blockFrameIndices.reserve(numFrames + expectedNumLeafs * BlockSize);
+        m_blockValues.reserve((numFrames + expectedNumLeafs * BlockSize) * m_numDimensions);
+        BuildNode(frameValues, frames.data(), numFrames, 0);
+
+        const float initTime = timer.GetDeltaTimeInSeconds();
+        AZ_TracePrintf("EMotionFX", "Flat KdTree initialized in %f seconds (numNodes = %zu  numLeafs = %zu  numDims = %zu  Memory used = %.2f MB).",
+            initTime,
+            m_nodes.size(),
+            m_numLeafs,
+            m_numDimensions,
+            static_cast<float>(CalcMemoryUsageInBytes()) / 1024.0f / 1024.0f);
+
+        return true;
+    }
+
+    void FlatKdTree::Clear()
+    {
+        m_nodes.clear();
+        m_blockValues.clear();
+        m_blockFrameIndices.clear();
+        m_numDimensions = 0;
+        m_numLeafs = 0;
+    }
+
+    size_t FlatKdTree::CalcMemoryUsageInBytes() const
+    {
+        size_t totalBytes = 0;
+        totalBytes += m_nodes.capacity() * sizeof(Node);
+        totalBytes += m_blockValues.capacity() * sizeof(float);
+        totalBytes += m_blockFrameIndices.capacity() * sizeof(size_t);
+        totalBytes += sizeof(FlatKdTree);
+        return totalBytes;
+    }
+
+    bool FlatKdTree::IsInitialized() const
+    {
+        return (m_numDimensions != 0);
+    }
+
+    size_t FlatKdTree::GetNumNodes() const
+    {
+        return m_nodes.size();
+    }
+
+    size_t FlatKdTree::GetNumLeafs() const
+    {
+        return m_numLeafs;
+    }
+
+    size_t FlatKdTree::GetNumDimensions() const
+    {
+        return m_numDimensions;
+    }
+
+    size_t FlatKdTree::BuildNode(const AZStd::vector<float>& frameValues, size_t* frames, size_t numFrames, size_t depth)
+    {
+        const size_t nodeIndex = m_nodes.size();
+        m_nodes.emplace_back();
+
+        // Split along the dimension in which the frames are spread the most.
+        size_t splitDimension = 0;
+        float maxSpread = 0.0f;
+        if (numFrames > m_maxFramesPerLeaf && depth < m_maxDepth)
+        {
+            for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+            {
+                float minValue = AZStd::numeric_limits<float>::max();
+                float maxValue = -AZStd::numeric_limits<float>::max();
+                for (size_t i = 0; i < numFrames; ++i)
+                {
+                    const float value = frameValues[frames[i] * m_numDimensions + dimension];
+                    minValue = AZ::GetMin(minValue, value);
+                    maxValue = AZ::GetMax(maxValue, value);
+                }
+
+                if (maxValue - minValue > maxSpread)
+                {
+                    maxSpread = maxValue - minValue;
+                    splitDimension = dimension;
+                }
+            }
+        }
+
+        // Split at the median, unless the node is small enough or all frames have the same values.
+        if (maxSpread > 0.0f)
+        {
+            const size_t numLeftFrames = numFrames / 2;
+            const auto valueLess = [&frameValues, stride = m_numDimensions, splitDimension](size_t frameA, size_t frameB)
+            {
+                return frameValues[frameA * stride + splitDimension] < frameValues[frameB * stride + splitDimension];
+            };
+            std::nth_element(frames, frames + numLeftFrames, frames + numFrames, valueLess);
+            const float splitValue = frameValues[frames[numLeftFrames] * m_numDimensions + splitDimension];
+
+            BuildNode(frameValues, frames, numLeftFrames, depth + 1);
+            const size_t rightNode = BuildNode(frameValues, frames + numLeftFrames, numFrames - numLeftFrames, depth + 1);
+
+            Node& node = m_nodes[nodeIndex];
+            node.m_splitValue = splitValue;
+            node.m_dimension = static_cast<AZ::u32>(splitDimension);
+            node.m_rightNode = static_cast<AZ::u32>(rightNode);
+            return nodeIndex;
+        }
+
+        // Copy the values of the leaf frames into blocks of four frames, padding the last block.
+        const size_t firstBlock = m_blockFrameIndices.size() / BlockSize;
+        const size_t numBlocks = (numFrames + BlockSize - 1) / BlockSize;
+        m_blockFrameIndices.resize(m_blockFrameIndices.size() + numBlocks * BlockSize, InvalidIndex);
+        m_blockValues.resize(m_blockValues.size() + numBlocks * BlockSize * m_numDimensions, 0.0f);
+        for (size_t i = 0; i < numFrames; ++i)
+        {
+            const size_t block = firstBlock + i / BlockSize;
+            const size_t lane = i % BlockSize;
+            m_blockFrameIndices[block * BlockSize + lane] = frames[i];
+
+            float* blockValues = &m_blockValues[block * BlockSize * m_numDimensions];
+            const float* values = &frameValues[frames[i] * m_numDimensions];
+            for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+            {
+                blockValues[dimension * BlockSize + lane] = values[dimension];
+            }
+        }
+
+        Node& leaf = m_nodes[nodeIndex];
+        leaf.m_firstBlock = static_cast<AZ::u32>(firstBlock);
+        leaf.m_numBlocks = static_cast<AZ::u32>(numBlocks);
+        m_numLeafs++;
+        return nodeIndex;
+    }
+
+    size_t FlatKdTree::FindLeaf(const float* queryValues) const
+    {
+        size_t nodeIndex = 0;
+        while (m_nodes[nodeIndex].m_rightNode != InvalidNode)
+        {
+            const Node& node = m_nodes[nodeIndex];
+            nodeIndex = (queryValues[node.m_dimension] < node.m_splitValue) ? nodeIndex + 1 : node.m_rightNode;
+        }
+        return nodeIndex;
+    }
+
+    void FlatKdTree::SearchLeaf(const Node& leaf, const float* queryValues, size_t maxNeighbors, Neighbor* neighbors, size_t& numNeighbors) const
+    {
+        using AZ::Simd::Vec4;
+
+        const size_t blockStride = BlockSize * m_numDimensions;
+        const float* blockValues = &m_blockValues[leaf.m_firstBlock * blockStride];
+        const size_t* blockFrameIndices = &m_blockFrameIndices[leaf.m_firstBlock * BlockSize];
+        for (size_t block = 0; block < leaf.m_numBlocks; ++block, blockValues += blockStride, blockFrameIndices += BlockSize)
+        {
+            // Calculate the squared distances to the four frames in the block at once.
+            Vec4::FloatType distances = Vec4::ZeroFloat();
+            for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+            {
+                const Vec4::FloatType delta = Vec4::Sub(Vec4::LoadUnaligned(blockValues + dimension * BlockSize), Vec4::Splat(queryValues[dimension]));
+                distances = Vec4::Madd(delta, delta, distances);
+            }
+
+            // Skip the whole block when none of the frames is closer than the ones found already.
+            if (numNeighbors == maxNeighbors && Vec4::CmpAllGtEq(distances, Vec4::Splat(neighbors[numNeighbors - 1].m_distance)))
+            {
+                continue;
+            }
+
+            float blockDistances[BlockSize];
+            Vec4::StoreUnaligned(blockDistances, distances);
+            for (size_t lane = 0; lane < BlockSize; ++lane)
+            {
+                const size_t frameIndex = blockFrameIndices[lane];
+                const float distance = blockDistances[lane];
+                if (frameIndex == InvalidIndex || (numNeighbors == maxNeighbors && distance >= neighbors[numNeighbors - 1].m_distance))
+                {
+                    continue;
+                }
+
+                // Insert the frame, keeping the neighbors sorted on distance.
+                size_t insertIndex = AZ::GetMin(numNeighbors, maxNeighbors - 1);
+                while (insertIndex > 0 && neighbors[insertIndex - 1].m_distance > distance)
+                {
+                    neighbors[insertIndex] = neighbors[insertIndex - 1];
+                    --insertIndex;
+                }
+                neighbors[insertIndex] = { distance, frameIndex };
+                numNeighbors = AZ::GetMin(numNeighbors + 1, maxNeighbors);
+            }
+        }
+    }
+
+    size_t FlatKdTree::FindNearestNeighbors(const float* queryValues, size_t maxNeighbors, size_t maxLeafVisits, Neighbor* outNeighbors) const
+    {
+        AZ_Assert(IsInitialized(), "Expecting an initialized flat kdTree. Did you forget to call FlatKdTree::Init()?");
+        AZ_Assert(maxNeighbors > 0 && maxNeighbors <= MaxNeighbors, "The number of nearest neighbors has to be between 1 and %zu.", MaxNeighbors);
+
+        // The far sides of the visited nodes, together with their distance to the split plane, which is the minimum distance to any of their frames.
+        struct PendingNode
+        {
+            float m_distance;
+            size_t m_nodeIndex;
+        };
+        AZStd::fixed_vector<PendingNode, FlatKdTreeInternal::MaxDepth> pendingNodes;
+
+        size_t numNeighbors = 0;
+        size_t numLeafVisits = 0;
+        size_t nodeIndex = 0;
+        for (;;)
+        {
+            // Step down to the leaf on the side of the query.
+            while (m_nodes[nodeIndex].m_rightNode != InvalidNode)
+            {
+                const Node& node = m_nodes[nodeIndex];
+                const float delta = queryValues[node.m_dimension] - node.m_splitValue;
+                if (delta < 0.0f)
+                {
+                    pendingNodes.push_back({ delta * delta, node.m_rightNode });
+                    nodeIndex = nodeIndex + 1;
+                }
+                else
+                {
+                    pendingNodes.push_back({ delta * delta, nodeIndex + 1 });
+                    nodeIndex = node.m_rightNode;
+                }
+            }
+
+            SearchLeaf(m_nodes[nodeIndex], queryValues, maxNeighbors, outNeighbors, numNeighbors);
+            if (++numLeafVisits >= maxLeafVisits)
+            {
+                break;
+            }
+
+            // Backtrack depth first: the pending nodes are a stack, so the far side of the deepest visited node comes first,
+            // which is not necessarily the closest one. This keeps the stack within the depth of the tree. Far sides which
+            // can't contain closer frames than the ones found so far are skipped.
+            bool foundNode = false;
+            while (!pendingNodes.empty())
+            {
+                const PendingNode pendingNode = pendingNodes.back();
+                pendingNodes.pop_back();
+                if (numNeighbors < maxNeighbors || pendingNode.m_distance < outNeighbors[numNeighbors - 1].m_distance)
+                {
+                    nodeIndex = pendingNode.m_nodeIndex;
+                    foundNode = true;
+                    break;
+                }
+            }
+
+            if (!foundNode)
+            {
+                break;
+            }
+        }
+
+        return numNeighbors;
+    }
+
+    void FlatKdTree::FindNearestNeighbors(const AZStd::vector<float>& queryValues,
+        size_t maxNeighbors,
+        AZStd::vector<size_t>& resultFrameIndices,
+        size_t maxLeafVisits) const
+    {
+        AZ_PROFILE_SCOPE(Animation, "FlatKdTree::FindNearestNeighbors");
+        AZ_Assert(queryValues.size() == m_numDimensions, "Expected %zu query values, got %zu.", m_numDimensions, queryValues.size());
+
+        Neighbor neighbors[MaxNeighbors];
+        const size_t numNeighbors = FindNearestNeighbors(queryValues.data(), maxNeighbors, maxLeafVisits, neighbors);
+
+        resultFrameIndices.resize(numNeighbors);
+        for (size_t i = 0; i < numNeighbors; ++i)
+        {
+            resultFrameIndices[i] = neighbors[i].m_frameIndex;
+        }
+    }
+
+    void FlatKdTree::FindNearestNeighborsBatch(const AZStd::vector<float>& queryValues,
+        size_t maxNeighbors,
+        AZStd::vector<size_t>& resultFrameIndices,
+        size_t maxLeafVisits) const
+    {
+        AZ_PROFILE_SCOPE(Animation, "FlatKdTree::FindNearestNeighborsBatch");
+        AZ_Assert(queryValues.size() % m_numDimensions == 0, "Expected %zu query values per query.", m_numDimensions);
+
+        const size_t numQueries = queryValues.size() / m_numDimensions;
+        resultFrameIndices.assign(numQueries * maxNeighbors, InvalidIndex);
+
+        // Order the queries on the leaf they start in.
+        AZStd::vector<AZStd::pair<size_t, size_t>> leafAndQueryIndices(numQueries);
+        for (size_t queryIndex = 0; queryIndex < numQueries; ++queryIndex)
+        {
+            leafAndQueryIndices[queryIndex] = { FindLeaf(&queryValues[queryIndex * m_numDimensions]), queryIndex };
+        }
+        AZStd::sort(leafAndQueryIndices.begin(), leafAndQueryIndices.end());
+
+        Neighbor neighbors[MaxNeighbors];
+        for (const auto& [leafIndex, queryIndex] : leafAndQueryIndices)
+        {
+            const size_t numNeighbors = FindNearestNeighbors(&queryValues[queryIndex * m_numDimensions], maxNeighbors, maxLeafVisits, neighbors);
+
+            size_t* results = &resultFrameIndices[queryIndex * maxNeighbors];
+            for (size_t i = 0; i < numNeighbors; ++i)
+            {
+                results[i] = neighbors[i].m_frameIndex;
+            }
+        }
+    }
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+#include <Feature.h>
+#include <FeatureMatrix.h>
+
+namespace EMotionFX::MotionMatching
+{
+    /**
+     * Approximate nearest neighbor search structure for the broad-phase of the motion matching search.
+     * Unlike the KdTree, which returns all frames inside the leaf the query ends up in, this returns the given number of
+     * frames closest to the query values, so that the narrow-phase only has to calculate the costs for a few frames.
+     *
+     * The nodes are stored in a single array in depth-first order, where the left child directly follows its parent,
+     * so that the search doesn't follow pointers or recurse. The feature values of the frames are copied out of the
+     * feature matrix in leaf order, interleaved in blocks of four frames per dimension, so that the distances to four
+     * frames are calculated at once using SIMD. The search visits the leaf of the query first and continues with the
+     * closest other leaves until the maximum number of leaf visits is reached, which makes it approximate.
+     */
+    class EMFX_API FlatKdTree
+    {
+    public:
+        AZ_RTTI(FlatKdTree, "{5C0B6B8E-3E1A-4A5C-8E7B-2F4C1D9A6E31}")
+        AZ_CLASS_ALLOCATOR_DECL
+
+        //! The maximum number of nearest neighbors a single query can return.
+        static constexpr size_t MaxNeighbors = 256;
+
+        FlatKdTree() = default;
+        virtual ~FlatKdTree() = default;
+
+        bool Init(const FeatureMatrix& featureMatrix,
+            const AZStd::vector<Feature*>& features,
+            size_t maxDepth=20,
+            size_t maxFramesPerLeaf=256);
+
+        void Clear();
+
+        size_t GetNumNodes() const;
+        size_t GetNumLeafs() const;
+        size_t GetNumDimensions() const;
+        size_t CalcMemoryUsageInBytes() const;
+        bool IsInitialized() const;
+
+        /**
+         * Find the frames closest to the query values, using the squared euclidean distance.
+         * @param queryValues The query feature values, GetNumDimensions() values.
+         * @param maxNeighbors The maximum number of frames to return, at most MaxNeighbors.
+         * @param resultFrameIndices The frame indices of the closest frames, sorted from closest to furthest. Cleared internally.
+         * @param maxLeafVisits The maximum number of leafs to search. More visits improve the accuracy of the search.
+         */
+        void FindNearestNeighbors(const AZStd::vector<float>& queryValues,
+            size_t maxNeighbors,
+            AZStd::vector<size_t>& resultFrameIndices,
+            size_t maxLeafVisits=4) const;
+
+        /**
+         * Find the closest frames for a batch of queries, like the queries of all instances searching in the same frame.
+         * The queries are searched grouped by the leaf they start in, so that the feature values of that leaf are still
+         * in the cache for the next query.
+         * @param queryValues The query feature values, GetNumDimensions() values for each query.
+         * @param maxNeighbors The maximum number of frames to return per query, at most MaxNeighbors.
+         * @param resultFrameIndices The frame indices of the closest frames, maxNeighbors entries per query, sorted from closest to furthest.
+         *        Entries are set to InvalidIndex when there are less frames than maxNeighbors.
+         * @param maxLeafVisits The maximum number of leafs to search per query.
+         */
+        void FindNearestNeighborsBatch(const AZStd::vector<float>& queryValues,
+            size_t maxNeighbors,
+            AZStd::vector<size_t>& resultFrameIndices,
+            size_t maxLeafVisits=4) const;
+
+    private:
+        static constexpr AZ::u32 InvalidNode = static_cast<AZ::u32>(-1);
+        static constexpr size_t BlockSize = 4;
+
+        struct Node
+        {
+            float m_splitValue = 0.0f; //< Queries with a value below the split value continue in the left child.
+            AZ::u32 m_dimension = 0;
+            AZ::u32 m_rightNode = InvalidNode; //< The left node directly follows its parent, leaf nodes don't have a right node.
+            AZ::u32 m_firstBlock = 0; //< The frame blocks of the leaf.
+            AZ::u32 m_numBlocks = 0;
+        };
+
+        struct Neighbor
+        {
+            float m_distance;
+            size_t m_frameIndex;
+        };
+
+        size_t BuildNode(const AZStd::vector<float>& frameValues, size_t* frames, size_t numFrames, size_t depth);
+        size_t FindLeaf(const float* queryValues) const;
+        size_t FindNearestNeighbors(const float* queryValues, size_t maxNeighbors, size_t maxLeafVisits, Neighbor* outNeighbors) const;
+        void SearchLeaf(const Node& leaf, const float* queryValues, size_t maxNeighbors, Neighbor* neighbors, size_t& numNeighbors) const;
+
+        AZStd::vector<Node> m_nodes;
+        AZStd::vector<float> m_blockValues; //< The feature values of four frames per dimension, for each block.
+        AZStd::vector<size_t> m_blockFrameIndices; //< The frame index of each value in the blocks, InvalidIndex for padding.
+        size_t m_numDimensions = 0;
+        size_t m_numLeafs = 0;
+        size_t m_maxDepth = 20;
+        size_t m_maxFramesPerLeaf = 256;
+    };
+} // namespace EMotionFX::MotionMatching
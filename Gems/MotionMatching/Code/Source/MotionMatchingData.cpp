@@ -31,6 +31,7 @@ namespace EMotionFX::MotionMatching
         : m_featureSchema(featureSchema)
     {
         m_kdTree = AZStd::make_unique<KdTree>();
+        m_flatKdTree = AZStd::make_unique<FlatKdTree>();
     }
 
     MotionMatchingData::~MotionMatchingData()
@@ -168,6 +169,16 @@ namespace EMotionFX::MotionMatching
             return false;
         }
 
+        // Initialize the flat kd-tree, which returns the nearest frames rather than all frames in a kd-tree leaf.
+        if (settings.m_useFlatKdTree && m_featureMatrix.rows() > 0)
+        {
+            if (!m_flatKdTree->Init(m_featureMatrix, m_featuresInKdTree, settings.m_maxKdTreeDepth, settings.m_maxFramesPerFlatKdTreeLeaf))
+            {
+                AZ_Error("Motion Matching", false, "Failed to initialize flat KdTree acceleration structure.");
+                return false;
+            }
+        }
+
         return true;
     }
 
@@ -176,6 +187,7 @@ namespace EMotionFX::MotionMatching
         m_frameDatabase.Clear();
         m_featureMatrix.Clear();
         m_kdTree->Clear();
+        m_flatKdTree->Clear();
         m_featuresInKdTree.clear();
     }
 } // namespace EMotionFX::MotionMatching
@@ -16,6 +16,7 @@
 
 #include <Feature.h>
 #include <FeatureSchema.h>
+#include <FlatKdTree.h>
 #include <FrameDatabase.h>
 #include <KdTree.h>
 
@@ -47,7 +48,9 @@ namespace EMotionFX::MotionMatching
             FrameDatabase::FrameImportSettings m_frameImportSettings;
             size_t m_maxKdTreeDepth = 20;
             size_t m_minFramesPerKdTreeNode = 1000;
+            size_t m_maxFramesPerFlatKdTreeLeaf = 256;
             bool m_importMirrored = false;
+            bool m_useFlatKdTree = false; //< Build the flat KD-tree, which the instances then use for the broad-phase search instead of the KD-tree.
         };
         bool Init(const InitSettings& settings);
 
@@ -58,6 +61,7 @@ namespace EMotionFX::MotionMatching
         const FeatureSchema& GetFeatureSchema() const { return m_featureSchema; }
         const FeatureMatrix& GetFeatureMatrix() const { return m_featureMatrix; }
         const KdTree& GetKdTree() const { return *m_kdTree.get(); }
+        const FlatKdTree& GetFlatKdTree() const { return *m_flatKdTree.get(); }
         const AZStd::vector<Feature*>& GetFeaturesInKdTree() const { return m_featuresInKdTree; }
 
     protected:
@@ -69,6 +73,7 @@ namespace EMotionFX::MotionMatching
         FeatureMatrix m_featureMatrix;
 
         AZStd::unique_ptr<KdTree> m_kdTree; /**< The acceleration structure to speed up the search for lowest cost frames. */
+        AZStd::unique_ptr<FlatKdTree> m_flatKdTree; /**< The approximate nearest neighbor search structure, only initialized when enabled in the init settings. */
         AZStd::vector<Feature*> m_featuresInKdTree;
     };
 } // namespace EMotionFX::MotionMatching
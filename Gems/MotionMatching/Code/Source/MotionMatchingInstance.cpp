@@ -22,6 +22,7 @@
 #include <Feature.h>
 #include <FeatureSchema.h>
 #include <FeatureTrajectory.h>
+#include <FlatKdTree.h>
 #include <KdTree.h>
 #include <ImGuiMonitorBus.h>
 #include <EMotionFX/Source/Pose.h>
@@ -470,7 +471,15 @@ namespace EMotionFX::MotionMatching
             AZ_Assert(startOffset == m_queryFeatureValues.size(), "Frame float vector is not the expected size.");
 
             // Find our nearest frames.
-            m_data->GetKdTree().FindNearestNeighbors(m_queryFeatureValues, m_nearestFrames);
+            const FlatKdTree& flatKdTree = m_data->GetFlatKdTree();
+            if (flatKdTree.IsInitialized())
+            {
+                flatKdTree.FindNearestNeighbors(m_queryFeatureValues, AZ::GetMin(m_maxNearestNeighbors, FlatKdTree::MaxNeighbors), m_nearestFrames);
+            }
+            else
+            {
+                m_data->GetKdTree().FindNearestNeighbors(m_queryFeatureValues, m_nearestFrames);
+            }
         }
 
         // 2. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
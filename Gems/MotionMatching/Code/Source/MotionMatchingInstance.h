@@ -62,6 +62,8 @@ namespace EMotionFX::MotionMatching
 
         size_t GetLowestCostFrameIndex() const { return m_lowestCostFrameIndex; }
         void SetLowestCostSearchFrequency(float frequency) { m_lowestCostSearchFrequency = frequency; }
+        void SetMaxNearestNeighbors(size_t maxNearestNeighbors) { m_maxNearestNeighbors = maxNearestNeighbors; }
+        size_t GetMaxNearestNeighbors() const { return m_maxNearestNeighbors; }
         float GetNewMotionTime() const { return m_newMotionTime; }
 
         /**
@@ -102,6 +104,7 @@ namespace EMotionFX::MotionMatching
         float m_newMotionTime = 0.0f;
         size_t m_lowestCostFrameIndex = InvalidIndex;
         float m_lowestCostSearchFrequency = 5.0f; //< How often the lowest cost frame shall be searched per second.
+        size_t m_maxNearestNeighbors = 64; //< The number of frames the flat KD-tree passes to the narrow-phase, when the data uses the flat KD-tree.
 
         bool m_blending = false;
         float m_blendWeight = 1.0f;
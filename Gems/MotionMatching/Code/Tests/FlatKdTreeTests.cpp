@@ -0,0 +1,422 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
+#include <Fixture.h>
+#include <FeatureMatrix.h>
+#include <FeaturePosition.h>
+#include <FlatKdTree.h>
+
+#include <numeric>
+
+#ifdef HAVE_BENCHMARK
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Frame.h>
+#include <FrameDatabase.h>
+#include <KdTree.h>
+#include <benchmark/benchmark.h>
+#endif
+
+namespace EMotionFX::MotionMatching
+{
+    namespace
+    {
+        void FillRandomFeatureMatrix(FeatureMatrix& featureMatrix, size_t numFrames, size_t numColumns)
+        {
+            AZ::SimpleLcgRandom random(1234);
+            featureMatrix.resize(numFrames, numColumns);
+            for (size_t row = 0; row < numFrames; ++row)
+            {
+                for (size_t column = 0; column < numColumns; ++column)
+                {
+                    featureMatrix(row, column) = random.GetRandomFloat() * 2.0f - 1.0f;
+                }
+            }
+        }
+
+        float CalcSquaredDistance(const FeatureMatrix& featureMatrix, size_t frameIndex, const float* queryValues, size_t numColumns)
+        {
+            float result = 0.0f;
+            for (size_t column = 0; column < numColumns; ++column)
+            {
+                const float delta = featureMatrix(frameIndex, column) - queryValues[column];
+                result += delta * delta;
+            }
+            return result;
+        }
+    } // namespace
+
+    class FlatKdTreeFixture
+        : public Fixture
+    {
+    public:
+        static constexpr size_t NumFrames = 5000;
+        static constexpr size_t NumColumns = 6;
+
+        void SetUp() override
+        {
+            Fixture::SetUp();
+
+            FillRandomFeatureMatrix(m_featureMatrix, NumFrames, NumColumns);
+            m_positionA.SetColumnOffset(0);
+            m_positionB.SetColumnOffset(3);
+            m_features = { &m_positionA, &m_positionB };
+        }
+
+        AZStd::vector<float> GetFrameValues(size_t frameIndex) const
+        {
+            AZStd::vector<float> result(NumColumns);
+            for (size_t column = 0; column < NumColumns; ++column)
+            {
+                result[column] = m_featureMatrix(frameIndex, column);
+            }
+            return result;
+        }
+
+        AZStd::vector<size_t> FindNearestNeighborsBruteForce(const AZStd::vector<float>& queryValues, size_t maxNeighbors) const
+        {
+            AZStd::vector<size_t> frames(NumFrames);
+            std::iota(frames.begin(), frames.end(), size_t{ 0 });
+            AZStd::sort(frames.begin(), frames.end(), [this, &queryValues](size_t frameA, size_t frameB)
+                {
+                    return CalcSquaredDistance(m_featureMatrix, frameA, queryValues.data(), NumColumns) <
+                        CalcSquaredDistance(m_featureMatrix, frameB, queryValues.data(), NumColumns);
+                });
+            frames.resize(maxNeighbors);
+            return frames;
+        }
+
+        AZStd::vector<float> CreateRandomQuery(AZ::SimpleLcgRandom& random) const
+        {
+            AZStd::vector<float> result(NumColumns);
+            for (float& value : result)
+            {
+                value = random.GetRandomFloat() * 2.0f - 1.0f;
+            }
+            return result;
+        }
+
+    protected:
+        FeatureMatrix m_featureMatrix;
+        FeaturePosition m_positionA;
+        FeaturePosition m_positionB;
+        AZStd::vector<Feature*> m_features;
+        FlatKdTree m_flatKdTree;
+    };
+
+    TEST_F(FlatKdTreeFixture, Init)
+    {
+        ASSERT_TRUE(m_flatKdTree.Init(m_featureMatrix, m_features, 20, 64));
+
+        EXPECT_TRUE(m_flatKdTree.IsInitialized());
+        EXPECT_EQ(m_flatKdTree.GetNumDimensions(), NumColumns);
+        EXPECT_GE(m_flatKdTree.GetNumLeafs(), NumFrames / 64);
+        EXPECT_EQ(m_flatKdTree.GetNumNodes(), m_flatKdTree.GetNumLeafs() * 2 - 1);
+
+        m_flatKdTree.Clear();
+        EXPECT_FALSE(m_flatKdTree.IsInitialized());
+    }
+
+    TEST_F(FlatKdTreeFixture, InitFailsWithoutFeatures)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(m_flatKdTree.Init(m_featureMatrix, {}));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(m_flatKdTree.IsInitialized());
+    }
+
+    TEST_F(FlatKdTreeFixture, FindsQueriedFrame)
+    {
+        ASSERT_TRUE(m_flatKdTree.Init(m_featureMatrix, m_features, 20, 64));
+
+        AZStd::vector<size_t> result;
+        for (size_t frameIndex = 0; frameIndex < NumFrames; frameIndex += 97)
+        {
+            m_flatKdTree.FindNearestNeighbors(GetFrameValues(frameIndex), 1, result, 1);
+            ASSERT_EQ(result.size(), 1);
+            EXPECT_EQ(result[0], frameIndex);
+        }
+    }
+
+    TEST_F(FlatKdTreeFixture, SearchingAllLeafsMatchesBruteForce)
+    {
+        ASSERT_TRUE(m_flatKdTree.Init(m_featureMatrix, m_features, 20, 64));
+
+        AZ::SimpleLcgRandom random(42);
+        AZStd::vector<size_t> result;
+        for (size_t i = 0; i < 20; ++i)
+        {
+            const AZStd::vector<float> query = CreateRandomQuery(random);
+            m_flatKdTree.FindNearestNeighbors(query, 16, result, m_flatKdTree.GetNumLeafs());
+            EXPECT_EQ(result, FindNearestNeighborsBruteForce(query, 16));
+        }
+    }
+
+    TEST_F(FlatKdTreeFixture, ApproximateSearchReturnsSortedNeighbors)
+    {
+        ASSERT_TRUE(m_flatKdTree.Init(m_featureMatrix, m_features, 20, 64));
+
+        AZ::SimpleLcgRandom random(7);
+        AZStd::vector<size_t> result;
+        for (size_t i = 0; i < 20; ++i)
+        {
+            const AZStd::vector<float> query = CreateRandomQuery(random);
+            m_flatKdTree.FindNearestNeighbors(query, 32, result, 1);
+            ASSERT_EQ(result.size(), 32);
+            for (size_t j = 1; j < result.size(); ++j)
+            {
+                EXPECT_LE(CalcSquaredDistance(m_featureMatrix, result[j - 1], query.data(), NumColumns),
+                    CalcSquaredDistance(m_featureMatrix, result[j], query.data(), NumColumns));
+            }
+        }
+    }
+
+    TEST_F(FlatKdTreeFixture, ReturnsAllFramesWhenAskingForMore)
+    {
+        FeatureMatrix smallFeatureMatrix;
+        FillRandomFeatureMatrix(smallFeatureMatrix, 10, NumColumns);
+        ASSERT_TRUE(m_flatKdTree.Init(smallFeatureMatrix, m_features, 20, 64));
+
+        AZStd::vector<size_t> result;
+        m_flatKdTree.FindNearestNeighbors(AZStd::vector<float>(NumColumns, 0.0f), 16, result);
+        EXPECT_EQ(result.size(), 10);
+
+        m_flatKdTree.FindNearestNeighborsBatch(AZStd::vector<float>(NumColumns * 2, 0.0f), 16, result);
+        ASSERT_EQ(result.size(), 32);
+        EXPECT_EQ(AZStd::count_if(result.begin(), result.end(), [](size_t frameIndex) { return frameIndex == InvalidIndex; }), 12);
+    }
+
+    TEST_F(FlatKdTreeFixture, BatchMatchesSingleQueries)
+    {
+        ASSERT_TRUE(m_flatKdTree.Init(m_featureMatrix, m_features, 20, 64));
+
+        constexpr size_t numQueries = 50;
+        constexpr size_t maxNeighbors = 8;
+        AZ::SimpleLcgRandom random(3);
+        AZStd::vector<float> queries;
+        for (size_t i = 0; i < numQueries; ++i)
+        {
+            const AZStd::vector<float> query = CreateRandomQuery(random);
+            queries.insert(queries.end(), query.begin(), query.end());
+        }
+
+        AZStd::vector<size_t> batchResult;
+        m_flatKdTree.FindNearestNeighborsBatch(queries, maxNeighbors, batchResult, 2);
+        ASSERT_EQ(batchResult.size(), numQueries * maxNeighbors);
+
+        AZStd::vector<size_t> result;
+        for (size_t i = 0; i < numQueries; ++i)
+        {
+            const AZStd::vector<float> query(queries.begin() + i * NumColumns, queries.begin() + (i + 1) * NumColumns);
+            m_flatKdTree.FindNearestNeighbors(query, maxNeighbors, result, 2);
+            EXPECT_EQ(result, AZStd::vector<size_t>(batchResult.begin() + i * maxNeighbors, batchResult.begin() + (i + 1) * maxNeighbors));
+        }
+    }
+
+#ifdef HAVE_BENCHMARK
+    //! Finds the lowest cost frame for 200 instances in a database of 100k frames.
+    //! The broad-phase searches the 12 values of four position features, the narrow-phase calculates the cost over all 24 columns of
+    //! the feature matrix, like the trajectory feature adds values that aren't part of the broad-phase search.
+    class FlatKdTreeBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t NumFrames = 100000;
+        static constexpr size_t NumColumns = 24;
+        static constexpr size_t NumInstances = 200;
+        static constexpr size_t MaxNearestNeighbors = 64;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpData();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpData();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            TearDownData();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDownData();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void SetUpData()
+        {
+            m_featureMatrix.emplace();
+            FillRandomFeatureMatrix(*m_featureMatrix, NumFrames, NumColumns);
+
+            m_positions.resize(4);
+            for (size_t i = 0; i < m_positions.size(); ++i)
+            {
+                m_positions[i].SetColumnOffset(i * 3);
+                m_features.emplace_back(&m_positions[i]);
+            }
+
+            // Query close to existing frames, like the current pose of an instance usually is.
+            AZ::SimpleLcgRandom random(5);
+            m_treeQueries.reserve(NumInstances * 12);
+            m_fullQueries.reserve(NumInstances * NumColumns);
+            for (size_t i = 0; i < NumInstances; ++i)
+            {
+                const size_t frameIndex = random.GetRandom() % NumFrames;
+                for (size_t column = 0; column < NumColumns; ++column)
+                {
+                    const float value = (*m_featureMatrix)(frameIndex, column) + (random.GetRandomFloat() - 0.5f) * 0.1f;
+                    m_fullQueries.emplace_back(value);
+                    if (column < 12)
+                    {
+                        m_treeQueries.emplace_back(value);
+                    }
+                }
+            }
+        }
+
+        void TearDownData()
+        {
+            m_treeQueries = {};
+            m_fullQueries = {};
+            m_features = {};
+            m_positions = {};
+            m_featureMatrix.reset();
+        }
+
+        //! The narrow-phase, calculating the cost of each candidate frame.
+        template<typename FrameContainer>
+        size_t FindLowestCostFrame(const FrameContainer& frames, size_t instanceIndex) const
+        {
+            const float* queryValues = &m_fullQueries[instanceIndex * NumColumns];
+            float minCost = AZStd::numeric_limits<float>::max();
+            size_t minCostFrameIndex = InvalidIndex;
+            for (const size_t frameIndex : frames)
+            {
+                if (frameIndex == InvalidIndex)
+                {
+                    continue;
+                }
+
+                const float cost = CalcSquaredDistance(*m_featureMatrix, frameIndex, queryValues, NumColumns);
+                if (cost < minCost)
+                {
+                    minCost = cost;
+                    minCostFrameIndex = frameIndex;
+                }
+            }
+            return minCostFrameIndex;
+        }
+
+        AZStd::vector<float> GetTreeQuery(size_t instanceIndex) const
+        {
+            return AZStd::vector<float>(m_treeQueries.begin() + instanceIndex * 12, m_treeQueries.begin() + (instanceIndex + 1) * 12);
+        }
+
+        AZStd::optional<FeatureMatrix> m_featureMatrix; //< Not allocated using the motion matching allocator, which the benchmark doesn't create.
+        AZStd::vector<FeaturePosition> m_positions;
+        AZStd::vector<Feature*> m_features;
+        AZStd::vector<float> m_treeQueries;
+        AZStd::vector<float> m_fullQueries;
+    };
+
+    BENCHMARK_F(FlatKdTreeBenchmarkFixture, BM_FindLowestCostFrame_BruteForce)(benchmark::State& state)
+    {
+        AZStd::vector<size_t> allFrames(NumFrames);
+        std::iota(allFrames.begin(), allFrames.end(), size_t{ 0 });
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < NumInstances; ++i)
+            {
+                benchmark::DoNotOptimize(FindLowestCostFrame(allFrames, i));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * NumInstances);
+    }
+
+    BENCHMARK_F(FlatKdTreeBenchmarkFixture, BM_FindLowestCostFrame_KdTree)(benchmark::State& state)
+    {
+        FrameDatabase frameDatabase;
+        frameDatabase.GetFrames().reserve(NumFrames);
+        for (size_t i = 0; i < NumFrames; ++i)
+        {
+            frameDatabase.GetFrames().emplace_back(i, nullptr, 0.0f, false);
+        }
+        KdTree kdTree;
+        kdTree.Init(frameDatabase, *m_featureMatrix, m_features, 12, 1000);
+
+        AZStd::vector<AZStd::vector<float>> queries(NumInstances);
+        for (size_t i = 0; i < NumInstances; ++i)
+        {
+            queries[i] = GetTreeQuery(i);
+        }
+
+        AZStd::vector<size_t> nearestFrames;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < NumInstances; ++i)
+            {
+                kdTree.FindNearestNeighbors(queries[i], nearestFrames);
+                benchmark::DoNotOptimize(FindLowestCostFrame(nearestFrames, i));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * NumInstances);
+    }
+
+    BENCHMARK_F(FlatKdTreeBenchmarkFixture, BM_FindLowestCostFrame_FlatKdTree)(benchmark::State& state)
+    {
+        FlatKdTree flatKdTree;
+        flatKdTree.Init(*m_featureMatrix, m_features);
+
+        AZStd::vector<AZStd::vector<float>> queries(NumInstances);
+        for (size_t i = 0; i < NumInstances; ++i)
+        {
+            queries[i] = GetTreeQuery(i);
+        }
+
+        AZStd::vector<size_t> nearestFrames;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < NumInstances; ++i)
+            {
+                flatKdTree.FindNearestNeighbors(queries[i], MaxNearestNeighbors, nearestFrames);
+                benchmark::DoNotOptimize(FindLowestCostFrame(nearestFrames, i));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * NumInstances);
+    }
+
+    BENCHMARK_F(FlatKdTreeBenchmarkFixture, BM_FindLowestCostFrame_FlatKdTreeBatch)(benchmark::State& state)
+    {
+        FlatKdTree flatKdTree;
+        flatKdTree.Init(*m_featureMatrix, m_features);
+
+        AZStd::vector<size_t> nearestFrames;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            flatKdTree.FindNearestNeighborsBatch(m_treeQueries, MaxNearestNeighbors, nearestFrames);
+            for (size_t i = 0; i < NumInstances; ++i)
+            {
+                const AZStd::span<const size_t> instanceFrames(nearestFrames.data() + i * MaxNearestNeighbors, MaxNearestNeighbors);
+                benchmark::DoNotOptimize(FindLowestCostFrame(instanceFrames, i));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * NumInstances);
+    }
+#endif // HAVE_BENCHMARK
+} // namespace EMotionFX::MotionMatching
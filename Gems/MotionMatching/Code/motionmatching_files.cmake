@@ -32,6 +32,8 @@ set(FILES
     Source/FeatureTrajectory.cpp
     Source/FeatureVelocity.cpp
     Source/FeatureVelocity.h
+    Source/FlatKdTree.cpp
+    Source/FlatKdTree.h
     Source/PoseDataJointVelocities.cpp
     Source/PoseDataJointVelocities.h
     Source/TrajectoryHistory.cpp
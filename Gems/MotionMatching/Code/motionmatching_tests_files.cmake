@@ -10,5 +10,6 @@ set(FILES
     Tests/Fixture.h
     Tests/FeatureMatrixTests.cpp
     Tests/FeatureSchemaTests.cpp
+    Tests/FlatKdTreeTests.cpp
     Tests/MotionMatchingTest.cpp
 )
\ No newline at end of file
@@ -39,6 +39,13 @@ namespace PhysX
         bool operator!=(const WindConfiguration& other) const;
     };
 
+    //! Scheduling system the tasks submitted by PhysX are dispatched to.
+    enum class CpuDispatcherType : AZ::u8
+    {
+        JobManager, //!< Tasks run as jobs on the global AZ::JobManager.
+        TaskExecutor //!< Tasks run on a dedicated AZ::TaskExecutor with pooled task wrappers.
+    };
+
     //! Contains global physics settings.
     //! Used to initialize the Physics System.
     struct PhysXSystemConfiguration : public AzPhysics::SystemConfiguration
@@ -51,6 +58,14 @@ namespace PhysX
 
         WindConfiguration m_windConfiguration; //!< Wind configuration for PhysX.
 
+        //! Scheduling system used to run the PhysX simulation tasks. Changes apply to the scenes added once all the existing ones are removed.
+        CpuDispatcherType m_cpuDispatcherType = CpuDispatcherType::JobManager;
+        //! Number of worker threads of the TaskExecutor dispatcher, 0 to match the hardware concurrency.
+        AZ::u32 m_cpuDispatcherWorkerCount = 0;
+
+        //! Returns true if the task executor dispatcher is selected, used to show its settings in the editor.
+        bool IsTaskExecutorDispatcher() const { return m_cpuDispatcherType == CpuDispatcherType::TaskExecutor; }
+
         bool operator==(const PhysXSystemConfiguration& other) const;
         bool operator!=(const PhysXSystemConfiguration& other) const;
     };
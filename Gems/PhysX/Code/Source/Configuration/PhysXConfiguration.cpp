@@ -90,8 +90,10 @@ namespace PhysX
         if (auto* serializeContext = azdynamic_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<PhysX::PhysXSystemConfiguration, AzPhysics::SystemConfiguration>()
-                ->Version(2, &PhysXInternal::PhysXSystemConfigurationConverter)
+                ->Version(3, &PhysXInternal::PhysXSystemConfigurationConverter)
                 ->Field("WindConfiguration", &PhysXSystemConfiguration::m_windConfiguration)
+                ->Field("CpuDispatcherType", &PhysXSystemConfiguration::m_cpuDispatcherType)
+                ->Field("CpuDispatcherWorkerCount", &PhysXSystemConfiguration::m_cpuDispatcherWorkerCount)
                 ;
 
             if (AZ::EditContext* editContext = serializeContext->GetEditContext())
@@ -100,6 +102,16 @@ namespace PhysX
                 editContext->Class<PhysX::PhysXSystemConfiguration>("System Configuration", "PhysX system configuration")
                     ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ->DataElement(AZ::Edit::UIHandlers::ComboBox, &PhysXSystemConfiguration::m_cpuDispatcherType,
+                        "CPU dispatcher", "Scheduling system used to run the PhysX simulation tasks.\n"
+                        "Job Manager: tasks run as jobs on the global job manager.\n"
+                        "Task Executor: tasks run on dedicated task executor threads.")
+                        ->EnumAttribute(CpuDispatcherType::JobManager, "Job Manager")
+                        ->EnumAttribute(CpuDispatcherType::TaskExecutor, "Task Executor")
+                        ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &PhysXSystemConfiguration::m_cpuDispatcherWorkerCount,
+                        "CPU dispatcher worker count", "Number of threads running the PhysX simulation tasks, 0 to match the hardware concurrency.")
+                        ->Attribute(AZ::Edit::Attributes::Visibility, &PhysXSystemConfiguration::IsTaskExecutorDispatcher)
                     ;
             }
         }
@@ -115,7 +127,9 @@ namespace PhysX
     bool PhysXSystemConfiguration::operator==(const PhysXSystemConfiguration& other) const
     {
         return AzPhysics::SystemConfiguration::operator==(other) &&
-            m_windConfiguration == other.m_windConfiguration
+            m_windConfiguration == other.m_windConfiguration &&
+            m_cpuDispatcherType == other.m_cpuDispatcherType &&
+            m_cpuDispatcherWorkerCount == other.m_cpuDispatcherWorkerCount
             ;
     }
 
@@ -12,6 +12,7 @@
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 #include <AzFramework/Physics/Shape.h>
 #include <Source/HeightfieldColliderComponent.h>
+#include <Source/RigidBodyStatic.h>
 #include <Source/Utils.h>
 #include <System/PhysXSystem.h>
 
@@ -22,10 +23,11 @@ namespace PhysX
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<EditorHeightfieldColliderComponent, EditorComponentBase>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("ColliderConfiguration", &EditorHeightfieldColliderComponent::m_colliderConfig)
                 ->Field("DebugDrawSettings", &EditorHeightfieldColliderComponent::m_colliderDebugDraw)
                 ->Field("ShapeConfig", &EditorHeightfieldColliderComponent::m_shapeConfig)
+                ->Field("TileStreaming", &EditorHeightfieldColliderComponent::m_tileStreamingConfig)
                 ;
 
             if (auto editContext = serializeContext->GetEditContext())
@@ -49,6 +51,9 @@ namespace PhysX
                         AZ::Edit::UIHandlers::Default, &EditorHeightfieldColliderComponent::m_colliderDebugDraw, "Debug draw settings",
                         "Debug draw settings")
                         ->Attribute(AZ::Edit::Attributes::Visibility, AZ::Edit::PropertyVisibility::ShowChildrenOnly)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default, &EditorHeightfieldColliderComponent::m_tileStreamingConfig, "Tile streaming",
+                        "Split the heightfield collider into tiles at runtime, and only simulate the tiles near the active camera")
                     ;
             }
         }
@@ -151,11 +156,15 @@ namespace PhysX
         auto* heightfieldColliderComponent = gameEntity->CreateComponent<HeightfieldColliderComponent>();
         heightfieldColliderComponent->SetShapeConfiguration(
             { AZStd::make_shared<Physics::ColliderConfiguration>(m_colliderConfig), m_shapeConfig });
+        heightfieldColliderComponent->SetTileStreamingConfiguration(m_tileStreamingConfig);
     }
 
-    void EditorHeightfieldColliderComponent::OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion)
+    void EditorHeightfieldColliderComponent::OnHeightfieldDataChanged(const AZ::Aabb& dirtyRegion)
     {
-        RefreshHeightfield();
+        if (!RefreshHeightfieldRegion(dirtyRegion))
+        {
+            RefreshHeightfield();
+        }
     }
 
     void EditorHeightfieldColliderComponent::ClearHeightfield()
@@ -179,13 +188,13 @@ namespace PhysX
         // Get the transform from the HeightfieldProvider.  Because rotation and scale can indirectly affect how the heightfield itself
         // is computed and the size of the heightfield, it's possible that the HeightfieldProvider will provide a different transform
         // back to us than the one that's directly on that entity.
-        AZ::Transform transform = AZ::Transform::CreateIdentity();
+        m_heightfieldTransform = AZ::Transform::CreateIdentity();
         Physics::HeightfieldProviderRequestsBus::EventResult(
-            transform, GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldTransform);
+            m_heightfieldTransform, GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldTransform);
 
         AzPhysics::StaticRigidBodyConfiguration configuration;
-        configuration.m_orientation = transform.GetRotation();
-        configuration.m_position = transform.GetTranslation();
+        configuration.m_orientation = m_heightfieldTransform.GetRotation();
+        configuration.m_position = m_heightfieldTransform.GetTranslation();
         configuration.m_entityId = GetEntityId();
         configuration.m_debugName = GetEntity()->GetName();
 
@@ -220,6 +229,59 @@ namespace PhysX
         Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
     }
 
+    bool EditorHeightfieldColliderComponent::RefreshHeightfieldRegion(const AZ::Aabb& dirtyRegion)
+    {
+        // The samples can only be updated in place if the heightfield still has the same layout and position.
+        if (!dirtyRegion.IsValid() || m_shapeConfig->GetSamples().empty() ||
+            !Utils::IsHeightfieldLayoutUnchanged(GetEntityId(), *m_shapeConfig))
+        {
+            return false;
+        }
+
+        AZ::Transform transform = AZ::Transform::CreateIdentity();
+        Physics::HeightfieldProviderRequestsBus::EventResult(
+            transform, GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldTransform);
+        if (!transform.IsClose(m_heightfieldTransform))
+        {
+            return false;
+        }
+
+        size_t startColumn = 0;
+        size_t startRow = 0;
+        size_t numColumns = 0;
+        size_t numRows = 0;
+        Physics::HeightfieldProviderRequestsBus::Event(
+            GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion, dirtyRegion, startColumn,
+            startRow, numColumns, numRows);
+
+        if ((numColumns == 0) || (numRows == 0))
+        {
+            return true;
+        }
+
+        auto* body = azdynamic_cast<PhysX::StaticRigidBody*>(GetSimulatedBody());
+        if (!body || (body->GetShapeCount() != 1))
+        {
+            return false;
+        }
+
+        Physics::HeightfieldProviderRequestsBus::Event(
+            GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::UpdateHeightsAndMaterials,
+            [this](size_t column, size_t row, const Physics::HeightMaterialPoint& dataPoint)
+            {
+                m_shapeConfig->ModifySample(column, row, dataPoint);
+            },
+            dirtyRegion);
+
+        if (!Utils::RefreshHeightfieldShape(*body->GetShape(0), *m_shapeConfig, startColumn, startRow, numColumns, numRows))
+        {
+            return false;
+        }
+
+        Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
+        return true;
+    }
+
     AZ::u32 EditorHeightfieldColliderComponent::OnConfigurationChanged()
     {
         RefreshHeightfield();
@@ -19,6 +19,8 @@
 
 #include <PhysX/ColliderShapeBus.h>
 
+#include <Source/HeightfieldColliderComponent.h>
+
 namespace PhysX
 {
     //! Editor PhysX Heightfield Collider Component.
@@ -77,7 +79,7 @@ namespace PhysX
         AzPhysics::SceneQueryHit RayCast(const AzPhysics::RayCastRequest& request) override;
 
         // Physics::HeightfieldProviderNotificationBus
-        void OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion) override;
+        void OnHeightfieldDataChanged(const AZ::Aabb& dirtyRegion) override;
 
     private:
         AZ::u32 OnConfigurationChanged();
@@ -86,6 +88,7 @@ namespace PhysX
         void InitHeightfieldShapeConfiguration();
         void InitStaticRigidBody();
         void RefreshHeightfield();
+        bool RefreshHeightfieldRegion(const AZ::Aabb& dirtyRegion);
 
         DebugDraw::Collider m_colliderDebugDraw; //!< Handles drawing the collider
         AzPhysics::SceneInterface* m_sceneInterface{ nullptr };
@@ -95,6 +98,9 @@ namespace PhysX
 
         Physics::ColliderConfiguration m_colliderConfig; //!< Stores collision layers, whether the collider is a trigger, etc.
         AZStd::shared_ptr<Physics::HeightfieldShapeConfiguration> m_shapeConfig{ new Physics::HeightfieldShapeConfiguration() };
+        //! Tiling only applies to the game entity, the editor always simulates the heightfield as a single shape.
+        HeightfieldTileStreamingConfiguration m_tileStreamingConfig;
+        AZ::Transform m_heightfieldTransform = AZ::Transform::CreateIdentity(); //!< The transform the simulated body was created with.
 
         AzPhysics::SimulatedBodyHandle m_staticRigidBodyHandle =
             AzPhysics::InvalidSimulatedBodyHandle; //!< Handle to the body in the editor physics scene if there is no rigid body component.
@@ -9,6 +9,7 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Physics/Collision/CollisionGroups.h>
 #include <AzFramework/Physics/Collision/CollisionLayers.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
@@ -26,13 +27,66 @@
 
 namespace PhysX
 {
+    namespace
+    {
+        // Limit how many tiles get cooked and added to the simulation in a single frame while streaming, to avoid frame spikes.
+        constexpr size_t MaxTileLoadsPerTick = 4;
+
+        bool GetActiveCameraPosition(AZ::Vector3& cameraPosition)
+        {
+            if (!Camera::ActiveCameraRequestBus::HasHandlers())
+            {
+                return false;
+            }
+
+            AZ::Transform cameraTransform = AZ::Transform::CreateIdentity();
+            Camera::ActiveCameraRequestBus::BroadcastResult(
+                cameraTransform, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraTransform);
+            cameraPosition = cameraTransform.GetTranslation();
+            return true;
+        }
+    } // namespace
+
+    void HeightfieldTileStreamingConfiguration::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<HeightfieldTileStreamingConfiguration>()
+                ->Version(1)
+                ->Field("Enabled", &HeightfieldTileStreamingConfiguration::m_enabled)
+                ->Field("TileSize", &HeightfieldTileStreamingConfiguration::m_tileSize)
+                ->Field("StreamingDistance", &HeightfieldTileStreamingConfiguration::m_streamingDistance)
+                ;
+
+            if (auto editContext = serializeContext->GetEditContext())
+            {
+                editContext->Class<HeightfieldTileStreamingConfiguration>("Tile Streaming", "Settings for splitting the heightfield collider into tiles")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &HeightfieldTileStreamingConfiguration::m_enabled, "Enabled",
+                        "Split the heightfield collider into tiles, and only simulate the tiles near the active camera.")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &HeightfieldTileStreamingConfiguration::m_tileSize, "Tile Size",
+                        "The number of heightfield quads along each side of a tile.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &HeightfieldTileStreamingConfiguration::m_streamingDistance, "Streaming Distance",
+                        "Tiles within this distance of the active camera are simulated. All tiles are simulated when there isn't an active camera.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                        ->Attribute(AZ::Edit::Attributes::Suffix, " m")
+                    ;
+            }
+        }
+    }
+
     void HeightfieldColliderComponent::Reflect(AZ::ReflectContext* context)
     {
+        HeightfieldTileStreamingConfiguration::Reflect(context);
+
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<HeightfieldColliderComponent, AZ::Component>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("ShapeConfig", &HeightfieldColliderComponent::m_shapeConfig)
+                ->Field("TileStreaming", &HeightfieldColliderComponent::m_tileStreamingConfig)
                 ;
         }
     }
@@ -73,10 +127,16 @@ namespace PhysX
         AzPhysics::SimulatedBodyComponentRequestsBus::Handler::BusConnect(entityId);
 
         RefreshHeightfield();
+
+        if (IsTiled())
+        {
+            AZ::TickBus::Handler::BusConnect();
+        }
     }
 
     void HeightfieldColliderComponent::Deactivate()
     {
+        AZ::TickBus::Handler::BusDisconnect();
         AzPhysics::SimulatedBodyComponentRequestsBus::Handler::BusDisconnect();
         Physics::CollisionFilteringRequestBus::Handler::BusDisconnect();
         ColliderShapeRequestBus::Handler::BusDisconnect();
@@ -86,13 +146,48 @@ namespace PhysX
         ClearHeightfield();
     }
 
-    void HeightfieldColliderComponent::OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion)
+    void HeightfieldColliderComponent::OnHeightfieldDataChanged(const AZ::Aabb& dirtyRegion)
     {
-        RefreshHeightfield();
+        // Small edits only need the affected samples updated in place, which is much cheaper than recooking the whole heightfield.
+        if (!RefreshHeightfieldRegion(dirtyRegion))
+        {
+            RefreshHeightfield();
+        }
+    }
+
+    void HeightfieldColliderComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (!m_tileStreamingPending)
+        {
+            // Only reevaluate which tiles to simulate once the camera has moved a meaningful fraction of a tile.
+            AZ::Vector3 cameraPosition = AZ::Vector3::CreateZero();
+            if (!GetActiveCameraPosition(cameraPosition))
+            {
+                return;
+            }
+
+            const Physics::HeightfieldShapeConfiguration& configuration =
+                static_cast<const Physics::HeightfieldShapeConfiguration&>(*m_shapeConfig.second);
+            const AZ::Vector2& gridSpacing = configuration.GetGridResolution();
+            const float tileExtent = m_tileStreamingConfig.m_tileSize * AZ::GetMax(gridSpacing.GetX(), gridSpacing.GetY());
+            if (cameraPosition.GetDistanceSq(m_lastStreamingPosition) < (tileExtent * tileExtent * 0.0625f))
+            {
+                return;
+            }
+        }
+
+        UpdateTileStreaming(false);
+    }
+
+    bool HeightfieldColliderComponent::IsTiled() const
+    {
+        return m_tileStreamingConfig.m_enabled && (m_tileStreamingConfig.m_tileSize > 0);
     }
 
     void HeightfieldColliderComponent::ClearHeightfield()
     {
+        ClearTiles();
+
         // There are two references to the heightfield data, we need to clear both to make the heightfield clear out and deallocate:
         // - The simulated body has a pointer to the shape, which has a GeometryHolder, which has the Heightfield inside it
         // - The shape config is also holding onto a pointer to the Heightfield
@@ -111,16 +206,9 @@ namespace PhysX
 
     void HeightfieldColliderComponent::InitStaticRigidBody()
     {
-        // Get the transform from the HeightfieldProvider.  Because rotation and scale can indirectly affect how the heightfield itself
-        // is computed and the size of the heightfield, it's possible that the HeightfieldProvider will provide a different transform
-        // back to us than the one that's directly on that entity.
-        AZ::Transform transform = AZ::Transform::CreateIdentity();
-        Physics::HeightfieldProviderRequestsBus::EventResult(
-            transform, GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldTransform);
-
         AzPhysics::StaticRigidBodyConfiguration configuration;
-        configuration.m_orientation = transform.GetRotation();
-        configuration.m_position = transform.GetTranslation();
+        configuration.m_orientation = m_heightfieldTransform.GetRotation();
+        configuration.m_position = m_heightfieldTransform.GetTranslation();
         configuration.m_entityId = GetEntityId();
         configuration.m_debugName = GetEntity()->GetName();
         configuration.m_colliderAndShapeData = GetShapeConfigurations();
@@ -139,7 +227,8 @@ namespace PhysX
     {
         Physics::HeightfieldShapeConfiguration& configuration = static_cast<Physics::HeightfieldShapeConfiguration&>(*m_shapeConfig.second);
 
-        configuration = Utils::CreateHeightfieldShapeConfiguration(GetEntityId());
+        // The samples of a tiled heightfield are only generated for the tiles that get simulated.
+        configuration = Utils::CreateHeightfieldShapeConfiguration(GetEntityId(), !IsTiled());
 
         // Update material selection from the mapping
         Physics::ColliderConfiguration* colliderConfig = m_shapeConfig.first.get();
@@ -151,13 +240,349 @@ namespace PhysX
         ClearHeightfield();
         InitHeightfieldShapeConfiguration();
 
+        // Get the transform from the HeightfieldProvider.  Because rotation and scale can indirectly affect how the heightfield itself
+        // is computed and the size of the heightfield, it's possible that the HeightfieldProvider will provide a different transform
+        // back to us than the one that's directly on that entity.
+        m_heightfieldTransform = AZ::Transform::CreateIdentity();
+        Physics::HeightfieldProviderRequestsBus::EventResult(
+            m_heightfieldTransform, GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldTransform);
+
+        if (IsTiled())
+        {
+            InitTiles();
+            UpdateTileStreaming(true);
+        }
+        else
+        {
+            Physics::HeightfieldShapeConfiguration& configuration =
+                static_cast<Physics::HeightfieldShapeConfiguration&>(*m_shapeConfig.second);
+            if (!configuration.GetSamples().empty())
+            {
+                InitStaticRigidBody();
+            }
+        }
+
+        Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
+    }
+
+    bool HeightfieldColliderComponent::RefreshHeightfieldRegion(const AZ::Aabb& dirtyRegion)
+    {
+        // The samples can only be updated in place if the heightfield still has the same layout and position.
         Physics::HeightfieldShapeConfiguration& configuration = static_cast<Physics::HeightfieldShapeConfiguration&>(*m_shapeConfig.second);
-        if (!configuration.GetSamples().empty())
+        if (!dirtyRegion.IsValid() || !Utils::IsHeightfieldLayoutUnchanged(GetEntityId(), configuration))
+        {
+            return false;
+        }
+
+        AZ::Transform transform = AZ::Transform::CreateIdentity();
+        Physics::HeightfieldProviderRequestsBus::EventResult(
+            transform, GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldTransform);
+        if (!transform.IsClose(m_heightfieldTransform))
+        {
+            return false;
+        }
+
+        size_t startColumn = 0;
+        size_t startRow = 0;
+        size_t numColumns = 0;
+        size_t numRows = 0;
+        Physics::HeightfieldProviderRequestsBus::Event(
+            GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion, dirtyRegion, startColumn,
+            startRow, numColumns, numRows);
+
+        if ((numColumns == 0) || (numRows == 0))
+        {
+            // The dirty region doesn't touch the heightfield, so there's nothing to update.
+            return true;
+        }
+
+        if (IsTiled())
+        {
+            return RefreshTileRegion(dirtyRegion, startColumn, startRow, numColumns, numRows);
+        }
+
+        AZStd::shared_ptr<Physics::Shape> heightfieldShape = GetHeightfieldShape();
+        if (!heightfieldShape || configuration.GetSamples().empty())
+        {
+            return false;
+        }
+
+        Physics::HeightfieldProviderRequestsBus::Event(
+            GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::UpdateHeightsAndMaterials,
+            [&configuration](size_t column, size_t row, const Physics::HeightMaterialPoint& dataPoint)
+            {
+                configuration.ModifySample(column, row, dataPoint);
+            },
+            dirtyRegion);
+
+        if (!Utils::RefreshHeightfieldShape(*heightfieldShape, configuration, startColumn, startRow, numColumns, numRows))
         {
-            InitStaticRigidBody();
+            return false;
         }
 
         Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
+        return true;
+    }
+
+    void HeightfieldColliderComponent::InitTiles()
+    {
+        m_tiles.clear();
+
+        const Physics::HeightfieldShapeConfiguration& configuration =
+            static_cast<const Physics::HeightfieldShapeConfiguration&>(*m_shapeConfig.second);
+        const size_t numColumns = aznumeric_cast<size_t>(AZStd::max(configuration.GetNumColumns(), 0));
+        const size_t numRows = aznumeric_cast<size_t>(AZStd::max(configuration.GetNumRows(), 0));
+        if ((numColumns < 2) || (numRows < 2))
+        {
+            return;
+        }
+
+        AZ::Aabb heightfieldAabb = AZ::Aabb::CreateNull();
+        Physics::HeightfieldProviderRequestsBus::EventResult(
+            heightfieldAabb, GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldAabb);
+        if (!heightfieldAabb.IsValid())
+        {
+            return;
+        }
+
+        const AZ::Vector2& gridSpacing = configuration.GetGridResolution();
+        const size_t tileSize = m_tileStreamingConfig.m_tileSize;
+
+        // Tiles are laid out in quads, and neighboring tiles share the samples along their common edge.
+        const size_t numTileColumns = (numColumns - 2) / tileSize + 1;
+        const size_t numTileRows = (numRows - 2) / tileSize + 1;
+        m_tiles.reserve(numTileColumns * numTileRows);
+
+        for (size_t tileRow = 0; tileRow < numTileRows; tileRow++)
+        {
+            for (size_t tileColumn = 0; tileColumn < numTileColumns; tileColumn++)
+            {
+                HeightfieldTile& tile = m_tiles.emplace_back();
+                tile.m_startColumn = tileColumn * tileSize;
+                tile.m_startRow = tileRow * tileSize;
+                tile.m_numColumns = AZStd::min(tileSize + 1, numColumns - tile.m_startColumn);
+                tile.m_numRows = AZStd::min(tileSize + 1, numRows - tile.m_startRow);
+
+                const AZ::Vector3 tileMin = heightfieldAabb.GetMin() +
+                    AZ::Vector3(tile.m_startColumn * gridSpacing.GetX(), tile.m_startRow * gridSpacing.GetY(), 0.0f);
+                const AZ::Vector3 tileSpan(
+                    (tile.m_numColumns - 1) * gridSpacing.GetX(), (tile.m_numRows - 1) * gridSpacing.GetY(),
+                    heightfieldAabb.GetZExtent());
+                tile.m_bounds = AZ::Aabb::CreateFromMinMax(tileMin, tileMin + tileSpan);
+            }
+        }
+    }
+
+    void HeightfieldColliderComponent::ClearTiles()
+    {
+        for (HeightfieldTile& tile : m_tiles)
+        {
+            UnloadTile(tile);
+        }
+        m_tiles.clear();
+        m_tileStreamingPending = false;
+    }
+
+    void HeightfieldColliderComponent::UpdateTileStreaming(bool loadAllTiles)
+    {
+        AZ::Vector3 cameraPosition = AZ::Vector3::CreateZero();
+        const bool hasCamera = GetActiveCameraPosition(cameraPosition);
+        m_lastStreamingPosition = cameraPosition;
+
+        // Tiles are kept a bit past the streaming distance before being removed, so that a camera moving back and forth across
+        // the streaming distance doesn't keep adding and removing the same tiles.
+        const Physics::HeightfieldShapeConfiguration& configuration =
+            static_cast<const Physics::HeightfieldShapeConfiguration&>(*m_shapeConfig.second);
+        const AZ::Vector2& gridSpacing = configuration.GetGridResolution();
+        const float loadDistance = m_tileStreamingConfig.m_streamingDistance;
+        const float unloadDistance =
+            loadDistance + (0.5f * m_tileStreamingConfig.m_tileSize * AZ::GetMax(gridSpacing.GetX(), gridSpacing.GetY()));
+
+        size_t numTilesLoaded = 0;
+        bool tilesChanged = false;
+        m_tileStreamingPending = false;
+
+        for (HeightfieldTile& tile : m_tiles)
+        {
+            const float distance = hasCamera ? tile.m_bounds.GetDistance(cameraPosition) : 0.0f;
+            const bool isLoaded = (tile.m_staticRigidBodyHandle != AzPhysics::InvalidSimulatedBodyHandle);
+
+            if (isLoaded && (distance > unloadDistance))
+            {
+                UnloadTile(tile);
+                tilesChanged = true;
+            }
+            else if (!isLoaded && (distance <= loadDistance))
+            {
+                if (loadAllTiles || (numTilesLoaded < MaxTileLoadsPerTick))
+                {
+                    LoadTile(tile);
+                    numTilesLoaded++;
+                    tilesChanged = true;
+                }
+                else
+                {
+                    m_tileStreamingPending = true;
+                }
+            }
+        }
+
+        // The initial refresh sends its own notification once the heightfield is set up.
+        if (tilesChanged && !loadAllTiles)
+        {
+            Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
+        }
+    }
+
+    void HeightfieldColliderComponent::LoadTile(HeightfieldTile& tile)
+    {
+        // Each tile is a standalone heightfield with the same spacing and height bounds as the full heightfield.
+        const Physics::HeightfieldShapeConfiguration& configuration =
+            static_cast<const Physics::HeightfieldShapeConfiguration&>(*m_shapeConfig.second);
+        tile.m_shapeConfig = AZStd::make_shared<Physics::HeightfieldShapeConfiguration>(configuration);
+        tile.m_shapeConfig->SetNumColumns(aznumeric_cast<int32_t>(tile.m_numColumns));
+        tile.m_shapeConfig->SetNumRows(aznumeric_cast<int32_t>(tile.m_numRows));
+        tile.m_shapeConfig->SetSamples(AZStd::vector<Physics::HeightMaterialPoint>(tile.m_numColumns * tile.m_numRows));
+
+        Physics::HeightfieldShapeConfiguration& tileConfig = *tile.m_shapeConfig;
+        Physics::HeightfieldProviderRequestsBus::Event(
+            GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::UpdateHeightsAndMaterials,
+            [&tile, &tileConfig](size_t column, size_t row, const Physics::HeightMaterialPoint& dataPoint)
+            {
+                if ((column >= tile.m_startColumn) && (column < tile.m_startColumn + tile.m_numColumns) &&
+                    (row >= tile.m_startRow) && (row < tile.m_startRow + tile.m_numRows))
+                {
+                    tileConfig.ModifySample(column - tile.m_startColumn, row - tile.m_startRow, dataPoint);
+                }
+            },
+            tile.m_bounds);
+
+        // The heightfield shape is centered on its body, so place the body at the center of the tile within the full heightfield.
+        const AZ::Vector2& gridSpacing = configuration.GetGridResolution();
+        const AZ::Vector3 tileCenter(
+            (tile.m_startColumn + (tile.m_numColumns / 2.0f) - (configuration.GetNumColumns() / 2.0f)) * gridSpacing.GetX(),
+            (tile.m_startRow + (tile.m_numRows / 2.0f) - (configuration.GetNumRows() / 2.0f)) * gridSpacing.GetY(),
+            0.0f);
+
+        AzPhysics::StaticRigidBodyConfiguration bodyConfiguration;
+        bodyConfiguration.m_orientation = m_heightfieldTransform.GetRotation();
+        bodyConfiguration.m_position = m_heightfieldTransform.TransformPoint(tileCenter);
+        bodyConfiguration.m_entityId = GetEntityId();
+        bodyConfiguration.m_debugName = GetEntity()->GetName();
+        bodyConfiguration.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(m_shapeConfig.first, tile.m_shapeConfig);
+
+        if (m_attachedSceneHandle == AzPhysics::InvalidSceneHandle)
+        {
+            Physics::DefaultWorldBus::BroadcastResult(m_attachedSceneHandle, &Physics::DefaultWorldRequests::GetDefaultSceneHandle);
+        }
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (!sceneInterface)
+        {
+            return;
+        }
+
+        tile.m_staticRigidBodyHandle = sceneInterface->AddSimulatedBody(m_attachedSceneHandle, &bodyConfiguration);
+        if (tile.m_staticRigidBodyHandle == AzPhysics::InvalidSimulatedBodyHandle)
+        {
+            return;
+        }
+
+        if (!m_tilePhysicsEnabled)
+        {
+            sceneInterface->DisableSimulationOfBody(m_attachedSceneHandle, tile.m_staticRigidBodyHandle);
+        }
+
+        // Collision filtering changes made at runtime are applied to the simulated tiles, so carry them over to the new tile.
+        AZStd::shared_ptr<Physics::Shape> tileShape = GetTileShape(tile);
+        for (const HeightfieldTile& otherTile : m_tiles)
+        {
+            if ((&otherTile == &tile) || (otherTile.m_staticRigidBodyHandle == AzPhysics::InvalidSimulatedBodyHandle))
+            {
+                continue;
+            }
+            if (AZStd::shared_ptr<Physics::Shape> otherShape = GetTileShape(otherTile); otherShape && tileShape)
+            {
+                tileShape->SetCollisionLayer(otherShape->GetCollisionLayer());
+                tileShape->SetCollisionGroup(otherShape->GetCollisionGroup());
+            }
+            break;
+        }
+    }
+
+    void HeightfieldColliderComponent::UnloadTile(HeightfieldTile& tile)
+    {
+        // Same as ClearHeightfield, the simulated body needs to be removed before the cached heightfield can be released.
+        if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+            sceneInterface && tile.m_staticRigidBodyHandle != AzPhysics::InvalidSimulatedBodyHandle)
+        {
+            sceneInterface->RemoveSimulatedBody(m_attachedSceneHandle, tile.m_staticRigidBodyHandle);
+        }
+        tile.m_staticRigidBodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+
+        if (tile.m_shapeConfig)
+        {
+            tile.m_shapeConfig->SetCachedNativeHeightfield(nullptr);
+            tile.m_shapeConfig.reset();
+        }
+    }
+
+    bool HeightfieldColliderComponent::RefreshTileRegion(
+        const AZ::Aabb& dirtyRegion, size_t startColumn, size_t startRow, size_t numColumns, size_t numRows)
+    {
+        // Tiles that aren't simulated will pick up the new data when they get loaded, so only the simulated tiles need updating.
+        AZStd::vector<HeightfieldTile*> dirtyTiles;
+        for (HeightfieldTile& tile : m_tiles)
+        {
+            if (tile.m_shapeConfig && (tile.m_startColumn < startColumn + numColumns) &&
+                (startColumn < tile.m_startColumn + tile.m_numColumns) && (tile.m_startRow < startRow + numRows) &&
+                (startRow < tile.m_startRow + tile.m_numRows))
+            {
+                dirtyTiles.push_back(&tile);
+            }
+        }
+
+        if (dirtyTiles.empty())
+        {
+            return true;
+        }
+
+        // Samples on the shared edges belong to more than one tile.
+        Physics::HeightfieldProviderRequestsBus::Event(
+            GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::UpdateHeightsAndMaterials,
+            [&dirtyTiles](size_t column, size_t row, const Physics::HeightMaterialPoint& dataPoint)
+            {
+                for (HeightfieldTile* tile : dirtyTiles)
+                {
+                    if ((column >= tile->m_startColumn) && (column < tile->m_startColumn + tile->m_numColumns) &&
+                        (row >= tile->m_startRow) && (row < tile->m_startRow + tile->m_numRows))
+                    {
+                        tile->m_shapeConfig->ModifySample(column - tile->m_startColumn, row - tile->m_startRow, dataPoint);
+                    }
+                }
+            },
+            dirtyRegion);
+
+        for (HeightfieldTile* tile : dirtyTiles)
+        {
+            const size_t firstColumn = AZStd::max(startColumn, tile->m_startColumn);
+            const size_t firstRow = AZStd::max(startRow, tile->m_startRow);
+            const size_t lastColumn = AZStd::min(startColumn + numColumns, tile->m_startColumn + tile->m_numColumns);
+            const size_t lastRow = AZStd::min(startRow + numRows, tile->m_startRow + tile->m_numRows);
+
+            AZStd::shared_ptr<Physics::Shape> tileShape = GetTileShape(*tile);
+            if (!tileShape ||
+                !Utils::RefreshHeightfieldShape(
+                    *tileShape, *tile->m_shapeConfig, firstColumn - tile->m_startColumn, firstRow - tile->m_startRow,
+                    lastColumn - firstColumn, lastRow - firstRow))
+            {
+                UnloadTile(*tile);
+                LoadTile(*tile);
+            }
+        }
+
+        Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
+        return true;
     }
 
     void HeightfieldColliderComponent::SetShapeConfiguration(const AzPhysics::ShapeColliderPair& shapeConfig)
@@ -172,9 +597,37 @@ namespace PhysX
         m_shapeConfig = shapeConfig;
     }
 
+    void HeightfieldColliderComponent::SetTileStreamingConfiguration(const HeightfieldTileStreamingConfiguration& tileStreamingConfig)
+    {
+        if (GetEntity()->GetState() == AZ::Entity::State::Active)
+        {
+            AZ_Warning(
+                "PhysX", false, "Trying to call SetTileStreamingConfiguration for entity \"%s\" while entity is active.",
+                GetEntity()->GetName().c_str());
+            return;
+        }
+        m_tileStreamingConfig = tileStreamingConfig;
+    }
+
     // SimulatedBodyComponentRequestsBus
     void HeightfieldColliderComponent::EnablePhysics()
     {
+        if (IsTiled())
+        {
+            m_tilePhysicsEnabled = true;
+            if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+            {
+                for (const HeightfieldTile& tile : m_tiles)
+                {
+                    if (tile.m_staticRigidBodyHandle != AzPhysics::InvalidSimulatedBodyHandle)
+                    {
+                        sceneInterface->EnableSimulationOfBody(m_attachedSceneHandle, tile.m_staticRigidBodyHandle);
+                    }
+                }
+            }
+            return;
+        }
+
         if (IsPhysicsEnabled())
         {
             return;
@@ -188,6 +641,22 @@ namespace PhysX
     // SimulatedBodyComponentRequestsBus
     void HeightfieldColliderComponent::DisablePhysics()
     {
+        if (IsTiled())
+        {
+            m_tilePhysicsEnabled = false;
+            if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+            {
+                for (const HeightfieldTile& tile : m_tiles)
+                {
+                    if (tile.m_staticRigidBodyHandle != AzPhysics::InvalidSimulatedBodyHandle)
+                    {
+                        sceneInterface->DisableSimulationOfBody(m_attachedSceneHandle, tile.m_staticRigidBodyHandle);
+                    }
+                }
+            }
+            return;
+        }
+
         if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
         {
             sceneInterface->DisableSimulationOfBody(m_attachedSceneHandle, m_staticRigidBodyHandle);
@@ -197,6 +666,24 @@ namespace PhysX
     // SimulatedBodyComponentRequestsBus
     bool HeightfieldColliderComponent::IsPhysicsEnabled() const
     {
+        if (IsTiled())
+        {
+            auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+            if (!m_tilePhysicsEnabled || !sceneInterface || !sceneInterface->IsEnabled(m_attachedSceneHandle))
+            {
+                return false;
+            }
+            for (const HeightfieldTile& tile : m_tiles)
+            {
+                if (AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(m_attachedSceneHandle, tile.m_staticRigidBodyHandle);
+                    body && body->m_simulating)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         if (m_staticRigidBodyHandle != AzPhysics::InvalidSimulatedBodyHandle)
         {
             if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
@@ -215,6 +702,7 @@ namespace PhysX
     // SimulatedBodyComponentRequestsBus
     AzPhysics::SimulatedBodyHandle HeightfieldColliderComponent::GetSimulatedBodyHandle() const
     {
+        // A tiled heightfield has one simulated body per tile, and m_staticRigidBodyHandle stays invalid.
         return m_staticRigidBodyHandle;
     }
 
@@ -231,6 +719,28 @@ namespace PhysX
     // SimulatedBodyComponentRequestsBus
     AzPhysics::SceneQueryHit HeightfieldColliderComponent::RayCast(const AzPhysics::RayCastRequest& request)
     {
+        if (IsTiled())
+        {
+            // Return the closest hit across all of the simulated tiles.
+            AzPhysics::SceneQueryHit closestHit;
+            if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+            {
+                for (const HeightfieldTile& tile : m_tiles)
+                {
+                    if (auto* body = azdynamic_cast<PhysX::StaticRigidBody*>(
+                            sceneInterface->GetSimulatedBodyFromHandle(m_attachedSceneHandle, tile.m_staticRigidBodyHandle)))
+                    {
+                        if (AzPhysics::SceneQueryHit hit = body->RayCast(request);
+                            hit && (!closestHit || (hit.m_distance < closestHit.m_distance)))
+                        {
+                            closestHit = hit;
+                        }
+                    }
+                }
+            }
+            return closestHit;
+        }
+
         if (auto* body = azdynamic_cast<PhysX::StaticRigidBody*>(GetSimulatedBody()))
         {
             return body->RayCast(request);
@@ -245,6 +755,21 @@ namespace PhysX
         return shapeConfigurationList;
     }
 
+    AZStd::shared_ptr<Physics::Shape> HeightfieldColliderComponent::GetTileShape(const HeightfieldTile& tile)
+    {
+        if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+        {
+            if (auto* body = azdynamic_cast<PhysX::StaticRigidBody*>(
+                    sceneInterface->GetSimulatedBodyFromHandle(m_attachedSceneHandle, tile.m_staticRigidBodyHandle)))
+            {
+                AZ_Assert(body->GetShapeCount() == 1, "Heightfield tile has the wrong number of shapes:  %zu", body->GetShapeCount());
+                return body->GetShape(0);
+            }
+        }
+
+        return {};
+    }
+
     AZStd::shared_ptr<Physics::Shape> HeightfieldColliderComponent::GetHeightfieldShape()
     {
         if (auto* body = azdynamic_cast<PhysX::StaticRigidBody*>(GetSimulatedBody()))
@@ -260,6 +785,19 @@ namespace PhysX
     // ColliderComponentRequestBus
     AZStd::vector<AZStd::shared_ptr<Physics::Shape>> HeightfieldColliderComponent::GetShapes()
     {
+        if (IsTiled())
+        {
+            AZStd::vector<AZStd::shared_ptr<Physics::Shape>> shapes;
+            for (const HeightfieldTile& tile : m_tiles)
+            {
+                if (AZStd::shared_ptr<Physics::Shape> tileShape = GetTileShape(tile))
+                {
+                    shapes.push_back(tileShape);
+                }
+            }
+            return shapes;
+        }
+
         return { GetHeightfieldShape() };
     }
 
@@ -280,6 +818,19 @@ namespace PhysX
         // On the SimulatedBodyComponentRequestsBus, get the AABB from the simulated body instead of the collider.
         if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
         {
+            if (IsTiled())
+            {
+                AZ::Aabb tilesAabb = AZ::Aabb::CreateNull();
+                for (const HeightfieldTile& tile : m_tiles)
+                {
+                    if (AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(m_attachedSceneHandle, tile.m_staticRigidBodyHandle))
+                    {
+                        tilesAabb.AddAabb(body->GetAabb());
+                    }
+                }
+                return tilesAabb;
+            }
+
             if (AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(m_attachedSceneHandle, m_staticRigidBodyHandle))
             {
                 return body->GetAabb();
@@ -291,18 +842,19 @@ namespace PhysX
     // CollisionFilteringRequestBus
     void HeightfieldColliderComponent::SetCollisionLayer(const AZStd::string& layerName, AZ::Crc32 colliderTag)
     {
-        if (auto heightfield = GetHeightfieldShape())
+        bool success = false;
+        AzPhysics::CollisionLayer layer;
+        Physics::CollisionRequestBus::BroadcastResult(success, &Physics::CollisionRequests::TryGetCollisionLayerByName, layerName, layer);
+        if (!success)
         {
-            if (Physics::Utils::FilterTag(heightfield->GetTag(), colliderTag))
+            return;
+        }
+
+        for (auto& heightfield : GetShapes())
+        {
+            if (heightfield && Physics::Utils::FilterTag(heightfield->GetTag(), colliderTag))
             {
-                bool success = false;
-                AzPhysics::CollisionLayer layer;
-                Physics::CollisionRequestBus::BroadcastResult(
-                    success, &Physics::CollisionRequests::TryGetCollisionLayerByName, layerName, layer);
-                if (success)
-                {
-                    heightfield->SetCollisionLayer(layer);
-                }
+                heightfield->SetCollisionLayer(layer);
             }
         }
     }
@@ -310,11 +862,12 @@ namespace PhysX
     // CollisionFilteringRequestBus
     AZStd::string HeightfieldColliderComponent::GetCollisionLayerName()
     {
+        // All tiles of a tiled heightfield share the same collision filtering, so the first shape is representative.
         AZStd::string layerName;
-        if (auto heightfield = GetHeightfieldShape())
+        if (auto shapes = GetShapes(); !shapes.empty() && shapes.front())
         {
             Physics::CollisionRequestBus::BroadcastResult(
-                layerName, &Physics::CollisionRequests::GetCollisionLayerName, heightfield->GetCollisionLayer());
+                layerName, &Physics::CollisionRequests::GetCollisionLayerName, shapes.front()->GetCollisionLayer());
         }
         return layerName;
     }
@@ -322,18 +875,19 @@ namespace PhysX
     // CollisionFilteringRequestBus
     void HeightfieldColliderComponent::SetCollisionGroup(const AZStd::string& groupName, AZ::Crc32 colliderTag)
     {
-        if (auto heightfield = GetHeightfieldShape())
+        bool success = false;
+        AzPhysics::CollisionGroup group;
+        Physics::CollisionRequestBus::BroadcastResult(success, &Physics::CollisionRequests::TryGetCollisionGroupByName, groupName, group);
+        if (!success)
+        {
+            return;
+        }
+
+        for (auto& heightfield : GetShapes())
         {
-            if (Physics::Utils::FilterTag(heightfield->GetTag(), colliderTag))
+            if (heightfield && Physics::Utils::FilterTag(heightfield->GetTag(), colliderTag))
             {
-                bool success = false;
-                AzPhysics::CollisionGroup group;
-                Physics::CollisionRequestBus::BroadcastResult(
-                    success, &Physics::CollisionRequests::TryGetCollisionGroupByName, groupName, group);
-                if (success)
-                {
-                    heightfield->SetCollisionGroup(group);
-                }
+                heightfield->SetCollisionGroup(group);
             }
         }
     }
@@ -342,10 +896,10 @@ namespace PhysX
     AZStd::string HeightfieldColliderComponent::GetCollisionGroupName()
     {
         AZStd::string groupName;
-        if (auto heightfield = GetHeightfieldShape())
+        if (auto shapes = GetShapes(); !shapes.empty() && shapes.front())
         {
             Physics::CollisionRequestBus::BroadcastResult(
-                groupName, &Physics::CollisionRequests::GetCollisionGroupName, heightfield->GetCollisionGroup());
+                groupName, &Physics::CollisionRequests::GetCollisionGroupName, shapes.front()->GetCollisionGroup());
         }
 
         return groupName;
@@ -354,20 +908,21 @@ namespace PhysX
     // CollisionFilteringRequestBus
     void HeightfieldColliderComponent::ToggleCollisionLayer(const AZStd::string& layerName, AZ::Crc32 colliderTag, bool enabled)
     {
-        if (auto heightfield = GetHeightfieldShape())
+        bool success = false;
+        AzPhysics::CollisionLayer layer;
+        Physics::CollisionRequestBus::BroadcastResult(success, &Physics::CollisionRequests::TryGetCollisionLayerByName, layerName, layer);
+        if (!success)
+        {
+            return;
+        }
+
+        for (auto& heightfield : GetShapes())
         {
-            if (Physics::Utils::FilterTag(heightfield->GetTag(), colliderTag))
+            if (heightfield && Physics::Utils::FilterTag(heightfield->GetTag(), colliderTag))
             {
-                bool success = false;
-                AzPhysics::CollisionLayer layer;
-                Physics::CollisionRequestBus::BroadcastResult(
-                    success, &Physics::CollisionRequests::TryGetCollisionLayerByName, layerName, layer);
-                if (success)
-                {
-                    auto group = heightfield->GetCollisionGroup();
-                    group.SetLayer(layer, enabled);
-                    heightfield->SetCollisionGroup(group);
-                }
+                auto group = heightfield->GetCollisionGroup();
+                group.SetLayer(layer, enabled);
+                heightfield->SetCollisionGroup(group);
             }
         }
     }
@@ -9,6 +9,8 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Transform.h>
 
 #include <AzFramework/Physics/CollisionBus.h>
 #include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
@@ -26,6 +28,24 @@ namespace PhysX
 {
     class StaticRigidBody;
 
+    //! Settings for splitting a heightfield collider into tiles, so that huge heightfields don't need to be simulated all at once.
+    //! Each tile is a separate heightfield, which gets added to the simulation when it's close enough to the active camera.
+    class HeightfieldTileStreamingConfiguration
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(HeightfieldTileStreamingConfiguration, AZ::SystemAllocator, 0);
+        AZ_TYPE_INFO(HeightfieldTileStreamingConfiguration, "{5A2D9E3C-7B41-4F6A-9C8E-1D3B6F0A4E27}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Split the heightfield into tiles instead of creating a single heightfield.
+        bool m_enabled = false;
+        //! The number of heightfield quads along each side of a tile.
+        AZ::u32 m_tileSize = 256;
+        //! Tiles within this distance of the active camera are added to the simulation.
+        //! If there isn't an active camera, such as on a dedicated server, all of the tiles get added.
+        float m_streamingDistance = 512.0f;
+    };
+
     //! Component that provides a Heightfield Collider and associated Static Rigid Body.
     //! The heightfield collider is a bit different from the other shape colliders in that it gets the heightfield data from a
     //! HeightfieldProvider, which can control position, rotation, size, and even change its data at runtime.
@@ -39,6 +59,7 @@ namespace PhysX
         , protected PhysX::ColliderShapeRequestBus::Handler
         , protected Physics::CollisionFilteringRequestBus::Handler
         , protected Physics::HeightfieldProviderNotificationBus::Handler
+        , protected AZ::TickBus::Handler
     {
     public:
         using Configuration = Physics::HeightfieldShapeConfiguration;
@@ -56,6 +77,7 @@ namespace PhysX
         void Deactivate() override;
 
         void SetShapeConfiguration(const AzPhysics::ShapeColliderPair& shapeConfig);
+        void SetTileStreamingConfiguration(const HeightfieldTileStreamingConfiguration& tileStreamingConfig);
 
     protected:
         // ColliderComponentRequestBus
@@ -78,6 +100,7 @@ namespace PhysX
         void ToggleCollisionLayer(const AZStd::string& layerName, AZ::Crc32 filterTag, bool enabled) override;
 
         // SimulatedBodyComponentRequestsBus
+        // When the heightfield is tiled, every tile has its own simulated body, so there's no single simulated body to return.
         void EnablePhysics() override;
         void DisablePhysics() override;
         bool IsPhysicsEnabled() const override;
@@ -87,18 +110,55 @@ namespace PhysX
         AzPhysics::SceneQueryHit RayCast(const AzPhysics::RayCastRequest& request) override;
 
         // HeightfieldProviderNotificationBus
-        void OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion) override;
+        void OnHeightfieldDataChanged(const AZ::Aabb& dirtyRegion) override;
+
+        // TickBus
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
     private:
+        //! A part of a tiled heightfield. The tiles share the samples along their edges, so that there aren't any gaps between them.
+        struct HeightfieldTile
+        {
+            size_t m_startColumn = 0;
+            size_t m_startRow = 0;
+            size_t m_numColumns = 0;
+            size_t m_numRows = 0;
+            //! The region of the heightfield provider covered by the samples of the tile.
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+            //! The samples and native heightfield of the tile, which only exist while the tile is in the simulation.
+            AZStd::shared_ptr<Physics::HeightfieldShapeConfiguration> m_shapeConfig;
+            AzPhysics::SimulatedBodyHandle m_staticRigidBodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+        };
+
         AZStd::shared_ptr<Physics::Shape> GetHeightfieldShape();
+        AZStd::shared_ptr<Physics::Shape> GetTileShape(const HeightfieldTile& tile);
+
+        bool IsTiled() const;
 
         void ClearHeightfield();
         void InitHeightfieldShapeConfiguration();
         void InitStaticRigidBody();
         void RefreshHeightfield();
+        bool RefreshHeightfieldRegion(const AZ::Aabb& dirtyRegion);
+
+        void InitTiles();
+        void ClearTiles();
+        void UpdateTileStreaming(bool loadAllTiles);
+        void LoadTile(HeightfieldTile& tile);
+        void UnloadTile(HeightfieldTile& tile);
+        bool RefreshTileRegion(const AZ::Aabb& dirtyRegion, size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
 
         AzPhysics::ShapeColliderPair m_shapeConfig;
         AzPhysics::SimulatedBodyHandle m_staticRigidBodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
         AzPhysics::SceneHandle m_attachedSceneHandle = AzPhysics::InvalidSceneHandle;
+
+        //! The heightfield transform that the simulated bodies were created with.
+        AZ::Transform m_heightfieldTransform = AZ::Transform::CreateIdentity();
+
+        HeightfieldTileStreamingConfiguration m_tileStreamingConfig;
+        AZStd::vector<HeightfieldTile> m_tiles;
+        AZ::Vector3 m_lastStreamingPosition = AZ::Vector3::CreateZero();
+        bool m_tileStreamingPending = false;
+        bool m_tilePhysicsEnabled = true;
     };
 } // namespace PhysX
@@ -809,4 +809,9 @@ namespace PhysX
     {
         return m_name;
     }
+
+    void RigidBody::RegisterActiveTransformHandler(ActiveTransformEvent::Handler& handler)
+    {
+        handler.Connect(m_activeTransformEvent);
+    }
 }
@@ -10,6 +10,7 @@
 
 #include <PxPhysicsAPI.h>
 #include <Utils.h>
+#include <AzCore/EBus/Event.h>
 #include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
 #include <PhysX/UserDataTypes.h>
@@ -21,6 +22,7 @@ namespace AzPhysics
 
 namespace PhysX
 {
+    class PhysXScene;
     class RigidBodyComponent;
     class Shape;
 
@@ -32,6 +34,7 @@ namespace PhysX
     {
     public:
         friend class RigidBodyComponent;
+        friend class PhysXScene;
 
         AZ_CLASS_ALLOCATOR(RigidBody, AZ::SystemAllocator, 0);
         AZ_RTTI(PhysX::RigidBody, "{30CD41DD-9783-47A1-B935-9E5634238F45}", AzPhysics::RigidBody);
@@ -113,7 +116,12 @@ namespace PhysX
             const AZ::Matrix3x3& inertiaTensorOverride = AZ::Matrix3x3::CreateIdentity(),
             const float massOverride = 1.0f) override;
 
+        //! Signaled by the scene after a simulation step which moved the body, with the new world transform of the body.
+        using ActiveTransformEvent = AZ::Event<const AZ::Transform&>;
+        void RegisterActiveTransformHandler(ActiveTransformEvent::Handler& handler);
+
     private:
+
         void CreatePhysXActor(const AzPhysics::RigidBodyConfiguration& configuration);
 
         void UpdateCenterOfMass(bool includeAllShapesInMassCalculation);
@@ -124,6 +132,7 @@ namespace PhysX
         AZStd::string m_name;
         PhysX::ActorData m_actorUserData;
         bool m_startAsleep = false;
+        ActiveTransformEvent m_activeTransformEvent;
     };
 
     AZ_POP_DISABLE_WARNING
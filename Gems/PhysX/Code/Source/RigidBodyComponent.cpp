@@ -184,6 +184,7 @@ namespace PhysX
         AzPhysics::SimulatedBodyComponentRequestsBus::Handler::BusDisconnect();
         AZ::TransformNotificationBus::MultiHandler::BusDisconnect();
         m_sceneFinishSimHandler.Disconnect();
+        m_activeTransformHandler.Disconnect();
         AZ::TickBus::Handler::BusDisconnect();
     }
 
@@ -214,6 +215,11 @@ namespace PhysX
             {
                 this->PostPhysicsTick(fixedDeltatime);
             }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics));
+
+        m_activeTransformHandler = RigidBody::ActiveTransformEvent::Handler([this](const AZ::Transform& transform)
+            {
+                this->OnActiveTransform(transform);
+            });
     }
 
     void RigidBodyComponent::PostPhysicsTick(float fixedDeltaTime)
@@ -256,6 +262,23 @@ namespace PhysX
         m_isLastMovementFromKinematicSource = false;
     }
 
+    void RigidBodyComponent::OnActiveTransform(const AZ::Transform& transform)
+    {
+        // Only called for bodies moved by the simulation, the same rules as PostPhysicsTick apply.
+        if (!IsPhysicsEnabled() || (IsKinematic() && !m_isLastMovementFromKinematicSource))
+        {
+            return;
+        }
+
+        // Move the entity with a single transform update, keeping its current scale.
+        float worldUniformScale = 1.0f;
+        AZ::TransformBus::EventResult(worldUniformScale, GetEntityId(), &AZ::TransformInterface::GetWorldUniformScale);
+        AZ::Transform worldTransform = transform;
+        worldTransform.SetUniformScale(worldUniformScale);
+        AZ::TransformBus::Event(GetEntityId(), &AZ::TransformInterface::SetWorldTM, worldTransform);
+        m_isLastMovementFromKinematicSource = false;
+    }
+
     void RigidBodyComponent::OnTransformChanged([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
     {
         // Note: OnTransformChanged is not safe at the moment due to TransformComponent design flaw.
@@ -301,7 +324,18 @@ namespace PhysX
         // Listen to the PhysX system for events concerning this entity.
         if (sceneInterface != nullptr)
         {
-            sceneInterface->RegisterSceneSimulationFinishHandler(m_attachedSceneHandle, m_sceneFinishSimHandler);
+            auto* rigidBody = azrtti_cast<RigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(m_attachedSceneHandle, m_rigidBodyHandle));
+            if (rigidBody && !m_configuration.m_interpolateMotion)
+            {
+                // The scene writes back the transforms of the bodies moved by the simulation in bulk, so sleeping bodies cost nothing
+                // when the scene tracks its active actors.
+                rigidBody->RegisterActiveTransformHandler(m_activeTransformHandler);
+            }
+            else
+            {
+                // The interpolator needs a target from every simulation step.
+                sceneInterface->RegisterSceneSimulationFinishHandler(m_attachedSceneHandle, m_sceneFinishSimHandler);
+            }
         }
         AZ::TickBus::Handler::BusConnect();
         AZ::TransformNotificationBus::MultiHandler::BusConnect(GetEntityId());
@@ -17,6 +17,7 @@
 #include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
 #include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 #include <AzFramework/Entity/SliceGameEntityOwnershipServiceBus.h>
+#include <Source/RigidBody.h>
 
 namespace AzPhysics
 {
@@ -148,6 +149,7 @@ namespace PhysX
         void CreatePhysics();
         void InitPhysicsTickHandler();
         void PostPhysicsTick(float fixedDeltaTime);
+        void OnActiveTransform(const AZ::Transform& transform);
 
         const AzPhysics::RigidBody* GetRigidBodyConst() const;
 
@@ -161,7 +163,8 @@ namespace PhysX
         bool m_isLastMovementFromKinematicSource = false; ///< True when the source of the movement comes from SetKinematicTarget as opposed to coming from a Transform change
         bool m_rigidBodyTransformNeedsUpdateOnPhysReEnable = false; ///< True if rigid body transform needs to be synced to the entity's when physics is re-enabled
 
-        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_sceneFinishSimHandler;
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_sceneFinishSimHandler; ///< Used with motion interpolation only.
+        RigidBody::ActiveTransformEvent::Handler m_activeTransformHandler; ///< Receives the transform when the simulation moved the body.
     };
 
     class TransformForwardTimeInterpolator
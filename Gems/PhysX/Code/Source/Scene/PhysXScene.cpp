@@ -24,6 +24,11 @@
 #include <Joint/PhysXJoint.h>
 
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -43,6 +48,29 @@ namespace PhysX
 
     namespace Internal
     {
+        //! Batches smaller than this are run on the calling thread, the cost of dispatching them to workers would outweigh the gain.
+        static constexpr size_t MinParallelQueryBatchSize = 64;
+        //! Number of requests run by each worker task of a parallel batch.
+        static constexpr size_t QueriesPerTask = 32;
+
+        //! Copies a request so that it outlives the call which queued it.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> CloneSceneQueryRequest(const AzPhysics::SceneQueryRequest* request)
+        {
+            if (const auto* raycastRequest = azrtti_cast<const AzPhysics::RayCastRequest*>(request))
+            {
+                return AZStd::make_shared<AzPhysics::RayCastRequest>(*raycastRequest);
+            }
+            else if (const auto* shapecastRequest = azrtti_cast<const AzPhysics::ShapeCastRequest*>(request))
+            {
+                return AZStd::make_shared<AzPhysics::ShapeCastRequest>(*shapecastRequest);
+            }
+            else if (const auto* overlapRequest = azrtti_cast<const AzPhysics::OverlapRequest*>(request))
+            {
+                return AZStd::make_shared<AzPhysics::OverlapRequest>(*overlapRequest);
+            }
+            return nullptr;
+        }
+
         physx::PxScene* CreatePxScene(const AzPhysics::SceneConfiguration& config,
             SceneSimulationFilterCallback* filterCallback,
             SceneSimulationEventCallback* simEventCallback)
@@ -495,6 +523,16 @@ namespace PhysX
     {
         m_physicsSystemConfigChanged.Disconnect();
 
+        // Scenes are simulated concurrently, so this scene can be removed by the events of another scene while it is
+        // still simulating.
+        if (m_isSimulating)
+        {
+            m_pxScene->checkResults(true);
+            PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+            m_pxScene->fetchResults(true);
+            m_isSimulating = false;
+        }
+
         s_overlapBuffer.swap({});
         s_rayCastBuffer.swap({});
         s_sweepBuffer.swap({});
@@ -547,15 +585,15 @@ namespace PhysX
 
         PHYSX_SCENE_WRITE_LOCK(m_pxScene);
         m_pxScene->simulate(deltatime);
+        m_isSimulating = true;
     }
 
-    void PhysXScene::FinishSimulation()
+    bool PhysXScene::FetchSimulationResults()
     {
-        AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
-
-        if (!IsEnabled())
+        // A started simulation is finished even if the scene was disabled since, the PhysX scene must not be left simulating.
+        if (!m_isSimulating)
         {
-            return;
+            return false;
         }
 
         {
@@ -569,46 +607,138 @@ namespace PhysX
             m_pxScene->checkResults(true);
         }
 
-        bool activeActorsEnabled = false;
         {
             AZ_PROFILE_SCOPE(Physics, "PhysXScene::FetchResults");
             PHYSX_SCENE_WRITE_LOCK(m_pxScene);
 
-            activeActorsEnabled = m_pxScene->getFlags() & physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
-
             // Swap the buffers, invoke callbacks, build the list of active actors.
             m_pxScene->fetchResults(true);
+            m_isSimulating = false;
         }
 
-        if (activeActorsEnabled)
+        m_hasPendingResults = true;
+        return true;
+    }
+
+    void PhysXScene::FinishSimulation()
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
+
+        FetchSimulationResults();
+        if (!m_hasPendingResults)
         {
-            AZ_PROFILE_SCOPE(Physics, "PhysXScene::ActiveActors");
+            return;
+        }
+        m_hasPendingResults = false;
 
+        CollectActiveBodyTransforms();
+
+        FlushQueuedEvents();
+        // Bodies removed while the events were flushed are deleted afterwards, so their pointers are still valid here.
+        WriteBackActiveBodyTransforms();
+        ClearDeferedDeletions();
+        ProcessAsyncQueries();
+
+        {
+            AZ_PROFILE_SCOPE(Physics, "OnSceneSimulationFinishedEvent::Signaled");
+            m_sceneSimuationFinishEvent.Signal(m_sceneHandle, m_currentDeltaTime);
+        }
+
+        UpdateAzProfilerDataPoints();
+    }
+
+    void PhysXScene::CollectActiveBodyTransforms()
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::ActiveActors");
+
+        m_activeBodyTransforms.clear();
+
+        // Read the poses while the actors are guaranteed to be alive, the events flushed afterwards may remove bodies.
+        auto addActiveBodyTransform = [this](const physx::PxRigidActor* rigidActor, const ActorData* actorData)
+        {
+            if (actorData->GetRigidBody() != nullptr)
+            {
+                m_activeBodyTransforms.push_back({ actorData->GetBodyHandle(), actorData->GetEntityId(),
+                    PxMathConvert(rigidActor->getGlobalPose()), static_cast<RigidBody*>(actorData->GetRigidBody()) });
+            }
+        };
+
+        if (!m_config.m_enableActiveActors)
+        {
+            // Without the active actor list, every awake rigid body is written back.
+            PHYSX_SCENE_READ_LOCK(m_pxScene);
+            for (const auto& [crc, simulatedBody] : m_simulatedBodies)
+            {
+                auto* rigidBody = azrtti_cast<RigidBody*>(simulatedBody);
+                if (rigidBody == nullptr || !rigidBody->m_simulating)
+                {
+                    continue;
+                }
+
+                auto* pxRigidDynamic = static_cast<physx::PxRigidDynamic*>(rigidBody->GetNativePointer());
+                if (pxRigidDynamic == nullptr || pxRigidDynamic->isSleeping())
+                {
+                    continue;
+                }
+
+                if (const ActorData* actorData = Utils::GetUserData(pxRigidDynamic))
+                {
+                    addActiveBodyTransform(pxRigidDynamic, actorData);
+                }
+            }
+            return;
+        }
+
+        AzPhysics::SimulatedBodyHandleList activeBodyHandles;
+        {
             PHYSX_SCENE_READ_LOCK(m_pxScene);
 
             physx::PxU32 numActiveActors = 0;
             physx::PxActor** activeActors = m_pxScene->getActiveActors(numActiveActors);
-            AzPhysics::SimulatedBodyHandleList activeBodyHandles;
+            m_activeBodyTransforms.reserve(numActiveActors);
             activeBodyHandles.reserve(numActiveActors);
+
             for (physx::PxU32 i = 0; i < numActiveActors; ++i)
             {
-                if (ActorData* actorData = Utils::GetUserData(activeActors[i]))
+                if (const ActorData* actorData = Utils::GetUserData(activeActors[i]))
                 {
                     activeBodyHandles.emplace_back(actorData->GetBodyHandle());
+                    addActiveBodyTransform(static_cast<physx::PxRigidActor*>(activeActors[i]), actorData);
                 }
             }
-            m_sceneActiveSimulatedBodies.Signal(m_sceneHandle, activeBodyHandles);
         }
+        m_sceneActiveSimulatedBodies.Signal(m_sceneHandle, activeBodyHandles);
+    }
 
-        FlushQueuedEvents();
-        ClearDeferedDeletions();
+    void PhysXScene::WriteBackActiveBodyTransforms()
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::WriteBackActiveBodyTransforms");
 
+        if (m_activeBodyTransforms.empty())
         {
-            AZ_PROFILE_SCOPE(Physics, "OnSceneSimulationFinishedEvent::Signaled");
-            m_sceneSimuationFinishEvent.Signal(m_sceneHandle, m_currentDeltaTime);
+            return;
         }
 
-        UpdateAzProfilerDataPoints();
+        m_sceneActiveBodyTransformsEvent.Signal(m_sceneHandle, m_activeBodyTransforms);
+
+        for (const ActiveBodyTransform& activeBody : m_activeBodyTransforms)
+        {
+            // Bodies removed or disabled while the collision and trigger events were flushed are no longer simulating.
+            if (activeBody.m_rigidBody->m_simulating)
+            {
+                activeBody.m_rigidBody->m_activeTransformEvent.Signal(activeBody.m_transform);
+            }
+        }
+    }
+
+    void PhysXScene::RegisterSceneActiveBodyTransformsHandler(OnSceneActiveBodyTransformsEvent::Handler& handler)
+    {
+        handler.Connect(m_sceneActiveBodyTransformsEvent);
+    }
+
+    const PhysXScene::ActiveBodyTransformList& PhysXScene::GetActiveBodyTransforms() const
+    {
+        return m_activeBodyTransforms;
     }
 
     void PhysXScene::FlushQueuedEvents()
@@ -639,6 +769,12 @@ namespace PhysX
     {
         if (m_config != config)
         {
+            if (m_pxScene && m_config.m_enableActiveActors != config.m_enableActiveActors)
+            {
+                PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+                m_pxScene->setFlag(physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS, config.m_enableActiveActors);
+            }
+
             m_config = config;
             m_configChangeEvent.Signal(m_sceneHandle, m_config);
 
@@ -952,26 +1088,141 @@ namespace PhysX
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
         AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        QuerySceneBatchInternal(requests, results);
+        return results;
+    }
+
+    void PhysXScene::QuerySceneBatchInternal(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::QuerySceneBatch");
+
+        // Every task writes the hits of its requests in place, so the results are allocated up front.
+        results.clear();
+        results.resize(requests.size());
+
+        // The scene is locked once per range of requests rather than once per request.
+        auto queryRange = [this, &requests, &results](size_t begin, size_t end)
         {
-            results.emplace_back(QueryScene(request.get()));
+            PHYSX_SCENE_READ_LOCK(m_pxScene);
+            for (size_t i = begin; i < end; ++i)
+            {
+                results[i] = QueryScene(requests[i].get());
+            }
+        };
+
+        const size_t taskCount = (requests.size() + Internal::QueriesPerTask - 1) / Internal::QueriesPerTask;
+        auto* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (requests.size() < Internal::MinParallelQueryBatchSize)
+        {
+            queryRange(0, requests.size());
+        }
+        else if (taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            // Waiting on a task graph from within a task is unsupported, so batches issued from a task run on the calling thread.
+            if (AZ::TaskExecutor::Instance().IsTaskWorkerThread())
+            {
+                queryRange(0, requests.size());
+                return;
+            }
+
+            static const AZ::TaskDescriptor queryTaskDescriptor{ "PhysXScene::QuerySceneBatch", "Physics" };
+            AZ::TaskGraph queryTaskGraph;
+            for (size_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+            {
+                queryTaskGraph.AddTask(queryTaskDescriptor, [&queryRange, &requests, taskIndex]()
+                    {
+                        const size_t begin = taskIndex * Internal::QueriesPerTask;
+                        queryRange(begin, AZStd::min(begin + Internal::QueriesPerTask, requests.size()));
+                    });
+            }
+            AZ::TaskGraphEvent queryTaskGraphEvent;
+            queryTaskGraph.Submit(&queryTaskGraphEvent);
+            queryTaskGraphEvent.Wait();
+        }
+        else if (AZ::JobContext::GetGlobalContext())
+        {
+            AZ::parallel_for(size_t(0), taskCount, [&queryRange, &requests](size_t taskIndex)
+                {
+                    const size_t begin = taskIndex * Internal::QueriesPerTask;
+                    queryRange(begin, AZStd::min(begin + Internal::QueriesPerTask, requests.size()));
+                });
+        }
+        else
+        {
+            queryRange(0, requests.size());
         }
-        return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> requestCopy = Internal::CloneSceneQueryRequest(request);
+        if (!requestCopy || !callback)
+        {
+            AZ_Warning("Physx", requestCopy, "Unknown Scene Query request type.");
+            return false;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueriesMutex);
+        m_asyncQueries.push_back({ requestId, { AZStd::move(requestCopy) }, AZStd::move(callback), {} });
+        return true;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (!callback)
+        {
+            return false;
+        }
+
+        // The requests are shared pointers, holding on to them keeps them alive until the queries are run.
+        AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueriesMutex);
+        m_asyncQueries.push_back({ requestId, requests, {}, AZStd::move(callback) });
+        return true;
+    }
+
+    void PhysXScene::ProcessAsyncQueries()
+    {
+        // Queries queued from the callbacks are run at the end of the next simulation.
+        AZStd::vector<AsyncQuery> asyncQueries;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueriesMutex);
+            asyncQueries.swap(m_asyncQueries);
+        }
+
+        if (asyncQueries.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::ProcessAsyncQueries");
+
+        // Run all the queued requests as a single batch so they are spread across the workers together.
+        AzPhysics::SceneQueryRequests requests;
+        for (const AsyncQuery& asyncQuery : asyncQueries)
+        {
+            requests.insert(requests.end(), asyncQuery.m_requests.begin(), asyncQuery.m_requests.end());
+        }
+
+        AzPhysics::SceneQueryHitsList results;
+        QuerySceneBatchInternal(requests, results);
+
+        auto resultIter = results.begin();
+        for (AsyncQuery& asyncQuery : asyncQueries)
+        {
+            const auto queryResultsEnd = resultIter + asyncQuery.m_requests.size();
+            if (asyncQuery.m_callback)
+            {
+                asyncQuery.m_callback(asyncQuery.m_requestId, AZStd::move(*resultIter));
+            }
+            else
+            {
+                asyncQuery.m_batchCallback(asyncQuery.m_requestId,
+                    AzPhysics::SceneQueryHitsList(AZStd::make_move_iterator(resultIter), AZStd::make_move_iterator(queryResultsEnd)));
+            }
+            resultIter = queryResultsEnd;
+        }
     }
 
     void PhysXScene::SuppressCollisionEvents(
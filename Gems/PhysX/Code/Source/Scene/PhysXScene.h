@@ -13,6 +13,9 @@
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
 
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/parallel/mutex.h>
+
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
 
@@ -27,7 +30,17 @@ namespace physx
 
 namespace PhysX
 {
+    class RigidBody;
+
     //! PhysX implementation of the AzPhysics::Scene.
+    //! Large query batches are split across worker threads, so the filter callbacks of batched requests can be invoked concurrently.
+    //! Asynchronous queries are run together at the end of FinishSimulation, once the simulation results have been fetched, and
+    //! their callbacks are invoked on the simulation thread before the OnSceneSimulationFinish event is signaled.
+    //! The transforms of the rigid bodies moved by a simulation step are gathered once, right after the results are fetched,
+    //! and written back through a single batched event followed by the active transform event of each moved body.
+    //! With SceneConfiguration::m_enableActiveActors, only the bodies PhysX reports as active are visited; otherwise every awake
+    //! rigid body is. Each body still updates its entity with its own SetWorldTM: neither the TransformBus nor the render
+    //! transform service have a batched update to forward the list to.
     class PhysXScene
         : public AzPhysics::Scene
     {
@@ -35,6 +48,20 @@ namespace PhysX
         AZ_CLASS_ALLOCATOR_DECL;
         AZ_RTTI(PhysXScene, "{B0FCFDE6-8B59-49D8-8819-E8C2F1EDC182}", AzPhysics::Scene);
 
+        //! World transform of a rigid body moved by the last simulation step.
+        struct ActiveBodyTransform
+        {
+            AzPhysics::SimulatedBodyHandle m_bodyHandle;
+            AZ::EntityId m_entityId;
+            AZ::Transform m_transform;
+            RigidBody* m_rigidBody = nullptr;
+        };
+        using ActiveBodyTransformList = AZStd::vector<ActiveBodyTransform>;
+
+        //! Signaled once per simulation step, after the collision and trigger events, with the transforms of all the
+        //! rigid bodies the step moved. Sleeping bodies are not included.
+        using OnSceneActiveBodyTransformsEvent = AZ::Event<AzPhysics::SceneHandle, const ActiveBodyTransformList&>;
+
         explicit PhysXScene(const AzPhysics::SceneConfiguration& config, const AzPhysics::SceneHandle& sceneHandle);
         ~PhysXScene();
 
@@ -79,11 +106,29 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! Waits for the simulation started by StartSimulation and fetches its results, without flushing any event.
+        //! FinishSimulation does it first if it wasn't done already. Calling it on every scene before finishing any of
+        //! them guarantees that the events of a scene are never flushed while another scene is still simulating.
+        //! @return True if a simulation was in flight.
+        bool FetchSimulationResults();
+
+        //! Returns true between StartSimulation and the fetch of the simulation results.
+        bool IsSimulating() const { return m_isSimulating; }
+
+        void RegisterSceneActiveBodyTransformsHandler(OnSceneActiveBodyTransformsEvent::Handler& handler);
+
+        //! Returns the transforms of the rigid bodies moved by the last simulation step.
+        const ActiveBodyTransformList& GetActiveBodyTransforms() const;
+
     private:
         void EnableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
         void DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
 
+        void CollectActiveBodyTransforms();
+        void WriteBackActiveBodyTransforms();
         void FlushQueuedEvents();
+        void ProcessAsyncQueries();
+        void QuerySceneBatchInternal(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results);
         void ClearDeferedDeletions();
         void ProcessTriggerEvents();
         void ProcessCollisionEvents();
@@ -91,6 +136,8 @@ namespace PhysX
         void UpdateAzProfilerDataPoints();
 
         bool m_isEnabled = true;
+        bool m_isSimulating = false; //!< Set between StartSimulation and FetchSimulationResults.
+        bool m_hasPendingResults = false; //!< Set between FetchSimulationResults and FinishSimulation.
         AzPhysics::SceneConfiguration m_config;
         AzPhysics::SceneHandle m_sceneHandle;
         float m_currentDeltaTime = 0.0f;
@@ -112,6 +159,20 @@ namespace PhysX
         AZ::u64 m_shapecastBufferSize = 32; //!< Maximum number of hits that can be returned from a shapecast.
         AZ::u64 m_overlapBufferSize = 32; //!< Maximum number of overlaps that can be returned from an overlap query.
 
+        //! A non-blocking query waiting for the end of the simulation. Single requests only have a callback, batches a batch callback.
+        struct AsyncQuery
+        {
+            AzPhysics::SceneQuery::AsyncRequestId m_requestId;
+            AzPhysics::SceneQueryRequests m_requests;
+            AzPhysics::SceneQuery::AsyncCallback m_callback;
+            AzPhysics::SceneQuery::AsyncBatchCallback m_batchCallback;
+        };
+        AZStd::vector<AsyncQuery> m_asyncQueries; //!< Queries queued with QuerySceneAsync and QuerySceneAsyncBatch.
+        AZStd::mutex m_asyncQueriesMutex; //!< Async queries can be queued from any thread.
+
+        ActiveBodyTransformList m_activeBodyTransforms; //!< Reused every simulation step to avoid allocations.
+        OnSceneActiveBodyTransformsEvent m_sceneActiveBodyTransformsEvent;
+
         SceneSimulationFilterCallback m_collisionFilterCallback; //!< Handles the filtering of collision pairs reported from PhysX.
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
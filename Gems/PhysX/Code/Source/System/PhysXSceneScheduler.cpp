@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <System/PhysXSceneScheduler.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <Scene/PhysXScene.h>
+
+namespace PhysX
+{
+    namespace Internal
+    {
+        static const SceneStepSettings DefaultStepSettings;
+        static const SceneTimingStats EmptyTimingStats;
+
+        static float TicksToMilliseconds(AZStd::sys_time_t ticks)
+        {
+            return static_cast<float>(ticks) * 1000.0f / static_cast<float>(AZStd::GetTimeTicksPerSecond());
+        }
+    } // namespace Internal
+
+    void PhysXSceneScheduler::Simulate(AzPhysics::SceneList& scenes, float deltaTime, float systemTimestep, AZ::u32 systemSteps)
+    {
+        AZ_PROFILE_FUNCTION(Physics);
+
+        if (m_sceneStates.size() < scenes.size())
+        {
+            m_sceneStates.resize(scenes.size());
+        }
+
+        // Work out the steps each scene takes this frame.
+        AZ::u32 maxPendingSteps = 0;
+        for (size_t sceneIndex = 0; sceneIndex < scenes.size(); ++sceneIndex)
+        {
+            SceneState& state = m_sceneStates[sceneIndex];
+            state.m_stats = SceneTimingStats();
+            state.m_pendingSteps = 0;
+
+            if (scenes[sceneIndex] == nullptr || !scenes[sceneIndex]->IsEnabled())
+            {
+                continue;
+            }
+
+            const AZ::u32 maxSubsteps = state.m_settings.m_maxSubsteps;
+            if (state.m_settings.m_fixedTimestep > 0.0f)
+            {
+                const float fixedTimestep = state.m_settings.m_fixedTimestep;
+                state.m_stepTime = fixedTimestep;
+                state.m_accumulatedTime += deltaTime;
+                while (state.m_accumulatedTime >= fixedTimestep && (maxSubsteps == 0 || state.m_pendingSteps < maxSubsteps))
+                {
+                    state.m_accumulatedTime -= fixedTimestep;
+                    state.m_pendingSteps++;
+                }
+                if (state.m_accumulatedTime >= fixedTimestep)
+                {
+                    // Out of budget, keep the remainder only so the scene doesn't fall further behind every frame.
+                    const float droppedTime = AZStd::floorf(state.m_accumulatedTime / fixedTimestep) * fixedTimestep;
+                    state.m_accumulatedTime -= droppedTime;
+                    state.m_stats.m_droppedTime = droppedTime;
+                }
+            }
+            else
+            {
+                state.m_stepTime = systemTimestep;
+                state.m_pendingSteps = systemSteps;
+                if (maxSubsteps > 0 && systemSteps > maxSubsteps)
+                {
+                    state.m_pendingSteps = maxSubsteps;
+                    state.m_stats.m_droppedTime = static_cast<float>(systemSteps - maxSubsteps) * systemTimestep;
+                }
+            }
+            maxPendingSteps = AZStd::max(maxPendingSteps, state.m_pendingSteps);
+        }
+
+        for (AZ::u32 round = 0; round < maxPendingSteps; ++round)
+        {
+            // Start all the scenes first so they simulate concurrently...
+            for (size_t sceneIndex = 0; sceneIndex < AZStd::min(scenes.size(), m_sceneStates.size()); ++sceneIndex)
+            {
+                SceneState& state = m_sceneStates[sceneIndex];
+                if (state.m_pendingSteps <= round)
+                {
+                    continue;
+                }
+
+                // The scene may have been removed or disabled by the events of the previous round.
+                if (scenes[sceneIndex] == nullptr || !scenes[sceneIndex]->IsEnabled())
+                {
+                    state.m_pendingSteps = 0;
+                    continue;
+                }
+
+                state.m_stepStartTime = AZStd::GetTimeNowTicks();
+                scenes[sceneIndex]->StartSimulation(state.m_stepTime);
+            }
+
+            // ...then wait for all of them, so that no scene is still simulating while the events of another one are flushed...
+            for (size_t sceneIndex = 0; sceneIndex < AZStd::min(scenes.size(), m_sceneStates.size()); ++sceneIndex)
+            {
+                SceneState& state = m_sceneStates[sceneIndex];
+                if (state.m_pendingSteps <= round)
+                {
+                    continue;
+                }
+
+                const AZStd::sys_time_t fetchStartTime = AZStd::GetTimeNowTicks();
+                if (auto* physXScene = azrtti_cast<PhysXScene*>(scenes[sceneIndex].get()))
+                {
+                    state.m_hasFetchedResults = physXScene->FetchSimulationResults();
+                }
+                else
+                {
+                    state.m_hasFetchedResults = scenes[sceneIndex] != nullptr;
+                }
+                state.m_stats.m_finishTimeMs += Internal::TicksToMilliseconds(AZStd::GetTimeNowTicks() - fetchStartTime);
+            }
+
+            // ...and finish them in order, which is the order their events are flushed in.
+            for (size_t sceneIndex = 0; sceneIndex < AZStd::min(scenes.size(), m_sceneStates.size()); ++sceneIndex)
+            {
+                SceneState& state = m_sceneStates[sceneIndex];
+                if (state.m_pendingSteps <= round)
+                {
+                    continue;
+                }
+
+                // Only steps which actually simulated are counted. A scene removed by the events of a scene finished
+                // before it has already been cleaned up, and its state was reset.
+                if (!state.m_hasFetchedResults || scenes[sceneIndex] == nullptr)
+                {
+                    continue;
+                }
+                state.m_hasFetchedResults = false;
+
+                const AZStd::sys_time_t finishStartTime = AZStd::GetTimeNowTicks();
+                scenes[sceneIndex]->FinishSimulation();
+                const AZStd::sys_time_t finishEndTime = AZStd::GetTimeNowTicks();
+
+                state.m_stats.m_substeps++;
+                state.m_stats.m_simulatedTime += state.m_stepTime;
+                state.m_stats.m_simulationTimeMs += Internal::TicksToMilliseconds(finishEndTime - state.m_stepStartTime);
+                state.m_stats.m_finishTimeMs += Internal::TicksToMilliseconds(finishEndTime - finishStartTime);
+            }
+        }
+    }
+
+    void PhysXSceneScheduler::SetStepSettings(AzPhysics::SceneIndex sceneIndex, const SceneStepSettings& settings)
+    {
+        AZ_Assert(settings.m_fixedTimestep >= 0.0f, "PhysXSceneScheduler - fixed timestep is negative.");
+
+        SceneState& state = GetOrCreateState(sceneIndex);
+        if (state.m_settings.m_fixedTimestep != settings.m_fixedTimestep)
+        {
+            state.m_accumulatedTime = 0.0f;
+        }
+        state.m_settings = settings;
+    }
+
+    const SceneStepSettings& PhysXSceneScheduler::GetStepSettings(AzPhysics::SceneIndex sceneIndex) const
+    {
+        if (sceneIndex >= 0 && static_cast<size_t>(sceneIndex) < m_sceneStates.size())
+        {
+            return m_sceneStates[sceneIndex].m_settings;
+        }
+        return Internal::DefaultStepSettings;
+    }
+
+    const SceneTimingStats& PhysXSceneScheduler::GetTimingStats(AzPhysics::SceneIndex sceneIndex) const
+    {
+        if (sceneIndex >= 0 && static_cast<size_t>(sceneIndex) < m_sceneStates.size())
+        {
+            return m_sceneStates[sceneIndex].m_stats;
+        }
+        return Internal::EmptyTimingStats;
+    }
+
+    void PhysXSceneScheduler::OnSceneRemoved(AzPhysics::SceneIndex sceneIndex)
+    {
+        if (sceneIndex >= 0 && static_cast<size_t>(sceneIndex) < m_sceneStates.size())
+        {
+            // Keep the pending steps so a removal during Simulate doesn't affect the rounds in flight.
+            const AZ::u32 pendingSteps = m_sceneStates[sceneIndex].m_pendingSteps;
+            m_sceneStates[sceneIndex] = SceneState();
+            m_sceneStates[sceneIndex].m_pendingSteps = pendingSteps;
+        }
+    }
+
+    void PhysXSceneScheduler::Reset()
+    {
+        m_sceneStates.clear();
+    }
+
+    PhysXSceneScheduler::SceneState& PhysXSceneScheduler::GetOrCreateState(AzPhysics::SceneIndex sceneIndex)
+    {
+        AZ_Assert(sceneIndex >= 0, "PhysXSceneScheduler - invalid scene index.");
+        if (m_sceneStates.size() <= static_cast<size_t>(sceneIndex))
+        {
+            m_sceneStates.resize(sceneIndex + 1);
+        }
+        return m_sceneStates[sceneIndex];
+    }
+} // namespace PhysX
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/time.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+
+namespace PhysX
+{
+    //! Fixed step settings of a single scene.
+    struct SceneStepSettings
+    {
+        //! Fixed timestep of the scene, 0 to step the scene with the timestep of the physics system.
+        float m_fixedTimestep = 0.0f;
+        //! Maximum number of steps the scene can take in one frame, 0 for no limit.
+        //! The time that doesn't fit in the budget is dropped rather than carried over to the next frame.
+        AZ::u32 m_maxSubsteps = 0;
+    };
+
+    //! Timings of a single scene, gathered during the last frame.
+    struct SceneTimingStats
+    {
+        AZ::u32 m_substeps = 0; //!< Number of steps taken.
+        float m_simulatedTime = 0.0f; //!< Total time simulated, in seconds.
+        float m_droppedTime = 0.0f; //!< Time dropped because of the substep budget, in seconds.
+        float m_simulationTimeMs = 0.0f; //!< Wall time from the start of the steps to the end of their finish.
+        float m_finishTimeMs = 0.0f; //!< Wall time spent finishing the steps: waiting for the results and flushing the events.
+    };
+
+    //! Steps the scenes of the physics system.
+    //! Every enabled scene is started before any of them is finished, so the simulations of independent scenes run
+    //! concurrently on the CPU dispatcher. The results of all the scenes are fetched before any event is flushed, so the
+    //! handlers of a scene can safely access other scenes. Scenes are then finished in the order of their index, which
+    //! keeps the order in which their events are flushed the same from one run to the next.
+    //! Scenes taking several steps in a frame are stepped in rounds, where each round starts and then finishes one step
+    //! of all the scenes that still have steps to take.
+    class PhysXSceneScheduler
+    {
+    public:
+        //! Steps the scenes for a frame.
+        //! @param scenes Scenes of the physics system.
+        //! @param deltaTime Frame time, already clamped to the max timestep of the system.
+        //! @param systemTimestep Timestep used by the scenes following the system timestep.
+        //! @param systemSteps Number of steps the scenes following the system timestep take.
+        void Simulate(AzPhysics::SceneList& scenes, float deltaTime, float systemTimestep, AZ::u32 systemSteps);
+
+        void SetStepSettings(AzPhysics::SceneIndex sceneIndex, const SceneStepSettings& settings);
+        const SceneStepSettings& GetStepSettings(AzPhysics::SceneIndex sceneIndex) const;
+        const SceneTimingStats& GetTimingStats(AzPhysics::SceneIndex sceneIndex) const;
+
+        //! Resets the settings, time and stats of a removed scene so they aren't inherited by a scene reusing the slot.
+        void OnSceneRemoved(AzPhysics::SceneIndex sceneIndex);
+        void Reset();
+
+    private:
+        struct SceneState
+        {
+            SceneStepSettings m_settings;
+            SceneTimingStats m_stats;
+            float m_accumulatedTime = 0.0f; //!< Only used with a scene fixed timestep.
+            float m_stepTime = 0.0f; //!< Timestep of the steps of the current frame.
+            AZ::u32 m_pendingSteps = 0; //!< Number of steps to take in the current frame.
+            AZStd::sys_time_t m_stepStartTime = 0;
+            bool m_hasFetchedResults = false; //!< Set when the step in flight has simulated and still has to be finished.
+        };
+
+        SceneState& GetOrCreateState(AzPhysics::SceneIndex sceneIndex);
+
+        AZStd::vector<SceneState> m_sceneStates; //!< Indexed by the scene index.
+    };
+} // namespace PhysX
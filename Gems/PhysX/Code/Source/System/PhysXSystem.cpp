@@ -12,6 +12,8 @@
 #include <Scene/PhysXScene.h>
 #include <System/PhysXAllocator.h>
 #include <System/PhysXCpuDispatcher.h>
+#include <System/PhysXTaskExecutorCpuDispatcher.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
 #include <AzCore/Asset/AssetManager.h>
@@ -153,18 +155,6 @@ namespace PhysX
             return;
         }
 
-        auto simulateScenes = [this](float timeStep)
-        {
-            for (auto& scenePtr : m_sceneList)
-            {
-                if (scenePtr != nullptr && scenePtr->IsEnabled())
-                {
-                    scenePtr->StartSimulation(timeStep);
-                    scenePtr->FinishSimulation();
-                }
-            }
-        };
-
 #ifdef ENABLE_PHYSX_TIMESTEP_WARNING
         if (FrameTimeWarning::NumSamples < FrameTimeWarning::MaxSamples)
         {
@@ -189,25 +179,26 @@ namespace PhysX
 
         AZ_Assert(m_systemConfig.m_fixedTimestep >= 0.0f, "PhysXSystem - fixed timestep is negitive.");
         float tickTime = deltaTime;
+        float stepTime = deltaTime;
+        AZ::u32 numSteps = 1;
         if (m_systemConfig.m_fixedTimestep > 0.0f) //use the fixed timestep
         {
             m_accumulatedTime += tickTime;
             //divide accumulated time by the fixed step and floor it to get the number of steps that would occur. Then multiply by fixedTimeStep to get the total executed time.
             tickTime = AZStd::floorf(m_accumulatedTime / m_systemConfig.m_fixedTimestep) * m_systemConfig.m_fixedTimestep;
-            m_preSimulateEvent.Signal(tickTime);
+            stepTime = m_systemConfig.m_fixedTimestep;
 
+            numSteps = 0;
             while (m_accumulatedTime >= m_systemConfig.m_fixedTimestep)
             {
-                simulateScenes(m_systemConfig.m_fixedTimestep);
                 m_accumulatedTime -= m_systemConfig.m_fixedTimestep;
+                numSteps++;
             }
         }
-        else
-        {
-            m_preSimulateEvent.Signal(tickTime);
 
-            simulateScenes(tickTime);
-        }
+        m_preSimulateEvent.Signal(tickTime);
+        // Scenes with their own fixed timestep accumulate the frame time themselves.
+        m_sceneScheduler.Simulate(m_sceneList, deltaTime, stepTime, numSteps);
         m_postSimulateEvent.Signal(tickTime);
     }
 
@@ -219,6 +210,8 @@ namespace PhysX
             return AzPhysics::InvalidSceneHandle;
         }
 
+        UpdateCpuDispatcher();
+
         if (!m_freeSceneSlots.empty()) //fill any free slots first before increasing the size of the scene list vector.
         {
             AzPhysics::SceneIndex freeIndex = m_freeSceneSlots.front();
@@ -327,6 +320,7 @@ namespace PhysX
                 {
                     m_sceneRemovedEvent.Signal(handle);
                     m_sceneList[index].reset();
+                    m_sceneScheduler.OnSceneRemoved(static_cast<AzPhysics::SceneIndex>(index));
                     m_freeSceneSlots.push(static_cast<AzPhysics::SceneIndex>(index));
                 }
             }
@@ -344,12 +338,33 @@ namespace PhysX
     void PhysXSystem::RemoveAllScenes()
     {
         m_sceneList.clear();
+        m_sceneScheduler.Reset();
 
         //clear the free slots queue
         AZStd::queue<AzPhysics::SceneIndex> empty;
         m_freeSceneSlots.swap(empty);
     }
 
+    void PhysXSystem::SetSceneStepSettings(AzPhysics::SceneHandle handle, const SceneStepSettings& settings)
+    {
+        if (GetScene(handle) == nullptr)
+        {
+            AZ_Warning("PhysXSystem", false, "SetSceneStepSettings: Invalid scene handle.");
+            return;
+        }
+        m_sceneScheduler.SetStepSettings(AZStd::get<AzPhysics::HandleTypeIndex::Index>(handle), settings);
+    }
+
+    const SceneStepSettings& PhysXSystem::GetSceneStepSettings(AzPhysics::SceneHandle handle) const
+    {
+        return m_sceneScheduler.GetStepSettings(AZStd::get<AzPhysics::HandleTypeIndex::Index>(handle));
+    }
+
+    const SceneTimingStats& PhysXSystem::GetSceneTimingStats(AzPhysics::SceneHandle handle) const
+    {
+        return m_sceneScheduler.GetTimingStats(AZStd::get<AzPhysics::HandleTypeIndex::Index>(handle));
+    }
+
     AZStd::pair<AzPhysics::SceneHandle, AzPhysics::SimulatedBodyHandle> PhysXSystem::FindAttachedBodyHandleFromEntityId(AZ::EntityId entityId)
     {
         for (auto& scenePtr : m_sceneList)
@@ -429,7 +444,22 @@ namespace PhysX
         // set up cooking for height fields, meshes etc.
         m_physXSdk.m_cooking = PxCreateCooking(PX_PHYSICS_VERSION, *m_physXSdk.m_foundation, cookingParams);
 
-        // Set up CPU dispatcher
+        CreateCpuDispatcher();
+
+        PxSetProfilerCallback(&m_pxAzProfilerCallback);
+    }
+
+    void PhysXSystem::CreateCpuDispatcher()
+    {
+        m_cpuDispatcherType = m_systemConfig.m_cpuDispatcherType;
+        m_cpuDispatcherWorkerCount = m_systemConfig.m_cpuDispatcherWorkerCount;
+
+        if (m_cpuDispatcherType == CpuDispatcherType::TaskExecutor)
+        {
+            m_cpuDispatcher = aznew PhysXTaskExecutorCpuDispatcher(m_cpuDispatcherWorkerCount);
+            return;
+        }
+
 #if defined(AZ_PLATFORM_LINUX)
         // Temporary workaround for linux. At the moment using AzPhysXCpuDispatcher results in an assert at
         // PhysX mutex indicating it must be unlocked only by the thread that has already acquired lock.
@@ -437,14 +467,38 @@ namespace PhysX
 #else
         m_cpuDispatcher = PhysXCpuDispatcherCreate();
 #endif
+    }
 
-        PxSetProfilerCallback(&m_pxAzProfilerCallback);
+    void PhysXSystem::UpdateCpuDispatcher()
+    {
+        if (m_systemConfig.m_cpuDispatcherType == m_cpuDispatcherType &&
+            m_systemConfig.m_cpuDispatcherWorkerCount == m_cpuDispatcherWorkerCount)
+        {
+            return;
+        }
+
+        // The scenes keep running on the dispatcher they were created with, so it can only be replaced once they are all removed.
+        const bool hasScenes = AZStd::any_of(m_sceneList.begin(), m_sceneList.end(),
+            [](const AZStd::unique_ptr<AzPhysics::Scene>& scene)
+            {
+                return scene != nullptr;
+            });
+        if (!hasScenes)
+        {
+            DestroyCpuDispatcher();
+            CreateCpuDispatcher();
+        }
     }
 
-    void PhysXSystem::ShutdownPhysXSdk()
+    void PhysXSystem::DestroyCpuDispatcher()
     {
         delete m_cpuDispatcher;
         m_cpuDispatcher = nullptr;
+    }
+
+    void PhysXSystem::ShutdownPhysXSdk()
+    {
+        DestroyCpuDispatcher();
 
         m_physXSdk.m_cooking->release();
         m_physXSdk.m_cooking = nullptr;
@@ -17,6 +17,7 @@
 #include <Debug/PhysXDebug.h>
 #include <Scene/PhysXSceneInterface.h>
 #include <System/PhysXAllocator.h>
+#include <System/PhysXSceneScheduler.h>
 #include <System/PhysXSdkCallbacks.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
@@ -62,6 +63,14 @@ namespace PhysX
         void UpdateDefaultSceneConfiguration(const AzPhysics::SceneConfiguration& sceneConfiguration) override;
         const AzPhysics::SceneConfiguration& GetDefaultSceneConfiguration() const override;
 
+        //! Sets the fixed timestep and substep budget of a scene.
+        //! By default scenes are stepped with the fixed timestep of the system, with no substep budget.
+        void SetSceneStepSettings(AzPhysics::SceneHandle handle, const SceneStepSettings& settings);
+        const SceneStepSettings& GetSceneStepSettings(AzPhysics::SceneHandle handle) const;
+
+        //! Returns the timings of a scene during the last call to Simulate.
+        const SceneTimingStats& GetSceneTimingStats(AzPhysics::SceneHandle handle) const;
+
         //! Accessor to get the current PhysX configuration data.
         const PhysXSystemConfiguration& GetPhysXConfiguration() const;
 
@@ -88,6 +97,12 @@ namespace PhysX
         void InitializePhysXSdk(const physx::PxCookingParams& cookingParams);
         void ShutdownPhysXSdk();
 
+        //! Creates the CPU dispatcher selected in the system configuration, used by the scenes to run the simulation tasks.
+        void CreateCpuDispatcher();
+        //! Recreates the CPU dispatcher if its settings changed and no scene is using it.
+        void UpdateCpuDispatcher();
+        void DestroyCpuDispatcher();
+
         void InitializeMaterialLibrary();
         bool LoadMaterialLibrary();
 
@@ -97,6 +112,7 @@ namespace PhysX
         AZStd::queue<AzPhysics::SceneIndex> m_freeSceneSlots; //when a scene is removed cache its index here to be used for the next add.
 
         float m_accumulatedTime = 0.0f;
+        PhysXSceneScheduler m_sceneScheduler; //!< Steps the scenes concurrently, each with its own timestep settings.
 
         struct PhysXSdk
         {
@@ -110,6 +126,8 @@ namespace PhysX
         PxAzProfilerCallback m_pxAzProfilerCallback;
 
         physx::PxCpuDispatcher* m_cpuDispatcher = nullptr;
+        CpuDispatcherType m_cpuDispatcherType = CpuDispatcherType::JobManager; //!< Type of the dispatcher currently created.
+        AZ::u32 m_cpuDispatcherWorkerCount = 0; //!< Worker count the dispatcher was created with.
 
         enum class State : AZ::u8
         {
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <System/PhysXTaskExecutorCpuDispatcher.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace PhysX
+{
+    namespace Internal
+    {
+        static AZStd::atomic<AZ::u64> s_nextDispatcherId{ 1 };
+    } // namespace Internal
+
+    //! Pool of task wrappers owned by one submitting thread.
+    //! Wrappers are only taken by the owning thread but can be given back by any thread, which keeps the free list safe
+    //! from ABA issues with a single compare and swap on each side.
+    struct PhysXTaskExecutorCpuDispatcher::TaskPool
+    {
+        //! Submits a PhysX task to the executor through a reusable AZ task.
+        struct TaskWrapper
+        {
+            AZ_CLASS_ALLOCATOR(TaskWrapper, AZ::SystemAllocator, 0);
+
+            explicit TaskWrapper(TaskPool& pool)
+                : m_pool(pool)
+                , m_task(AZ::TaskDescriptor{ "PhysX Task", "PhysX" }, [this]() { Run(); })
+            {
+            }
+
+            void Run()
+            {
+                {
+                    AZ_PROFILE_SCOPE(Physics, m_pxTask->getName());
+                    m_pxTask->run();
+                    m_pxTask->release();
+                }
+
+                // The wrapper can be taken and resubmitted by its owning thread as soon as it is freed, so it must be
+                // the last thing done.
+                m_pool.Free(this);
+            }
+
+            TaskPool& m_pool;
+            physx::PxBaseTask* m_pxTask = nullptr;
+            TaskWrapper* m_nextFree = nullptr;
+            AZ::Internal::Task m_task;
+        };
+
+        //! Only called from the owning thread.
+        TaskWrapper* Allocate()
+        {
+            TaskWrapper* wrapper = m_freeList.load(AZStd::memory_order_acquire);
+            while (wrapper && !m_freeList.compare_exchange_weak(wrapper, wrapper->m_nextFree, AZStd::memory_order_acquire))
+            {
+            }
+
+            if (!wrapper)
+            {
+                m_wrappers.emplace_back(AZStd::make_unique<TaskWrapper>(*this));
+                wrapper = m_wrappers.back().get();
+            }
+            return wrapper;
+        }
+
+        //! Can be called from any thread.
+        void Free(TaskWrapper* wrapper)
+        {
+            TaskWrapper* head = m_freeList.load(AZStd::memory_order_relaxed);
+            do
+            {
+                wrapper->m_nextFree = head;
+            } while (!m_freeList.compare_exchange_weak(head, wrapper, AZStd::memory_order_release, AZStd::memory_order_relaxed));
+        }
+
+        AZStd::atomic<TaskWrapper*> m_freeList{ nullptr };
+        AZStd::vector<AZStd::unique_ptr<TaskWrapper>> m_wrappers; //!< All the wrappers of the pool, only grown by the owning thread.
+    };
+
+    PhysXTaskExecutorCpuDispatcher::PhysXTaskExecutorCpuDispatcher(AZ::u32 workerCount)
+        : m_workerCount(workerCount > 0 ? workerCount : AZStd::thread::hardware_concurrency())
+        , m_dispatcherId(Internal::s_nextDispatcherId++)
+    {
+        m_executor = AZStd::make_unique<AZ::TaskExecutor>(m_workerCount);
+    }
+
+    PhysXTaskExecutorCpuDispatcher::~PhysXTaskExecutorCpuDispatcher()
+    {
+        // PhysX has waited for all of its tasks to complete by the time the dispatcher is released.
+        m_executor.reset();
+        m_taskPools.clear();
+    }
+
+    PhysXTaskExecutorCpuDispatcher::TaskPool& PhysXTaskExecutorCpuDispatcher::GetThreadTaskPool()
+    {
+        // Cache of the pool this thread owns in the most recently used dispatcher.
+        thread_local AZ::u64 t_dispatcherId = 0;
+        thread_local TaskPool* t_taskPool = nullptr;
+
+        if (t_dispatcherId != m_dispatcherId)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_taskPoolsMutex);
+            AZStd::unique_ptr<TaskPool>& taskPool = m_taskPools[AZStd::this_thread::get_id()];
+            if (!taskPool)
+            {
+                taskPool = AZStd::make_unique<TaskPool>();
+            }
+            t_taskPool = taskPool.get();
+            t_dispatcherId = m_dispatcherId;
+        }
+        return *t_taskPool;
+    }
+
+    void PhysXTaskExecutorCpuDispatcher::submitTask(physx::PxBaseTask& task)
+    {
+        TaskPool::TaskWrapper* wrapper = GetThreadTaskPool().Allocate();
+        wrapper->m_pxTask = &task;
+        m_executor->Submit(wrapper->m_task);
+    }
+
+    physx::PxU32 PhysXTaskExecutorCpuDispatcher::getWorkerCount() const
+    {
+        return m_workerCount;
+    }
+} // namespace PhysX
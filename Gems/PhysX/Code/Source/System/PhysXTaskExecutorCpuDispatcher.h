@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <System/PhysXAllocator.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+}
+
+namespace PhysX
+{
+    //! CPU dispatcher which runs the tasks submitted by PhysX on a dedicated AZ::TaskExecutor.
+    //! PhysX submits many small tasks every simulation step, so the wrappers used to hand them to the executor are pooled
+    //! rather than allocated per task. Every thread submitting tasks owns a pool, and a wrapper goes back to the pool it
+    //! was taken from once its task has run, whichever thread ran it.
+    class PhysXTaskExecutorCpuDispatcher
+        : public physx::PxCpuDispatcher
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PhysXTaskExecutorCpuDispatcher, PhysXAllocator, 0);
+
+        //! @param workerCount Number of worker threads of the executor, 0 to match the hardware concurrency.
+        explicit PhysXTaskExecutorCpuDispatcher(AZ::u32 workerCount);
+        ~PhysXTaskExecutorCpuDispatcher();
+
+    private:
+        // PxCpuDispatcher implementation
+        void submitTask(physx::PxBaseTask& task) override;
+        physx::PxU32 getWorkerCount() const override;
+
+        struct TaskPool;
+        TaskPool& GetThreadTaskPool();
+
+        AZStd::unique_ptr<AZ::TaskExecutor> m_executor;
+        AZ::u32 m_workerCount = 0;
+        AZ::u64 m_dispatcherId = 0; //!< Identifies the pools of this dispatcher in the thread local pool cache.
+
+        //! The pool of each thread which submitted tasks to this dispatcher. Only locked when the thread local pool cache
+        //! doesn't point to this dispatcher, so a thread alternating between dispatchers keeps reusing the same pools.
+        AZStd::mutex m_taskPoolsMutex;
+        AZStd::unordered_map<AZStd::thread::id, AZStd::unique_ptr<TaskPool>> m_taskPools;
+    };
+} // namespace PhysX
@@ -128,21 +128,8 @@ namespace PhysX
             return { materialIndex0, materialIndex1 };
         }
 
-        void CreatePxGeometryFromHeightfield(
-            Physics::HeightfieldShapeConfiguration& heightfieldConfig, physx::PxGeometryHolder& pxGeometry)
+        float GetHeightfieldScaleFactor(const float minHeightBounds, const float maxHeightBounds)
         {
-            physx::PxHeightField* heightfield = nullptr;
-
-            const AZ::Vector2& gridSpacing = heightfieldConfig.GetGridResolution();
-
-            const int32_t numCols = heightfieldConfig.GetNumColumns();
-            const int32_t numRows = heightfieldConfig.GetNumRows();
-
-            const float rowScale = gridSpacing.GetX();
-            const float colScale = gridSpacing.GetY();
-
-            const float minHeightBounds = heightfieldConfig.GetMinHeightBounds();
-            const float maxHeightBounds = heightfieldConfig.GetMaxHeightBounds();
             const float halfBounds{ (maxHeightBounds - minHeightBounds) / 2.0f };
 
             // We're making the assumption right now that the min/max bounds are centered around 0.
@@ -161,11 +148,56 @@ namespace PhysX
             // full 16-bit range.
             // Note that the scaleFactor choice here affects overall precision.  For each bit that the integer part of our max
             // height uses, that's one less bit for the fractional part.
-            const float scaleFactor = (maxHeightBounds <= minHeightBounds) ? 1.0f : AZStd::numeric_limits<int16_t>::max() / halfBounds;
-            const float heightScale{ 1.0f / scaleFactor };
+            return (maxHeightBounds <= minHeightBounds) ? 1.0f : AZStd::numeric_limits<int16_t>::max() / halfBounds;
+        }
 
+        physx::PxHeightFieldSample CreatePxHeightfieldSample(
+            const Physics::HeightfieldShapeConfiguration& heightfieldConfig, const int32_t row, const int32_t col, const float scaleFactor)
+        {
             [[maybe_unused]] constexpr uint8_t physxMaximumMaterialIndex = 0x7f;
 
+            const int32_t numCols = heightfieldConfig.GetNumColumns();
+            const int32_t numRows = heightfieldConfig.GetNumRows();
+            const AZStd::vector<Physics::HeightMaterialPoint>& samples = heightfieldConfig.GetSamples();
+
+            const Physics::HeightMaterialPoint& currentSample = samples[(row * numCols) + col];
+            AZ_Assert(currentSample.m_materialIndex < physxMaximumMaterialIndex, "MaterialIndex must be less than 128");
+
+            physx::PxHeightFieldSample physxSample;
+            physxSample.height = azlossy_cast<physx::PxI16>(
+                AZ::GetClamp(currentSample.m_height, heightfieldConfig.GetMinHeightBounds(), heightfieldConfig.GetMaxHeightBounds()) *
+                scaleFactor);
+
+            auto [materialIndex0, materialIndex1] = GetPhysXMaterialIndicesFromHeightfieldSamples(samples, row, col, numRows, numCols);
+            physxSample.materialIndex0 = materialIndex0;
+            physxSample.materialIndex1 = materialIndex1;
+
+            if (currentSample.m_quadMeshType == Physics::QuadMeshType::SubdivideUpperLeftToBottomRight)
+            {
+                // Set the tesselation flag to say that we need to go from UL to BR
+                physxSample.setTessFlag();
+            }
+
+            return physxSample;
+        }
+
+        void CreatePxGeometryFromHeightfield(
+            Physics::HeightfieldShapeConfiguration& heightfieldConfig, physx::PxGeometryHolder& pxGeometry)
+        {
+            physx::PxHeightField* heightfield = nullptr;
+
+            const AZ::Vector2& gridSpacing = heightfieldConfig.GetGridResolution();
+
+            const int32_t numCols = heightfieldConfig.GetNumColumns();
+            const int32_t numRows = heightfieldConfig.GetNumRows();
+
+            const float rowScale = gridSpacing.GetX();
+            const float colScale = gridSpacing.GetY();
+
+            const float scaleFactor =
+                GetHeightfieldScaleFactor(heightfieldConfig.GetMinHeightBounds(), heightfieldConfig.GetMaxHeightBounds());
+            const float heightScale{ 1.0f / scaleFactor };
+
             // Delete the cached heightfield object if it is there, and create a new one and save in the shape configuration
             heightfieldConfig.SetCachedNativeHeightfield(nullptr);
 
@@ -180,28 +212,7 @@ namespace PhysX
                 {
                     for (int32_t col = 0; col < numCols; col++)
                     {
-                        auto GetIndex = [numCols](int32_t row, int32_t col)
-                        {
-                            return (row * numCols) + col;
-                        };
-
-                        const int32_t sampleIndex = GetIndex(row, col);
-
-                        const Physics::HeightMaterialPoint& currentSample = samples[sampleIndex];
-                        physx::PxHeightFieldSample& currentPhysxSample = physxSamples[sampleIndex];
-                        AZ_Assert(currentSample.m_materialIndex < physxMaximumMaterialIndex, "MaterialIndex must be less than 128");
-                        currentPhysxSample.height = azlossy_cast<physx::PxI16>(
-                            AZ::GetClamp(currentSample.m_height, minHeightBounds, maxHeightBounds) * scaleFactor);
-
-                        auto [materialIndex0, materialIndex1] = GetPhysXMaterialIndicesFromHeightfieldSamples(samples, row, col, numRows, numCols);
-                        currentPhysxSample.materialIndex0 = materialIndex0;
-                        currentPhysxSample.materialIndex1 = materialIndex1;
-
-                        if (currentSample.m_quadMeshType == Physics::QuadMeshType::SubdivideUpperLeftToBottomRight)
-                        {
-                            // Set the tesselation flag to say that we need to go from UL to BR
-                            currentPhysxSample.setTessFlag();
-                        }
+                        physxSamples[(row * numCols) + col] = CreatePxHeightfieldSample(heightfieldConfig, row, col, scaleFactor);
                     }
                 }
 
@@ -217,6 +228,78 @@ namespace PhysX
             }
         }
 
+        bool RefreshHeightfieldShape(
+            Physics::Shape& shape, Physics::HeightfieldShapeConfiguration& heightfieldConfig,
+            size_t startColumn, size_t startRow, size_t numColumns, size_t numRows)
+        {
+            auto* pxShape = static_cast<physx::PxShape*>(shape.GetNativePointer());
+            auto* heightfield = static_cast<physx::PxHeightField*>(heightfieldConfig.GetCachedNativeHeightfield());
+            if (!pxShape || !heightfield || (numColumns == 0) || (numRows == 0))
+            {
+                return false;
+            }
+
+            const int32_t numCols = heightfieldConfig.GetNumColumns();
+            const int32_t numHeightfieldRows = heightfieldConfig.GetNumRows();
+            if ((heightfield->getNbColumns() != aznumeric_cast<physx::PxU32>(numCols)) ||
+                (heightfield->getNbRows() != aznumeric_cast<physx::PxU32>(numHeightfieldRows)) ||
+                (heightfieldConfig.GetSamples().size() != aznumeric_cast<size_t>(numCols * numHeightfieldRows)))
+            {
+                return false;
+            }
+
+            // The material indices of a sample are chosen from the samples below and to the right of it, so the samples above and
+            // to the left of the changed region need to be refreshed as well.
+            const int32_t firstRow = AZStd::max(aznumeric_cast<int32_t>(startRow) - 1, 0);
+            const int32_t firstCol = AZStd::max(aznumeric_cast<int32_t>(startColumn) - 1, 0);
+            const int32_t lastRow = AZStd::min(aznumeric_cast<int32_t>(startRow + numRows) - 1, numHeightfieldRows - 1);
+            const int32_t lastCol = AZStd::min(aznumeric_cast<int32_t>(startColumn + numColumns) - 1, numCols - 1);
+            if ((lastRow < firstRow) || (lastCol < firstCol))
+            {
+                return false;
+            }
+
+            const float scaleFactor =
+                GetHeightfieldScaleFactor(heightfieldConfig.GetMinHeightBounds(), heightfieldConfig.GetMaxHeightBounds());
+
+            const int32_t subfieldRows = lastRow - firstRow + 1;
+            const int32_t subfieldCols = lastCol - firstCol + 1;
+            AZStd::vector<physx::PxHeightFieldSample> physxSamples(aznumeric_cast<size_t>(subfieldRows * subfieldCols));
+
+            for (int32_t row = 0; row < subfieldRows; row++)
+            {
+                for (int32_t col = 0; col < subfieldCols; col++)
+                {
+                    physxSamples[(row * subfieldCols) + col] =
+                        CreatePxHeightfieldSample(heightfieldConfig, firstRow + row, firstCol + col, scaleFactor);
+                }
+            }
+
+            physx::PxHeightFieldDesc subfieldDesc;
+            subfieldDesc.format = physx::PxHeightFieldFormat::eS16_TM;
+            subfieldDesc.nbColumns = aznumeric_cast<physx::PxU32>(subfieldCols);
+            subfieldDesc.nbRows = aznumeric_cast<physx::PxU32>(subfieldRows);
+            subfieldDesc.samples.data = physxSamples.data();
+            subfieldDesc.samples.stride = sizeof(physx::PxHeightFieldSample);
+
+            physx::PxScene* pxScene = pxShape->getActor() ? pxShape->getActor()->getScene() : nullptr;
+            PHYSX_SCENE_WRITE_LOCK(pxScene);
+
+            if (!heightfield->modifySamples(firstCol, firstRow, subfieldDesc, true))
+            {
+                return false;
+            }
+
+            // The bounds of the shape are cached, so the shape needs its geometry set again to pick up the modified samples.
+            physx::PxHeightFieldGeometry heightfieldGeometry;
+            if (pxShape->getHeightFieldGeometry(heightfieldGeometry))
+            {
+                pxShape->setGeometry(heightfieldGeometry);
+            }
+
+            return true;
+        }
+
         bool CreatePxGeometryFromConfig(const Physics::ShapeConfiguration& shapeConfiguration, physx::PxGeometryHolder& pxGeometry)
         {
             if (!shapeConfiguration.m_scale.IsGreaterThan(AZ::Vector3::CreateZero()))
@@ -1549,7 +1632,7 @@ namespace PhysX
             return entityWorldTransformWithoutScale * jointLocalTransformWithoutScale;
         }
         
-        Physics::HeightfieldShapeConfiguration CreateHeightfieldShapeConfiguration(AZ::EntityId entityId)
+        Physics::HeightfieldShapeConfiguration CreateHeightfieldShapeConfiguration(AZ::EntityId entityId, bool includeSamples)
         {
             Physics::HeightfieldShapeConfiguration configuration;
 
@@ -1575,15 +1658,29 @@ namespace PhysX
             configuration.SetMinHeightBounds(minHeightBounds);
             configuration.SetMaxHeightBounds(maxHeightBounds);
 
-            AZStd::vector<Physics::HeightMaterialPoint> samples;
-            Physics::HeightfieldProviderRequestsBus::EventResult(
-                samples, entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightsAndMaterials);
+            if (includeSamples)
+            {
+                AZStd::vector<Physics::HeightMaterialPoint> samples;
+                Physics::HeightfieldProviderRequestsBus::EventResult(
+                    samples, entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightsAndMaterials);
 
-            configuration.SetSamples(samples);
+                configuration.SetSamples(samples);
+            }
 
             return configuration;
         }
 
+        bool IsHeightfieldLayoutUnchanged(AZ::EntityId entityId, const Physics::HeightfieldShapeConfiguration& heightfieldConfig)
+        {
+            const Physics::HeightfieldShapeConfiguration providerConfig = CreateHeightfieldShapeConfiguration(entityId, false);
+
+            return providerConfig.GetGridResolution().IsClose(heightfieldConfig.GetGridResolution()) &&
+                (providerConfig.GetNumColumns() == heightfieldConfig.GetNumColumns()) &&
+                (providerConfig.GetNumRows() == heightfieldConfig.GetNumRows()) &&
+                (providerConfig.GetMinHeightBounds() == heightfieldConfig.GetMinHeightBounds()) &&
+                (providerConfig.GetMaxHeightBounds() == heightfieldConfig.GetMaxHeightBounds());
+        }
+
         void SetMaterialsFromHeightfieldProvider(const AZ::EntityId& heightfieldProviderId, Physics::MaterialSelection& materialSelection)
         {
             AZStd::vector<Physics::MaterialId> materialList;
@@ -193,7 +193,21 @@ namespace PhysX
             const int32_t row, const int32_t col,
             const int32_t numRows, const int32_t numCols);
 
-        Physics::HeightfieldShapeConfiguration CreateHeightfieldShapeConfiguration(AZ::EntityId entityId);
+        //! Creates a heightfield shape configuration from the heightfield provider on the entity.
+        //! The samples can be left out when they are generated separately, such as for each tile of a tiled heightfield.
+        Physics::HeightfieldShapeConfiguration CreateHeightfieldShapeConfiguration(AZ::EntityId entityId, bool includeSamples = true);
+
+        //! Checks whether the heightfield provider on the entity still has the same spacing, size and height bounds as the
+        //! heightfield configuration, which is required for updating the heightfield in place.
+        bool IsHeightfieldLayoutUnchanged(AZ::EntityId entityId, const Physics::HeightfieldShapeConfiguration& heightfieldConfig);
+
+        //! Updates a region of the native heightfield of a shape in place, from the samples in the heightfield configuration.
+        //! This avoids recooking the whole heightfield when only a small part of it has changed.
+        //! @return false if the shape doesn't have a native heightfield with the same layout as the configuration, in which
+        //!         case the heightfield needs to be recreated instead.
+        bool RefreshHeightfieldShape(
+            Physics::Shape& shape, Physics::HeightfieldShapeConfiguration& heightfieldConfig,
+            size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
 
         void SetMaterialsFromHeightfieldProvider(const AZ::EntityId& heightfieldProviderId, Physics::MaterialSelection& materialSelection);
 
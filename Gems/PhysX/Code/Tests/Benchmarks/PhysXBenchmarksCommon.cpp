@@ -55,6 +55,19 @@ namespace PhysX::Benchmarks
 
     void PhysXBaseBenchmarkFixture::SetUpInternal()
     {
+        //select the CPU dispatcher before adding the scene, it is only replaced while no scene exists
+        if (auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get())
+        {
+            if (const auto* physXConfig = azdynamic_cast<const PhysXSystemConfiguration*>(physicsSystem->GetConfiguration());
+                physXConfig && (physXConfig->m_cpuDispatcherType != m_cpuDispatcherType || physXConfig->m_cpuDispatcherWorkerCount != m_cpuDispatcherWorkerCount))
+            {
+                PhysXSystemConfiguration newConfig = *physXConfig;
+                newConfig.m_cpuDispatcherType = m_cpuDispatcherType;
+                newConfig.m_cpuDispatcherWorkerCount = m_cpuDispatcherWorkerCount;
+                physicsSystem->UpdateConfiguration(&newConfig);
+            }
+        }
+
         m_testSceneHandle = CreateDefaultTestScene(); //create the default scene
         if (auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get())
         {
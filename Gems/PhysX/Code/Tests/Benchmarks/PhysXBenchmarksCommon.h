@@ -13,6 +13,7 @@
 #include <PhysXTestEnvironment.h>
 
 #include <AzFramework/Physics/SystemBus.h>
+#include <PhysX/Configuration/PhysXConfiguration.h>
 
 namespace PhysX::Benchmarks
 {
@@ -61,6 +62,10 @@ namespace PhysX::Benchmarks
 
         AzPhysics::Scene* m_defaultScene = nullptr;
         AzPhysics::SceneHandle m_testSceneHandle = AzPhysics::InvalidSceneHandle;
+
+        //! CPU dispatcher the default scene runs its simulation tasks on, applied by SetUpInternal.
+        CpuDispatcherType m_cpuDispatcherType = CpuDispatcherType::JobManager;
+        AZ::u32 m_cpuDispatcherWorkerCount = 0;
     };
 } // namespace PhysX::Benchmarks
 #endif //HAVE_BENCHMARK
@@ -105,6 +105,8 @@ namespace PhysX::Benchmarks
         }
 
     protected:
+        void RunMovingAndColliding(benchmark::State& state);
+
         // PhysXBaseBenchmarkFixture Overrides ...
         AzPhysics::SceneConfiguration GetDefaultSceneConfiguration() override
         {
@@ -217,10 +219,10 @@ namespace PhysX::Benchmarks
         PhysX::Benchmarks::Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
     }
 
-    //! BM_Ragdoll_MovingAndColliding - This test will create the physics washing machine, a cylinder with a spinning blade where
-    //! it will spawn the requested number of ragdolls and places them above the machine to fall into the spinning blade.
+    //! Creates the physics washing machine, a cylinder with a spinning blade where it will spawn the requested number of ragdolls
+    //! and places them above the machine to fall into the spinning blade.
     //! The test will run the simulation for ~1800 game frames at 60fps.
-    BENCHMARK_DEFINE_F(PhysXCharactersRagdollBenchmarkFixture, BM_Ragdoll_MovingAndColliding)(benchmark::State& state)
+    void PhysXCharactersRagdollBenchmarkFixture::RunMovingAndColliding(benchmark::State& state)
     {
         //setup some pieces for the test
         AZ::SimpleLcgRandom rand;
@@ -283,6 +285,29 @@ namespace PhysX::Benchmarks
         PhysX::Benchmarks::Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
     }
 
+    //! BM_Ragdoll_MovingAndColliding - Runs the washing machine simulation, see RunMovingAndColliding.
+    BENCHMARK_DEFINE_F(PhysXCharactersRagdollBenchmarkFixture, BM_Ragdoll_MovingAndColliding)(benchmark::State& state)
+    {
+        RunMovingAndColliding(state);
+    }
+
+    //! Same as the PhysXCharactersRagdollBenchmarkFixture, runs the simulation tasks on the TaskExecutor CPU dispatcher instead of the job manager
+    class PhysXCharactersRagdollTaskExecutorBenchmarkFixture
+        : public PhysXCharactersRagdollBenchmarkFixture
+    {
+    public:
+        PhysXCharactersRagdollTaskExecutorBenchmarkFixture()
+        {
+            m_cpuDispatcherType = CpuDispatcherType::TaskExecutor;
+        }
+    };
+
+    //! BM_Ragdoll_MovingAndColliding_TaskExecutor - Runs that same benchmark as BM_Ragdoll_MovingAndColliding, with the TaskExecutor CPU dispatcher.
+    BENCHMARK_DEFINE_F(PhysXCharactersRagdollTaskExecutorBenchmarkFixture, BM_Ragdoll_MovingAndColliding_TaskExecutor)(benchmark::State& state)
+    {
+        RunMovingAndColliding(state);
+    }
+
     BENCHMARK_REGISTER_F(PhysXCharactersRagdollBenchmarkFixture, BM_Ragdoll_AtRest)
         ->RangeMultiplier(RagdollConstants::BenchmarkSettings::RangeMultipler)
         ->Ranges({
@@ -299,6 +324,13 @@ namespace PhysX::Benchmarks
         ->Unit(benchmark::kMillisecond)
         ->Iterations(RagdollConstants::BenchmarkSettings::NumIterations)
         ;
+
+    BENCHMARK_REGISTER_F(PhysXCharactersRagdollTaskExecutorBenchmarkFixture, BM_Ragdoll_MovingAndColliding_TaskExecutor)
+        ->RangeMultiplier(RagdollConstants::BenchmarkSettings::RangeMultipler)
+        ->Range(RagdollConstants::BenchmarkSettings::StartRange, RagdollConstants::BenchmarkSettings::EndRange)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RagdollConstants::BenchmarkSettings::NumIterations)
+        ;
 } // namespace PhysX::Benchmarks
 
 #endif // #ifdef HAVE_BENCHMARK
@@ -19,6 +19,7 @@
 
 #include <PhysXTestCommon.h>
 #include <PhysXTestUtil.h>
+#include <Source/RigidBody.h>
 
 namespace PhysX::Benchmarks
 {
@@ -69,6 +70,16 @@ namespace PhysX::Benchmarks
             static const int HalfCollisionHandlers = 1; // create half the number of handlers as rigid bodies
             static const int NoCollisionHandlers = 2; // create the no handlers
 
+            //! Number of rigid bodies used by the transform write back benchmark.
+            static const int WriteBackRigidBodies = 10000;
+
+            //!Flags to select how the transform write back benchmark reads the simulated transforms
+            static const int PollTransformWriteBack = 0; // read the transform of every body when the simulation finishes
+            static const int ActiveTransformWriteBack = 1; // receive the transforms of the bodies moved by the simulation
+
+            //! Number of rigid bodies spawned in each scene by the multiple scenes benchmark.
+            static const int MultipleScenesRigidBodies = 512;
+
             //! Number of iterations for each test
             static const int NumIterations = 3;
         } // namespace BenchmarkRange
@@ -151,6 +162,8 @@ namespace PhysX::Benchmarks
             m_terrainEntity = nullptr;
             PhysXBaseBenchmarkFixture::TearDownInternal();
         }
+
+        void RunMovingAndColliding(benchmark::State& state);
     public:
         void SetUp(const benchmark::State&) override
         {
@@ -252,10 +265,10 @@ namespace PhysX::Benchmarks
         Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
     }
 
-    //! BM_RigidBody_MovingAndColliding - This test will create the physics washing machine, a cylinder with a spinning blade where
-    //! it will spawn the requested number of rigid bodies above the machine and let them fall into a spinning blade.
+    //! Creates the physics washing machine, a cylinder with a spinning blade where it will spawn the requested number of rigid
+    //! bodies above the machine and let them fall into a spinning blade.
     //! The test will run the simulation for ~1800 game frames at 60fps.
-    BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_MovingAndColliding)(benchmark::State &state)
+    void PhysXRigidbodyBenchmarkFixture::RunMovingAndColliding(benchmark::State& state)
     {
         //setup some pieces for the test
         AZ::SimpleLcgRandom rand;
@@ -326,6 +339,29 @@ namespace PhysX::Benchmarks
         Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
     }
 
+    //! BM_RigidBody_MovingAndColliding - Runs the washing machine simulation, see RunMovingAndColliding.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_MovingAndColliding)(benchmark::State &state)
+    {
+        RunMovingAndColliding(state);
+    }
+
+    //! Same as the PhysXRigidbodyBenchmarkFixture, runs the simulation tasks on the TaskExecutor CPU dispatcher instead of the job manager
+    class PhysXRigidbodyTaskExecutorBenchmarkFixture
+        : public PhysXRigidbodyBenchmarkFixture
+    {
+    public:
+        PhysXRigidbodyTaskExecutorBenchmarkFixture()
+        {
+            m_cpuDispatcherType = CpuDispatcherType::TaskExecutor;
+        }
+    };
+
+    //! BM_RigidBody_MovingAndColliding_TaskExecutor - Runs that same benchmark as BM_RigidBody_MovingAndColliding, with the TaskExecutor CPU dispatcher.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyTaskExecutorBenchmarkFixture, BM_RigidBody_MovingAndColliding_TaskExecutor)(benchmark::State& state)
+    {
+        RunMovingAndColliding(state);
+    }
+
     //! Same as the PhysXRigidbodyBenchmarkFixture, adds a world event handler to receive collision events
     class PhysXRigidbodyCollisionsBenchmarkFixture
         : public PhysXRigidbodyBenchmarkFixture
@@ -501,6 +537,219 @@ namespace PhysX::Benchmarks
         state.counters["Collisions-End"] = static_cast<double>(m_collisionEndCount);
     }
 
+    //! BM_RigidBody_TransformWriteBack - Runs the washing machine simulation of BM_RigidBody_MovingAndColliding, while writing the
+    //! transforms of the rigid bodies back to a buffer standing in for the entities' transforms, the way RigidBodyComponent does.
+    //! Either every body is polled when the simulation finishes, or the transforms are received from the scene's bulk write back,
+    //! which only visits the bodies the simulation moved.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_TransformWriteBack)(benchmark::State& state)
+    {
+        AZ::SimpleLcgRandom rand;
+        rand.SetSeed(RigidBodyConstants::RandGenSeed);
+
+        const AZ::Vector3 washingMachineCentre(500.0f, 500.0f, 1.0f);
+        WashingMachine washingMachine;
+        washingMachine.SetupWashingMachine(
+            m_testSceneHandle, RigidBodyConstants::TestRadius, RigidBodyConstants::WashingMachine::CylinderHeight,
+            washingMachineCentre, RigidBodyConstants::WashingMachine::BladeRPM);
+
+        const int numRigidBodies = static_cast<int>(state.range(0));
+        const bool activeWriteBack = static_cast<int>(state.range(1)) == RigidBodyConstants::BenchmarkSettings::ActiveTransformWriteBack;
+
+        // the bulk write back only visits the moved bodies when the scene tracks its active actors
+        AzPhysics::SceneConfiguration sceneConfig = m_defaultScene->GetConfiguration();
+        sceneConfig.m_enableActiveActors = activeWriteBack;
+        m_defaultScene->UpdateConfiguration(sceneConfig);
+
+        Utils::GenerateSpawnPositionFuncPtr posGenerator = [washingMachineCentre, &rand](int idx) -> const AZ::Vector3 {
+            const float spawnArea = (RigidBodyConstants::TestRadius * 1.5f);
+            const float x = washingMachineCentre.GetX() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+            const float y = washingMachineCentre.GetY() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+            const float z = washingMachineCentre.GetZ() + RigidBodyConstants::WashingMachine::CylinderHeight + ((RigidBodyConstants::RigidBodys::BoxSize / 2.0f) * idx);
+            return AZ::Vector3(x, y, z);
+        };
+        Utils::GenerateSpawnOrientationFuncPtr oriGenerator = [&rand]([[maybe_unused]] int idx) -> AZ::Quaternion {
+            return AZ::CreateRandomQuaternion(rand);
+        };
+        Utils::GenerateMassFuncPtr massGenerator = [&rand]([[maybe_unused]] int idx) -> float {
+            return rand.GetRandomFloat() * 25.0f + 5.0f;
+        };
+        auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(RigidBodyConstants::RigidBodys::BoxSize));
+        Utils::GenerateColliderFuncPtr colliderGenerator = [&boxShapeConfiguration]([[maybe_unused]] int idx)
+        {
+            return boxShapeConfiguration;
+        };
+        AzPhysics::SimulatedBodyHandleList rigidBodies = Utils::CreateRigidBodies(numRigidBodies, m_defaultScene,
+            RigidBodyConstants::CCDEnabled, &colliderGenerator, &posGenerator, &oriGenerator, &massGenerator);
+
+        // the transforms written back, one per rigid body
+        AZStd::vector<AZ::Transform> entityTransforms(rigidBodies.size(), AZ::Transform::CreateIdentity());
+        AZ::u64 transformsWrittenBack = 0;
+
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler pollHandler(
+            [this, &rigidBodies, &entityTransforms, &transformsWrittenBack](AzPhysics::SceneHandle, float)
+            {
+                for (size_t i = 0; i < rigidBodies.size(); i++)
+                {
+                    if (AzPhysics::SimulatedBody* body = m_defaultScene->GetSimulatedBodyFromHandle(rigidBodies[i]))
+                    {
+                        entityTransforms[i] = body->GetTransform();
+                        transformsWrittenBack++;
+                    }
+                }
+            });
+        AZStd::vector<RigidBody::ActiveTransformEvent::Handler> activeTransformHandlers;
+        if (activeWriteBack)
+        {
+            activeTransformHandlers.reserve(rigidBodies.size());
+            for (size_t i = 0; i < rigidBodies.size(); i++)
+            {
+                AZ::Transform* entityTransform = &entityTransforms[i];
+                activeTransformHandlers.emplace_back([entityTransform, &transformsWrittenBack](const AZ::Transform& transform)
+                    {
+                        *entityTransform = transform;
+                        transformsWrittenBack++;
+                    });
+                if (auto* rigidBody = azrtti_cast<RigidBody*>(m_defaultScene->GetSimulatedBodyFromHandle(rigidBodies[i])))
+                {
+                    rigidBody->RegisterActiveTransformHandler(activeTransformHandlers.back());
+                }
+            }
+        }
+        else
+        {
+            m_defaultScene->RegisterSceneSimulationFinishHandler(pollHandler);
+        }
+
+        Utils::PrePostSimulationEventHandler subTickTracker;
+        subTickTracker.Start(m_defaultScene);
+
+        AZStd::vector<double> tickTimes;
+        tickTimes.reserve(RigidBodyConstants::GameFramesToSimulate);
+        for (auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < RigidBodyConstants::GameFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::system_clock::now();
+                StepScene1Tick(DefaultTimeStep);
+
+                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::system_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+            }
+        }
+        subTickTracker.Stop();
+        benchmark::DoNotOptimize(entityTransforms.data());
+
+        pollHandler.Disconnect();
+        activeTransformHandlers.clear();
+        washingMachine.TearDownWashingMachine();
+        m_defaultScene->RemoveSimulatedBodies(rigidBodies);
+        rigidBodies.clear();
+
+        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        state.counters["TransformsWrittenBack"] = static_cast<double>(transformsWrittenBack);
+    }
+
+    //! BM_RigidBody_MultipleScenes - Runs a washing machine simulation in each of the requested number of scenes.
+    //! All the scenes are stepped by the physics system, which simulates them concurrently.
+    //! Reports the mean simulation and finish time of a scene along with the frame times.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_MultipleScenes)(benchmark::State& state)
+    {
+        const int numScenes = static_cast<int>(state.range(0));
+        const int numRigidBodies = static_cast<int>(state.range(1));
+
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+
+        // the default scene is the first scene, create the others the same way.
+        AzPhysics::SceneHandleList sceneHandles = { m_testSceneHandle };
+        AZStd::vector<EntityPtr> terrainEntities;
+        for (int sceneIdx = 1; sceneIdx < numScenes; sceneIdx++)
+        {
+            AzPhysics::SceneConfiguration sceneConfig = GetDefaultSceneConfiguration();
+            sceneConfig.m_sceneName = AZStd::string::format("MultipleScenes-%d", sceneIdx);
+            sceneHandles.push_back(physicsSystem->AddScene(sceneConfig));
+            terrainEntities.push_back(PhysX::TestUtils::CreateFlatTestTerrain(
+                sceneHandles.back(), RigidBodyConstants::TerrainSize, RigidBodyConstants::TerrainSize));
+        }
+
+        AZ::SimpleLcgRandom rand;
+        rand.SetSeed(RigidBodyConstants::RandGenSeed);
+
+        const AZ::Vector3 washingMachineCentre(500.0f, 500.0f, 1.0f);
+        Utils::GenerateSpawnPositionFuncPtr posGenerator = [washingMachineCentre, &rand](int idx) -> const AZ::Vector3 {
+            const float spawnArea = (RigidBodyConstants::TestRadius * 1.5f);
+            const float x = washingMachineCentre.GetX() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+            const float y = washingMachineCentre.GetY() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+            const float z = washingMachineCentre.GetZ() + RigidBodyConstants::WashingMachine::CylinderHeight + ((RigidBodyConstants::RigidBodys::BoxSize / 2.0f) * idx);
+            return AZ::Vector3(x, y, z);
+        };
+        auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(RigidBodyConstants::RigidBodys::BoxSize));
+        Utils::GenerateColliderFuncPtr colliderGenerator = [&boxShapeConfiguration]([[maybe_unused]] int idx)
+        {
+            return boxShapeConfiguration;
+        };
+
+        // every scene gets its own washing machine and rigid bodies.
+        AZStd::vector<AZStd::unique_ptr<WashingMachine>> washingMachines;
+        AZStd::vector<AzPhysics::SimulatedBodyHandleList> rigidBodies;
+        for (const AzPhysics::SceneHandle& sceneHandle : sceneHandles)
+        {
+            washingMachines.emplace_back(AZStd::make_unique<WashingMachine>());
+            washingMachines.back()->SetupWashingMachine(
+                sceneHandle, RigidBodyConstants::TestRadius, RigidBodyConstants::WashingMachine::CylinderHeight,
+                washingMachineCentre, RigidBodyConstants::WashingMachine::BladeRPM);
+
+            rigidBodies.push_back(Utils::CreateRigidBodies(numRigidBodies, physicsSystem->GetScene(sceneHandle),
+                RigidBodyConstants::CCDEnabled, &colliderGenerator, &posGenerator));
+        }
+
+        //setup the sub tick tracker on the first scene
+        Utils::PrePostSimulationEventHandler subTickTracker;
+        subTickTracker.Start(m_defaultScene);
+
+        AZStd::vector<double> tickTimes;
+        tickTimes.reserve(RigidBodyConstants::GameFramesToSimulate);
+        double sceneSimulationTimeMs = 0.0;
+        double sceneFinishTimeMs = 0.0;
+        AZ::u64 sceneSteps = 0;
+        for (auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < RigidBodyConstants::GameFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::system_clock::now();
+                physicsSystem->Simulate(DefaultTimeStep);
+
+                //time each physics tick and store it to analyze
+                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::system_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+
+                for (const AzPhysics::SceneHandle& sceneHandle : sceneHandles)
+                {
+                    const SceneTimingStats& stats = GetPhysXSystem()->GetSceneTimingStats(sceneHandle);
+                    sceneSimulationTimeMs += stats.m_simulationTimeMs;
+                    sceneFinishTimeMs += stats.m_finishTimeMs;
+                    sceneSteps += stats.m_substeps;
+                }
+            }
+        }
+        subTickTracker.Stop();
+
+        //object clean up
+        for (size_t sceneIdx = 0; sceneIdx < sceneHandles.size(); sceneIdx++)
+        {
+            washingMachines[sceneIdx]->TearDownWashingMachine();
+            physicsSystem->GetScene(sceneHandles[sceneIdx])->RemoveSimulatedBodies(rigidBodies[sceneIdx]);
+        }
+        terrainEntities.clear();
+        physicsSystem->RemoveScenes(AzPhysics::SceneHandleList(sceneHandles.begin() + 1, sceneHandles.end()));
+
+        //sort the frame times and get the P50, P90, P99 percentiles
+        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        state.counters["SceneSimulation-Mean"] = sceneSteps > 0 ? sceneSimulationTimeMs / sceneSteps : 0.0;
+        state.counters["SceneFinish-Mean"] = sceneSteps > 0 ? sceneFinishTimeMs / sceneSteps : 0.0;
+    }
+
     BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_AtRest)
         ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
         ->Range(RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange)
@@ -515,6 +764,30 @@ namespace PhysX::Benchmarks
         ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
         ;
 
+    BENCHMARK_REGISTER_F(PhysXRigidbodyTaskExecutorBenchmarkFixture, BM_RigidBody_MovingAndColliding_TaskExecutor)
+        ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
+        ->Range(RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_TransformWriteBack)
+        ->Args({ RigidBodyConstants::BenchmarkSettings::WriteBackRigidBodies, RigidBodyConstants::BenchmarkSettings::PollTransformWriteBack })
+        ->Args({ RigidBodyConstants::BenchmarkSettings::WriteBackRigidBodies, RigidBodyConstants::BenchmarkSettings::ActiveTransformWriteBack })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_MultipleScenes)
+        ->Args({ 1, RigidBodyConstants::BenchmarkSettings::MultipleScenesRigidBodies })
+        ->Args({ 2, RigidBodyConstants::BenchmarkSettings::MultipleScenesRigidBodies })
+        ->Args({ 4, RigidBodyConstants::BenchmarkSettings::MultipleScenesRigidBodies })
+        ->Args({ 8, RigidBodyConstants::BenchmarkSettings::MultipleScenesRigidBodies })
+        ->Args({ 16, RigidBodyConstants::BenchmarkSettings::MultipleScenesRigidBodies })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
+        ;
+
     BENCHMARK_REGISTER_F(PhysXRigidbodyCollisionsBenchmarkFixture, BM_RigidBody_MovingAndColliding_CollisionHandlers)
         ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
         ->Ranges({ {RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange}, {RigidBodyConstants::BenchmarkSettings::AllCollisionHanders, RigidBodyConstants::BenchmarkSettings::AllCollisionHanders} })
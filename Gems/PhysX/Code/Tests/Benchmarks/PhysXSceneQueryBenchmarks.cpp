@@ -226,6 +226,99 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    //! Creates \batchSize raycast requests towards the boxes of the fixture.
+    AzPhysics::SceneQueryRequests CreateRaycastBatch(const std::vector<AZ::Vector3>& boxes, int64_t batchSize)
+    {
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(batchSize);
+        for (int64_t i = 0; i < batchSize; ++i)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = boxes[i % boxes.size()].GetNormalized();
+            request->m_distance = 2000.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+        return requests;
+    }
+
+    //! Baseline for BM_RaycastBatch: the same requests made one at a time on the calling thread.
+    //! state.range(2) - number of requests in the batch
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastSerialLoop)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastBatch(m_boxes, state.range(2));
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            for (const auto& request : requests)
+            {
+                AzPhysics::SceneQueryHits result = sceneInterface->QueryScene(m_testSceneHandle, request.get());
+                benchmark::DoNotOptimize(result);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
+    //! state.range(2) - number of requests in the batch
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatch)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastBatch(m_boxes, state.range(2));
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+            benchmark::DoNotOptimize(results);
+        }
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
+    //! Includes the cost of a simulation step, which is when the queued requests are run.
+    //! state.range(2) - number of requests in the batch
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatch)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastBatch(m_boxes, state.range(2));
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            size_t resultCount = 0;
+            [[maybe_unused]] const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 0, requests,
+                [&resultCount](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHitsList results)
+                {
+                    resultCount = results.size();
+                });
+            AZ_Assert(queued, "Failed to queue the async batch");
+            TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+            benchmark::DoNotOptimize(resultCount);
+        }
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
+    //! state.range(2) - number of requests in the batch
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_OverlapBatch)(benchmark::State& state)
+    {
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(state.range(2));
+        for (int64_t i = 0; i < state.range(2); ++i)
+        {
+            auto request = AZStd::make_shared<AzPhysics::OverlapRequest>(AzPhysics::OverlapRequestHelpers::CreateSphereOverlapRequest(
+                SceneQueryConstants::SphereShapeRadius,
+                AZ::Transform::CreateTranslation(m_boxes[i % m_numBoxes])
+            ));
+            requests.emplace_back(AZStd::move(request));
+        }
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+            benchmark::DoNotOptimize(results);
+        }
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
@@ -250,5 +343,35 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond)
         ;
+
+    // {number of boxes, max radius, number of requests in the batch}
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastSerialLoop)
+        ->Args({ 1024, 32, 1000 })
+        ->Args({ 1024, 32, 10000 })
+        ->Args({ 1024, 32, 100000 })
+        ->Unit(::benchmark::kMillisecond)
+        ->UseRealTime()
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatch)
+        ->Args({ 1024, 32, 1000 })
+        ->Args({ 1024, 32, 10000 })
+        ->Args({ 1024, 32, 100000 })
+        ->Unit(::benchmark::kMillisecond)
+        ->UseRealTime()
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatch)
+        ->Args({ 1024, 32, 1000 })
+        ->Args({ 1024, 32, 10000 })
+        ->Args({ 1024, 32, 100000 })
+        ->Unit(::benchmark::kMillisecond)
+        ->UseRealTime()
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_OverlapBatch)
+        ->Args({ 1024, 32, 1000 })
+        ->Args({ 1024, 32, 10000 })
+        ->Args({ 1024, 32, 100000 })
+        ->Unit(::benchmark::kMillisecond)
+        ->UseRealTime()
+        ;
 }
 #endif
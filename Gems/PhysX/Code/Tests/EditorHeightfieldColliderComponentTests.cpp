@@ -92,6 +92,27 @@ namespace PhysXEditorTests
         ON_CALL(mockShapeRequests, GetMaterialList).WillByDefault(Return(GetMaterialList()));
     }
 
+    physx::PxHeightField* GetPxHeightfield(AZ::EntityId entityId)
+    {
+        AzPhysics::SimulatedBody* staticBody = nullptr;
+        AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(
+            staticBody, entityId, &AzPhysics::SimulatedBodyComponentRequests::GetSimulatedBody);
+        if (!staticBody)
+        {
+            return nullptr;
+        }
+
+        const auto* pxRigidStatic = static_cast<const physx::PxRigidStatic*>(staticBody->GetNativePointer());
+        PHYSX_SCENE_READ_LOCK(pxRigidStatic->getScene());
+
+        physx::PxShape* shape = nullptr;
+        pxRigidStatic->getShapes(&shape, 1, 0);
+
+        physx::PxHeightFieldGeometry heightfieldGeometry;
+        shape->getHeightFieldGeometry(heightfieldGeometry);
+        return heightfieldGeometry.heightField;
+    }
+
     EntityPtr TestCreateActiveGameEntityFromEditorEntity(AZ::Entity* editorEntity)
     {
         EntityPtr gameEntity = AZStd::make_unique<AZ::Entity>();
@@ -373,5 +394,113 @@ namespace PhysXEditorTests
         }
     }
 
+    TEST_F(PhysXEditorHeightfieldFixture, HeightfieldColliderComponentUpdatesDirtyRegionInPlace)
+    {
+        AZ::EntityId gameEntityId = m_gameEntity->GetId();
+
+        // Change the height of the center sample, and only report that sample as dirty.
+        const Physics::HeightMaterialPoint modifiedSample(-2.0f, Physics::QuadMeshType::SubdivideUpperLeftToBottomRight, 1);
+        ON_CALL(*m_gameMockShapeRequests, GetHeightfieldIndicesFromRegion)
+            .WillByDefault(
+                []([[maybe_unused]] const AZ::Aabb& region, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows)
+                {
+                    startColumn = 1;
+                    startRow = 1;
+                    numColumns = 1;
+                    numRows = 1;
+                });
+        ON_CALL(*m_gameMockShapeRequests, UpdateHeightsAndMaterials)
+            .WillByDefault(
+                [modifiedSample](const Physics::UpdateHeightfieldSampleFunction& updateHeightsMaterialsCallback, [[maybe_unused]] const AZ::Aabb& region)
+                {
+                    updateHeightsMaterialsCallback(1, 1, modifiedSample);
+                });
+
+        physx::PxHeightField* heightfieldBefore = GetPxHeightfield(gameEntityId);
+        ASSERT_NE(heightfieldBefore, nullptr);
+
+        Physics::HeightfieldProviderNotificationBus::Event(
+            gameEntityId, &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged,
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(1.0f)));
+
+        // The existing heightfield should have been modified instead of being recreated.
+        physx::PxHeightField* heightfieldAfter = GetPxHeightfield(gameEntityId);
+        EXPECT_EQ(heightfieldAfter, heightfieldBefore);
+
+        const float scaleFactor = AZStd::numeric_limits<int16_t>::max() / 3.0f;
+        EXPECT_EQ(heightfieldAfter->getSample(1, 1).height, azlossy_cast<physx::PxI16>(modifiedSample.m_height * scaleFactor));
+
+        // The samples outside of the dirty region are unchanged.
+        EXPECT_EQ(heightfieldAfter->getSample(0, 0).height, azlossy_cast<physx::PxI16>(GetSamples()[0].m_height * scaleFactor));
+    }
+
+    TEST_F(PhysXEditorHeightfieldFixture, HeightfieldColliderComponentTilesMatchSingleHeightfield)
+    {
+        // Create a runtime heightfield collider split into single quad tiles, using the same heightfield data as the fixture.
+        EntityPtr tiledEntity = AZStd::make_unique<AZ::Entity>("TiledHeightfieldColliderEntity");
+        tiledEntity->CreateComponent<UnitTest::MockPhysXHeightfieldProviderComponent>();
+        auto* tiledCollider = tiledEntity->CreateComponent<PhysX::HeightfieldColliderComponent>();
+        tiledCollider->SetShapeConfiguration(
+            { AZStd::make_shared<Physics::ColliderConfiguration>(), AZStd::make_shared<Physics::HeightfieldShapeConfiguration>() });
+
+        PhysX::HeightfieldTileStreamingConfiguration tileStreamingConfig;
+        tileStreamingConfig.m_enabled = true;
+        tileStreamingConfig.m_tileSize = 1;
+        tiledCollider->SetTileStreamingConfiguration(tileStreamingConfig);
+        tiledEntity->Init();
+
+        NiceMock<UnitTest::MockPhysXHeightfieldProvider> tiledMockShapeRequests(tiledEntity->GetId());
+        SetupMockMethods(tiledMockShapeRequests);
+        ON_CALL(tiledMockShapeRequests, GetHeightfieldAabb)
+            .WillByDefault(Return(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.5f, 0.5f, -3.0f), AZ::Vector3(2.5f, 3.5f, 3.0f))));
+        ON_CALL(tiledMockShapeRequests, UpdateHeightsAndMaterials)
+            .WillByDefault(
+                [](const Physics::UpdateHeightfieldSampleFunction& updateHeightsMaterialsCallback, [[maybe_unused]] const AZ::Aabb& region)
+                {
+                    // Provide every sample, the tiles only keep the ones within their own range.
+                    const AZStd::vector<Physics::HeightMaterialPoint> samples = GetSamples();
+                    for (size_t index = 0; index < samples.size(); index++)
+                    {
+                        updateHeightsMaterialsCallback(index % 3, index / 3, samples[index]);
+                    }
+                });
+        tiledEntity->Activate();
+
+        // There isn't an active camera, so all of the 2x2 tiles get simulated.
+        AZStd::vector<AZStd::shared_ptr<Physics::Shape>> shapes;
+        PhysX::ColliderComponentRequestBus::EventResult(shapes, tiledEntity->GetId(), &PhysX::ColliderComponentRequests::GetShapes);
+        EXPECT_EQ(shapes.size(), 4);
+
+        bool physicsEnabled = false;
+        AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(
+            physicsEnabled, tiledEntity->GetId(), &AzPhysics::SimulatedBodyComponentRequests::IsPhysicsEnabled);
+        EXPECT_TRUE(physicsEnabled);
+
+        // Raycasts against the tiles should hit the same surface as raycasts against the single heightfield.
+        const AZStd::array<AZ::Vector2, 4> rayPositions = {
+            AZ::Vector2(-0.2f, 0.7f), AZ::Vector2(0.8f, 1.2f), AZ::Vector2(0.2f, 1.9f), AZ::Vector2(1.3f, 2.2f)
+        };
+        for (const AZ::Vector2& rayPosition : rayPositions)
+        {
+            AzPhysics::RayCastRequest request;
+            request.m_start = AZ::Vector3(rayPosition.GetX(), rayPosition.GetY(), 5.0f);
+            request.m_direction = AZ::Vector3(0.0f, 0.0f, -1.0f);
+            request.m_distance = 10.0f;
+
+            AzPhysics::SceneQueryHit singleHit;
+            AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(
+                singleHit, m_gameEntity->GetId(), &AzPhysics::SimulatedBodyComponentRequests::RayCast, request);
+            AzPhysics::SceneQueryHit tiledHit;
+            AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(
+                tiledHit, tiledEntity->GetId(), &AzPhysics::SimulatedBodyComponentRequests::RayCast, request);
+
+            ASSERT_TRUE(singleHit);
+            ASSERT_TRUE(tiledHit);
+            EXPECT_NEAR(tiledHit.m_distance, singleHit.m_distance, 0.001f);
+        }
+
+        tiledEntity->Deactivate();
+    }
+
 } // namespace PhysXEditorTests
 
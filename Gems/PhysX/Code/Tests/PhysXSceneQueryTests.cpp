@@ -1009,4 +1009,126 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_ReturnsSameHitsAsQueryScene)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        // Enough requests for the batch to be split across worker threads.
+        constexpr int BoxCount = 50;
+        constexpr int RequestCount = 1000;
+        for (int i = 0; i < BoxCount; ++i)
+        {
+            TestUtils::AddStaticBoxToScene(m_testSceneHandle, AZ::Vector3(aznumeric_cast<float>(i * 3), 0.0f, 10.0f));
+        }
+
+        AzPhysics::SceneQueryRequests requests;
+        for (int i = 0; i < RequestCount; ++i)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3(aznumeric_cast<float>(i % (BoxCount * 3)), 0.0f, 0.0f);
+            request->m_direction = AZ::Vector3::CreateAxisZ(1.0f);
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const AzPhysics::SceneQueryHits expectedResult = sceneInterface->QueryScene(m_testSceneHandle, requests[i].get());
+            ASSERT_EQ(results[i].m_hits.size(), expectedResult.m_hits.size());
+            for (size_t j = 0; j < results[i].m_hits.size(); j++)
+            {
+                EXPECT_TRUE(results[i].m_hits[j].m_bodyHandle == expectedResult.m_hits[j].m_bodyHandle);
+            }
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_CallbackIsCalledAfterSimulation)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AzPhysics::SimulatedBodyHandle boxHandle = TestUtils::AddStaticBoxToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f));
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3::CreateZero();
+        request.m_direction = AZ::Vector3::CreateAxisX(1.0f);
+        request.m_distance = 200.0f;
+
+        static constexpr AzPhysics::SceneQuery::AsyncRequestId RequestId = 42;
+        int callbackCount = 0;
+        AzPhysics::SceneQueryHits results;
+        const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, RequestId, &request,
+            [&callbackCount, &results](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHits hits)
+            {
+                EXPECT_EQ(requestId, RequestId);
+                results = AZStd::move(hits);
+                ++callbackCount;
+            });
+        ASSERT_TRUE(queued);
+
+        // The request was copied, changing it doesn't affect the queued query.
+        request.m_direction = AZ::Vector3::CreateAxisY(1.0f);
+        EXPECT_EQ(callbackCount, 0);
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        EXPECT_EQ(callbackCount, 1);
+        ASSERT_EQ(results.m_hits.size(), 1);
+        EXPECT_TRUE(results.m_hits[0].m_bodyHandle == boxHandle);
+
+        // The callback is only called once.
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        EXPECT_EQ(callbackCount, 1);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_CallbacksReceiveTheirOwnResults)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> boxHandles;
+        AzPhysics::SceneQueryRequests requests;
+        for (const AZ::Vector3& position : positions)
+        {
+            boxHandles.emplace_back(TestUtils::AddStaticBoxToScene(m_testSceneHandle, position));
+
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = position.GetNormalized();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        // Two batches in the same frame, the second one with the requests in reverse order.
+        AzPhysics::SceneQueryRequests reversedRequests(requests.rbegin(), requests.rend());
+        AZStd::vector<AzPhysics::SceneQueryHitsList> results(2);
+        for (AzPhysics::SceneQuery::AsyncRequestId requestId = 0; requestId < 2; ++requestId)
+        {
+            const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, requestId, requestId == 0 ? requests : reversedRequests,
+                [&results](AzPhysics::SceneQuery::AsyncRequestId callbackRequestId, AzPhysics::SceneQueryHitsList hits)
+                {
+                    results[callbackRequestId] = AZStd::move(hits);
+                });
+            ASSERT_TRUE(queued);
+        }
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+
+        ASSERT_EQ(results[0].size(), positions.size());
+        ASSERT_EQ(results[1].size(), positions.size());
+        for (size_t i = 0; i < positions.size(); i++)
+        {
+            ASSERT_EQ(results[0][i].m_hits.size(), 1);
+            EXPECT_TRUE(results[0][i].m_hits[0].m_bodyHandle == boxHandles[i]);
+            ASSERT_EQ(results[1][i].m_hits.size(), 1);
+            EXPECT_TRUE(results[1][i].m_hits[0].m_bodyHandle == boxHandles[positions.size() - 1 - i]);
+        }
+    }
 }
@@ -11,6 +11,8 @@
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <Source/RigidBody.h>
+#include <Source/Scene/PhysXScene.h>
 
 namespace PhysX
 {
@@ -519,6 +521,73 @@ namespace PhysX
         EXPECT_TRUE(eventTriggered);
     }
 
+    // Checks that only the rigid bodies moved by a simulation step have their transforms written back.
+    void CheckOnlyMovedRigidBodiesWrittenBack(AzPhysics::SceneHandle testSceneHandle)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        auto* scene = azrtti_cast<PhysXScene*>(physicsSystem->GetScene(testSceneHandle));
+        ASSERT_NE(scene, nullptr);
+
+        AzPhysics::ShapeColliderPair shapeColliderData(
+            AZStd::make_shared<Physics::ColliderConfiguration>(),
+            AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3::CreateOne()));
+
+        // static and sleeping bodies are not moved by the simulation, so they are not expected to be written back
+        AzPhysics::StaticRigidBodyConfiguration staticConfig;
+        staticConfig.m_colliderAndShapeData = shapeColliderData;
+        sceneInterface->AddSimulatedBody(testSceneHandle, &staticConfig);
+
+        AzPhysics::RigidBodyConfiguration sleepingConfig;
+        sleepingConfig.m_colliderAndShapeData = shapeColliderData;
+        sleepingConfig.m_position = AZ::Vector3(10.0f, 0.0f, 0.0f);
+        sleepingConfig.m_startAsleep = true;
+        sceneInterface->AddSimulatedBody(testSceneHandle, &sleepingConfig);
+
+        AzPhysics::RigidBodyConfiguration fallingConfig;
+        fallingConfig.m_colliderAndShapeData = shapeColliderData;
+        fallingConfig.m_position = AZ::Vector3(20.0f, 0.0f, 10.0f);
+        AzPhysics::SimulatedBodyHandle fallingHandle = sceneInterface->AddSimulatedBody(testSceneHandle, &fallingConfig);
+        auto* fallingBody = azrtti_cast<RigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(testSceneHandle, fallingHandle));
+        ASSERT_NE(fallingBody, nullptr);
+
+        int batchCount = 0;
+        PhysXScene::ActiveBodyTransformList batchTransforms;
+        PhysXScene::OnSceneActiveBodyTransformsEvent::Handler batchHandler(
+            [&batchCount, &batchTransforms](AzPhysics::SceneHandle, const PhysXScene::ActiveBodyTransformList& transforms)
+            {
+                batchCount++;
+                batchTransforms = transforms;
+            });
+        scene->RegisterSceneActiveBodyTransformsHandler(batchHandler);
+
+        int bodyCount = 0;
+        AZ::Transform bodyTransform = AZ::Transform::CreateIdentity();
+        RigidBody::ActiveTransformEvent::Handler bodyHandler(
+            [&bodyCount, &bodyTransform](const AZ::Transform& transform)
+            {
+                bodyCount++;
+                bodyTransform = transform;
+            });
+        fallingBody->RegisterActiveTransformHandler(bodyHandler);
+
+        TestUtils::UpdateScene(testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+
+        EXPECT_EQ(batchCount, 1);
+        EXPECT_EQ(bodyCount, 1);
+        ASSERT_EQ(batchTransforms.size(), 1);
+        EXPECT_TRUE(batchTransforms[0].m_bodyHandle == fallingHandle);
+        EXPECT_TRUE(batchTransforms[0].m_transform.IsClose(fallingBody->GetTransform()));
+        EXPECT_TRUE(bodyTransform.IsClose(fallingBody->GetTransform()));
+        EXPECT_LT(bodyTransform.GetTranslation().GetZ(), fallingConfig.m_position.GetZ());
+    }
+
+    TEST_F(PhysXSceneFixture, ActiveBodyTransforms_OnlyMovedRigidBodiesWrittenBack)
+    {
+        // without active actor tracking, the awake rigid bodies are written back
+        CheckOnlyMovedRigidBodiesWrittenBack(m_testSceneHandle);
+    }
+
     class PhysXSceneActiveSimulatedBodiesFixture
         : public testing::Test
     {
@@ -585,4 +654,10 @@ namespace PhysX
 
         EXPECT_TRUE(handlerTriggered);
     }
+
+    TEST_F(PhysXSceneActiveSimulatedBodiesFixture, ActiveBodyTransforms_OnlyMovedRigidBodiesWrittenBack)
+    {
+        // with active actor tracking, the bodies reported as active by PhysX are written back
+        CheckOnlyMovedRigidBodiesWrittenBack(m_testSceneHandle);
+    }
 }
@@ -11,8 +11,12 @@
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
+#include <Scene/PhysXScene.h>
+#include <System/PhysXSystem.h>
 
 namespace PhysX
 {
@@ -317,4 +321,128 @@ namespace PhysX
         physicsSystem->RemoveScenes(sceneHandles);
         EXPECT_EQ(removedCount, m_sceneConfigs.size());
     }
+
+    TEST_F(PhysXSystemFixture, TaskExecutorCpuDispatcher_SimulatesScene)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        PhysXSystemConfiguration preTestConfig;
+        if (const auto* config = azdynamic_cast<const PhysXSystemConfiguration*>(physicsSystem->GetConfiguration()))
+        {
+            preTestConfig = *config;
+        }
+
+        // the dispatcher is replaced when the next scene is added
+        PhysXSystemConfiguration taskExecutorConfig = preTestConfig;
+        taskExecutorConfig.m_cpuDispatcherType = CpuDispatcherType::TaskExecutor;
+        taskExecutorConfig.m_cpuDispatcherWorkerCount = 2;
+        physicsSystem->UpdateConfiguration(&taskExecutorConfig);
+
+        AzPhysics::SceneHandle sceneHandle = physicsSystem->AddScene(m_sceneConfigs[0]);
+        ASSERT_TRUE(sceneHandle != AzPhysics::InvalidSceneHandle);
+
+        // add enough bodies for the simulation to be split into several tasks
+        constexpr int NumBodies = 64;
+        AzPhysics::RigidBodyConfiguration rigidConfig;
+        rigidConfig.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(
+            AZStd::make_shared<Physics::ColliderConfiguration>(),
+            AZStd::make_shared<Physics::SphereShapeConfiguration>(0.5f));
+        AzPhysics::SimulatedBodyHandleList bodyHandles;
+        for (int i = 0; i < NumBodies; i++)
+        {
+            rigidConfig.m_position = AZ::Vector3(2.0f * i, 0.0f, 10.0f);
+            bodyHandles.push_back(sceneInterface->AddSimulatedBody(sceneHandle, &rigidConfig));
+        }
+
+        TestUtils::UpdateScene(sceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 30);
+
+        for (AzPhysics::SimulatedBodyHandle bodyHandle : bodyHandles)
+        {
+            AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, bodyHandle);
+            ASSERT_NE(body, nullptr);
+            EXPECT_LT(body->GetPosition().GetZ(), 10.0f);
+        }
+
+        physicsSystem->RemoveScene(sceneHandle);
+        physicsSystem->UpdateConfiguration(&preTestConfig);
+    }
+
+    TEST_F(PhysXSystemFixture, SceneScheduler_StepsScenesWithTheirOwnSettings_FinishesInSceneOrderAfterAllSimulations)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        // timesteps exactly representable as floats, so the number of steps doesn't depend on rounding.
+        const float frameDeltaTime = 0.0625f;
+        const float sceneTimestep = 0.03125f;
+
+        AzPhysics::SceneHandleList sceneHandles;
+        for (int i = 0; i < 3; i++)
+        {
+            sceneHandles.push_back(physicsSystem->AddScene(m_sceneConfigs[i]));
+        }
+
+        // The first scene follows the system timestep, the second has its own timestep and the third is limited to one step.
+        SceneStepSettings stepSettings;
+        stepSettings.m_fixedTimestep = sceneTimestep;
+        GetPhysXSystem()->SetSceneStepSettings(sceneHandles[1], stepSettings);
+        stepSettings.m_maxSubsteps = 1;
+        GetPhysXSystem()->SetSceneStepSettings(sceneHandles[2], stepSettings);
+
+        // The events of a scene are only flushed once no other scene is simulating anymore.
+        AZStd::vector<PhysXScene*> scenes;
+        for (AzPhysics::SceneHandle sceneHandle : sceneHandles)
+        {
+            scenes.push_back(azrtti_cast<PhysXScene*>(physicsSystem->GetScene(sceneHandle)));
+            ASSERT_NE(scenes.back(), nullptr);
+        }
+
+        AZStd::vector<size_t> finishOrder;
+        AZStd::vector<AzPhysics::SceneEvents::OnSceneSimulationFinishHandler> finishHandlers;
+        finishHandlers.reserve(sceneHandles.size());
+        for (size_t i = 0; i < sceneHandles.size(); i++)
+        {
+            finishHandlers.emplace_back(
+                [&finishOrder, &scenes, i]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltatime)
+                {
+                    finishOrder.push_back(i);
+                    for (const PhysXScene* scene : scenes)
+                    {
+                        EXPECT_FALSE(scene->IsSimulating());
+                    }
+                });
+            sceneInterface->RegisterSceneSimulationFinishHandler(sceneHandles[i], finishHandlers.back());
+        }
+
+        physicsSystem->Simulate(frameDeltaTime);
+
+        const SceneTimingStats& ownTimestepStats = GetPhysXSystem()->GetSceneTimingStats(sceneHandles[1]);
+        EXPECT_EQ(ownTimestepStats.m_substeps, 2u);
+        EXPECT_NEAR(ownTimestepStats.m_simulatedTime, frameDeltaTime, 0.0001f);
+        EXPECT_NEAR(ownTimestepStats.m_droppedTime, 0.0f, 0.0001f);
+        EXPECT_GE(ownTimestepStats.m_simulationTimeMs, ownTimestepStats.m_finishTimeMs);
+
+        const SceneTimingStats& budgetedStats = GetPhysXSystem()->GetSceneTimingStats(sceneHandles[2]);
+        EXPECT_EQ(budgetedStats.m_substeps, 1u);
+        EXPECT_NEAR(budgetedStats.m_simulatedTime, sceneTimestep, 0.0001f);
+        EXPECT_NEAR(budgetedStats.m_droppedTime, sceneTimestep, 0.0001f);
+
+        // Each round finishes one step of every scene with steps left, in the order of the scenes.
+        AZStd::vector<size_t> expectedFinishOrder;
+        for (AZ::u32 round = 0; round < 8; round++)
+        {
+            for (size_t i = 0; i < sceneHandles.size(); i++)
+            {
+                if (GetPhysXSystem()->GetSceneTimingStats(sceneHandles[i]).m_substeps > round)
+                {
+                    expectedFinishOrder.push_back(i);
+                }
+            }
+        }
+        EXPECT_GT(GetPhysXSystem()->GetSceneTimingStats(sceneHandles[0]).m_substeps, 0u);
+        EXPECT_EQ(finishOrder, expectedFinishOrder);
+
+        physicsSystem->RemoveScenes(sceneHandles);
+    }
 }
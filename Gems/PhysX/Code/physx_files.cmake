@@ -130,6 +130,10 @@ set(FILES
     Source/System/PhysXCpuDispatcher.h
     Source/System/PhysXJob.cpp
     Source/System/PhysXJob.h
+    Source/System/PhysXSceneScheduler.cpp
+    Source/System/PhysXSceneScheduler.h
+    Source/System/PhysXTaskExecutorCpuDispatcher.cpp
+    Source/System/PhysXTaskExecutorCpuDispatcher.h
     Source/System/PhysXJointInterface.h
     Source/System/PhysXJointInterface.cpp
     Source/System/PhysXSdkCallbacks.h
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <SurfaceData/SurfaceDataTypes.h>
+
+namespace SurfaceData
+{
+    /**
+    * The surface points for a list or region of input positions, stored in flat arrays.
+    * A SurfacePointLists result allocates a list for every input position and a map of tag weights for every surface point.
+    * This list stores the positions, normals, entity ids and tag weights of all the points in shared arrays instead, which are
+    * indexed by point, and keeps the points of every input position together. The arrays keep their memory between queries,
+    * so reusing a list for repeated queries doesn't allocate at all once it has grown to its working size.
+    *
+    * The list is built in two phases:
+    * - Between StartListConstruction() and EndListConstruction(), the surface providers add points, and the surface modifiers
+    *   add tag weights to them. The points of the different input positions can be added in any order.
+    * - EndListConstruction() filters the points by the desired tags, combines points that are effectively identical, and sorts
+    *   the points of every input position the same way as GetSurfacePoints(). After that the list can be read by input position.
+    */
+    class PackedSurfacePointList final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PackedSurfacePointList, AZ::SystemAllocator, 0);
+
+        struct TagWeight
+        {
+            AZ::Crc32 m_tag;
+            float m_weight = 0.0f;
+        };
+
+        //! Remove all of the input positions and points from the list. The list keeps its memory for the next query.
+        void Clear();
+
+        //! Start building the list for a set of input positions. This clears the previous contents of the list.
+        void StartListConstruction(AZStd::span<const AZ::Vector3> inPositions);
+
+        //! Start building the list for the input positions of a region, starting at the min sides of inRegion and incrementing by
+        //! stepSize. This is inclusive on the min sides of the region, and exclusive on the max sides, like
+        //! SurfaceDataSystemRequests::GetSurfacePointsFromRegion().
+        void StartListConstruction(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize);
+
+        //! Add a surface point for an input position, and return the index of the new point.
+        size_t AddSurfacePoint(size_t inputIndex, const AZ::EntityId& entityId, const AZ::Vector3& position, const AZ::Vector3& normal);
+        size_t AddSurfacePoint(
+            size_t inputIndex, const AZ::EntityId& entityId, const AZ::Vector3& position, const AZ::Vector3& normal,
+            const SurfaceTagWeightMap& masks);
+
+        //! Add tag weights to a point that was added during the construction of the list. Tags that the point already has keep
+        //! the larger of the two weights.
+        void AddMaxValueForMasks(size_t pointIndex, const AZ::Crc32 tag, float weight);
+        void AddMaxValueForMasks(size_t pointIndex, const SurfaceTagVector& tags, float weight);
+        void AddMaxValueForMasks(size_t pointIndex, const SurfaceTagWeightMap& masks);
+
+        //! Filter, combine and sort the points that were added to the list.
+        //! @param desiredTags - Points that don't have any of these tags are removed. If there are no valid tags, all points are kept.
+        void EndListConstruction(const SurfaceTagVector& desiredTags);
+
+        bool IsConstructing() const { return m_constructing; }
+
+        size_t GetInputPositionCount() const { return m_inputPositions.size(); }
+        const AZ::Vector3& GetInputPosition(size_t inputIndex) const { return m_inputPositions[inputIndex]; }
+        AZStd::span<const AZ::Vector3> GetInputPositions() const { return m_inputPositions; }
+
+        //! The points of the list. During construction the points are in the order that they were added in, afterwards the points
+        //! of every input position are stored contiguously.
+        size_t GetPointCount() const { return m_positions.size(); }
+        bool IsEmpty() const { return m_positions.empty(); }
+        AZStd::span<const AZ::Vector3> GetPositions() const { return m_positions; }
+        AZStd::span<const AZ::Vector3> GetNormals() const { return m_normals; }
+        AZStd::span<const AZ::EntityId> GetEntityIds() const { return m_entityIds; }
+
+        //! The input position that every point belongs to.
+        AZStd::span<const AZ::u32> GetInputIndices() const { return m_inputIndices; }
+
+        //! The range of points [begin, end) of an input position. Only valid after EndListConstruction().
+        size_t GetPointBegin(size_t inputIndex) const { return m_inputPointOffsets[inputIndex]; }
+        size_t GetPointEnd(size_t inputIndex) const { return m_inputPointOffsets[inputIndex + 1]; }
+
+        //! The tag weights of a point. Only valid after EndListConstruction().
+        AZStd::span<const TagWeight> GetTagWeights(size_t pointIndex) const;
+
+        //! Copy the points of the list into a list of surface points per input position. Only valid after EndListConstruction().
+        void ConvertToSurfacePointLists(SurfacePointLists& surfacePointLists) const;
+        void ConvertToSurfacePointList(size_t inputIndex, SurfacePointList& surfacePointList) const;
+
+    private:
+        struct PendingTagWeight
+        {
+            AZ::u32 m_pointIndex = 0;
+            TagWeight m_tagWeight;
+        };
+
+        void GroupTagWeightsByPoint();
+        bool HasMatchingTags(size_t pointIndex, const SurfaceTagVector& desiredTags) const;
+
+        bool m_constructing = false;
+
+        AZStd::vector<AZ::Vector3> m_inputPositions;
+
+        // The points of the list, indexed by point.
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_normals;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::u32> m_inputIndices;
+
+        // The tag weights of point i are m_tagWeights[m_tagOffsets[i]] to m_tagWeights[m_tagOffsets[i + 1]].
+        AZStd::vector<AZ::u32> m_tagOffsets;
+        AZStd::vector<TagWeight> m_tagWeights;
+
+        // The points of input position i are the points m_inputPointOffsets[i] to m_inputPointOffsets[i + 1].
+        AZStd::vector<AZ::u32> m_inputPointOffsets;
+
+        // The tag weights that get added during construction, in the order that they were added in.
+        AZStd::vector<PendingTagWeight> m_pendingTagWeights;
+
+        // Scratch buffers that keep their memory between queries.
+        AZStd::vector<AZ::u32> m_filteredPointIndices;
+        AZStd::vector<AZ::u32> m_sortedPointIndices;
+        AZStd::vector<AZ::Vector3> m_scratchPositions;
+        AZStd::vector<AZ::Vector3> m_scratchNormals;
+        AZStd::vector<AZ::EntityId> m_scratchEntityIds;
+        AZStd::vector<AZ::u32> m_scratchInputIndices;
+        AZStd::vector<AZ::u32> m_scratchTagOffsets;
+        AZStd::vector<TagWeight> m_scratchTagWeights;
+    };
+}
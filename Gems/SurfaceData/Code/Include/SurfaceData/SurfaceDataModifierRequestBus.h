@@ -10,6 +10,8 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/span.h>
+#include <SurfaceData/PackedSurfacePointList.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 
 namespace SurfaceData
@@ -32,6 +34,32 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void ModifySurfacePoints(SurfacePointList& surfacePointList) const = 0;
+
+        //! Add tags to a set of surface points in a packed list.
+        //! The default implementation copies the points into a SurfacePointList and calls ModifySurfacePoints(). Modifiers only
+        //! add tags to points, so the copies don't include the tags that the points already have. Modifiers can override this to
+        //! process all of the points at once.
+        //! @param pointIndices - The indices of the points in surfacePointList to modify.
+        //! @param surfacePointList - The packed list that is being constructed.
+        virtual void ModifySurfacePointsFromList(AZStd::span<const size_t> pointIndices, PackedSurfacePointList& surfacePointList) const
+        {
+            SurfacePointList points;
+            points.resize(pointIndices.size());
+            for (size_t index = 0; index < pointIndices.size(); index++)
+            {
+                const size_t pointIndex = pointIndices[index];
+                points[index].m_entityId = surfacePointList.GetEntityIds()[pointIndex];
+                points[index].m_position = surfacePointList.GetPositions()[pointIndex];
+                points[index].m_normal = surfacePointList.GetNormals()[pointIndex];
+            }
+
+            ModifySurfacePoints(points);
+
+            for (size_t index = 0; index < pointIndices.size(); index++)
+            {
+                surfacePointList.AddMaxValueForMasks(pointIndices[index], points[index].m_masks);
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataModifierRequests> SurfaceDataModifierRequestBus;
@@ -9,6 +9,8 @@
 #pragma once
 
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/std/containers/span.h>
+#include <SurfaceData/PackedSurfacePointList.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 
 namespace SurfaceData
@@ -35,6 +37,26 @@ namespace SurfaceData
         //! @param surfacePointList - The output list of surface points generated, if any. Each provider is expected to
         //! append to this list, not overwrite it.
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const = 0;
+
+        //! Get all of the surface points that this provider has at a set of input positions, and add them to a packed list.
+        //! The default implementation calls GetSurfacePoints() for every input position. Providers can override this to process
+        //! all of the positions at once.
+        //! @param inputIndices - The indices of the input positions in surfacePointList to query. Only XY of the input positions
+        //! are guaranteed to be valid, Z should be ignored.
+        //! @param surfacePointList - The packed list that is being constructed. Each provider is expected to add its points to it.
+        virtual void GetSurfacePointsFromList(AZStd::span<const size_t> inputIndices, PackedSurfacePointList& surfacePointList) const
+        {
+            SurfacePointList points;
+            for (size_t inputIndex : inputIndices)
+            {
+                points.clear();
+                GetSurfacePoints(surfacePointList.GetInputPosition(inputIndex), points);
+                for (const auto& point : points)
+                {
+                    surfacePointList.AddSurfacePoint(inputIndex, point.m_entityId, point.m_position, point.m_normal, point.m_masks);
+                }
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataProviderRequests> SurfaceDataProviderRequestBus;
@@ -13,6 +13,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector2.h>
 #include <AzCore/std/containers/span.h>
+#include <SurfaceData/PackedSurfacePointList.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 
 namespace SurfaceData
@@ -48,6 +49,18 @@ namespace SurfaceData
             const SurfaceTagVector& desiredTags,
             SurfacePointLists& surfacePointLists) const = 0;
 
+        // Get all surface points for every input position within an AABB region, in a packed list. The input positions are the
+        // same as for GetSurfacePointsFromRegion(). The packed list keeps its memory, so reusing it for repeated queries avoids
+        // almost all of the allocations of the SurfacePointLists version.
+        virtual void GetPackedSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
+                                                      PackedSurfacePointList& surfacePointList) const = 0;
+
+        // Get all surface points for every passed-in input position, in a packed list.  Only the XY dimensions of each position are used.
+        virtual void GetPackedSurfacePointsFromList(
+            AZStd::span<const AZ::Vector3> inPositions,
+            const SurfaceTagVector& desiredTags,
+            PackedSurfacePointList& surfacePointList) const = 0;
+
         virtual SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) = 0;
         virtual void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) = 0;
         virtual void UpdateSurfaceDataProvider(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry) = 0;
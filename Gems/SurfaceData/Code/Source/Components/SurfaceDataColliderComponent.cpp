@@ -246,6 +246,25 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataColliderComponent::GetSurfacePointsFromList(
+        AZStd::span<const size_t> inputIndices, PackedSurfacePointList& surfacePointList) const
+    {
+        AZ::Vector3 hitPosition;
+        AZ::Vector3 hitNormal;
+
+        // We want a full raycast, so don't just query the start point.
+        constexpr bool queryPointOnly = false;
+
+        const AZ::EntityId entityId = GetEntityId();
+        for (size_t inputIndex : inputIndices)
+        {
+            if (DoRayTrace(surfacePointList.GetInputPosition(inputIndex), queryPointOnly, hitPosition, hitNormal))
+            {
+                surfacePointList.AddSurfacePoint(inputIndex, entityId, hitPosition, hitNormal, m_newPointWeights);
+            }
+        }
+    }
+
     void SurfaceDataColliderComponent::ModifySurfacePoints(SurfacePointList& surfacePointList) const
     {
         AZStd::shared_lock<decltype(m_cacheMutex)> lock(m_cacheMutex);
@@ -269,6 +288,32 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataColliderComponent::ModifySurfacePointsFromList(
+        AZStd::span<const size_t> pointIndices, PackedSurfacePointList& surfacePointList) const
+    {
+        AZStd::shared_lock<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_colliderBounds.IsValid() && !m_configuration.m_modifierTags.empty())
+        {
+            const AZ::EntityId entityId = GetEntityId();
+            const AZStd::span<const AZ::Vector3> positions = surfacePointList.GetPositions();
+            const AZStd::span<const AZ::EntityId> entityIds = surfacePointList.GetEntityIds();
+            for (size_t pointIndex : pointIndices)
+            {
+                if (entityIds[pointIndex] != entityId && m_colliderBounds.Contains(positions[pointIndex]))
+                {
+                    AZ::Vector3 hitPosition;
+                    AZ::Vector3 hitNormal;
+                    constexpr bool queryPointOnly = true;
+                    if (DoRayTrace(positions[pointIndex], queryPointOnly, hitPosition, hitNormal))
+                    {
+                        surfacePointList.AddMaxValueForMasks(pointIndex, m_configuration.m_modifierTags, 1.0f);
+                    }
+                }
+            }
+        }
+    }
+
     void SurfaceDataColliderComponent::OnCompositionChanged()
     {
         if (!m_refresh)
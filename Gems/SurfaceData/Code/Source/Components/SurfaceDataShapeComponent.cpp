@@ -165,6 +165,38 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataShapeComponent::GetSurfacePointsFromList(
+        AZStd::span<const size_t> inputIndices, PackedSurfacePointList& surfacePointList) const
+    {
+        AZStd::shared_lock<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid)
+        {
+            const AZ::EntityId entityId = GetEntityId();
+            const AZ::Vector3 rayDirection = -AZ::Vector3::CreateAxisZ();
+            const float rayOriginZ = m_shapeBounds.GetMax().GetZ();
+
+            // Intersect all of the rays within a single shape bus call.
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                entityId,
+                [this, entityId, &rayDirection, rayOriginZ, inputIndices, &surfacePointList](LmbrCentral::ShapeComponentRequestsBus::Events* shape)
+                {
+                    for (size_t inputIndex : inputIndices)
+                    {
+                        const AZ::Vector3& inPosition = surfacePointList.GetInputPosition(inputIndex);
+                        const AZ::Vector3 rayOrigin = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), rayOriginZ);
+                        float intersectionDistance = 0.0f;
+                        if (shape->IntersectRay(rayOrigin, rayDirection, intersectionDistance))
+                        {
+                            surfacePointList.AddSurfacePoint(
+                                inputIndex, entityId, rayOrigin + intersectionDistance * rayDirection, AZ::Vector3::CreateAxisZ(),
+                                m_newPointWeights);
+                        }
+                    }
+                });
+        }
+    }
+
     void SurfaceDataShapeComponent::ModifySurfacePoints(SurfacePointList& surfacePointList) const
     {
         AZStd::shared_lock<decltype(m_cacheMutex)> lock(m_cacheMutex);
@@ -191,6 +223,32 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataShapeComponent::ModifySurfacePointsFromList(
+        AZStd::span<const size_t> pointIndices, PackedSurfacePointList& surfacePointList) const
+    {
+        AZStd::shared_lock<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid && !m_configuration.m_modifierTags.empty())
+        {
+            const AZ::EntityId entityId = GetEntityId();
+            const AZStd::span<const AZ::Vector3> positions = surfacePointList.GetPositions();
+            const AZStd::span<const AZ::EntityId> entityIds = surfacePointList.GetEntityIds();
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                entityId,
+                [entityId, this, pointIndices, positions, entityIds, &surfacePointList](LmbrCentral::ShapeComponentRequestsBus::Events* shape)
+                {
+                    for (size_t pointIndex : pointIndices)
+                    {
+                        const AZ::Vector3& position = positions[pointIndex];
+                        if (entityIds[pointIndex] != entityId && m_shapeBounds.Contains(position) && shape->IsPointInside(position))
+                        {
+                            surfacePointList.AddMaxValueForMasks(pointIndex, m_configuration.m_modifierTags, 1.0f);
+                        }
+                    }
+                });
+        }
+    }
+
     void SurfaceDataShapeComponent::OnTransformChanged(const AZ::Transform& /*local*/, const AZ::Transform& /*world*/)
     {
         OnCompositionChanged();
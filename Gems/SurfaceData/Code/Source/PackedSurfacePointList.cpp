@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/sort.h>
+
+#include <SurfaceData/PackedSurfacePointList.h>
+#include <SurfaceData/Utility/SurfaceDataUtility.h>
+
+namespace SurfaceData
+{
+    void PackedSurfacePointList::Clear()
+    {
+        m_constructing = false;
+        m_inputPositions.clear();
+        m_positions.clear();
+        m_normals.clear();
+        m_entityIds.clear();
+        m_inputIndices.clear();
+        m_tagOffsets.clear();
+        m_tagWeights.clear();
+        m_inputPointOffsets.clear();
+        m_pendingTagWeights.clear();
+    }
+
+    void PackedSurfacePointList::StartListConstruction(AZStd::span<const AZ::Vector3> inPositions)
+    {
+        Clear();
+        m_inputPositions.assign(inPositions.begin(), inPositions.end());
+        m_constructing = true;
+    }
+
+    void PackedSurfacePointList::StartListConstruction(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize)
+    {
+        Clear();
+
+        const size_t totalQueryPositions = aznumeric_cast<size_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) *
+            aznumeric_cast<size_t>(ceil(inRegion.GetYExtent() / stepSize.GetY()));
+        m_inputPositions.reserve(totalQueryPositions);
+
+        // This uses the same loop as GetSurfacePointsFromRegion() always has, so that the input positions are identical.
+        for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
+        {
+            for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
+            {
+                m_inputPositions.emplace_back(x, y, AZ::Constants::FloatMax);
+            }
+        }
+
+        m_constructing = true;
+    }
+
+    size_t PackedSurfacePointList::AddSurfacePoint(
+        size_t inputIndex, const AZ::EntityId& entityId, const AZ::Vector3& position, const AZ::Vector3& normal)
+    {
+        AZ_Assert(m_constructing, "Surface points can only be added between StartListConstruction() and EndListConstruction().");
+        AZ_Assert(inputIndex < m_inputPositions.size(), "Input index %zu is out of range (%zu input positions).",
+            inputIndex, m_inputPositions.size());
+
+        m_positions.emplace_back(position);
+        m_normals.emplace_back(normal);
+        m_entityIds.emplace_back(entityId);
+        m_inputIndices.emplace_back(aznumeric_cast<AZ::u32>(inputIndex));
+        return m_positions.size() - 1;
+    }
+
+    size_t PackedSurfacePointList::AddSurfacePoint(
+        size_t inputIndex, const AZ::EntityId& entityId, const AZ::Vector3& position, const AZ::Vector3& normal,
+        const SurfaceTagWeightMap& masks)
+    {
+        const size_t pointIndex = AddSurfacePoint(inputIndex, entityId, position, normal);
+        AddMaxValueForMasks(pointIndex, masks);
+        return pointIndex;
+    }
+
+    void PackedSurfacePointList::AddMaxValueForMasks(size_t pointIndex, const AZ::Crc32 tag, float weight)
+    {
+        AZ_Assert(m_constructing, "Tag weights can only be added between StartListConstruction() and EndListConstruction().");
+        AZ_Assert(pointIndex < m_positions.size(), "Point index %zu is out of range (%zu points).", pointIndex, m_positions.size());
+
+        // The tag weights just get recorded here. Duplicate tags get merged once in EndListConstruction().
+        m_pendingTagWeights.push_back({ aznumeric_cast<AZ::u32>(pointIndex), { tag, weight } });
+    }
+
+    void PackedSurfacePointList::AddMaxValueForMasks(size_t pointIndex, const SurfaceTagVector& tags, float weight)
+    {
+        for (const auto& tag : tags)
+        {
+            AddMaxValueForMasks(pointIndex, tag, weight);
+        }
+    }
+
+    void PackedSurfacePointList::AddMaxValueForMasks(size_t pointIndex, const SurfaceTagWeightMap& masks)
+    {
+        for (const auto& [tag, weight] : masks)
+        {
+            AddMaxValueForMasks(pointIndex, tag, weight);
+        }
+    }
+
+    void PackedSurfacePointList::GroupTagWeightsByPoint()
+    {
+        const size_t pointCount = m_positions.size();
+
+        // Counting sort of the pending tag weights by point, which keeps them in the order they were added in.
+        m_tagOffsets.assign(pointCount + 1, 0);
+        for (const auto& pendingTagWeight : m_pendingTagWeights)
+        {
+            m_tagOffsets[pendingTagWeight.m_pointIndex + 1]++;
+        }
+        for (size_t pointIndex = 0; pointIndex < pointCount; pointIndex++)
+        {
+            m_tagOffsets[pointIndex + 1] += m_tagOffsets[pointIndex];
+        }
+
+        m_scratchTagOffsets.assign(m_tagOffsets.begin(), m_tagOffsets.end() - 1);
+        m_tagWeights.resize(m_pendingTagWeights.size());
+        for (const auto& pendingTagWeight : m_pendingTagWeights)
+        {
+            m_tagWeights[m_scratchTagOffsets[pendingTagWeight.m_pointIndex]++] = pendingTagWeight.m_tagWeight;
+        }
+
+        // Merge the duplicate tags of every point in place, keeping the largest weight.
+        AZ::u32 writeIndex = 0;
+        for (size_t pointIndex = 0; pointIndex < pointCount; pointIndex++)
+        {
+            const AZ::u32 readBegin = m_tagOffsets[pointIndex];
+            const AZ::u32 readEnd = m_tagOffsets[pointIndex + 1];
+            const AZ::u32 pointBegin = writeIndex;
+            m_tagOffsets[pointIndex] = pointBegin;
+
+            for (AZ::u32 readIndex = readBegin; readIndex < readEnd; readIndex++)
+            {
+                const TagWeight tagWeight = m_tagWeights[readIndex];
+                auto existingTag = AZStd::find_if(
+                    m_tagWeights.begin() + pointBegin, m_tagWeights.begin() + writeIndex,
+                    [&tagWeight](const TagWeight& other)
+                    {
+                        return other.m_tag == tagWeight.m_tag;
+                    });
+
+                if (existingTag != m_tagWeights.begin() + writeIndex)
+                {
+                    existingTag->m_weight = AZ::GetMax(existingTag->m_weight, tagWeight.m_weight);
+                }
+                else
+                {
+                    m_tagWeights[writeIndex++] = tagWeight;
+                }
+            }
+        }
+        m_tagOffsets[pointCount] = writeIndex;
+        m_tagWeights.resize(writeIndex);
+        m_pendingTagWeights.clear();
+    }
+
+    bool PackedSurfacePointList::HasMatchingTags(size_t pointIndex, const SurfaceTagVector& desiredTags) const
+    {
+        for (AZ::u32 tagIndex = m_tagOffsets[pointIndex]; tagIndex < m_tagOffsets[pointIndex + 1]; tagIndex++)
+        {
+            if (HasMatchingTag(desiredTags, m_tagWeights[tagIndex].m_tag))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void PackedSurfacePointList::EndListConstruction(const SurfaceTagVector& desiredTags)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+        AZ_Assert(m_constructing, "EndListConstruction() called without StartListConstruction().");
+
+        GroupTagWeightsByPoint();
+
+        const size_t inputCount = m_inputPositions.size();
+        const size_t pointCount = m_positions.size();
+        const bool useTagFilters = HasValidTags(desiredTags);
+
+        // Filter out any points that don't match our search tags. This can happen when a surface provider doesn't add a desired tag,
+        // and a surface modifier has the *potential* to add it, but then doesn't.
+        m_filteredPointIndices.clear();
+        m_filteredPointIndices.reserve(pointCount);
+        for (size_t pointIndex = 0; pointIndex < pointCount; pointIndex++)
+        {
+            if (!useTagFilters || HasMatchingTags(pointIndex, desiredTags))
+            {
+                m_filteredPointIndices.push_back(aznumeric_cast<AZ::u32>(pointIndex));
+            }
+        }
+
+        // Group the remaining points by input position with a counting sort.
+        m_inputPointOffsets.assign(inputCount + 1, 0);
+        for (AZ::u32 pointIndex : m_filteredPointIndices)
+        {
+            m_inputPointOffsets[m_inputIndices[pointIndex] + 1]++;
+        }
+        for (size_t inputIndex = 0; inputIndex < inputCount; inputIndex++)
+        {
+            m_inputPointOffsets[inputIndex + 1] += m_inputPointOffsets[inputIndex];
+        }
+
+        m_scratchInputIndices.assign(m_inputPointOffsets.begin(), m_inputPointOffsets.end() - 1);
+        m_sortedPointIndices.resize(m_filteredPointIndices.size());
+        for (AZ::u32 pointIndex : m_filteredPointIndices)
+        {
+            m_sortedPointIndices[m_scratchInputIndices[m_inputIndices[pointIndex]]++] = pointIndex;
+        }
+
+        m_scratchPositions.clear();
+        m_scratchNormals.clear();
+        m_scratchEntityIds.clear();
+        m_scratchInputIndices.clear();
+        m_scratchTagOffsets.clear();
+        m_scratchTagWeights.clear();
+        m_scratchPositions.reserve(m_sortedPointIndices.size());
+        m_scratchNormals.reserve(m_sortedPointIndices.size());
+        m_scratchEntityIds.reserve(m_sortedPointIndices.size());
+        m_scratchInputIndices.reserve(m_sortedPointIndices.size());
+        m_scratchTagOffsets.reserve(m_sortedPointIndices.size() + 1);
+        m_scratchTagWeights.reserve(m_tagWeights.size());
+
+        for (size_t inputIndex = 0; inputIndex < inputCount; inputIndex++)
+        {
+            const AZ::u32 sortedBegin = m_inputPointOffsets[inputIndex];
+            const AZ::u32 sortedEnd = m_inputPointOffsets[inputIndex + 1];
+            m_inputPointOffsets[inputIndex] = aznumeric_cast<AZ::u32>(m_scratchPositions.size());
+
+            // Efficient point consolidation requires the points to be pre-sorted so we are only comparing/combining neighbors.
+            // This uses the same ordering as the surface point lists: increasing Y, then increasing X, then decreasing Z, with the
+            // entity ID as the tiebreaker.
+            AZStd::sort(
+                m_sortedPointIndices.begin() + sortedBegin, m_sortedPointIndices.begin() + sortedEnd,
+                [this](AZ::u32 a, AZ::u32 b)
+                {
+                    const AZ::Vector3& positionA = m_positions[a];
+                    const AZ::Vector3& positionB = m_positions[b];
+                    if (positionA.GetY() != positionB.GetY())
+                    {
+                        return positionA.GetY() < positionB.GetY();
+                    }
+                    if (positionA.GetX() != positionB.GetX())
+                    {
+                        return positionA.GetX() < positionB.GetX();
+                    }
+                    if (positionA.GetZ() != positionB.GetZ())
+                    {
+                        return positionA.GetZ() > positionB.GetZ();
+                    }
+                    return m_entityIds[a] < m_entityIds[b];
+                });
+
+            const size_t inputPointBegin = m_scratchPositions.size();
+            for (AZ::u32 sortedIndex = sortedBegin; sortedIndex < sortedEnd; sortedIndex++)
+            {
+                const AZ::u32 pointIndex = m_sortedPointIndices[sortedIndex];
+
+                // Combine points with similar attributes by adding their tag weights to the previous point.
+                // (Someday we should add a configurable tolerance for comparison)
+                if ((m_scratchPositions.size() > inputPointBegin) && m_positions[pointIndex].IsClose(m_scratchPositions.back()) &&
+                    m_normals[pointIndex].IsClose(m_scratchNormals.back()))
+                {
+                    const size_t previousTagsBegin = m_scratchTagOffsets.back();
+                    for (AZ::u32 tagIndex = m_tagOffsets[pointIndex]; tagIndex < m_tagOffsets[pointIndex + 1]; tagIndex++)
+                    {
+                        const TagWeight& tagWeight = m_tagWeights[tagIndex];
+                        auto existingTag = AZStd::find_if(
+                            m_scratchTagWeights.begin() + previousTagsBegin, m_scratchTagWeights.end(),
+                            [&tagWeight](const TagWeight& other)
+                            {
+                                return other.m_tag == tagWeight.m_tag;
+                            });
+
+                        if (existingTag != m_scratchTagWeights.end())
+                        {
+                            existingTag->m_weight = AZ::GetMax(existingTag->m_weight, tagWeight.m_weight);
+                        }
+                        else
+                        {
+                            m_scratchTagWeights.push_back(tagWeight);
+                        }
+                    }
+                }
+                else
+                {
+                    m_scratchPositions.push_back(m_positions[pointIndex]);
+                    m_scratchNormals.push_back(m_normals[pointIndex]);
+                    m_scratchEntityIds.push_back(m_entityIds[pointIndex]);
+                    m_scratchInputIndices.push_back(aznumeric_cast<AZ::u32>(inputIndex));
+                    m_scratchTagOffsets.push_back(aznumeric_cast<AZ::u32>(m_scratchTagWeights.size()));
+                    m_scratchTagWeights.insert(
+                        m_scratchTagWeights.end(), m_tagWeights.begin() + m_tagOffsets[pointIndex],
+                        m_tagWeights.begin() + m_tagOffsets[pointIndex + 1]);
+                }
+            }
+        }
+        m_inputPointOffsets[inputCount] = aznumeric_cast<AZ::u32>(m_scratchPositions.size());
+        m_scratchTagOffsets.push_back(aznumeric_cast<AZ::u32>(m_scratchTagWeights.size()));
+
+        // Swap the final points in, and keep the previous buffers around as scratch memory for the next query.
+        m_positions.swap(m_scratchPositions);
+        m_normals.swap(m_scratchNormals);
+        m_entityIds.swap(m_scratchEntityIds);
+        m_inputIndices.swap(m_scratchInputIndices);
+        m_tagOffsets.swap(m_scratchTagOffsets);
+        m_tagWeights.swap(m_scratchTagWeights);
+
+        m_constructing = false;
+    }
+
+    AZStd::span<const PackedSurfacePointList::TagWeight> PackedSurfacePointList::GetTagWeights(size_t pointIndex) const
+    {
+        AZ_Assert(!m_constructing, "Tag weights can only be read after EndListConstruction().");
+        return AZStd::span<const TagWeight>(
+            m_tagWeights.data() + m_tagOffsets[pointIndex], m_tagOffsets[pointIndex + 1] - m_tagOffsets[pointIndex]);
+    }
+
+    void PackedSurfacePointList::ConvertToSurfacePointList(size_t inputIndex, SurfacePointList& surfacePointList) const
+    {
+        AZ_Assert(!m_constructing, "Surface points can only be converted after EndListConstruction().");
+
+        surfacePointList.clear();
+        surfacePointList.reserve(GetPointEnd(inputIndex) - GetPointBegin(inputIndex));
+        for (size_t pointIndex = GetPointBegin(inputIndex); pointIndex < GetPointEnd(inputIndex); pointIndex++)
+        {
+            SurfacePoint point;
+            point.m_entityId = m_entityIds[pointIndex];
+            point.m_position = m_positions[pointIndex];
+            point.m_normal = m_normals[pointIndex];
+
+            const auto tagWeights = GetTagWeights(pointIndex);
+            point.m_masks.reserve(tagWeights.size());
+            for (const auto& tagWeight : tagWeights)
+            {
+                point.m_masks[tagWeight.m_tag] = tagWeight.m_weight;
+            }
+
+            surfacePointList.push_back(AZStd::move(point));
+        }
+    }
+
+    void PackedSurfacePointList::ConvertToSurfacePointLists(SurfacePointLists& surfacePointLists) const
+    {
+        surfacePointLists.clear();
+        surfacePointLists.resize(m_inputPositions.size());
+        for (size_t inputIndex = 0; inputIndex < m_inputPositions.size(); inputIndex++)
+        {
+            ConvertToSurfacePointList(inputIndex, surfacePointLists[inputIndex]);
+        }
+    }
+}
@@ -182,34 +182,28 @@ namespace SurfaceData
     void SurfaceDataSystemComponent::GetSurfacePoints(const AZ::Vector3& inPosition, const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointList) const
     {
         const bool useTagFilters = HasValidTags(desiredTags);
-        const bool hasModifierTags = useTagFilters && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
-        AZStd::shared_lock<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+        RegisteredBoundsList providers;
+        RegisteredBoundsList modifiers;
+        GetRegisteredBounds(desiredTags, providers, modifiers);
 
         surfacePointList.clear();
 
         //gather all intersecting points
-        for (const auto& entryPair : m_registeredSurfaceDataProviders)
+        for (const auto& [entryAddress, entryBounds] : providers)
         {
-            const AZ::u32 entryAddress = entryPair.first;
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
-            if (!entry.m_bounds.IsValid() || AabbContains2D(entry.m_bounds, inPosition))
+            if (!entryBounds.IsValid() || AabbContains2D(entryBounds, inPosition))
             {
-                if (!useTagFilters || hasModifierTags || HasMatchingTags(desiredTags, entry.m_tags))
-                {
-                    SurfaceDataProviderRequestBus::Event(entryAddress, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, inPosition, surfacePointList);
-                }
+                SurfaceDataProviderRequestBus::Event(entryAddress, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, inPosition, surfacePointList);
             }
         }
 
         if (!surfacePointList.empty())
         {
             //modify or annotate reported points
-            for (const auto& entryPair : m_registeredSurfaceDataModifiers)
+            for (const auto& [entryAddress, entryBounds] : modifiers)
             {
-                const AZ::u32 entryAddress = entryPair.first;
-                const SurfaceDataRegistryEntry& entry = entryPair.second;
-                if (!entry.m_bounds.IsValid() || AabbContains2D(entry.m_bounds, inPosition))
+                if (!entryBounds.IsValid() || AabbContains2D(entryBounds, inPosition))
                 {
                     SurfaceDataModifierRequestBus::Event(entryAddress, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
                 }
@@ -231,58 +225,68 @@ namespace SurfaceData
     void SurfaceDataSystemComponent::GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize,
         const SurfaceTagVector& desiredTags, SurfacePointLists& surfacePointLists) const
     {
-        const size_t totalQueryPositions = aznumeric_cast<size_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) *
-            aznumeric_cast<size_t>(ceil(inRegion.GetYExtent() / stepSize.GetY()));
+        PackedSurfacePointList surfacePointList;
+        GetPackedSurfacePointsFromRegion(inRegion, stepSize, desiredTags, surfacePointList);
+        surfacePointList.ConvertToSurfacePointLists(surfacePointLists);
+    }
 
-        AZStd::vector<AZ::Vector3> inPositions;
-        inPositions.reserve(totalQueryPositions);
+    void SurfaceDataSystemComponent::GetSurfacePointsFromList(
+        AZStd::span<const AZ::Vector3> inPositions, const SurfaceTagVector& desiredTags, SurfacePointLists& surfacePointLists) const
+    {
+        PackedSurfacePointList surfacePointList;
+        GetPackedSurfacePointsFromList(inPositions, desiredTags, surfacePointList);
+        surfacePointList.ConvertToSurfacePointLists(surfacePointLists);
+    }
 
-        // Initialize our list-per-position list with every input position to query from the region.
+    void SurfaceDataSystemComponent::GetPackedSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize,
+        const SurfaceTagVector& desiredTags, PackedSurfacePointList& surfacePointList) const
+    {
+        // Initialize the list with every input position to query from the region.
         // This is inclusive on the min sides of inRegion, and exclusive on the max sides.
-        for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
-        {
-            for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
-            {
-                inPositions.emplace_back(x, y, AZ::Constants::FloatMax);
-            }
-        }
-
-        GetSurfacePointsFromList(inPositions, desiredTags, surfacePointLists);
+        surfacePointList.StartListConstruction(inRegion, stepSize);
+        ConstructPackedSurfacePoints(desiredTags, surfacePointList);
     }
 
-    void SurfaceDataSystemComponent::GetSurfacePointsFromList(
-        AZStd::span<const AZ::Vector3> inPositions, const SurfaceTagVector& desiredTags, SurfacePointLists& surfacePointLists) const
+    void SurfaceDataSystemComponent::GetPackedSurfacePointsFromList(
+        AZStd::span<const AZ::Vector3> inPositions, const SurfaceTagVector& desiredTags, PackedSurfacePointList& surfacePointList) const
     {
-        AZStd::shared_lock<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+        surfacePointList.StartListConstruction(inPositions);
+        ConstructPackedSurfacePoints(desiredTags, surfacePointList);
+    }
 
-        const size_t totalQueryPositions = inPositions.size();
+    void SurfaceDataSystemComponent::ConstructPackedSurfacePoints(
+        const SurfaceTagVector& desiredTags, PackedSurfacePointList& surfacePointList) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
 
-        surfacePointLists.clear();
-        surfacePointLists.resize(totalQueryPositions);
+        RegisteredBoundsList providers;
+        RegisteredBoundsList modifiers;
+        GetRegisteredBounds(desiredTags, providers, modifiers);
 
-        const bool useTagFilters = HasValidTags(desiredTags);
-        const bool hasModifierTags = useTagFilters && HasMatchingTags(desiredTags, m_registeredModifierTags);
+        const AZStd::span<const AZ::Vector3> inPositions = surfacePointList.GetInputPositions();
 
-        // Loop through each data provider, and query all the points for each one.  This allows us to check the tags and the overall
-        // AABB bounds just once per provider, instead of once per point.  It also allows for an eventual optimization in which we could
-        // send the list of points directly into each SurfaceDataProvider.
-        for (const auto& [providerHandle, provider] : m_registeredSurfaceDataProviders)
+        // Loop through each data provider, and send it all the input positions within its bounds at once.  This allows us to check
+        // the tags just once per provider, and lets the providers process the positions in bulk.
+        AZStd::vector<size_t> indices;
+        indices.reserve(inPositions.size());
+        for (const auto& [providerHandle, providerBounds] : providers)
         {
-            bool hasInfiniteBounds = !provider.m_bounds.IsValid();
+            const bool hasInfiniteBounds = !providerBounds.IsValid();
 
-            if (!useTagFilters || hasModifierTags || HasMatchingTags(desiredTags, provider.m_tags))
+            indices.clear();
+            for (size_t inputIndex = 0; inputIndex < inPositions.size(); inputIndex++)
             {
-                for (size_t index = 0; index < totalQueryPositions; index++)
+                if (hasInfiniteBounds || AabbContains2D(providerBounds, inPositions[inputIndex]))
                 {
-                    bool inBounds = hasInfiniteBounds || AabbContains2D(provider.m_bounds, inPositions[index]);
-                    if (inBounds)
-                    {
-                        SurfaceDataProviderRequestBus::Event(
-                            providerHandle, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints,
-                            inPositions[index], surfacePointLists[index]);
-                    }
+                    indices.push_back(inputIndex);
                 }
             }
+
+            if (!indices.empty())
+            {
+                SurfaceDataProviderRequestBus::Event(
+                    providerHandle, &SurfaceDataProviderRequestBus::Events::GetSurfacePointsFromList, indices, surfacePointList);
+            }
         }
 
         // Once we have our list of surface points created, run through the list of surface data modifiers to potentially add
@@ -290,40 +294,60 @@ namespace SurfaceData
         // create new surface points, but surface data *modifiers* simply annotate points that have already been created.  The modifiers
         // are used to annotate points that occur within a volume.  A common example is marking points as "underwater" for points that occur
         // within a water volume.
-        for (const auto& entryPair : m_registeredSurfaceDataModifiers)
+        if (!surfacePointList.IsEmpty())
         {
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
-            bool hasInfiniteBounds = !entry.m_bounds.IsValid();
+            const AZStd::span<const AZ::u32> pointInputIndices = surfacePointList.GetInputIndices();
 
-            for (size_t index = 0; index < totalQueryPositions; index++)
+            for (const auto& [modifierHandle, modifierBounds] : modifiers)
             {
-                const auto& inPosition = inPositions[index];
-                SurfacePointList& surfacePointList = surfacePointLists[index];
-                if (!surfacePointList.empty())
+                const bool hasInfiniteBounds = !modifierBounds.IsValid();
+
+                indices.clear();
+                for (size_t pointIndex = 0; pointIndex < pointInputIndices.size(); pointIndex++)
                 {
-                    if (hasInfiniteBounds || AabbContains2D(entry.m_bounds, inPosition))
+                    if (hasInfiniteBounds || AabbContains2D(modifierBounds, inPositions[pointInputIndices[pointIndex]]))
                     {
-                        SurfaceDataModifierRequestBus::Event(
-                            entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints,
-                            surfacePointList);
+                        indices.push_back(pointIndex);
                     }
                 }
+
+                if (!indices.empty())
+                {
+                    SurfaceDataModifierRequestBus::Event(
+                        modifierHandle, &SurfaceDataModifierRequestBus::Events::ModifySurfacePointsFromList, indices, surfacePointList);
+                }
             }
         }
 
-        // After we've finished creating and annotating all the surface points, combine any points together that have effectively the
-        // same XY coordinates and extremely similar Z values.  This produces results that are sorted in decreasing Z order.
-        // Also, this filters out any remaining points that don't match the desired tag list.  This can happen when a surface provider
-        // doesn't add a desired tag, and a surface modifier has the *potential* to add it, but then doesn't.
-        for (auto& surfacePointList : surfacePointLists)
+        // After we've finished creating and annotating all the surface points, filter out the points that don't match the desired
+        // tags, and combine any points together that have effectively the same XY coordinates and extremely similar Z values.
+        surfacePointList.EndListConstruction(desiredTags);
+    }
+
+    void SurfaceDataSystemComponent::GetRegisteredBounds(
+        const SurfaceTagVector& desiredTags, RegisteredBoundsList& providers, RegisteredBoundsList& modifiers) const
+    {
+        const bool useTagFilters = HasValidTags(desiredTags);
+
+        AZStd::shared_lock<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+
+        // Providers that don't have any of the desired tags can be skipped, unless a modifier could add one of them to their points.
+        const bool hasModifierTags = useTagFilters && HasMatchingTags(desiredTags, m_registeredModifierTags);
+
+        providers.reserve(m_registeredSurfaceDataProviders.size());
+        for (const auto& [providerHandle, provider] : m_registeredSurfaceDataProviders)
         {
-            if (useTagFilters)
+            if (!useTagFilters || hasModifierTags || HasMatchingTags(desiredTags, provider.m_tags))
             {
-                FilterPoints(surfacePointList, desiredTags);
+                providers.emplace_back(providerHandle, provider.m_bounds);
             }
-            CombineAndSortNeighboringPoints(surfacePointList);
         }
 
+        modifiers.reserve(m_registeredSurfaceDataModifiers.size());
+        for (const auto& [modifierHandle, modifier] : m_registeredSurfaceDataModifiers)
+        {
+            modifiers.emplace_back(modifierHandle, modifier.m_bounds);
+        }
     }
 
     void SurfaceDataSystemComponent::FilterPoints(SurfacePointList& sourcePointList, const SurfaceTagVector& desiredTags) const
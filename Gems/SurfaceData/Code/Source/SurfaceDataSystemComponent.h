@@ -10,7 +10,9 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/utils.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 
 namespace SurfaceData
@@ -47,6 +49,13 @@ namespace SurfaceData
             AZStd::span<const AZ::Vector3> inPositions,
             const SurfaceTagVector& desiredTags,
             SurfacePointLists& surfacePointLists) const override;
+        void GetPackedSurfacePointsFromRegion(
+            const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
+            PackedSurfacePointList& surfacePointList) const override;
+        void GetPackedSurfacePointsFromList(
+            AZStd::span<const AZ::Vector3> inPositions,
+            const SurfaceTagVector& desiredTags,
+            PackedSurfacePointList& surfacePointList) const override;
 
         SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) override;
         void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) override;
@@ -58,8 +67,18 @@ namespace SurfaceData
 
         void RefreshSurfaceData(const AZ::Aabb& dirtyArea) override;
     private:
+        //! The handle and bounds of each registered provider or modifier that a query calls into.
+        using RegisteredBoundsList = AZStd::vector<AZStd::pair<SurfaceDataRegistryHandle, AZ::Aabb>>;
+
+        //! Copy the providers matching the desired tags and all of the modifiers under the registration lock. Queries call into them
+        //! from these copies after releasing the lock, since providers and modifiers can call back into the SurfaceData bus (for
+        //! example by sampling gradients), while registrations are made through the bus and need the registration lock.
+        void GetRegisteredBounds(
+            const SurfaceTagVector& desiredTags, RegisteredBoundsList& providers, RegisteredBoundsList& modifiers) const;
+
         void FilterPoints(SurfacePointList& sourcePointList, const SurfaceTagVector& desiredTags) const;
         void CombineAndSortNeighboringPoints(SurfacePointList& sourcePointList) const;
+        void ConstructPackedSurfacePoints(const SurfaceTagVector& desiredTags, PackedSurfacePointList& surfacePointList) const;
 
         SurfaceDataRegistryHandle RegisterSurfaceDataProviderInternal(const SurfaceDataRegistryEntry& entry);
         SurfaceDataRegistryEntry UnregisterSurfaceDataProviderInternal(const SurfaceDataRegistryHandle& handle);
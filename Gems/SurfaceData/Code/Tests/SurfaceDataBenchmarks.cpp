@@ -255,6 +255,30 @@ namespace UnitTest
         }
     }
 
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_GetPackedSurfacePointsFromRegion)(benchmark::State& state)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Create our benchmark world
+        float worldSize = aznumeric_cast<float>(state.range(0));
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> benchmarkEntities = CreateBenchmarkEntities(worldSize);
+        SurfaceData::SurfaceTagVector filterTags = CreateBenchmarkTagFilterList();
+
+        // The packed list is reused between queries, so only the first query allocates.
+        SurfaceData::PackedSurfacePointList points;
+
+        // Query every point in our world at 1 meter intervals.
+        for (auto _ : state)
+        {
+            AZ::Aabb inRegion = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(worldSize));
+            AZ::Vector2 stepSize(1.0f);
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                &SurfaceData::SurfaceDataSystemRequestBus::Events::GetPackedSurfacePointsFromRegion, inRegion, stepSize, filterTags,
+                points);
+            benchmark::DoNotOptimize(points);
+        }
+    }
+
     BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_GetSurfacePoints)
         ->Arg( 1024 )
         ->Arg( 2048 )
@@ -270,6 +294,11 @@ namespace UnitTest
         ->Arg( 2048 )
         ->Unit(::benchmark::kMillisecond);
 
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_GetPackedSurfacePointsFromRegion)
+        ->Arg( 1024 )
+        ->Arg( 2048 )
+        ->Unit(::benchmark::kMillisecond);
+
 #endif
 }
 
@@ -15,6 +15,8 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Script/ScriptContext.h>
 #include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <SurfaceDataSystemComponent.h>
 #include <SurfaceDataModule.h>
 #include <SurfaceData/SurfaceDataProviderRequestBus.h>
@@ -175,6 +177,47 @@ class MockSurfaceProvider
 
 };
 
+// Surface modifier that locks the SurfaceDataSystemRequestBus while modifying points, the same way that modifiers sampling a
+// gradient do through GradientSampler. It adds its tags to every point.
+class MockBusLockingSurfaceModifier
+    : private SurfaceData::SurfaceDataModifierRequestBus::Handler
+{
+public:
+    MockBusLockingSurfaceModifier(const SurfaceData::SurfaceTagVector& surfaceTags)
+        : m_tags(surfaceTags)
+    {
+        SurfaceData::SurfaceDataRegistryEntry registryEntry;
+        registryEntry.m_tags = m_tags;
+        SurfaceData::SurfaceDataSystemRequestBus::BroadcastResult(
+            m_modifierHandle, &SurfaceData::SurfaceDataSystemRequestBus::Events::RegisterSurfaceDataModifier, registryEntry);
+        SurfaceData::SurfaceDataModifierRequestBus::Handler::BusConnect(m_modifierHandle);
+    }
+
+    ~MockBusLockingSurfaceModifier()
+    {
+        SurfaceData::SurfaceDataModifierRequestBus::Handler::BusDisconnect();
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::UnregisterSurfaceDataModifier, m_modifierHandle);
+    }
+
+    void ModifySurfacePoints(SurfaceData::SurfacePointList& surfacePointList) const override
+    {
+        m_modifyStarted = true;
+
+        auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+        typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+
+        for (auto& point : surfacePointList)
+        {
+            AddMaxValueForMasks(point.m_masks, m_tags, 1.0f);
+        }
+    }
+
+    SurfaceData::SurfaceTagVector m_tags;
+    SurfaceData::SurfaceDataRegistryHandle m_modifierHandle = SurfaceData::InvalidSurfaceDataRegistryHandle;
+    mutable AZStd::atomic_bool m_modifyStarted{ false };
+};
+
 TEST(SurfaceDataTest, ComponentsWithComponentApplication)
 {
     AZ::Entity* testSystemEntity = new AZ::Entity();
@@ -767,5 +810,120 @@ TEST_F(SurfaceDataTestApp, SurfaceData_VerifyGetSurfacePointsFromListAndGetSurfa
     // For each point entry returned from GetSurfacePointsFromList, call GetSurfacePoints and verify the results match.
     CompareSurfacePointListWithGetSurfacePoints(queryPositions, availablePointsPerPosition, providerTags);
 }
+
+TEST_F(SurfaceDataTestApp, SurfaceData_VerifyGetPackedSurfacePointsAndGetSurfacePointsMatch)
+{
+    // This ensures that the packed surface point queries produce the same results as GetSurfacePoints, including when the
+    // same packed list gets reused for multiple queries.
+
+    // Create a mock Surface Provider that covers from (0, 0) - (8, 8) in space.
+    // It defines points spaced 0.25 apart, with heights of 0 and 4, and with the tags "test_surface1" and "test_surface2".
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc), SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockProvider(
+        MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags, AZ::Vector3(0.0f), AZ::Vector3(8.0f),
+        AZ::Vector3(0.25f, 0.25f, 4.0f));
+
+    SurfaceData::PackedSurfacePointList packedPoints;
+    SurfaceData::SurfacePointLists availablePointsPerPosition;
+
+    // Query for all the surface points from (0, 0, 16) - (4, 4, 16) with a step size of 1.
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f, 0.0f, 16.0f), AZ::Vector3(4.0f, 4.0f, 16.0f));
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetPackedSurfacePointsFromRegion, regionBounds, stepSize, providerTags,
+        packedPoints);
+
+    AZStd::vector<AZ::Vector3> queryPositions;
+    for (float y = 0.0f; y < 4.0f; y += 1.0f)
+    {
+        for (float x = 0.0f; x < 4.0f; x += 1.0f)
+        {
+            queryPositions.push_back(AZ::Vector3(x, y, 16.0f));
+        }
+    }
+
+    EXPECT_EQ(packedPoints.GetInputPositionCount(), queryPositions.size());
+    packedPoints.ConvertToSurfacePointLists(availablePointsPerPosition);
+    CompareSurfacePointListWithGetSurfacePoints(queryPositions, availablePointsPerPosition, providerTags);
+
+    // Reuse the packed list for a smaller list query that partially overlaps the provider.
+    queryPositions.clear();
+    for (float x = 6.0f; x < 10.0f; x += 1.0f)
+    {
+        queryPositions.push_back(AZ::Vector3(x, 2.0f, 16.0f));
+    }
+
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetPackedSurfacePointsFromList, queryPositions, providerTags,
+        packedPoints);
+
+    EXPECT_EQ(packedPoints.GetInputPositionCount(), queryPositions.size());
+    packedPoints.ConvertToSurfacePointLists(availablePointsPerPosition);
+    CompareSurfacePointListWithGetSurfacePoints(queryPositions, availablePointsPerPosition, providerTags);
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_QueryFromAnotherThreadDoesNotBlockRegistrationsMadeThroughTheBus)
+{
+    // Queries can be made from other threads without the SurfaceDataSystemRequestBus lock, while modifiers can lock the bus
+    // themselves, for example by sampling gradients. Registrations are made through the bus, so they hold the bus lock while
+    // updating the registrations. This verifies that a registration can complete while such a query is in progress, which
+    // requires the query not to hold the registration lock while calling into the providers and modifiers.
+
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(
+        MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags, AZ::Vector3(0.0f), AZ::Vector3(8.0f),
+        AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockBusLockingSurfaceModifier mockModifier(modifierTags);
+
+    // Get the handler before locking the bus, since looking it up takes the bus lock.
+    const SurfaceData::SurfaceDataSystemRequests* surfaceDataSystem = SurfaceData::SurfaceDataSystemRequestBus::FindFirstHandler();
+    ASSERT_NE(surfaceDataSystem, nullptr);
+
+    SurfaceData::PackedSurfacePointList packedPoints;
+    AZStd::thread queryThread;
+    {
+        // Hold the bus lock so that the modifier blocks in the middle of the query, then register and unregister another modifier
+        // through the bus.
+        auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+        typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+
+        queryThread = AZStd::thread(
+            [surfaceDataSystem, &packedPoints, &providerTags]()
+            {
+                AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(4.0f));
+                surfaceDataSystem->GetPackedSurfacePointsFromRegion(regionBounds, AZ::Vector2(1.0f), providerTags, packedPoints);
+            });
+
+        while (!mockModifier.m_modifyStarted)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        SurfaceData::SurfaceDataRegistryHandle registeredDuringQuery = SurfaceData::InvalidSurfaceDataRegistryHandle;
+        SurfaceData::SurfaceDataSystemRequestBus::BroadcastResult(
+            registeredDuringQuery, &SurfaceData::SurfaceDataSystemRequestBus::Events::RegisterSurfaceDataModifier,
+            SurfaceData::SurfaceDataRegistryEntry());
+        EXPECT_NE(registeredDuringQuery, SurfaceData::InvalidSurfaceDataRegistryHandle);
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::UnregisterSurfaceDataModifier, registeredDuringQuery);
+    }
+    queryThread.join();
+
+    // Every point should have been created by the provider and annotated by the modifier.
+    EXPECT_EQ(packedPoints.GetInputPositionCount(), 16);
+    SurfaceData::SurfacePointLists availablePointsPerPosition;
+    packedPoints.ConvertToSurfacePointLists(availablePointsPerPosition);
+    for (auto& pointList : availablePointsPerPosition)
+    {
+        EXPECT_EQ(pointList.size(), 2);
+        for (auto& point : pointList)
+        {
+            EXPECT_EQ(point.m_masks.size(), 2);
+        }
+    }
+}
+
 // This uses custom test / benchmark hooks so that we can load LmbrCentral and use Shape components in our unit tests and benchmarks.
 AZ_UNIT_TEST_HOOK(new UnitTest::SurfaceDataTestEnvironment, UnitTest::SurfaceDataBenchmarkEnvironment);
@@ -7,6 +7,7 @@
 #
 
 set(FILES
+    Include/SurfaceData/PackedSurfacePointList.h
     Include/SurfaceData/SurfaceDataConstants.h
     Include/SurfaceData/SurfaceDataTypes.h
     Include/SurfaceData/SurfaceDataSystemRequestBus.h
@@ -17,6 +18,7 @@ set(FILES
     Include/SurfaceData/SurfaceDataModifierRequestBus.h
     Include/SurfaceData/SurfaceTag.h
     Include/SurfaceData/Utility/SurfaceDataUtility.h
+    Source/PackedSurfacePointList.cpp
     Source/SurfaceDataSystemComponent.cpp
     Source/SurfaceDataSystemComponent.h
     Source/SurfaceTag.cpp
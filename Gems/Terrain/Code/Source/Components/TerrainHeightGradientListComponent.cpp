@@ -114,6 +114,11 @@ namespace Terrain
             {
                 m_dependencyMonitor.ConnectDependency(entityId);
             }
+
+            if (entityId.IsValid())
+            {
+                m_compiledGradients.emplace_back(AZStd::make_unique<GradientSignal::CompiledGradient>(entityId));
+            }
         }
 
         // Cache any height data needed and notify that the area has changed.
@@ -123,6 +128,7 @@ namespace Terrain
     void TerrainHeightGradientListComponent::Deactivate()
     {
         m_dependencyMonitor.Reset();
+        m_compiledGradients.clear();
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusDisconnect();
         Terrain::TerrainAreaHeightRequestBus::Handler::BusDisconnect();
         LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
@@ -218,21 +224,17 @@ namespace Terrain
             // value of 0 outside their data bounds if they're using bounded data.  We should examine the possibility of extending the
             // gradient API to provide actual bounds so that it's possible to detect if the gradient even 'exists' in an area, at which
             // point we could just make this list a prioritized list from top to bottom for any points that overlap.
-            for (auto& gradientId : m_configuration.m_gradientEntities)
+            for (auto& compiledGradient : m_compiledGradients)
             {
-                if (gradientId.IsValid())
-                {
-                    GradientSignal::GradientRequestBus::Event(
-                        gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, inOutPositionList, curGradientSamples);
+                compiledGradient->GetValues(inOutPositionList, curGradientSamples);
 
-                    for (size_t index = 0; index < maxValueSamples.size(); index++)
-                    {
-                        maxValueSamples[index] = AZ::GetMax(maxValueSamples[index], curGradientSamples[index]);
+                for (size_t index = 0; index < maxValueSamples.size(); index++)
+                {
+                    maxValueSamples[index] = AZ::GetMax(maxValueSamples[index], curGradientSamples[index]);
 
-                        // If gradients ever provide bounds, or if we add a value threshold in this component, it would be possible for
-                        // terrain to *not* exist at a specific point.
-                        terrainExistsList[index] = true;
-                    }
+                    // If gradients ever provide bounds, or if we add a value threshold in this component, it would be possible for
+                    // terrain to *not* exist at a specific point.
+                    terrainExistsList[index] = true;
                 }
             }
 
@@ -254,6 +256,12 @@ namespace Terrain
 
     void TerrainHeightGradientListComponent::OnCompositionChanged()
     {
+        // The compiled gradients track the gradients compiled into them, but not the activation of the gradient entities themselves.
+        for (auto& compiledGradient : m_compiledGradients)
+        {
+            compiledGradient->Invalidate();
+        }
+
         RefreshMinMaxHeights();
         TerrainSystemServiceRequestBus::Broadcast(
             &TerrainSystemServiceRequestBus::Events::RefreshArea, GetEntityId(),
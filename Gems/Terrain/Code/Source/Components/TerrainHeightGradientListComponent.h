@@ -22,6 +22,7 @@
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
+#include <GradientSignal/CompiledGradient.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
 
@@ -99,5 +100,8 @@ namespace Terrain
         mutable bool m_isRequestInProgress{ false }; 
 
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
+
+        // The compiled gradient networks used for the height list queries, one for each valid gradient entity.
+        AZStd::vector<AZStd::unique_ptr<GradientSignal::CompiledGradient>> m_compiledGradients;
     };
 }
@@ -140,11 +140,14 @@ namespace Terrain
         Physics::HeightfieldProviderRequestsBus::Handler::BusConnect(entityId);
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusConnect();
 
-        NotifyListenersOfHeightfieldDataChange();
+        NotifyListenersOfHeightfieldDataChange(GetHeightfieldAabb());
     }
 
     void TerrainPhysicsColliderComponent::Deactivate()
     {
+        AZ::TickBus::Handler::BusDisconnect();
+        m_pendingDirtyRegion = AZ::Aabb::CreateNull();
+
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusDisconnect();
         Physics::HeightfieldProviderRequestsBus::Handler ::BusDisconnect();
         LmbrCentral::ShapeComponentNotificationsBus::Handler::BusDisconnect();
@@ -170,15 +173,10 @@ namespace Terrain
         return false;
     }
 
-    void TerrainPhysicsColliderComponent::NotifyListenersOfHeightfieldDataChange()
+    void TerrainPhysicsColliderComponent::NotifyListenersOfHeightfieldDataChange(const AZ::Aabb& dirtyRegion)
     {
-        AZ::Aabb worldSize = AZ::Aabb::CreateNull();
-
-        LmbrCentral::ShapeComponentRequestsBus::EventResult(
-            worldSize, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::GetEncompassingAabb);
-
-        Physics::HeightfieldProviderNotificationBus::Broadcast(
-            &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged, worldSize);
+        Physics::HeightfieldProviderNotificationBus::Event(
+            GetEntityId(), &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged, dirtyRegion);
     }
 
     void TerrainPhysicsColliderComponent::OnShapeChanged([[maybe_unused]] ShapeChangeReasons changeReason)
@@ -187,26 +185,69 @@ namespace Terrain
         // It's important to use this event for transform changes instead of listening to OnTransformChanged, because we need to guarantee
         // the shape has received the transform change message and updated its internal state before passing it along to us.
 
-        NotifyListenersOfHeightfieldDataChange();
+        NotifyListenersOfHeightfieldDataChange(GetHeightfieldAabb());
     }
 
     void TerrainPhysicsColliderComponent::OnTerrainDataCreateEnd()
     {
         // The terrain system has finished creating itself, so we should now have data for creating a heightfield.
-        NotifyListenersOfHeightfieldDataChange();
+        NotifyListenersOfHeightfieldDataChange(GetHeightfieldAabb());
     }
 
     void TerrainPhysicsColliderComponent::OnTerrainDataDestroyBegin()
     {
         // The terrain system is starting to destroy itself, so notify listeners of a change since the heightfield
         // will no longer have any valid data.
-        NotifyListenersOfHeightfieldDataChange();
+        NotifyListenersOfHeightfieldDataChange(GetHeightfieldAabb());
     }
 
-    void TerrainPhysicsColliderComponent::OnTerrainDataChanged(
-        [[maybe_unused]] const AZ::Aabb& dirtyRegion, [[maybe_unused]] TerrainDataChangedMask dataChangedMask)
+    void TerrainPhysicsColliderComponent::OnTerrainDataChanged(const AZ::Aabb& dirtyRegion, TerrainDataChangedMask dataChangedMask)
     {
-        NotifyListenersOfHeightfieldDataChange();
+        // Color changes don't affect the heightfield, so there's nothing to update for them.
+        if ((dataChangedMask &
+             (TerrainDataChangedMask::Settings | TerrainDataChangedMask::HeightData | TerrainDataChangedMask::SurfaceData)) == 0)
+        {
+            return;
+        }
+
+        const AZ::Aabb heightfieldAabb = GetHeightfieldAabb();
+
+        // The terrain system sends this notification while holding the SurfaceData bus lock, which the terrain queries of the
+        // listeners need from the task graph threads. So the listeners get notified on the next tick instead, when nothing
+        // is locked, with all the changes until then merged together.
+        // Settings changes, such as the height query resolution, can change the layout of the whole heightfield.
+        if (((dataChangedMask & TerrainDataChangedMask::Settings) != 0) || !dirtyRegion.IsValid())
+        {
+            m_pendingDirtyRegion.AddAabb(heightfieldAabb);
+        }
+        else
+        {
+            // Only the XY extents of the dirty region matter, since any height change within them can affect the heightfield.
+            const AZ::Aabb dirtyColumns = AZ::Aabb::CreateFromMinMaxValues(
+                dirtyRegion.GetMin().GetX(), dirtyRegion.GetMin().GetY(), heightfieldAabb.GetMin().GetZ(),
+                dirtyRegion.GetMax().GetX(), dirtyRegion.GetMax().GetY(), heightfieldAabb.GetMax().GetZ());
+
+            // Let listeners update just the changed samples instead of regenerating the whole heightfield.
+            if (!dirtyColumns.Overlaps(heightfieldAabb))
+            {
+                return;
+            }
+            m_pendingDirtyRegion.AddAabb(dirtyColumns.GetClamped(heightfieldAabb));
+        }
+
+        if (!AZ::TickBus::Handler::BusIsConnected())
+        {
+            AZ::TickBus::Handler::BusConnect();
+        }
+    }
+
+    void TerrainPhysicsColliderComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+
+        const AZ::Aabb dirtyRegion = m_pendingDirtyRegion;
+        m_pendingDirtyRegion = AZ::Aabb::CreateNull();
+        NotifyListenersOfHeightfieldDataChange(dirtyRegion);
     }
 
     AZ::Aabb TerrainPhysicsColliderComponent::GetHeightfieldAabb() const
@@ -332,25 +373,115 @@ namespace Terrain
     {
         AZ_PROFILE_FUNCTION(Entity);
 
+        int32_t gridWidth, gridHeight;
+        GetHeightfieldGridSize(gridWidth, gridHeight);
+
+        heightMaterials.clear();
+        if ((gridWidth <= 0) || (gridHeight <= 0))
+        {
+            return;
+        }
+
+        const size_t numColumns = aznumeric_cast<size_t>(gridWidth);
+        heightMaterials.resize(numColumns * aznumeric_cast<size_t>(gridHeight));
+
+        auto updateHeightsMaterialsCallback = [&heightMaterials, numColumns](size_t column, size_t row, const Physics::HeightMaterialPoint& point)
+        {
+            heightMaterials[(row * numColumns) + column] = point;
+        };
+
+        UpdateHeightsAndMaterials(updateHeightsMaterialsCallback, AZ::Aabb::CreateNull());
+    }
+
+    void TerrainPhysicsColliderComponent::GetHeightfieldIndicesFromRegion(
+        const AZ::Aabb& region, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows) const
+    {
+        startColumn = 0;
+        startRow = 0;
+        numColumns = 0;
+        numRows = 0;
+
+        int32_t gridWidth, gridHeight;
+        GetHeightfieldGridSize(gridWidth, gridHeight);
+
+        if (!region.IsValid() || (gridWidth <= 0) || (gridHeight <= 0))
+        {
+            return;
+        }
+
         const AZ::Vector2 gridResolution = GetHeightfieldGridSpacing();
+        const AZ::Vector2 gridMin(GetHeightfieldAabb().GetMin());
 
-        AZ::Aabb worldSize = GetHeightfieldAabb();
+        // Convert the region to sample positions. The range is rounded outwards so that every sample that's affected by a change
+        // within the region gets included, even if the region doesn't line up with the grid.
+        const AZ::Vector2 regionMin = (AZ::Vector2(region.GetMin()) - gridMin) / gridResolution;
+        const AZ::Vector2 regionMax = (AZ::Vector2(region.GetMax()) - gridMin) / gridResolution;
+
+        const float maxColumn = aznumeric_cast<float>(gridWidth - 1);
+        const float maxRow = aznumeric_cast<float>(gridHeight - 1);
+
+        if ((regionMax.GetX() < 0.0f) || (regionMax.GetY() < 0.0f) || (regionMin.GetX() > maxColumn) || (regionMin.GetY() > maxRow))
+        {
+            return;
+        }
+
+        const size_t firstColumn = aznumeric_cast<size_t>(AZStd::max(floorf(regionMin.GetX()), 0.0f));
+        const size_t firstRow = aznumeric_cast<size_t>(AZStd::max(floorf(regionMin.GetY()), 0.0f));
+        const size_t lastColumn = aznumeric_cast<size_t>(AZStd::min(ceilf(regionMax.GetX()), maxColumn));
+        const size_t lastRow = aznumeric_cast<size_t>(AZStd::min(ceilf(regionMax.GetY()), maxRow));
+
+        startColumn = firstColumn;
+        startRow = firstRow;
+        numColumns = lastColumn - firstColumn + 1;
+        numRows = lastRow - firstRow + 1;
+    }
+
+    void TerrainPhysicsColliderComponent::UpdateHeightsAndMaterials(
+        const Physics::UpdateHeightfieldSampleFunction& updateHeightsMaterialsCallback, const AZ::Aabb& region) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        if (!updateHeightsMaterialsCallback)
+        {
+            return;
+        }
+
+        const AZ::Aabb worldSize = GetHeightfieldAabb();
+
+        size_t startColumn, startRow, numColumns, numRows;
+        GetHeightfieldIndicesFromRegion(region.IsValid() ? region : worldSize, startColumn, startRow, numColumns, numRows);
+        if ((numColumns == 0) || (numRows == 0))
+        {
+            return;
+        }
+
+        const AZ::Vector2 gridResolution = GetHeightfieldGridSpacing();
 
         const float worldCenterZ = worldSize.GetCenter().GetZ();
         const float worldHeightBoundsMin = worldSize.GetMin().GetZ();
         const float worldHeightBoundsMax = worldSize.GetMax().GetZ();
 
-        int32_t gridWidth, gridHeight;
-        GetHeightfieldGridSize(gridWidth, gridHeight);
-
-        heightMaterials.clear();
-        heightMaterials.reserve(gridWidth * gridHeight);
+        // Query only the samples within the range. The query region starts on the first sample and covers exactly the number of
+        // samples in the range, so that the query positions line up with the heightfield grid.
+        const AZ::Vector2 queryMin =
+            AZ::Vector2(worldSize.GetMin()) + (AZ::Vector2(aznumeric_cast<float>(startColumn), aznumeric_cast<float>(startRow)) * gridResolution);
+        const AZ::Vector2 queryMax =
+            queryMin + (AZ::Vector2(aznumeric_cast<float>(numColumns), aznumeric_cast<float>(numRows)) * gridResolution);
+        const AZ::Aabb queryRegion = AZ::Aabb::CreateFromMinMaxValues(
+            queryMin.GetX(), queryMin.GetY(), worldHeightBoundsMin, queryMax.GetX(), queryMax.GetY(), worldHeightBoundsMax);
 
         AZStd::vector<Physics::MaterialId> materialList = GetMaterialList();
 
-        auto perPositionCallback = [&heightMaterials, &materialList, this, worldCenterZ, worldHeightBoundsMin, worldHeightBoundsMax]
-            ([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+        auto perPositionCallback = [&updateHeightsMaterialsCallback, &materialList, this, startColumn, startRow, numColumns, numRows,
+                                    worldCenterZ, worldHeightBoundsMin, worldHeightBoundsMax]
+            (size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
         {
+            // Floating-point error in the query region can produce an extra row or column of positions, so skip those.
+            if ((xIndex >= numColumns) || (yIndex >= numRows))
+            {
+                return;
+            }
+
             float height = surfacePoint.m_position.GetZ();
 
             // Any heights that fall outside the range of our bounding box will get turned into holes.
@@ -374,11 +505,22 @@ namespace Terrain
             point.m_quadMeshType = terrainExists ? Physics::QuadMeshType::SubdivideUpperLeftToBottomRight : Physics::QuadMeshType::Hole;
             Physics::MaterialId materialId = FindMaterialIdForSurfaceTag(surfaceWeight.m_surfaceType);
             point.m_materialIndex = GetMaterialIdIndex(materialId, materialList);
-            heightMaterials.emplace_back(point);
+
+            updateHeightsMaterialsCallback(startColumn + xIndex, startRow + yIndex, point);
         };
 
-        AzFramework::Terrain::TerrainDataRequestBus::Broadcast(&AzFramework::Terrain::TerrainDataRequests::ProcessSurfacePointsFromRegion,
-            worldSize, gridResolution, perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
+        // The samples don't depend on each other, so the tiles of the query get processed in parallel on the task graph, and the
+        // callback gets called from several threads at once. The callers expect the samples to be updated on return, so wait for
+        // the query. It needs the SurfaceData bus lock from the task graph threads, so this must not be called while holding it.
+        AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> jobContext;
+        AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
+            jobContext, &AzFramework::Terrain::TerrainDataRequests::ProcessSurfacePointsFromRegionAsync, queryRegion, gridResolution,
+            perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT, AzFramework::Terrain::QueryAsyncParams{});
+
+        if (jobContext)
+        {
+            jobContext->Wait();
+        }
     }
 
     AZ::Vector2 TerrainPhysicsColliderComponent::GetHeightfieldGridSpacing() const
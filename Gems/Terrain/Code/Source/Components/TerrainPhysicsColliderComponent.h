@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
 
 #include <AzFramework/Physics/HeightfieldProviderBus.h>
 #include <AzFramework/Physics/Material.h>
@@ -58,6 +59,7 @@ namespace Terrain
         , public Physics::HeightfieldProviderRequestsBus::Handler
         , protected LmbrCentral::ShapeComponentNotificationsBus::Handler
         , protected AzFramework::Terrain::TerrainDataNotificationBus::Handler
+        , private AZ::TickBus::Handler
     {
     public:
         template<typename, typename>
@@ -86,6 +88,10 @@ namespace Terrain
         AZStd::vector<Physics::MaterialId> GetMaterialList() const override;
         AZStd::vector<float> GetHeights() const override;
         AZStd::vector<Physics::HeightMaterialPoint> GetHeightsAndMaterials() const override;
+        void GetHeightfieldIndicesFromRegion(
+            const AZ::Aabb& region, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows) const override;
+        void UpdateHeightsAndMaterials(
+            const Physics::UpdateHeightfieldSampleFunction& updateHeightsMaterialsCallback, const AZ::Aabb& region) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -101,7 +107,7 @@ namespace Terrain
         void GenerateHeightsInBounds(AZStd::vector<float>& heights) const;
         void GenerateHeightsAndMaterialsInBounds(AZStd::vector<Physics::HeightMaterialPoint>& heightMaterials) const;
 
-        void NotifyListenersOfHeightfieldDataChange();
+        void NotifyListenersOfHeightfieldDataChange(const AZ::Aabb& dirtyRegion);
 
         // ShapeComponentNotificationsBus
         void OnShapeChanged(ShapeChangeReasons changeReason) override;
@@ -111,6 +117,12 @@ namespace Terrain
         void OnTerrainDataChanged(const AZ::Aabb& dirtyRegion, TerrainDataChangedMask dataChangedMask) override;
 
     private:
+        // AZ::TickBus
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
         TerrainPhysicsColliderConfig m_configuration;
+
+        // The terrain changes that listeners get notified of on the next tick.
+        AZ::Aabb m_pendingDirtyRegion = AZ::Aabb::CreateNull();
     };
 }
@@ -180,6 +180,47 @@ namespace Terrain
         surfacePointList.push_back(AZStd::move(point));
     }
 
+    void TerrainSurfaceDataSystemComponent::GetSurfacePointsFromList(
+        AZStd::span<const size_t> inputIndices, SurfaceData::PackedSurfacePointList& surfacePointList) const
+    {
+        if (!m_terrainBoundsIsValid)
+        {
+            return;
+        }
+
+        AZStd::vector<AZ::Vector3> inPositions;
+        inPositions.reserve(inputIndices.size());
+        for (size_t inputIndex : inputIndices)
+        {
+            inPositions.push_back(surfacePointList.GetInputPosition(inputIndex));
+        }
+
+        // The terrain system processes the positions in order and calls the callback once per position, so the callback can
+        // keep track of which input position each surface point belongs to.
+        const AZ::EntityId entityId = GetEntityId();
+        size_t positionIndex = 0;
+        auto perPositionCallback = [inputIndices, entityId, &positionIndex, &surfacePointList](
+            const AzFramework::SurfaceData::SurfacePoint& terrainSurfacePoint, bool isTerrainValidAtPoint)
+        {
+            const size_t pointIndex = surfacePointList.AddSurfacePoint(
+                inputIndices[positionIndex++], entityId, terrainSurfacePoint.m_position, terrainSurfacePoint.m_normal);
+
+            // Add all of the surface tags that the terrain has at this point.
+            for (auto& tag : terrainSurfacePoint.m_surfaceTags)
+            {
+                surfacePointList.AddMaxValueForMasks(pointIndex, tag.m_surfaceType, tag.m_weight);
+            }
+
+            // Always add a "terrain" or "terrainHole" tag.
+            const AZ::Crc32 terrainTag = isTerrainValidAtPoint ? Constants::s_terrainTagCrc : Constants::s_terrainHoleTagCrc;
+            surfacePointList.AddMaxValueForMasks(pointIndex, terrainTag, 1.0f);
+        };
+
+        AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+            &AzFramework::Terrain::TerrainDataRequestBus::Events::ProcessSurfacePointsFromList, inPositions, perPositionCallback,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
+    }
+
     AZ::Aabb TerrainSurfaceDataSystemComponent::GetSurfaceAabb() const
     {
         auto terrain = AzFramework::Terrain::TerrainDataRequestBus::FindFirstHandler();
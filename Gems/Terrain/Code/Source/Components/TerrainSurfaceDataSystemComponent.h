@@ -59,6 +59,8 @@ namespace Terrain
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfaceData::SurfacePointList& surfacePointList) const override;
+        void GetSurfacePointsFromList(
+            AZStd::span<const size_t> inputIndices, SurfaceData::PackedSurfacePointList& surfacePointList) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // AzFramework::Terrain::TerrainDataNotificationBus
@@ -139,6 +139,12 @@ namespace Terrain
             {
                 m_dependencyMonitor.ConnectDependency(surfaceMapping.m_gradientEntityId);
             }
+
+            // Mappings without a gradient keep an empty slot, so that the compiled gradients stay indexed like the mappings.
+            m_compiledGradients.emplace_back(
+                surfaceMapping.m_gradientEntityId.IsValid()
+                    ? AZStd::make_unique<GradientSignal::CompiledGradient>(surfaceMapping.m_gradientEntityId)
+                    : nullptr);
         }
 
         // Notify that the area has changed.
@@ -148,6 +154,7 @@ namespace Terrain
     void TerrainSurfaceGradientListComponent::Deactivate()
     {
         m_dependencyMonitor.Reset();
+        m_compiledGradients.clear();
 
         Terrain::TerrainAreaSurfaceRequestBus::Handler::BusDisconnect();
         LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
@@ -203,10 +210,18 @@ namespace Terrain
 
         AZStd::vector<float> gradientValues(inPositionList.size());
 
-        for (const auto& mapping : m_configuration.m_gradientSurfaceMappings)
+        for (size_t mappingIndex = 0; mappingIndex < m_compiledGradients.size(); mappingIndex++)
         {
-            GradientSignal::GradientRequestBus::Event(
-                mapping.m_gradientEntityId, &GradientSignal::GradientRequestBus::Events::GetValues, inPositionList, gradientValues);
+            const auto& mapping = m_configuration.m_gradientSurfaceMappings[mappingIndex];
+            if (m_compiledGradients[mappingIndex])
+            {
+                m_compiledGradients[mappingIndex]->GetValues(inPositionList, gradientValues);
+            }
+            else
+            {
+                // Same as the single position query, where the bus leaves the weight at 0 for an invalid gradient.
+                AZStd::fill(gradientValues.begin(), gradientValues.end(), 0.0f);
+            }
 
             for (size_t index = 0; index < outSurfaceWeightsList.size(); index++)
             {
@@ -217,6 +232,15 @@ namespace Terrain
 
     void TerrainSurfaceGradientListComponent::OnCompositionChanged()
     {
+        // The compiled gradients track the gradients compiled into them, but not the activation of the gradient entities themselves.
+        for (auto& compiledGradient : m_compiledGradients)
+        {
+            if (compiledGradient)
+            {
+                compiledGradient->Invalidate();
+            }
+        }
+
         TerrainSystemServiceRequestBus::Broadcast(
             &TerrainSystemServiceRequestBus::Events::RefreshArea, GetEntityId(),
             AzFramework::Terrain::TerrainDataNotifications::SurfaceData);
@@ -11,6 +11,7 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Component/Component.h>
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
+#include <GradientSignal/CompiledGradient.h>
 #include <LmbrCentral/Dependency/DependencyMonitor.h>
 #include <LmbrCentral/Dependency/DependencyNotificationBus.h>
 #include <SurfaceData/SurfaceDataTypes.h>
@@ -91,5 +92,9 @@ namespace Terrain
 
         TerrainSurfaceGradientListConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
+
+        // The compiled gradient networks used for the surface weight list queries, one for each gradient surface mapping,
+        // or nullptr for the mappings without a valid gradient.
+        AZStd::vector<AZStd::unique_ptr<GradientSignal::CompiledGradient>> m_compiledGradients;
     };
 } // namespace Terrain
@@ -27,8 +27,9 @@ namespace Terrain
         if (serialize)
         {
             serialize->Class<TerrainWorldRendererConfig, AZ::ComponentConfig>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("WorldSize", &TerrainWorldRendererConfig::m_worldSize)
+                ->Field("ClipmapLods", &TerrainWorldRendererConfig::m_clipmapLodsEnabled)
                 ;
 
             AZ::EditContext* editContext = serialize->GetEditContext();
@@ -47,6 +48,9 @@ namespace Terrain
                         ->EnumAttribute(TerrainWorldRendererConfig::WorldSize::_8192Meters, "8 Kilometers")
                         ->EnumAttribute(TerrainWorldRendererConfig::WorldSize::_16384Meters, "16 Kilometers")
                         ->Attribute(AZ::Edit::Attributes::Visibility, false) // Keeping invisible until it's hooked up under the hood
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &TerrainWorldRendererConfig::m_clipmapLodsEnabled, "Clipmap LODs",
+                        "Choose the LODs of the terrain sectors from the rings of a CPU clipmap of heights around the camera, and use its "
+                        "heights to cull the sectors more tightly. Only the regions that come into view are updated as the camera moves.")
                         ;
             }
         }
@@ -133,6 +137,10 @@ namespace Terrain
         if (AZ::RPI::Scene* scene = GetScene(); scene)
         {
             m_terrainFeatureProcessor = scene->EnableFeatureProcessor<Terrain::TerrainFeatureProcessor>();
+            if (m_terrainFeatureProcessor)
+            {
+                m_terrainFeatureProcessor->SetClipmapLodsEnabled(m_configuration.m_clipmapLodsEnabled);
+            }
         }
         m_terrainRendererActive = true;
     }
@@ -47,6 +47,9 @@ namespace Terrain
         };
 
         WorldSize m_worldSize = WorldSize::_1024Meters;
+
+        //! Choose the LODs of the terrain sectors from a clipmap of heights around the camera, which is updated incrementally as the camera moves.
+        bool m_clipmapLodsEnabled = false;
     };
 
 
@@ -358,6 +358,8 @@ namespace Terrain
                     m_meshManager.RebuildDrawPackets(*GetParentScene());
                 }
                 m_forceRebuildDrawPackets = false;
+
+                m_meshManager.UpdateClipmap(cameraPosition);
             }
 
             if (m_terrainSrg)
@@ -428,6 +430,11 @@ namespace Terrain
         // This will control the max rendering size. Actual terrain size can be much
         // larger but this will limit how much is rendered.
     }
+
+    void TerrainFeatureProcessor::SetClipmapLodsEnabled(bool enabled)
+    {
+        m_meshManager.SetClipmapEnabled(enabled);
+    }
     
     void TerrainFeatureProcessor::CacheForwardPass()
     {
@@ -53,6 +53,7 @@ namespace Terrain
         void Render(const AZ::RPI::FeatureProcessor::RenderPacket& packet) override;
 
         void SetWorldSize(AZ::Vector2 sizeInMeters);
+        void SetClipmapLodsEnabled(bool enabled);
 
     private:
 
@@ -0,0 +1,418 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainRenderer/TerrainHeightClipmap.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzFramework/Terrain/TerrainDataRequestBus.h>
+
+namespace Terrain
+{
+    namespace
+    {
+        [[maybe_unused]] static const char* TerrainHeightClipmapName = "TerrainHeightClipmap";
+    }
+
+    TerrainHeightClipmap::~TerrainHeightClipmap()
+    {
+        Reset();
+    }
+
+    void TerrainHeightClipmap::Initialize(const TerrainHeightClipmapDescriptor& desc, const AZ::Vector3& center)
+    {
+        AZ_Error(TerrainHeightClipmapName, desc.m_size > 0 && desc.m_size % 2 == 0, "Clipmap size should be a positive even number.");
+        AZ_Error(TerrainHeightClipmapName, desc.m_sampleSpacing > 0.0f, "Clipmap sample spacing should be greater than 0.0f.");
+
+        Reset();
+        m_descriptor = desc;
+        m_levels.resize(desc.m_levelCount);
+
+        float sampleSpacing = desc.m_sampleSpacing;
+        for (ClipmapLevel& level : m_levels)
+        {
+            ClipmapBoundsDescriptor boundsDesc;
+            boundsDesc.m_size = desc.m_size;
+            boundsDesc.m_worldSpaceCenter = AZ::Vector2(center.GetX(), center.GetY());
+            boundsDesc.m_clipmapUpdateMultiple = desc.m_clipmapUpdateMultiple;
+            boundsDesc.m_clipToWorldScale = sampleSpacing;
+
+            level.m_bounds = ClipmapBounds(boundsDesc);
+            level.m_sampleSpacing = sampleSpacing;
+            level.m_heights.resize(desc.m_size * desc.m_size, 0.0f);
+            level.m_pendingRegions.push_back(level.m_bounds.GetWorldBounds());
+
+            sampleSpacing *= 2.0f;
+        }
+    }
+
+    bool TerrainHeightClipmap::IsInitialized() const
+    {
+        return !m_levels.empty();
+    }
+
+    void TerrainHeightClipmap::Reset()
+    {
+        // Don't wait for the queries in flight, since they may need locks held by the caller. They keep their own heights
+        // alive until they complete.
+        for (ClipmapLevel& level : m_levels)
+        {
+            for (HeightQuery& query : level.m_queriesInFlight)
+            {
+                if (query.m_jobContext)
+                {
+                    query.m_jobContext->Cancel();
+                }
+            }
+        }
+        m_levels.clear();
+    }
+
+    size_t TerrainHeightClipmap::Update(const AZ::Vector3& center, AZStd::vector<AZ::Aabb>* updatedRegions)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const AZ::Vector2 center2d = AZ::Vector2(center.GetX(), center.GetY());
+        for (ClipmapLevel& level : m_levels)
+        {
+            // Only the strips along the edges of the level that came into view need new heights, everything else
+            // stays where it is in the toroidal storage.
+            for (const ClipmapBoundsRegion& region : level.m_bounds.UpdateCenter(center2d))
+            {
+                level.m_pendingRegions.push_back(region.m_worldAabb);
+            }
+        }
+
+        CompleteQueries(updatedRegions);
+
+        // Start the next batch of queries only once the previous one is done, so the samples in flight stay within the budget.
+        if (AreQueriesInFlight())
+        {
+            return 0;
+        }
+
+        // Fill the finer levels first since they're closest to the center.
+        const size_t sampleBudget = AZ::GetMax<size_t>(m_descriptor.m_maxSamplesPerUpdate, 1);
+        size_t samplesProcessed = 0;
+        for (ClipmapLevel& level : m_levels)
+        {
+            while (!level.m_pendingRegions.empty() && samplesProcessed < sampleBudget)
+            {
+                samplesProcessed += ProcessPendingRegion(level, sampleBudget - samplesProcessed);
+            }
+        }
+
+        // Queries can complete right away, such as when the terrain system has no task executor to run them on.
+        CompleteQueries(updatedRegions);
+
+        return samplesProcessed;
+    }
+
+    void TerrainHeightClipmap::MarkDirty(const AZ::Aabb& dirtyRegion)
+    {
+        for (ClipmapLevel& level : m_levels)
+        {
+            const AZ::Aabb levelBounds = level.m_bounds.GetWorldBounds();
+            if (!dirtyRegion.IsValid())
+            {
+                level.m_pendingRegions.clear();
+                level.m_pendingRegions.push_back(levelBounds);
+                continue;
+            }
+
+            // Expand the region to the sample grid of the level so it includes every sample the dirty region touches.
+            const float spacing = level.m_sampleSpacing;
+            const AZ::Aabb region = AZ::Aabb::CreateFromMinMaxValues(
+                AZStd::floorf(dirtyRegion.GetMin().GetX() / spacing) * spacing,
+                AZStd::floorf(dirtyRegion.GetMin().GetY() / spacing) * spacing,
+                0.0f,
+                (AZStd::floorf(dirtyRegion.GetMax().GetX() / spacing) + 1.0f) * spacing,
+                (AZStd::floorf(dirtyRegion.GetMax().GetY() / spacing) + 1.0f) * spacing,
+                0.0f);
+
+            if (region.Overlaps(levelBounds))
+            {
+                level.m_pendingRegions.push_back(region);
+            }
+        }
+    }
+
+    bool TerrainHeightClipmap::HasPendingUpdates() const
+    {
+        for (const ClipmapLevel& level : m_levels)
+        {
+            if (!level.m_pendingRegions.empty() || !level.m_queriesInFlight.empty())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t TerrainHeightClipmap::GetLevelCount() const
+    {
+        return m_levels.size();
+    }
+
+    float TerrainHeightClipmap::GetLevelSampleSpacing(size_t level) const
+    {
+        return level < m_levels.size() ? m_levels.at(level).m_sampleSpacing : 0.0f;
+    }
+
+    AZ::Aabb TerrainHeightClipmap::GetLevelWorldBounds(size_t level) const
+    {
+        return level < m_levels.size() ? m_levels.at(level).m_bounds.GetWorldBounds() : AZ::Aabb::CreateNull();
+    }
+
+    bool TerrainHeightClipmap::IsLevelReady(size_t level) const
+    {
+        return level < m_levels.size() && m_levels.at(level).m_pendingRegions.empty() && m_levels.at(level).m_queriesInFlight.empty();
+    }
+
+    bool TerrainHeightClipmap::FindLevelForRegion(const AZ::Aabb& region, size_t& level) const
+    {
+        // Only the samples the region needs have to be up to date. Otherwise, every time the center moves, the whole level
+        // would be skipped until the strips that came into view at its edges get their heights.
+        Aabb2i sampleRange;
+        for (size_t i = 0; i < m_levels.size(); ++i)
+        {
+            if (GetSampleRange(m_levels.at(i), region, sampleRange) && !IsSampleRangePending(m_levels.at(i), sampleRange))
+            {
+                level = i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool TerrainHeightClipmap::ContainsRegion(size_t level, const AZ::Aabb& region) const
+    {
+        Aabb2i sampleRange;
+        return level < m_levels.size() && GetSampleRange(m_levels.at(level), region, sampleRange);
+    }
+
+    bool TerrainHeightClipmap::GetHeightBounds(const AZ::Aabb& region, float& minHeight, float& maxHeight) const
+    {
+        // Only the finest level is used. The coarser levels skip the samples in between theirs, so peaks and valleys
+        // between their samples would be left out of the bounds.
+        if (m_levels.empty())
+        {
+            return false;
+        }
+
+        const ClipmapLevel& level = m_levels.front();
+        Aabb2i sampleRange;
+        if (!GetSampleRange(level, region, sampleRange) || IsSampleRangePending(level, sampleRange))
+        {
+            return false;
+        }
+
+        minHeight = AZStd::numeric_limits<float>::max();
+        maxHeight = AZStd::numeric_limits<float>::lowest();
+        for (int32_t y = sampleRange.m_min.m_y; y < sampleRange.m_max.m_y; ++y)
+        {
+            for (int32_t x = sampleRange.m_min.m_x; x < sampleRange.m_max.m_x; ++x)
+            {
+                const float height = level.m_heights[GetHeightIndex(x, y)];
+                minHeight = AZ::GetMin(minHeight, height);
+                maxHeight = AZ::GetMax(maxHeight, height);
+            }
+        }
+        return true;
+    }
+
+    size_t TerrainHeightClipmap::ProcessPendingRegion(ClipmapLevel& level, size_t sampleBudget)
+    {
+        // The bounds may have moved since the region was queued, so only the part still inside the level is needed.
+        const AZ::Aabb levelBounds = level.m_bounds.GetWorldBounds();
+        AZ::Aabb region = level.m_pendingRegions.front().GetClamped(levelBounds);
+
+        const float spacing = level.m_sampleSpacing;
+        const int32_t columns = region.IsValid() ? AZStd::lround(region.GetXExtent() / spacing) : 0;
+        const int32_t rows = region.IsValid() ? AZStd::lround(region.GetYExtent() / spacing) : 0;
+        if (columns <= 0 || rows <= 0)
+        {
+            level.m_pendingRegions.pop_front();
+            return 0;
+        }
+
+        // Process as many whole rows as fit in the budget, but always at least one row so the update makes progress.
+        const int32_t rowsToProcess = AZStd::clamp(aznumeric_cast<int32_t>(sampleBudget / columns), 1, rows);
+        if (rowsToProcess < rows)
+        {
+            const float splitY = region.GetMin().GetY() + rowsToProcess * spacing;
+            AZ::Aabb& remainingRegion = level.m_pendingRegions.front();
+            remainingRegion = region;
+            remainingRegion.SetMin(AZ::Vector3(region.GetMin().GetX(), splitY, 0.0f));
+            region.SetMax(AZ::Vector3(region.GetMax().GetX(), splitY, 0.0f));
+        }
+        else
+        {
+            level.m_pendingRegions.pop_front();
+        }
+
+        // The heights are queried into their own buffer rather than into the toroidal storage, so the query doesn't
+        // depend on where the region is in the storage by the time it completes.
+        const size_t width = aznumeric_cast<size_t>(columns);
+        const size_t height = aznumeric_cast<size_t>(rowsToProcess);
+
+        HeightQuery query;
+        query.m_sampleRange = GetAlignedSampleRange(level, region);
+        query.m_heights = AZStd::make_shared<AZStd::vector<float>>(width * height, 0.0f);
+
+        // The callback is called from several task graph threads at once, but each sample is only written by one of them.
+        auto perPositionCallback = [heights = query.m_heights, width, height]
+            (size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+        {
+            if (xIndex < width && yIndex < height)
+            {
+                (*heights)[yIndex * width + xIndex] = surfacePoint.m_position.GetZ();
+            }
+        };
+
+        // The region queries treat max as exclusive, so pull it in by half a sample to get exactly width * height samples.
+        const AZ::Vector3 regionMin = region.GetMin();
+        const AZ::Aabb queryRegion = AZ::Aabb::CreateFromMinMax(
+            regionMin, regionMin + AZ::Vector3((width - 0.5f) * spacing, (height - 0.5f) * spacing, 0.0f));
+
+        AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
+            query.m_jobContext, &AzFramework::Terrain::TerrainDataRequests::ProcessHeightsFromRegionAsync, queryRegion,
+            AZ::Vector2(spacing), perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT,
+            AzFramework::Terrain::QueryAsyncParams{});
+
+        level.m_queriesInFlight.push_back(AZStd::move(query));
+        return width * height;
+    }
+
+    void TerrainHeightClipmap::CompleteQueries(AZStd::vector<AZ::Aabb>* updatedRegions)
+    {
+        for (ClipmapLevel& level : m_levels)
+        {
+            const Aabb2i levelRange = GetAlignedSampleRange(level, level.m_bounds.GetWorldBounds());
+            const float spacing = level.m_sampleSpacing;
+
+            for (auto queryIt = level.m_queriesInFlight.begin(); queryIt != level.m_queriesInFlight.end();)
+            {
+                const HeightQuery& query = *queryIt;
+                if (query.m_jobContext && !query.m_jobContext->IsComplete())
+                {
+                    ++queryIt;
+                    continue;
+                }
+
+                // The center may have moved since the query started. Samples that went out of view map to the storage of
+                // the samples that came into view, which have their own queries, so only keep the ones still in the level.
+                const Aabb2i sampleRange = query.m_sampleRange.GetClamped(levelRange);
+                if (sampleRange.IsValid())
+                {
+                    if (query.m_jobContext && query.m_jobContext->IsCancelled())
+                    {
+                        // Not every sample got a height, so ask for the region again.
+                        level.m_pendingRegions.push_back(AZ::Aabb::CreateFromMinMaxValues(
+                            sampleRange.m_min.m_x * spacing, sampleRange.m_min.m_y * spacing, 0.0f,
+                            sampleRange.m_max.m_x * spacing, sampleRange.m_max.m_y * spacing, 0.0f));
+                    }
+                    else
+                    {
+                        const int32_t queryWidth = query.m_sampleRange.m_max.m_x - query.m_sampleRange.m_min.m_x;
+                        const float* queryHeights = query.m_heights->data();
+                        for (int32_t y = sampleRange.m_min.m_y; y < sampleRange.m_max.m_y; ++y)
+                        {
+                            const int32_t queryRow = (y - query.m_sampleRange.m_min.m_y) * queryWidth;
+                            for (int32_t x = sampleRange.m_min.m_x; x < sampleRange.m_max.m_x; ++x)
+                            {
+                                level.m_heights[GetHeightIndex(x, y)] = queryHeights[queryRow + x - query.m_sampleRange.m_min.m_x];
+                            }
+                        }
+
+                        if (updatedRegions)
+                        {
+                            updatedRegions->push_back(AZ::Aabb::CreateFromMinMaxValues(
+                                sampleRange.m_min.m_x * spacing, sampleRange.m_min.m_y * spacing, 0.0f,
+                                sampleRange.m_max.m_x * spacing, sampleRange.m_max.m_y * spacing, 0.0f));
+                        }
+                    }
+                }
+
+                queryIt = level.m_queriesInFlight.erase(queryIt);
+            }
+        }
+    }
+
+    bool TerrainHeightClipmap::AreQueriesInFlight() const
+    {
+        for (const ClipmapLevel& level : m_levels)
+        {
+            if (!level.m_queriesInFlight.empty())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool TerrainHeightClipmap::IsSampleRangePending(const ClipmapLevel& level, const Aabb2i& sampleRange) const
+    {
+        auto overlaps = [&sampleRange](const Aabb2i& otherRange)
+        {
+            return otherRange.m_min.m_x < sampleRange.m_max.m_x && sampleRange.m_min.m_x < otherRange.m_max.m_x &&
+                otherRange.m_min.m_y < sampleRange.m_max.m_y && sampleRange.m_min.m_y < otherRange.m_max.m_y;
+        };
+
+        for (const AZ::Aabb& pendingRegion : level.m_pendingRegions)
+        {
+            if (overlaps(GetAlignedSampleRange(level, pendingRegion)))
+            {
+                return true;
+            }
+        }
+        for (const HeightQuery& query : level.m_queriesInFlight)
+        {
+            if (overlaps(query.m_sampleRange))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Aabb2i TerrainHeightClipmap::GetAlignedSampleRange(const ClipmapLevel& level, const AZ::Aabb& region)
+    {
+        const float rcpSpacing = 1.0f / level.m_sampleSpacing;
+        return Aabb2i(
+            Vector2i(AZStd::lround(region.GetMin().GetX() * rcpSpacing), AZStd::lround(region.GetMin().GetY() * rcpSpacing)),
+            Vector2i(AZStd::lround(region.GetMax().GetX() * rcpSpacing), AZStd::lround(region.GetMax().GetY() * rcpSpacing)));
+    }
+
+    bool TerrainHeightClipmap::GetSampleRange(const ClipmapLevel& level, const AZ::Aabb& region, Aabb2i& sampleRange) const
+    {
+        const float rcpSpacing = 1.0f / level.m_sampleSpacing;
+        const Aabb2i levelRange = GetAlignedSampleRange(level, level.m_bounds.GetWorldBounds());
+
+        // Include the samples on both sides of the region edges since the triangles crossing the edges use them.
+        sampleRange.m_min = Vector2i(
+            aznumeric_cast<int32_t>(AZStd::floorf(region.GetMin().GetX() * rcpSpacing)),
+            aznumeric_cast<int32_t>(AZStd::floorf(region.GetMin().GetY() * rcpSpacing)));
+        sampleRange.m_max = Vector2i(
+            aznumeric_cast<int32_t>(AZStd::ceilf(region.GetMax().GetX() * rcpSpacing)) + 1,
+            aznumeric_cast<int32_t>(AZStd::ceilf(region.GetMax().GetY() * rcpSpacing)) + 1);
+
+        return sampleRange.m_min.m_x >= levelRange.m_min.m_x && sampleRange.m_min.m_y >= levelRange.m_min.m_y &&
+            sampleRange.m_max.m_x <= levelRange.m_max.m_x && sampleRange.m_max.m_y <= levelRange.m_max.m_y;
+    }
+
+    size_t TerrainHeightClipmap::GetHeightIndex(int32_t x, int32_t y) const
+    {
+        const int32_t size = aznumeric_cast<int32_t>(m_descriptor.m_size);
+        const int32_t localX = ((x % size) + size) % size;
+        const int32_t localY = ((y % size) + size) % size;
+        return aznumeric_cast<size_t>(localY * size + localX);
+    }
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <TerrainRenderer/ClipmapBounds.h>
+
+namespace AzFramework::Terrain
+{
+    class TerrainJobContext;
+}
+
+namespace Terrain
+{
+    struct TerrainHeightClipmapDescriptor
+    {
+        //! Number of nested clipmap levels. Each level covers twice the width of the previous level at half the sample density.
+        uint32_t m_levelCount = 4;
+
+        //! Width and height of each clipmap level in height samples. Should be an even number.
+        uint32_t m_size = 512;
+
+        //! Distance between the height samples of the finest level in meters. This should match the resolution of the
+        //! rendered terrain heights, so that the finest level has every height the terrain is rendered with.
+        float m_sampleSpacing = 1.0f;
+
+        //! Updates to the clipmap levels are produced in multiples of this many samples. See ClipmapBoundsDescriptor.
+        uint32_t m_clipmapUpdateMultiple = 4;
+
+        //! The maximum number of height samples queried in a single Update(). Regions that don't fit in the budget
+        //! are continued once the queries in flight are done, so large dirty regions don't flood the task graph.
+        uint32_t m_maxSamplesPerUpdate = 64 * 1024;
+    };
+
+    // A CPU-side clipmap of terrain heights around a center point like the camera. Each level keeps a toroidal grid of
+    // heights using ClipmapBounds, so when the center moves, only the newly exposed strips along the edges of each level
+    // need new heights. The heights are fetched with asynchronous terrain region queries that run on the task graph, and
+    // each batch of queries is capped to a number of samples, so the calling thread only pays for submitting the queries
+    // and copying their results.
+    class TerrainHeightClipmap
+    {
+    public:
+
+        TerrainHeightClipmap() = default;
+        ~TerrainHeightClipmap();
+
+        //! Creates the clipmap levels around the given center and queues every level for a full refresh.
+        void Initialize(const TerrainHeightClipmapDescriptor& desc, const AZ::Vector3& center);
+        bool IsInitialized() const;
+
+        //! Removes the clipmap levels. Queries still in flight are cancelled and their results are dropped.
+        void Reset();
+
+        //! Moves the center of the clipmap, which queues the newly exposed regions of each level, and copies the heights of
+        //! the queries that completed into the levels. Once all the queries in flight are done, queries for the next queued
+        //! regions are started, finest level first, until the sample budget is used up. This never waits on the queries.
+        //! @param center The new center of the clipmap in world space. Z is ignored.
+        //! @param updatedRegions If not null, the world space regions that received new heights get added to this list.
+        //! @return The number of height samples that were queried.
+        size_t Update(const AZ::Vector3& center, AZStd::vector<AZ::Aabb>* updatedRegions = nullptr);
+
+        //! Queues a world space region of every level that overlaps it for a refresh, such as after the terrain heights changed.
+        //! An invalid region refreshes all of the levels entirely.
+        void MarkDirty(const AZ::Aabb& dirtyRegion);
+
+        //! Returns true if any level still has queued regions that need heights, or queries in flight.
+        bool HasPendingUpdates() const;
+
+        size_t GetLevelCount() const;
+        float GetLevelSampleSpacing(size_t level) const;
+        AZ::Aabb GetLevelWorldBounds(size_t level) const;
+
+        //! Returns true if the level has no queued regions or queries in flight, so all of its heights are up to date.
+        bool IsLevelReady(size_t level) const;
+
+        //! Finds the finest level that contains the XY extents of the region, including its max edges, and whose heights
+        //! are up to date within them. Regions still waiting for heights elsewhere in a level don't prevent using it.
+        bool FindLevelForRegion(const AZ::Aabb& region, size_t& level) const;
+
+        //! Returns true if the level contains the XY extents of the region, including its max edges, whether or not its
+        //! heights are up to date there.
+        bool ContainsRegion(size_t level, const AZ::Aabb& region) const;
+
+        //! Gets the min and max heights of the samples within the XY extents of the region and along its edges. Only the
+        //! finest level is used, since its samples are the full resolution heights, so the bounds include everything
+        //! between the samples as long as m_sampleSpacing matches the spacing of the rendered heights. Returns false if
+        //! the finest level doesn't contain the region or is still waiting for heights within it.
+        bool GetHeightBounds(const AZ::Aabb& region, float& minHeight, float& maxHeight) const;
+
+    private:
+
+        //! An asynchronous query for the heights of a region of a level.
+        struct HeightQuery
+        {
+            //! The samples queried, in unscaled clipmap space. Max is exclusive.
+            Aabb2i m_sampleRange;
+
+            //! The queried heights, row by row. The query writes them from the task graph threads, so the query keeps
+            //! them alive even if the clipmap is reset before the query completes.
+            AZStd::shared_ptr<AZStd::vector<float>> m_heights;
+
+            //! Null if there was no terrain system to run the query, in which case the heights are left as they are.
+            AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> m_jobContext;
+        };
+
+        struct ClipmapLevel
+        {
+            ClipmapBounds m_bounds;
+            float m_sampleSpacing = 1.0f;
+
+            //! Toroidal storage of m_size * m_size heights, indexed by local clipmap coordinates.
+            AZStd::vector<float> m_heights;
+
+            //! World space regions, aligned to the sample grid of the level, that are waiting for new heights.
+            AZStd::deque<AZ::Aabb> m_pendingRegions;
+
+            //! Queries that haven't been copied into m_heights yet.
+            AZStd::vector<HeightQuery> m_queriesInFlight;
+        };
+
+        //! Starts a query for as much of the first queued region of the level as fits within the sample budget.
+        size_t ProcessPendingRegion(ClipmapLevel& level, size_t sampleBudget);
+
+        //! Copies the heights of the queries that completed into the levels. The parts of the queried regions which are
+        //! outside of the bounds of their level by now are dropped, and cancelled queries are queued again.
+        void CompleteQueries(AZStd::vector<AZ::Aabb>* updatedRegions);
+
+        //! Returns true if any level has queries in flight.
+        bool AreQueriesInFlight() const;
+
+        //! Returns true if a queued region or a query in flight of the level overlaps the range of samples.
+        bool IsSampleRangePending(const ClipmapLevel& level, const Aabb2i& sampleRange) const;
+
+        //! Converts a world space region aligned to the sample grid of the level to its range of samples. Max is exclusive.
+        static Aabb2i GetAlignedSampleRange(const ClipmapLevel& level, const AZ::Aabb& region);
+
+        //! Gets the range of samples of the level, in unscaled clipmap space, needed to cover the XY extents of the region.
+        //! Returns false if any of those samples are outside of the bounds of the level. Max is exclusive.
+        bool GetSampleRange(const ClipmapLevel& level, const AZ::Aabb& region, Aabb2i& sampleRange) const;
+
+        //! Returns the index into the toroidal storage for a sample in unscaled clipmap space.
+        size_t GetHeightIndex(int32_t x, int32_t y) const;
+
+        AZStd::vector<ClipmapLevel> m_levels;
+        TerrainHeightClipmapDescriptor m_descriptor;
+    };
+}
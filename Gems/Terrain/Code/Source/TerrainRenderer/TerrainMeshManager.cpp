@@ -61,6 +61,9 @@ namespace Terrain
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusDisconnect();
         m_patchModel = {};
         m_sectorData.clear();
+        m_clipmap.Reset();
+        m_clipmapUpdatedRegions.clear();
+        m_sectorHeightBoundsPending = false;
         m_rebuildSectors = true;
         m_isInitialized = false;
     }
@@ -134,6 +137,12 @@ namespace Terrain
                     );
             }
         }
+
+        if (m_clipmapEnabled)
+        {
+            // The new sectors start out with the full height range of the world until the clipmap can tighten them.
+            MarkSectorHeightBoundsPending(m_worldBounds);
+        }
         return true;
     }
 
@@ -143,26 +152,36 @@ namespace Terrain
         {
             uint8_t lodChoice = AZ::RPI::ModelLodAsset::LodCountMax;
 
-            // Go through all cameras and choose an LOD based on the closest camera.
-            for (auto& view : process.m_views)
+            size_t clipmapLevel = 0;
+            if (m_clipmapEnabled && m_clipmap.FindLevelForRegion(sectorData.m_aabb, clipmapLevel))
+            {
+                // Each clipmap level has half the sample density of the previous one, just like the LODs, so the finest
+                // level covering the sector is the LOD to use. All cameras use it since the clipmap follows the camera.
+                lodChoice = aznumeric_cast<uint8_t>(clipmapLevel);
+            }
+            else
             {
-                if ((view->GetUsageFlags() & AZ::RPI::View::UsageFlags::UsageCamera) > 0)
+                // Go through all cameras and choose an LOD based on the closest camera.
+                for (auto& view : process.m_views)
                 {
-                    const AZ::Vector3 cameraPosition = view->GetCameraTransform().GetTranslation();
-                    const AZ::Vector2 cameraPositionXY = AZ::Vector2(cameraPosition.GetX(), cameraPosition.GetY());
-                    const AZ::Vector2 sectorCenterXY = AZ::Vector2(sectorData.m_aabb.GetCenter().GetX(), sectorData.m_aabb.GetCenter().GetY());
+                    if ((view->GetUsageFlags() & AZ::RPI::View::UsageFlags::UsageCamera) > 0)
+                    {
+                        const AZ::Vector3 cameraPosition = view->GetCameraTransform().GetTranslation();
+                        const AZ::Vector2 cameraPositionXY = AZ::Vector2(cameraPosition.GetX(), cameraPosition.GetY());
+                        const AZ::Vector2 sectorCenterXY = AZ::Vector2(sectorData.m_aabb.GetCenter().GetX(), sectorData.m_aabb.GetCenter().GetY());
 
-                    const float sectorDistance = sectorCenterXY.GetDistance(cameraPositionXY);
+                        const float sectorDistance = sectorCenterXY.GetDistance(cameraPositionXY);
 
-                    // This will be configurable later
-                    const float minDistanceForLod0 = (GridMeters * 4.0f);
+                        // This will be configurable later
+                        const float minDistanceForLod0 = (GridMeters * 4.0f);
 
-                    // For every distance doubling beyond a minDistanceForLod0, we only need half the mesh density. Each LOD
-                    // is exactly half the resolution of the last.
-                    const float lodForCamera = AZStd::floorf(AZ::GetMax(0.0f, log2f(sectorDistance / minDistanceForLod0)));
+                        // For every distance doubling beyond a minDistanceForLod0, we only need half the mesh density. Each LOD
+                        // is exactly half the resolution of the last.
+                        const float lodForCamera = AZStd::floorf(AZ::GetMax(0.0f, log2f(sectorDistance / minDistanceForLod0)));
 
-                    // All cameras should render the same LOD so effects like shadows are consistent.
-                    lodChoice = AZ::GetMin(lodChoice, aznumeric_cast<uint8_t>(lodForCamera));
+                        // All cameras should render the same LOD so effects like shadows are consistent.
+                        lodChoice = AZ::GetMin(lodChoice, aznumeric_cast<uint8_t>(lodForCamera));
+                    }
                 }
             }
 
@@ -190,12 +209,131 @@ namespace Terrain
         }
     }
 
+    template<typename Callback>
+    void TerrainMeshManager::ForOverlappingSectors(const AZ::Aabb& bounds, Callback callback)
+    {
+        // Only check the x/y bounds since the height range of each sector can differ from the bounds being checked.
+        for (SectorData& sectorData : m_sectorData)
+        {
+            const AZ::Aabb& sectorAabb = sectorData.m_aabb;
+            if (sectorAabb.GetMin().GetX() <= bounds.GetMax().GetX() && sectorAabb.GetMax().GetX() >= bounds.GetMin().GetX() &&
+                sectorAabb.GetMin().GetY() <= bounds.GetMax().GetY() && sectorAabb.GetMax().GetY() >= bounds.GetMin().GetY())
+            {
+                callback(sectorData);
+            }
+        }
+    }
+
+    void TerrainMeshManager::SetClipmapEnabled(bool enabled)
+    {
+        if (m_clipmapEnabled == enabled)
+        {
+            return;
+        }
+
+        m_clipmapEnabled = enabled;
+        m_clipmap.Reset();
+        m_clipmapUpdatedRegions.clear();
+        m_sectorHeightBoundsPending = false;
+
+        if (!enabled)
+        {
+            // Go back to the full height range of the world since the sector bounds won't be kept up to date anymore.
+            for (SectorData& sectorData : m_sectorData)
+            {
+                sectorData.m_aabb.SetMin(AZ::Vector3(sectorData.m_aabb.GetMin().GetX(), sectorData.m_aabb.GetMin().GetY(), m_worldBounds.GetMin().GetZ()));
+                sectorData.m_aabb.SetMax(AZ::Vector3(sectorData.m_aabb.GetMax().GetX(), sectorData.m_aabb.GetMax().GetY(), m_worldBounds.GetMax().GetZ()));
+                sectorData.m_heightBoundsPending = false;
+            }
+        }
+        else
+        {
+            MarkSectorHeightBoundsPending(m_worldBounds);
+        }
+    }
+
+    bool TerrainMeshManager::IsClipmapEnabled() const
+    {
+        return m_clipmapEnabled;
+    }
+
+    void TerrainMeshManager::UpdateClipmap(const AZ::Vector3& cameraPosition)
+    {
+        if (!m_clipmapEnabled || !m_isInitialized)
+        {
+            return;
+        }
+
+        if (!m_clipmap.IsInitialized())
+        {
+            TerrainHeightClipmapDescriptor desc;
+            desc.m_sampleSpacing = m_sampleSpacing;
+            m_clipmap.Initialize(desc, cameraPosition);
+        }
+
+        m_clipmapUpdatedRegions.clear();
+        m_clipmap.Update(cameraPosition, &m_clipmapUpdatedRegions);
+        for (const AZ::Aabb& region : m_clipmapUpdatedRegions)
+        {
+            MarkSectorHeightBoundsPending(region);
+        }
+
+        if (m_sectorHeightBoundsPending)
+        {
+            RefreshSectorHeightBounds();
+        }
+    }
+
+    void TerrainMeshManager::MarkSectorHeightBoundsPending(const AZ::Aabb& region)
+    {
+        ForOverlappingSectors(region,
+            [](SectorData& sectorData)
+            {
+                sectorData.m_heightBoundsPending = true;
+            }
+        );
+        m_sectorHeightBoundsPending = true;
+    }
+
+    void TerrainMeshManager::RefreshSectorHeightBounds()
+    {
+        // A sector can span regions that get their heights from different batches of queries, so each sector is refreshed
+        // as soon as the clipmap has all of its heights, rather than waiting for the whole clipmap to be up to date, which
+        // may never happen while the camera keeps moving.
+        const bool clipmapComplete = !m_clipmap.HasPendingUpdates();
+        bool sectorsPending = false;
+        for (SectorData& sectorData : m_sectorData)
+        {
+            if (!sectorData.m_heightBoundsPending)
+            {
+                continue;
+            }
+
+            float minHeight = 0.0f;
+            float maxHeight = 0.0f;
+            if (m_clipmap.GetHeightBounds(sectorData.m_aabb, minHeight, maxHeight))
+            {
+                sectorData.m_aabb.SetMin(AZ::Vector3(sectorData.m_aabb.GetMin().GetX(), sectorData.m_aabb.GetMin().GetY(), minHeight));
+                sectorData.m_aabb.SetMax(AZ::Vector3(sectorData.m_aabb.GetMax().GetX(), sectorData.m_aabb.GetMax().GetY(), maxHeight));
+                sectorData.m_heightBoundsPending = false;
+            }
+            else if (clipmapComplete || !m_clipmap.ContainsRegion(0, sectorData.m_aabb))
+            {
+                // The sector is outside of the finest clipmap level. The coarser levels don't have every height of the
+                // sector, so it keeps the height range it has rather than risk a range that cuts off its peaks.
+                sectorData.m_heightBoundsPending = false;
+            }
+            sectorsPending = sectorsPending || sectorData.m_heightBoundsPending;
+        }
+        m_sectorHeightBoundsPending = sectorsPending;
+    }
+
     void TerrainMeshManager::OnTerrainDataDestroyBegin()
     {
         Reset();
     }
 
-    void TerrainMeshManager::OnTerrainDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion, TerrainDataChangedMask dataChangedMask)
+    void TerrainMeshManager::OnTerrainDataChanged(const AZ::Aabb& dirtyRegion, TerrainDataChangedMask dataChangedMask)
     {
         if ((dataChangedMask & (TerrainDataChangedMask::HeightData | TerrainDataChangedMask::Settings)) != 0)
         {
@@ -216,8 +354,35 @@ namespace Terrain
                 m_worldBounds.GetMax().GetY() != worldBounds.GetMax().GetY() ||
                 m_sampleSpacing != queryResolution;
 
+            const bool sampleSpacingChanged = m_sampleSpacing != queryResolution;
+
             m_worldBounds = worldBounds;
             m_sampleSpacing = queryResolution;
+
+            if (m_clipmap.IsInitialized())
+            {
+                if (sampleSpacingChanged)
+                {
+                    // The clipmap gets recreated with the new sample spacing on the next update.
+                    m_clipmap.Reset();
+                }
+                else
+                {
+                    m_clipmap.MarkDirty(dirtyRegion);
+                }
+
+                // Fall back to the full height range of the world for the changed sectors until the clipmap has the new heights.
+                const AZ::Aabb changedRegion = dirtyRegion.IsValid() ? dirtyRegion : m_worldBounds;
+                ForOverlappingSectors(changedRegion,
+                    [this](SectorData& sectorData)
+                    {
+                        sectorData.m_aabb.SetMin(AZ::Vector3(sectorData.m_aabb.GetMin().GetX(), sectorData.m_aabb.GetMin().GetY(), m_worldBounds.GetMin().GetZ()));
+                        sectorData.m_aabb.SetMax(AZ::Vector3(sectorData.m_aabb.GetMax().GetX(), sectorData.m_aabb.GetMax().GetY(), m_worldBounds.GetMax().GetZ()));
+                        sectorData.m_heightBoundsPending = true;
+                    }
+                );
+                m_sectorHeightBoundsPending = true;
+            }
         }
     }
 
@@ -336,16 +501,4 @@ namespace Terrain
         return success;
     }
 
-    template<typename Callback>
-    void TerrainMeshManager::ForOverlappingSectors(const AZ::Aabb& bounds, Callback callback)
-    {
-        for (SectorData& sectorData : m_sectorData)
-        {
-            if (sectorData.m_aabb.Overlaps(bounds))
-            {
-                callback(sectorData);
-            }
-        }
-    }
-
 }
@@ -23,6 +23,8 @@
 
 #include <Atom/RPI.Reflect/Model/ModelLodAsset.h>
 
+#include <TerrainRenderer/TerrainHeightClipmap.h>
+
 
 namespace AZ::RPI
 {
@@ -59,6 +61,15 @@ namespace Terrain
         void DrawMeshes(const AZ::RPI::FeatureProcessor::RenderPacket& process);
         void RebuildDrawPackets(AZ::RPI::Scene& scene);
 
+        //! Enables choosing sector LODs from the rings of a clipmap of terrain heights around the camera instead of from the
+        //! distance to each sector. The clipmap also provides tight height bounds for culling the sectors. The sectors are
+        //! still drawn with the same LOD patches, and their heights still come from the heightmap on the GPU.
+        void SetClipmapEnabled(bool enabled);
+        bool IsClipmapEnabled() const;
+
+        //! Moves the clipmap to the camera position and incrementally updates the heights of the regions that came into view.
+        void UpdateClipmap(const AZ::Vector3& cameraPosition);
+
         static constexpr float GridSpacing{ 1.0f };
         static constexpr int32_t GridSize{ 64 }; // number of terrain quads (vertices are m_gridSize + 1)
         static constexpr float GridMeters{ GridSpacing * GridSize };
@@ -83,6 +94,7 @@ namespace Terrain
             AZStd::fixed_vector<AZ::RPI::MeshDrawPacket, AZ::RPI::ModelLodAsset::LodCountMax> m_drawPackets;
             AZStd::fixed_vector<AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>, AZ::RPI::ModelLodAsset::LodCountMax> m_srgs; // Hold on to refs so it's not dropped
             AZ::Aabb m_aabb;
+            bool m_heightBoundsPending = false; // Waiting for the clipmap to tighten the height range of m_aabb.
         };
         
         struct ShaderTerrainData // Must align with struct in Object Srg
@@ -104,14 +116,26 @@ namespace Terrain
         template<typename Callback>
         void ForOverlappingSectors(const AZ::Aabb& bounds, Callback callback);
 
+        //! Flags the sectors overlapping the region to have their height bounds refreshed from the clipmap.
+        void MarkSectorHeightBoundsPending(const AZ::Aabb& region);
+
+        //! Updates the height bounds of the flagged sectors for which the clipmap has all the heights.
+        void RefreshSectorHeightBounds();
+
         AZStd::vector<SectorData> m_sectorData;
         AZ::Data::Instance<AZ::RPI::Model> m_patchModel;
         
         AZ::Aabb m_worldBounds{ AZ::Aabb::CreateNull() };
         float m_sampleSpacing = 1.0f;
 
+        TerrainHeightClipmap m_clipmap;
+        //! Regions that received new clipmap heights in the last update, kept to avoid allocations.
+        AZStd::vector<AZ::Aabb> m_clipmapUpdatedRegions;
+
         bool m_isInitialized{ false };
         bool m_rebuildSectors{ true };
+        bool m_clipmapEnabled{ false };
+        bool m_sectorHeightBoundsPending{ false };
 
     };
 }
@@ -7,7 +7,12 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/sort.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
@@ -21,6 +26,28 @@
 
 using namespace Terrain;
 
+AZ_CVAR(uint32_t,
+    terrain_tileCacheMemoryBudgetMB,
+    32,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The memory budget in megabytes of the tile cache for the terrain height and surface weight queries. 0 disables the cache. "
+    "Applied when the terrain system activates."
+);
+
+namespace
+{
+    // The tile cache only gets used when the positions are bit-identical to the positions that the cached data was evaluated at.
+    bool IsBitIdentical(float value1, float value2)
+    {
+        AZ::u32 bits1;
+        AZ::u32 bits2;
+        memcpy(&bits1, &value1, sizeof(float));
+        memcpy(&bits2, &value2, sizeof(float));
+        return bits1 == bits2;
+    }
+}
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/keylookup.
@@ -82,11 +109,19 @@ void TerrainSystem::Activate()
     m_terrainSurfacesDirty = true;
     m_requestedSettings.m_systemActive = true;
 
+    {
+        AZStd::scoped_lock lock(m_asyncQueriesMutex);
+        m_asyncQueriesCancelled = false;
+    }
+
     {
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
         m_registeredAreas.clear();
     }
 
+    m_tileCache.Clear();
+    m_tileCache.SetMemoryBudget(aznumeric_cast<size_t>(static_cast<uint32_t>(terrain_tileCacheMemoryBudgetMB)) * 1024 * 1024);
+
     AzFramework::Terrain::TerrainDataRequestBus::Handler::BusConnect();
 
     // Register any terrain spawners that were already active before the terrain system activated.
@@ -110,6 +145,9 @@ void TerrainSystem::Deactivate()
     // calling DestroyBegin will fail to reach the terrain system.
     AzFramework::Terrain::TerrainDataRequestBus::Handler::BusDisconnect();
 
+    // Stop any asynchronous queries that are still in flight, since they reference the terrain areas.
+    CancelAsyncQueries();
+
     AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
         &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataDestroyBegin);
 
@@ -118,6 +156,8 @@ void TerrainSystem::Deactivate()
         m_registeredAreas.clear();
     }
 
+    m_tileCache.Clear();
+
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainHeightDirty = true;
     m_terrainSettingsDirty = true;
@@ -206,12 +246,18 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             ClampPosition(x, y, pos0, normalizedDelta);
             const AZ::Vector2 pos1 = pos0 + AZ::Vector2(m_currentSettings.m_heightQueryResolution);
 
-            const float heightX0Y0 = GetTerrainAreaHeight(pos0.GetX(), pos0.GetY(), terrainExists);
-            const float heightX1Y0 = GetTerrainAreaHeight(pos1.GetX(), pos0.GetY(), terrainExists);
-            const float heightX0Y1 = GetTerrainAreaHeight(pos0.GetX(), pos1.GetY(), terrainExists);
-            const float heightX1Y1 = GetTerrainAreaHeight(pos1.GetX(), pos1.GetY(), terrainExists);
-            const float heightXY0 = AZ::Lerp(heightX0Y0, heightX1Y0, normalizedDelta.GetX());
-            const float heightXY1 = AZ::Lerp(heightX0Y1, heightX1Y1, normalizedDelta.GetX());
+            TerrainHeightTile::GridSquare gridSquare;
+            if (!GetCachedGridSquare(pos0, gridSquare))
+            {
+                gridSquare.m_heightX0Y0 = GetTerrainAreaHeight(pos0.GetX(), pos0.GetY(), gridSquare.m_existsX0Y0);
+                gridSquare.m_heightX1Y0 = GetTerrainAreaHeight(pos1.GetX(), pos0.GetY(), terrainExists);
+                gridSquare.m_heightX0Y1 = GetTerrainAreaHeight(pos0.GetX(), pos1.GetY(), terrainExists);
+                gridSquare.m_heightX1Y1 = GetTerrainAreaHeight(pos1.GetX(), pos1.GetY(), gridSquare.m_existsX1Y1);
+            }
+
+            terrainExists = gridSquare.m_existsX1Y1;
+            const float heightXY0 = AZ::Lerp(gridSquare.m_heightX0Y0, gridSquare.m_heightX1Y0, normalizedDelta.GetX());
+            const float heightXY1 = AZ::Lerp(gridSquare.m_heightX0Y1, gridSquare.m_heightX1Y1, normalizedDelta.GetX());
             height = AZ::Lerp(heightXY0, heightXY1, normalizedDelta.GetY());
         }
         break;
@@ -223,7 +269,16 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             AZ::Vector2 clampedPosition;
             ClampPosition(x, y, clampedPosition, normalizedDelta);
 
-            height = GetTerrainAreaHeight(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists);
+            TerrainHeightTile::GridSquare gridSquare;
+            if (GetCachedGridSquare(clampedPosition, gridSquare))
+            {
+                height = gridSquare.m_heightX0Y0;
+                terrainExists = gridSquare.m_existsX0Y0;
+            }
+            else
+            {
+                height = GetTerrainAreaHeight(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists);
+            }
         }
         break;
 
@@ -231,7 +286,24 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
     case AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT:
         [[fallthrough]];
     default:
-        height = GetTerrainAreaHeight(x, y, terrainExists);
+        {
+            // Positions that lie exactly on the terrain sample grid can still be served from the cache.
+            AZ::Vector2 normalizedDelta;
+            AZ::Vector2 gridPosition;
+            ClampPosition(x, y, gridPosition, normalizedDelta);
+
+            TerrainHeightTile::GridSquare gridSquare;
+            if (IsBitIdentical(gridPosition.GetX(), x) && IsBitIdentical(gridPosition.GetY(), y) &&
+                GetCachedGridSquare(gridPosition, gridSquare))
+            {
+                height = gridSquare.m_heightX0Y0;
+                terrainExists = gridSquare.m_existsX0Y0;
+            }
+            else
+            {
+                height = GetTerrainAreaHeight(x, y, terrainExists);
+            }
+        }
         break;
     }
 
@@ -478,14 +550,23 @@ void TerrainSystem::GetOrderedSurfaceWeights(
     AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights,
     bool* terrainExistsPtr) const
 {
-    AZ::Aabb bounds;
-    AZ::EntityId bestAreaId = FindBestAreaEntityAtPosition(x, y, bounds);
-
     if (terrainExistsPtr)
     {
         GetHeightFromFloats(x, y, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT, terrainExistsPtr);
     }
 
+    if (!GetCachedSurfaceWeights(x, y, outSurfaceWeights))
+    {
+        GetOrderedSurfaceWeightsUncached(x, y, outSurfaceWeights);
+    }
+}
+
+void TerrainSystem::GetOrderedSurfaceWeightsUncached(
+    const float x, const float y, AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights) const
+{
+    AZ::Aabb bounds;
+    AZ::EntityId bestAreaId = FindBestAreaEntityAtPosition(x, y, bounds);
+
     outSurfaceWeights.clear();
 
     if (!bestAreaId.IsValid())
@@ -502,6 +583,215 @@ void TerrainSystem::GetOrderedSurfaceWeights(
     AZStd::sort(outSurfaceWeights.begin(), outSurfaceWeights.end(), AzFramework::SurfaceData::SurfaceTagWeightComparator());
 }
 
+bool TerrainSystem::GetGridIndices(const AZ::Vector2& gridPosition, int32_t& outGridX, int32_t& outGridY) const
+{
+    const float queryResolution = m_currentSettings.m_heightQueryResolution;
+    if (queryResolution <= 0.0f)
+    {
+        return false;
+    }
+
+    const float gridX = roundf(gridPosition.GetX() / queryResolution);
+    const float gridY = roundf(gridPosition.GetY() / queryResolution);
+    constexpr float maxGridIndex = aznumeric_cast<float>(TerrainTileCache::MaxGridIndex);
+    if (!(fabsf(gridX) <= maxGridIndex) || !(fabsf(gridY) <= maxGridIndex))
+    {
+        return false;
+    }
+
+    outGridX = aznumeric_cast<int32_t>(gridX);
+    outGridY = aznumeric_cast<int32_t>(gridY);
+
+    // The cached tiles calculate their grid positions the same way as ClampPosition(). Positions that don't match them exactly
+    // aren't served from the cache, so that cached queries always return the same results as uncached queries.
+    const AZ::Vector2 cachedPosition =
+        AZ::Vector2(aznumeric_cast<float>(outGridX), aznumeric_cast<float>(outGridY)) * queryResolution;
+    return IsBitIdentical(cachedPosition.GetX(), gridPosition.GetX()) && IsBitIdentical(cachedPosition.GetY(), gridPosition.GetY());
+}
+
+bool TerrainSystem::GetCachedGridSquare(const AZ::Vector2& gridPosition, TerrainHeightTile::GridSquare& outGridSquare) const
+{
+    int32_t gridX = 0;
+    int32_t gridY = 0;
+    if (!m_tileCache.IsEnabled() || !GetGridIndices(gridPosition, gridX, gridY))
+    {
+        return false;
+    }
+
+    const TerrainTileKey key = TerrainTileCache::GetTileKey(gridX, gridY);
+    AZStd::shared_ptr<const TerrainHeightTile> tile = m_tileCache.FindHeightTile(key);
+    if (!tile)
+    {
+        // Only one thread creates a tile at a time. The other threads that miss it meanwhile, including recursive queries from
+        // the area providers, query the terrain directly instead of waiting on the whole tile.
+        if (!m_tileCache.BeginCreateTile(key, TerrainTileCache::Layer::Heights))
+        {
+            return false;
+        }
+
+        // Get the generation before creating the tile, so that the tile doesn't get added if the terrain changes meanwhile.
+        const uint64_t generation = m_tileCache.GetGeneration();
+        tile = CreateHeightTile(key);
+        m_tileCache.AddHeightTile(key, tile, generation);
+        m_tileCache.EndCreateTile(key, TerrainTileCache::Layer::Heights);
+    }
+
+    size_t localX = 0;
+    size_t localY = 0;
+    TerrainTileCache::GetLocalIndices(key, gridX, gridY, localX, localY);
+    tile->GetGridSquare(localX, localY, outGridSquare);
+    return true;
+}
+
+bool TerrainSystem::GetCachedSurfaceWeights(
+    float x, float y, AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights) const
+{
+    if (!m_tileCache.IsEnabled())
+    {
+        return false;
+    }
+
+    // The surface weights are only cached at the grid points, since they get evaluated at the exact query position.
+    AZ::Vector2 normalizedDelta;
+    AZ::Vector2 gridPosition;
+    ClampPosition(x, y, gridPosition, normalizedDelta);
+
+    int32_t gridX = 0;
+    int32_t gridY = 0;
+    if (!IsBitIdentical(gridPosition.GetX(), x) || !IsBitIdentical(gridPosition.GetY(), y) ||
+        !GetGridIndices(gridPosition, gridX, gridY))
+    {
+        return false;
+    }
+
+    const TerrainTileKey key = TerrainTileCache::GetTileKey(gridX, gridY);
+    AZStd::shared_ptr<const TerrainSurfaceTile> tile = m_tileCache.FindSurfaceTile(key);
+    if (!tile)
+    {
+        if (!m_tileCache.BeginCreateTile(key, TerrainTileCache::Layer::SurfaceWeights))
+        {
+            return false;
+        }
+
+        const uint64_t generation = m_tileCache.GetGeneration();
+        tile = CreateSurfaceTile(key);
+        m_tileCache.AddSurfaceTile(key, tile, generation);
+        m_tileCache.EndCreateTile(key, TerrainTileCache::Layer::SurfaceWeights);
+    }
+
+    size_t localX = 0;
+    size_t localY = 0;
+    TerrainTileCache::GetLocalIndices(key, gridX, gridY, localX, localY);
+    return tile->GetSurfaceWeights(localX, localY, outSurfaceWeights);
+}
+
+AZStd::shared_ptr<const TerrainHeightTile> TerrainSystem::CreateHeightTile(const TerrainTileKey& key) const
+{
+    const float queryResolution = m_currentSettings.m_heightQueryResolution;
+    auto tile = AZStd::make_shared<TerrainHeightTile>();
+
+    // Collect the X0 and X1 coordinates of every grid square in the tile, using the same vector math as the uncached bilinear
+    // queries. Consecutive coordinates that are bit-identical get shared, which is usually the case for all but a few of them.
+    auto buildCoordinates = [queryResolution](int32_t tileStart, AZStd::vector<float>& coordinates,
+        AZStd::vector<AZ::u16>& indices0, AZStd::vector<AZ::u16>& indices1)
+    {
+        auto addCoordinate = [&coordinates](float coordinate) -> AZ::u16
+        {
+            if (coordinates.empty() || !IsBitIdentical(coordinates.back(), coordinate))
+            {
+                coordinates.push_back(coordinate);
+            }
+            return aznumeric_cast<AZ::u16>(coordinates.size() - 1);
+        };
+
+        indices0.resize(TerrainTileCache::TileSize);
+        indices1.resize(TerrainTileCache::TileSize);
+        for (int32_t index = 0; index < TerrainTileCache::TileSize; index++)
+        {
+            const AZ::Vector2 pos0 = AZ::Vector2(aznumeric_cast<float>(tileStart + index)) * queryResolution;
+            const AZ::Vector2 pos1 = pos0 + AZ::Vector2(queryResolution);
+            indices0[index] = addCoordinate(pos0.GetX());
+            indices1[index] = addCoordinate(pos1.GetX());
+        }
+    };
+
+    AZStd::vector<float> xCoordinates;
+    AZStd::vector<float> yCoordinates;
+    buildCoordinates(key.m_x * TerrainTileCache::TileSize, xCoordinates, tile->m_x0Indices, tile->m_x1Indices);
+    buildCoordinates(key.m_y * TerrainTileCache::TileSize, yCoordinates, tile->m_y0Indices, tile->m_y1Indices);
+
+    tile->m_gridWidth = xCoordinates.size();
+    tile->m_heights.resize(xCoordinates.size() * yCoordinates.size());
+    tile->m_exists.resize(xCoordinates.size() * yCoordinates.size());
+
+    // Query all the heights of the tile at once, so that each area provider gets called once for the whole tile.
+    QueryBuffers buffers;
+    buffers.m_positions.reserve(tile->m_heights.size());
+    for (float y : yCoordinates)
+    {
+        for (float x : xCoordinates)
+        {
+            buffers.m_positions.emplace_back(x, y, 0.0f);
+        }
+    }
+
+    const TerrainAreaList areas = GetAreasForPositions(buffers.m_positions);
+    GetTerrainAreaHeights(areas, buffers.m_positions, tile->m_exists, buffers);
+    for (size_t index = 0; index < buffers.m_positions.size(); index++)
+    {
+        tile->m_heights[index] = buffers.m_positions[index].GetZ();
+    }
+
+    return tile;
+}
+
+AZStd::shared_ptr<const TerrainSurfaceTile> TerrainSystem::CreateSurfaceTile(const TerrainTileKey& key) const
+{
+    const float queryResolution = m_currentSettings.m_heightQueryResolution;
+    auto tile = AZStd::make_shared<TerrainSurfaceTile>();
+    tile->m_weights.resize(TerrainTileCache::TileSize * TerrainTileCache::TileSize * TerrainSurfaceTile::MaxSurfaceWeights);
+    tile->m_counts.resize(TerrainTileCache::TileSize * TerrainTileCache::TileSize);
+
+    // Query all the surface weights of the tile at once, so that each area provider gets called once for the whole tile.
+    QueryBuffers buffers;
+    buffers.m_positions.reserve(TerrainTileCache::TileSize * TerrainTileCache::TileSize);
+    for (int32_t localY = 0; localY < TerrainTileCache::TileSize; localY++)
+    {
+        for (int32_t localX = 0; localX < TerrainTileCache::TileSize; localX++)
+        {
+            const AZ::Vector2 gridPosition = AZ::Vector2(
+                aznumeric_cast<float>((key.m_x * TerrainTileCache::TileSize) + localX),
+                aznumeric_cast<float>((key.m_y * TerrainTileCache::TileSize) + localY)) * queryResolution;
+            buffers.m_positions.emplace_back(gridPosition.GetX(), gridPosition.GetY(), 0.0f);
+        }
+    }
+
+    buffers.m_surfaceWeights.resize(buffers.m_positions.size());
+    const TerrainAreaList areas = GetAreasForPositions(buffers.m_positions);
+    GetOrderedSurfaceWeightsBatched(areas, buffers.m_positions, buffers.m_surfaceWeights, {}, buffers);
+
+    size_t index = 0;
+    for (int32_t localY = 0; localY < TerrainTileCache::TileSize; localY++)
+    {
+        for (int32_t localX = 0; localX < TerrainTileCache::TileSize; localX++)
+        {
+            tile->SetSurfaceWeights(localX, localY, buffers.m_surfaceWeights[index++]);
+        }
+    }
+
+    return tile;
+}
+
+void TerrainSystem::SetTileCacheMemoryBudget(size_t memoryBudget)
+{
+    m_tileCache.SetMemoryBudget(memoryBudget);
+}
+
+TerrainTileCache::Statistics TerrainSystem::GetTileCacheStatistics() const
+{
+    return m_tileCache.GetStatistics();
+}
+
 void TerrainSystem::GetSurfaceWeights(
     const AZ::Vector3& inPosition,
     AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights,
@@ -541,166 +831,508 @@ const char* TerrainSystem::GetMaxSurfaceName(
     return "";
 }
 
-void TerrainSystem::ProcessHeightsFromList(
-    const AZStd::span<AZ::Vector3>& inPositions,
-    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
-    Sampler sampleFilter) const
+TerrainSystem::TerrainAreaList TerrainSystem::GetAreasForPositions(AZStd::span<const AZ::Vector3> positions) const
 {
-    if (!perPositionCallback)
+    TerrainAreaList areas;
+    if (positions.empty())
     {
-        return;
+        return areas;
     }
 
-    AzFramework::SurfaceData::SurfacePoint surfacePoint;
-    for (const auto& position : inPositions)
+    // Expand the bounds of the positions by the distance that the bilinear filtering and the normal calculations sample
+    // away from each position, so that all the areas that can contribute to the results get included.
+    AZ::Aabb positionBounds = AZ::Aabb::CreateNull();
+    for (const auto& position : positions)
     {
-        bool terrainExists = false;
-        surfacePoint.m_position = position;
-        surfacePoint.m_position.SetZ(GetHeight(position, sampleFilter, &terrainExists));
-        perPositionCallback(surfacePoint, terrainExists);
+        positionBounds.AddPoint(position);
     }
-}
+    positionBounds.Expand(AZ::Vector3(m_currentSettings.m_heightQueryResolution * 2.0f));
 
-void TerrainSystem::ProcessNormalsFromList(
-    const AZStd::span<AZ::Vector3>& inPositions,
-    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
-    Sampler sampleFilter) const
-{
-    if (!perPositionCallback)
+    AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
+
+    // Keep the priority order of the registered areas, and only compare the XY bounds, since the area lookups ignore the height.
+    for (const auto& [areaId, areaData] : m_registeredAreas)
     {
-        return;
+        const AZ::Aabb& areaBounds = areaData.m_areaBounds;
+        if (areaBounds.IsValid() &&
+            (areaBounds.GetMin().GetX() <= positionBounds.GetMax().GetX()) &&
+            (areaBounds.GetMax().GetX() >= positionBounds.GetMin().GetX()) &&
+            (areaBounds.GetMin().GetY() <= positionBounds.GetMax().GetY()) &&
+            (areaBounds.GetMax().GetY() >= positionBounds.GetMin().GetY()))
+        {
+            areas.emplace_back(areaId, areaData);
+        }
     }
 
-    AzFramework::SurfaceData::SurfacePoint surfacePoint;
-    for (const auto& position : inPositions)
+    return areas;
+}
+
+void TerrainSystem::GetAreaIndices(
+    const TerrainAreaList& areas, AZStd::span<const AZ::Vector3> positions, AZStd::vector<size_t>& outAreaIndices) const
+{
+    // For each position, find the highest priority area that contains it. Positions outside of all the areas get an index
+    // of areas.size().
+    outAreaIndices.resize(positions.size());
+    for (size_t index = 0; index < positions.size(); index++)
     {
-        bool terrainExists = false;
-        surfacePoint.m_position = position;
-        surfacePoint.m_normal = GetNormal(position, sampleFilter, &terrainExists);
-        perPositionCallback(surfacePoint, terrainExists);
+        AZ::Vector3 inPosition = positions[index];
+        size_t areaIndex = 0;
+        for (; areaIndex < areas.size(); areaIndex++)
+        {
+            const AZ::Aabb& areaBounds = areas[areaIndex].second.m_areaBounds;
+            inPosition.SetZ(areaBounds.GetMin().GetZ());
+            if (areaBounds.Contains(inPosition))
+            {
+                break;
+            }
+        }
+        outAreaIndices[index] = areaIndex;
     }
 }
 
-void TerrainSystem::ProcessSurfaceWeightsFromList(
-    const AZStd::span<AZ::Vector3>& inPositions,
-    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
-    Sampler sampleFilter) const
+void TerrainSystem::GetTerrainAreaHeights(
+    const TerrainAreaList& areas, AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> terrainExists,
+    QueryBuffers& buffers) const
 {
-    if (!perPositionCallback)
+    AZ_Assert(inOutPositions.size() == terrainExists.size(), "The position list size doesn't match the terrainExists list size.");
+
+    const float worldMin = m_currentSettings.m_worldBounds.GetMin().GetZ();
+
+    // Positions that aren't in any area don't have any terrain.
+    for (size_t index = 0; index < inOutPositions.size(); index++)
     {
-        return;
+        inOutPositions[index].SetZ(worldMin);
+        terrainExists[index] = false;
     }
 
-    AzFramework::SurfaceData::SurfacePoint surfacePoint;
-    for (const auto& position : inPositions)
+    GetAreaIndices(areas, inOutPositions, buffers.m_areaIndices);
+
+    // Gather the positions of each area, so that each area provider gets called once for all of its positions.
+    for (size_t areaIndex = 0; areaIndex < areas.size(); areaIndex++)
     {
-        bool terrainExists = false;
-        surfacePoint.m_position = position;
-        GetSurfaceWeights(position, surfacePoint.m_surfaceTags, sampleFilter, &terrainExists);
-        perPositionCallback(surfacePoint, terrainExists);
+        const auto& [areaId, areaData] = areas[areaIndex];
+        const float areaMin = areaData.m_areaBounds.GetMin().GetZ();
+
+        buffers.m_areaPositions.clear();
+        buffers.m_areaPositionIndices.clear();
+        for (size_t index = 0; index < inOutPositions.size(); index++)
+        {
+            if (buffers.m_areaIndices[index] == areaIndex)
+            {
+                buffers.m_areaPositions.emplace_back(inOutPositions[index].GetX(), inOutPositions[index].GetY(), areaMin);
+                buffers.m_areaPositionIndices.emplace_back(index);
+            }
+        }
+
+        if (buffers.m_areaPositions.empty())
+        {
+            continue;
+        }
+
+        buffers.m_areaExists.assign(buffers.m_areaPositions.size(), false);
+        Terrain::TerrainAreaHeightRequestBus::Event(
+            areaId, &Terrain::TerrainAreaHeightRequestBus::Events::GetHeights, buffers.m_areaPositions, buffers.m_areaExists);
+
+        for (size_t areaPositionIndex = 0; areaPositionIndex < buffers.m_areaPositions.size(); areaPositionIndex++)
+        {
+            const size_t index = buffers.m_areaPositionIndices[areaPositionIndex];
+            if (buffers.m_areaExists[areaPositionIndex])
+            {
+                inOutPositions[index].SetZ(buffers.m_areaPositions[areaPositionIndex].GetZ());
+                terrainExists[index] = true;
+            }
+            else
+            {
+                // If the terrain height provider doesn't have any data, then use the area's "use ground plane" setting,
+                // the same way as GetTerrainAreaHeight().
+                inOutPositions[index].SetZ(areaData.m_useGroundPlane ? areaMin : worldMin);
+                terrainExists[index] = areaData.m_useGroundPlane;
+            }
+        }
     }
 }
 
-void TerrainSystem::ProcessSurfacePointsFromList(
-    const AZStd::span<AZ::Vector3>& inPositions,
-    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
-    Sampler sampleFilter) const
+void TerrainSystem::GetHeightsBatched(
+    const TerrainAreaList& areas, AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outHeights,
+    AZStd::span<bool> terrainExists, Sampler sampler, QueryBuffers& buffers) const
 {
-    if (!perPositionCallback)
+    AZ_Assert(positions.size() == outHeights.size(), "The position list size doesn't match the height list size.");
+    AZ_Assert(positions.size() == terrainExists.size(), "The position list size doesn't match the terrainExists list size.");
+
+    const float worldMin = m_currentSettings.m_worldBounds.GetMin().GetZ();
+    const float worldMax = m_currentSettings.m_worldBounds.GetMax().GetZ();
+    const size_t numPositions = positions.size();
+
+    switch (sampler)
     {
-        return;
+    // Get the heights of the four corners of the grid square around each position, and bilinear filter between them.
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR:
+        {
+            buffers.m_samplePositions.resize(numPositions * 4);
+            buffers.m_sampleDeltas.resize(numPositions);
+            buffers.m_sampleExists.resize(numPositions * 4);
+
+            for (size_t index = 0; index < numPositions; index++)
+            {
+                AZ::Vector2 pos0;
+                ClampPosition(positions[index].GetX(), positions[index].GetY(), pos0, buffers.m_sampleDeltas[index]);
+                const AZ::Vector2 pos1 = pos0 + AZ::Vector2(m_currentSettings.m_heightQueryResolution);
+
+                buffers.m_samplePositions[(index * 4) + 0].Set(pos0.GetX(), pos0.GetY(), 0.0f);
+                buffers.m_samplePositions[(index * 4) + 1].Set(pos1.GetX(), pos0.GetY(), 0.0f);
+                buffers.m_samplePositions[(index * 4) + 2].Set(pos0.GetX(), pos1.GetY(), 0.0f);
+                buffers.m_samplePositions[(index * 4) + 3].Set(pos1.GetX(), pos1.GetY(), 0.0f);
+            }
+
+            GetTerrainAreaHeights(areas, buffers.m_samplePositions, buffers.m_sampleExists, buffers);
+
+            for (size_t index = 0; index < numPositions; index++)
+            {
+                const AZ::Vector2& normalizedDelta = buffers.m_sampleDeltas[index];
+                const float heightX0Y0 = buffers.m_samplePositions[(index * 4) + 0].GetZ();
+                const float heightX1Y0 = buffers.m_samplePositions[(index * 4) + 1].GetZ();
+                const float heightX0Y1 = buffers.m_samplePositions[(index * 4) + 2].GetZ();
+                const float heightX1Y1 = buffers.m_samplePositions[(index * 4) + 3].GetZ();
+                const float heightXY0 = AZ::Lerp(heightX0Y0, heightX1Y0, normalizedDelta.GetX());
+                const float heightXY1 = AZ::Lerp(heightX0Y1, heightX1Y1, normalizedDelta.GetX());
+                outHeights[index] = AZ::Lerp(heightXY0, heightXY1, normalizedDelta.GetY());
+
+                // Match GetHeightSynchronous(), where the last corner that gets queried determines whether or not the terrain exists.
+                terrainExists[index] = buffers.m_sampleExists[(index * 4) + 3];
+            }
+        }
+        break;
+
+    // Clamp the input points to the terrain sample grid, then get the heights at the given grid locations.
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP:
+        {
+            buffers.m_samplePositions.resize(numPositions);
+            for (size_t index = 0; index < numPositions; index++)
+            {
+                AZ::Vector2 normalizedDelta;
+                AZ::Vector2 clampedPosition;
+                ClampPosition(positions[index].GetX(), positions[index].GetY(), clampedPosition, normalizedDelta);
+                buffers.m_samplePositions[index].Set(clampedPosition.GetX(), clampedPosition.GetY(), 0.0f);
+            }
+
+            GetTerrainAreaHeights(areas, buffers.m_samplePositions, terrainExists, buffers);
+
+            for (size_t index = 0; index < numPositions; index++)
+            {
+                outHeights[index] = buffers.m_samplePositions[index].GetZ();
+            }
+        }
+        break;
+
+    // Directly get the values at the locations, regardless of terrain sample grid density.
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT:
+        [[fallthrough]];
+    default:
+        {
+            buffers.m_samplePositions.assign(positions.begin(), positions.end());
+
+            GetTerrainAreaHeights(areas, buffers.m_samplePositions, terrainExists, buffers);
+
+            for (size_t index = 0; index < numPositions; index++)
+            {
+                outHeights[index] = buffers.m_samplePositions[index].GetZ();
+            }
+        }
+        break;
     }
 
-    AzFramework::SurfaceData::SurfacePoint surfacePoint;
-    for (const auto& position : inPositions)
+    for (size_t index = 0; index < numPositions; index++)
     {
-        bool terrainExists = false;
-        surfacePoint.m_position = position;
-        GetSurfacePoint(position, surfacePoint, sampleFilter, &terrainExists);
-        perPositionCallback(surfacePoint, terrainExists);
+        if (InWorldBounds(positions[index].GetX(), positions[index].GetY()))
+        {
+            outHeights[index] = AZ::GetClamp(outHeights[index], worldMin, worldMax);
+        }
+        else
+        {
+            outHeights[index] = worldMin;
+            terrainExists[index] = false;
+        }
     }
 }
 
-void TerrainSystem::ProcessHeightsFromListOfVector2(
-    const AZStd::span<AZ::Vector2>& inPositions,
-    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
-    Sampler sampleFilter) const
+void TerrainSystem::GetNormalsBatched(
+    const TerrainAreaList& areas, AZStd::span<const AZ::Vector3> positions, AZStd::span<AZ::Vector3> outNormals,
+    AZStd::span<bool> terrainExists, Sampler sampler, QueryBuffers& buffers) const
 {
-    if (!perPositionCallback)
+    AZ_Assert(positions.size() == outNormals.size(), "The position list size doesn't match the normal list size.");
+    AZ_Assert(
+        terrainExists.empty() || (positions.size() == terrainExists.size()),
+        "The position list size doesn't match the terrainExists list size.");
+
+    const size_t numPositions = positions.size();
+    const float range = m_currentSettings.m_heightQueryResolution / 2.0f;
+
+    // Query the heights of the up, left, right and down neighbors of every position in a single batch.
+    buffers.m_normalPositions.resize(numPositions * 4);
+    buffers.m_normalHeights.resize(numPositions * 4);
+    buffers.m_normalExists.resize(numPositions * 4);
+    for (size_t index = 0; index < numPositions; index++)
     {
-        return;
+        const float x = positions[index].GetX();
+        const float y = positions[index].GetY();
+        buffers.m_normalPositions[(index * 4) + 0].Set(x, y - range, 0.0f);
+        buffers.m_normalPositions[(index * 4) + 1].Set(x - range, y, 0.0f);
+        buffers.m_normalPositions[(index * 4) + 2].Set(x + range, y, 0.0f);
+        buffers.m_normalPositions[(index * 4) + 3].Set(x, y + range, 0.0f);
     }
 
-    AzFramework::SurfaceData::SurfacePoint surfacePoint;
-    for (const auto& position : inPositions)
+    GetHeightsBatched(areas, buffers.m_normalPositions, buffers.m_normalHeights, buffers.m_normalExists, sampler, buffers);
+
+    for (size_t index = 0; index < numPositions; index++)
     {
-        bool terrainExists = false;
-        surfacePoint.m_position.Set(position.GetX(), position.GetY(), 0.0f);
-        surfacePoint.m_position.SetZ(GetHeightFromVector2(position, sampleFilter, &terrainExists));
-        perPositionCallback(surfacePoint, terrainExists);
+        bool exists = false;
+        if (InWorldBounds(positions[index].GetX(), positions[index].GetY()))
+        {
+            AZ::Vector3 v1 = buffers.m_normalPositions[(index * 4) + 0];
+            AZ::Vector3 v2 = buffers.m_normalPositions[(index * 4) + 1];
+            AZ::Vector3 v3 = buffers.m_normalPositions[(index * 4) + 2];
+            AZ::Vector3 v4 = buffers.m_normalPositions[(index * 4) + 3];
+            v1.SetZ(buffers.m_normalHeights[(index * 4) + 0]);
+            v2.SetZ(buffers.m_normalHeights[(index * 4) + 1]);
+            v3.SetZ(buffers.m_normalHeights[(index * 4) + 2]);
+            v4.SetZ(buffers.m_normalHeights[(index * 4) + 3]);
+
+            outNormals[index] = (v3 - v2).Cross(v4 - v1).GetNormalized();
+            exists = buffers.m_normalExists[(index * 4) + 3];
+        }
+        else
+        {
+            outNormals[index] = AZ::Vector3::CreateAxisZ();
+        }
+
+        if (!terrainExists.empty())
+        {
+            terrainExists[index] = exists;
+        }
     }
 }
 
-void TerrainSystem::ProcessNormalsFromListOfVector2(
-    const AZStd::span<AZ::Vector2>& inPositions,
-    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
-    Sampler sampleFilter) const
+void TerrainSystem::GetOrderedSurfaceWeightsBatched(
+    const TerrainAreaList& areas, AZStd::span<const AZ::Vector3> positions,
+    AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights, AZStd::span<bool> terrainExists,
+    QueryBuffers& buffers) const
 {
-    if (!perPositionCallback)
+    AZ_Assert(positions.size() == outSurfaceWeights.size(), "The position list size doesn't match the surface weight list size.");
+    AZ_Assert(
+        terrainExists.empty() || (positions.size() == terrainExists.size()),
+        "The position list size doesn't match the terrainExists list size.");
+
+    if (!terrainExists.empty())
     {
-        return;
+        buffers.m_surfaceHeights.resize(positions.size());
+        GetHeightsBatched(
+            areas, positions, buffers.m_surfaceHeights, terrainExists, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT,
+            buffers);
     }
 
-    AzFramework::SurfaceData::SurfacePoint surfacePoint;
-    for (const auto& position : inPositions)
+    for (auto& surfaceWeights : outSurfaceWeights)
     {
-        bool terrainExists = false;
-        surfacePoint.m_position.Set(position.GetX(), position.GetY(), 0.0f);
-        surfacePoint.m_normal = GetNormalFromVector2(position, sampleFilter, &terrainExists);
-        perPositionCallback(surfacePoint, terrainExists);
+        surfaceWeights.clear();
     }
-}
 
-void TerrainSystem::ProcessSurfaceWeightsFromListOfVector2(
-    const AZStd::span<AZ::Vector2>& inPositions,
-    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
-    Sampler sampleFilter) const
+    GetAreaIndices(areas, positions, buffers.m_areaIndices);
+
+    for (size_t areaIndex = 0; areaIndex < areas.size(); areaIndex++)
+    {
+        buffers.m_areaPositions.clear();
+        buffers.m_areaPositionIndices.clear();
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            if (buffers.m_areaIndices[index] == areaIndex)
+            {
+                buffers.m_areaPositions.emplace_back(positions[index].GetX(), positions[index].GetY(), 0.0f);
+                buffers.m_areaPositionIndices.emplace_back(index);
+            }
+        }
+
+        if (buffers.m_areaPositions.empty())
+        {
+            continue;
+        }
+
+        buffers.m_areaSurfaceWeights.resize(buffers.m_areaPositions.size());
+        for (auto& surfaceWeights : buffers.m_areaSurfaceWeights)
+        {
+            surfaceWeights.clear();
+        }
+
+        // Get all the surfaces with weights at the positions of this area.
+        Terrain::TerrainAreaSurfaceRequestBus::Event(
+            areas[areaIndex].first, &Terrain::TerrainAreaSurfaceRequestBus::Events::GetSurfaceWeightsFromList,
+            buffers.m_areaPositions, buffers.m_areaSurfaceWeights);
+
+        for (size_t areaPositionIndex = 0; areaPositionIndex < buffers.m_areaPositions.size(); areaPositionIndex++)
+        {
+            auto& surfaceWeights = outSurfaceWeights[buffers.m_areaPositionIndices[areaPositionIndex]];
+            AZStd::swap(surfaceWeights, buffers.m_areaSurfaceWeights[areaPositionIndex]);
+            AZStd::sort(surfaceWeights.begin(), surfaceWeights.end(), AzFramework::SurfaceData::SurfaceTagWeightComparator());
+        }
+    }
+}
+
+void TerrainSystem::ProcessQueryBatch(QueryType queryType, Sampler sampler, QueryBuffers& buffers) const
 {
-    if (!perPositionCallback)
+    const size_t numPositions = buffers.m_positions.size();
+    const TerrainAreaList areas = GetAreasForPositions(buffers.m_positions);
+
+    buffers.m_terrainExists.assign(numPositions, false);
+
+    if ((queryType == QueryType::Heights) || (queryType == QueryType::SurfacePoints))
     {
-        return;
+        buffers.m_heights.resize(numPositions);
+        GetHeightsBatched(areas, buffers.m_positions, buffers.m_heights, buffers.m_terrainExists, sampler, buffers);
     }
 
-    AzFramework::SurfaceData::SurfacePoint surfacePoint;
-    for (const auto& position : inPositions)
+    // The surface points only report whether or not the terrain exists from the height query.
+    if ((queryType == QueryType::Normals) || (queryType == QueryType::SurfacePoints))
     {
-        bool terrainExists = false;
-        surfacePoint.m_position.Set(position.GetX(), position.GetY(), 0.0f);
-        GetSurfaceWeightsFromVector2(position, surfacePoint.m_surfaceTags, sampleFilter, &terrainExists);
-        perPositionCallback(surfacePoint, terrainExists);
+        buffers.m_normals.resize(numPositions);
+        GetNormalsBatched(
+            areas, buffers.m_positions, buffers.m_normals,
+            (queryType == QueryType::Normals) ? AZStd::span<bool>(buffers.m_terrainExists) : AZStd::span<bool>(), sampler, buffers);
+    }
+
+    if ((queryType == QueryType::SurfaceWeights) || (queryType == QueryType::SurfacePoints))
+    {
+        buffers.m_surfaceWeights.resize(numPositions);
+        GetOrderedSurfaceWeightsBatched(
+            areas, buffers.m_positions, buffers.m_surfaceWeights,
+            (queryType == QueryType::SurfaceWeights) ? AZStd::span<bool>(buffers.m_terrainExists) : AZStd::span<bool>(), buffers);
     }
 }
 
-void TerrainSystem::ProcessSurfacePointsFromListOfVector2(
-    const AZStd::span<AZ::Vector2>& inPositions,
-    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
-    Sampler sampleFilter) const
+void TerrainSystem::GetQueryResult(
+    QueryType queryType, size_t index, QueryBuffers& buffers, AzFramework::SurfaceData::SurfacePoint& outSurfacePoint) const
 {
+    outSurfacePoint.m_position = buffers.m_positions[index];
+
+    if ((queryType == QueryType::Heights) || (queryType == QueryType::SurfacePoints))
+    {
+        outSurfacePoint.m_position.SetZ(buffers.m_heights[index]);
+    }
+
+    if ((queryType == QueryType::Normals) || (queryType == QueryType::SurfacePoints))
+    {
+        outSurfacePoint.m_normal = buffers.m_normals[index];
+    }
+
+    // The surface weights get swapped instead of copied. Each batch clears the surface weights before filling them again.
+    if ((queryType == QueryType::SurfaceWeights) || (queryType == QueryType::SurfacePoints))
+    {
+        AZStd::swap(outSurfacePoint.m_surfaceTags, buffers.m_surfaceWeights[index]);
+    }
+}
+
+void TerrainSystem::ProcessFromList(
+    QueryType queryType, AZStd::span<const AZ::Vector3> inPositions,
+    const AzFramework::Terrain::SurfacePointListFillCallback& perPositionCallback, Sampler sampler) const
+{
+    // Don't bother processing if we don't have a callback
     if (!perPositionCallback)
     {
         return;
     }
 
+    QueryBuffers buffers;
     AzFramework::SurfaceData::SurfacePoint surfacePoint;
-    for (const auto& position : inPositions)
+    for (size_t batchStart = 0; batchStart < inPositions.size(); batchStart += RegionQueryTileSize)
     {
-        bool terrainExists = false;
-        surfacePoint.m_position.Set(position.GetX(), position.GetY(), 0.0f);
-        GetSurfacePointFromVector2(position, surfacePoint, sampleFilter, &terrainExists);
-        perPositionCallback(surfacePoint, terrainExists);
+        const size_t batchEnd = AZStd::min(batchStart + RegionQueryTileSize, inPositions.size());
+        buffers.m_positions.assign(inPositions.begin() + batchStart, inPositions.begin() + batchEnd);
+
+        ProcessQueryBatch(queryType, sampler, buffers);
+
+        for (size_t index = 0; index < buffers.m_positions.size(); index++)
+        {
+            GetQueryResult(queryType, index, buffers, surfacePoint);
+            perPositionCallback(surfacePoint, buffers.m_terrainExists[index]);
+        }
     }
 }
 
+void TerrainSystem::ProcessHeightsFromList(
+    const AZStd::span<AZ::Vector3>& inPositions,
+    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
+    Sampler sampleFilter) const
+{
+    ProcessFromList(QueryType::Heights, inPositions, perPositionCallback, sampleFilter);
+}
+
+void TerrainSystem::ProcessNormalsFromList(
+    const AZStd::span<AZ::Vector3>& inPositions,
+    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
+    Sampler sampleFilter) const
+{
+    ProcessFromList(QueryType::Normals, inPositions, perPositionCallback, sampleFilter);
+}
+
+void TerrainSystem::ProcessSurfaceWeightsFromList(
+    const AZStd::span<AZ::Vector3>& inPositions,
+    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
+    Sampler sampleFilter) const
+{
+    ProcessFromList(QueryType::SurfaceWeights, inPositions, perPositionCallback, sampleFilter);
+}
+
+void TerrainSystem::ProcessSurfacePointsFromList(
+    const AZStd::span<AZ::Vector3>& inPositions,
+    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
+    Sampler sampleFilter) const
+{
+    ProcessFromList(QueryType::SurfacePoints, inPositions, perPositionCallback, sampleFilter);
+}
+
+namespace
+{
+    AZStd::vector<AZ::Vector3> GetPositionsFromListOfVector2(const AZStd::span<AZ::Vector2>& inPositions)
+    {
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(inPositions.size());
+        for (const auto& position : inPositions)
+        {
+            positions.emplace_back(position.GetX(), position.GetY(), 0.0f);
+        }
+        return positions;
+    }
+}
+
+void TerrainSystem::ProcessHeightsFromListOfVector2(
+    const AZStd::span<AZ::Vector2>& inPositions,
+    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
+    Sampler sampleFilter) const
+{
+    ProcessFromList(QueryType::Heights, GetPositionsFromListOfVector2(inPositions), perPositionCallback, sampleFilter);
+}
+
+void TerrainSystem::ProcessNormalsFromListOfVector2(
+    const AZStd::span<AZ::Vector2>& inPositions,
+    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
+    Sampler sampleFilter) const
+{
+    ProcessFromList(QueryType::Normals, GetPositionsFromListOfVector2(inPositions), perPositionCallback, sampleFilter);
+}
+
+void TerrainSystem::ProcessSurfaceWeightsFromListOfVector2(
+    const AZStd::span<AZ::Vector2>& inPositions,
+    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
+    Sampler sampleFilter) const
+{
+    ProcessFromList(QueryType::SurfaceWeights, GetPositionsFromListOfVector2(inPositions), perPositionCallback, sampleFilter);
+}
+
+void TerrainSystem::ProcessSurfacePointsFromListOfVector2(
+    const AZStd::span<AZ::Vector2>& inPositions,
+    AzFramework::Terrain::SurfacePointListFillCallback perPositionCallback,
+    Sampler sampleFilter) const
+{
+    ProcessFromList(QueryType::SurfacePoints, GetPositionsFromListOfVector2(inPositions), perPositionCallback, sampleFilter);
+}
+
 AZStd::pair<size_t, size_t> TerrainSystem::GetNumSamplesFromRegion(
     const AZ::Aabb& inRegion,
     const AZ::Vector2& stepSize) const
@@ -711,41 +1343,39 @@ AZStd::pair<size_t, size_t> TerrainSystem::GetNumSamplesFromRegion(
     return AZStd::make_pair(numSamplesX, numSamplesY);
 }
 
-void TerrainSystem::ProcessHeightsFromRegion(
-    const AZ::Aabb& inRegion,
-    const AZ::Vector2& stepSize,
-    AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
-    Sampler sampleFilter) const
+void TerrainSystem::ProcessRegionTile(
+    QueryType queryType, const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, size_t numSamplesX, size_t yStart, size_t yEnd,
+    const AzFramework::Terrain::SurfacePointRegionFillCallback& perPositionCallback, Sampler sampler, QueryBuffers& buffers) const
 {
-    // Don't bother processing if we don't have a callback
-    if (!perPositionCallback)
+    buffers.m_positions.clear();
+    for (size_t y = yStart; y < yEnd; y++)
     {
-        return;
+        float fy = aznumeric_cast<float>(inRegion.GetMin().GetY() + (y * stepSize.GetY()));
+        for (size_t x = 0; x < numSamplesX; x++)
+        {
+            float fx = aznumeric_cast<float>(inRegion.GetMin().GetX() + (x * stepSize.GetX()));
+            buffers.m_positions.emplace_back(fx, fy, 0.0f);
+        }
     }
 
-    const size_t numSamplesX = aznumeric_cast<size_t>(ceil(inRegion.GetExtents().GetX() / stepSize.GetX()));
-    const size_t numSamplesY = aznumeric_cast<size_t>(ceil(inRegion.GetExtents().GetY() / stepSize.GetY()));
-    
+    ProcessQueryBatch(queryType, sampler, buffers);
+
     AzFramework::SurfaceData::SurfacePoint surfacePoint;
-    for (size_t y = 0; y < numSamplesY; y++)
+    size_t index = 0;
+    for (size_t y = yStart; y < yEnd; y++)
     {
-        float fy = aznumeric_cast<float>(inRegion.GetMin().GetY() + (y * stepSize.GetY()));
         for (size_t x = 0; x < numSamplesX; x++)
         {
-            bool terrainExists = false;
-            float fx = aznumeric_cast<float>(inRegion.GetMin().GetX() + (x * stepSize.GetX()));
-            surfacePoint.m_position.Set(fx, fy, 0.0f);
-            surfacePoint.m_position.SetZ(GetHeight(surfacePoint.m_position, sampleFilter, &terrainExists));
-            perPositionCallback(x, y, surfacePoint, terrainExists);
+            GetQueryResult(queryType, index, buffers, surfacePoint);
+            perPositionCallback(x, y, surfacePoint, buffers.m_terrainExists[index]);
+            index++;
         }
     }
 }
 
-void TerrainSystem::ProcessNormalsFromRegion(
-    const AZ::Aabb& inRegion,
-    const AZ::Vector2& stepSize,
-    AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
-    Sampler sampleFilter) const
+void TerrainSystem::ProcessFromRegion(
+    QueryType queryType, const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+    const AzFramework::Terrain::SurfacePointRegionFillCallback& perPositionCallback, Sampler sampler) const
 {
     // Don't bother processing if we don't have a callback
     if (!perPositionCallback)
@@ -753,82 +1383,268 @@ void TerrainSystem::ProcessNormalsFromRegion(
         return;
     }
 
-    const size_t numSamplesX = aznumeric_cast<size_t>(ceil(inRegion.GetExtents().GetX() / stepSize.GetX()));
-    const size_t numSamplesY = aznumeric_cast<size_t>(ceil(inRegion.GetExtents().GetY() / stepSize.GetY()));
+    const auto [numSamplesX, numSamplesY] = GetNumSamplesFromRegion(inRegion, stepSize);
+    if ((numSamplesX == 0) || (numSamplesY == 0))
+    {
+        return;
+    }
 
-    AzFramework::SurfaceData::SurfacePoint surfacePoint;
-    for (size_t y = 0; y < numSamplesY; y++)
+    // The synchronous queries process the tiles on the calling thread, so that the positions get reported in order.
+    const size_t rowsPerTile = AZStd::max<size_t>(1, RegionQueryTileSize / numSamplesX);
+    QueryBuffers buffers;
+    for (size_t yStart = 0; yStart < numSamplesY; yStart += rowsPerTile)
     {
-        float fy = aznumeric_cast<float>(inRegion.GetMin().GetY() + (y * stepSize.GetY()));
-        for (size_t x = 0; x < numSamplesX; x++)
-        {
-            bool terrainExists = false;
-            float fx = aznumeric_cast<float>(inRegion.GetMin().GetX() + (x * stepSize.GetX()));
-            surfacePoint.m_position.Set(fx, fy, 0.0f);
-            surfacePoint.m_normal = GetNormal(surfacePoint.m_position, sampleFilter, &terrainExists);
-            perPositionCallback(x, y, surfacePoint, terrainExists);
-        }
+        const size_t yEnd = AZStd::min(yStart + rowsPerTile, numSamplesY);
+        ProcessRegionTile(queryType, inRegion, stepSize, numSamplesX, yStart, yEnd, perPositionCallback, sampler, buffers);
     }
 }
 
+void TerrainSystem::ProcessHeightsFromRegion(
+    const AZ::Aabb& inRegion,
+    const AZ::Vector2& stepSize,
+    AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+    Sampler sampleFilter) const
+{
+    ProcessFromRegion(QueryType::Heights, inRegion, stepSize, perPositionCallback, sampleFilter);
+}
+
+void TerrainSystem::ProcessNormalsFromRegion(
+    const AZ::Aabb& inRegion,
+    const AZ::Vector2& stepSize,
+    AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+    Sampler sampleFilter) const
+{
+    ProcessFromRegion(QueryType::Normals, inRegion, stepSize, perPositionCallback, sampleFilter);
+}
+
 void TerrainSystem::ProcessSurfaceWeightsFromRegion(
     const AZ::Aabb& inRegion,
     const AZ::Vector2& stepSize,
     AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
     Sampler sampleFilter) const
 {
-    // Don't bother processing if we don't have a callback
-    if (!perPositionCallback)
+    ProcessFromRegion(QueryType::SurfaceWeights, inRegion, stepSize, perPositionCallback, sampleFilter);
+}
+
+void TerrainSystem::ProcessSurfacePointsFromRegion(
+    const AZ::Aabb& inRegion,
+    const AZ::Vector2& stepSize,
+    AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+    Sampler sampleFilter) const
+{
+    ProcessFromRegion(QueryType::SurfacePoints, inRegion, stepSize, perPositionCallback, sampleFilter);
+}
+
+AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::ProcessFromRegionAsync(
+    QueryType queryType, const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+    AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback, Sampler sampler,
+    const AzFramework::Terrain::QueryAsyncParams& params) const
+{
+    auto jobContext = AZStd::make_shared<AzFramework::Terrain::TerrainJobContext>();
+
+    const auto [numSamplesX, numSamplesY] = GetNumSamplesFromRegion(inRegion, stepSize);
+    const size_t rowsPerTile = (numSamplesX > 0) ? AZStd::max<size_t>(1, RegionQueryTileSize / numSamplesX) : 1;
+    const size_t numTiles = (perPositionCallback && (numSamplesX > 0)) ? ((numSamplesY + rowsPerTile - 1) / rowsPerTile) : 0;
+
+    AZ::TaskExecutor* taskExecutor = GetTaskExecutor();
+    const bool runOnTaskGraph = taskExecutor && (numTiles > 0);
+
+    // Keep track of the query until it completes, so that it can be cancelled and waited on when the terrain system deactivates.
+    // The cancellation flag is checked under the same lock, so that a query either gets tracked before CancelAsyncQueries()
+    // collects the queries to cancel, or sees that they got cancelled and doesn't start at all.
+    bool isCancelled = false;
     {
-        return;
+        AZStd::scoped_lock lock(m_asyncQueriesMutex);
+        isCancelled = m_asyncQueriesCancelled;
+        if (!isCancelled && runOnTaskGraph)
+        {
+            m_asyncQueries.push_back(jobContext);
+        }
     }
 
-    const size_t numSamplesX = aznumeric_cast<size_t>(ceil(inRegion.GetExtents().GetX() / stepSize.GetX()));
-    const size_t numSamplesY = aznumeric_cast<size_t>(ceil(inRegion.GetExtents().GetY() / stepSize.GetY()));
+    if (isCancelled)
+    {
+        jobContext->Cancel();
+        if (params.m_completionCallback)
+        {
+            params.m_completionCallback(jobContext);
+        }
+        jobContext->MarkComplete();
+        return jobContext;
+    }
 
-    AzFramework::SurfaceData::SurfacePoint surfacePoint;
-    for (size_t y = 0; y < numSamplesY; y++)
+    // Without a task executor, or without anything to process, complete the query right away on the calling thread.
+    if (!runOnTaskGraph)
     {
-        float fy = aznumeric_cast<float>(inRegion.GetMin().GetY() + (y * stepSize.GetY()));
-        for (size_t x = 0; x < numSamplesX; x++)
+        ProcessFromRegion(queryType, inRegion, stepSize, perPositionCallback, sampler);
+        if (params.m_completionCallback)
         {
-            bool terrainExists = false;
-            float fx = aznumeric_cast<float>(inRegion.GetMin().GetX() + (x * stepSize.GetX()));
-            surfacePoint.m_position.Set(fx, fy, 0.0f);
-            GetSurfaceWeights(surfacePoint.m_position, surfacePoint.m_surfaceTags, sampleFilter, &terrainExists);
-            perPositionCallback(x, y, surfacePoint, terrainExists);
+            params.m_completionCallback(jobContext);
         }
+        jobContext->MarkComplete();
+        return jobContext;
+    }
+
+    // The state that is shared by all the tasks of the query. The tasks only capture a pointer to it, because the size of
+    // the data captured by a task lambda is limited.
+    struct AsyncQueryState
+    {
+        QueryType m_queryType;
+        AZ::Aabb m_region;
+        AZ::Vector2 m_stepSize;
+        size_t m_numSamplesX;
+        size_t m_numSamplesY;
+        size_t m_rowsPerTile;
+        Sampler m_sampler;
+        AzFramework::Terrain::SurfacePointRegionFillCallback m_perPositionCallback;
+        AZStd::function<void(AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>)> m_completionCallback;
+        AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> m_jobContext;
+    };
+
+    auto state = AZStd::make_shared<AsyncQueryState>(AsyncQueryState{ queryType, inRegion, stepSize, numSamplesX, numSamplesY,
+        rowsPerTile, sampler, AZStd::move(perPositionCallback), params.m_completionCallback, jobContext });
+
+    const size_t numJobs = AZStd::min(
+        (params.m_desiredNumberOfJobs > 0) ? aznumeric_cast<size_t>(params.m_desiredNumberOfJobs)
+                                           : aznumeric_cast<size_t>(AZStd::max(1u, AZStd::thread::hardware_concurrency())),
+        numTiles);
+
+    AZ::TaskGraph taskGraph;
+    const AZ::TaskDescriptor taskDescriptor{ "TerrainSystem::ProcessFromRegionAsync", "Terrain" };
+
+    AZ::TaskToken completionToken = taskGraph.AddTask(
+        taskDescriptor,
+        [this, state]()
+        {
+            if (state->m_completionCallback)
+            {
+                state->m_completionCallback(state->m_jobContext);
+            }
+
+            {
+                AZStd::scoped_lock lock(m_asyncQueriesMutex);
+                AZStd::erase(m_asyncQueries, state->m_jobContext);
+            }
+
+            state->m_jobContext->MarkComplete();
+        });
+
+    // Split the tiles evenly between the jobs. Each job reuses one set of query buffers for all of its tiles.
+    for (size_t job = 0; job < numJobs; job++)
+    {
+        const size_t tileStart = (job * numTiles) / numJobs;
+        const size_t tileEnd = ((job + 1) * numTiles) / numJobs;
+
+        AZ::TaskToken tileToken = taskGraph.AddTask(
+            taskDescriptor,
+            [this, state, tileStart, tileEnd]()
+            {
+                QueryBuffers buffers;
+                for (size_t tile = tileStart; tile < tileEnd; tile++)
+                {
+                    if (state->m_jobContext->IsCancelled())
+                    {
+                        break;
+                    }
+
+                    const size_t yStart = tile * state->m_rowsPerTile;
+                    const size_t yEnd = AZStd::min(yStart + state->m_rowsPerTile, state->m_numSamplesY);
+                    ProcessRegionTile(
+                        state->m_queryType, state->m_region, state->m_stepSize, state->m_numSamplesX, yStart, yEnd,
+                        state->m_perPositionCallback, state->m_sampler, buffers);
+                }
+            });
+        tileToken.Precedes(completionToken);
     }
+
+    taskGraph.Detach();
+    taskGraph.SubmitOnExecutor(*taskExecutor);
+
+    return jobContext;
 }
 
-void TerrainSystem::ProcessSurfacePointsFromRegion(
+AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::ProcessHeightsFromRegionAsync(
     const AZ::Aabb& inRegion,
     const AZ::Vector2& stepSize,
     AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
-    Sampler sampleFilter) const
+    Sampler sampleFilter,
+    const AzFramework::Terrain::QueryAsyncParams& params) const
 {
-    // Don't bother processing if we don't have a callback
-    if (!perPositionCallback)
+    return ProcessFromRegionAsync(QueryType::Heights, inRegion, stepSize, AZStd::move(perPositionCallback), sampleFilter, params);
+}
+
+AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::ProcessNormalsFromRegionAsync(
+    const AZ::Aabb& inRegion,
+    const AZ::Vector2& stepSize,
+    AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+    Sampler sampleFilter,
+    const AzFramework::Terrain::QueryAsyncParams& params) const
+{
+    return ProcessFromRegionAsync(QueryType::Normals, inRegion, stepSize, AZStd::move(perPositionCallback), sampleFilter, params);
+}
+
+AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::ProcessSurfaceWeightsFromRegionAsync(
+    const AZ::Aabb& inRegion,
+    const AZ::Vector2& stepSize,
+    AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+    Sampler sampleFilter,
+    const AzFramework::Terrain::QueryAsyncParams& params) const
+{
+    return ProcessFromRegionAsync(
+        QueryType::SurfaceWeights, inRegion, stepSize, AZStd::move(perPositionCallback), sampleFilter, params);
+}
+
+AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::ProcessSurfacePointsFromRegionAsync(
+    const AZ::Aabb& inRegion,
+    const AZ::Vector2& stepSize,
+    AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+    Sampler sampleFilter,
+    const AzFramework::Terrain::QueryAsyncParams& params) const
+{
+    return ProcessFromRegionAsync(
+        QueryType::SurfacePoints, inRegion, stepSize, AZStd::move(perPositionCallback), sampleFilter, params);
+}
+
+void TerrainSystem::SetTaskExecutor(AZ::TaskExecutor* taskExecutor)
+{
+    m_taskExecutor = taskExecutor;
+}
+
+AZ::TaskExecutor* TerrainSystem::GetTaskExecutor() const
+{
+    if (m_taskExecutor)
     {
-        return;
+        return m_taskExecutor;
     }
 
-    const size_t numSamplesX = aznumeric_cast<size_t>(ceil(inRegion.GetExtents().GetX() / stepSize.GetX()));
-    const size_t numSamplesY = aznumeric_cast<size_t>(ceil(inRegion.GetExtents().GetY() / stepSize.GetY()));
+    // The global task executor only exists when the task graph system is available.
+    if (AZ::Interface<AZ::TaskGraphActiveInterface>::Get())
+    {
+        return &AZ::TaskExecutor::Instance();
+    }
 
-    AzFramework::SurfaceData::SurfacePoint surfacePoint;
-    for (size_t y = 0; y < numSamplesY; y++)
+    return nullptr;
+}
+
+void TerrainSystem::CancelAsyncQueries()
+{
+    // Refuse any new query and cancel the tracked ones under the same lock, so that no query can get submitted in between.
+    // The list is copied, since the queries remove themselves from it when they complete.
+    AZStd::vector<AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>> asyncQueries;
     {
-        float fy = aznumeric_cast<float>(inRegion.GetMin().GetY() + (y * stepSize.GetY()));
-        for (size_t x = 0; x < numSamplesX; x++)
+        AZStd::scoped_lock lock(m_asyncQueriesMutex);
+        m_asyncQueriesCancelled = true;
+        asyncQueries = m_asyncQueries;
+        for (auto& asyncQuery : asyncQueries)
         {
-            bool terrainExists = false;
-            float fx = aznumeric_cast<float>(inRegion.GetMin().GetX() + (x * stepSize.GetX()));
-            surfacePoint.m_position.Set(fx, fy, 0.0f);
-            GetSurfacePoint(surfacePoint.m_position, surfacePoint, sampleFilter, &terrainExists);
-            perPositionCallback(x, y, surfacePoint, terrainExists);
+            asyncQuery->Cancel();
         }
     }
+
+    for (auto& asyncQuery : asyncQueries)
+    {
+        asyncQuery->Wait();
+    }
 }
 
 void TerrainSystem::RegisterArea(AZ::EntityId areaId)
@@ -843,6 +1659,7 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
 
     m_registeredAreas[areaId] = { aabb, useGroundPlane };
     m_dirtyRegion.AddAabb(aabb);
+    m_tileCache.Invalidate(aabb, m_currentSettings.m_heightQueryResolution);
     m_terrainHeightDirty = true;
     m_terrainSurfacesDirty = true;
 }
@@ -862,6 +1679,7 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
             if (areaId == entityId)
             {
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
+                m_tileCache.Invalidate(areaData.m_areaBounds, m_currentSettings.m_heightQueryResolution);
                 m_terrainHeightDirty = true;
                 m_terrainSurfacesDirty = true;
                 return true;
@@ -888,6 +1706,16 @@ void TerrainSystem::RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::Terra
 
     m_dirtyRegion.AddAabb(expandedAabb);
 
+    // Only drop the cached data that has changed. A change without any data flags conservatively drops all of it.
+    const bool heightsChanged = (changeMask & Terrain::HeightData) == Terrain::HeightData;
+    const bool surfacesChanged = (changeMask & Terrain::SurfaceData) == Terrain::SurfaceData;
+    TerrainTileCache::Layer cacheLayers = TerrainTileCache::Layer::All;
+    if (heightsChanged != surfacesChanged)
+    {
+        cacheLayers = heightsChanged ? TerrainTileCache::Layer::Heights : TerrainTileCache::Layer::SurfaceWeights;
+    }
+    m_tileCache.Invalidate(expandedAabb, m_currentSettings.m_heightQueryResolution, cacheLayers);
+
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
 
     m_terrainHeightDirty = m_terrainHeightDirty || ((changeMask & Terrain::HeightData) == Terrain::HeightData);
@@ -925,6 +1753,9 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+
+        // The cached tiles depend on the world bounds and on the query resolution.
+        m_tileCache.Clear();
     }
 
     if (terrainSettingsChanged || m_terrainHeightDirty || m_terrainSurfacesDirty)
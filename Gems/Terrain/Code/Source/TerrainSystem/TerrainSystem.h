@@ -21,10 +21,12 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskGraph.h>
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
 #include <TerrainSystem/TerrainSystemBus.h>
+#include <TerrainSystem/TerrainTileCache.h>
 
 namespace Terrain
 {
@@ -188,11 +190,88 @@ namespace Terrain
             AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
             Sampler sampleFilter = Sampler::DEFAULT) const override;
 
+        //! Asynchronous versions of the region queries, which process the tiles of the region on the task graph.
+        AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> ProcessHeightsFromRegionAsync(const AZ::Aabb& inRegion,
+            const AZ::Vector2& stepSize,
+            AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+            Sampler sampleFilter = Sampler::DEFAULT,
+            const AzFramework::Terrain::QueryAsyncParams& params = {}) const override;
+        AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> ProcessNormalsFromRegionAsync(const AZ::Aabb& inRegion,
+            const AZ::Vector2& stepSize,
+            AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+            Sampler sampleFilter = Sampler::DEFAULT,
+            const AzFramework::Terrain::QueryAsyncParams& params = {}) const override;
+        AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> ProcessSurfaceWeightsFromRegionAsync(const AZ::Aabb& inRegion,
+            const AZ::Vector2& stepSize,
+            AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+            Sampler sampleFilter = Sampler::DEFAULT,
+            const AzFramework::Terrain::QueryAsyncParams& params = {}) const override;
+        AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> ProcessSurfacePointsFromRegionAsync(const AZ::Aabb& inRegion,
+            const AZ::Vector2& stepSize,
+            AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+            Sampler sampleFilter = Sampler::DEFAULT,
+            const AzFramework::Terrain::QueryAsyncParams& params = {}) const override;
+
         AzFramework::EntityContextId GetTerrainRaycastEntityContextId() const override;
         AzFramework::RenderGeometry::RayResult GetClosestIntersection(
             const AzFramework::RenderGeometry::RayRequest& ray) const override;
 
+        //! Override the task executor used by the asynchronous queries. By default, the global task executor is used when the
+        //! task graph system is available, and the asynchronous queries run on the calling thread otherwise.
+        void SetTaskExecutor(AZ::TaskExecutor* taskExecutor);
+
+        //! Set the memory budget of the tile cache for the height and surface weight queries. A budget of 0 disables the cache.
+        void SetTileCacheMemoryBudget(size_t memoryBudget);
+        TerrainTileCache::Statistics GetTileCacheStatistics() const;
+
+        //! The approximate number of positions in each tile of a region query. The tiles are made of whole rows,
+        //! so that the positions of each tile can be reported in order.
+        static constexpr size_t RegionQueryTileSize = 1024;
+
     private:
+        // The data that a batched query calculates for each position.
+        enum class QueryType : AZ::u8
+        {
+            Heights,
+            Normals,
+            SurfaceWeights,
+            SurfacePoints
+        };
+
+        // Cached data for each terrain area to use when looking up terrain data.
+        struct TerrainAreaData
+        {
+            AZ::Aabb m_areaBounds{ AZ::Aabb::CreateNull() };
+            bool m_useGroundPlane{ false };
+        };
+
+        // A copy of the registered areas in priority order, so that the batched queries can call the area providers
+        // without holding the area mutex.
+        using TerrainAreaList = AZStd::vector<AZStd::pair<AZ::EntityId, TerrainAreaData>>;
+
+        // The results and scratch buffers of the batched queries. They get reused for every batch processed on the same thread.
+        struct QueryBuffers
+        {
+            AZStd::vector<AZ::Vector3> m_positions;
+            AZStd::vector<float> m_heights;
+            AZStd::vector<AZ::Vector3> m_normals;
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> m_surfaceWeights;
+            AZStd::vector<bool> m_terrainExists;
+
+            AZStd::vector<AZ::Vector3> m_samplePositions;
+            AZStd::vector<AZ::Vector2> m_sampleDeltas;
+            AZStd::vector<bool> m_sampleExists;
+            AZStd::vector<AZ::Vector3> m_normalPositions;
+            AZStd::vector<float> m_normalHeights;
+            AZStd::vector<bool> m_normalExists;
+            AZStd::vector<float> m_surfaceHeights;
+            AZStd::vector<size_t> m_areaIndices;
+            AZStd::vector<size_t> m_areaPositionIndices;
+            AZStd::vector<AZ::Vector3> m_areaPositions;
+            AZStd::vector<bool> m_areaExists;
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> m_areaSurfaceWeights;
+        };
+
         void ClampPosition(float x, float y, AZ::Vector2& outPosition, AZ::Vector2& normalizedDelta) const;
         bool InWorldBounds(float x, float y) const;
 
@@ -206,6 +285,55 @@ namespace Terrain
         float GetHeightSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
         float GetTerrainAreaHeight(float x, float y, bool& terrainExists) const;
         AZ::Vector3 GetNormalSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
+        void GetOrderedSurfaceWeightsUncached(float x, float y, AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights) const;
+
+        // Tile cache lookups for the queries above. They return false if the data can't be served from the cache, either
+        // because the cache is disabled or because the position can't be mapped exactly onto the query grid.
+        bool GetGridIndices(const AZ::Vector2& gridPosition, int32_t& outGridX, int32_t& outGridY) const;
+        bool GetCachedGridSquare(const AZ::Vector2& gridPosition, TerrainHeightTile::GridSquare& outGridSquare) const;
+        bool GetCachedSurfaceWeights(float x, float y, AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights) const;
+        AZStd::shared_ptr<const TerrainHeightTile> CreateHeightTile(const TerrainTileKey& key) const;
+        AZStd::shared_ptr<const TerrainSurfaceTile> CreateSurfaceTile(const TerrainTileKey& key) const;
+
+        // Batched versions of the queries above, which call the batched area providers once per area for the whole list of positions.
+        TerrainAreaList GetAreasForPositions(AZStd::span<const AZ::Vector3> positions) const;
+        void GetAreaIndices(
+            const TerrainAreaList& areas, AZStd::span<const AZ::Vector3> positions, AZStd::vector<size_t>& outAreaIndices) const;
+        void GetTerrainAreaHeights(
+            const TerrainAreaList& areas, AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> terrainExists,
+            QueryBuffers& buffers) const;
+        void GetHeightsBatched(
+            const TerrainAreaList& areas, AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outHeights,
+            AZStd::span<bool> terrainExists, Sampler sampler, QueryBuffers& buffers) const;
+        void GetNormalsBatched(
+            const TerrainAreaList& areas, AZStd::span<const AZ::Vector3> positions, AZStd::span<AZ::Vector3> outNormals,
+            AZStd::span<bool> terrainExists, Sampler sampler, QueryBuffers& buffers) const;
+        void GetOrderedSurfaceWeightsBatched(
+            const TerrainAreaList& areas, AZStd::span<const AZ::Vector3> positions,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights, AZStd::span<bool> terrainExists,
+            QueryBuffers& buffers) const;
+
+        // Calculate the data of the given query type for buffers.m_positions.
+        void ProcessQueryBatch(QueryType queryType, Sampler sampler, QueryBuffers& buffers) const;
+        void GetQueryResult(QueryType queryType, size_t index, QueryBuffers& buffers, AzFramework::SurfaceData::SurfacePoint& outSurfacePoint) const;
+
+        // Process the rows [yStart, yEnd) of a region query and report the positions in order.
+        void ProcessRegionTile(
+            QueryType queryType, const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, size_t numSamplesX, size_t yStart, size_t yEnd,
+            const AzFramework::Terrain::SurfacePointRegionFillCallback& perPositionCallback, Sampler sampler, QueryBuffers& buffers) const;
+        void ProcessFromRegion(
+            QueryType queryType, const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+            const AzFramework::Terrain::SurfacePointRegionFillCallback& perPositionCallback, Sampler sampler) const;
+        AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> ProcessFromRegionAsync(
+            QueryType queryType, const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+            AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback, Sampler sampler,
+            const AzFramework::Terrain::QueryAsyncParams& params) const;
+        void ProcessFromList(
+            QueryType queryType, AZStd::span<const AZ::Vector3> inPositions,
+            const AzFramework::Terrain::SurfacePointListFillCallback& perPositionCallback, Sampler sampler) const;
+
+        AZ::TaskExecutor* GetTaskExecutor() const;
+        void CancelAsyncQueries();
 
         // AZ::TickBus::Handler overrides ...
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
@@ -225,16 +353,20 @@ namespace Terrain
         bool m_terrainSurfacesDirty = false;
         AZ::Aabb m_dirtyRegion;
 
-        // Cached data for each terrain area to use when looking up terrain data.
-        struct TerrainAreaData
-        {
-            AZ::Aabb m_areaBounds{ AZ::Aabb::CreateNull() };
-            bool m_useGroundPlane{ false };
-        };
-
         mutable AZStd::shared_mutex m_areaMutex;
         AZStd::map<AZ::EntityId, TerrainAreaData, TerrainLayerPriorityComparator> m_registeredAreas;
 
         mutable TerrainRaycastContext m_terrainRaycastContext;
+
+        // Cached heights and surface weights on the query grid, for the single position queries.
+        mutable TerrainTileCache m_tileCache;
+
+        AZ::TaskExecutor* m_taskExecutor = nullptr;
+
+        // The asynchronous queries that are still in flight, so that they can be cancelled and completed on deactivation.
+        // New queries get cancelled right away once the queries got cancelled, until the next activation.
+        mutable AZStd::mutex m_asyncQueriesMutex;
+        mutable AZStd::vector<AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>> m_asyncQueries;
+        bool m_asyncQueriesCancelled = false;
     };
 } // namespace Terrain
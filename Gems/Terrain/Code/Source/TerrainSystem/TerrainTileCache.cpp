@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainTileCache.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace Terrain
+{
+    namespace
+    {
+        bool HasLayer(TerrainTileCache::Layer layers, TerrainTileCache::Layer layer)
+        {
+            return (static_cast<AZ::u8>(layers) & static_cast<AZ::u8>(layer)) != 0;
+        }
+
+        // Floor division, so that negative grid indices map to the tile below them.
+        int32_t GetTileIndex(int32_t gridIndex)
+        {
+            return (gridIndex >= 0) ? (gridIndex / TerrainTileCache::TileSize)
+                                    : -((-gridIndex + TerrainTileCache::TileSize - 1) / TerrainTileCache::TileSize);
+        }
+
+        int32_t GetClampedGridIndex(float value, float queryResolution)
+        {
+            const float gridIndex = AZ::GetClamp(
+                floorf(value / queryResolution), aznumeric_cast<float>(-TerrainTileCache::MaxGridIndex),
+                aznumeric_cast<float>(TerrainTileCache::MaxGridIndex));
+            return aznumeric_cast<int32_t>(gridIndex);
+        }
+    }
+
+    void TerrainHeightTile::GetGridSquare(size_t localX, size_t localY, GridSquare& outGridSquare) const
+    {
+        const size_t x0 = m_x0Indices[localX];
+        const size_t x1 = m_x1Indices[localX];
+        const size_t y0 = m_y0Indices[localY] * m_gridWidth;
+        const size_t y1 = m_y1Indices[localY] * m_gridWidth;
+
+        outGridSquare.m_heightX0Y0 = m_heights[y0 + x0];
+        outGridSquare.m_heightX1Y0 = m_heights[y0 + x1];
+        outGridSquare.m_heightX0Y1 = m_heights[y1 + x0];
+        outGridSquare.m_heightX1Y1 = m_heights[y1 + x1];
+        outGridSquare.m_existsX0Y0 = m_exists[y0 + x0];
+        outGridSquare.m_existsX1Y1 = m_exists[y1 + x1];
+    }
+
+    size_t TerrainHeightTile::GetMemorySize() const
+    {
+        return sizeof(TerrainHeightTile) +
+            ((m_x0Indices.size() + m_x1Indices.size() + m_y0Indices.size() + m_y1Indices.size()) * sizeof(AZ::u16)) +
+            (m_heights.size() * sizeof(float)) + m_exists.size();
+    }
+
+    bool TerrainSurfaceTile::GetSurfaceWeights(
+        size_t localX, size_t localY, AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights) const
+    {
+        const size_t index = (localY * TerrainTileCache::TileSize) + localX;
+        const AZ::u8 count = m_counts[index];
+        if (count == Overflow)
+        {
+            return false;
+        }
+
+        const auto weightsBegin = m_weights.begin() + (index * MaxSurfaceWeights);
+        outSurfaceWeights.assign(weightsBegin, weightsBegin + count);
+        return true;
+    }
+
+    void TerrainSurfaceTile::SetSurfaceWeights(
+        size_t localX, size_t localY, const AzFramework::SurfaceData::SurfaceTagWeightList& surfaceWeights)
+    {
+        const size_t index = (localY * TerrainTileCache::TileSize) + localX;
+        if (surfaceWeights.size() > MaxSurfaceWeights)
+        {
+            m_counts[index] = Overflow;
+            return;
+        }
+
+        m_counts[index] = aznumeric_cast<AZ::u8>(surfaceWeights.size());
+        AZStd::copy(surfaceWeights.begin(), surfaceWeights.end(), m_weights.begin() + (index * MaxSurfaceWeights));
+    }
+
+    size_t TerrainSurfaceTile::GetMemorySize() const
+    {
+        return sizeof(TerrainSurfaceTile) + (m_weights.size() * sizeof(AzFramework::SurfaceData::SurfaceTagWeight)) + m_counts.size();
+    }
+
+    TerrainTileKey TerrainTileCache::GetTileKey(int32_t gridX, int32_t gridY)
+    {
+        return TerrainTileKey{ GetTileIndex(gridX), GetTileIndex(gridY) };
+    }
+
+    void TerrainTileCache::GetLocalIndices(const TerrainTileKey& key, int32_t gridX, int32_t gridY, size_t& outLocalX, size_t& outLocalY)
+    {
+        outLocalX = aznumeric_cast<size_t>(gridX - (key.m_x * TileSize));
+        outLocalY = aznumeric_cast<size_t>(gridY - (key.m_y * TileSize));
+    }
+
+    void TerrainTileCache::SetMemoryBudget(size_t memoryBudget)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+        m_memoryBudget = memoryBudget;
+        EnforceMemoryBudget();
+    }
+
+    bool TerrainTileCache::IsEnabled() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+        return m_memoryBudget > 0;
+    }
+
+    AZStd::shared_ptr<const TerrainHeightTile> TerrainTileCache::FindHeightTile(const TerrainTileKey& key)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+
+        auto entry = m_entries.find(key);
+        if ((entry == m_entries.end()) || !entry->second.m_heightTile)
+        {
+            m_statistics.m_misses++;
+            return {};
+        }
+
+        m_statistics.m_hits++;
+        m_lruList.splice(m_lruList.begin(), m_lruList, entry->second.m_lruIterator);
+        return entry->second.m_heightTile;
+    }
+
+    AZStd::shared_ptr<const TerrainSurfaceTile> TerrainTileCache::FindSurfaceTile(const TerrainTileKey& key)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+
+        auto entry = m_entries.find(key);
+        if ((entry == m_entries.end()) || !entry->second.m_surfaceTile)
+        {
+            m_statistics.m_misses++;
+            return {};
+        }
+
+        m_statistics.m_hits++;
+        m_lruList.splice(m_lruList.begin(), m_lruList, entry->second.m_lruIterator);
+        return entry->second.m_surfaceTile;
+    }
+
+    uint64_t TerrainTileCache::GetGeneration() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+        return m_generation;
+    }
+
+    void TerrainTileCache::AddHeightTile(const TerrainTileKey& key, AZStd::shared_ptr<const TerrainHeightTile> tile, uint64_t generation)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+        if ((m_memoryBudget == 0) || (generation != m_generation))
+        {
+            return;
+        }
+
+        CacheEntry& entry = GetOrCreateEntry(key);
+        entry.m_heightTile = AZStd::move(tile);
+        UpdateEntryMemorySize(entry);
+        EnforceMemoryBudget();
+    }
+
+    void TerrainTileCache::AddSurfaceTile(const TerrainTileKey& key, AZStd::shared_ptr<const TerrainSurfaceTile> tile, uint64_t generation)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+        if ((m_memoryBudget == 0) || (generation != m_generation))
+        {
+            return;
+        }
+
+        CacheEntry& entry = GetOrCreateEntry(key);
+        entry.m_surfaceTile = AZStd::move(tile);
+        UpdateEntryMemorySize(entry);
+        EnforceMemoryBudget();
+    }
+
+    bool TerrainTileCache::BeginCreateTile(const TerrainTileKey& key, Layer layer)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+
+        AZ::u8& layersInCreation = m_tilesInCreation[key];
+        if (HasLayer(static_cast<Layer>(layersInCreation), layer))
+        {
+            m_statistics.m_concurrentMisses++;
+            return false;
+        }
+
+        layersInCreation |= static_cast<AZ::u8>(layer);
+        return true;
+    }
+
+    void TerrainTileCache::EndCreateTile(const TerrainTileKey& key, Layer layer)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+
+        auto tileInCreation = m_tilesInCreation.find(key);
+        if (tileInCreation != m_tilesInCreation.end())
+        {
+            tileInCreation->second &= ~static_cast<AZ::u8>(layer);
+            if (tileInCreation->second == 0)
+            {
+                m_tilesInCreation.erase(tileInCreation);
+            }
+        }
+    }
+
+    void TerrainTileCache::Invalidate(const AZ::Aabb& region, float queryResolution, Layer layers)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+
+        // Tiles that are being created right now may already contain stale data, so they must not get added.
+        m_generation++;
+
+        if (!region.IsValid() || (queryResolution <= 0.0f))
+        {
+            return;
+        }
+
+        // Bilinear queries read the grid points on both sides of a grid square, so include one extra grid point on each side.
+        const TerrainTileKey minKey = GetTileKey(
+            GetClampedGridIndex(region.GetMin().GetX(), queryResolution) - 1, GetClampedGridIndex(region.GetMin().GetY(), queryResolution) - 1);
+        const TerrainTileKey maxKey = GetTileKey(
+            GetClampedGridIndex(region.GetMax().GetX(), queryResolution) + 1, GetClampedGridIndex(region.GetMax().GetY(), queryResolution) + 1);
+
+        AZStd::vector<TerrainTileKey> removedKeys;
+        for (auto& [key, entry] : m_entries)
+        {
+            if ((key.m_x < minKey.m_x) || (key.m_x > maxKey.m_x) || (key.m_y < minKey.m_y) || (key.m_y > maxKey.m_y))
+            {
+                continue;
+            }
+
+            if (HasLayer(layers, Layer::Heights))
+            {
+                entry.m_heightTile.reset();
+            }
+            if (HasLayer(layers, Layer::SurfaceWeights))
+            {
+                entry.m_surfaceTile.reset();
+            }
+
+            m_statistics.m_invalidations++;
+            if (!entry.m_heightTile && !entry.m_surfaceTile)
+            {
+                removedKeys.push_back(key);
+            }
+            else
+            {
+                UpdateEntryMemorySize(entry);
+            }
+        }
+
+        for (const auto& key : removedKeys)
+        {
+            RemoveEntry(key);
+        }
+    }
+
+    void TerrainTileCache::Clear()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+        m_generation++;
+        m_entries.clear();
+        m_lruList.clear();
+        m_memoryUsed = 0;
+    }
+
+    TerrainTileCache::Statistics TerrainTileCache::GetStatistics() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+        Statistics statistics = m_statistics;
+        statistics.m_numTiles = m_entries.size();
+        statistics.m_memoryUsed = m_memoryUsed;
+        statistics.m_memoryBudget = m_memoryBudget;
+        return statistics;
+    }
+
+    void TerrainTileCache::ResetStatistics()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_cacheMutex);
+        m_statistics = {};
+    }
+
+    TerrainTileCache::CacheEntry& TerrainTileCache::GetOrCreateEntry(const TerrainTileKey& key)
+    {
+        auto [entry, inserted] = m_entries.try_emplace(key);
+        if (inserted)
+        {
+            m_lruList.push_front(key);
+            entry->second.m_lruIterator = m_lruList.begin();
+        }
+        else
+        {
+            m_lruList.splice(m_lruList.begin(), m_lruList, entry->second.m_lruIterator);
+        }
+        return entry->second;
+    }
+
+    void TerrainTileCache::UpdateEntryMemorySize(CacheEntry& entry)
+    {
+        m_memoryUsed -= entry.m_memorySize;
+        entry.m_memorySize = (entry.m_heightTile ? entry.m_heightTile->GetMemorySize() : 0) +
+            (entry.m_surfaceTile ? entry.m_surfaceTile->GetMemorySize() : 0);
+        m_memoryUsed += entry.m_memorySize;
+    }
+
+    void TerrainTileCache::RemoveEntry(const TerrainTileKey& key)
+    {
+        auto entry = m_entries.find(key);
+        if (entry != m_entries.end())
+        {
+            m_memoryUsed -= entry->second.m_memorySize;
+            m_lruList.erase(entry->second.m_lruIterator);
+            m_entries.erase(entry);
+        }
+    }
+
+    void TerrainTileCache::EnforceMemoryBudget()
+    {
+        // Evict the least recently used tiles until the cache fits within its budget.
+        while ((m_memoryUsed > m_memoryBudget) && !m_lruList.empty())
+        {
+            const TerrainTileKey key = m_lruList.back();
+            RemoveEntry(key);
+            m_statistics.m_evictions++;
+        }
+    }
+} // namespace Terrain
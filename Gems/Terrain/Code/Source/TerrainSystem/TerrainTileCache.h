@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzFramework/SurfaceData/SurfaceData.h>
+
+namespace Terrain
+{
+    //! The key of a tile in the terrain tile cache, in units of tiles on the terrain query grid.
+    struct TerrainTileKey
+    {
+        int32_t m_x = 0;
+        int32_t m_y = 0;
+
+        bool operator==(const TerrainTileKey& other) const
+        {
+            return (m_x == other.m_x) && (m_y == other.m_y);
+        }
+    };
+
+    struct TerrainTileKeyHash
+    {
+        size_t operator()(const TerrainTileKey& key) const
+        {
+            return (static_cast<size_t>(static_cast<uint32_t>(key.m_x)) * 73856093) ^ static_cast<size_t>(static_cast<uint32_t>(key.m_y));
+        }
+    };
+
+    //! The cached heights of a tile of grid squares on the terrain query grid.
+    //! Uncached bilinear queries evaluate the four corners of a grid square at gridPosition and gridPosition + queryResolution,
+    //! which isn't always bit-identical to the position of the neighboring grid point. The tile stores the heights at exactly
+    //! those positions, and shares the positions that are identical, so that cached queries match uncached queries bit for bit.
+    //! The heights get queried with the batched area queries, so this holds as long as the area providers return the same
+    //! heights from GetHeights() as from GetHeight().
+    struct TerrainHeightTile
+    {
+        AZ_CLASS_ALLOCATOR(TerrainHeightTile, AZ::SystemAllocator, 0);
+
+        //! The heights of the four corners of a grid square, and whether or not terrain exists at the corners
+        //! that the queries report.
+        struct GridSquare
+        {
+            float m_heightX0Y0 = 0.0f;
+            float m_heightX1Y0 = 0.0f;
+            float m_heightX0Y1 = 0.0f;
+            float m_heightX1Y1 = 0.0f;
+            bool m_existsX0Y0 = false;
+            bool m_existsX1Y1 = false;
+        };
+
+        void GetGridSquare(size_t localX, size_t localY, GridSquare& outGridSquare) const;
+        size_t GetMemorySize() const;
+
+        //! For each column and row of the tile, the index of the X0/Y0 and X1/Y1 coordinates in the height grid.
+        AZStd::vector<AZ::u16> m_x0Indices;
+        AZStd::vector<AZ::u16> m_x1Indices;
+        AZStd::vector<AZ::u16> m_y0Indices;
+        AZStd::vector<AZ::u16> m_y1Indices;
+
+        //! The heights and terrain exists flags at the unique coordinates of the tile, in row-major order.
+        size_t m_gridWidth = 0;
+        AZStd::vector<float> m_heights;
+        AZStd::vector<bool> m_exists;
+    };
+
+    //! The cached surface weights at the grid points of a tile on the terrain query grid, sorted by weight.
+    //! They get queried with the batched area queries, like the heights.
+    struct TerrainSurfaceTile
+    {
+        AZ_CLASS_ALLOCATOR(TerrainSurfaceTile, AZ::SystemAllocator, 0);
+
+        //! The number of surface weights that get cached for each grid point.
+        static constexpr size_t MaxSurfaceWeights = 4;
+        //! Marks a grid point with more surface weights than the tile can hold. These grid points aren't served from the cache.
+        static constexpr AZ::u8 Overflow = 0xFF;
+
+        //! Returns false if the grid point has more surface weights than the tile holds.
+        bool GetSurfaceWeights(size_t localX, size_t localY, AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights) const;
+        void SetSurfaceWeights(size_t localX, size_t localY, const AzFramework::SurfaceData::SurfaceTagWeightList& surfaceWeights);
+        size_t GetMemorySize() const;
+
+        AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeight> m_weights;
+        AZStd::vector<AZ::u8> m_counts;
+    };
+
+    //! An LRU cache of terrain tiles with a memory budget.
+    //! The tiles are immutable once they are added, so they can be read without holding the lock of the cache.
+    //! Tiles are created outside of the cache by the terrain system, and only get added if the cache hasn't been invalidated
+    //! since their creation started.
+    class TerrainTileCache final
+    {
+    public:
+        //! The number of grid squares along each side of a tile.
+        static constexpr int32_t TileSize = 32;
+
+        //! The grid index range that can be cached. Larger indices can't be represented exactly as floats.
+        static constexpr int32_t MaxGridIndex = (1 << 24) - TileSize;
+
+        enum class Layer : AZ::u8
+        {
+            Heights = 0x01,
+            SurfaceWeights = 0x02,
+            All = Heights | SurfaceWeights
+        };
+
+        struct Statistics
+        {
+            size_t m_hits = 0;
+            size_t m_misses = 0;
+            size_t m_evictions = 0;
+            size_t m_invalidations = 0;
+            //! Misses that got queried directly, because another thread was already creating the tile.
+            size_t m_concurrentMisses = 0;
+            size_t m_numTiles = 0;
+            size_t m_memoryUsed = 0;
+            size_t m_memoryBudget = 0;
+        };
+
+        //! Get the tile that contains a grid point, and the position of the grid point within that tile.
+        static TerrainTileKey GetTileKey(int32_t gridX, int32_t gridY);
+        static void GetLocalIndices(const TerrainTileKey& key, int32_t gridX, int32_t gridY, size_t& outLocalX, size_t& outLocalY);
+
+        //! Set the memory budget of the cache in bytes. A budget of 0 disables the cache.
+        void SetMemoryBudget(size_t memoryBudget);
+        bool IsEnabled() const;
+
+        AZStd::shared_ptr<const TerrainHeightTile> FindHeightTile(const TerrainTileKey& key);
+        AZStd::shared_ptr<const TerrainSurfaceTile> FindSurfaceTile(const TerrainTileKey& key);
+
+        //! The generation of the cache changes with every invalidation. Tiles that were created with an older generation
+        //! don't get added, since they may contain stale data.
+        uint64_t GetGeneration() const;
+        void AddHeightTile(const TerrainTileKey& key, AZStd::shared_ptr<const TerrainHeightTile> tile, uint64_t generation);
+        void AddSurfaceTile(const TerrainTileKey& key, AZStd::shared_ptr<const TerrainSurfaceTile> tile, uint64_t generation);
+
+        //! Mark a layer of a tile as being created by the calling thread. Returns false if another thread is already creating it,
+        //! in which case the caller should query the terrain directly instead of creating the same tile again.
+        bool BeginCreateTile(const TerrainTileKey& key, Layer layer);
+        //! Clear the mark set by a successful BeginCreateTile(), once the tile has been added.
+        void EndCreateTile(const TerrainTileKey& key, Layer layer);
+
+        //! Remove the given layers of the tiles that contain grid points within the region.
+        void Invalidate(const AZ::Aabb& region, float queryResolution, Layer layers = Layer::All);
+        void Clear();
+
+        Statistics GetStatistics() const;
+        void ResetStatistics();
+
+    private:
+        struct CacheEntry
+        {
+            AZStd::shared_ptr<const TerrainHeightTile> m_heightTile;
+            AZStd::shared_ptr<const TerrainSurfaceTile> m_surfaceTile;
+            AZStd::list<TerrainTileKey>::iterator m_lruIterator;
+            size_t m_memorySize = 0;
+        };
+
+        CacheEntry& GetOrCreateEntry(const TerrainTileKey& key);
+        void UpdateEntryMemorySize(CacheEntry& entry);
+        void RemoveEntry(const TerrainTileKey& key);
+        void EnforceMemoryBudget();
+
+        mutable AZStd::mutex m_cacheMutex;
+        AZStd::unordered_map<TerrainTileKey, CacheEntry, TerrainTileKeyHash> m_entries;
+
+        //! The layers of the tiles that are being created right now.
+        AZStd::unordered_map<TerrainTileKey, AZ::u8, TerrainTileKeyHash> m_tilesInCreation;
+
+        //! The tile keys ordered from the most recently used to the least recently used.
+        AZStd::list<TerrainTileKey> m_lruList;
+
+        size_t m_memoryBudget = 0;
+        size_t m_memoryUsed = 0;
+        uint64_t m_generation = 0;
+        Statistics m_statistics;
+    };
+} // namespace Terrain
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <gmock/gmock.h>
+
+#include <TerrainRenderer/TerrainHeightClipmap.h>
+
+#include <AzFramework/Terrain/TerrainDataRequestBus.h>
+#include <Tests/Mocks/Terrain/MockTerrainDataRequestBus.h>
+
+namespace UnitTest
+{
+    using ::testing::NiceMock;
+
+    class TerrainHeightClipmapTests
+        : public UnitTest::AllocatorsTestFixture
+    {
+    public:
+        static float GetMockHeight(float x, float y)
+        {
+            return x * 0.5f + y * 0.25f;
+        }
+
+        void SetUp() override
+        {
+            UnitTest::AllocatorsTestFixture::SetUp();
+
+            m_terrainData = AZStd::make_unique<NiceMock<UnitTest::MockTerrainDataRequests>>();
+            ON_CALL(*m_terrainData, ProcessHeightsFromRegionAsync).WillByDefault(
+                [this](const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+                    AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+                    [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter,
+                    [[maybe_unused]] const AzFramework::Terrain::QueryAsyncParams& params)
+                {
+                    auto jobContext = AZStd::make_shared<AzFramework::Terrain::TerrainJobContext>();
+                    auto runQuery = [this, inRegion, stepSize, perPositionCallback, jobContext]()
+                    {
+                        ProcessHeights(inRegion, stepSize, perPositionCallback);
+                        jobContext->MarkComplete();
+                    };
+
+                    // Queries either complete right away, or wait until the test completes them.
+                    if (m_deferQueries)
+                    {
+                        m_deferredQueries.push_back(runQuery);
+                    }
+                    else
+                    {
+                        runQuery();
+                    }
+                    return jobContext;
+                }
+            );
+        }
+
+        void ProcessHeights(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+            AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback)
+        {
+            const size_t numSamplesX = aznumeric_cast<size_t>(ceil(inRegion.GetExtents().GetX() / stepSize.GetX()));
+            const size_t numSamplesY = aznumeric_cast<size_t>(ceil(inRegion.GetExtents().GetY() / stepSize.GetY()));
+
+            AzFramework::SurfaceData::SurfacePoint surfacePoint;
+            for (size_t y = 0; y < numSamplesY; y++)
+            {
+                const float fy = inRegion.GetMin().GetY() + (y * stepSize.GetY());
+                for (size_t x = 0; x < numSamplesX; x++)
+                {
+                    const float fx = inRegion.GetMin().GetX() + (x * stepSize.GetX());
+                    const bool isPeak = (fx == m_peakPosition.GetX()) && (fy == m_peakPosition.GetY());
+                    surfacePoint.m_position.Set(fx, fy, isPeak ? m_peakHeight : GetMockHeight(fx, fy));
+                    perPositionCallback(x, y, surfacePoint, true);
+                    ++m_samplesQueried;
+                }
+            }
+        }
+
+        void CompleteDeferredQueries()
+        {
+            for (auto& runQuery : m_deferredQueries)
+            {
+                runQuery();
+            }
+            m_deferredQueries.clear();
+        }
+
+        void TearDown() override
+        {
+            m_deferredQueries.clear();
+            m_terrainData.reset();
+
+            UnitTest::AllocatorsTestFixture::TearDown();
+        }
+
+        Terrain::TerrainHeightClipmapDescriptor CreateDescriptor(uint32_t levelCount, uint32_t size, uint32_t maxSamplesPerUpdate)
+        {
+            Terrain::TerrainHeightClipmapDescriptor desc;
+            desc.m_levelCount = levelCount;
+            desc.m_size = size;
+            desc.m_sampleSpacing = 1.0f;
+            desc.m_clipmapUpdateMultiple = 4;
+            desc.m_maxSamplesPerUpdate = maxSamplesPerUpdate;
+            return desc;
+        }
+
+        AZStd::unique_ptr<NiceMock<UnitTest::MockTerrainDataRequests>> m_terrainData;
+        size_t m_samplesQueried = 0;
+        bool m_deferQueries = false;
+
+        //! A single sample that sticks out of the otherwise flat slope of the mock heights.
+        AZ::Vector2 m_peakPosition = AZ::Vector2(AZStd::numeric_limits<float>::max());
+        float m_peakHeight = 0.0f;
+        AZStd::vector<AZStd::function<void()>> m_deferredQueries;
+    };
+
+    TEST_F(TerrainHeightClipmapTests, InitialUpdateFillsAllLevels)
+    {
+        constexpr uint32_t LevelCount = 2;
+        constexpr uint32_t Size = 16;
+
+        Terrain::TerrainHeightClipmap clipmap;
+        clipmap.Initialize(CreateDescriptor(LevelCount, Size, LevelCount * Size * Size), AZ::Vector3::CreateZero());
+        EXPECT_TRUE(clipmap.HasPendingUpdates());
+        EXPECT_FALSE(clipmap.IsLevelReady(0));
+
+        const size_t samplesProcessed = clipmap.Update(AZ::Vector3::CreateZero());
+        EXPECT_EQ(samplesProcessed, LevelCount * Size * Size);
+        EXPECT_EQ(m_samplesQueried, LevelCount * Size * Size);
+        EXPECT_FALSE(clipmap.HasPendingUpdates());
+
+        // Each level is twice the size of the previous one.
+        EXPECT_TRUE(clipmap.GetLevelWorldBounds(0).IsClose(AZ::Aabb::CreateFromMinMaxValues(-8.0f, -8.0f, 0.0f, 8.0f, 8.0f, 0.0f)));
+        EXPECT_TRUE(clipmap.GetLevelWorldBounds(1).IsClose(AZ::Aabb::CreateFromMinMaxValues(-16.0f, -16.0f, 0.0f, 16.0f, 16.0f, 0.0f)));
+        EXPECT_FLOAT_EQ(clipmap.GetLevelSampleSpacing(1), 2.0f);
+    }
+
+    TEST_F(TerrainHeightClipmapTests, HeightBoundsMatchTerrainHeights)
+    {
+        Terrain::TerrainHeightClipmap clipmap;
+        clipmap.Initialize(CreateDescriptor(2, 16, 2 * 16 * 16), AZ::Vector3::CreateZero());
+        clipmap.Update(AZ::Vector3::CreateZero());
+
+        float minHeight = 0.0f;
+        float maxHeight = 0.0f;
+        const AZ::Aabb region = AZ::Aabb::CreateFromMinMaxValues(-4.0f, -4.0f, 0.0f, 4.0f, 4.0f, 0.0f);
+        ASSERT_TRUE(clipmap.GetHeightBounds(region, minHeight, maxHeight));
+        EXPECT_FLOAT_EQ(minHeight, GetMockHeight(-4.0f, -4.0f));
+        EXPECT_FLOAT_EQ(maxHeight, GetMockHeight(4.0f, 4.0f));
+
+        // Regions that need samples past the edge of the finest level fall back to the next level.
+        size_t level = 0;
+        EXPECT_TRUE(clipmap.FindLevelForRegion(AZ::Aabb::CreateFromMinMaxValues(-8.0f, -8.0f, 0.0f, 7.0f, 7.0f, 0.0f), level));
+        EXPECT_EQ(level, 0);
+        EXPECT_TRUE(clipmap.FindLevelForRegion(AZ::Aabb::CreateFromMinMaxValues(-8.0f, -8.0f, 0.0f, 8.0f, 8.0f, 0.0f), level));
+        EXPECT_EQ(level, 1);
+        EXPECT_FALSE(clipmap.FindLevelForRegion(AZ::Aabb::CreateFromMinMaxValues(-32.0f, -32.0f, 0.0f, 0.0f, 0.0f, 0.0f), level));
+    }
+
+    TEST_F(TerrainHeightClipmapTests, HeightBoundsIncludePeaksBetweenCoarseSamples)
+    {
+        // The peak is on an odd sample, so only the finest level has it. The next level has half the sample density.
+        m_peakPosition = AZ::Vector2(-11.0f, 1.0f);
+        m_peakHeight = 100.0f;
+
+        Terrain::TerrainHeightClipmap clipmap;
+        clipmap.Initialize(CreateDescriptor(2, 16, 2 * 16 * 16), AZ::Vector3::CreateZero());
+        clipmap.Update(AZ::Vector3::CreateZero());
+
+        // The region is outside of the finest level, and the next level would miss the peak, so there are no bounds for it.
+        float minHeight = 0.0f;
+        float maxHeight = 0.0f;
+        const AZ::Aabb region = AZ::Aabb::CreateFromMinMaxValues(-12.0f, -2.0f, 0.0f, -10.0f, 2.0f, 0.0f);
+        size_t level = 0;
+        EXPECT_TRUE(clipmap.FindLevelForRegion(region, level));
+        EXPECT_EQ(level, 1);
+        EXPECT_FALSE(clipmap.ContainsRegion(0, region));
+        EXPECT_TRUE(clipmap.ContainsRegion(1, region));
+        EXPECT_FALSE(clipmap.GetHeightBounds(region, minHeight, maxHeight));
+
+        // Once the finest level moves over the region, its bounds include the peak.
+        clipmap.Update(AZ::Vector3(-8.0f, 0.0f, 0.0f));
+        EXPECT_TRUE(clipmap.ContainsRegion(0, region));
+        ASSERT_TRUE(clipmap.GetHeightBounds(region, minHeight, maxHeight));
+        EXPECT_FLOAT_EQ(minHeight, GetMockHeight(-12.0f, -2.0f));
+        EXPECT_FLOAT_EQ(maxHeight, m_peakHeight);
+    }
+
+    TEST_F(TerrainHeightClipmapTests, UpdatesStayWithinSampleBudget)
+    {
+        constexpr uint32_t Size = 16;
+        constexpr uint32_t MaxSamplesPerUpdate = 64;
+
+        Terrain::TerrainHeightClipmap clipmap;
+        clipmap.Initialize(CreateDescriptor(1, Size, MaxSamplesPerUpdate), AZ::Vector3::CreateZero());
+
+        size_t updateCount = 0;
+        while (clipmap.HasPendingUpdates())
+        {
+            EXPECT_LE(clipmap.Update(AZ::Vector3::CreateZero()), MaxSamplesPerUpdate);
+            ++updateCount;
+        }
+
+        EXPECT_EQ(updateCount, Size * Size / MaxSamplesPerUpdate);
+        EXPECT_EQ(m_samplesQueried, Size * Size);
+    }
+
+    TEST_F(TerrainHeightClipmapTests, CameraMovementOnlyUpdatesExposedRegions)
+    {
+        constexpr uint32_t Size = 16;
+
+        Terrain::TerrainHeightClipmap clipmap;
+        clipmap.Initialize(CreateDescriptor(2, Size, 2 * Size * Size), AZ::Vector3::CreateZero());
+        clipmap.Update(AZ::Vector3::CreateZero());
+        m_samplesQueried = 0;
+
+        // Moving by the update multiple exposes a single strip of the finest level. The next level is twice as coarse,
+        // so it doesn't move yet.
+        AZStd::vector<AZ::Aabb> updatedRegions;
+        const size_t samplesProcessed = clipmap.Update(AZ::Vector3(4.0f, 0.0f, 0.0f), &updatedRegions);
+        EXPECT_EQ(samplesProcessed, 4 * Size);
+        EXPECT_EQ(m_samplesQueried, 4 * Size);
+        ASSERT_EQ(updatedRegions.size(), 1);
+        EXPECT_TRUE(updatedRegions.at(0).IsClose(AZ::Aabb::CreateFromMinMaxValues(8.0f, -8.0f, 0.0f, 12.0f, 8.0f, 0.0f)));
+
+        // The new strip reuses the storage of the samples that went out of view, but the heights should still match the world positions.
+        float minHeight = 0.0f;
+        float maxHeight = 0.0f;
+        const AZ::Aabb region = AZ::Aabb::CreateFromMinMaxValues(4.0f, -2.0f, 0.0f, 10.0f, 2.0f, 0.0f);
+        ASSERT_TRUE(clipmap.GetHeightBounds(region, minHeight, maxHeight));
+        EXPECT_FLOAT_EQ(minHeight, GetMockHeight(4.0f, -2.0f));
+        EXPECT_FLOAT_EQ(maxHeight, GetMockHeight(10.0f, 2.0f));
+
+        // Small movements within the update multiple don't query anything.
+        m_samplesQueried = 0;
+        EXPECT_EQ(clipmap.Update(AZ::Vector3(5.0f, 1.0f, 0.0f)), 0);
+        EXPECT_EQ(m_samplesQueried, 0);
+    }
+
+    TEST_F(TerrainHeightClipmapTests, MarkDirtyOnlyUpdatesDirtySamples)
+    {
+        Terrain::TerrainHeightClipmap clipmap;
+        clipmap.Initialize(CreateDescriptor(2, 16, 2 * 16 * 16), AZ::Vector3::CreateZero());
+        clipmap.Update(AZ::Vector3::CreateZero());
+        m_samplesQueried = 0;
+
+        clipmap.MarkDirty(AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, 0.0f, 2.0f, 2.0f, 0.0f));
+        EXPECT_FALSE(clipmap.IsLevelReady(0));
+        EXPECT_FALSE(clipmap.IsLevelReady(1));
+
+        // The dirty region is expanded to the sample grid of each level: 3x3 samples in the first level and 2x2 in the second.
+        EXPECT_EQ(clipmap.Update(AZ::Vector3::CreateZero()), 9 + 4);
+        EXPECT_EQ(m_samplesQueried, 9 + 4);
+        EXPECT_FALSE(clipmap.HasPendingUpdates());
+
+        // Regions outside of all the levels are ignored.
+        clipmap.MarkDirty(AZ::Aabb::CreateFromMinMaxValues(100.0f, 100.0f, 0.0f, 110.0f, 110.0f, 0.0f));
+        EXPECT_FALSE(clipmap.HasPendingUpdates());
+    }
+
+    TEST_F(TerrainHeightClipmapTests, QueriesInFlightCompleteOnLaterUpdates)
+    {
+        constexpr uint32_t Size = 16;
+        constexpr uint32_t MaxSamplesPerUpdate = 64;
+        m_deferQueries = true;
+
+        Terrain::TerrainHeightClipmap clipmap;
+        clipmap.Initialize(CreateDescriptor(1, Size, MaxSamplesPerUpdate), AZ::Vector3::CreateZero());
+
+        // The first update only starts the queries, it doesn't wait for them.
+        AZStd::vector<AZ::Aabb> updatedRegions;
+        EXPECT_EQ(clipmap.Update(AZ::Vector3::CreateZero(), &updatedRegions), MaxSamplesPerUpdate);
+        EXPECT_EQ(m_samplesQueried, 0);
+        EXPECT_TRUE(updatedRegions.empty());
+        EXPECT_FALSE(clipmap.IsLevelReady(0));
+
+        // No new queries are started while the previous ones are in flight.
+        EXPECT_EQ(clipmap.Update(AZ::Vector3::CreateZero(), &updatedRegions), 0);
+        EXPECT_TRUE(updatedRegions.empty());
+
+        // Once the queries complete, the next update copies their heights and starts the next queries.
+        CompleteDeferredQueries();
+        EXPECT_EQ(m_samplesQueried, MaxSamplesPerUpdate);
+        EXPECT_EQ(clipmap.Update(AZ::Vector3::CreateZero(), &updatedRegions), MaxSamplesPerUpdate);
+        ASSERT_EQ(updatedRegions.size(), 1);
+        EXPECT_TRUE(updatedRegions.at(0).IsClose(AZ::Aabb::CreateFromMinMaxValues(-8.0f, -8.0f, 0.0f, 8.0f, -4.0f, 0.0f)));
+
+        float minHeight = 0.0f;
+        float maxHeight = 0.0f;
+        const AZ::Aabb region = AZ::Aabb::CreateFromMinMaxValues(-8.0f, -8.0f, 0.0f, 0.0f, -6.0f, 0.0f);
+        ASSERT_TRUE(clipmap.GetHeightBounds(region, minHeight, maxHeight));
+        EXPECT_FLOAT_EQ(minHeight, GetMockHeight(-8.0f, -8.0f));
+        EXPECT_FLOAT_EQ(maxHeight, GetMockHeight(0.0f, -6.0f));
+
+        // Queries that complete after the clipmap is reset don't touch it anymore.
+        clipmap.Reset();
+        CompleteDeferredQueries();
+        EXPECT_FALSE(clipmap.HasPendingUpdates());
+    }
+
+    TEST_F(TerrainHeightClipmapTests, PendingRegionsOnlyAffectTheSamplesTheyCover)
+    {
+        constexpr uint32_t Size = 16;
+
+        Terrain::TerrainHeightClipmap clipmap;
+        clipmap.Initialize(CreateDescriptor(2, Size, 2 * Size * Size), AZ::Vector3::CreateZero());
+        clipmap.Update(AZ::Vector3::CreateZero());
+
+        // While the strip that came into view is waiting for its heights, the rest of the finest level can still be used,
+        // so regions near the center don't switch to a coarser level every time the center moves.
+        m_deferQueries = true;
+        clipmap.Update(AZ::Vector3(4.0f, 0.0f, 0.0f));
+        EXPECT_FALSE(clipmap.IsLevelReady(0));
+
+        size_t level = 0;
+        EXPECT_TRUE(clipmap.FindLevelForRegion(AZ::Aabb::CreateFromMinMaxValues(-2.0f, -2.0f, 0.0f, 2.0f, 2.0f, 0.0f), level));
+        EXPECT_EQ(level, 0);
+        EXPECT_TRUE(clipmap.FindLevelForRegion(AZ::Aabb::CreateFromMinMaxValues(8.0f, -2.0f, 0.0f, 10.0f, 2.0f, 0.0f), level));
+        EXPECT_EQ(level, 1);
+
+        CompleteDeferredQueries();
+        clipmap.Update(AZ::Vector3(4.0f, 0.0f, 0.0f));
+        EXPECT_TRUE(clipmap.FindLevelForRegion(AZ::Aabb::CreateFromMinMaxValues(8.0f, -2.0f, 0.0f, 10.0f, 2.0f, 0.0f), level));
+        EXPECT_EQ(level, 0);
+
+        // Dirty regions work the same way.
+        m_deferQueries = false;
+        clipmap.MarkDirty(AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, 0.0f, 2.0f, 2.0f, 0.0f));
+        EXPECT_TRUE(clipmap.FindLevelForRegion(AZ::Aabb::CreateFromMinMaxValues(4.0f, 4.0f, 0.0f, 6.0f, 6.0f, 0.0f), level));
+        EXPECT_EQ(level, 0);
+        EXPECT_FALSE(clipmap.FindLevelForRegion(AZ::Aabb::CreateFromMinMaxValues(-1.0f, -1.0f, 0.0f, 1.0f, 1.0f, 0.0f), level));
+    }
+}
@@ -8,8 +8,10 @@
 
 #include <AzCore/Casting/lossy_cast.h>
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Memory/MemoryComponent.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <AzFramework/Physics/Mocks/MockHeightfieldProviderBus.h>
@@ -112,6 +114,23 @@ protected:
             }
         }
     }
+
+    AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> ProcessRegionLoopAsync(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+        AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+        AzFramework::SurfaceData::SurfaceTagWeightList* surfaceTags,
+        float mockHeight,
+        const AzFramework::Terrain::QueryAsyncParams& params)
+    {
+        // The mock completes the query before returning, like the terrain system does without a task executor.
+        auto jobContext = AZStd::make_shared<AzFramework::Terrain::TerrainJobContext>();
+        ProcessRegionLoop(inRegion, stepSize, perPositionCallback, surfaceTags, mockHeight);
+        if (params.m_completionCallback)
+        {
+            params.m_completionCallback(jobContext);
+        }
+        jobContext->MarkComplete();
+        return jobContext;
+    }
 };
 
 TEST_F(TerrainPhysicsColliderComponentTest, ActivateEntityActivateSuccess)
@@ -419,12 +438,13 @@ TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderGetHeightsAndM
 
     NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
     ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(mockHeightResolution));
-    ON_CALL(terrainListener, ProcessSurfacePointsFromRegion).WillByDefault(
+    ON_CALL(terrainListener, ProcessSurfacePointsFromRegionAsync).WillByDefault(
         [this, mockHeight, &surfaceTags](const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
             AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
-            [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter)
+            [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter,
+            const AzFramework::Terrain::QueryAsyncParams& params)
         {
-            ProcessRegionLoop(inRegion, stepSize, perPositionCallback, &surfaceTags, mockHeight);
+            return ProcessRegionLoopAsync(inRegion, stepSize, perPositionCallback, &surfaceTags, mockHeight, params);
         }
     );
 
@@ -499,12 +519,13 @@ TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderDefaultMateria
 
     NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
     ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(mockHeightResolution));
-    ON_CALL(terrainListener, ProcessSurfacePointsFromRegion).WillByDefault(
+    ON_CALL(terrainListener, ProcessSurfacePointsFromRegionAsync).WillByDefault(
         [this, mockHeight, &surfaceTags](const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
             AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
-            [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter)
+            [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter,
+            const AzFramework::Terrain::QueryAsyncParams& params)
     {
-        ProcessRegionLoop(inRegion, stepSize, perPositionCallback, &surfaceTags, mockHeight);
+        return ProcessRegionLoopAsync(inRegion, stepSize, perPositionCallback, &surfaceTags, mockHeight, params);
     }
     );
 
@@ -566,12 +587,13 @@ TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderDefaultMateria
 
     NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
     ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(mockHeightResolution));
-    ON_CALL(terrainListener, ProcessSurfacePointsFromRegion).WillByDefault(
+    ON_CALL(terrainListener, ProcessSurfacePointsFromRegionAsync).WillByDefault(
         [this, mockHeight, &surfaceTags](const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
             AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
-            [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter)
+            [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter,
+            const AzFramework::Terrain::QueryAsyncParams& params)
     {
-        ProcessRegionLoop(inRegion, stepSize, perPositionCallback, &surfaceTags, mockHeight);
+        return ProcessRegionLoopAsync(inRegion, stepSize, perPositionCallback, &surfaceTags, mockHeight, params);
     }
     );
 
@@ -591,3 +613,156 @@ TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderDefaultMateria
         EXPECT_EQ(heightsAndMaterials[256 * 128].m_materialIndex, 0);
     }
 }
+
+TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderReturnsIndicesFromRegion)
+{
+    // Check that a world region is converted to the range of heightfield samples that it affects.
+    AddTerrainPhysicsColliderToEntity(Terrain::TerrainPhysicsColliderConfig());
+
+    m_entity->Activate();
+
+    NiceMock<UnitTest::MockShapeComponentRequests> boxShape(m_entity->GetId());
+    const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(1024.0f));
+    ON_CALL(boxShape, GetEncompassingAabb).WillByDefault(Return(bounds));
+
+    float mockHeightResolution = 1.0f;
+    NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
+    ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(mockHeightResolution));
+
+    size_t startColumn, startRow, numColumns, numRows;
+
+    // A region that doesn't line up with the grid gets rounded outwards to the surrounding samples.
+    Physics::HeightfieldProviderRequestsBus::Event(
+        m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion,
+        AZ::Aabb::CreateFromMinMaxValues(10.5f, 20.2f, 0.0f, 30.1f, 40.0f, 0.0f), startColumn, startRow, numColumns, numRows);
+    EXPECT_EQ(startColumn, 10);
+    EXPECT_EQ(startRow, 20);
+    EXPECT_EQ(numColumns, 22);
+    EXPECT_EQ(numRows, 21);
+
+    // A region that extends past the heightfield gets clamped to the last sample.
+    Physics::HeightfieldProviderRequestsBus::Event(
+        m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion,
+        AZ::Aabb::CreateFromMinMaxValues(1000.0f, -50.0f, 0.0f, 2000.0f, 5.0f, 0.0f), startColumn, startRow, numColumns, numRows);
+    EXPECT_EQ(startColumn, 1000);
+    EXPECT_EQ(startRow, 0);
+    EXPECT_EQ(numColumns, 24);
+    EXPECT_EQ(numRows, 6);
+
+    // A region outside of the heightfield doesn't affect any samples.
+    Physics::HeightfieldProviderRequestsBus::Event(
+        m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion,
+        AZ::Aabb::CreateFromMinMaxValues(-100.0f, -100.0f, 0.0f, -50.0f, -50.0f, 0.0f), startColumn, startRow, numColumns, numRows);
+    EXPECT_EQ(numColumns, 0);
+    EXPECT_EQ(numRows, 0);
+}
+
+TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderUpdatesOnlySamplesInRegion)
+{
+    // Check that updating a region of the heightfield only generates the samples within that region, with absolute indices.
+    AddTerrainPhysicsColliderToEntity(Terrain::TerrainPhysicsColliderConfig());
+
+    m_entity->Activate();
+
+    NiceMock<UnitTest::MockShapeComponentRequests> boxShape(m_entity->GetId());
+    const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(256.0f, 256.0f, 32768.0f));
+    ON_CALL(boxShape, GetEncompassingAabb).WillByDefault(Return(bounds));
+
+    const float mockHeight = 32768.0f;
+    float mockHeightResolution = 1.0f;
+
+    AzFramework::SurfaceData::SurfaceTagWeightList surfaceTags = {
+        AzFramework::SurfaceData::SurfaceTagWeight(SurfaceData::SurfaceTag("tag1"), 1.0f),
+        AzFramework::SurfaceData::SurfaceTagWeight(SurfaceData::SurfaceTag("tag2"), 1.0f)
+    };
+
+    NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
+    ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(mockHeightResolution));
+    ON_CALL(terrainListener, ProcessSurfacePointsFromRegionAsync).WillByDefault(
+        [this, mockHeight, &surfaceTags](const AZ::Aabb& inRegion, const AZ::Vector2& stepSize,
+            AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+            [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter,
+            const AzFramework::Terrain::QueryAsyncParams& params)
+        {
+            return ProcessRegionLoopAsync(inRegion, stepSize, perPositionCallback, &surfaceTags, mockHeight, params);
+        }
+    );
+
+    AZStd::vector<AZStd::pair<size_t, size_t>> updatedSamples;
+    auto updateCallback = [&updatedSamples](size_t column, size_t row, const Physics::HeightMaterialPoint& dataPoint)
+    {
+        const float expectedHeightValue = 16384.0f;
+        EXPECT_NEAR(dataPoint.m_height, expectedHeightValue, 0.01f);
+        updatedSamples.emplace_back(column, row);
+    };
+
+    Physics::HeightfieldProviderRequestsBus::Event(
+        m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::UpdateHeightsAndMaterials, updateCallback,
+        AZ::Aabb::CreateFromMinMaxValues(10.0f, 20.0f, 0.0f, 12.0f, 21.0f, 0.0f));
+
+    // The region covers columns 10-12 and rows 20-21.
+    ASSERT_EQ(updatedSamples.size(), 6);
+    for (const auto& [column, row] : updatedSamples)
+    {
+        EXPECT_GE(column, 10);
+        EXPECT_LE(column, 12);
+        EXPECT_GE(row, 20);
+        EXPECT_LE(row, 21);
+    }
+}
+
+TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderOnlyNotifiesForHeightfieldChanges)
+{
+    // Check that terrain changes only notify heightfield listeners when they affect the heightfield.
+    AddTerrainPhysicsColliderToEntity(Terrain::TerrainPhysicsColliderConfig());
+
+    m_entity->Activate();
+
+    NiceMock<UnitTest::MockShapeComponentRequests> boxShape(m_entity->GetId());
+    const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(256.0f));
+    ON_CALL(boxShape, GetEncompassingAabb).WillByDefault(Return(bounds));
+
+    float mockHeightResolution = 1.0f;
+    NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
+    ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(mockHeightResolution));
+
+    const AZ::Aabb dirtyRegion = AZ::Aabb::CreateFromMinMax(AZ::Vector3(10.0f), AZ::Vector3(20.0f));
+
+    NiceMock<UnitTest::MockHeightfieldProviderNotificationBusListener> heightfieldListener(m_entity->GetId());
+
+    // Color changes don't affect the heightfield.
+    EXPECT_CALL(heightfieldListener, OnHeightfieldDataChanged(_)).Times(0);
+    AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
+        &AzFramework::Terrain::TerrainDataNotifications::OnTerrainDataChanged, dirtyRegion,
+        AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::ColorData);
+    ::testing::Mock::VerifyAndClearExpectations(&heightfieldListener);
+
+    AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint());
+    ::testing::Mock::VerifyAndClearExpectations(&heightfieldListener);
+
+    // Height changes get notified on the next tick, with just the XY extents of the dirty regions, so that listeners can
+    // update them in place.
+    EXPECT_CALL(heightfieldListener, OnHeightfieldDataChanged(_)).Times(0);
+    AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
+        &AzFramework::Terrain::TerrainDataNotifications::OnTerrainDataChanged, dirtyRegion,
+        AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+    AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
+        &AzFramework::Terrain::TerrainDataNotifications::OnTerrainDataChanged,
+        AZ::Aabb::CreateFromMinMax(AZ::Vector3(15.0f), AZ::Vector3(30.0f)),
+        AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData);
+    ::testing::Mock::VerifyAndClearExpectations(&heightfieldListener);
+
+    EXPECT_CALL(heightfieldListener, OnHeightfieldDataChanged(_))
+        .WillOnce(
+            [](const AZ::Aabb& heightfieldDirtyRegion)
+            {
+                EXPECT_NEAR(heightfieldDirtyRegion.GetMin().GetX(), 10.0f, 0.001f);
+                EXPECT_NEAR(heightfieldDirtyRegion.GetMax().GetY(), 30.0f, 0.001f);
+            });
+    AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint());
+    ::testing::Mock::VerifyAndClearExpectations(&heightfieldListener);
+
+    // Nothing is left to notify on the following ticks.
+    EXPECT_CALL(heightfieldListener, OnHeightfieldDataChanged(_)).Times(0);
+    AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint());
+}
@@ -13,6 +13,7 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
@@ -31,6 +32,7 @@
 #include <Components/TerrainLayerSpawnerComponent.h>
 #include <Components/TerrainHeightGradientListComponent.h>
 #include <Components/TerrainSurfaceGradientListComponent.h>
+#include <TerrainRenderer/TerrainHeightClipmap.h>
 
 #include <benchmark/benchmark.h>
 
@@ -219,7 +221,8 @@ namespace UnitTest
             AZStd::function<void(
                 float queryResolution,
                 const AZ::Aabb& worldBounds,
-                AzFramework::Terrain::TerrainDataRequests::Sampler sampler)> ApiCaller)
+                AzFramework::Terrain::TerrainDataRequests::Sampler sampler)> ApiCaller,
+            AZ::TaskExecutor* taskExecutor = nullptr)
         {
             // Get the ranges for querying from our benchmark parameters
             float boundsRange = aznumeric_cast<float>(state.range(0));
@@ -265,6 +268,7 @@ namespace UnitTest
 
             // Create the terrain system (do this after creating the terrain layer entity to ensure that we don't need any data refreshes)
             auto terrainSystem = CreateAndActivateTerrainSystem(queryResolution, worldBounds);
+            terrainSystem->SetTaskExecutor(taskExecutor);
 
             // Call the terrain API we're testing for every height and width in our ranges.
             for (auto stateIterator : state)
@@ -372,6 +376,57 @@ namespace UnitTest
         ->Args({ 4096, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
         ->Unit(::benchmark::kMillisecond);
 
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ProcessHeightsRegionAsync)(benchmark::State& state)
+    {
+        // The fourth benchmark parameter is the number of threads and jobs to process the region with.
+        const int32_t numJobs = aznumeric_cast<int32_t>(state.range(3));
+        AZ::TaskExecutor taskExecutor(aznumeric_cast<uint32_t>(numJobs));
+
+        // Run the benchmark
+        RunTerrainApiBenchmark(
+            state,
+            [numJobs]([[maybe_unused]] float queryResolution, const AZ::Aabb& worldBounds,
+                AzFramework::Terrain::TerrainDataRequests::Sampler sampler)
+            {
+                auto perPositionCallback = []([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex,
+                    const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+                {
+                    benchmark::DoNotOptimize(surfacePoint.m_position.GetZ());
+                };
+
+                AzFramework::Terrain::QueryAsyncParams params;
+                params.m_desiredNumberOfJobs = numJobs;
+
+                AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> jobContext;
+                AZ::Vector2 stepSize = AZ::Vector2(queryResolution);
+                AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
+                    jobContext, &AzFramework::Terrain::TerrainDataRequests::ProcessHeightsFromRegionAsync, worldBounds, stepSize,
+                    perPositionCallback, sampler, params);
+
+                // Wait for the query to complete, so that the benchmark measures the whole query.
+                if (jobContext)
+                {
+                    jobContext->Wait();
+                }
+            },
+            &taskExecutor);
+    }
+
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_ProcessHeightsRegionAsync)
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 1 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 2 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 4 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 8 })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 1 })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 2 })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 4 })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 8 })
+        ->Args({ 4096, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 1 })
+        ->Args({ 4096, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 2 })
+        ->Args({ 4096, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 4 })
+        ->Args({ 4096, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 8 })
+        ->Unit(::benchmark::kMillisecond);
+
     BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ProcessHeightsList)(benchmark::State& state)
     {
         // Run the benchmark
@@ -653,6 +708,53 @@ namespace UnitTest
         ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
         ->Unit(::benchmark::kMillisecond);
 
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ProcessSurfacePointsRegionAsync)(benchmark::State& state)
+    {
+        // The fourth benchmark parameter is the number of threads and jobs to process the region with.
+        const int32_t numJobs = aznumeric_cast<int32_t>(state.range(3));
+        AZ::TaskExecutor taskExecutor(aznumeric_cast<uint32_t>(numJobs));
+
+        // Run the benchmark
+        RunTerrainApiBenchmark(
+            state,
+            [numJobs]([[maybe_unused]] float queryResolution, const AZ::Aabb& worldBounds,
+                AzFramework::Terrain::TerrainDataRequests::Sampler sampler)
+            {
+                auto perPositionCallback = []([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex,
+                    const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+                {
+                    benchmark::DoNotOptimize(surfacePoint);
+                };
+
+                AzFramework::Terrain::QueryAsyncParams params;
+                params.m_desiredNumberOfJobs = numJobs;
+
+                AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> jobContext;
+                AZ::Vector2 stepSize = AZ::Vector2(queryResolution);
+                AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
+                    jobContext, &AzFramework::Terrain::TerrainDataRequests::ProcessSurfacePointsFromRegionAsync, worldBounds, stepSize,
+                    perPositionCallback, sampler, params);
+
+                // Wait for the query to complete, so that the benchmark measures the whole query.
+                if (jobContext)
+                {
+                    jobContext->Wait();
+                }
+            },
+            &taskExecutor);
+    }
+
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_ProcessSurfacePointsRegionAsync)
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 1 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 2 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 4 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 8 })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 1 })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 2 })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 4 })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 8 })
+        ->Unit(::benchmark::kMillisecond);
+
     BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ProcessSurfacePointsList)(benchmark::State& state)
     {
         // Run the benchmark
@@ -766,6 +868,55 @@ namespace UnitTest
         ->Args({ 2048, 1000, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
         ->Args({ 4096, 1000, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
         ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_TerrainHeightClipmapFlythrough)(benchmark::State& state)
+    {
+        // Flies a camera around the terrain world and updates a terrain height clipmap at every step, which measures the CPU cost
+        // per frame on the calling thread of keeping the clipmap heights up to date. The height queries themselves run on the
+        // task graph. The clipmap doesn't need a renderer, so this runs without any RHI.
+        // The fourth benchmark parameter is the camera speed in meters per frame.
+        const float cameraSpeed = aznumeric_cast<float>(state.range(3));
+        Terrain::TerrainHeightClipmap clipmap;
+        float pathAngle = 0.0f;
+
+        RunTerrainApiBenchmark(
+            state,
+            [&state, &clipmap, &pathAngle, cameraSpeed](float queryResolution, const AZ::Aabb& worldBounds,
+                [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampler)
+            {
+                // Fly in a circle around the center of the world so that the camera keeps changing direction.
+                const float pathRadius = worldBounds.GetXExtent() * 0.25f;
+                auto getCameraPosition = [&worldBounds, pathRadius](float angle)
+                {
+                    return worldBounds.GetCenter() + AZ::Vector3(cosf(angle) * pathRadius, sinf(angle) * pathRadius, 0.0f);
+                };
+
+                if (!clipmap.IsInitialized())
+                {
+                    // Fill the whole clipmap up front so that only the incremental updates are measured.
+                    state.PauseTiming();
+                    Terrain::TerrainHeightClipmapDescriptor desc;
+                    desc.m_sampleSpacing = queryResolution;
+                    clipmap.Initialize(desc, getCameraPosition(pathAngle));
+                    while (clipmap.HasPendingUpdates())
+                    {
+                        clipmap.Update(getCameraPosition(pathAngle));
+                    }
+                    state.ResumeTiming();
+                }
+
+                pathAngle += cameraSpeed / pathRadius;
+                benchmark::DoNotOptimize(clipmap.Update(getCameraPosition(pathAngle)));
+            });
+    }
+
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_TerrainHeightClipmapFlythrough)
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT), 1 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT), 10 })
+        ->Args({ 4096, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT), 1 })
+        ->Args({ 4096, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT), 10 })
+        ->Args({ 4096, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT), 50 })
+        ->Unit(::benchmark::kMicrosecond);
 #endif
 
 }
@@ -8,6 +8,8 @@
 
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Memory/MemoryComponent.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/parallel/atomic.h>
 
 #include <AzTest/AzTest.h>
 
@@ -158,6 +160,17 @@ namespace UnitTest
                         // Let the test function modify these values based on the needs of the specific test.
                         mockHeights(outPosition, terrainExists);
                     });
+            ON_CALL(*m_terrainAreaHeightRequests, GetHeights)
+                .WillByDefault(
+                    [mockHeights](AZStd::span<AZ::Vector3> inOutPositionList, AZStd::span<bool> terrainExistsList)
+                    {
+                        for (size_t index = 0; index < inOutPositionList.size(); index++)
+                        {
+                            bool terrainExists = true;
+                            mockHeights(inOutPositionList[index], terrainExists);
+                            terrainExistsList[index] = terrainExists;
+                        }
+                    });
 
             ActivateEntity(entity.get());
             return entity;
@@ -185,7 +198,7 @@ namespace UnitTest
             expectedTags.push_back(tagWeight3);
 
             m_terrainAreaSurfaceRequests = AZStd::make_unique<NiceMock<UnitTest::MockTerrainAreaSurfaceRequestBus>>(entity->GetId());
-            ON_CALL(*m_terrainAreaSurfaceRequests, GetSurfaceWeights).WillByDefault(
+            auto mockSurfaceWeights =
                 [tagWeight1, tagWeight2, tagWeight3](const AZ::Vector3& position, AzFramework::SurfaceData::SurfaceTagWeightList& surfaceWeights)
                 {
                     surfaceWeights.clear();
@@ -202,6 +215,17 @@ namespace UnitTest
                     {
                         surfaceWeights.push_back(tagWeight3);
                     }
+                };
+            ON_CALL(*m_terrainAreaSurfaceRequests, GetSurfaceWeights).WillByDefault(mockSurfaceWeights);
+            ON_CALL(*m_terrainAreaSurfaceRequests, GetSurfaceWeightsFromList).WillByDefault(
+                [mockSurfaceWeights](
+                    AZStd::span<const AZ::Vector3> inPositionList,
+                    AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList)
+                {
+                    for (size_t index = 0; index < inPositionList.size(); index++)
+                    {
+                        mockSurfaceWeights(inPositionList[index], outSurfaceWeightsList[index]);
+                    }
                 }
             );
         }
@@ -1037,4 +1061,339 @@ namespace UnitTest
 
         terrainSystem->ProcessSurfacePointsFromRegion(testRegionBox, stepSize, perPositionCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
     }
+
+    TEST_F(TerrainSystemTest, TerrainProcessSurfacePointsFromRegionAsyncMatchesSynchronousQuery)
+    {
+        // Verify that the asynchronous region query reports the same data for every position as the synchronous region query,
+        // when the region is split into multiple tiles that get processed on multiple threads.
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-64.0f, -64.0f, -5.0f, 64.0f, 64.0f, 15.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ((position.GetX() * 0.1f) + (position.GetY() * 0.05f));
+                terrainExists = true;
+            });
+
+        AzFramework::SurfaceData::SurfaceTagWeightList expectedTags;
+        SetupSurfaceWeightMocks(entity.get(), expectedTags);
+
+        // The task executor is created before the terrain system, so that it outlives any queries the terrain system has in flight.
+        AZ::TaskExecutor taskExecutor(4);
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+        terrainSystem->SetTaskExecutor(&taskExecutor);
+
+        const AZ::Aabb testRegionBox = AZ::Aabb::CreateFromMinMaxValues(-48.0f, -48.0f, -1.0f, 48.0f, 48.0f, 1.0f);
+        const AZ::Vector2 stepSize(0.5f);
+        const size_t numSamplesX = aznumeric_cast<size_t>(testRegionBox.GetExtents().GetX() / stepSize.GetX());
+        const size_t numSamplesY = aznumeric_cast<size_t>(testRegionBox.GetExtents().GetY() / stepSize.GetY());
+        ASSERT_GT(numSamplesX * numSamplesY, Terrain::TerrainSystem::RegionQueryTileSize * 4);
+
+        AZStd::vector<AzFramework::SurfaceData::SurfacePoint> expectedPoints(numSamplesX * numSamplesY);
+        AZStd::vector<bool> expectedExists(numSamplesX * numSamplesY, false);
+        terrainSystem->ProcessSurfacePointsFromRegion(
+            testRegionBox, stepSize,
+            [&](size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+            {
+                expectedPoints[(yIndex * numSamplesX) + xIndex] = surfacePoint;
+                expectedExists[(yIndex * numSamplesX) + xIndex] = terrainExists;
+            },
+            AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
+
+        // Every position is written by exactly one task, so the results can be stored without locking.
+        AZStd::vector<AzFramework::SurfaceData::SurfacePoint> asyncPoints(numSamplesX * numSamplesY);
+        AZStd::vector<char> asyncExists(numSamplesX * numSamplesY, 0);
+        AZStd::atomic<size_t> numCompletionCallbacks{ 0 };
+
+        AzFramework::Terrain::QueryAsyncParams params;
+        params.m_desiredNumberOfJobs = 4;
+        params.m_completionCallback = [&numCompletionCallbacks](AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>)
+        {
+            numCompletionCallbacks++;
+        };
+
+        auto jobContext = terrainSystem->ProcessSurfacePointsFromRegionAsync(
+            testRegionBox, stepSize,
+            [&](size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+            {
+                asyncPoints[(yIndex * numSamplesX) + xIndex] = surfacePoint;
+                asyncExists[(yIndex * numSamplesX) + xIndex] = terrainExists ? 1 : 2;
+            },
+            AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR, params);
+        ASSERT_NE(jobContext, nullptr);
+        jobContext->Wait();
+
+        EXPECT_TRUE(jobContext->IsComplete());
+        EXPECT_FALSE(jobContext->IsCancelled());
+        EXPECT_EQ(numCompletionCallbacks, 1);
+
+        for (size_t index = 0; index < expectedPoints.size(); index++)
+        {
+            // We use ASSERT instead of EXPECT because if one value doesn't match, they probably all won't.
+            ASSERT_NE(asyncExists[index], 0);
+            ASSERT_EQ(asyncExists[index] == 1, expectedExists[index]);
+            ASSERT_TRUE(asyncPoints[index].m_position.IsClose(expectedPoints[index].m_position));
+            ASSERT_TRUE(asyncPoints[index].m_normal.IsClose(expectedPoints[index].m_normal));
+            ASSERT_EQ(asyncPoints[index].m_surfaceTags.size(), expectedPoints[index].m_surfaceTags.size());
+            ASSERT_EQ(asyncPoints[index].m_surfaceTags[0].m_surfaceType, expectedPoints[index].m_surfaceTags[0].m_surfaceType);
+        }
+    }
+
+    TEST_F(TerrainSystemTest, TerrainProcessHeightsFromRegionAsyncCanBeCancelled)
+    {
+        // Verify that a cancelled asynchronous query still completes and calls its completion callback exactly once,
+        // and that it never reports more positions than the region contains.
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-64.0f, -64.0f, -5.0f, 64.0f, 64.0f, 15.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(1.0f);
+                terrainExists = true;
+            });
+
+        AZ::TaskExecutor taskExecutor(2);
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+        terrainSystem->SetTaskExecutor(&taskExecutor);
+
+        const AZ::Aabb testRegionBox = AZ::Aabb::CreateFromMinMaxValues(-64.0f, -64.0f, -1.0f, 64.0f, 64.0f, 1.0f);
+        const AZ::Vector2 stepSize(0.25f);
+        const size_t numSamples = aznumeric_cast<size_t>(testRegionBox.GetExtents().GetX() / stepSize.GetX()) *
+            aznumeric_cast<size_t>(testRegionBox.GetExtents().GetY() / stepSize.GetY());
+
+        AZStd::atomic<size_t> numPositions{ 0 };
+        AZStd::atomic<size_t> numCompletionCallbacks{ 0 };
+
+        AzFramework::Terrain::QueryAsyncParams params;
+        params.m_desiredNumberOfJobs = 2;
+        params.m_completionCallback =
+            [&numCompletionCallbacks](AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> jobContext)
+        {
+            EXPECT_TRUE(jobContext->IsCancelled());
+            numCompletionCallbacks++;
+        };
+
+        auto jobContext = terrainSystem->ProcessHeightsFromRegionAsync(
+            testRegionBox, stepSize,
+            [&numPositions](size_t, size_t, const AzFramework::SurfaceData::SurfacePoint&, bool)
+            {
+                numPositions++;
+            },
+            AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT, params);
+        jobContext->Cancel();
+        jobContext->Wait();
+
+        EXPECT_TRUE(jobContext->IsComplete());
+        EXPECT_EQ(numCompletionCallbacks, 1);
+        EXPECT_LE(numPositions, numSamples);
+
+        // Queries that are still in flight when the terrain system deactivates get cancelled and waited on.
+        auto deactivatedJobContext = terrainSystem->ProcessHeightsFromRegionAsync(
+            testRegionBox, stepSize,
+            [](size_t, size_t, const AzFramework::SurfaceData::SurfacePoint&, bool)
+            {
+            },
+            AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+        terrainSystem->Deactivate();
+        EXPECT_TRUE(deactivatedJobContext->IsComplete());
+
+        // Queries submitted after the cancellation don't process anything, but still complete and call their completion callback.
+        numPositions = 0;
+        numCompletionCallbacks = 0;
+        auto lateJobContext = terrainSystem->ProcessHeightsFromRegionAsync(
+            testRegionBox, stepSize,
+            [&numPositions](size_t, size_t, const AzFramework::SurfaceData::SurfacePoint&, bool)
+            {
+                numPositions++;
+            },
+            AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT, params);
+        EXPECT_TRUE(lateJobContext->IsCancelled());
+        EXPECT_TRUE(lateJobContext->IsComplete());
+        EXPECT_EQ(numCompletionCallbacks, 1);
+        EXPECT_EQ(numPositions, 0);
+    }
+
+    TEST_F(TerrainSystemTest, TerrainHeightQueriesWithTileCacheMatchUncachedQueries)
+    {
+        // Verify that the heights and normals served from the tile cache are bit-identical to the uncached queries, for all samplers.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-20.0f, -20.0f, -20.0f, 20.0f, 20.0f, 20.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ((sinf(position.GetX() * 0.37f) * cosf(position.GetY() * 0.21f) * 10.0f) + (position.GetX() * 0.1f));
+                terrainExists = true;
+            });
+
+        // Use a query resolution that isn't a power of 2, so that neighboring grid squares don't always share their corner positions.
+        const float queryResolution = 0.3f;
+        auto terrainSystem = CreateAndActivateTerrainSystem(queryResolution);
+
+        // Query positions on the grid points as well as in-between them, across several tiles.
+        AZStd::vector<AZ::Vector3> positions;
+        for (int32_t y = -40; y < 40; y += 3)
+        {
+            for (int32_t x = -40; x < 40; x += 3)
+            {
+                const AZ::Vector2 gridPosition = AZ::Vector2(aznumeric_cast<float>(x), aznumeric_cast<float>(y)) * queryResolution;
+                positions.emplace_back(gridPosition.GetX(), gridPosition.GetY(), 0.0f);
+                positions.emplace_back(gridPosition.GetX() + 0.17f, gridPosition.GetY() + 0.09f, 0.0f);
+            }
+        }
+
+        const AzFramework::Terrain::TerrainDataRequests::Sampler samplers[] = {
+            AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT
+        };
+
+        for (auto sampler : samplers)
+        {
+            terrainSystem->SetTileCacheMemoryBudget(0);
+
+            AZStd::vector<float> uncachedHeights;
+            AZStd::vector<AZ::Vector3> uncachedNormals;
+            for (const auto& position : positions)
+            {
+                uncachedHeights.push_back(terrainSystem->GetHeight(position, sampler));
+                uncachedNormals.push_back(terrainSystem->GetNormal(position, sampler));
+            }
+
+            terrainSystem->SetTileCacheMemoryBudget(32 * 1024 * 1024);
+
+            // Query twice, so that the first pass fills the cache and the second pass is served from it.
+            for (int pass = 0; pass < 2; pass++)
+            {
+                for (size_t index = 0; index < positions.size(); index++)
+                {
+                    EXPECT_EQ(terrainSystem->GetHeight(positions[index], sampler), uncachedHeights[index]);
+                    EXPECT_EQ(terrainSystem->GetNormal(positions[index], sampler), uncachedNormals[index]);
+                }
+            }
+        }
+
+        EXPECT_GT(terrainSystem->GetTileCacheStatistics().m_hits, 0);
+    }
+
+    TEST_F(TerrainSystemTest, TerrainTileCacheIsInvalidatedWhenTerrainAreaChanges)
+    {
+        // Verify that refreshing a terrain area drops the cached heights within it.
+
+        auto heightOffset = AZStd::make_shared<float>(0.0f);
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [heightOffset](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(position.GetX() + position.GetY() + *heightOffset);
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        const AZ::Vector3 position(2.5f, 3.25f, 0.0f);
+        constexpr float epsilon = 0.0001f;
+        EXPECT_NEAR(terrainSystem->GetHeight(position, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 5.75f, epsilon);
+
+        // Without a refresh, the cached heights are still used.
+        *heightOffset = 2.0f;
+        EXPECT_NEAR(terrainSystem->GetHeight(position, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 5.75f, epsilon);
+        EXPECT_GT(terrainSystem->GetTileCacheStatistics().m_hits, 0);
+
+        terrainSystem->RefreshArea(entity->GetId(), AzFramework::Terrain::TerrainDataNotifications::HeightData);
+        EXPECT_NEAR(terrainSystem->GetHeight(position, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 7.75f, epsilon);
+        EXPECT_GT(terrainSystem->GetTileCacheStatistics().m_invalidations, 0);
+    }
+
+    TEST_F(TerrainSystemTest, TerrainTileCacheMissesDuringTileCreationQueryDirectly)
+    {
+        // Verify that a query that misses a tile while that tile is being created, here a recursive query from the area provider,
+        // gets answered with a direct query instead of creating the same tile again.
+
+        auto terrainSystemPtr = AZStd::make_shared<Terrain::TerrainSystem*>(nullptr);
+        auto nestedQueryDone = AZStd::make_shared<bool>(false);
+        auto nestedHeight = AZStd::make_shared<float>(0.0f);
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [terrainSystemPtr, nestedQueryDone, nestedHeight](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(position.GetX() + position.GetY());
+                terrainExists = true;
+
+                if (*terrainSystemPtr && !*nestedQueryDone)
+                {
+                    *nestedQueryDone = true;
+                    *nestedHeight = (*terrainSystemPtr)->GetHeight(
+                        AZ::Vector3(1.0f, 2.0f, 0.0f), AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
+                }
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+        *terrainSystemPtr = terrainSystem.get();
+
+        constexpr float epsilon = 0.0001f;
+        const auto sampler = AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR;
+        EXPECT_NEAR(terrainSystem->GetHeight(AZ::Vector3(2.5f, 3.25f, 0.0f), sampler), 5.75f, epsilon);
+        EXPECT_TRUE(*nestedQueryDone);
+        EXPECT_NEAR(*nestedHeight, 3.0f, epsilon);
+        EXPECT_EQ(terrainSystem->GetTileCacheStatistics().m_concurrentMisses, 1);
+
+        // The tile got added once its creation completed.
+        EXPECT_NEAR(terrainSystem->GetHeight(AZ::Vector3(1.0f, 2.0f, 0.0f), sampler), 3.0f, epsilon);
+        EXPECT_GT(terrainSystem->GetTileCacheStatistics().m_hits, 0);
+    }
+
+    TEST_F(TerrainSystemTest, TerrainSurfaceWeightQueriesWithTileCacheMatchUncachedQueries)
+    {
+        // Verify that the surface weights on the query grid points are served from the tile cache with the same results.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(1.0f);
+                terrainExists = true;
+            });
+
+        AzFramework::SurfaceData::SurfaceTagWeightList expectedTags;
+        SetupSurfaceWeightMocks(entity.get(), expectedTags);
+
+        const float queryResolution = 0.5f;
+        auto terrainSystem = CreateAndActivateTerrainSystem(queryResolution);
+
+        AZStd::vector<AZ::Vector3> positions;
+        for (float y = -4.0f; y < 4.0f; y += queryResolution)
+        {
+            positions.emplace_back(0.0f, y, 0.0f);
+            positions.emplace_back(0.25f, y + 0.25f, 0.0f);
+        }
+
+        terrainSystem->SetTileCacheMemoryBudget(0);
+        AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> uncachedWeights(positions.size());
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            terrainSystem->GetSurfaceWeights(positions[index], uncachedWeights[index]);
+        }
+
+        terrainSystem->SetTileCacheMemoryBudget(32 * 1024 * 1024);
+        for (int pass = 0; pass < 2; pass++)
+        {
+            for (size_t index = 0; index < positions.size(); index++)
+            {
+                AzFramework::SurfaceData::SurfaceTagWeightList surfaceWeights;
+                terrainSystem->GetSurfaceWeights(positions[index], surfaceWeights);
+                ASSERT_EQ(surfaceWeights.size(), uncachedWeights[index].size());
+                for (size_t weightIndex = 0; weightIndex < surfaceWeights.size(); weightIndex++)
+                {
+                    EXPECT_EQ(surfaceWeights[weightIndex].m_surfaceType, uncachedWeights[index][weightIndex].m_surfaceType);
+                    EXPECT_EQ(surfaceWeights[weightIndex].m_weight, uncachedWeights[index][weightIndex].m_weight);
+                }
+            }
+        }
+
+        EXPECT_GT(terrainSystem->GetTileCacheStatistics().m_hits, 0);
+    }
 } // namespace UnitTest
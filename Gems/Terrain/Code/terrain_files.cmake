@@ -47,6 +47,8 @@ set(FILES
     Source/TerrainRenderer/TerrainFeatureProcessor.h
     Source/TerrainRenderer/TerrainDetailMaterialManager.cpp
     Source/TerrainRenderer/TerrainDetailMaterialManager.h
+    Source/TerrainRenderer/TerrainHeightClipmap.cpp
+    Source/TerrainRenderer/TerrainHeightClipmap.h
     Source/TerrainRenderer/TerrainMacroMaterialManager.cpp
     Source/TerrainRenderer/TerrainMacroMaterialManager.h
     Source/TerrainRenderer/TerrainMeshManager.cpp
@@ -59,4 +61,6 @@ set(FILES
     Source/TerrainSystem/TerrainSystem.cpp
     Source/TerrainSystem/TerrainSystem.h
     Source/TerrainSystem/TerrainSystemBus.h
+    Source/TerrainSystem/TerrainTileCache.cpp
+    Source/TerrainSystem/TerrainTileCache.h
 )
@@ -10,6 +10,7 @@ set(FILES
     Tests/ClipmapBoundsTests.cpp
     Tests/LayerSpawnerTests.cpp
     Tests/MockAxisAlignedBoxShapeComponent.h
+    Tests/TerrainHeightClipmapTests.cpp
     Tests/TerrainHeightGradientListTests.cpp
     Tests/TerrainMacroMaterialTests.cpp
     Tests/SurfaceMaterialsListTest.cpp
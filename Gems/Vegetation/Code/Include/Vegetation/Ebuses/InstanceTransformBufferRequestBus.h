@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/Math/Aabb.h>
+#include <Vegetation/InstanceTransformBuffers.h>
+
+namespace Vegetation
+{
+    class InstanceSpawner;
+
+    //! Called once per sector with the spawner that placed the instances and the buffers of the sector.
+    using InstanceTransformBufferSpawnerCallback =
+        AZStd::function<AreaSystemEnumerateCallbackResult(const InstanceSpawner&, const InstanceTransformBufferView&)>;
+
+    /**
+    * A bus to query the instances of the spawners that write their instances into transform buffers instead of creating entities.
+    * Every spawner that is registered with the vegetation system connects to this bus, so renderers and physics can
+    * find all of the placed instances within a region without knowing about the individual spawners.
+    */
+    class InstanceTransformBufferRequests
+        : public AZ::EBusTraits
+    {
+    public:
+        ////////////////////////////////////////////////////////////////////////
+        // EBusTraits
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using MutexType = AZStd::recursive_mutex;
+        ////////////////////////////////////////////////////////////////////////
+
+        virtual ~InstanceTransformBufferRequests() = default;
+
+        //! Visit the instance buffers of every sector that overlaps the given bounds until the callback decides otherwise.
+        //! The sector buffers can't change while the callback runs, so the callback should copy out what it needs and return quickly.
+        //! @param bounds The AABB to find overlapping sectors for. If the AABB is invalid, every sector gets visited.
+        //! @param callback The function to call for every sector found
+        virtual void EnumerateInstanceTransformBuffers(const AZ::Aabb& bounds, const InstanceTransformBufferSpawnerCallback& callback) const = 0;
+
+        //! Add the number of instances and the number of bytes used to store them to the given totals, so that the totals
+        //! of all the spawners can be gathered with a single broadcast.
+        virtual void GetInstanceTransformBufferStats(size_t& instanceCount, size_t& memoryUsage) const = 0;
+    };
+
+    using InstanceTransformBufferRequestBus = AZ::EBus<InstanceTransformBufferRequests>;
+
+} // namespace Vegetation
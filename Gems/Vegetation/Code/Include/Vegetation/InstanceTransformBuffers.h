@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <Vegetation/Ebuses/AreaSystemRequestBus.h>
+
+namespace Vegetation
+{
+    /**
+    * A read-only view of the instance transforms of one sector, stored as separate arrays per component.
+    * All of the arrays have one entry per instance, in the same order.
+    */
+    struct InstanceTransformBufferView
+    {
+        AZ::Aabb m_sectorBounds = AZ::Aabb::CreateNull();
+        AZStd::span<const float> m_positionsX;
+        AZStd::span<const float> m_positionsY;
+        AZStd::span<const float> m_positionsZ;
+        AZStd::span<const AZ::Quaternion> m_rotations;
+        AZStd::span<const float> m_scales;
+
+        size_t GetInstanceCount() const { return m_scales.size(); }
+    };
+
+    using InstanceTransformBufferEnumerateCallback = AZStd::function<AreaSystemEnumerateCallbackResult(const InstanceTransformBufferView&)>;
+
+    /**
+    * Stores the transforms of lightweight vegetation instances in per-sector buffers, without creating any entities.
+    * Every sector keeps the positions, rotations and scales of its instances in separate, densely packed arrays, so that
+    * renderers and physics can consume whole sectors at a time. Instances are removed by swapping the last instance of
+    * the sector into their place, so the arrays never have holes. The handle of an instance stays valid until it gets removed.
+    * All of the methods are thread-safe. Instances get added and removed from the main thread by the vegetation system,
+    * while the buffers can be enumerated from any thread.
+    */
+    class InstanceTransformBuffers final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(InstanceTransformBuffers, AZ::SystemAllocator, 0);
+
+        using Handle = AZ::u32;
+        static constexpr Handle InvalidHandle = AZStd::numeric_limits<Handle>::max();
+
+        explicit InstanceTransformBuffers(float sectorSizeInMeters = 16.0f);
+        ~InstanceTransformBuffers() = default;
+
+        //! Change the size of the sectors that the instances get grouped into. This removes all of the instances.
+        void SetSectorSize(float sectorSizeInMeters);
+        float GetSectorSize() const;
+
+        //! Add an instance to the sector that contains its position, and return its handle.
+        Handle AddInstance(const AZ::Vector3& position, const AZ::Quaternion& rotation, float scale);
+
+        //! Remove an instance that was previously added.
+        void RemoveInstance(Handle handle);
+
+        //! Remove all of the instances and release the memory of the buffers.
+        void Clear();
+
+        //! Visit the buffers of every sector that overlaps the given bounds and contains instances, until the callback decides
+        //! otherwise. The buffers are locked for reading while the callback runs, so the callback must not add or remove instances.
+        //! @param bounds The AABB to find overlapping sectors for. If the AABB is invalid, every sector gets visited.
+        //! @param callback The function to call for every sector found
+        void EnumerateSectors(const AZ::Aabb& bounds, const InstanceTransformBufferEnumerateCallback& callback) const;
+
+        size_t GetInstanceCount() const;
+        size_t GetSectorCount() const;
+
+        //! The number of bytes that are allocated for the buffers and the instance bookkeeping.
+        size_t GetMemoryUsage() const;
+
+    private:
+        using SectorKey = AZ::u64;
+
+        struct Sector
+        {
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+            AZStd::vector<float> m_positionsX;
+            AZStd::vector<float> m_positionsY;
+            AZStd::vector<float> m_positionsZ;
+            AZStd::vector<AZ::Quaternion> m_rotations;
+            AZStd::vector<float> m_scales;
+
+            //! The handle of every instance, so that the handle of a moved instance can be updated on removal.
+            AZStd::vector<Handle> m_handles;
+
+            size_t GetMemoryUsage() const;
+        };
+
+        //! Every handle is an index into the list of slots. Each slot refers to the sector and index of its instance,
+        //! or holds the next free slot if the handle isn't in use.
+        struct Slot
+        {
+            Sector* m_sector = nullptr;
+            AZ::u32 m_index = 0;
+        };
+
+        static SectorKey MakeSectorKey(AZ::s32 sectorX, AZ::s32 sectorY);
+        Sector& GetOrCreateSector(SectorKey key, AZ::s32 sectorX, AZ::s32 sectorY);
+        void ClearInternal();
+
+        mutable AZStd::shared_mutex m_bufferMutex;
+        float m_sectorSizeInMeters = 16.0f;
+        float m_worldToSector = 1.0f / 16.0f;
+        AZStd::unordered_map<SectorKey, Sector> m_sectors;
+        AZStd::vector<Slot> m_slots;
+        Handle m_firstFreeSlot = InvalidHandle;
+        size_t m_instanceCount = 0;
+    };
+} // namespace Vegetation
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Vegetation/InstanceSpawner.h>
+#include <Vegetation/InstanceTransformBuffers.h>
+#include <Vegetation/Ebuses/InstanceTransformBufferRequestBus.h>
+
+namespace Vegetation
+{
+    /**
+    * Instance spawner of lightweight instances, such as grass and rocks.
+    * Instead of creating entities, the placed instances are written into per-sector transform buffers, which renderers and
+    * physics can query through the InstanceTransformBufferRequestBus.
+    */
+    class TransformBufferInstanceSpawner
+        : public InstanceSpawner
+        , private InstanceTransformBufferRequestBus::Handler
+    {
+    public:
+        AZ_RTTI(TransformBufferInstanceSpawner, "{6C0B7E53-4E9D-4E0B-9A4C-2A38C6F4D7E1}", InstanceSpawner);
+        AZ_CLASS_ALLOCATOR(TransformBufferInstanceSpawner, AZ::SystemAllocator, 0);
+        static void Reflect(AZ::ReflectContext* context);
+
+        TransformBufferInstanceSpawner() = default;
+        virtual ~TransformBufferInstanceSpawner();
+
+        //! Start loading any assets that the spawner will need.
+        void LoadAssets() override { NotifyOnAssetsLoaded(); }
+
+        //! Unload any assets that the spawner loaded.
+        void UnloadAssets() override { NotifyOnAssetsUnloaded(); }
+
+        //! Perform any extra initialization needed at the point of registering with the vegetation system.
+        void OnRegisterUniqueDescriptor() override;
+
+        //! Perform any extra cleanup needed at the point of unregistering with the vegetation system.
+        void OnReleaseUniqueDescriptor() override;
+
+        //! Does this exist but have empty asset references?
+        bool HasEmptyAssetReferences() const override { return false; }
+
+        //! Has this finished loading any assets that are needed?
+        bool IsLoaded() const override { return true; }
+
+        //! Are the assets loaded, initialized, and spawnable?
+        bool IsSpawnable() const override { return true; }
+
+        //! Display name of the instances that will be spawned.
+        AZStd::string GetName() const override;
+
+        //! Create a single instance.
+        InstancePtr CreateInstance(const InstanceData& instanceData) override;
+
+        //! Destroy a single instance.
+        void DestroyInstance(InstanceId id, InstancePtr instance) override;
+
+        //! The name that renderers and physics use to identify the kind of instances in the buffers, such as a grass type.
+        AZStd::string GetBufferName() const;
+        void SetBufferName(const AZStd::string& bufferName);
+
+        float GetSectorSizeInMeters() const;
+        void SetSectorSizeInMeters(float sectorSizeInMeters);
+
+        const InstanceTransformBuffers& GetInstanceTransformBuffers() const { return m_buffers; }
+
+    private:
+        bool DataIsEquivalent(const InstanceSpawner& rhs) const override;
+
+        AZ::u32 SectorSizeChanged();
+
+        //////////////////////////////////////////////////////////////////////////
+        // InstanceTransformBufferRequestBus
+        void EnumerateInstanceTransformBuffers(const AZ::Aabb& bounds, const InstanceTransformBufferSpawnerCallback& callback) const override;
+        void GetInstanceTransformBufferStats(size_t& instanceCount, size_t& memoryUsage) const override;
+
+        AZStd::string m_bufferName;
+
+        //! The size of the sectors that the instances are grouped into.
+        float m_sectorSizeInMeters = 16.0f;
+
+        //! The number of unique descriptors that this spawner is registered with.
+        AZ::u32 m_registrationCount = 0;
+
+        InstanceTransformBuffers m_buffers;
+    };
+
+} // namespace Vegetation
@@ -19,10 +19,12 @@
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/utils.h>
@@ -1070,22 +1072,66 @@ namespace Vegetation
         return itSector != m_sectorRollingWindow.end() ? &itSector->second : nullptr;
     }
 
-    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::AddSector(SectorInfo&& sectorInfo)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        SectorInfo sectorInfo;
-        sectorInfo.m_id = sectorId;
-        sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
-        UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
         UpdateSectorCallbacks(sectorInfoRef);
         return &sectorInfoRef;
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    void AreaSystemComponent::VegetationThreadTasks::UpdateSectorPoints(
+        AZStd::span<SectorInfo> sectors, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        if (m_sectorSurfacePoints.size() < sectors.size())
+        {
+            m_sectorSurfacePoints.resize(sectors.size());
+        }
+
+        // The surface data system is thread-safe, and it doesn't hold its registration lock while calling into the surface
+        // providers and modifiers, so the tasks query it directly instead of serializing all of the queries on the request bus mutex.
+        const SurfaceData::SurfaceDataSystemRequests* surfaceDataSystem = SurfaceData::SurfaceDataSystemRequestBus::FindFirstHandler();
+
+        auto updateSector = [this, sectors, sectorDensity, sectorSizeInMeters, sectorPointSnapMode, surfaceDataSystem](size_t index)
+        {
+            UpdateSectorPoints(
+                sectors[index], sectorDensity, sectorSizeInMeters, sectorPointSnapMode, surfaceDataSystem, m_sectorSurfacePoints[index]);
+        };
+
+        auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if ((sectors.size() > 1) && taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            static const AZ::TaskDescriptor updateSectorPointsTaskDescriptor{ "Vegetation::AreaSystemComponent::UpdateSectorPoints",
+                                                                              "Vegetation" };
+            AZ::TaskGraph updateSectorPointsTaskGraph;
+            for (size_t index = 0; index < sectors.size(); ++index)
+            {
+                updateSectorPointsTaskGraph.AddTask(updateSectorPointsTaskDescriptor, [&updateSector, index]()
+                {
+                    updateSector(index);
+                });
+            }
+
+            AZ::TaskGraphEvent updateSectorPointsTaskGraphEvent;
+            updateSectorPointsTaskGraph.Submit(&updateSectorPointsTaskGraphEvent);
+            updateSectorPointsTaskGraphEvent.Wait();
+        }
+        else
+        {
+            for (size_t index = 0; index < sectors.size(); ++index)
+            {
+                updateSector(index);
+            }
+        }
+    }
+
+    void AreaSystemComponent::VegetationThreadTasks::UpdateSectorPoints(
+        SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode,
+        const SurfaceData::SurfaceDataSystemRequests* surfaceDataSystem, SurfaceData::PackedSurfacePointList& surfacePoints) const
     {
         AZ_PROFILE_FUNCTION(Entity);
         const float vegStep = sectorSizeInMeters / static_cast<float>(sectorDensity);
@@ -1099,7 +1145,6 @@ namespace Vegetation
         // 0 = lower left corner, 0.5 = center
         const float texelOffset = (sectorPointSnapMode == SnapMode::Center) ? 0.5f : 0.0f;
 
-        SurfaceData::SurfacePointLists availablePointsPerPosition;
         AZ::Vector2 stepSize(vegStep, vegStep);
         AZ::Vector3 regionOffset(texelOffset * vegStep, texelOffset * vegStep, 0.0f);
         AZ::Aabb regionBounds = sectorInfo.m_bounds;
@@ -1113,29 +1158,34 @@ namespace Vegetation
         regionBounds.SetMax(regionBounds.GetMin() + AZ::Vector3(vegStep * (sectorDensity - 0.5f),
             vegStep * (sectorDensity - 0.5f), 0.0f));
 
-        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
-            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
-            regionBounds,
-            stepSize,
-            SurfaceData::SurfaceTagVector(),
-            availablePointsPerPosition);
+        if (surfaceDataSystem)
+        {
+            surfaceDataSystem->GetPackedSurfacePointsFromRegion(regionBounds, stepSize, SurfaceData::SurfaceTagVector(), surfacePoints);
+        }
+        else
+        {
+            surfacePoints.Clear();
+        }
 
-        AZ_Assert(availablePointsPerPosition.size() == (sectorDensity * sectorDensity),
-            "Veg sector ended up with unexpected density (%d points created, %d expected)", availablePointsPerPosition.size(),
+        AZ_Assert(surfacePoints.GetInputPositionCount() == (sectorDensity * sectorDensity),
+            "Veg sector ended up with unexpected density (%d points created, %d expected)", surfacePoints.GetInputPositionCount(),
             (sectorDensity * sectorDensity));
 
         uint claimIndex = 0;
-        for (auto& availablePoints : availablePointsPerPosition)
+        for (size_t inputIndex = 0; inputIndex < surfacePoints.GetInputPositionCount(); ++inputIndex)
         {
-            for (auto& surfacePoint : availablePoints)
+            for (size_t pointIndex = surfacePoints.GetPointBegin(inputIndex); pointIndex < surfacePoints.GetPointEnd(inputIndex); ++pointIndex)
             {
                 sectorInfo.m_baseContext.m_availablePoints.push_back();
                 ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.back();
                 claimPoint.m_handle = CreateClaimHandle(sectorInfo, ++claimIndex);
-                claimPoint.m_position = surfacePoint.m_position;
-                claimPoint.m_normal = surfacePoint.m_normal;
-                claimPoint.m_masks = surfacePoint.m_masks;
-                SurfaceData::AddMaxValueForMasks(sectorInfo.m_baseContext.m_masks, surfacePoint.m_masks);
+                claimPoint.m_position = surfacePoints.GetPositions()[pointIndex];
+                claimPoint.m_normal = surfacePoints.GetNormals()[pointIndex];
+                for (const auto& tagWeight : surfacePoints.GetTagWeights(pointIndex))
+                {
+                    claimPoint.m_masks[tagWeight.m_tag] = tagWeight.m_weight;
+                    SurfaceData::AddMaxValueForMasks(sectorInfo.m_baseContext.m_masks, tagWeight.m_tag, tagWeight.m_weight);
+                }
             }
         }
     }
@@ -1492,7 +1542,7 @@ namespace Vegetation
 
             if (keepProcessing)
             {
-                keepProcessing = UpdateOneSector(threadData, vegTasks);
+                keepProcessing = UpdateSectorBatch(threadData, vegTasks);
             }
         }
     }
@@ -1757,21 +1807,23 @@ namespace Vegetation
         return !m_deleteWorkList.empty() || !m_updateWorkList.empty();
     }
 
-    bool AreaSystemComponent::UpdateContext::UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
+    bool AreaSystemComponent::UpdateContext::UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
         // This chooses work in the following order:
         // 1) Delete if we have more sectors than the total that should be in the view rectangle
-        // 2) Create/update if we have any sectors to create / update
+        // 2) Create/update a batch of sectors if we have any sectors to create / update
         // 3) Delete if we have any sectors to delete
 
         // Delete if there are more active sectors than the number of desired sectors or the update list is empty.
+        size_t activeSectorCount = 0;
         if (!m_deleteWorkList.empty())
         {
             AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
 
-            if ((vegTasks->m_sectorRollingWindow.size() > m_viewRectSectorCount) || m_updateWorkList.empty())
+            activeSectorCount = vegTasks->m_sectorRollingWindow.size();
+            if ((activeSectorCount > m_viewRectSectorCount) || m_updateWorkList.empty())
             {
                 vegTasks->DeleteSector(m_deleteWorkList.back());
                 m_deleteWorkList.pop_back();
@@ -1782,17 +1834,63 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
-            auto& updateEntry = m_updateWorkList.back();
-            SectorId sectorId = updateEntry.first;
-            UpdateMode mode = updateEntry.second;
-            m_updateWorkList.pop_back();
+            auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+            auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+            auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
 
+            // Take the closest sectors off the end of the work list.  While there are still sectors to delete, stop adding creates
+            // to the batch once they would take us above the number of sectors in the view rectangle, so that deletes and creates
+            // stay balanced like they are when processing one sector at a time.
+            m_sectorBatch.clear();
+            size_t createCount = 0;
+            while (!m_updateWorkList.empty() && (m_sectorBatch.size() < MaxSectorBatchSize))
             {
-                AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+                if (m_updateWorkList.back().second == UpdateMode::Create)
+                {
+                    if (!m_sectorBatch.empty() && !m_deleteWorkList.empty() &&
+                        ((activeSectorCount + createCount) >= m_viewRectSectorCount))
+                    {
+                        break;
+                    }
+                    ++createCount;
+                }
+
+                m_sectorBatch.push_back(m_updateWorkList.back());
+                m_updateWorkList.pop_back();
+            }
+
+            // Gather the surface points of all the sectors that need them.  The new points are gathered into separate sector
+            // infos, so the sectors in the rolling window don't need to be locked while this happens.
+            m_sectorBatchPoints.clear();
+            for (const auto& [sectorId, mode] : m_sectorBatch)
+            {
+                if (mode != UpdateMode::Fill)
+                {
+                    SectorInfo& sectorInfo = m_sectorBatchPoints.emplace_back();
+                    sectorInfo.m_id = sectorId;
+                    sectorInfo.m_bounds = VegetationThreadTasks::GetSectorBounds(sectorId, sectorSizeInMeters);
+                }
+            }
+            vegTasks->UpdateSectorPoints(m_sectorBatchPoints, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
 
-                auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
-                auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
-                auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+            // Fill the sectors one at a time, closest first.  Areas can look at the instances in neighboring sectors when they
+            // claim points, so filling the sectors in a fixed order keeps the claims deterministic.
+            auto sectorPoints = m_sectorBatchPoints.begin();
+            for (size_t batchIndex = 0; batchIndex < m_sectorBatch.size(); ++batchIndex)
+            {
+                if (threadData->m_vegetationThreadState == PersistentThreadData::VegetationThreadState::InterruptRequested)
+                {
+                    // Put the rest of the batch back on the work list, closest sector last, so that it isn't lost.
+                    for (size_t remainingIndex = m_sectorBatch.size(); remainingIndex > batchIndex; --remainingIndex)
+                    {
+                        m_updateWorkList.push_back(m_sectorBatch[remainingIndex - 1]);
+                    }
+                    break;
+                }
+
+                const auto& [sectorId, mode] = m_sectorBatch[batchIndex];
+
+                AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
 
                 switch (mode)
                 {
@@ -1800,7 +1898,9 @@ namespace Vegetation
                     {
                         auto sectorInfo = vegTasks->GetSector(sectorId);
                         AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        sectorInfo->m_baseContext.m_masks = AZStd::move(sectorPoints->m_baseContext.m_masks);
+                        sectorInfo->m_baseContext.m_availablePoints = AZStd::move(sectorPoints->m_baseContext.m_availablePoints);
+                        ++sectorPoints;
                         vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                     }
                     break;
@@ -1816,7 +1916,8 @@ namespace Vegetation
                     case UpdateMode::Create:
                     {
                         AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        auto sectorInfo = vegTasks->AddSector(AZStd::move(*sectorPoints));
+                        ++sectorPoints;
                         vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                     }
                     break;
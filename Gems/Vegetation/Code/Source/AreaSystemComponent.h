@@ -15,7 +15,9 @@
 #include <AzCore/std/parallel/semaphore.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/containers/span.h>
 #include <GradientSignal/Ebuses/SectorDataRequestBus.h>
+#include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/SurfaceDataSystemNotificationBus.h>
 #include <CrySystemBus.h>
 #include <ISystem.h>
@@ -287,8 +289,12 @@ namespace Vegetation
             const SectorInfo* GetSector(const SectorId& sectorId) const;
             SectorInfo* GetSector(const SectorId& sectorId);
 
-            SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
-            void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Add a new sector, whose surface points have already been gathered, to the rolling window.
+            SectorInfo* AddSector(SectorInfo&& sectorInfo);
+
+            //! Gather the surface points for a batch of sectors. The sectors don't depend on each other, so their surface points
+            //! get gathered in parallel on the task graph when it's available.
+            void UpdateSectorPoints(AZStd::span<SectorInfo> sectors, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
             void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
             void DeleteSector(const SectorId& sectorId);
             void ClearSectors();
@@ -307,6 +313,10 @@ namespace Vegetation
             SectorRollingWindow m_sectorRollingWindow;
 
         private:
+            void UpdateSectorPoints(
+                SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode,
+                const SurfaceData::SurfaceDataSystemRequests* surfaceDataSystem, SurfaceData::PackedSurfacePointList& surfacePoints) const;
+
             // claiming logic
             void CreateClaim(SectorInfo& sectorInfo, const ClaimHandle handle, const InstanceData& instanceData);
             ClaimHandle CreateClaimHandle(const SectorInfo& sectorInfo, uint32_t index) const;
@@ -334,6 +344,11 @@ namespace Vegetation
             //! Note: This is only updated from the vegetation thread when processing vegetation tasks.
             UnregisteredVegetationAreaMap m_unregisteredVegetationAreaSet;
 
+            //! The surface points of each sector in the batch that's being updated. These are reused between batches so that the
+            //! surface point queries don't need to allocate.
+            //! Note: These are only used by the vegetation thread and the tasks that it waits on when updating sector points.
+            AZStd::vector<SurfaceData::PackedSurfacePointList> m_sectorSurfacePoints;
+
             //! Cached pointer to the debug data.
             //! Note: This doesn't have an associated mutex because DebugData itself consists purely of atomics
             DebugData* m_debugData = nullptr;
@@ -425,7 +440,7 @@ namespace Vegetation
 
         private:
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
-            bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            bool UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
 
             enum class UpdateMode
             {
@@ -442,6 +457,16 @@ namespace Vegetation
             // be recalculated.
             AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateWorkList;
 
+            // The maximum number of sectors that get created / updated together in one batch.  The surface points of the sectors in
+            // a batch are gathered in parallel, and then the sectors are filled one at a time, closest first.
+            static constexpr size_t MaxSectorBatchSize = 16;
+
+            // The batch of update requests that's currently being processed, closest sector first.
+            AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_sectorBatch;
+
+            // The new surface points of the sectors in the batch that get created or rebuilt, in batch order.
+            AZStd::vector<SectorInfo> m_sectorBatchPoints;
+
             // Sector counts of the number of expected sectors in the view rectangle vs the number of sectors
             // currently active.  These are used to "load balance" sector deletes and creates so that we don't have
             // too many sectors active at any one point in time.
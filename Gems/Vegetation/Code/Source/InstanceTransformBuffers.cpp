@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Vegetation/InstanceTransformBuffers.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace Vegetation
+{
+    size_t InstanceTransformBuffers::Sector::GetMemoryUsage() const
+    {
+        return sizeof(Sector) +
+            ((m_positionsX.capacity() + m_positionsY.capacity() + m_positionsZ.capacity() + m_scales.capacity()) * sizeof(float)) +
+            (m_rotations.capacity() * sizeof(AZ::Quaternion)) + (m_handles.capacity() * sizeof(Handle));
+    }
+
+    InstanceTransformBuffers::InstanceTransformBuffers(float sectorSizeInMeters)
+    {
+        SetSectorSize(sectorSizeInMeters);
+    }
+
+    void InstanceTransformBuffers::SetSectorSize(float sectorSizeInMeters)
+    {
+        AZ_Assert(sectorSizeInMeters > 0.0f, "Instance transform buffer sectors need a positive size.");
+
+        AZStd::unique_lock<decltype(m_bufferMutex)> lock(m_bufferMutex);
+        ClearInternal();
+        m_sectorSizeInMeters = AZ::GetMax(sectorSizeInMeters, 1.0f);
+        m_worldToSector = 1.0f / m_sectorSizeInMeters;
+    }
+
+    float InstanceTransformBuffers::GetSectorSize() const
+    {
+        AZStd::shared_lock<decltype(m_bufferMutex)> lock(m_bufferMutex);
+        return m_sectorSizeInMeters;
+    }
+
+    InstanceTransformBuffers::Handle InstanceTransformBuffers::AddInstance(
+        const AZ::Vector3& position, const AZ::Quaternion& rotation, float scale)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::unique_lock<decltype(m_bufferMutex)> lock(m_bufferMutex);
+
+        const AZ::s32 sectorX = aznumeric_cast<AZ::s32>(floorf(position.GetX() * m_worldToSector));
+        const AZ::s32 sectorY = aznumeric_cast<AZ::s32>(floorf(position.GetY() * m_worldToSector));
+        Sector& sector = GetOrCreateSector(MakeSectorKey(sectorX, sectorY), sectorX, sectorY);
+
+        // Reuse a free slot for the handle if there is one.
+        Handle handle = m_firstFreeSlot;
+        if (handle != InvalidHandle)
+        {
+            m_firstFreeSlot = m_slots[handle].m_index;
+        }
+        else
+        {
+            AZ_Assert(m_slots.size() < InvalidHandle, "Too many instances in the instance transform buffers.");
+            handle = aznumeric_cast<Handle>(m_slots.size());
+            m_slots.emplace_back();
+        }
+
+        Slot& slot = m_slots[handle];
+        slot.m_sector = &sector;
+        slot.m_index = aznumeric_cast<AZ::u32>(sector.m_handles.size());
+
+        sector.m_positionsX.push_back(position.GetX());
+        sector.m_positionsY.push_back(position.GetY());
+        sector.m_positionsZ.push_back(position.GetZ());
+        sector.m_rotations.push_back(rotation);
+        sector.m_scales.push_back(scale);
+        sector.m_handles.push_back(handle);
+
+        ++m_instanceCount;
+        return handle;
+    }
+
+    void InstanceTransformBuffers::RemoveInstance(Handle handle)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::unique_lock<decltype(m_bufferMutex)> lock(m_bufferMutex);
+
+        if ((handle >= m_slots.size()) || !m_slots[handle].m_sector)
+        {
+            AZ_Assert(false, "Removing an instance with an invalid handle (%u) from the instance transform buffers.", handle);
+            return;
+        }
+
+        Slot& slot = m_slots[handle];
+        Sector& sector = *slot.m_sector;
+        const AZ::u32 index = slot.m_index;
+        const AZ::u32 lastIndex = aznumeric_cast<AZ::u32>(sector.m_handles.size() - 1);
+
+        // Move the last instance of the sector into the place of the removed one, so that the buffers stay densely packed.
+        if (index != lastIndex)
+        {
+            sector.m_positionsX[index] = sector.m_positionsX[lastIndex];
+            sector.m_positionsY[index] = sector.m_positionsY[lastIndex];
+            sector.m_positionsZ[index] = sector.m_positionsZ[lastIndex];
+            sector.m_rotations[index] = sector.m_rotations[lastIndex];
+            sector.m_scales[index] = sector.m_scales[lastIndex];
+            sector.m_handles[index] = sector.m_handles[lastIndex];
+            m_slots[sector.m_handles[index]].m_index = index;
+        }
+
+        sector.m_positionsX.pop_back();
+        sector.m_positionsY.pop_back();
+        sector.m_positionsZ.pop_back();
+        sector.m_rotations.pop_back();
+        sector.m_scales.pop_back();
+        sector.m_handles.pop_back();
+
+        // Empty sectors keep their memory, since vegetation usually gets removed and recreated in the same sectors as
+        // the view moves and the vegetation gets refreshed.  The memory gets released by Clear().
+        slot.m_sector = nullptr;
+        slot.m_index = m_firstFreeSlot;
+        m_firstFreeSlot = handle;
+
+        --m_instanceCount;
+    }
+
+    void InstanceTransformBuffers::Clear()
+    {
+        AZStd::unique_lock<decltype(m_bufferMutex)> lock(m_bufferMutex);
+        ClearInternal();
+    }
+
+    void InstanceTransformBuffers::EnumerateSectors(const AZ::Aabb& bounds, const InstanceTransformBufferEnumerateCallback& callback) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::shared_lock<decltype(m_bufferMutex)> lock(m_bufferMutex);
+
+        auto visitSector = [&callback](const Sector& sector)
+        {
+            if (sector.m_handles.empty())
+            {
+                return AreaSystemEnumerateCallbackResult::KeepEnumerating;
+            }
+
+            InstanceTransformBufferView view;
+            view.m_sectorBounds = sector.m_bounds;
+            view.m_positionsX = sector.m_positionsX;
+            view.m_positionsY = sector.m_positionsY;
+            view.m_positionsZ = sector.m_positionsZ;
+            view.m_rotations = sector.m_rotations;
+            view.m_scales = sector.m_scales;
+            return callback(view);
+        };
+
+        if (!bounds.IsValid())
+        {
+            for (const auto& [key, sector] : m_sectors)
+            {
+                if (visitSector(sector) == AreaSystemEnumerateCallbackResult::StopEnumerating)
+                {
+                    return;
+                }
+            }
+            return;
+        }
+
+        // Look up the sectors within the bounds directly if that's cheaper than checking every sector for overlap.
+        const float minSectorX = floorf(bounds.GetMin().GetX() * m_worldToSector);
+        const float minSectorY = floorf(bounds.GetMin().GetY() * m_worldToSector);
+        const float maxSectorX = floorf(bounds.GetMax().GetX() * m_worldToSector);
+        const float maxSectorY = floorf(bounds.GetMax().GetY() * m_worldToSector);
+        const float boundsSectorCount = (maxSectorX - minSectorX + 1.0f) * (maxSectorY - minSectorY + 1.0f);
+
+        if (boundsSectorCount <= aznumeric_cast<float>(m_sectors.size()))
+        {
+            for (AZ::s32 sectorY = aznumeric_cast<AZ::s32>(minSectorY); sectorY <= aznumeric_cast<AZ::s32>(maxSectorY); ++sectorY)
+            {
+                for (AZ::s32 sectorX = aznumeric_cast<AZ::s32>(minSectorX); sectorX <= aznumeric_cast<AZ::s32>(maxSectorX); ++sectorX)
+                {
+                    auto sectorItr = m_sectors.find(MakeSectorKey(sectorX, sectorY));
+                    if ((sectorItr != m_sectors.end()) &&
+                        (visitSector(sectorItr->second) == AreaSystemEnumerateCallbackResult::StopEnumerating))
+                    {
+                        return;
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (const auto& [key, sector] : m_sectors)
+            {
+                if (sector.m_bounds.Overlaps(bounds) && (visitSector(sector) == AreaSystemEnumerateCallbackResult::StopEnumerating))
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    size_t InstanceTransformBuffers::GetInstanceCount() const
+    {
+        AZStd::shared_lock<decltype(m_bufferMutex)> lock(m_bufferMutex);
+        return m_instanceCount;
+    }
+
+    size_t InstanceTransformBuffers::GetSectorCount() const
+    {
+        AZStd::shared_lock<decltype(m_bufferMutex)> lock(m_bufferMutex);
+        return m_sectors.size();
+    }
+
+    size_t InstanceTransformBuffers::GetMemoryUsage() const
+    {
+        AZStd::shared_lock<decltype(m_bufferMutex)> lock(m_bufferMutex);
+
+        // Include the map node overhead of each sector: the key, the value and a pointer to the next node.
+        size_t memoryUsage = (m_slots.capacity() * sizeof(Slot)) + (m_sectors.bucket_count() * sizeof(void*));
+        for (const auto& [key, sector] : m_sectors)
+        {
+            memoryUsage += sizeof(SectorKey) + sizeof(void*) + sector.GetMemoryUsage();
+        }
+        return memoryUsage;
+    }
+
+    InstanceTransformBuffers::SectorKey InstanceTransformBuffers::MakeSectorKey(AZ::s32 sectorX, AZ::s32 sectorY)
+    {
+        return (static_cast<SectorKey>(static_cast<AZ::u32>(sectorX)) << 32) | static_cast<SectorKey>(static_cast<AZ::u32>(sectorY));
+    }
+
+    InstanceTransformBuffers::Sector& InstanceTransformBuffers::GetOrCreateSector(SectorKey key, AZ::s32 sectorX, AZ::s32 sectorY)
+    {
+        auto [sectorItr, inserted] = m_sectors.try_emplace(key);
+        Sector& sector = sectorItr->second;
+        if (inserted)
+        {
+            // The sector bounds are unbounded in Z, like the vegetation sectors of the area system.
+            sector.m_bounds = AZ::Aabb::CreateFromMinMax(
+                AZ::Vector3(
+                    aznumeric_cast<float>(sectorX) * m_sectorSizeInMeters, aznumeric_cast<float>(sectorY) * m_sectorSizeInMeters,
+                    -AZ::Constants::FloatMax),
+                AZ::Vector3(
+                    aznumeric_cast<float>(sectorX + 1) * m_sectorSizeInMeters, aznumeric_cast<float>(sectorY + 1) * m_sectorSizeInMeters,
+                    AZ::Constants::FloatMax));
+        }
+        return sector;
+    }
+
+    void InstanceTransformBuffers::ClearInternal()
+    {
+        m_sectors.clear();
+        m_slots.clear();
+        m_slots.shrink_to_fit();
+        m_firstFreeSlot = InvalidHandle;
+        m_instanceCount = 0;
+    }
+} // namespace Vegetation
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Vegetation/TransformBufferInstanceSpawner.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <Vegetation/InstanceData.h>
+
+namespace Vegetation
+{
+    namespace TransformBufferInstanceSpawnerUtil
+    {
+        // The handles of the instances are stored as opaque instance pointers. The vegetation system treats a null pointer as a
+        // failed instance creation, so the handles are offset by one.
+        static InstancePtr HandleToInstancePtr(InstanceTransformBuffers::Handle handle)
+        {
+            return reinterpret_cast<InstancePtr>(static_cast<uintptr_t>(handle) + 1);
+        }
+
+        static InstanceTransformBuffers::Handle InstancePtrToHandle(InstancePtr instance)
+        {
+            return static_cast<InstanceTransformBuffers::Handle>(reinterpret_cast<uintptr_t>(instance) - 1);
+        }
+    }
+
+    void TransformBufferInstanceSpawner::Reflect(AZ::ReflectContext* context)
+    {
+        AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serialize)
+        {
+            serialize->Class<TransformBufferInstanceSpawner, InstanceSpawner>()
+                ->Version(0)
+                ->Field("BufferName", &TransformBufferInstanceSpawner::m_bufferName)
+                ->Field("SectorSizeInMeters", &TransformBufferInstanceSpawner::m_sectorSizeInMeters)
+                ;
+
+            AZ::EditContext* edit = serialize->GetEditContext();
+            if (edit)
+            {
+                edit->Class<TransformBufferInstanceSpawner>(
+                    "Transform Buffer", "Lightweight instances that are written into per-sector transform buffers instead of entities")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, AZ::Edit::PropertyVisibility::ShowChildrenOnly)
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &TransformBufferInstanceSpawner::m_bufferName, "Buffer Name",
+                        "Name that renderers and physics use to identify the instances in the buffers")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &TransformBufferInstanceSpawner::m_sectorSizeInMeters, "Sector Size",
+                        "Size in meters of the sectors that the instances are grouped into")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1.0f)
+                    ->Attribute(AZ::Edit::Attributes::Suffix, " m")
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &TransformBufferInstanceSpawner::SectorSizeChanged)
+                    ;
+            }
+        }
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<TransformBufferInstanceSpawner>()
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Category, "Vegetation")
+                ->Attribute(AZ::Script::Attributes::Module, "vegetation")
+                ->Constructor()
+                ->Method("GetBufferName", &TransformBufferInstanceSpawner::GetBufferName)
+                ->Method("SetBufferName", &TransformBufferInstanceSpawner::SetBufferName)
+                ->Method("GetSectorSizeInMeters", &TransformBufferInstanceSpawner::GetSectorSizeInMeters)
+                ->Method("SetSectorSizeInMeters", &TransformBufferInstanceSpawner::SetSectorSizeInMeters)
+                ;
+        }
+    }
+
+    TransformBufferInstanceSpawner::~TransformBufferInstanceSpawner()
+    {
+        InstanceTransformBufferRequestBus::Handler::BusDisconnect();
+    }
+
+    bool TransformBufferInstanceSpawner::DataIsEquivalent(const InstanceSpawner& baseRhs) const
+    {
+        if (const auto* rhs = azrtti_cast<const TransformBufferInstanceSpawner*>(&baseRhs))
+        {
+            return (m_bufferName == rhs->m_bufferName) && (m_sectorSizeInMeters == rhs->m_sectorSizeInMeters);
+        }
+
+        // Not the same subtypes, so definitely not a data match.
+        return false;
+    }
+
+    void TransformBufferInstanceSpawner::OnRegisterUniqueDescriptor()
+    {
+        // The same spawner can be shared by several unique descriptors, so only connect on the first registration.
+        if (m_registrationCount++ == 0)
+        {
+            // The sector size may have been changed through serialization since the buffers were created.
+            if (m_buffers.GetSectorSize() != m_sectorSizeInMeters)
+            {
+                SectorSizeChanged();
+            }
+            InstanceTransformBufferRequestBus::Handler::BusConnect();
+        }
+    }
+
+    void TransformBufferInstanceSpawner::OnReleaseUniqueDescriptor()
+    {
+        AZ_Assert(m_registrationCount > 0, "Releasing a transform buffer spawner that was never registered.");
+        if ((m_registrationCount > 0) && (--m_registrationCount == 0))
+        {
+            InstanceTransformBufferRequestBus::Handler::BusDisconnect();
+        }
+    }
+
+    AZStd::string TransformBufferInstanceSpawner::GetName() const
+    {
+        return m_bufferName.empty() ? "<transform buffer>" : m_bufferName;
+    }
+
+    InstancePtr TransformBufferInstanceSpawner::CreateInstance(const InstanceData& instanceData)
+    {
+        const InstanceTransformBuffers::Handle handle =
+            m_buffers.AddInstance(instanceData.m_position, instanceData.m_alignment * instanceData.m_rotation, instanceData.m_scale);
+        return TransformBufferInstanceSpawnerUtil::HandleToInstancePtr(handle);
+    }
+
+    void TransformBufferInstanceSpawner::DestroyInstance([[maybe_unused]] InstanceId id, InstancePtr instance)
+    {
+        if (instance)
+        {
+            m_buffers.RemoveInstance(TransformBufferInstanceSpawnerUtil::InstancePtrToHandle(instance));
+        }
+    }
+
+    AZStd::string TransformBufferInstanceSpawner::GetBufferName() const
+    {
+        return m_bufferName;
+    }
+
+    void TransformBufferInstanceSpawner::SetBufferName(const AZStd::string& bufferName)
+    {
+        m_bufferName = bufferName;
+    }
+
+    float TransformBufferInstanceSpawner::GetSectorSizeInMeters() const
+    {
+        return m_sectorSizeInMeters;
+    }
+
+    void TransformBufferInstanceSpawner::SetSectorSizeInMeters(float sectorSizeInMeters)
+    {
+        m_sectorSizeInMeters = sectorSizeInMeters;
+        SectorSizeChanged();
+    }
+
+    AZ::u32 TransformBufferInstanceSpawner::SectorSizeChanged()
+    {
+        // Changing the sector size removes all of the instances, so it's only applied directly while there aren't any.
+        // Otherwise it gets applied the next time that the spawner gets registered with the vegetation system, after
+        // the descriptors get refreshed.
+        if (m_buffers.GetInstanceCount() == 0)
+        {
+            m_buffers.SetSectorSize(m_sectorSizeInMeters);
+        }
+        return AZ::Edit::PropertyRefreshLevels::None;
+    }
+
+    void TransformBufferInstanceSpawner::EnumerateInstanceTransformBuffers(
+        const AZ::Aabb& bounds, const InstanceTransformBufferSpawnerCallback& callback) const
+    {
+        m_buffers.EnumerateSectors(bounds, [this, &callback](const InstanceTransformBufferView& view)
+        {
+            return callback(*this, view);
+        });
+    }
+
+    void TransformBufferInstanceSpawner::GetInstanceTransformBufferStats(size_t& instanceCount, size_t& memoryUsage) const
+    {
+        instanceCount += m_buffers.GetInstanceCount();
+        memoryUsage += m_buffers.GetMemoryUsage();
+    }
+
+} // namespace Vegetation
@@ -19,6 +19,7 @@
 #include <Vegetation/Ebuses/InstanceSystemRequestBus.h>
 #include <Vegetation/InstanceSpawner.h>
 #include <Vegetation/EmptyInstanceSpawner.h>
+#include <Vegetation/TransformBufferInstanceSpawner.h>
 #include <Vegetation/DynamicSliceInstanceSpawner.h>
 #include <Vegetation/PrefabInstanceSpawner.h>
 
@@ -73,6 +74,7 @@ namespace Vegetation
         EmptyInstanceSpawner::Reflect(context);
         DynamicSliceInstanceSpawner::Reflect(context);
         PrefabInstanceSpawner::Reflect(context);
+        TransformBufferInstanceSpawner::Reflect(context);
         Descriptor::Reflect(context);
         AreaConfig::Reflect(context);
         AreaComponentBase::Reflect(context);
@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "VegetationTest.h"
+#include "VegetationMocks.h"
+
+#include <AzCore/Component/Entity.h>
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Vegetation/InstanceData.h>
+#include <Vegetation/TransformBufferInstanceSpawner.h>
+#include <Vegetation/Ebuses/InstanceTransformBufferRequestBus.h>
+
+namespace UnitTest
+{
+    // Mock VegetationSystemComponent is needed to reflect only the TransformBufferInstanceSpawner.
+    class MockTransformBufferVegetationSystemComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(MockTransformBufferVegetationSystemComponent, "{4E1B3C55-2B0A-4A0D-8C61-7F5D4E3A9B21}", AZ::Component);
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflect)
+        {
+            Vegetation::InstanceSpawner::Reflect(reflect);
+            Vegetation::TransformBufferInstanceSpawner::Reflect(reflect);
+        }
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+        {
+            provided.push_back(AZ_CRC("VegetationSystemService", 0xa2322728));
+        }
+    };
+
+    class TransformBufferInstanceSpawnerTests
+        : public VegetationComponentTests
+    {
+    public:
+        void RegisterComponentDescriptors() override
+        {
+            m_app.RegisterComponentDescriptor(MockTransformBufferVegetationSystemComponent::CreateDescriptor());
+        }
+
+        static Vegetation::InstanceData CreateInstanceData(const AZ::Vector3& position, float scale = 1.0f)
+        {
+            Vegetation::InstanceData instanceData;
+            instanceData.m_position = position;
+            instanceData.m_scale = scale;
+            return instanceData;
+        }
+
+        // Gather all of the instance positions and scales in the buffers of a spawner.
+        static AZStd::vector<AZStd::pair<AZ::Vector3, float>> GetInstances(
+            const Vegetation::TransformBufferInstanceSpawner& instanceSpawner, const AZ::Aabb& bounds = AZ::Aabb::CreateNull())
+        {
+            AZStd::vector<AZStd::pair<AZ::Vector3, float>> instances;
+            instanceSpawner.GetInstanceTransformBuffers().EnumerateSectors(bounds,
+                [&instances](const Vegetation::InstanceTransformBufferView& view)
+                {
+                    EXPECT_EQ(view.m_positionsX.size(), view.GetInstanceCount());
+                    EXPECT_EQ(view.m_positionsY.size(), view.GetInstanceCount());
+                    EXPECT_EQ(view.m_positionsZ.size(), view.GetInstanceCount());
+                    EXPECT_EQ(view.m_rotations.size(), view.GetInstanceCount());
+                    for (size_t index = 0; index < view.GetInstanceCount(); ++index)
+                    {
+                        const AZ::Vector3 position(view.m_positionsX[index], view.m_positionsY[index], view.m_positionsZ[index]);
+                        EXPECT_TRUE(view.m_sectorBounds.Contains(position));
+                        instances.emplace_back(position, view.m_scales[index]);
+                    }
+                    return Vegetation::AreaSystemEnumerateCallbackResult::KeepEnumerating;
+                });
+            return instances;
+        }
+    };
+
+    TEST_F(TransformBufferInstanceSpawnerTests, BasicInitializationTest)
+    {
+        // Basic test to make sure we can construct / destroy without errors.
+
+        Vegetation::TransformBufferInstanceSpawner instanceSpawner;
+        EXPECT_EQ(instanceSpawner.GetInstanceTransformBuffers().GetInstanceCount(), 0);
+    }
+
+    TEST_F(TransformBufferInstanceSpawnerTests, SpawnersWithSameSettingsAreEqual)
+    {
+        // Two spawners are only data-equivalent if they write into the same kind of buffers.
+
+        Vegetation::TransformBufferInstanceSpawner instanceSpawner1;
+        Vegetation::TransformBufferInstanceSpawner instanceSpawner2;
+        EXPECT_TRUE(instanceSpawner1 == instanceSpawner2);
+
+        instanceSpawner2.SetBufferName("grass");
+        EXPECT_FALSE(instanceSpawner1 == instanceSpawner2);
+
+        instanceSpawner1.SetBufferName("grass");
+        instanceSpawner1.SetSectorSizeInMeters(32.0f);
+        EXPECT_FALSE(instanceSpawner1 == instanceSpawner2);
+    }
+
+    TEST_F(TransformBufferInstanceSpawnerTests, CreateAndDestroyInstances)
+    {
+        // Instances should get written into the buffers of the sectors that contain them, and destroying an instance
+        // should leave the other instances intact.
+
+        Vegetation::TransformBufferInstanceSpawner instanceSpawner;
+        instanceSpawner.SetSectorSizeInMeters(16.0f);
+
+        AZStd::vector<Vegetation::InstancePtr> instances;
+        instances.push_back(instanceSpawner.CreateInstance(CreateInstanceData(AZ::Vector3(1.0f, 1.0f, 5.0f), 1.0f)));
+        instances.push_back(instanceSpawner.CreateInstance(CreateInstanceData(AZ::Vector3(2.0f, 2.0f, 5.0f), 2.0f)));
+        instances.push_back(instanceSpawner.CreateInstance(CreateInstanceData(AZ::Vector3(3.0f, 3.0f, 5.0f), 3.0f)));
+        instances.push_back(instanceSpawner.CreateInstance(CreateInstanceData(AZ::Vector3(-20.0f, 40.0f, 5.0f), 4.0f)));
+        for (auto instance : instances)
+        {
+            EXPECT_TRUE(instance);
+        }
+
+        const auto& buffers = instanceSpawner.GetInstanceTransformBuffers();
+        EXPECT_EQ(buffers.GetInstanceCount(), 4);
+        EXPECT_EQ(buffers.GetSectorCount(), 2);
+        EXPECT_EQ(GetInstances(instanceSpawner).size(), 4);
+
+        // Destroy an instance from the middle of a sector, which moves the last instance of the sector into its place.
+        instanceSpawner.DestroyInstance(0, instances[1]);
+        auto remainingInstances = GetInstances(instanceSpawner);
+        ASSERT_EQ(remainingInstances.size(), 3);
+        for (const auto& [position, scale] : remainingInstances)
+        {
+            EXPECT_NE(scale, 2.0f);
+        }
+
+        // The handle of the moved instance should still refer to it.
+        instanceSpawner.DestroyInstance(0, instances[2]);
+        remainingInstances = GetInstances(instanceSpawner);
+        ASSERT_EQ(remainingInstances.size(), 2);
+        for (const auto& [position, scale] : remainingInstances)
+        {
+            EXPECT_NE(scale, 3.0f);
+        }
+
+        instanceSpawner.DestroyInstance(0, instances[0]);
+        instanceSpawner.DestroyInstance(0, instances[3]);
+        EXPECT_EQ(buffers.GetInstanceCount(), 0);
+        EXPECT_TRUE(GetInstances(instanceSpawner).empty());
+    }
+
+    TEST_F(TransformBufferInstanceSpawnerTests, EnumerateOnlyOverlappingSectors)
+    {
+        // Enumerating the buffers with bounds should only visit the sectors that overlap the bounds.
+
+        Vegetation::TransformBufferInstanceSpawner instanceSpawner;
+        instanceSpawner.SetSectorSizeInMeters(16.0f);
+
+        AZStd::vector<Vegetation::InstancePtr> instances;
+        for (float y = -64.0f; y < 64.0f; y += 4.0f)
+        {
+            for (float x = -64.0f; x < 64.0f; x += 4.0f)
+            {
+                instances.push_back(instanceSpawner.CreateInstance(CreateInstanceData(AZ::Vector3(x, y, 0.0f))));
+            }
+        }
+        EXPECT_EQ(instanceSpawner.GetInstanceTransformBuffers().GetSectorCount(), 64);
+
+        // The bounds overlap the 2 x 2 sectors around the origin, which contain 4 x 4 instances each.
+        const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-8.0f, -8.0f, -1.0f), AZ::Vector3(8.0f, 8.0f, 1.0f));
+        EXPECT_EQ(GetInstances(instanceSpawner, bounds).size(), 64);
+
+        for (auto instance : instances)
+        {
+            instanceSpawner.DestroyInstance(0, instance);
+        }
+    }
+
+    TEST_F(TransformBufferInstanceSpawnerTests, RegisteredSpawnersAreQueryableThroughBus)
+    {
+        // Spawners should only be queryable through the bus while they are registered with the vegetation system.
+
+        Vegetation::TransformBufferInstanceSpawner instanceSpawner;
+        auto instance = instanceSpawner.CreateInstance(CreateInstanceData(AZ::Vector3(1.0f, 1.0f, 1.0f)));
+
+        auto getBusInstanceCount = []()
+        {
+            size_t instanceCount = 0;
+            Vegetation::InstanceTransformBufferRequestBus::Broadcast(
+                &Vegetation::InstanceTransformBufferRequestBus::Events::EnumerateInstanceTransformBuffers, AZ::Aabb::CreateNull(),
+                [&instanceCount](const Vegetation::InstanceSpawner&, const Vegetation::InstanceTransformBufferView& view)
+                {
+                    instanceCount += view.GetInstanceCount();
+                    return Vegetation::AreaSystemEnumerateCallbackResult::KeepEnumerating;
+                });
+            return instanceCount;
+        };
+
+        EXPECT_EQ(getBusInstanceCount(), 0);
+
+        instanceSpawner.OnRegisterUniqueDescriptor();
+        EXPECT_EQ(getBusInstanceCount(), 1);
+
+        size_t instanceCount = 0;
+        size_t memoryUsage = 0;
+        Vegetation::InstanceTransformBufferRequestBus::Broadcast(
+            &Vegetation::InstanceTransformBufferRequestBus::Events::GetInstanceTransformBufferStats, instanceCount, memoryUsage);
+        EXPECT_EQ(instanceCount, 1);
+        EXPECT_GT(memoryUsage, 0);
+
+        instanceSpawner.OnReleaseUniqueDescriptor();
+        EXPECT_EQ(getBusInstanceCount(), 0);
+
+        instanceSpawner.DestroyInstance(0, instance);
+    }
+
+    TEST_F(TransformBufferInstanceSpawnerTests, DescriptorCreatesCorrectSpawner)
+    {
+        // Validate that the Descriptor successfully creates a new TransformBufferInstanceSpawner if we change
+        // the spawner type on the Descriptor.
+
+        MockTransformBufferVegetationSystemComponent* component = nullptr;
+        auto entity = CreateEntity(&component);
+
+        Vegetation::Descriptor descriptor;
+        EXPECT_TRUE(azrtti_typeid(*(descriptor.GetInstanceSpawner())) != Vegetation::TransformBufferInstanceSpawner::RTTI_Type());
+        descriptor.m_spawnerType = Vegetation::TransformBufferInstanceSpawner::RTTI_Type();
+        descriptor.RefreshSpawnerTypeList();
+        descriptor.SpawnerTypeChanged();
+        EXPECT_TRUE(azrtti_typeid(*(descriptor.GetInstanceSpawner())) == Vegetation::TransformBufferInstanceSpawner::RTTI_Type());
+    }
+
+#ifdef HAVE_BENCHMARK
+    class TransformBufferInstanceSpawnerBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        // Create instances on a 1 meter grid, which places 256 instances in every 16 x 16 meter sector.
+        static void CreateInstances(
+            Vegetation::TransformBufferInstanceSpawner& instanceSpawner, size_t instanceCount, AZStd::vector<Vegetation::InstancePtr>& instances)
+        {
+            const size_t gridSize = aznumeric_cast<size_t>(ceilf(sqrtf(aznumeric_cast<float>(instanceCount))));
+            Vegetation::InstanceData instanceData;
+            for (size_t index = 0; index < instanceCount; ++index)
+            {
+                instanceData.m_position = AZ::Vector3(aznumeric_cast<float>(index % gridSize), aznumeric_cast<float>(index / gridSize), 0.0f);
+                instances.push_back(instanceSpawner.CreateInstance(instanceData));
+            }
+        }
+    };
+
+    BENCHMARK_DEFINE_F(TransformBufferInstanceSpawnerBenchmark, BM_CreateInstances)(benchmark::State& state)
+    {
+        const size_t instanceCount = aznumeric_cast<size_t>(state.range(0));
+        AZStd::vector<Vegetation::InstancePtr> instances;
+        instances.reserve(instanceCount);
+        size_t memoryUsage = 0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            Vegetation::TransformBufferInstanceSpawner instanceSpawner;
+            instances.clear();
+            state.ResumeTiming();
+
+            CreateInstances(instanceSpawner, instanceCount, instances);
+
+            state.PauseTiming();
+            memoryUsage = instanceSpawner.GetInstanceTransformBuffers().GetMemoryUsage();
+            for (auto instance : instances)
+            {
+                instanceSpawner.DestroyInstance(0, instance);
+            }
+            state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(instanceCount * state.iterations());
+        state.counters["BytesPerInstance"] = aznumeric_cast<double>(memoryUsage) / aznumeric_cast<double>(instanceCount);
+    }
+
+    BENCHMARK_DEFINE_F(TransformBufferInstanceSpawnerBenchmark, BM_DestroyInstances)(benchmark::State& state)
+    {
+        const size_t instanceCount = aznumeric_cast<size_t>(state.range(0));
+        AZStd::vector<Vegetation::InstancePtr> instances;
+        instances.reserve(instanceCount);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            Vegetation::TransformBufferInstanceSpawner instanceSpawner;
+            instances.clear();
+            CreateInstances(instanceSpawner, instanceCount, instances);
+            state.ResumeTiming();
+
+            for (auto instance : instances)
+            {
+                instanceSpawner.DestroyInstance(0, instance);
+            }
+        }
+
+        state.SetItemsProcessed(instanceCount * state.iterations());
+    }
+
+    BENCHMARK_DEFINE_F(TransformBufferInstanceSpawnerBenchmark, BM_RecreateInstances)(benchmark::State& state)
+    {
+        // Destroy and recreate every instance, which is what happens when the vegetation in the view gets refreshed.
+        // The buffers and handles get reused, so this shouldn't allocate at all.
+        const size_t instanceCount = aznumeric_cast<size_t>(state.range(0));
+        AZStd::vector<Vegetation::InstancePtr> instances;
+        instances.reserve(instanceCount);
+
+        Vegetation::TransformBufferInstanceSpawner instanceSpawner;
+        CreateInstances(instanceSpawner, instanceCount, instances);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto instance : instances)
+            {
+                instanceSpawner.DestroyInstance(0, instance);
+            }
+            instances.clear();
+            CreateInstances(instanceSpawner, instanceCount, instances);
+        }
+
+        state.SetItemsProcessed(instanceCount * state.iterations());
+        state.counters["BytesPerInstance"] =
+            aznumeric_cast<double>(instanceSpawner.GetInstanceTransformBuffers().GetMemoryUsage()) / aznumeric_cast<double>(instanceCount);
+
+        for (auto instance : instances)
+        {
+            instanceSpawner.DestroyInstance(0, instance);
+        }
+    }
+
+    BENCHMARK_DEFINE_F(TransformBufferInstanceSpawnerBenchmark, BM_EnumerateInstances)(benchmark::State& state)
+    {
+        const size_t instanceCount = aznumeric_cast<size_t>(state.range(0));
+        AZStd::vector<Vegetation::InstancePtr> instances;
+        instances.reserve(instanceCount);
+
+        Vegetation::TransformBufferInstanceSpawner instanceSpawner;
+        CreateInstances(instanceSpawner, instanceCount, instances);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            float totalHeight = 0.0f;
+            instanceSpawner.GetInstanceTransformBuffers().EnumerateSectors(AZ::Aabb::CreateNull(),
+                [&totalHeight](const Vegetation::InstanceTransformBufferView& view)
+                {
+                    for (float height : view.m_positionsZ)
+                    {
+                        totalHeight += height;
+                    }
+                    return Vegetation::AreaSystemEnumerateCallbackResult::KeepEnumerating;
+                });
+            benchmark::DoNotOptimize(totalHeight);
+        }
+
+        state.SetItemsProcessed(instanceCount * state.iterations());
+
+        for (auto instance : instances)
+        {
+            instanceSpawner.DestroyInstance(0, instance);
+        }
+    }
+
+    BENCHMARK_REGISTER_F(TransformBufferInstanceSpawnerBenchmark, BM_CreateInstances)
+        ->Arg(65536)
+        ->Arg(1048576)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(TransformBufferInstanceSpawnerBenchmark, BM_DestroyInstances)
+        ->Arg(65536)
+        ->Arg(1048576)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(TransformBufferInstanceSpawnerBenchmark, BM_RecreateInstances)
+        ->Arg(65536)
+        ->Arg(1048576)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(TransformBufferInstanceSpawnerBenchmark, BM_EnumerateInstances)
+        ->Arg(65536)
+        ->Arg(1048576)
+        ->Unit(::benchmark::kMillisecond);
+#endif
+}
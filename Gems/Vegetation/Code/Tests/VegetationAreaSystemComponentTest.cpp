@@ -15,12 +15,19 @@
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzFramework/Components/CameraBus.h>
 
 //////////////////////////////////////////////////////////////////////////
 
 #include <Vegetation/Ebuses/AreaSystemRequestBus.h>
 #include <VegetationModule.h>
 #include <AreaSystemComponent.h>
+#include <Tests/VegetationMocks.h>
+#include <SurfaceData/SurfaceDataSystemNotificationBus.h>
+#include <GradientSignal/GradientSampler.h>
 
 namespace UnitTest
 {
@@ -112,18 +119,11 @@ namespace UnitTest
         }
     };
 
-    // Test harness for the vegetation system that starts up / shuts down all the vegetation system components.
-    class VegetationTestApp
-        : public ::testing::Test
+    // Starts up / shuts down an application with all the vegetation system components.
+    class VegetationTestApplication
     {
     public:
-        VegetationTestApp()
-            : m_application()
-            , m_systemEntity(nullptr)
-        {
-        }
-
-        void SetUp() override
+        void Start()
         {
             AZ::ComponentApplication::Descriptor appDesc;
             appDesc.m_memoryBlocksByteSize = 50 * 1024 * 1024;
@@ -143,15 +143,219 @@ namespace UnitTest
             m_systemEntity->Activate();
         }
 
-        void TearDown() override
+        void Stop()
         {
             m_systemEntity->Deactivate();
             m_application.Destroy();
         }
 
         AZ::ComponentApplication m_application;
-        AZ::Entity* m_systemEntity;
+        AZ::Entity* m_systemEntity = nullptr;
+    };
+
+    // Test harness for the vegetation system that starts up / shuts down all the vegetation system components.
+    class VegetationTestApp
+        : public ::testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            m_testApplication.Start();
+        }
+
+        void TearDown() override
+        {
+            m_testApplication.Stop();
+        }
+
+        VegetationTestApplication m_testApplication;
+    };
+
+    // Provides the active camera to the vegetation system, so that it has a view rectangle of sectors to fill.
+    struct MockActiveCamera
+        : public Camera::CameraSystemRequestBus::Handler
+        , public MockTransformBus
+    {
+        MockActiveCamera(const AZ::Vector3& position)
+            : m_position(position)
+        {
+            Camera::CameraSystemRequestBus::Handler::BusConnect();
+            AZ::TransformBus::Handler::BusConnect(m_cameraId);
+        }
+
+        ~MockActiveCamera()
+        {
+            AZ::TransformBus::Handler::BusDisconnect();
+            Camera::CameraSystemRequestBus::Handler::BusDisconnect();
+        }
+
+        AZ::EntityId GetActiveCamera() override
+        {
+            return m_cameraId;
+        }
+
+        AZ::Vector3 GetWorldTranslation() override
+        {
+            return m_position;
+        }
+
+        AZ::EntityId m_cameraId = AZ::EntityId(AZ::Entity::MakeId());
+        AZ::Vector3 m_position;
+    };
+
+    // A vegetation area that claims every point of every sector. The claims are made from the vegetation thread, so they are counted
+    // with an atomic.
+    struct MockClaimAllArea
+        : public Vegetation::AreaRequestBus::Handler
+    {
+        MockClaimAllArea()
+        {
+            Vegetation::AreaRequestBus::Handler::BusConnect(m_areaId);
+        }
+
+        ~MockClaimAllArea()
+        {
+            Vegetation::AreaRequestBus::Handler::BusDisconnect();
+        }
+
+        bool PrepareToClaim([[maybe_unused]] Vegetation::EntityIdStack& stackIds) override
+        {
+            return true;
+        }
+
+        void ClaimPositions([[maybe_unused]] Vegetation::EntityIdStack& stackIds, Vegetation::ClaimContext& context) override
+        {
+            for (const auto& point : context.m_availablePoints)
+            {
+                Vegetation::InstanceData instanceData;
+                instanceData.m_id = m_areaId;
+                instanceData.m_position = point.m_position;
+                context.m_createdCallback(point, instanceData);
+            }
+            context.m_availablePoints.clear();
+            ++m_claimCount;
+        }
+
+        void UnclaimPosition([[maybe_unused]] const Vegetation::ClaimHandle handle) override
+        {
+        }
+
+        AZ::EntityId m_areaId = AZ::EntityId(AZ::Entity::MakeId());
+        AZStd::atomic_int m_claimCount{ 0 };
+    };
+
+    // A surface data system with a single flat surface whose mask weights come from a gradient, like a surface modifier that
+    // samples a gradient. Sampling the gradient locks the SurfaceDataSystemRequestBus from the vegetation tasks.
+    struct MockGradientSurfaceHandler
+        : public MockSurfaceHandler
+    {
+        MockGradientSurfaceHandler()
+        {
+            m_gradientSampler.m_gradientId = m_gradient.m_entity.GetId();
+            m_gradient.m_valueGetter = []()
+            {
+                return 0.5f;
+            };
+        }
+
+        void GetPackedSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceData::SurfaceTagVector& desiredTags,
+            SurfaceData::PackedSurfacePointList& surfacePointList) const override
+        {
+            surfacePointList.StartListConstruction(inRegion, stepSize);
+            for (size_t inputIndex = 0; inputIndex < surfacePointList.GetInputPositionCount(); ++inputIndex)
+            {
+                const AZ::Vector3 position(
+                    surfacePointList.GetInputPosition(inputIndex).GetX(), surfacePointList.GetInputPosition(inputIndex).GetY(),
+                    m_outPosition.GetZ());
+
+                SurfaceData::SurfaceTagWeightMap masks;
+                masks[AZ_CRC_CE("gradient_mask")] = m_gradientSampler.GetValue(GradientSignal::GradientSampleParams(position));
+                surfacePointList.AddSurfacePoint(inputIndex, AZ::EntityId(), position, m_outNormal, masks);
+                ++m_sampleCount;
+            }
+            surfacePointList.EndListConstruction(desiredTags);
+        }
 
+        MockGradientRequestHandler m_gradient;
+        GradientSignal::GradientSampler m_gradientSampler;
+        mutable AZStd::atomic_int m_sampleCount{ 0 };
+    };
+
+    // Sets up a camera, a flat surface and an area that claims all points, so that the vegetation system fills every sector
+    // in its view rectangle.
+    template<typename SurfaceHandler = MockSurfaceHandler>
+    struct VegetationSectorFillEnvironment
+    {
+        VegetationSectorFillEnvironment(int viewRectangleSize, int sectorDensity, int sectorSizeInMeters)
+            : m_camera(AZ::Vector3::CreateZero())
+        {
+            m_surfaceHandler.m_outPosition = AZ::Vector3::CreateZero();
+            m_surfaceHandler.m_outNormal = AZ::Vector3::CreateAxisZ();
+            m_surfaceHandler.m_outMasks[AZ_CRC_CE("test_mask")] = 1.0f;
+
+            Vegetation::AreaSystemConfig config;
+            config.m_viewRectangleSize = viewRectangleSize;
+            config.m_sectorDensity = sectorDensity;
+            config.m_sectorSizeInMeters = sectorSizeInMeters;
+            config.m_threadProcessingIntervalMs = 0;
+            Vegetation::SystemConfigurationRequestBus::Broadcast(
+                &Vegetation::SystemConfigurationRequestBus::Events::UpdateSystemConfig, &config);
+
+            Vegetation::AreaSystemRequestBus::Broadcast(
+                &Vegetation::AreaSystemRequestBus::Events::RegisterArea, m_area.m_areaId, 0, 0,
+                AZ::Aabb::CreateFromMinMax(AZ::Vector3(-WorldSize), AZ::Vector3(WorldSize)));
+        }
+
+        ~VegetationSectorFillEnvironment()
+        {
+            Vegetation::AreaSystemRequestBus::Broadcast(&Vegetation::AreaSystemRequestBus::Events::UnregisterArea, m_area.m_areaId);
+            TickUntil([]() { return false; }, AZStd::chrono::milliseconds(100));
+        }
+
+        // Tick the main thread until the vegetation thread has filled the given number of sectors.
+        bool WaitForSectorFills(int sectorFillCount)
+        {
+            return TickUntil([this, sectorFillCount]() { return m_area.m_claimCount >= sectorFillCount; }, AZStd::chrono::seconds(60));
+        }
+
+        // Mark the surface points of all the sectors as dirty, so that they all get rebuilt and filled again.
+        void RefreshAllSurfaces()
+        {
+            const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-WorldSize), AZ::Vector3(WorldSize));
+            SurfaceData::SurfaceDataSystemNotificationBus::Broadcast(
+                &SurfaceData::SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, AZ::EntityId(), bounds, bounds);
+        }
+
+        size_t GetInstanceCount() const
+        {
+            size_t instanceCount = 0;
+            Vegetation::AreaSystemRequestBus::BroadcastResult(
+                instanceCount, &Vegetation::AreaSystemRequestBus::Events::GetInstanceCountInAabb,
+                AZ::Aabb::CreateFromMinMax(AZ::Vector3(-WorldSize), AZ::Vector3(WorldSize)));
+            return instanceCount;
+        }
+
+        template<typename Condition, typename Duration>
+        static bool TickUntil(Condition condition, Duration timeout)
+        {
+            const auto endTime = AZStd::chrono::system_clock::now() + timeout;
+            while (AZStd::chrono::system_clock::now() < endTime)
+            {
+                AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint{});
+                if (condition())
+                {
+                    return true;
+                }
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+            return false;
+        }
+
+        static constexpr float WorldSize = 100000.0f;
+
+        SurfaceHandler m_surfaceHandler;
+        MockActiveCamera m_camera;
+        MockClaimAllArea m_area;
     };
 
     TEST_F(VegetationTestApp, Vegetation_AreaComponentTest_SuccessfulActivation)
@@ -159,5 +363,122 @@ namespace UnitTest
         // This test simply creates an environment that activates and deactivates the vegetation system components.
         // If it runs without asserting / crashing, then it is successful.
     }
+
+    TEST_F(VegetationTestApp, Vegetation_AreaSystemComponent_FillsAndRebuildsAllSectorsInViewRectangle)
+    {
+        // Use a view rectangle with more sectors than a single sector batch, so that sectors get created and rebuilt in several batches.
+        const int viewRectangleSize = 8;
+        const int sectorDensity = 4;
+        const int sectorCount = viewRectangleSize * viewRectangleSize;
+        const size_t expectedInstanceCount = sectorCount * sectorDensity * sectorDensity;
+
+        VegetationSectorFillEnvironment<> environment(viewRectangleSize, sectorDensity, 16);
+
+        // Every point of every sector should get claimed once the sectors have been created and filled.
+        ASSERT_TRUE(environment.WaitForSectorFills(sectorCount));
+        EXPECT_TRUE(VegetationSectorFillEnvironment<>::TickUntil(
+            [&environment, expectedInstanceCount]() { return environment.GetInstanceCount() == expectedInstanceCount; },
+            AZStd::chrono::seconds(10)));
+        EXPECT_EQ(environment.GetInstanceCount(), expectedInstanceCount);
+
+        // Rebuilding the surface points of all the sectors should fill every sector again with the same claims.
+        const int previousClaimCount = environment.m_area.m_claimCount;
+        environment.RefreshAllSurfaces();
+        ASSERT_TRUE(environment.WaitForSectorFills(previousClaimCount + sectorCount));
+        EXPECT_EQ(environment.GetInstanceCount(), expectedInstanceCount);
+    }
+
+    TEST_F(VegetationTestApp, Vegetation_AreaSystemComponent_FillsSectorsFromGradientSurfaceWhileModifiersRegister)
+    {
+        const int viewRectangleSize = 8;
+        const int sectorDensity = 4;
+        const int sectorCount = viewRectangleSize * viewRectangleSize;
+
+        VegetationSectorFillEnvironment<MockGradientSurfaceHandler> environment(viewRectangleSize, sectorDensity, 16);
+
+        // Register surface modifiers through the bus from the main thread while the vegetation tasks gather the surface points and
+        // sample the gradient, so that the bus gets locked from both sides while the sectors are being filled.
+        const bool sectorsFilled = VegetationSectorFillEnvironment<MockGradientSurfaceHandler>::TickUntil(
+            [&environment, sectorCount]()
+            {
+                SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                    &SurfaceData::SurfaceDataSystemRequestBus::Events::RegisterSurfaceDataModifier, SurfaceData::SurfaceDataRegistryEntry());
+                return environment.m_area.m_claimCount >= sectorCount;
+            },
+            AZStd::chrono::seconds(60));
+        ASSERT_TRUE(sectorsFilled);
+
+        // Every surface point should have sampled the gradient.
+        EXPECT_GE(environment.m_surfaceHandler.m_sampleCount.load(), sectorCount * sectorDensity * sectorDensity);
+        EXPECT_GE(environment.m_surfaceHandler.m_gradient.m_count, sectorCount * sectorDensity * sectorDensity);
+    }
+
+#ifdef HAVE_BENCHMARK
+    class VegetationAreaSystemBenchmark
+        : public ::benchmark::Fixture
+    {
+    public:
+        void internalSetUp()
+        {
+            m_testApplication.Start();
+        }
+
+        void internalTearDown()
+        {
+            m_testApplication.Stop();
+        }
+
+    protected:
+        void SetUp([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalSetUp();
+        }
+        void SetUp([[maybe_unused]] benchmark::State& state) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+        void TearDown([[maybe_unused]] benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+
+        VegetationTestApplication m_testApplication;
+    };
+
+    BENCHMARK_DEFINE_F(VegetationAreaSystemBenchmark, BM_FillSectors)(benchmark::State& state)
+    {
+        // Fill a view rectangle of 32 x 32 = 1024 sectors. Every iteration rebuilds the surface points of all the sectors and
+        // fills them again.
+        const int viewRectangleSize = 32;
+        const int sectorCount = viewRectangleSize * viewRectangleSize;
+        const int sectorDensity = aznumeric_cast<int>(state.range(0));
+
+        VegetationSectorFillEnvironment<> environment(viewRectangleSize, sectorDensity, 16);
+        if (!environment.WaitForSectorFills(sectorCount))
+        {
+            state.SkipWithError("Vegetation sectors were never filled.");
+            return;
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const int previousClaimCount = environment.m_area.m_claimCount;
+            environment.RefreshAllSurfaces();
+            environment.WaitForSectorFills(previousClaimCount + sectorCount);
+        }
+
+        state.SetItemsProcessed(sectorCount * state.iterations());
+    }
+
+    BENCHMARK_REGISTER_F(VegetationAreaSystemBenchmark, BM_FillSectors)
+        ->Arg(4)
+        ->Arg(20)
+        ->Unit(::benchmark::kMillisecond);
+#endif
 }
 
@@ -352,6 +352,28 @@ namespace UnitTest
         {
         }
 
+        // Returns one point per input position, at the height of m_outPosition. This can get called from multiple threads,
+        // so it doesn't update m_count.
+        void GetPackedSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceData::SurfaceTagVector& desiredTags,
+            SurfaceData::PackedSurfacePointList& surfacePointList) const override
+        {
+            surfacePointList.StartListConstruction(inRegion, stepSize);
+            for (size_t inputIndex = 0; inputIndex < surfacePointList.GetInputPositionCount(); ++inputIndex)
+            {
+                const AZ::Vector3& inPosition = surfacePointList.GetInputPosition(inputIndex);
+                surfacePointList.AddSurfacePoint(inputIndex, AZ::EntityId(),
+                    AZ::Vector3(inPosition.GetX(), inPosition.GetY(), m_outPosition.GetZ()), m_outNormal, m_outMasks);
+            }
+            surfacePointList.EndListConstruction(desiredTags);
+        }
+
+        void GetPackedSurfacePointsFromList(
+            [[maybe_unused]] AZStd::span<const AZ::Vector3> inPositions,
+            [[maybe_unused]] const SurfaceData::SurfaceTagVector& desiredTags,
+            [[maybe_unused]] SurfaceData::PackedSurfacePointList& surfacePointList) const override
+        {
+        }
+
         SurfaceData::SurfaceDataRegistryHandle RegisterSurfaceDataProvider([[maybe_unused]] const SurfaceData::SurfaceDataRegistryEntry& entry) override
         {
             ++m_count;
@@ -14,6 +14,8 @@ set(FILES
     Include/Vegetation/DynamicSliceInstanceSpawner.h
     Include/Vegetation/EmptyInstanceSpawner.h
     Include/Vegetation/PrefabInstanceSpawner.h
+    Include/Vegetation/TransformBufferInstanceSpawner.h
+    Include/Vegetation/InstanceTransformBuffers.h
     Include/Vegetation/AreaComponentBase.h
     Include/Vegetation/Ebuses/AreaSystemRequestBus.h
     Include/Vegetation/Ebuses/AreaNotificationBus.h
@@ -29,6 +31,7 @@ set(FILES
     Include/Vegetation/Ebuses/DescriptorSelectorRequestBus.h
     Include/Vegetation/Ebuses/FilterRequestBus.h
     Include/Vegetation/Ebuses/InstanceSystemRequestBus.h
+    Include/Vegetation/Ebuses/InstanceTransformBufferRequestBus.h
     Include/Vegetation/Ebuses/ModifierRequestBus.h
     Include/Vegetation/Ebuses/SystemConfigurationBus.h
     Include/Vegetation/Ebuses/ScaleModifierRequestBus.h
@@ -96,6 +99,8 @@ set(FILES
     Source/DynamicSliceInstanceSpawner.cpp
     Source/EmptyInstanceSpawner.cpp
     Source/PrefabInstanceSpawner.cpp
+    Source/TransformBufferInstanceSpawner.cpp
+    Source/InstanceTransformBuffers.cpp
     Source/VegetationSystemComponent.cpp
     Source/VegetationSystemComponent.h
     Source/InstanceData.cpp
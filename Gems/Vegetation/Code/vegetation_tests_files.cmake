@@ -15,6 +15,7 @@ set(FILES
     Tests/DynamicSliceInstanceSpawnerTests.cpp
     Tests/EmptyInstanceSpawnerTests.cpp
     Tests/PrefabInstanceSpawnerTests.cpp
+    Tests/TransformBufferInstanceSpawnerTests.cpp
     Tests/VegetationAreaSystemComponentTest.cpp
     Tests/VegetationTest.cpp
     Tests/VegetationTest.h